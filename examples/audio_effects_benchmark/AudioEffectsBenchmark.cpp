@@ -0,0 +1,121 @@
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include "SFML/Audio/AudioEffect.hpp"
+#include "SFML/Audio/BiquadFilter.hpp"
+#include "SFML/Audio/Compressor.hpp"
+#include "SFML/Audio/Echo.hpp"
+#include "SFML/Audio/EffectChain.hpp"
+#include "SFML/Audio/FirFilter.hpp"
+#include "SFML/Audio/Reverb.hpp"
+
+#include "SFML/System/Time.hpp"
+
+#include <BenchmarkUtils.hpp>
+
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <cstdlib>
+
+
+namespace
+{
+////////////////////////////////////////////////////////////
+constexpr unsigned int sampleRate   = 48'000u;
+constexpr unsigned int channelCount = 2u;
+constexpr unsigned int blockFrames  = 512u; // Typical size of a block requested by the audio engine
+constexpr unsigned int blockCount   = 1024u;
+constexpr unsigned int passCount    = 8u;
+
+
+////////////////////////////////////////////////////////////
+/// Process `passCount` times `blockCount` blocks of noise and print
+/// the throughput, ignoring the first pass which lets the effect settle
+///
+/// The effect runs on a single thread, so the result is the
+/// number of frames one core can process per second, which can
+/// be compared with the sample rate to get the real-time factor.
+///
+////////////////////////////////////////////////////////////
+void benchmark(const std::string& name, sf::AudioEffect& effect, const std::vector<float>& noise)
+{
+    std::vector<float> buffer(noise.size());
+
+    // Blocks are timed as a whole, as a single block is too short for the clock resolution
+    const sf::Time elapsed = bench::timeAverage(passCount,
+                                                [&] { buffer = noise; },
+                                                [&]
+                                                {
+                                                    for (unsigned int i = 0u; i < blockCount; ++i)
+                                                        effect.process(buffer.data() + i * blockFrames * channelCount,
+                                                                       blockFrames,
+                                                                       channelCount);
+                                                });
+
+    const double framesPerSecond = static_cast<double>(blockFrames) * blockCount /
+                                   static_cast<double>(elapsed.asSeconds());
+
+    bench::printResult(name, framesPerSecond, 0, "frames/s") << "  (" << std::setprecision(1)
+                                                             << framesPerSecond / sampleRate << "x real-time)" << '\n';
+}
+
+} // namespace
+
+
+////////////////////////////////////////////////////////////
+/// Main
+///
+////////////////////////////////////////////////////////////
+int main()
+{
+    std::minstd_rand                      rng(42u);
+    std::uniform_real_distribution<float> distribution(-1.f, 1.f);
+
+    std::vector<float> noise(blockFrames * channelCount * blockCount);
+
+    for (float& sample : noise)
+        sample = distribution(rng);
+
+    sf::BiquadFilter lowPass(sampleRate, sf::BiquadFilter::Type::LowPass, 2000.f);
+    sf::BiquadFilter peaking(sampleRate, sf::BiquadFilter::Type::Peaking, 1000.f, 1.f, 6.f);
+    sf::Echo         echo(sampleRate, sf::seconds(1.f), channelCount);
+    sf::Reverb       reverb(sampleRate);
+    sf::Compressor   compressor(sampleRate);
+
+    // Moving average, with a tap count typical of FIR equalizers
+    std::vector<float> taps(64);
+
+    for (std::size_t i = 0u; i < taps.size(); ++i)
+        taps[i] = 1.f / static_cast<float>(taps.size());
+
+    sf::FirFilter fir(taps.data(), taps.size());
+
+    sf::EffectChain chain;
+
+    for (sf::AudioEffect* effect : {static_cast<sf::AudioEffect*>(&lowPass),
+                                    static_cast<sf::AudioEffect*>(&peaking),
+                                    static_cast<sf::AudioEffect*>(&echo),
+                                    static_cast<sf::AudioEffect*>(&reverb),
+                                    static_cast<sf::AudioEffect*>(&compressor)})
+        if (!chain.add(*effect))
+        {
+            std::cerr << "Failed to add effect to chain" << '\n';
+            return EXIT_FAILURE;
+        }
+
+    std::cout << "Stereo, " << sampleRate << " Hz, " << blockFrames << " frames per block, single core" << '\n';
+
+    benchmark("biquad (low-pass)", lowPass, noise);
+    benchmark("biquad (peaking)", peaking, noise);
+    benchmark("echo", echo, noise);
+    benchmark("reverb", reverb, noise);
+    benchmark("compressor", compressor, noise);
+    benchmark("fir (64 taps)", fir, noise);
+    benchmark("chain (all but fir)", chain, noise);
+
+    return EXIT_SUCCESS;
+}
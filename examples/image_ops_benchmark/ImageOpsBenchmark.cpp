@@ -0,0 +1,134 @@
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include "SFML/Graphics/Color.hpp"
+#include "SFML/Graphics/Image.hpp"
+
+#include "SFML/System/Time.hpp"
+
+#include "SFML/Base/IntTypes.hpp"
+#include "SFML/Base/SizeT.hpp"
+
+#include <BenchmarkUtils.hpp>
+
+#include <algorithm>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <cstdlib>
+
+
+namespace
+{
+////////////////////////////////////////////////////////////
+constexpr sf::Vector2u imageSize{4096u, 4096u}; // Texture atlas built at load time
+constexpr unsigned int passCount = 8u;
+
+
+////////////////////////////////////////////////////////////
+/// Time `func` over `passCount` passes and print the throughput,
+/// ignoring the first pass which warms up the caches
+///
+////////////////////////////////////////////////////////////
+template <typename F>
+void benchmark(const std::string& name, F&& func)
+{
+    const sf::Time elapsed    = bench::timeAverage(passCount, func);
+    const double   pixelCount = static_cast<double>(imageSize.x) * imageSize.y;
+
+    bench::printResult(name, bench::perMicrosecond(pixelCount, elapsed), 1, "pixels/us") << '\n';
+}
+
+
+////////////////////////////////////////////////////////////
+/// Pixel by pixel blending, as `sf::Image::copy` used to do
+///
+////////////////////////////////////////////////////////////
+void scalarBlendOver(const sf::base::U8* src, sf::base::U8* dst, sf::base::SizeT pixelCount)
+{
+    for (sf::base::SizeT i = 0u; i < pixelCount * 4u; i += 4u)
+    {
+        const sf::base::U8 srcAlpha = src[i + 3];
+        const sf::base::U8 dstAlpha = dst[i + 3];
+        const auto         outAlpha = static_cast<sf::base::U8>(srcAlpha + dstAlpha - srcAlpha * dstAlpha / 255);
+
+        dst[i + 3] = outAlpha;
+
+        if (outAlpha)
+            for (int k = 0; k < 3; k++)
+                dst[i + k] = static_cast<sf::base::U8>((src[i + k] * srcAlpha + dst[i + k] * (outAlpha - srcAlpha)) /
+                                                       outAlpha);
+        else
+            for (int k = 0; k < 3; k++)
+                dst[i + k] = src[i + k];
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+/// Byte by byte color-key, as `sf::Image::createMaskFromColor` used to do
+///
+////////////////////////////////////////////////////////////
+void scalarMask(sf::base::U8* ptr, sf::base::SizeT pixelCount, sf::Color color, sf::base::U8 alpha)
+{
+    for (sf::base::U8* const end = ptr + pixelCount * 4u; ptr != end; ptr += 4)
+        if ((ptr[0] == color.r) && (ptr[1] == color.g) && (ptr[2] == color.b) && (ptr[3] == color.a))
+            ptr[3] = alpha;
+}
+
+} // namespace
+
+
+////////////////////////////////////////////////////////////
+/// Main
+///
+////////////////////////////////////////////////////////////
+int main()
+{
+    const sf::base::SizeT pixelCount = static_cast<sf::base::SizeT>(imageSize.x) * imageSize.y;
+
+    std::minstd_rand          rng(42u);
+    std::vector<sf::base::U8> pixels(pixelCount * 4u);
+
+    for (sf::base::U8& component : pixels)
+        component = static_cast<sf::base::U8>(rng());
+
+    const sf::Image source = sf::Image::create(imageSize, pixels.data()).value();
+    sf::Image       image  = sf::Image::create(imageSize, pixels.data()).value();
+
+    std::vector<sf::base::U8> scalarPixels = pixels;
+
+    std::cout << imageSize.x << "x" << imageSize.y << " random RGBA pixels, single core" << '\n';
+
+    benchmark("copy with alpha, scalar", [&] { scalarBlendOver(pixels.data(), scalarPixels.data(), pixelCount); });
+    benchmark("copy with alpha", [&] { (void)image.copy(source, {0u, 0u}, {}, /* applyAlpha */ true); });
+
+    benchmark("createMaskFromColor, scalar",
+              [&] { scalarMask(scalarPixels.data(), pixelCount, sf::Color::Magenta, 0u); });
+    benchmark("createMaskFromColor", [&] { image.createMaskFromColor(sf::Color::Magenta); });
+
+    benchmark("flipHorizontally, scalar",
+              [&]
+              {
+                  // Swap the four components of each pair of pixels, as `sf::Image::flipHorizontally` used to do
+                  for (sf::base::SizeT y = 0u; y < imageSize.y; ++y)
+                  {
+                      sf::base::U8* left  = scalarPixels.data() + y * imageSize.x * 4u;
+                      sf::base::U8* right = left + (imageSize.x - 1u) * 4u;
+
+                      for (; left < right; left += 4, right -= 4)
+                          std::swap_ranges(left, left + 4, right);
+                  }
+              });
+    benchmark("flipHorizontally", [&] { image.flipHorizontally(); });
+    benchmark("flipVertically", [&] { image.flipVertically(); });
+
+    benchmark("fillRect", [&] { image.fillRect({{0, 0}, imageSize.to<sf::Vector2i>()}, sf::Color::Red); });
+    benchmark("premultiplyAlpha", [&] { image.premultiplyAlpha(); });
+    benchmark("unpremultiplyAlpha", [&] { image.unpremultiplyAlpha(); });
+    benchmark("swizzleChannels", [&] { image.swizzleChannels(2u, 1u, 0u, 3u); });
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,114 @@
+#pragma once
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include "SFML/System/Clock.hpp"
+#include "SFML/System/Time.hpp"
+
+#include <iomanip>
+#include <iostream>
+#include <ostream>
+#include <string_view>
+
+
+////////////////////////////////////////////////////////////
+/// Timing and printing helpers shared by the benchmark examples
+///
+////////////////////////////////////////////////////////////
+namespace bench
+{
+////////////////////////////////////////////////////////////
+/// Width of the name column of `printResult`
+///
+////////////////////////////////////////////////////////////
+inline constexpr int nameWidth = 40;
+
+
+////////////////////////////////////////////////////////////
+/// Run `func` once and return how long it took
+///
+////////////////////////////////////////////////////////////
+template <typename F>
+[[nodiscard]] sf::Time timeOnce(F&& func)
+{
+    const sf::Clock clock;
+    func();
+    return clock.getElapsedTime();
+}
+
+
+////////////////////////////////////////////////////////////
+/// Run `func` `passCount` times and return the average time of
+/// all passes but the first, which warms up the caches
+///
+/// `reset` runs before each pass, outside of the timed section,
+/// e.g. to restore the input that `func` modifies in place.
+///
+////////////////////////////////////////////////////////////
+template <typename Reset, typename F>
+[[nodiscard]] sf::Time timeAverage(unsigned int passCount, Reset&& reset, F&& func)
+{
+    sf::Time elapsed;
+
+    for (unsigned int pass = 0u; pass < passCount; ++pass)
+    {
+        reset();
+
+        const sf::Time passTime = timeOnce(func);
+
+        if (pass > 0u)
+            elapsed += passTime;
+    }
+
+    return elapsed / static_cast<float>(passCount - 1u);
+}
+
+
+////////////////////////////////////////////////////////////
+/// Run `func` `passCount` times and return the average time of
+/// all passes but the first, which warms up the caches
+///
+////////////////////////////////////////////////////////////
+template <typename F>
+[[nodiscard]] sf::Time timeAverage(unsigned int passCount, F&& func)
+{
+    return timeAverage(passCount, [] {}, func);
+}
+
+
+////////////////////////////////////////////////////////////
+/// Return how many of `count` items were processed per microsecond
+///
+////////////////////////////////////////////////////////////
+[[nodiscard]] inline double perMicrosecond(double count, sf::Time time)
+{
+    return count / static_cast<double>(time.asMicroseconds());
+}
+
+
+////////////////////////////////////////////////////////////
+/// Return `time` in milliseconds
+///
+////////////////////////////////////////////////////////////
+[[nodiscard]] inline double toMilliseconds(sf::Time time)
+{
+    return static_cast<double>(time.asMicroseconds()) / 1000.0;
+}
+
+
+////////////////////////////////////////////////////////////
+/// Print an indented result row, with `name` and `value` in
+/// aligned columns followed by `unit`
+///
+/// The line is not terminated, so that callers can append
+/// more columns.
+///
+////////////////////////////////////////////////////////////
+inline std::ostream& printResult(std::string_view name, double value, int precision, std::string_view unit)
+{
+    return std::cout << "  " << std::left << std::setw(nameWidth) << name << std::right << std::setw(10)
+                     << std::fixed << std::setprecision(precision) << value << ' ' << unit;
+}
+
+} // namespace bench
@@ -16,8 +16,8 @@
 #include "SFML/Window/Keyboard.hpp"
 
 #include "SFML/System/Clock.hpp"
+#include "SFML/System/JobSystem.hpp"
 #include "SFML/System/Path.hpp"
-#include "SFML/System/Sleep.hpp"
 #include "SFML/System/String.hpp"
 #include "SFML/System/Time.hpp"
 #include "SFML/System/Vector2.hpp"
@@ -28,17 +28,13 @@
 
 #include <algorithm>
 #include <array>
-#include <deque>
 #include <iostream>
-#include <mutex>
 #include <sstream>
-#include <thread>
 #include <vector>
 
 #include <cmath>
 #include <cstdint>
 #include <cstdlib>
-#include <cstring>
 
 
 namespace
@@ -49,41 +45,8 @@ constexpr sf::Vector2u windowSize{800u, 600u};
 // Resolution of the generated terrain
 constexpr sf::Vector2u resolution{800u, 600u};
 
-// Thread pool parameters
-constexpr unsigned int threadCount = 4u;
-constexpr unsigned int blockCount  = 32u;
-
-struct WorkItem
-{
-    sf::Vertex*  targetBuffer{};
-    unsigned int index{};
-};
-
-struct ThreadPool
-{
-    std::mutex               poolMutex;
-    std::vector<std::thread> threads;
-    std::deque<WorkItem>     workQueue;
-    unsigned int             pendingWorkCount    = 0u;
-    bool                     bufferUploadPending = false;
-    bool                     finished            = false;
-
-    explicit ThreadPool() = default;
-
-    ThreadPool(const ThreadPool&) = delete;
-    ThreadPool(ThreadPool&&)      = delete;
-
-    ~ThreadPool()
-    {
-        {
-            const std::lock_guard lock(poolMutex);
-            finished = true;
-        }
-
-        for (std::thread& t : threads)
-            t.join();
-    }
-};
+// Number of row blocks the terrain is split in, each generated by its own job
+constexpr unsigned int blockCount = 32u;
 
 struct Setting
 {
@@ -303,21 +266,20 @@ sf::Vertex computeVertex(sf::Vector2u position)
 
 
 ////////////////////////////////////////////////////////////
-/// Process a terrain generation work item. Use the vector
-/// of vertices as scratch memory and upload the data to
-/// the vertex buffer when done.
+/// Generate the rows of a block of terrain directly into
+/// their place in the target buffer.
 ///
 ////////////////////////////////////////////////////////////
-void processWorkItem(std::vector<sf::Vertex>& vertices, const WorkItem& workItem)
+void generateBlock(sf::Vertex* targetBuffer, unsigned int blockIndex)
 {
     const unsigned int rowBlockSize = (resolution.y / blockCount) + 1;
-    const unsigned int rowStart     = rowBlockSize * workItem.index;
+    const unsigned int rowStart     = rowBlockSize * blockIndex;
 
     if (rowStart >= resolution.y)
         return;
 
     const unsigned int rowEnd   = std::min(rowStart + rowBlockSize, resolution.y);
-    const unsigned int rowCount = rowEnd - rowStart;
+    sf::Vertex* const  vertices = targetBuffer + (resolution.x * rowStart * 6);
 
     for (unsigned int y = rowStart; y < rowEnd; ++y)
     {
@@ -369,96 +331,26 @@ void processWorkItem(std::vector<sf::Vertex>& vertices, const WorkItem& workItem
             }
         }
     }
-
-    // Copy the resulting geometry from our thread-local buffer into the target buffer
-    std::memcpy(workItem.targetBuffer + (resolution.x * rowStart * 6),
-                vertices.data(),
-                sizeof(sf::Vertex) * resolution.x * rowCount * 6);
 }
 
 
 ////////////////////////////////////////////////////////////
-/// Worker thread entry point. We use a thread pool to avoid
-/// the heavy cost of constantly recreating and starting
-/// new threads whenever we need to regenerate the terrain.
+/// Terrain generation entry point. This schedules one job
+/// per block of rows, plus a final job depending on all of
+/// them whose completion means that the terrain is ready.
 ///
 ////////////////////////////////////////////////////////////
-void threadFunction(ThreadPool& threadPool)
+[[nodiscard]] sf::JobHandle generateTerrain(sf::JobSystem& jobSystem, sf::Vertex* buffer)
 {
-    const unsigned int rowBlockSize = (resolution.y / blockCount) + 1;
-
-    std::vector<sf::Vertex> vertices(resolution.x * rowBlockSize * 6);
-
-    WorkItem workItem{nullptr, 0};
-
-    // Loop until the application exits
-    for (;;)
-    {
-        workItem.targetBuffer = nullptr;
-
-        // Check if there are new work items in the queue
-        {
-            const std::lock_guard lock(threadPool.poolMutex);
+    // Make sure the previous generation is over before overwriting its buffer
+    jobSystem.waitAll();
 
-            if (threadPool.finished)
-                return;
+    sf::JobHandle blockJobs[blockCount];
 
-            if (!threadPool.workQueue.empty())
-            {
-                workItem = threadPool.workQueue.front();
-                threadPool.workQueue.pop_front();
-            }
-        }
-
-        // If we didn't receive a new work item, keep looping
-        if (workItem.targetBuffer == nullptr)
-        {
-            sf::sleep(sf::milliseconds(10));
-            continue;
-        }
+    for (unsigned int i = 0u; i < blockCount; ++i)
+        blockJobs[i] = jobSystem.schedule([buffer, i] { generateBlock(buffer, i); });
 
-        processWorkItem(vertices, workItem);
-
-        {
-            const std::lock_guard lock(threadPool.poolMutex);
-            --threadPool.pendingWorkCount;
-        }
-    }
-}
-
-
-////////////////////////////////////////////////////////////
-/// Terrain generation entry point. This queues up the
-/// generation work items which the worker threads dequeue
-/// and process.
-///
-////////////////////////////////////////////////////////////
-void generateTerrain(ThreadPool& threadPool, sf::Vertex* buffer)
-{
-    threadPool.bufferUploadPending = true;
-
-    // Make sure the work queue is empty before queuing new work
-    for (;;)
-    {
-        {
-            const std::lock_guard lock(threadPool.poolMutex);
-
-            if (threadPool.pendingWorkCount == 0u)
-                break;
-        }
-
-        sf::sleep(sf::milliseconds(10));
-    }
-
-    // Queue all the new work items
-    {
-        const std::lock_guard lock(threadPool.poolMutex);
-
-        for (unsigned int i = 0u; i < blockCount; ++i)
-            threadPool.workQueue.emplace_back(buffer, i);
-
-        threadPool.pendingWorkCount = blockCount;
-    }
+    return jobSystem.schedule([] {}, blockJobs);
 }
 
 } // namespace
@@ -504,12 +396,8 @@ int main()
     // Staging buffer for our terrain data that we will upload to our VertexBuffer
     std::vector<sf::Vertex> terrainStagingBuffer;
 
-    // Create a thread pool
-    ThreadPool threadPool;
-
-    // Start up our thread pool
-    for (unsigned int i = 0; i < threadCount; ++i)
-        threadPool.threads.emplace_back([&threadPool] { threadFunction(threadPool); });
+    // Create a job system, its worker threads generate the terrain in the background
+    sf::JobSystem jobSystem;
 
     // Create our VertexBuffer with enough space to hold all the terrain geometry
     if (!terrain.create(resolution.x * resolution.y * 6))
@@ -522,7 +410,8 @@ int main()
     terrainStagingBuffer.resize(resolution.x * resolution.y * 6);
 
     // Generate the initial terrain
-    generateTerrain(threadPool, terrainStagingBuffer.data());
+    sf::JobHandle terrainJob          = generateTerrain(jobSystem, terrainStagingBuffer.data());
+    bool          bufferUploadPending = true;
 
     // Set up the render states
     terrainStates = sf::RenderStates{.shader = &terrainShader};
@@ -561,7 +450,8 @@ int main()
                 switch (event->getIf<sf::Event::KeyPressed>()->code)
                 {
                     case sf::Keyboard::Key::Enter:
-                        generateTerrain(threadPool, terrainStagingBuffer.data());
+                        terrainJob          = generateTerrain(jobSystem, terrainStagingBuffer.data());
+                        bufferUploadPending = true;
                         break;
                     case sf::Keyboard::Key::Down:
                         currentSetting = (currentSetting + 1) % settings.size();
@@ -586,27 +476,23 @@ int main()
 
         window.draw(statusText);
 
+        // Don't bother updating/drawing the VertexBuffer while terrain is being regenerated
+        if (jobSystem.isDone(terrainJob))
         {
-            const std::lock_guard lock(threadPool.poolMutex);
-
-            // Don't bother updating/drawing the VertexBuffer while terrain is being regenerated
-            if (threadPool.pendingWorkCount == 0u)
+            // If there is new data pending to be uploaded to the VertexBuffer, do it now
+            if (bufferUploadPending)
             {
-                // If there is new data pending to be uploaded to the VertexBuffer, do it now
-                if (threadPool.bufferUploadPending)
+                if (!terrain.update(terrainStagingBuffer.data()))
                 {
-                    if (!terrain.update(terrainStagingBuffer.data()))
-                    {
-                        std::cerr << "Failed to update vertex buffer" << std::endl;
-                        return EXIT_SUCCESS;
-                    }
-
-                    threadPool.bufferUploadPending = false;
+                    std::cerr << "Failed to update vertex buffer" << std::endl;
+                    return EXIT_SUCCESS;
                 }
 
-                terrainShader.setUniform(ulLightFactor, lightFactor);
-                window.draw(terrain, terrainStates);
+                bufferUploadPending = false;
             }
+
+            terrainShader.setUniform(ulLightFactor, lightFactor);
+            window.draw(terrain, terrainStates);
         }
 
         // Update and draw the HUD text
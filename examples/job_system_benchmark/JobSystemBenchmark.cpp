@@ -0,0 +1,130 @@
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include "SFML/System/JobSystem.hpp"
+#include "SFML/System/Time.hpp"
+
+#include "SFML/Base/SizeT.hpp"
+
+#include <BenchmarkUtils.hpp>
+
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <cmath>
+#include <cstdlib>
+
+
+namespace
+{
+////////////////////////////////////////////////////////////
+constexpr sf::base::SizeT width     = 1024u; // Size of the generated height map
+constexpr sf::base::SizeT height    = 1024u;
+constexpr sf::base::SizeT grainSize = 16u;   // Rows per `parallelFor` chunk
+constexpr unsigned int    passCount = 8u;
+
+
+////////////////////////////////////////////////////////////
+/// Some sums of waves, costly enough per sample to be compute bound
+///
+////////////////////////////////////////////////////////////
+[[nodiscard]] float computeHeight(sf::base::SizeT x, sf::base::SizeT y)
+{
+    const float fx = static_cast<float>(x) / static_cast<float>(width);
+    const float fy = static_cast<float>(y) / static_cast<float>(height);
+
+    float result    = 0.f;
+    float amplitude = 1.f;
+    float frequency = 2.f;
+
+    for (int octave = 0; octave < 8; ++octave)
+    {
+        result += amplitude * std::sin(fx * frequency + std::cos(fy * frequency * 1.3f));
+        amplitude *= 0.5f;
+        frequency *= 2.f;
+    }
+
+    return result;
+}
+
+
+////////////////////////////////////////////////////////////
+[[nodiscard]] std::string workersName(unsigned int workerCount)
+{
+    return std::to_string(workerCount) + " worker(s)";
+}
+
+
+////////////////////////////////////////////////////////////
+/// Print the time taken and the speedup over `reference`
+///
+////////////////////////////////////////////////////////////
+void printRow(const std::string& name, sf::Time elapsed, sf::Time reference)
+{
+    bench::printResult(name, bench::toMilliseconds(elapsed), 2, "ms")
+        << std::setw(10) << std::setprecision(2) << reference / elapsed << "x" << '\n';
+}
+
+} // namespace
+
+
+////////////////////////////////////////////////////////////
+/// Main
+///
+////////////////////////////////////////////////////////////
+int main()
+{
+    std::vector<float> heights(width * height);
+
+    const auto generateRows = [&](sf::base::SizeT begin, sf::base::SizeT end)
+    {
+        for (sf::base::SizeT y = begin; y < end; ++y)
+            for (sf::base::SizeT x = 0u; x < width; ++x)
+                heights[y * width + x] = computeHeight(x, y);
+    };
+
+    // Reference: the same work on the calling thread only
+    const sf::Time serial = bench::timeAverage(passCount, [&] { generateRows(0u, height); });
+
+    std::vector<unsigned int> workerCounts{0u, 1u, 3u, 7u};
+    if (const unsigned int defaultCount = sf::JobSystem::getDefaultWorkerCount(); defaultCount > 7u)
+        workerCounts.push_back(defaultCount);
+
+    std::cout << width << "x" << height << " height map, chunks of " << grainSize << " rows" << '\n';
+
+    printRow("plain loop", serial, serial);
+
+    for (const unsigned int workerCount : workerCounts)
+    {
+        sf::JobSystem jobSystem(workerCount);
+        const sf::Time elapsed = bench::timeAverage(passCount,
+                                                    [&] { jobSystem.parallelFor(height, grainSize, generateRows); });
+
+        printRow(workersName(workerCount), elapsed, serial);
+    }
+
+    // Scheduling overhead: many tiny jobs
+    constexpr int jobCount = 100'000;
+
+    std::cout << '\n' << jobCount << " empty jobs" << '\n';
+
+    for (const unsigned int workerCount : workerCounts)
+    {
+        sf::JobSystem jobSystem(workerCount);
+
+        const sf::Time elapsed = bench::timeAverage(passCount,
+                                                    [&]
+                                                    {
+                                                        for (int i = 0; i < jobCount; ++i)
+                                                            (void)jobSystem.schedule([] {});
+
+                                                        jobSystem.waitAll();
+                                                    });
+
+        bench::printResult(workersName(workerCount), bench::toMilliseconds(elapsed), 2, "ms") << '\n';
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,217 @@
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include "SFML/Graphics/Color.hpp"
+#include "SFML/Graphics/Image.hpp"
+#include "SFML/Graphics/ImageUtils.hpp"
+
+#include "SFML/System/FileInputStream.hpp"
+#include "SFML/System/MappedFileInputStream.hpp"
+#include "SFML/System/Path.hpp"
+
+#include "SFML/Base/Optional.hpp"
+
+#include <BenchmarkUtils.hpp>
+
+#include <fstream>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <cstddef>
+#include <cstdlib>
+
+
+namespace
+{
+////////////////////////////////////////////////////////////
+constexpr std::size_t  rawFileSize  = 64u * 1024u * 1024u;
+constexpr std::size_t  rawChunkSize = 4u * 1024u; // Typical size of a read issued by a decoder
+constexpr unsigned int imageSize    = 1024u;
+constexpr unsigned int passCount    = 8u;
+constexpr int          getSizeCalls = 100'000;
+
+
+////////////////////////////////////////////////////////////
+/// Print the average time of `func` over `passCount` passes
+///
+/// Files are read from the page cache, so the results measure
+/// the overhead of each loading path rather than disk speed.
+///
+////////////////////////////////////////////////////////////
+template <typename F>
+void benchmark(const std::string& name, F&& func)
+{
+    bench::printResult(name, bench::toMilliseconds(bench::timeAverage(passCount, func)), 2, "ms") << '\n';
+}
+
+
+////////////////////////////////////////////////////////////
+/// Read the whole stream in small chunks, as most decoders do
+///
+////////////////////////////////////////////////////////////
+[[nodiscard]] std::size_t readInChunks(sf::InputStream& stream)
+{
+    static std::vector<char> chunk(rawChunkSize);
+
+    std::size_t total = 0u;
+
+    while (const sf::base::Optional<std::size_t> count = stream.read(chunk.data(), chunk.size()))
+    {
+        if (*count == 0u)
+            break;
+
+        total += *count;
+    }
+
+    return total;
+}
+
+
+////////////////////////////////////////////////////////////
+[[noreturn]] void fail(const std::string& message)
+{
+    std::cerr << message << '\n';
+    std::exit(EXIT_FAILURE);
+}
+
+
+////////////////////////////////////////////////////////////
+void benchmarkRawReads(const sf::Path& path)
+{
+    std::cout << "Sequential reads of a " << rawFileSize / (1024u * 1024u) << " MiB file in " << rawChunkSize / 1024u
+              << " KiB chunks" << '\n';
+
+    benchmark("FileInputStream",
+              [&]
+              {
+                  auto stream = sf::FileInputStream::open(path);
+                  if (!stream.hasValue() || readInChunks(*stream) != rawFileSize)
+                      fail("Failed to read the file with FileInputStream");
+              });
+
+    benchmark("MappedFileInputStream",
+              [&]
+              {
+                  auto stream = sf::MappedFileInputStream::open(path);
+                  if (!stream.hasValue() || readInChunks(*stream) != rawFileSize)
+                      fail("Failed to read the file with MappedFileInputStream");
+              });
+
+    std::cout << '\n' << getSizeCalls << " calls to getSize()" << '\n';
+
+    auto fileStream   = sf::FileInputStream::open(path).value();
+    auto mappedStream = sf::MappedFileInputStream::open(path).value();
+
+    benchmark("FileInputStream",
+              [&]
+              {
+                  for (int i = 0; i < getSizeCalls; ++i)
+                      if (!fileStream.getSize().hasValue())
+                          fail("Failed to query the size with FileInputStream");
+              });
+
+    benchmark("MappedFileInputStream",
+              [&]
+              {
+                  for (int i = 0; i < getSizeCalls; ++i)
+                      if (!mappedStream.getSize().hasValue())
+                          fail("Failed to query the size with MappedFileInputStream");
+              });
+}
+
+
+////////////////////////////////////////////////////////////
+void benchmarkImageLoading(const sf::Path& path)
+{
+    std::cout << '\n' << "Decoding a " << imageSize << "x" << imageSize << " PNG image" << '\n';
+
+    benchmark("Image::loadFromFile",
+              [&]
+              {
+                  if (!sf::Image::loadFromFile(path).hasValue())
+                      fail("Failed to load the image from file");
+              });
+
+    benchmark("Image::loadFromStream(FileInputStream)",
+              [&]
+              {
+                  auto stream = sf::FileInputStream::open(path);
+                  if (!stream.hasValue() || !sf::Image::loadFromStream(*stream).hasValue())
+                      fail("Failed to load the image from a FileInputStream");
+              });
+
+    benchmark("Image::loadFromStream(Mapped...)",
+              [&]
+              {
+                  auto stream = sf::MappedFileInputStream::open(path);
+                  if (!stream.hasValue() || !sf::Image::loadFromStream(*stream).hasValue())
+                      fail("Failed to load the image from a MappedFileInputStream");
+              });
+
+    benchmark("Image::loadFromMemory(Mapped...)",
+              [&]
+              {
+                  auto stream = sf::MappedFileInputStream::open(path);
+                  if (!stream.hasValue() ||
+                      !sf::Image::loadFromMemory(stream->getData(), stream->getDataSize()).hasValue())
+                      fail("Failed to load the image from a mapping");
+              });
+}
+
+} // namespace
+
+
+////////////////////////////////////////////////////////////
+/// Main
+///
+////////////////////////////////////////////////////////////
+int main()
+{
+    const sf::Path rawPath   = sf::Path::tempDirectoryPath() / "sfml_loader_benchmark.bin";
+    const sf::Path imagePath = sf::Path::tempDirectoryPath() / "sfml_loader_benchmark.png";
+
+    std::minstd_rand rng(42u);
+
+    // Incompressible contents, so that the file system cannot shortcut anything
+    {
+        std::vector<char> contents(rawFileSize);
+
+        for (char& c : contents)
+            c = static_cast<char>(rng());
+
+        std::ofstream file(rawPath.to<std::string>(), std::ios::binary);
+        file.write(contents.data(), static_cast<std::streamsize>(contents.size()));
+
+        if (!file)
+            fail("Failed to write the raw benchmark file");
+    }
+
+    // Noise on a gradient, which keeps the PNG decoder busy without being a worst case
+    {
+        auto image = sf::Image::create({imageSize, imageSize}).value();
+
+        for (unsigned int y = 0u; y < imageSize; ++y)
+            for (unsigned int x = 0u; x < imageSize; ++x)
+            {
+                const auto noise = static_cast<sf::base::U8>(rng() % 32u);
+                image.setPixel({x, y},
+                               sf::Color{static_cast<sf::base::U8>(x / 4u + noise),
+                                         static_cast<sf::base::U8>(y / 4u + noise),
+                                         noise,
+                                         255u});
+            }
+
+        if (!sf::ImageUtils::saveToFile(image, imagePath))
+            fail("Failed to write the image benchmark file");
+    }
+
+    benchmarkRawReads(rawPath);
+    benchmarkImageLoading(imagePath);
+
+    [[maybe_unused]] const bool rawRemoved   = rawPath.remove();
+    [[maybe_unused]] const bool imageRemoved = imagePath.remove();
+
+    return EXIT_SUCCESS;
+}
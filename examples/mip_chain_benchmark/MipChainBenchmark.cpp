@@ -0,0 +1,84 @@
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include "SFML/Graphics/Image.hpp"
+#include "SFML/Graphics/ImageUtils.hpp"
+
+#include "SFML/System/JobSystem.hpp"
+
+#include "SFML/Base/IntTypes.hpp"
+#include "SFML/Base/SizeT.hpp"
+
+#include <BenchmarkUtils.hpp>
+
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <cstdlib>
+
+
+namespace
+{
+////////////////////////////////////////////////////////////
+constexpr sf::Vector2u imageSize{4096u, 4096u}; // Texture atlas built at load time
+constexpr unsigned int passCount = 4u;
+
+
+////////////////////////////////////////////////////////////
+/// Time `func` over `passCount` passes and print the average
+/// duration, ignoring the first pass which warms up the caches
+///
+////////////////////////////////////////////////////////////
+template <typename F>
+void benchmark(const std::string& name, F&& func)
+{
+    bench::printResult(name, bench::toMilliseconds(bench::timeAverage(passCount, func)), 1, "ms") << '\n';
+}
+
+} // namespace
+
+
+////////////////////////////////////////////////////////////
+/// Main
+///
+////////////////////////////////////////////////////////////
+int main()
+{
+    const sf::base::SizeT pixelCount = static_cast<sf::base::SizeT>(imageSize.x) * imageSize.y;
+
+    std::minstd_rand          rng(42u);
+    std::vector<sf::base::U8> pixels(pixelCount * 4u);
+
+    for (sf::base::U8& component : pixels)
+        component = static_cast<sf::base::U8>(rng());
+
+    const sf::Image image = sf::Image::create(imageSize, pixels.data()).value();
+
+    sf::JobSystem jobSystem;
+
+    std::cout << imageSize.x << "x" << imageSize.y << " random RGBA pixels, " << jobSystem.getWorkerCount()
+              << " workers" << '\n';
+
+    benchmark("resized 1/2, box",
+              [&] { (void)image.resized(imageSize / 2u, sf::Image::ResampleFilter::Box).value(); });
+    benchmark("resized 1/2, bilinear",
+              [&] { (void)image.resized(imageSize / 2u, sf::Image::ResampleFilter::Bilinear).value(); });
+    benchmark("resized 1/2, lanczos3",
+              [&] { (void)image.resized(imageSize / 2u, sf::Image::ResampleFilter::Lanczos3).value(); });
+    benchmark("resized 1/2, lanczos3, job system",
+              [&]
+              { (void)image.resized(imageSize / 2u, sf::Image::ResampleFilter::Lanczos3, &jobSystem).value(); });
+
+    benchmark("generateMipChain, box", [&] { (void)sf::ImageUtils::generateMipChain(image); });
+    benchmark("generateMipChain, box, job system",
+              [&] { (void)sf::ImageUtils::generateMipChain(image, &jobSystem); });
+    benchmark("generateMipChain, lanczos3, job system",
+              [&]
+              {
+                  (void)sf::ImageUtils::generateMipChain(image, &jobSystem, sf::Image::ResampleFilter::Lanczos3);
+              });
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,182 @@
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include "SFML/System/RectPacker.hpp"
+#include "SFML/System/Time.hpp"
+#include "SFML/System/Vector2.hpp"
+
+#include "SFML/Base/Optional.hpp"
+#include "SFML/Base/SizeT.hpp"
+
+#include <BenchmarkUtils.hpp>
+
+#include <algorithm>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <cstdlib>
+
+#define STBRP_STATIC
+#define STB_RECT_PACK_IMPLEMENTATION
+#include <stb_rect_pack.h>
+
+
+namespace
+{
+////////////////////////////////////////////////////////////
+constexpr sf::Vector2u    atlasSize{2048u, 2048u};
+constexpr sf::base::SizeT rectCount = 50'000u; // Small glyphs and sprites, more than fit in the atlas
+
+
+////////////////////////////////////////////////////////////
+/// Print the duration and the share of the atlas covered by
+/// the rectangles that were packed
+///
+////////////////////////////////////////////////////////////
+void report(const std::string& name, sf::Time elapsed, sf::base::SizeT packedCount, double packedArea)
+{
+    bench::printResult(name, bench::toMilliseconds(elapsed), 1, "ms")
+        << std::setw(8) << packedCount << " packed" << std::setw(8)
+        << 100.0 * packedArea / (static_cast<double>(atlasSize.x) * atlasSize.y) << "% occupancy" << '\n';
+}
+
+
+////////////////////////////////////////////////////////////
+/// stb_rect_pack with the settings that `sf::RectPacker` used
+/// to have: 2048 nodes, one rectangle per call
+///
+////////////////////////////////////////////////////////////
+void benchmarkStb(const std::vector<sf::Vector2u>& sizes, bool batch)
+{
+    std::vector<stbrp_node> nodes(2048u);
+    stbrp_context           context{};
+    stbrp_init_target(&context,
+                      static_cast<int>(atlasSize.x),
+                      static_cast<int>(atlasSize.y),
+                      nodes.data(),
+                      static_cast<int>(nodes.size()));
+
+    std::vector<stbrp_rect> rects(sizes.size());
+
+    for (sf::base::SizeT i = 0u; i < sizes.size(); ++i)
+        rects[i] = {static_cast<int>(i), static_cast<int>(sizes[i].x), static_cast<int>(sizes[i].y), 0, 0, 0};
+
+    const sf::Time elapsed = bench::timeOnce(
+        [&]
+        {
+            if (batch)
+                stbrp_pack_rects(&context, rects.data(), static_cast<int>(rects.size()));
+            else
+                for (stbrp_rect& rect : rects)
+                    stbrp_pack_rects(&context, &rect, 1);
+        });
+
+    sf::base::SizeT packedCount = 0u;
+    double          packedArea  = 0.0;
+
+    for (const stbrp_rect& rect : rects)
+        if (rect.was_packed != 0)
+        {
+            ++packedCount;
+            packedArea += static_cast<double>(rect.w) * rect.h;
+        }
+
+    report(batch ? "stb_rect_pack, batch" : "stb_rect_pack, one at a time", elapsed, packedCount, packedArea);
+}
+
+} // namespace
+
+
+////////////////////////////////////////////////////////////
+/// Main
+///
+////////////////////////////////////////////////////////////
+int main()
+{
+    std::minstd_rand                            rng(42u);
+    std::uniform_int_distribution<unsigned int> distribution(4u, 24u);
+
+    std::vector<sf::Vector2u> sizes(rectCount);
+
+    for (sf::Vector2u& size : sizes)
+        size = {distribution(rng), distribution(rng)};
+
+    std::cout << rectCount << " rectangles from 4x4 to 24x24 into a " << atlasSize.x << "x" << atlasSize.y
+              << " atlas" << '\n';
+
+    benchmarkStb(sizes, /* batch */ false);
+    benchmarkStb(sizes, /* batch */ true);
+
+    std::vector<sf::base::Optional<sf::Vector2u>> positions(sizes.size());
+
+    {
+        sf::RectPacker  rectPacker(atlasSize);
+        sf::base::SizeT packedCount = 0u;
+
+        const sf::Time elapsed = bench::timeOnce(
+            [&]
+            {
+                for (sf::base::SizeT i = 0u; i < sizes.size(); ++i)
+                {
+                    // Not `pack`, which logs every rectangle that does not fit
+                    positions[i].reset();
+                    packedCount += rectPacker.packMany({&sizes[i], 1u}, {&positions[i], 1u});
+                }
+            });
+
+        report("sf::RectPacker, one at a time",
+               elapsed,
+               packedCount,
+               rectPacker.getOccupancy() * static_cast<double>(atlasSize.x) * atlasSize.y);
+    }
+
+    sf::RectPacker rectPacker(atlasSize);
+
+    sf::base::SizeT packedCount = 0u;
+
+    const sf::Time elapsed = bench::timeOnce(
+        [&] { packedCount = rectPacker.packMany({sizes.data(), sizes.size()}, {positions.data(), positions.size()}); });
+
+    report("sf::RectPacker, batch",
+           elapsed,
+           packedCount,
+           rectPacker.getOccupancy() * static_cast<double>(atlasSize.x) * atlasSize.y);
+
+    // Free every other rectangle, then fill the atlas again, as a glyph cache evicting unused glyphs would
+    sf::base::SizeT removedCount = 0u;
+
+    const sf::Time removeElapsed = bench::timeOnce(
+        [&]
+        {
+            for (sf::base::SizeT i = 0u; i < sizes.size(); i += 2u)
+                if (positions[i].hasValue())
+                {
+                    rectPacker.remove(*positions[i], sizes[i]);
+                    ++removedCount;
+                }
+        });
+
+    bench::printResult("sf::RectPacker, remove every other", bench::toMilliseconds(removeElapsed), 1, "ms")
+        << std::setw(8) << removedCount << " removed" << '\n';
+
+    std::shuffle(sizes.begin(), sizes.end(), rng);
+
+    sf::base::SizeT refilledCount = 0u;
+
+    const sf::Time refillElapsed = bench::timeOnce(
+        [&]
+        {
+            refilledCount = rectPacker.packMany({sizes.data(), sizes.size()},
+                                                {positions.data(), positions.size()});
+        });
+
+    report("sf::RectPacker, refill after removals",
+           refillElapsed,
+           refilledCount,
+           rectPacker.getOccupancy() * static_cast<double>(atlasSize.x) * atlasSize.y);
+
+    return EXIT_SUCCESS;
+}
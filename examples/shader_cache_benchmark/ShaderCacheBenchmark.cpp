@@ -0,0 +1,118 @@
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include "SFML/Graphics/GraphicsContext.hpp"
+#include "SFML/Graphics/Shader.hpp"
+
+#include "SFML/System/Path.hpp"
+#include "SFML/System/Time.hpp"
+
+#include "SFML/Base/Optional.hpp"
+
+#include <BenchmarkUtils.hpp>
+
+#include <filesystem>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <cstdlib>
+
+
+namespace
+{
+////////////////////////////////////////////////////////////
+constexpr int variantCount = 64;
+
+
+////////////////////////////////////////////////////////////
+/// Generate a unique fragment shader, heavy enough for
+/// the compiler to spend a noticeable amount of time on it
+///
+////////////////////////////////////////////////////////////
+[[nodiscard]] std::string makeFragmentShader(unsigned int seed, int variant)
+{
+    std::string source = R"glsl(
+layout(location = 2) uniform sampler2D sf_u_texture;
+
+in vec4 sf_v_color;
+in vec2 sf_v_texCoord;
+
+layout(location = 0) out vec4 sf_fragColor;
+
+void main()
+{
+    vec4 color = texture(sf_u_texture, sf_v_texCoord);
+)glsl";
+
+    const std::string factor = std::to_string(seed % 1000u + static_cast<unsigned int>(variant));
+
+    for (int i = 0; i < 32; ++i)
+        source += "    color = sin(color * " + factor + ".0 + " + std::to_string(i) + ".0) * cos(color.yzwx);\n";
+
+    source += "    sf_fragColor = sf_v_color * color;\n}\n";
+    return source;
+}
+
+
+////////////////////////////////////////////////////////////
+/// Compile all variants and return the total elapsed time
+///
+////////////////////////////////////////////////////////////
+[[nodiscard]] sf::Time compileAll(sf::GraphicsContext& graphicsContext, const std::vector<std::string>& sources)
+{
+    return bench::timeOnce(
+        [&]
+        {
+            for (const std::string& source : sources)
+                if (!sf::Shader::loadFromMemory(graphicsContext, source, sf::Shader::Type::Fragment).hasValue())
+                {
+                    std::cerr << "Failed to compile shader variant" << '\n';
+                    std::exit(EXIT_FAILURE);
+                }
+        });
+}
+
+} // namespace
+
+
+////////////////////////////////////////////////////////////
+/// Main
+///
+////////////////////////////////////////////////////////////
+int main()
+{
+    const sf::Path cacheDirectory = sf::Path::tempDirectoryPath() / "sfml_shader_cache_benchmark";
+
+    std::error_code error;
+    std::filesystem::remove_all(cacheDirectory.to<std::string>(), error);
+
+    sf::GraphicsContext graphicsContext;
+
+    // A fresh seed per run keeps the driver's own shader cache (if any) from skewing the cold timings
+    const unsigned int seed = std::random_device{}();
+
+    std::vector<std::string> sources;
+    sources.reserve(variantCount);
+
+    for (int i = 0; i < variantCount; ++i)
+        sources.push_back(makeFragmentShader(seed, i));
+
+    graphicsContext.setShaderCacheDirectory(cacheDirectory);
+
+    const sf::Time coldTime = compileAll(graphicsContext, sources);
+    const sf::Time warmTime = compileAll(graphicsContext, sources);
+
+    std::filesystem::remove_all(cacheDirectory.to<std::string>(), error);
+
+    std::cout << variantCount << " shader variants" << '\n';
+
+    bench::printResult("cold (compile, link and store)", bench::toMilliseconds(coldTime), 1, "ms") << '\n';
+    bench::printResult("warm (load from cache)", bench::toMilliseconds(warmTime), 1, "ms") << '\n';
+
+    if (warmTime.asMicroseconds() > 0)
+        bench::printResult("speedup", static_cast<double>(coldTime.asSeconds() / warmTime.asSeconds()), 1, "x") << '\n';
+
+    return EXIT_SUCCESS;
+}
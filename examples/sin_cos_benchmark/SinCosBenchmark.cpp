@@ -0,0 +1,159 @@
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include "SFML/System/Time.hpp"
+
+#include "SFML/Base/Constants.hpp"
+#include "SFML/Base/FastSinCos.hpp"
+#include "SFML/Base/IntTypes.hpp"
+#include "SFML/Base/SizeT.hpp"
+
+#include <BenchmarkUtils.hpp>
+
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <cmath>
+#include <cstdlib>
+
+
+namespace
+{
+////////////////////////////////////////////////////////////
+constexpr sf::base::SizeT angleCount = 1u << 20; // Rotations of all the sprites of a very busy scene
+constexpr unsigned int    passCount  = 16u;
+
+
+////////////////////////////////////////////////////////////
+/// 65536-entry sine table, as `fastSinCos` used before it
+/// switched to polynomials
+///
+////////////////////////////////////////////////////////////
+struct SinTable
+{
+    std::vector<float> data = std::vector<float>(65536u);
+
+    SinTable()
+    {
+        for (sf::base::SizeT i = 0u; i < data.size(); ++i)
+            data[i] = static_cast<float>(std::sin(static_cast<double>(i) / 65536.0 * 6.283185307179586));
+    }
+
+    [[nodiscard]] float sin(float radians) const
+    {
+        return data[static_cast<sf::base::U32>(radians * (65536.f / sf::base::tau)) & 0xFFFFu];
+    }
+
+    [[nodiscard]] float cos(float radians) const
+    {
+        return data[(static_cast<sf::base::U32>(radians * (65536.f / sf::base::tau)) + 16384u) & 0xFFFFu];
+    }
+};
+
+
+////////////////////////////////////////////////////////////
+/// Run `func` `passCount` times over all the angles and print
+/// the throughput, ignoring the first pass which warms up the caches
+///
+////////////////////////////////////////////////////////////
+template <typename F>
+void benchmark(const std::string& name, F&& func)
+{
+    float checksum = 0.f; // Keeps the computations from being optimized away
+
+    const sf::Time elapsed = bench::timeAverage(passCount, [&] { checksum += func(); });
+
+    bench::printResult(name, bench::perMicrosecond(static_cast<double>(angleCount), elapsed), 1, "angles/us")
+        << (checksum == 0.f ? " " : "") << '\n';
+}
+
+} // namespace
+
+
+////////////////////////////////////////////////////////////
+/// Main
+///
+////////////////////////////////////////////////////////////
+int main()
+{
+    std::minstd_rand                      rng(42u);
+    std::uniform_real_distribution<float> distribution(0.f, sf::base::tau);
+
+    std::vector<float> angles(angleCount);
+    for (float& angle : angles)
+        angle = distribution(rng);
+
+    std::vector<float> sines(angleCount);
+    std::vector<float> cosines(angleCount);
+
+    const SinTable table;
+
+    std::cout << angleCount << " random angles, sine and cosine of each, single core" << '\n';
+
+    benchmark("std::sin and std::cos",
+              [&]
+              {
+                  for (sf::base::SizeT i = 0u; i < angleCount; ++i)
+                  {
+                      sines[i]   = std::sin(angles[i]);
+                      cosines[i] = std::cos(angles[i]);
+                  }
+
+                  return sines[angleCount / 2u] + cosines[angleCount / 3u];
+              });
+
+    benchmark("256 KB table",
+              [&]
+              {
+                  for (sf::base::SizeT i = 0u; i < angleCount; ++i)
+                  {
+                      sines[i]   = table.sin(angles[i]);
+                      cosines[i] = table.cos(angles[i]);
+                  }
+
+                  return sines[angleCount / 2u] + cosines[angleCount / 3u];
+              });
+
+    benchmark("fastSinCos",
+              [&]
+              {
+                  for (sf::base::SizeT i = 0u; i < angleCount; ++i)
+                  {
+                      const auto [sine, cosine] = sf::base::fastSinCos(angles[i]);
+
+                      sines[i]   = sine;
+                      cosines[i] = cosine;
+                  }
+
+                  return sines[angleCount / 2u] + cosines[angleCount / 3u];
+              });
+
+    benchmark("fastSinCos8",
+              [&]
+              {
+                  for (sf::base::SizeT i = 0u; i < angleCount; i += 8u)
+                      sf::base::fastSinCos8(angles.data() + i, sines.data() + i, cosines.data() + i);
+
+                  return sines[angleCount / 2u] + cosines[angleCount / 3u];
+              });
+
+    double maxTableError      = 0.;
+    double maxPolynomialError = 0.;
+
+    for (const float angle : angles)
+    {
+        const double expected = std::sin(static_cast<double>(angle));
+
+        maxTableError      = std::fmax(maxTableError, std::fabs(table.sin(angle) - expected));
+        maxPolynomialError = std::fmax(maxPolynomialError, std::fabs(sf::base::fastSin(angle) - expected));
+    }
+
+    std::cout << '\n'
+              << "Maximum sine error, table:      " << std::scientific << std::setprecision(2) << maxTableError << '\n'
+              << "Maximum sine error, polynomial: " << maxPolynomialError << '\n';
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,109 @@
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include "SFML/System/Time.hpp"
+
+#include "SFML/Base/Algorithm.hpp"
+#include "SFML/Base/IntTypes.hpp"
+#include "SFML/Base/RadixSort.hpp"
+#include "SFML/Base/TrivialVector.hpp"
+
+#include <BenchmarkUtils.hpp>
+
+#include <algorithm>
+#include <iostream>
+#include <random>
+#include <string>
+
+#include <cstdlib>
+
+
+namespace
+{
+////////////////////////////////////////////////////////////
+constexpr sf::base::SizeT keyCount  = 100'000u; // Sprites depth-sorted per frame by a busy scene
+constexpr unsigned int    passCount = 32u;
+
+
+////////////////////////////////////////////////////////////
+/// Sprite as seen by the sort: a depth and the index of the
+/// sprite to draw
+///
+////////////////////////////////////////////////////////////
+struct DepthEntry
+{
+    float         depth;
+    sf::base::U32 index;
+};
+
+
+////////////////////////////////////////////////////////////
+/// Restore the unsorted input with `reset`, then time `func`
+/// over `passCount` passes, ignoring the first one which warms
+/// up the caches and the scratch buffers
+///
+////////////////////////////////////////////////////////////
+template <typename Reset, typename F>
+void benchmark(const std::string& name, Reset&& reset, F&& func)
+{
+    const sf::Time elapsed = bench::timeAverage(passCount, reset, func);
+    bench::printResult(name, bench::perMicrosecond(static_cast<double>(keyCount), elapsed), 1, "keys/us") << '\n';
+}
+
+} // namespace
+
+
+////////////////////////////////////////////////////////////
+/// Main
+///
+////////////////////////////////////////////////////////////
+int main()
+{
+    std::minstd_rand                      rng(42u);
+    std::uniform_real_distribution<float> distribution(-100.f, 100.f);
+
+    sf::base::TrivialVector<float> input(keyCount);
+    for (float& depth : input)
+        depth = distribution(rng);
+
+    sf::base::TrivialVector<float>         keys(keyCount);
+    sf::base::TrivialVector<DepthEntry>    entries(keyCount);
+    sf::base::TrivialVector<sf::base::U32> indices(keyCount);
+    sf::base::RadixSorter                  sorter;
+
+    const auto resetKeys = [&] { std::copy(input.begin(), input.end(), keys.begin()); };
+
+    const auto resetEntries = [&]
+    {
+        for (sf::base::SizeT i = 0u; i < keyCount; ++i)
+            entries[i] = {input[i], static_cast<sf::base::U32>(i)};
+    };
+
+    const auto byDepth = [](const DepthEntry& a, const DepthEntry& b) { return a.depth < b.depth; };
+
+    std::cout << keyCount << " random float depths, single core" << '\n' << '\n' << "Keys only" << '\n';
+
+    benchmark("std::sort", resetKeys, [&] { std::sort(keys.begin(), keys.end()); });
+    benchmark("sf::base::sort", resetKeys, [&] { sf::base::sort(keys.begin(), keys.end()); });
+    benchmark("RadixSorter::sortKeys", resetKeys, [&] { sorter.sortKeys(keys.data(), keys.size()); });
+
+    std::cout << '\n' << "Depth and sprite index" << '\n';
+
+    benchmark("std::sort", resetEntries, [&] { std::sort(entries.begin(), entries.end(), byDepth); });
+    benchmark("std::stable_sort", resetEntries, [&] { std::stable_sort(entries.begin(), entries.end(), byDepth); });
+    benchmark("sf::base::sort", resetEntries, [&] { sf::base::sort(entries.begin(), entries.end(), byDepth); });
+    benchmark("RadixSorter::sortPairs",
+              resetKeys,
+              [&]
+              {
+                  for (sf::base::SizeT i = 0u; i < keyCount; ++i)
+                      indices[i] = static_cast<sf::base::U32>(i);
+
+                  sorter.sortPairs(keys.data(), indices.data(), keys.size());
+              });
+    benchmark("RadixSorter::sortIndices",
+              [] {},
+              [&] { sorter.sortIndices(input.data(), indices.data(), input.size()); });
+
+    return EXIT_SUCCESS;
+}
@@ -28,13 +28,16 @@
 #include "SFML/System/Path.hpp"
 #include "SFML/System/Rect.hpp"
 #include "SFML/System/String.hpp"
+#include "SFML/System/Time.hpp"
 #include "SFML/System/Vector2.hpp"
 
+#include "SFML/Base/IntTypes.hpp"
 #include "SFML/Base/Optional.hpp"
 
 #include <imgui.h>
 
 #include <array>
+#include <fstream>
 #include <iostream>
 #include <random>
 #include <sstream>
@@ -44,6 +47,76 @@
 #include <cstddef>
 
 
+////////////////////////////////////////////////////////////
+/// Resident set size of the process in KiB, or 0 if unknown
+///
+////////////////////////////////////////////////////////////
+[[nodiscard]] std::size_t getResidentMemoryKiB()
+{
+#ifdef __linux__
+    // Second field of statm is the resident set size, in pages
+    std::ifstream statm("/proc/self/statm");
+
+    std::size_t totalPages    = 0u;
+    std::size_t residentPages = 0u;
+
+    if (statm >> totalPages >> residentPages)
+        return residentPages * 4u; // Assumes 4 KiB pages
+#endif
+
+    return 0u;
+}
+
+
+////////////////////////////////////////////////////////////
+/// Open the same fonts many times, as separate subsystems of a game
+/// typically do, and report the resident memory before and after
+///
+/// Fonts opened from the same file with `shareFace` set share a single
+/// memory-mapped face, so the cost of each additional instance is only
+/// its glyph cache. Set `shareFaces` to `false` to compare.
+///
+////////////////////////////////////////////////////////////
+void reportFontMemory(sf::GraphicsContext& graphicsContext)
+{
+    constexpr std::size_t instanceCount = 16u;
+    constexpr bool        shareFaces    = true; // All fonts are used from the main thread only
+
+    auto textureAtlas = sf::TextureAtlas{sf::Texture::create(graphicsContext, {1024u, 1024u}).value()};
+
+    const sf::Clock       clock;
+    const std::size_t     residentBefore = getResidentMemoryKiB();
+    std::vector<sf::Font> fonts;
+
+    fonts.reserve(instanceCount * 2u);
+
+    for (std::size_t i = 0u; i < instanceCount; ++i)
+    {
+        fonts.push_back(sf::Font::openFromFile(graphicsContext, "resources/tuffy.ttf", &textureAtlas, shareFaces).value());
+        fonts.push_back(
+            sf::Font::openFromFile(graphicsContext, "resources/mouldycheese.ttf", &textureAtlas, shareFaces).value());
+    }
+
+    // Rasterize a few glyphs per instance, lazily creating the metrics of each size
+    for (const sf::Font& font : fonts)
+        for (const sf::base::U32 codePoint : {U'A', U'g', U'%'})
+            (void)font.getGlyph(codePoint, 32u, /* bold */ false);
+
+    const sf::Time    elapsed       = clock.getElapsedTime();
+    const std::size_t residentAfter = getResidentMemoryKiB();
+
+    std::cout << "Opened " << fonts.size() << " fonts in " << elapsed.asMicroseconds() / 1000.f << " ms" << '\n';
+
+    if (residentBefore == 0u || residentAfter == 0u)
+        std::cout << "  resident memory: unavailable on this platform" << '\n';
+    else
+        std::cout << "  resident memory before: " << residentBefore << " KiB" << '\n'
+                  << "  resident memory after:  " << residentAfter << " KiB" << '\n'
+                  << "  difference:             "
+                  << static_cast<long long>(residentAfter) - static_cast<long long>(residentBefore) << " KiB" << '\n';
+}
+
+
 ////////////////////////////////////////////////////////////
 
 #if 1
@@ -51,7 +124,9 @@
 int main()
 {
     sf::GraphicsContext graphicsContext;
-    sf::RenderWindow    window(graphicsContext, {.size{800u, 600u}, .title = L"महसुस"});
+    reportFontMemory(graphicsContext);
+
+    sf::RenderWindow window(graphicsContext, {.size{800u, 600u}, .title = L"महसुस"});
 
     sf::RectangleShape rs0(
         {.position         = {250.f, 250.f},
@@ -0,0 +1,109 @@
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include "SFML/Graphics/CachedTransformable.hpp"
+#include "SFML/Graphics/Sprite.hpp"
+#include "SFML/Graphics/Vertex.hpp"
+
+#include "SFML/System/Time.hpp"
+
+#include "SFML/Base/SizeT.hpp"
+#include "SFML/Base/TrivialVector.hpp"
+
+#include <BenchmarkUtils.hpp>
+
+#include <iostream>
+#include <random>
+#include <string>
+
+#include <cstdlib>
+
+
+namespace
+{
+////////////////////////////////////////////////////////////
+constexpr sf::base::SizeT spriteCount = 100'000u;
+constexpr sf::base::SizeT movingEvery = 100u; // 1% of the sprites move every frame
+constexpr unsigned int    frameCount  = 64u;
+
+
+////////////////////////////////////////////////////////////
+/// Time `func` over `frameCount` frames and print the throughput,
+/// ignoring the first frame which warms up the caches
+///
+////////////////////////////////////////////////////////////
+template <typename F>
+void benchmark(const std::string& name, F&& func)
+{
+    const sf::Time elapsed = bench::timeAverage(frameCount, func);
+    bench::printResult(name, bench::perMicrosecond(static_cast<double>(spriteCount), elapsed), 1, "sprites/us") << '\n';
+}
+
+} // namespace
+
+
+////////////////////////////////////////////////////////////
+/// Main
+///
+////////////////////////////////////////////////////////////
+int main()
+{
+    std::minstd_rand                      rng(42u);
+    std::uniform_real_distribution<float> distribution(0.f, 1000.f);
+
+    sf::base::TrivialVector<sf::Sprite>              sprites;
+    sf::base::TrivialVector<sf::CachedTransformable> transformables;
+
+    sprites.reserve(spriteCount);
+    transformables.reserve(spriteCount);
+
+    for (sf::base::SizeT i = 0u; i < spriteCount; ++i)
+    {
+        sprites.emplaceBack(sf::FloatRect{{0.f, 0.f}, {32.f, 32.f}});
+        sf::Sprite& sprite = sprites[i];
+
+        sprite.position = {distribution(rng), distribution(rng)};
+        sprite.rotation = sf::degrees(distribution(rng));
+        sprite.origin   = {16.f, 16.f};
+
+        transformables.emplaceBack(sprite);
+    }
+
+    sf::base::TrivialVector<sf::Vertex> vertices(spriteCount * 4u);
+
+    std::cout << spriteCount << " sprites, 1 in " << movingEvery << " moving every frame, single core" << '\n';
+
+    benchmark("Transformable::getTransform",
+              [&]
+              {
+                  for (sf::base::SizeT i = 0u; i < spriteCount; i += movingEvery)
+                      sprites[i].position.x += 1.f;
+
+                  for (sf::base::SizeT i = 0u; i < spriteCount; ++i)
+                      sf::priv::spriteToVertices(sprites[i], vertices.data() + i * 4u);
+              });
+
+    benchmark("CachedTransformable::getTransform",
+              [&]
+              {
+                  for (sf::base::SizeT i = 0u; i < spriteCount; i += movingEvery)
+                      transformables[i].move({1.f, 0.f});
+
+                  for (sf::base::SizeT i = 0u; i < spriteCount; ++i)
+                      sf::priv::spriteToVertices(sprites[i], transformables[i].getTransform(), vertices.data() + i * 4u);
+              });
+
+    benchmark("CachedTransformable::updateTransforms",
+              [&]
+              {
+                  for (sf::base::SizeT i = 0u; i < spriteCount; i += movingEvery)
+                      transformables[i].move({1.f, 0.f});
+
+                  sf::CachedTransformable::updateTransforms({transformables.data(), transformables.size()});
+
+                  for (sf::base::SizeT i = 0u; i < spriteCount; ++i)
+                      sf::priv::spriteToVertices(sprites[i], transformables[i].getTransform(), vertices.data() + i * 4u);
+              });
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,237 @@
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include "SFML/System/String.hpp"
+#include "SFML/System/StringUtfUtils.hpp"
+#include "SFML/System/Time.hpp"
+#include "SFML/System/Utf.hpp"
+
+#include "SFML/Base/Algorithm.hpp"
+#include "SFML/Base/IntTypes.hpp"
+
+#include <BenchmarkUtils.hpp>
+
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <cstddef>
+#include <cstdlib>
+
+
+namespace
+{
+////////////////////////////////////////////////////////////
+constexpr std::size_t  stringCount  = 1024u; // Strings rebuilt per frame by a busy HUD
+constexpr std::size_t  stringLength = 48u;   // Typical length of a HUD line, in code points
+constexpr unsigned int passCount    = 16u;
+
+
+////////////////////////////////////////////////////////////
+/// Run `func` `passCount` times over all the strings and print the
+/// throughput, ignoring the first pass which warms up the caches
+///
+////////////////////////////////////////////////////////////
+template <typename F>
+void benchmark(const std::string& name, std::size_t totalUnits, F&& func)
+{
+    const sf::Time elapsed = bench::timeAverage(passCount, func);
+    bench::printResult(name, bench::perMicrosecond(static_cast<double>(totalUnits), elapsed), 1, "units/us") << '\n';
+}
+
+
+////////////////////////////////////////////////////////////
+/// Decode one code point at a time, as `toUtf32` did before it
+/// was able to convert runs of characters in bulk
+///
+////////////////////////////////////////////////////////////
+template <typename Utf, typename CharT>
+void decodeOneByOne(const std::basic_string<CharT>& input, std::u32string& output)
+{
+    output.clear();
+
+    for (auto it = input.begin(); it != input.end();)
+    {
+        sf::base::U32 codepoint = 0;
+        it                      = Utf::decode(it, input.end(), codepoint);
+        output.push_back(codepoint);
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+/// Generate strings where roughly one code point out of
+/// `nonAsciiOneIn` is picked from `nonAscii`
+///
+////////////////////////////////////////////////////////////
+[[nodiscard]] std::vector<std::u32string> makeTexts(std::minstd_rand&     rng,
+                                                    const std::u32string& nonAscii,
+                                                    unsigned int          nonAsciiOneIn)
+{
+    std::vector<std::u32string> texts(stringCount);
+
+    for (std::u32string& text : texts)
+        for (std::size_t i = 0u; i < stringLength; ++i)
+            text += nonAscii.empty() || rng() % nonAsciiOneIn != 0u
+                        ? static_cast<char32_t>(U' ' + rng() % 95u)
+                        : nonAscii[rng() % nonAscii.size()];
+
+    return texts;
+}
+
+
+////////////////////////////////////////////////////////////
+void benchmarkTexts(const std::string& title, const std::vector<std::u32string>& texts)
+{
+    std::vector<std::string>    utf8(texts.size());
+    std::vector<std::u16string> utf16(texts.size());
+
+    std::size_t utf8Units  = 0u;
+    std::size_t utf16Units = 0u;
+
+    for (std::size_t i = 0u; i < texts.size(); ++i)
+    {
+        sf::Utf32::toUtf8(texts[i].begin(), texts[i].end(), sf::base::BackInserter(utf8[i]));
+        sf::Utf32::toUtf16(texts[i].begin(), texts[i].end(), sf::base::BackInserter(utf16[i]));
+
+        utf8Units += utf8[i].size();
+        utf16Units += utf16[i].size();
+    }
+
+    std::u32string output;
+    std::size_t    checksum = 0u; // Keeps the conversions from being optimized away
+
+    std::cout << '\n' << title << '\n';
+
+    benchmark("UTF-8, one by one",
+              utf8Units,
+              [&]
+              {
+                  for (const std::string& string : utf8)
+                  {
+                      decodeOneByOne<sf::Utf8>(string, output);
+                      checksum += output.size();
+                  }
+              });
+
+    benchmark("UTF-8, Utf8::toUtf32",
+              utf8Units,
+              [&]
+              {
+                  for (const std::string& string : utf8)
+                  {
+                      output.clear();
+                      sf::Utf8::toUtf32(string.begin(), string.end(), sf::base::BackInserter(output));
+                      checksum += output.size();
+                  }
+              });
+
+    benchmark("UTF-8, StringUtfUtils::fromUtf8",
+              utf8Units,
+              [&]
+              {
+                  for (const std::string& string : utf8)
+                      checksum += sf::StringUtfUtils::fromUtf8(string.begin(), string.end()).getSize();
+              });
+
+    benchmark("UTF-16, one by one",
+              utf16Units,
+              [&]
+              {
+                  for (const std::u16string& string : utf16)
+                  {
+                      decodeOneByOne<sf::Utf16>(string, output);
+                      checksum += output.size();
+                  }
+              });
+
+    benchmark("UTF-16, Utf16::toUtf32",
+              utf16Units,
+              [&]
+              {
+                  for (const std::u16string& string : utf16)
+                  {
+                      output.clear();
+                      sf::Utf16::toUtf32(string.begin(), string.end(), sf::base::BackInserter(output));
+                      checksum += output.size();
+                  }
+              });
+
+    benchmark("UTF-16, StringUtfUtils::fromUtf16",
+              utf16Units,
+              [&]
+              {
+                  for (const std::u16string& string : utf16)
+                      checksum += sf::StringUtfUtils::fromUtf16(string.begin(), string.end()).getSize();
+              });
+
+    if (checksum == 0u)
+        std::cerr << "Nothing was converted" << '\n';
+}
+
+
+////////////////////////////////////////////////////////////
+/// Build and copy short labels, which `sf::String` stores in
+/// place while `std::u32string` allocates past 3 characters
+///
+////////////////////////////////////////////////////////////
+void benchmarkShortStrings()
+{
+    std::vector<std::string> labels(stringCount);
+
+    for (std::size_t i = 0u; i < labels.size(); ++i)
+        labels[i] = "HP: " + std::to_string(i % 1000u);
+
+    std::size_t checksum = 0u; // Keeps the copies from being optimized away
+
+    std::cout << '\n' << "Short labels, construction and copy" << '\n';
+
+    benchmark("std::u32string",
+              stringCount,
+              [&]
+              {
+                  for (const std::string& label : labels)
+                  {
+                      const std::u32string string(label.begin(), label.end());
+                      const std::u32string copy = string;
+                      checksum += copy.size();
+                  }
+              });
+
+    benchmark("sf::String",
+              stringCount,
+              [&]
+              {
+                  for (const std::string& label : labels)
+                  {
+                      const sf::String string(label);
+                      const sf::String copy = string;
+                      checksum += copy.getSize();
+                  }
+              });
+
+    if (checksum == 0u)
+        std::cerr << "Nothing was copied" << '\n';
+}
+
+} // namespace
+
+
+////////////////////////////////////////////////////////////
+/// Main
+///
+////////////////////////////////////////////////////////////
+int main()
+{
+    std::minstd_rand rng(42u);
+
+    std::cout << stringCount << " strings of " << stringLength << " code points, single core" << '\n';
+
+    benchmarkTexts("ASCII", makeTexts(rng, U"", 1u));
+    benchmarkTexts("Latin (1 in 12 accented)", makeTexts(rng, U"àáâäçèéêëìíîïñòóôöùúûüÿßœ", 12u));
+    benchmarkTexts("Mixed (1 in 2 CJK or emoji)", makeTexts(rng, U"中文字体渲染測試日本語한국어😀🎮🏆", 2u));
+    benchmarkShortStrings();
+
+    return EXIT_SUCCESS;
+}
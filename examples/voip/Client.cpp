@@ -156,4 +156,9 @@ void doClient(sf::CaptureDevice& captureDevice, unsigned short port)
 
     if (!recorder.stop())
         std::cerr << "Failed to stop network recorder" << std::endl;
+
+    // Samples are dropped if sending them cannot keep up with the microphone
+    if (captureDevice.getOverrunCount() > 0u)
+        std::cerr << "Dropped " << captureDevice.getDroppedSampleCount() << " samples in "
+                  << captureDevice.getOverrunCount() << " capture overruns" << std::endl;
 }
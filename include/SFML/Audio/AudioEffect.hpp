@@ -0,0 +1,123 @@
+#pragma once
+#include <SFML/Copyright.hpp> // LICENSE AND COPYRIGHT (C) INFORMATION
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include "SFML/Audio/Export.hpp"
+
+#include "SFML/Audio/EffectProcessor.hpp"
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+/// \brief Abstract base class for built-in audio effects
+///
+////////////////////////////////////////////////////////////
+class SFML_AUDIO_API AudioEffect
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Maximum number of interleaved channels processed by effects
+    ///
+    /// Channels beyond this limit are passed through unchanged.
+    ///
+    ////////////////////////////////////////////////////////////
+    static constexpr unsigned int maxChannelCount = 8u;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Destructor
+    ///
+    ////////////////////////////////////////////////////////////
+    virtual ~AudioEffect();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    AudioEffect(const AudioEffect&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy assignment
+    ///
+    ////////////////////////////////////////////////////////////
+    AudioEffect& operator=(const AudioEffect&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted move constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    AudioEffect(AudioEffect&&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted move assignment
+    ///
+    ////////////////////////////////////////////////////////////
+    AudioEffect& operator=(AudioEffect&&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Process frames in place
+    ///
+    /// This function is called from the audio thread. It never
+    /// allocates nor blocks, and reads the parameters that were
+    /// last set from any other thread.
+    ///
+    /// \param frames       Interleaved frames to process
+    /// \param frameCount   Number of frames pointed by \a `frames`
+    /// \param channelCount Number of channels in each frame
+    ///
+    ////////////////////////////////////////////////////////////
+    virtual void process(float* frames, unsigned int frameCount, unsigned int channelCount) = 0;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Create an effect processor that applies this effect
+    ///
+    /// The returned processor references this effect, which
+    /// must therefore outlive the sound source it is set on.
+    ///
+    /// \return Effect processor to pass to `SoundSource::setEffectProcessor`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] EffectProcessor makeEffectProcessor();
+
+protected:
+    ////////////////////////////////////////////////////////////
+    /// \brief Default constructor
+    ///
+    /// This constructor is only meant to be called by derived classes.
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] AudioEffect() = default;
+};
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::AudioEffect
+/// \ingroup audio
+///
+/// `sf::AudioEffect` is the base class of the effects shipped
+/// with SFML: `sf::BiquadFilter`, `sf::Echo`, `sf::Reverb`,
+/// `sf::Compressor` and `sf::FirFilter`. Several effects can be
+/// combined into a single processing step with `sf::EffectChain`.
+///
+/// Effects preallocate all of their state on construction and
+/// process audio with SIMD instructions where available. Their
+/// parameters can be changed from any thread while audio is
+/// playing; changes are picked up at the start of the next
+/// processed block.
+///
+/// Usage example:
+/// \code
+/// sf::BiquadFilter lowPass(sampleRate, sf::BiquadFilter::Type::LowPass, 500.f);
+/// music.setEffectProcessor(lowPass.makeEffectProcessor());
+///
+/// // Later, while the music is playing
+/// lowPass.setFrequency(800.f);
+/// \endcode
+///
+/// \see `sf::EffectChain`, `sf::EffectProcessor`
+///
+////////////////////////////////////////////////////////////
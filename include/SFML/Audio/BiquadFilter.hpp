@@ -0,0 +1,139 @@
+#pragma once
+#include <SFML/Copyright.hpp> // LICENSE AND COPYRIGHT (C) INFORMATION
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include "SFML/Audio/Export.hpp"
+
+#include "SFML/Audio/AudioEffect.hpp"
+
+#include "SFML/Base/UniquePtr.hpp"
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+/// \brief Second-order IIR filter (low-pass, high-pass, shelves, ...)
+///
+////////////////////////////////////////////////////////////
+class SFML_AUDIO_API BiquadFilter : public AudioEffect
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Frequency response of the filter
+    ///
+    ////////////////////////////////////////////////////////////
+    enum class [[nodiscard]] Type
+    {
+        LowPass,  //!< Attenuates frequencies above the cutoff
+        HighPass, //!< Attenuates frequencies below the cutoff
+        BandPass, //!< Only keeps frequencies around the center frequency
+        Notch,    //!< Removes frequencies around the center frequency
+        AllPass,  //!< Keeps all frequencies, only shifts their phase
+        Peaking,  //!< Boosts or cuts frequencies around the center frequency by the gain
+        LowShelf, //!< Boosts or cuts frequencies below the corner frequency by the gain
+        HighShelf //!< Boosts or cuts frequencies above the corner frequency by the gain
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Construct the filter
+    ///
+    /// \param sampleRate Sample rate of the processed audio, in samples per second
+    /// \param type       Frequency response of the filter
+    /// \param frequency  Cutoff, center or corner frequency, in Hz
+    /// \param q          Quality factor, the higher the narrower the transition band
+    /// \param gain       Gain of the peaking and shelf filters, in dB
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] explicit BiquadFilter(unsigned int sampleRate,
+                                        Type         type,
+                                        float        frequency,
+                                        float        q    = 0.70710678f,
+                                        float        gain = 0.f);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Destructor
+    ///
+    ////////////////////////////////////////////////////////////
+    ~BiquadFilter() override;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the frequency response of the filter
+    ///
+    ////////////////////////////////////////////////////////////
+    void setType(Type type);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the cutoff, center or corner frequency, in Hz
+    ///
+    ////////////////////////////////////////////////////////////
+    void setFrequency(float frequency);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the quality factor
+    ///
+    ////////////////////////////////////////////////////////////
+    void setQ(float q);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the gain of the peaking and shelf filters, in dB
+    ///
+    ////////////////////////////////////////////////////////////
+    void setGain(float gain);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the frequency response of the filter
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Type getType() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the cutoff, center or corner frequency, in Hz
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] float getFrequency() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the quality factor
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] float getQ() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the gain of the peaking and shelf filters, in dB
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] float getGain() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Filter frames in place
+    ///
+    ////////////////////////////////////////////////////////////
+    void process(float* frames, unsigned int frameCount, unsigned int channelCount) override;
+
+private:
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    struct Impl;
+    base::UniquePtr<Impl> m_impl; //!< Implementation details
+};
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::BiquadFilter
+/// \ingroup audio
+///
+/// `sf::BiquadFilter` implements the classic filters from the
+/// "Audio EQ Cookbook" as a transposed direct form II biquad.
+/// Groups of four channels are filtered at once with SIMD
+/// instructions, the remaining ones (e.g. mono or stereo)
+/// with scalar code. Parameter changes are applied over the
+/// next processed block to avoid clicks.
+///
+/// \see `sf::AudioEffect`, `sf::EffectChain`
+///
+////////////////////////////////////////////////////////////
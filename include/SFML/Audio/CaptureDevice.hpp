@@ -129,6 +129,30 @@ public:
     ////////////////////////////////////////////////////////////
     const ChannelMap& getChannelMap() const;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of capture overruns since the device was last started
+    ///
+    /// An overrun happens when the capture ring is full because
+    /// recorded samples are not processed fast enough. The
+    /// samples that do not fit are dropped.
+    ///
+    /// \return Number of capture callbacks that could not store all their samples
+    ///
+    /// \see `getDroppedSampleCount`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] base::U64 getOverrunCount() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of samples dropped since the device was last started
+    ///
+    /// \return Number of samples dropped due to overruns
+    ///
+    /// \see `getOverrunCount`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] base::U64 getDroppedSampleCount() const;
+
 private:
     friend SoundRecorder;
 
@@ -147,17 +171,35 @@ private:
     ////////////////////////////////////////////////////////////
     /// \brief Try to start the device, returns `true` on success
     ///
+    /// Captured samples are delivered to the "process samples"
+    /// callback in blocks of `blockSampleCount` samples, either
+    /// from a dedicated processing thread or from `processCapturedSamples`.
+    ///
     ////////////////////////////////////////////////////////////
-    [[nodiscard]] bool startDevice() const;
+    [[nodiscard]] bool startDevice(base::SizeT blockSampleCount, bool useProcessingThread);
 
     ////////////////////////////////////////////////////////////
     /// \brief Try to stop the device, returns `true` on success
     ///
+    /// Joins the processing thread, if any. Samples that were
+    /// captured but not yet delivered are kept in the ring.
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool stopDevice();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deliver the complete blocks of captured samples
+    ///
+    /// If `flush` is `true`, the trailing incomplete block is
+    /// delivered as well.
+    ///
+    /// \return `false` if the "process samples" callback asked to stop the capture
+    ///
     ////////////////////////////////////////////////////////////
-    [[nodiscard]] bool stopDevice() const;
+    [[nodiscard]] bool processCapturedSamples(bool flush);
 
     ////////////////////////////////////////////////////////////
-    /// \brief Set the "process samples" callback used by miniaudio
+    /// \brief Set the "process samples" callback used to deliver captured samples
     ///
     ////////////////////////////////////////////////////////////
     using ProcessSamplesFunc = bool (*)(void* userData, const base::I16* samples, base::SizeT sampleCount);
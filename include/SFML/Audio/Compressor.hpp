@@ -0,0 +1,149 @@
+#pragma once
+#include <SFML/Copyright.hpp> // LICENSE AND COPYRIGHT (C) INFORMATION
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include "SFML/Audio/Export.hpp"
+
+#include "SFML/Audio/AudioEffect.hpp"
+
+#include "SFML/System/Time.hpp"
+
+#include "SFML/Base/UniquePtr.hpp"
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+/// \brief Dynamic range compressor and limiter
+///
+////////////////////////////////////////////////////////////
+class SFML_AUDIO_API Compressor : public AudioEffect
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Construct the compressor
+    ///
+    /// \param sampleRate Sample rate of the processed audio, in samples per second
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] explicit Compressor(unsigned int sampleRate);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Destructor
+    ///
+    ////////////////////////////////////////////////////////////
+    ~Compressor() override;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the level above which the signal is compressed, in dB
+    ///
+    /// The default is -12 dB.
+    ///
+    ////////////////////////////////////////////////////////////
+    void setThreshold(float threshold);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the compression ratio
+    ///
+    /// A ratio of 4 turns 4 dB above the threshold into 1 dB.
+    /// Ratios of 20 and above make the compressor act as a
+    /// limiter. The default is 4.
+    ///
+    ////////////////////////////////////////////////////////////
+    void setRatio(float ratio);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set how fast the gain is reduced when the level rises
+    ///
+    /// The default is 10 milliseconds.
+    ///
+    ////////////////////////////////////////////////////////////
+    void setAttack(Time attack);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set how fast the gain recovers when the level falls
+    ///
+    /// The default is 100 milliseconds.
+    ///
+    ////////////////////////////////////////////////////////////
+    void setRelease(Time release);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the gain applied after compression, in dB
+    ///
+    /// The default is 0 dB.
+    ///
+    ////////////////////////////////////////////////////////////
+    void setMakeupGain(float makeupGain);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the level above which the signal is compressed, in dB
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] float getThreshold() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the compression ratio
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] float getRatio() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get how fast the gain is reduced when the level rises
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Time getAttack() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get how fast the gain recovers when the level falls
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Time getRelease() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the gain applied after compression, in dB
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] float getMakeupGain() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the gain reduction applied to the last processed block, in dB
+    ///
+    /// Meant for metering, the value is zero or negative.
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] float getGainReduction() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Compress frames in place
+    ///
+    ////////////////////////////////////////////////////////////
+    void process(float* frames, unsigned int frameCount, unsigned int channelCount) override;
+
+private:
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    struct Impl;
+    base::UniquePtr<Impl> m_impl; //!< Implementation details
+};
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::Compressor
+/// \ingroup audio
+///
+/// `sf::Compressor` follows the peak level of all channels
+/// together, so that the stereo image is preserved, and
+/// reduces the gain when it exceeds the threshold. The gain is
+/// updated every 32 frames and interpolated in between; the
+/// peak detection and the gain application use SIMD
+/// instructions.
+///
+/// \see `sf::AudioEffect`, `sf::EffectChain`
+///
+////////////////////////////////////////////////////////////
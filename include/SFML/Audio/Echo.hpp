@@ -0,0 +1,125 @@
+#pragma once
+#include <SFML/Copyright.hpp> // LICENSE AND COPYRIGHT (C) INFORMATION
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include "SFML/Audio/Export.hpp"
+
+#include "SFML/Audio/AudioEffect.hpp"
+
+#include "SFML/System/Time.hpp"
+
+#include "SFML/Base/UniquePtr.hpp"
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+/// \brief Feedback delay line producing repeating echoes
+///
+////////////////////////////////////////////////////////////
+class SFML_AUDIO_API Echo : public AudioEffect
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Construct the echo
+    ///
+    /// The delay line is allocated here, for `maxDelay` and
+    /// `channelCount`. Audio with more channels is left unchanged.
+    ///
+    /// \param sampleRate   Sample rate of the processed audio, in samples per second
+    /// \param maxDelay     Longest delay that can be set
+    /// \param channelCount Maximum number of channels of the processed audio
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] explicit Echo(unsigned int sampleRate, Time maxDelay = seconds(1.f), unsigned int channelCount = 2u);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Destructor
+    ///
+    ////////////////////////////////////////////////////////////
+    ~Echo() override;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the time between two repetitions
+    ///
+    /// The delay is clamped to the maximum delay given on
+    /// construction. The default is 200 milliseconds.
+    ///
+    ////////////////////////////////////////////////////////////
+    void setDelay(Time delay);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the fraction of the signal fed back into the delay line
+    ///
+    /// \param feedback Feedback in the range [0, 1), the default is 0.5
+    ///
+    ////////////////////////////////////////////////////////////
+    void setFeedback(float feedback);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the gain of the delayed signal, the default is 0.5
+    ///
+    ////////////////////////////////////////////////////////////
+    void setWet(float wet);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the gain of the original signal, the default is 1
+    ///
+    ////////////////////////////////////////////////////////////
+    void setDry(float dry);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the time between two repetitions
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Time getDelay() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the fraction of the signal fed back into the delay line
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] float getFeedback() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the gain of the delayed signal
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] float getWet() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the gain of the original signal
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] float getDry() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Apply the echo to frames in place
+    ///
+    ////////////////////////////////////////////////////////////
+    void process(float* frames, unsigned int frameCount, unsigned int channelCount) override;
+
+private:
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    struct Impl;
+    base::UniquePtr<Impl> m_impl; //!< Implementation details
+};
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::Echo
+/// \ingroup audio
+///
+/// `sf::Echo` mixes a delayed copy of the signal back into it,
+/// part of which is fed back into the delay line to produce
+/// decaying repetitions. Interleaved samples are processed four
+/// at a time with SIMD instructions.
+///
+/// \see `sf::AudioEffect`, `sf::EffectChain`
+///
+////////////////////////////////////////////////////////////
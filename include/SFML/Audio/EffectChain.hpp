@@ -0,0 +1,131 @@
+#pragma once
+#include <SFML/Copyright.hpp> // LICENSE AND COPYRIGHT (C) INFORMATION
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include "SFML/Audio/Export.hpp"
+
+#include "SFML/Audio/AudioEffect.hpp"
+
+#include "SFML/Base/SizeT.hpp"
+#include "SFML/Base/UniquePtr.hpp"
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+/// \brief Sequence of audio effects applied one after the other
+///
+////////////////////////////////////////////////////////////
+class SFML_AUDIO_API EffectChain : public AudioEffect
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Maximum number of effects in a chain
+    ///
+    ////////////////////////////////////////////////////////////
+    static constexpr base::SizeT maxEffectCount = 16u;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Default constructor
+    ///
+    /// Creates an empty chain, which leaves audio unchanged.
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] EffectChain();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Destructor
+    ///
+    ////////////////////////////////////////////////////////////
+    ~EffectChain() override;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Append an effect to the end of the chain
+    ///
+    /// This function can be called while the chain is processing
+    /// audio. The effect must outlive the chain.
+    ///
+    /// \param effect Effect to append
+    ///
+    /// \return `true` on success, `false` if the chain is full
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool add(AudioEffect& effect);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of effects in the chain
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] base::SizeT getEffectCount() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Enable or bypass an effect of the chain
+    ///
+    /// Effects are enabled when they are added.
+    ///
+    /// \param index   Index of the effect, in order of addition
+    /// \param enabled `false` to bypass the effect
+    ///
+    /// \see `isEnabled`
+    ///
+    ////////////////////////////////////////////////////////////
+    void setEnabled(base::SizeT index, bool enabled);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether an effect of the chain is enabled
+    ///
+    /// \param index Index of the effect, in order of addition
+    ///
+    /// \see `setEnabled`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool isEnabled(base::SizeT index) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Apply every enabled effect, in order of addition
+    ///
+    ////////////////////////////////////////////////////////////
+    void process(float* frames, unsigned int frameCount, unsigned int channelCount) override;
+
+private:
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    struct Impl;
+    base::UniquePtr<Impl> m_impl; //!< Implementation details
+};
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::EffectChain
+/// \ingroup audio
+///
+/// `sf::EffectChain` combines several audio effects into one,
+/// so that they can be applied to a sound source with a single
+/// `sf::EffectProcessor`. All effects process the same buffer
+/// in place, so chaining adds no copies.
+///
+/// Usage example:
+/// \code
+/// sf::BiquadFilter highPass(sampleRate, sf::BiquadFilter::Type::HighPass, 80.f);
+/// sf::Compressor   compressor(sampleRate);
+/// sf::Reverb       reverb(sampleRate);
+///
+/// sf::EffectChain chain;
+/// (void)chain.add(highPass);
+/// (void)chain.add(compressor);
+/// (void)chain.add(reverb);
+///
+/// music.setEffectProcessor(chain.makeEffectProcessor());
+///
+/// // Bypass the reverb without interrupting playback
+/// chain.setEnabled(2, false);
+/// \endcode
+///
+/// \see `sf::AudioEffect`
+///
+////////////////////////////////////////////////////////////
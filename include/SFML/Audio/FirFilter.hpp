@@ -0,0 +1,99 @@
+#pragma once
+#include <SFML/Copyright.hpp> // LICENSE AND COPYRIGHT (C) INFORMATION
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include "SFML/Audio/Export.hpp"
+
+#include "SFML/Audio/AudioEffect.hpp"
+
+#include "SFML/Base/SizeT.hpp"
+#include "SFML/Base/UniquePtr.hpp"
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+/// \brief Finite impulse response filter (direct convolution)
+///
+////////////////////////////////////////////////////////////
+class SFML_AUDIO_API FirFilter : public AudioEffect
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Construct the filter from its impulse response
+    ///
+    /// \param taps     Impulse response of the filter, the first tap applies to the newest sample
+    /// \param tapCount Number of taps pointed by \a `taps`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] explicit FirFilter(const float* taps, base::SizeT tapCount);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Construct the filter from its impulse response
+    ///
+    /// \param taps Impulse response of the filter, the first tap applies to the newest sample
+    ///
+    ////////////////////////////////////////////////////////////
+    template <base::SizeT N>
+    [[nodiscard]] explicit FirFilter(const float (&taps)[N]) : FirFilter(taps, N)
+    {
+    }
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Destructor
+    ///
+    ////////////////////////////////////////////////////////////
+    ~FirFilter() override;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of taps
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] base::SizeT getTapCount() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the gain applied to the filtered signal, the default is 1
+    ///
+    ////////////////////////////////////////////////////////////
+    void setGain(float gain);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the gain applied to the filtered signal
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] float getGain() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Filter frames in place
+    ///
+    ////////////////////////////////////////////////////////////
+    void process(float* frames, unsigned int frameCount, unsigned int channelCount) override;
+
+private:
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    struct Impl;
+    base::UniquePtr<Impl> m_impl; //!< Implementation details
+};
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::FirFilter
+/// \ingroup audio
+///
+/// `sf::FirFilter` convolves each channel with a fixed impulse
+/// response. The history of each channel is stored twice in a
+/// row so that the convolution is a single contiguous dot
+/// product, computed four taps at a time with SIMD instructions.
+/// The cost is proportional to the number of taps, which makes
+/// it best suited to short responses such as equalization
+/// curves or small cabinet simulations.
+///
+/// \see `sf::AudioEffect`, `sf::EffectChain`
+///
+////////////////////////////////////////////////////////////
@@ -65,12 +65,18 @@ public:
     /// and there is a low chance of garbage decoded at the end of file.
     /// See also: https://github.com/lieff/minimp3
     ///
+    /// If `prefetch` is `true`, the file is read ahead in large
+    /// blocks on a background thread (see `sf::PrefetchInputStream`),
+    /// which hides the latency of slow or network storage from
+    /// the decoder.
+    ///
     /// \param filename Path of the sound file to load
+    /// \param prefetch Whether to read the file ahead on a background thread
     ///
     /// \return Input sound file in success, `base::nullOpt` otherwise
     ///
     ////////////////////////////////////////////////////////////
-    [[nodiscard]] static base::Optional<InputSoundFile> openFromFile(const Path& filename);
+    [[nodiscard]] static base::Optional<InputSoundFile> openFromFile(const Path& filename, bool prefetch = false);
 
     ////////////////////////////////////////////////////////////
     /// \brief Open a sound file in memory for reading
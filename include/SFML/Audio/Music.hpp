@@ -66,14 +66,19 @@ public:
     /// and until all active `sf::Music` objects linked to this
     /// `sf::Music` instance are destroyed.
     ///
+    /// If `prefetch` is `true`, the file is read ahead in large
+    /// blocks on a background thread (see `sf::PrefetchInputStream`),
+    /// so that streaming does not stall on slow or network storage.
+    ///
     /// \param filename Path of the music file to open
+    /// \param prefetch Whether to read the file ahead on a background thread
     ///
     /// \return Music source if loading succeeded, `base::nullOpt` if it failed
     ///
     /// \see `openFromMemory`, `openFromStream`
     ///
     ////////////////////////////////////////////////////////////
-    [[nodiscard]] static base::Optional<Music> openFromFile(const Path& filename);
+    [[nodiscard]] static base::Optional<Music> openFromFile(const Path& filename, bool prefetch = false);
 
     ////////////////////////////////////////////////////////////
     /// \brief Open a music from an audio file in memory
@@ -10,6 +10,7 @@
 #include "SFML/System/LifetimeDependee.hpp"
 
 #include "SFML/Base/Optional.hpp"
+#include "SFML/Base/StringView.hpp"
 #include "SFML/Base/UniquePtr.hpp"
 
 
@@ -26,6 +27,7 @@ namespace sf
 class AudioContext;
 class PlaybackDeviceHandle;
 class Sound;
+class SoundBus;
 class SoundStream;
 struct Listener;
 } // namespace sf
@@ -87,6 +89,58 @@ public:
     ////////////////////////////////////////////////////////////
     [[nodiscard]] bool updateListener(const Listener& listener);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the sample rate of the device output
+    ///
+    /// This is the sample rate at which sound sources, buses
+    /// and their effect processors are mixed.
+    ///
+    /// \return Sample rate, in samples per second
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] unsigned int getSampleRate() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of channels of the device output
+    ///
+    /// \return Number of interleaved channels seen by effect processors
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] unsigned int getChannelCount() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Create a named submix bus
+    ///
+    /// Sound sources and other buses routed into the bus are
+    /// mixed together, processed by the bus effect processor,
+    /// then mixed into `parent`, or into the device output if
+    /// `parent` is `nullptr`.
+    ///
+    /// The bus is owned by the playback device and lives as
+    /// long as the device does.
+    ///
+    /// \param name   Unique name of the bus
+    /// \param parent Bus to mix the new bus into, must belong to this device
+    ///
+    /// \return Pointer to the new bus, `nullptr` if the name is taken or the bus could not be created
+    ///
+    /// \see `findBus`, `SoundSource::setBus`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] SoundBus* createBus(base::StringView name, SoundBus* parent = nullptr);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Find a submix bus by name
+    ///
+    /// \param name Name given to `createBus`
+    ///
+    /// \return Pointer to the bus, `nullptr` if no bus has that name
+    ///
+    /// \see `createBus`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] SoundBus* findBus(base::StringView name) const;
+
 private:
     // Friends
     using SoundBase = priv::MiniaudioUtils::SoundBase;
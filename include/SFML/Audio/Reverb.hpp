@@ -0,0 +1,121 @@
+#pragma once
+#include <SFML/Copyright.hpp> // LICENSE AND COPYRIGHT (C) INFORMATION
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include "SFML/Audio/Export.hpp"
+
+#include "SFML/Audio/AudioEffect.hpp"
+
+#include "SFML/Base/UniquePtr.hpp"
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+/// \brief Room reverberation based on a feedback delay network
+///
+////////////////////////////////////////////////////////////
+class SFML_AUDIO_API Reverb : public AudioEffect
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Construct the reverb
+    ///
+    /// \param sampleRate Sample rate of the processed audio, in samples per second
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] explicit Reverb(unsigned int sampleRate);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Destructor
+    ///
+    ////////////////////////////////////////////////////////////
+    ~Reverb() override;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the size of the simulated room
+    ///
+    /// Larger rooms have a longer decay.
+    ///
+    /// \param roomSize Room size in the range [0, 1], the default is 0.5
+    ///
+    ////////////////////////////////////////////////////////////
+    void setRoomSize(float roomSize);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set how much high frequencies are absorbed on each reflection
+    ///
+    /// \param damping Damping in the range [0, 1], the default is 0.5
+    ///
+    ////////////////////////////////////////////////////////////
+    void setDamping(float damping);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the gain of the reverberated signal, the default is 0.3
+    ///
+    ////////////////////////////////////////////////////////////
+    void setWet(float wet);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the gain of the original signal, the default is 1
+    ///
+    ////////////////////////////////////////////////////////////
+    void setDry(float dry);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the size of the simulated room
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] float getRoomSize() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get how much high frequencies are absorbed on each reflection
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] float getDamping() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the gain of the reverberated signal
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] float getWet() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the gain of the original signal
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] float getDry() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Apply the reverb to frames in place
+    ///
+    ////////////////////////////////////////////////////////////
+    void process(float* frames, unsigned int frameCount, unsigned int channelCount) override;
+
+private:
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    struct Impl;
+    base::UniquePtr<Impl> m_impl; //!< Implementation details
+};
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::Reverb
+/// \ingroup audio
+///
+/// `sf::Reverb` feeds the mono sum of its input into four
+/// delay lines of mutually prime lengths, which are damped,
+/// mixed together through an orthogonal Hadamard matrix and
+/// fed back. Even and odd channels receive different mixes of
+/// the delay lines for a wide stereo image. The four lines are
+/// processed at once with SIMD instructions.
+///
+/// \see `sf::AudioEffect`, `sf::EffectChain`
+///
+////////////////////////////////////////////////////////////
@@ -21,6 +21,7 @@ namespace sf
 class EffectProcessor;
 class PlaybackDevice;
 class SoundBuffer;
+class SoundBus;
 class Time;
 } // namespace sf
 
@@ -161,6 +162,16 @@ public:
     ////////////////////////////////////////////////////////////
     void setEffectProcessor(EffectProcessor effectProcessor) override;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Route the sound into a submix bus
+    ///
+    /// \param bus Bus to route the sound into, `nullptr` to route it to the device output
+    ///
+    /// \see `SoundSource::setBus`
+    ///
+    ////////////////////////////////////////////////////////////
+    void setBus(SoundBus* bus) override;
+
     ////////////////////////////////////////////////////////////
     /// \brief Get the audio buffer attached to the sound
     ///
@@ -0,0 +1,217 @@
+#pragma once
+#include <SFML/Copyright.hpp> // LICENSE AND COPYRIGHT (C) INFORMATION
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include "SFML/Audio/Export.hpp"
+
+#include "SFML/Base/PassKey.hpp"
+#include "SFML/Base/StringView.hpp"
+#include "SFML/Base/UniquePtr.hpp"
+
+
+////////////////////////////////////////////////////////////
+// Forward declarations
+////////////////////////////////////////////////////////////
+namespace sf::priv::MiniaudioUtils
+{
+struct SoundBase;
+} // namespace sf::priv::MiniaudioUtils
+
+namespace sf
+{
+class EffectProcessor;
+class PlaybackDevice;
+} // namespace sf
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+/// \brief Submix bus of a playback device
+///
+////////////////////////////////////////////////////////////
+class SFML_AUDIO_API SoundBus
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Constructor, only usable by `PlaybackDevice`
+    ///
+    /// Use `PlaybackDevice::createBus` to create buses.
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] explicit SoundBus(base::PassKey<PlaybackDevice>&&,
+                                    void*            maEngine,
+                                    base::StringView name,
+                                    SoundBus*        parent);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Destructor
+    ///
+    ////////////////////////////////////////////////////////////
+    ~SoundBus();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    SoundBus(const SoundBus&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy assignment
+    ///
+    ////////////////////////////////////////////////////////////
+    SoundBus& operator=(const SoundBus&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted move constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    SoundBus(SoundBus&&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted move assignment
+    ///
+    ////////////////////////////////////////////////////////////
+    SoundBus& operator=(SoundBus&&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the name of the bus
+    ///
+    /// \return Name given to `PlaybackDevice::createBus`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] base::StringView getName() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the bus this bus is mixed into
+    ///
+    /// \return Parent bus, or `nullptr` if the bus is mixed directly into the device output
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] SoundBus* getParent() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the volume of the bus
+    ///
+    /// The volume is applied to the mix of all the sources and
+    /// child buses routed into this bus, after its effect
+    /// processor. It is a value between 0 (mute) and
+    /// 100 (full volume). The default value is 100.
+    ///
+    /// \param volume Volume of the bus
+    ///
+    /// \see `getVolume`
+    ///
+    ////////////////////////////////////////////////////////////
+    void setVolume(float volume);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the volume of the bus
+    ///
+    /// \return Volume of the bus, in the range [0, 100]
+    ///
+    /// \see `setVolume`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] float getVolume() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the effect processor to be applied to the bus
+    ///
+    /// The effect processor runs once per audio block on the
+    /// mix of everything routed into the bus, regardless of
+    /// how many sources feed it.
+    ///
+    /// \param effectProcessor The effect processor to attach to this bus, attach an empty processor to disable processing
+    ///
+    /// \see `getEffectProcessor`
+    ///
+    ////////////////////////////////////////////////////////////
+    void setEffectProcessor(EffectProcessor effectProcessor);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the effect processor of the bus
+    ///
+    /// \return Effect processor of the bus
+    ///
+    /// \see `setEffectProcessor`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] EffectProcessor getEffectProcessor() const;
+
+private:
+    // Friends
+    friend PlaybackDevice;
+    friend priv::MiniaudioUtils::SoundBase;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Create the miniaudio group and effect node of the bus
+    ///
+    /// \return `true` on success, `false` otherwise
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool initialize();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the miniaudio engine the bus belongs to
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] void* getMAEngine() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the miniaudio node sources and child buses are attached to
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] void* getMAInputNode() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Route the group output through the effect node or directly to the parent
+    ///
+    ////////////////////////////////////////////////////////////
+    void connectEffect(bool connect);
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    struct Impl;
+    base::UniquePtr<Impl> m_impl; //!< Implementation details
+};
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::SoundBus
+/// \ingroup audio
+///
+/// A sound bus mixes together every sound source and child bus
+/// routed into it, then applies its own effect processor and
+/// volume to the mix before passing it on to its parent bus,
+/// or to the output of the playback device.
+///
+/// Effects that should apply to a whole category of sounds
+/// (e.g. a reverb on all footsteps) are much cheaper on a bus,
+/// as they run once per bus instead of once per source.
+///
+/// Buses are created by and owned by a `sf::PlaybackDevice`,
+/// and live as long as the device does.
+///
+/// Usage example:
+/// \code
+/// sf::SoundBus* sfx       = playbackDevice.createBus("sfx");
+/// sf::SoundBus* footsteps = playbackDevice.createBus("footsteps", sfx);
+///
+/// sf::Reverb reverb(playbackDevice.getSampleRate());
+/// footsteps->setEffectProcessor(reverb.makeEffectProcessor());
+/// sfx->setVolume(80.f);
+///
+/// sf::Sound step(stepBuffer);
+/// step.setBus(footsteps);
+/// step.play(playbackDevice);
+/// \endcode
+///
+/// \see `sf::PlaybackDevice`, `sf::SoundSource`, `sf::EffectProcessor`
+///
+////////////////////////////////////////////////////////////
@@ -31,6 +31,16 @@ namespace sf
 class SFML_AUDIO_API SoundRecorder
 {
 public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Thread on which captured samples are processed
+    ///
+    ////////////////////////////////////////////////////////////
+    enum class [[nodiscard]] ProcessingMode
+    {
+        Thread, //!< `onProcessSamples` is called from a dedicated processing thread
+        Poll    //!< `onProcessSamples` is called from `poll`, on the calling thread
+    };
+
     ////////////////////////////////////////////////////////////
     /// \brief destructor
     ///
@@ -93,6 +103,66 @@ public:
     ////////////////////////////////////////////////////////////
     [[nodiscard]] bool stop();
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Process the samples captured since the last call
+    ///
+    /// Only valid in `ProcessingMode::Poll`. Every complete block
+    /// of captured samples is passed to `onProcessSamples` on the
+    /// calling thread. If `onProcessSamples` returns `false`, the
+    /// capture is stopped as if `stop` had been called.
+    ///
+    /// Call this often enough (e.g. once per frame) so that the
+    /// capture ring does not overflow.
+    ///
+    /// \return `true` if the capture is still running
+    ///
+    /// \see `setProcessingMode`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool poll();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the thread on which captured samples are processed
+    ///
+    /// The new mode is applied the next time the capture starts.
+    /// The default is `ProcessingMode::Thread`.
+    ///
+    /// \see `getProcessingMode`, `poll`
+    ///
+    ////////////////////////////////////////////////////////////
+    void setProcessingMode(ProcessingMode processingMode);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the thread on which captured samples are processed
+    ///
+    /// \see `setProcessingMode`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] ProcessingMode getProcessingMode() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the number of sample frames passed to each `onProcessSamples` call
+    ///
+    /// A sample frame contains one sample per channel. Blocks
+    /// always have this exact size, except for the last one
+    /// delivered when the capture stops. The new size is applied
+    /// the next time the capture starts. The default is 512.
+    ///
+    /// \param frameCount Number of sample frames per block, at most 8192
+    ///
+    /// \see `getBlockSize`
+    ///
+    ////////////////////////////////////////////////////////////
+    void setBlockSize(base::SizeT frameCount);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of sample frames passed to each `onProcessSamples` call
+    ///
+    /// \see `setBlockSize`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] base::SizeT getBlockSize() const;
+
 
 protected:
     ////////////////////////////////////////////////////////////
@@ -147,7 +217,9 @@ private:
     ////////////////////////////////////////////////////////////
     // Member data
     ////////////////////////////////////////////////////////////
-    CaptureDevice* m_lastCaptureDevice{};
+    CaptureDevice* m_lastCaptureDevice{};                     //!< Device of the running capture, if any
+    ProcessingMode m_processingMode{ProcessingMode::Thread}; //!< Thread on which samples are processed
+    base::SizeT    m_blockSize{512u};                        //!< Number of sample frames per block
 
     ////////////////////////////////////////////////////////////
     // Lifetime tracking
@@ -178,11 +250,13 @@ private:
 /// \li `onStart` is called before the capture happens, to perform custom initializations
 /// \li `onStop` is called after the capture ends, to perform custom cleanup
 ///
-/// A derived class can also control the frequency of the onProcessSamples
-/// calls, with the `setProcessingInterval` protected function. The default
-/// interval is chosen so that recording thread doesn't consume too much
-/// CPU, but it can be changed to a smaller value if you need to process
-/// the recorded data in real time, for example.
+/// Captured samples are first written into a preallocated lock-free
+/// ring by the audio thread, which never runs user code. They are
+/// then passed to `onProcessSamples` in blocks of a fixed number of
+/// sample frames, configurable with `setBlockSize`. If the samples
+/// are not processed fast enough, the ring overflows and the excess
+/// samples are dropped: see `CaptureDevice::getOverrunCount` and
+/// `CaptureDevice::getDroppedSampleCount`.
 ///
 /// If you have multiple sound input devices connected to your
 /// computer (for example: microphone, external sound card, webcam mic, ...)
@@ -199,11 +273,13 @@ private:
 ///
 /// It is important to note that the audio capture happens in a
 /// separate thread, so that it doesn't block the rest of the
-/// program. In particular, the `onProcessSamples` virtual function
-/// (but not `onStart` and not `onStop`) will be called
-/// from this separate thread. It is important to keep this in
+/// program. By default, the `onProcessSamples` virtual function
+/// (but not `onStart` and not `onStop`) will be called from a
+/// dedicated processing thread. It is important to keep this in
 /// mind, because you may have to take care of synchronization
-/// issues if you share data between threads.
+/// issues if you share data between threads. Alternatively, with
+/// `ProcessingMode::Poll`, the samples are only processed when
+/// `poll` is called, on the calling thread.
 /// Another thing to bear in mind is that you must call `stop()`
 /// in the destructor of your derived class, so that the recording
 /// thread finishes before your object is destroyed.
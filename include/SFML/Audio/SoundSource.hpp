@@ -22,6 +22,7 @@ namespace sf
 {
 class EffectProcessor;
 class PlaybackDevice;
+class SoundBus;
 class Time;
 } // namespace sf
 
@@ -337,6 +338,23 @@ public:
     ////////////////////////////////////////////////////////////
     virtual void setEffectProcessor(EffectProcessor effectProcessor);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Route the sound into a submix bus
+    ///
+    /// The sound is mixed into `bus` instead of directly into
+    /// the output of the playback device, after its own effect
+    /// processor. The bus must belong to the playback device
+    /// the sound is played on. If the sound is transferred to
+    /// another playback device, it is routed into the bus of
+    /// that device with the same name, if any.
+    ///
+    /// \param bus Bus to route the sound into, `nullptr` to route it to the device output
+    ///
+    /// \see `getBus`, `PlaybackDevice::createBus`
+    ///
+    ////////////////////////////////////////////////////////////
+    virtual void setBus(SoundBus* bus);
+
     ////////////////////////////////////////////////////////////
     /// \brief Set whether or not the sound should loop after reaching the end
     ///
@@ -538,6 +556,16 @@ public:
     ////////////////////////////////////////////////////////////
     [[nodiscard]] EffectProcessor getEffectProcessor() const;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the submix bus the sound is routed into
+    ///
+    /// \return Bus of the sound, `nullptr` if it is routed to the device output
+    ///
+    /// \see `setBus`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] SoundBus* getBus() const;
+
     ////////////////////////////////////////////////////////////
     /// \brief Tell whether or not the sound is in loop mode
     ///
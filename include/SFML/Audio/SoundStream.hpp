@@ -22,6 +22,7 @@ namespace sf
 {
 class EffectProcessor;
 class PlaybackDevice;
+class SoundBus;
 class Time;
 } // namespace sf
 
@@ -176,6 +177,16 @@ public:
     ////////////////////////////////////////////////////////////
     void setEffectProcessor(EffectProcessor effectProcessor) override;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Route the stream into a submix bus
+    ///
+    /// \param bus Bus to route the stream into, `nullptr` to route it to the device output
+    ///
+    /// \see `SoundSource::setBus`
+    ///
+    ////////////////////////////////////////////////////////////
+    void setBus(SoundBus* bus) override;
+
 protected:
     ////////////////////////////////////////////////////////////
     /// \brief Default constructor
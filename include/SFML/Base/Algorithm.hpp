@@ -5,6 +5,7 @@
 // Headers
 ////////////////////////////////////////////////////////////
 #include "SFML/Base/Macros.hpp"
+#include "SFML/Base/PtrDiffT.hpp"
 #include "SFML/Base/SizeT.hpp"
 
 
@@ -213,4 +214,165 @@ template <typename Iter, typename Comparer>
     return true;
 }
 
+
+namespace priv
+{
+////////////////////////////////////////////////////////////
+template <typename Iter, typename Comparer>
+constexpr void insertionSort(Iter first, Iter last, Comparer& comp)
+{
+    if (first == last)
+        return;
+
+    for (Iter i = first + 1; i != last; ++i)
+    {
+        auto value = SFML_BASE_MOVE(*i);
+        Iter hole  = i;
+
+        for (; hole != first && comp(value, *(hole - 1)); --hole)
+            *hole = SFML_BASE_MOVE(*(hole - 1));
+
+        *hole = SFML_BASE_MOVE(value);
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+template <typename Iter, typename Comparer>
+constexpr void siftDown(Iter first, PtrDiffT hole, PtrDiffT count, Comparer& comp)
+{
+    auto value = SFML_BASE_MOVE(first[hole]);
+
+    for (PtrDiffT child = hole * 2 + 1; child < count; child = hole * 2 + 1)
+    {
+        if (child + 1 < count && comp(first[child], first[child + 1]))
+            ++child;
+
+        if (!comp(value, first[child]))
+            break;
+
+        first[hole] = SFML_BASE_MOVE(first[child]);
+        hole        = child;
+    }
+
+    first[hole] = SFML_BASE_MOVE(value);
+}
+
+
+////////////////////////////////////////////////////////////
+template <typename Iter, typename Comparer>
+constexpr void heapSort(Iter first, Iter last, Comparer& comp)
+{
+    const PtrDiffT count = last - first;
+
+    for (PtrDiffT i = count / 2; i-- > 0;)
+        siftDown(first, i, count, comp);
+
+    for (PtrDiffT end = count; end-- > 1;)
+    {
+        iterSwap(first, first + end);
+        siftDown(first, PtrDiffT{0}, end, comp);
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+template <typename Iter, typename Comparer>
+constexpr void moveMedianToFirst(Iter result, Iter a, Iter b, Iter c, Comparer& comp)
+{
+    if (comp(*a, *b))
+    {
+        if (comp(*b, *c))
+            iterSwap(result, b);
+        else if (comp(*a, *c))
+            iterSwap(result, c);
+        else
+            iterSwap(result, a);
+    }
+    else if (comp(*a, *c))
+        iterSwap(result, a);
+    else if (comp(*b, *c))
+        iterSwap(result, c);
+    else
+        iterSwap(result, b);
+}
+
+
+////////////////////////////////////////////////////////////
+template <typename Iter, typename Comparer>
+constexpr void introSortLoop(Iter first, Iter last, int depthLimit, Comparer& comp)
+{
+    // Small ranges are left for the final insertion sort
+    while (last - first > 16)
+    {
+        if (depthLimit-- == 0)
+        {
+            heapSort(first, last, comp);
+            return;
+        }
+
+        // The median of three as pivot guarantees that both scans below stop within the range
+        moveMedianToFirst(first, first + 1, first + (last - first) / 2, last - 1, comp);
+
+        Iter left  = first + 1;
+        Iter right = last;
+
+        while (true)
+        {
+            while (comp(*left, *first))
+                ++left;
+
+            --right;
+
+            while (comp(*first, *right))
+                --right;
+
+            if (!(left < right))
+                break;
+
+            iterSwap(left, right);
+            ++left;
+        }
+
+        // Recurse into the right part, loop over the left one
+        introSortLoop(left, last, depthLimit, comp);
+        last = left;
+    }
+}
+
+} // namespace priv
+
+
+////////////////////////////////////////////////////////////
+/// \brief Sort a random access range, not stable
+///
+/// Introsort: quicksort with a median of three pivot, falling
+/// back to heapsort on adversarial inputs to stay O(n log n),
+/// and finishing with an insertion sort over small partitions.
+///
+////////////////////////////////////////////////////////////
+template <typename Iter, typename Comparer>
+constexpr void sort(Iter first, Iter last, Comparer comp)
+{
+    const PtrDiffT count = last - first;
+
+    if (count < 2)
+        return;
+
+    int depthLimit = 0;
+    for (PtrDiffT n = count; n > 1; n /= 2)
+        depthLimit += 2;
+
+    priv::introSortLoop(first, last, depthLimit, comp);
+    priv::insertionSort(first, last, comp);
+}
+
+
+////////////////////////////////////////////////////////////
+template <typename Iter>
+constexpr void sort(Iter first, Iter last)
+{
+    base::sort(first, last, [](const auto& a, const auto& b) { return a < b; });
+}
+
 } // namespace sf::base
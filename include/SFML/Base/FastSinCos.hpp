@@ -5,77 +5,65 @@
 ////////////////////////////////////////////////////////////
 // Headers
 ////////////////////////////////////////////////////////////
-#include "SFML/Base/Assert.hpp"
 #include "SFML/Base/Constants.hpp"
 #include "SFML/Base/IntTypes.hpp"
+#include "SFML/Base/Simd.hpp"
 
 
 namespace sf::base::priv
 {
 ////////////////////////////////////////////////////////////
-enum : U32
-{
-    sinBits  = 16u,
-    sinMask  = ~(-1u << sinBits),
-    sinCount = sinMask + 1u // 65536
-};
+// Minimax polynomial coefficients of `sin` and `cos` over `[-pi/4, pi/4]`, from Cephes' `sinf` and `cosf`
+inline constexpr float sinCoeff0 = -1.6666654611e-1f;
+inline constexpr float sinCoeff1 = 8.3321608736e-3f;
+inline constexpr float sinCoeff2 = -1.9515295891e-4f;
 
+inline constexpr float cosCoeff0 = 4.166664568298827e-2f;
+inline constexpr float cosCoeff1 = -1.388731625493765e-3f;
+inline constexpr float cosCoeff2 = 2.443315711809948e-5f;
 
-////////////////////////////////////////////////////////////
-inline constexpr float radToIndex = static_cast<float>(sinCount) / tau;
+inline constexpr float twoOverPi = 0.63661977236f;
 
 
 ////////////////////////////////////////////////////////////
-[[nodiscard, gnu::always_inline, gnu::flatten, gnu::const]] inline constexpr U32 fastSinIdx(float radians) noexcept
+[[nodiscard, gnu::always_inline, gnu::const]] inline constexpr float sinPolynomial(float r) noexcept
 {
-    return static_cast<U32>(radians * radToIndex);
+    const float z = r * r;
+    return r + r * z * (sinCoeff0 + z * (sinCoeff1 + z * sinCoeff2));
 }
 
 
 ////////////////////////////////////////////////////////////
-[[nodiscard, gnu::always_inline, gnu::flatten, gnu::const]] inline constexpr U32 fastCosIdx(float radians) noexcept
+[[nodiscard, gnu::always_inline, gnu::const]] inline constexpr float cosPolynomial(float r) noexcept
 {
-    return fastSinIdx(radians) + 16384u;
+    const float z = r * r;
+    return 1.f - 0.5f * z + z * z * (cosCoeff0 + z * (cosCoeff1 + z * cosCoeff2));
 }
 
 
 ////////////////////////////////////////////////////////////
-inline constexpr struct SinTable
+/// Angle as `quadrant * halfPi + remainder`, with the remainder in `[-pi/4, pi/4]`
+///
+/// The reduction uses `halfPi` itself rather than an extended
+/// precision split of pi/2, so that multiples of `halfPi` reduce
+/// to exactly zero and right angles produce exact results.
+///
+////////////////////////////////////////////////////////////
+struct ReducedAngle
 {
-    ////////////////////////////////////////////////////////////
-    float data[sinCount]{
-#include "SFML/Base/FastSinCosTable.inl"
-    };
-
+    float remainder;
+    I32   quadrant;
+};
 
-    ////////////////////////////////////////////////////////////
-    static_assert(sizeof(data) == (sinCount) * sizeof(float));
 
+////////////////////////////////////////////////////////////
+[[nodiscard, gnu::always_inline, gnu::const]] inline constexpr ReducedAngle reduceAngle(float radians) noexcept
+{
+    const float scaled   = radians * twoOverPi;
+    const auto  quadrant = static_cast<I32>(scaled + (scaled >= 0.f ? 0.5f : -0.5f));
 
-    ////////////////////////////////////////////////////////////
-    [[nodiscard, gnu::always_inline, gnu::flatten]] constexpr SinTable() noexcept
-    {
-        data[fastSinIdx(halfPi * 0.f) & sinMask]  = 0.f;
-        data[fastSinIdx(halfPi * 0.5f) & sinMask] = 0.70710678118f;
-        data[fastSinIdx(halfPi * 1.f) & sinMask]  = 1.f;
-        data[fastSinIdx(halfPi * 1.5f) & sinMask] = 0.70710678118f;
-        data[fastSinIdx(halfPi * 2.f) & sinMask]  = 0.f;
-        data[fastSinIdx(halfPi * 2.5f) & sinMask] = -0.70710678118f;
-        data[fastSinIdx(halfPi * 3.f) & sinMask]  = -1.f;
-        data[fastSinIdx(halfPi * 3.5f) & sinMask] = -0.70710678118f;
-        data[fastSinIdx(halfPi * 4.f) & sinMask]  = 0.f;
-
-        data[fastCosIdx(halfPi * 0.f) & sinMask]  = 1.f;
-        data[fastCosIdx(halfPi * 0.5f) & sinMask] = 0.70710678118f;
-        data[fastCosIdx(halfPi * 1.f) & sinMask]  = 0.f;
-        data[fastCosIdx(halfPi * 1.5f) & sinMask] = -0.70710678118f;
-        data[fastCosIdx(halfPi * 2.f) & sinMask]  = -1.f;
-        data[fastCosIdx(halfPi * 2.5f) & sinMask] = -0.70710678118f;
-        data[fastCosIdx(halfPi * 3.f) & sinMask]  = 0.f;
-        data[fastCosIdx(halfPi * 3.5f) & sinMask] = 0.70710678118f;
-        data[fastCosIdx(halfPi * 4.f) & sinMask]  = 1.f;
-    }
-} sinTable;
+    return {radians - static_cast<float>(quadrant) * halfPi, quadrant};
+}
 
 } // namespace sf::base::priv
 
@@ -83,40 +71,191 @@ inline constexpr struct SinTable
 namespace sf::base
 {
 ////////////////////////////////////////////////////////////
-/// \brief TODO P1: docs
+/// \brief Fast approximation of `sin`, without lookup tables
+///
+/// Reduces the angle to `[-pi/4, pi/4]` and evaluates a minimax
+/// polynomial. The maximum absolute error is below `1e-7` over
+/// `[-pi/4, pi/4]` and below `2.5e-7` over `[-tau, tau]`. It grows
+/// with the magnitude of the angle beyond that (about `6e-6` at
+/// 100 radians), as the reduction is done in single precision.
+/// Multiples of `halfPi` produce exact results.
+///
+/// \param radians Angle in radians
+///
+/// \return Approximated sine of the angle
 ///
 ////////////////////////////////////////////////////////////
 [[nodiscard, gnu::always_inline, gnu::flatten, gnu::const]] inline constexpr float fastSin(float radians) noexcept
 {
-    SFML_BASE_ASSERT(radians >= 0.f && radians <= tau);
-    return priv::sinTable.data[priv::fastSinIdx(radians) & priv::sinMask];
+    const auto [remainder, quadrant] = priv::reduceAngle(radians);
+
+    const float result = (quadrant & 1) != 0 ? priv::cosPolynomial(remainder) : priv::sinPolynomial(remainder);
+    return (quadrant & 2) != 0 ? -result : result;
 }
 
+
 ////////////////////////////////////////////////////////////
-/// \brief TODO P1: docs
+/// \brief Fast approximation of `cos`, without lookup tables
+///
+/// Same accuracy as `fastSin`.
+///
+/// \param radians Angle in radians
+///
+/// \return Approximated cosine of the angle
 ///
 ////////////////////////////////////////////////////////////
 [[nodiscard, gnu::always_inline, gnu::flatten, gnu::const]] inline constexpr float fastCos(float radians) noexcept
 {
-    SFML_BASE_ASSERT(radians >= 0.f && radians <= tau);
-    return priv::sinTable.data[priv::fastCosIdx(radians) & priv::sinMask];
+    const auto [remainder, quadrant] = priv::reduceAngle(radians);
+
+    const float result = (quadrant & 1) != 0 ? priv::sinPolynomial(remainder) : priv::cosPolynomial(remainder);
+    return ((quadrant + 1) & 2) != 0 ? -result : result;
 }
 
+
 ////////////////////////////////////////////////////////////
-/// \brief TODO P1: docs
+/// \brief Fast approximation of both `sin` and `cos`, sharing the angle reduction
+///
+/// Same accuracy as `fastSin`.
+///
+/// \param radians Angle in radians
+///
+/// \return Approximated sine and cosine of the angle
 ///
 ////////////////////////////////////////////////////////////
 [[nodiscard, gnu::always_inline, gnu::flatten, gnu::const]] inline constexpr auto fastSinCos(float radians) noexcept
 {
-    SFML_BASE_ASSERT(radians >= 0.f && radians <= tau);
-
     struct Result
     {
         float sin, cos;
     };
 
-    const auto sinIndex = static_cast<U32>(radians * priv::radToIndex);
-    return Result{priv::sinTable.data[sinIndex & priv::sinMask], priv::sinTable.data[(sinIndex + 16384u) & priv::sinMask]};
+    const auto [remainder, quadrant] = priv::reduceAngle(radians);
+
+    const float sinPoly = priv::sinPolynomial(remainder);
+    const float cosPoly = priv::cosPolynomial(remainder);
+
+    // Branchless selection, as quadrants of arbitrary angles are unpredictable
+    const auto  odd     = static_cast<float>(quadrant & 1);
+    const auto  even    = 1.f - odd;
+    const float sinSign = static_cast<float>(1 - (quadrant & 2));
+    const float cosSign = static_cast<float>(1 - ((quadrant + 1) & 2));
+
+    return Result{(sinPoly * even + cosPoly * odd) * sinSign, (cosPoly * even + sinPoly * odd) * cosSign};
+}
+
+
+////////////////////////////////////////////////////////////
+/// \brief Compute `fastSinCos` of four angles at once
+///
+/// Uses SIMD instructions where available and produces the same
+/// results as calling `fastSinCos` on each angle.
+///
+/// \param radians Four angles in radians
+/// \param sines   Receives the four sines
+/// \param cosines Receives the four cosines
+///
+////////////////////////////////////////////////////////////
+[[gnu::always_inline, gnu::flatten]] inline void fastSinCos4(const float* const radians,
+                                                             float* const       sines,
+                                                             float* const       cosines) noexcept
+{
+#if defined(SFML_BASE_SIMD_SSE2)
+    const __m128 x      = _mm_loadu_ps(radians);
+    const __m128 scaled = _mm_mul_ps(x, _mm_set1_ps(priv::twoOverPi));
+
+    // Round half away from zero, as the scalar reduction does
+    const __m128  half     = _mm_or_ps(_mm_and_ps(scaled, _mm_set1_ps(-0.f)), _mm_set1_ps(0.5f));
+    const __m128i quadrant = _mm_cvttps_epi32(_mm_add_ps(scaled, half));
+    const __m128  r        = _mm_sub_ps(x, _mm_mul_ps(_mm_cvtepi32_ps(quadrant), _mm_set1_ps(halfPi)));
+    const __m128  z        = _mm_mul_ps(r, r);
+
+    __m128 sinTerms = _mm_add_ps(_mm_set1_ps(priv::sinCoeff1), _mm_mul_ps(z, _mm_set1_ps(priv::sinCoeff2)));
+    sinTerms        = _mm_add_ps(_mm_set1_ps(priv::sinCoeff0), _mm_mul_ps(z, sinTerms));
+
+    __m128 cosTerms = _mm_add_ps(_mm_set1_ps(priv::cosCoeff1), _mm_mul_ps(z, _mm_set1_ps(priv::cosCoeff2)));
+    cosTerms        = _mm_add_ps(_mm_set1_ps(priv::cosCoeff0), _mm_mul_ps(z, cosTerms));
+
+    const __m128 sinPoly = _mm_add_ps(r, _mm_mul_ps(_mm_mul_ps(r, z), sinTerms));
+    const __m128 cosPoly = _mm_add_ps(_mm_sub_ps(_mm_set1_ps(1.f), _mm_mul_ps(_mm_set1_ps(0.5f), z)),
+                                      _mm_mul_ps(_mm_mul_ps(z, z), cosTerms));
+
+    // Swap the polynomials in odd quadrants, then move bit 1 of the quadrant into the sign bit
+    const __m128i one  = _mm_set1_epi32(1);
+    const __m128i two  = _mm_set1_epi32(2);
+    const __m128  swap = _mm_castsi128_ps(_mm_cmpeq_epi32(_mm_and_si128(quadrant, one), one));
+
+    const __m128 sine   = _mm_or_ps(_mm_and_ps(swap, cosPoly), _mm_andnot_ps(swap, sinPoly));
+    const __m128 cosine = _mm_or_ps(_mm_and_ps(swap, sinPoly), _mm_andnot_ps(swap, cosPoly));
+
+    const __m128i sinSign = _mm_slli_epi32(_mm_and_si128(quadrant, two), 30);
+    const __m128i cosSign = _mm_slli_epi32(_mm_and_si128(_mm_add_epi32(quadrant, one), two), 30);
+
+    _mm_storeu_ps(sines, _mm_xor_ps(sine, _mm_castsi128_ps(sinSign)));
+    _mm_storeu_ps(cosines, _mm_xor_ps(cosine, _mm_castsi128_ps(cosSign)));
+#elif defined(SFML_BASE_SIMD_NEON)
+    const float32x4_t x      = vld1q_f32(radians);
+    const float32x4_t scaled = vmulq_n_f32(x, priv::twoOverPi);
+
+    // Round half away from zero, as the scalar reduction does
+    const uint32x4_t  signBit  = vandq_u32(vreinterpretq_u32_f32(scaled), vdupq_n_u32(0x80000000u));
+    const float32x4_t half     = vreinterpretq_f32_u32(vorrq_u32(signBit, vreinterpretq_u32_f32(vdupq_n_f32(0.5f))));
+    const int32x4_t   quadrant = vcvtq_s32_f32(vaddq_f32(scaled, half));
+    const float32x4_t r        = vsubq_f32(x, vmulq_n_f32(vcvtq_f32_s32(quadrant), halfPi));
+    const float32x4_t z        = vmulq_f32(r, r);
+
+    float32x4_t sinTerms = vaddq_f32(vdupq_n_f32(priv::sinCoeff1), vmulq_n_f32(z, priv::sinCoeff2));
+    sinTerms             = vaddq_f32(vdupq_n_f32(priv::sinCoeff0), vmulq_f32(z, sinTerms));
+
+    float32x4_t cosTerms = vaddq_f32(vdupq_n_f32(priv::cosCoeff1), vmulq_n_f32(z, priv::cosCoeff2));
+    cosTerms             = vaddq_f32(vdupq_n_f32(priv::cosCoeff0), vmulq_f32(z, cosTerms));
+
+    const float32x4_t sinPoly = vaddq_f32(r, vmulq_f32(vmulq_f32(r, z), sinTerms));
+    const float32x4_t cosPoly = vaddq_f32(vsubq_f32(vdupq_n_f32(1.f), vmulq_n_f32(z, 0.5f)),
+                                          vmulq_f32(vmulq_f32(z, z), cosTerms));
+
+    // Swap the polynomials in odd quadrants, then move bit 1 of the quadrant into the sign bit
+    const uint32x4_t swap = vtstq_s32(quadrant, vdupq_n_s32(1));
+
+    const uint32x4_t sinSign = vshlq_n_u32(vandq_u32(vreinterpretq_u32_s32(quadrant), vdupq_n_u32(2u)), 30);
+    const uint32x4_t cosSign = vshlq_n_u32(vandq_u32(vreinterpretq_u32_s32(vaddq_s32(quadrant, vdupq_n_s32(1))),
+                                                     vdupq_n_u32(2u)),
+                                           30);
+
+    const uint32x4_t sine   = vreinterpretq_u32_f32(vbslq_f32(swap, cosPoly, sinPoly));
+    const uint32x4_t cosine = vreinterpretq_u32_f32(vbslq_f32(swap, sinPoly, cosPoly));
+
+    vst1q_f32(sines, vreinterpretq_f32_u32(veorq_u32(sine, sinSign)));
+    vst1q_f32(cosines, vreinterpretq_f32_u32(veorq_u32(cosine, cosSign)));
+#else
+    for (int i = 0; i < 4; ++i)
+    {
+        const auto [sine, cosine] = fastSinCos(radians[i]);
+
+        sines[i]   = sine;
+        cosines[i] = cosine;
+    }
+#endif
+}
+
+
+////////////////////////////////////////////////////////////
+/// \brief Compute `fastSinCos` of eight angles at once
+///
+/// Processes two groups of four angles, whose independent
+/// computations are interleaved by the compiler.
+///
+/// \param radians Eight angles in radians
+/// \param sines   Receives the eight sines
+/// \param cosines Receives the eight cosines
+///
+////////////////////////////////////////////////////////////
+[[gnu::always_inline, gnu::flatten]] inline void fastSinCos8(const float* const radians,
+                                                             float* const       sines,
+                                                             float* const       cosines) noexcept
+{
+    fastSinCos4(radians, sines, cosines);
+    fastSinCos4(radians + 4, sines + 4, cosines + 4);
 }
 
 } // namespace sf::base
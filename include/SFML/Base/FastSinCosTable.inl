@@ -1,3 +0,0 @@
-// clang-format off
-.000143811f,.000239685f,.000335558f,.000431432f,.000527306f,.00062318f,.000719053f,.000814927f,.000910801f,.00100667f,.00110255f,.00119842f,.0012943f,.00139017f,.00148604f,.00158192f,.00167779f,.00177366f,.00186954f,.00196541f,.00206129f,.00215716f,.00225303f,.00234891f,.00244478f,.00254065f,.00263653f,.0027324f,.00282827f,.00292415f,.00302002f,.00311589f,.00321177f,.00330764f,.00340351f,.00349939f,.00359526f,.00369113f,.00378701f,.00388288f,.00397875f,.00407463f,.0041705f,.00426637f,.00436224f,.00445812f,.00455399f,.00464986f,.00474574f,.00484161f,.00493748f,.00503335f,.00512923f,.0052251f,.00532097f,.00541684f,.00551272f,.00560859f,.00570446f,.00580033f,.0058962f,.00599208f,.00608795f,.00618382f,.00627969f,.00637556f,.00647144f,.00656731f,.00666318f,.00675905f,.00685492f,.00695079f,.00704667f,.00714254f,.00723841f,.00733428f,.00743015f,.00752602f,.00762189f,.00771776f,.00781364f,.00790951f,.00800538f,.00810125f,.00819712f,.00829299f,.00838886f,.00848473f,.0085806f,.00867647f,.00877234f,.00886821f,.00896408f,.00905995f,.00915582f,.00925169f,.00934756f,.00944343f,.0095393f,.00963517f,.00973104f,.00982691f,.00992278f,.0100186f,.0101145f,.0102104f,.0103063f,.0104021f,.010498f,.0105939f,.0106897f,.0107856f,.0108815f,.0109773f,.0110732f,.0111691f,.0112649f,.0113608f,.0114567f,.0115525f,.0116484f,.0117443f,.0118401f,.011936f,.0120319f,.0121277f,.0122236f,.0123195f,.0124153f,.0125112f,.0126071f,.0127029f,.0127988f,.0128947f,.0129905f,.0130864f,.0131823f,.0132781f,.013374f,.0134699f,.0135657f,.0136616f,.0137575f,.0138533f,.0139492f,.0140451f,.0141409f,.0142368f,.0143326f,.0144285f,.0145244f,.0146202f,.0147161f,.014812f,.0149078f,.0150037f,.0150995f,.0151954f,.0152913f,.0153871f,.015483f,.0155789f,.0156747f,.0157706f,.0158664f,.0159623f,.0160582f,.016154f,.0162499f,.0163458f,.0164416f,.0165375f,.0166333f,.0167292f,.0168251f,.0169209f,.0170168f,.0171126f,.0172085f,.0173044f,.0174002f,.0174961f,.0175919f,.0176878f,.0177837f,.0178795f,.0179754f,.0180712f,.0181671f,.0182629f,.0183588f,.0184547f,.0185505f,.0186464f,.0187422f,.0188381f,.0189339f,.0190298f,.0191257f,.0192215f,.0193174f,.0194132f,.0195091f,.0196049f,.0197008f,.0197966f,.0198925f,.0199884f,.0200842f,.0201801f,.0202759f,.0203718f,.0204676f,.0205635f,.0206593f,.0207552f,.020851f,.0209469f,.0210427f,.0211386f,.0212345f,.0213303f,.0214262f,.021522f,.0216179f,.0217137f,.0218096f,.0219054f,.0220013f,.0220971f,.022193f,.0222888f,.0223847f,.0224805f,.0225764f,.0226722f,.0227681f,.0228639f,.0229598f,.0230556f,.0231515f,.0232473f,.0233432f,.023439f,.0235348f,.0236307f,.0237265f,.0238224f,.0239182f,.0240141f,.0241099f,.0242058f,.0243016f,.0243975f,.0244933f,.0245892f,.024685f,.0247808f,.0248767f,.0249725f,.0250684f,.0251642f,.0252601f,.0253559f,.0254517f,.0255476f,.0256434f,.0257393f,.0258351f,.025931f,.0260268f,.0261226f,.0262185f,.0263143f,.0264102f,.026506f,.0266018f,.0266977f,.0267935f,.0268894f,.0269852f,.027081f,.0271769f,.0272727f,.0273686f,.0274644f,.0275602f,.0276561f,.0277519f,.0278477f,.0279436f,.0280394f,.0281352f,.0282311f,.0283269f,.0284228f,.0285186f,.0286144f,.0287103f,.0288061f,.0289019f,.0289978f,.0290936f,.0291894f,.0292853f,.0293811f,.0294769f,.0295728f,.0296686f,.0297644f,.0298603f,.0299561f,.0300519f,.0301477f,.0302436f,.0303394f,.0304352f,.0305311f,.0306269f,.0307227f,.0308185f,.0309144f,.0310102f,.031106f,.0312019f,.0312977f,.0313935f,.0314893f,.0315852f,.031681f,.0317768f,.0318726f,.0319685f,.0320643f,.0321601f,.0322559f,.0323518f,.0324476f,.0325434f,.0326392f,.0327351f,.0328309f,.0329267f,.0330225f,.0331183f,.0332142f,.03331f,.0334058f,.0335016f,.0335974f,.0336933f,.0337891f,.0338849f,.0339807f,.0340765f,.0341724f,.0342682f,.034364f,.0344598f,.0345556f,.0346514f,.0347473f,.0348431f,.0349389f,.0350347f,.0351305f,.0352263f,.0353221f,.035418f,.0355138f,.0356096f,.0357054f,.0358012f,.035897f,.0359928f,.0360886f,.0361845f,.0362803f,.0363761f,.0364719f,.0365677f,.0366635f,.0367593f,.0368551f,.0369509f,.0370467f,.0371426f,.0372384f,.0373342f,.03743f,.0375258f,.0376216f,.0377174f,.0378132f,.037909f,.0380048f,.0381006f,.0381964f,.0382922f,.038388f,.0384838f,.0385796f,.0386754f,.0387712f,.038867f,.0389628f,.0390586f,.0391544f,.0392502f,.039346f,.0394418f,.0395376f,.0396334f,.0397292f,.039825f,.0399208f,.0400166f,.0401124f,.0402082f,.040304f,.0403998f,.0404956f,.0405914f,.0406872f,.040783f,.0408788f,.0409746f,.0410704f,.0411662f,.041262f,.0413577f,.0414535f,.0415493f,.0416451f,.0417409f,.0418367f,.0419325f,.0420283f,.0421241f,.0422199f,.0423156f,.0424114f,.0425072f,.042603f,.0426988f,.0427946f,.0428904f,.0429862f,.0430819f,.0431777f,.0432735f,.0433693f,.0434651f,.0435609f,.0436566f,.0437524f,.0438482f,.043944f,.0440398f,.0441355f,.0442313f,.0443271f,.0444229f,.0445187f,.0446144f,.0447102f,.044806f,.0449018f,.0449976f,.0450933f,.0451891f,.0452849f,.0453807f,.0454764f,.0455722f,.045668f,.0457637f,.0458595f,.0459553f,.0460511f,.0461468f,.0462426f,.0463384f,.0464342f,.0465299f,.0466257f,.0467215f,.0468172f,.046913f,.0470088f,.0471045f,.0472003f,.0472961f,.0473918f,.0474876f,.0475834f,.0476791f,.0477749f,.0478707f,.0479664f,.0480622f,.048158f,.0482537f,.0483495f,.0484452f,.048541f,.0486368f,.0487325f,.0488283f,.048924f,.0490198f,.0491156f,.0492113f,.0493071f,.0494028f,.0494986f,.0495943f,.0496901f,.0497858f,.0498816f,.0499774f,.0500731f,.0501689f,.0502646f,.0503604f,.0504561f,.0505519f,.0506476f,.0507434f,.0508391f,.0509349f,.0510306f,.0511264f,.0512221f,.0513179f,.0514136f,.0515094f,.0516051f,.0517009f,.0517966f,.0518923f,.0519881f,.0520838f,.0521796f,.0522753f,.0523711f,.0524668f,.0525625f,.0526583f,.052754f,.0528498f,.0529455f,.0530412f,.053137f,.0532327f,.0533285f,.0534242f,.0535199f,.0536157f,.0537114f,.0538071f,.0539029f,.0539986f,.0540943f,.0541901f,.0542858f,.0543815f,.0544773f,.054573f,.0546687f,.0547645f,.0548602f,.0549559f,.0550517f,.0551474f,.0552431f,.0553388f,.0554346f,.0555303f,.055626f,.0557217f,.0558175f,.0559132f,.0560089f,.0561046f,.0562004f,.0562961f,.0563918f,.0564875f,.0565832f,.056679f,.0567747f,.0568704f,.0569661f,.0570618f,.0571576f,.0572533f,.057349f,.0574447f,.0575404f,.0576361f,.0577318f,.0578276f,.0579233f,.058019f,.0581147f,.0582104f,.0583061f,.0584018f,.0584975f,.0585933f,.058689f,.0587847f,.0588804f,.0589761f,.0590718f,.0591675f,.0592632f,.0593589f,.0594546f,.0595503f,.059646f,.0597417f,.0598374f,.0599331f,.0600288f,.0601245f,.0602202f,.0603159f,.0604116f,.0605073f,.060603f,.0606987f,.0607944f,.0608901f,.0609858f,.0610815f,.0611772f,.0612729f,.0613686f,.0614643f,.06156f,.0616557f,.0617514f,.061847f,.0619427f,.0620384f,.0621341f,.0622298f,.0623255f,.0624212f,.0625169f,.0626125f,.0627082f,.0628039f,.0628996f,.0629953f,.063091f,.0631867f,.0632823f,.063378f,.0634737f,.0635694f,.0636651f,.0637607f,.0638564f,.0639521f,.0640478f,.0641434f,.0642391f,.0643348f,.0644305f,.0645261f,.0646218f,.0647175f,.0648132f,.0649088f,.0650045f,.0651002f,.0651958f,.0652915f,.0653872f,.0654829f,.0655785f,.0656742f,.0657699f,.0658655f,.0659612f,.0660568f,.0661525f,.0662482f,.0663438f,.0664395f,.0665352f,.0666308f,.0667265f,.0668221f,.0669178f,.0670135f,.0671091f,.0672048f,.0673004f,.0673961f,.0674918f,.0675874f,.0676831f,.0677787f,.0678744f,.06797f,.0680657f,.0681613f,.068257f,.0683526f,.0684483f,.0685439f,.0686396f,.0687352f,.0688309f,.0689265f,.0690221f,.0691178f,.0692134f,.0693091f,.0694047f,.0695004f,.069596f,.0696917f,.0697873f,.0698829f,.0699786f,.0700742f,.0701699f,.0702655f,.0703611f,.0704568f,.0705524f,.070648f,.0707437f,.0708393f,.0709349f,.0710306f,.0711262f,.0712218f,.0713174f,.0714131f,.0715087f,.0716043f,.0717f,.0717956f,.0718912f,.0719868f,.0720825f,.0721781f,.0722737f,.0723693f,.072465f,.0725606f,.0726562f,.0727518f,.0728474f,.0729431f,.0730387f,.0731343f,.0732299f,.0733255f,.0734211f,.0735168f,.0736124f,.073708f,.0738036f,.0738992f,.0739948f,.0740904f,.074186f,.0742817f,.0743773f,.0744729f,.0745685f,.0746641f,.0747597f,.0748553f,.0749509f,.0750465f,.0751421f,.0752377f,.0753333f,.0754289f,.0755245f,.0756201f,.0757157f,.0758113f,.0759069f,.0760025f,.0760981f,.0761937f,.0762893f,.0763849f,.0764805f,.0765761f,.0766717f,.0767673f,.0768628f,.0769584f,.077054f,.0771496f,.0772452f,.0773408f,.0774364f,.077532f,.0776275f,.0777231f,.0778187f,.0779143f,.0780099f,.0781055f,.078201f,.0782966f,.0783922f,.0784878f,.0785833f,.0786789f,.0787745f,.0788701f,.0789656f,.0790612f,.0791568f,.0792524f,.0793479f,.0794435f,.0795391f,.0796347f,.0797302f,.0798258f,.0799214f,.0800169f,.0801125f,.0802081f,.0803036f,.0803992f,.0804948f,.0805903f,.0806859f,.0807814f,.080877f,.0809726f,.0810681f,.0811637f,.0812592f,.0813548f,.0814503f,.0815459f,.0816415f,.081737f,.0818326f,.0819281f,.0820237f,.0821192f,.0822148f,.0823103f,.0824059f,.0825014f,.082597f,.0826925f,.082788f,.0828836f,.0829791f,.0830747f,.0831702f,.0832658f,.0833613f,.0834568f,.0835524f,.0836479f,.0837434f,.083839f,.0839345f,.0840301f,.0841256f,.0842211f,.0843167f,.0844122f,.0845077f,.0846033f,.0846988f,.0847943f,.0848898f,.0849854f,.0850809f,.0851764f,.0852719f,.0853675f,.085463f,.0855585f,.085654f,.0857496f,.0858451f,.0859406f,.0860361f,.0861316f,.0862271f,.0863227f,.0864182f,.0865137f,.0866092f,.0867047f,.0868002f,.0868957f,.0869913f,.0870868f,.0871823f,.0872778f,.0873733f,.0874688f,.0875643f,.0876598f,.0877553f,.0878508f,.0879463f,.0880418f,.0881373f,.0882328f,.0883283f,.0884238f,.0885193f,.0886148f,.0887103f,.0888058f,.0889013f,.0889968f,.0890923f,.0891878f,.0892833f,.0893788f,.0894743f,.0895697f,.0896652f,.0897607f,.0898562f,.0899517f,.0900472f,.0901427f,.0902381f,.0903336f,.0904291f,.0905246f,.0906201f,.0907155f,.090811f,.0909065f,.091002f,.0910975f,.0911929f,.0912884f,.0913839f,.0914793f,.0915748f,.0916703f,.0917658f,.0918612f,.0919567f,.0920522f,.0921476f,.0922431f,.0923386f,.092434f,.0925295f,.0926249f,.0927204f,.0928159f,.0929113f,.0930068f,.0931022f,.0931977f,.0932932f,.0933886f,.0934841f,.0935795f,.093675f,.0937704f,.0938659f,.0939613f,.0940568f,.0941522f,.0942477f,.0943431f,.0944386f,.094534f,.0946295f,.0947249f,.0948203f,.0949158f,.0950112f,.0951067f,.0952021f,.0952975f,.095393f,.0954884f,.0955838f,.0956793f,.0957747f,.0958701f,.0959656f,.096061f,.0961564f,.0962519f,.0963473f,.0964427f,.0965381f,.0966336f,.096729f,.0968244f,.0969198f,.0970153f,.0971107f,.0972061f,.0973015f,.0973969f,.0974924f,.0975878f,.0976832f,.0977786f,.097874f,.0979694f,.0980648f,.0981603f,.0982557f,.0983511f,.0984465f,.0985419f,.0986373f,.0987327f,.0988281f,.0989235f,.0990189f,.0991143f,.0992097f,.0993051f,.0994005f,.0994959f,.0995913f,.0996867f,.0997821f,.0998775f,.0999729f,0.100068f,0.100164f,0.100259f,0.100354f,0.10045f,0.100545f,0.100641f,0.100736f,0.100831f,0.100927f,0.101022f,0.101118f,0.101213f,0.101308f,0.101404f,0.101499f,0.101594f,0.10169f,0.101785f,0.101881f,0.101976f,0.102071f,0.102167f,0.102262f,0.102357f,0.102453f,0.102548f,0.102644f,0.102739f,0.102834f,0.10293f,0.103025f,0.10312f,0.103216f,0.103311f,0.103406f,0.103502f,0.103597f,0.103693f,0.103788f,0.103883f,0.103979f,0.104074f,0.104169f,0.104265f,0.10436f,0.104455f,0.104551f,0.104646f,0.104741f,0.104837f,0.104932f,0.105027f,0.105123f,0.105218f,0.105313f,0.105409f,0.105504f,0.105599f,0.105695f,0.10579f,0.105885f,0.105981f,0.106076f,0.106171f,0.106267f,0.106362f,0.106457f,0.106553f,0.106648f,0.106743f,0.106839f,0.106934f,0.107029f,0.107125f,0.10722f,0.107315f,0.107411f,0.107506f,0.107601f,0.107697f,0.107792f,0.107887f,0.107983f,0.108078f,0.108173f,0.108269f,0.108364f,0.108459f,0.108554f,0.10865f,0.108745f,0.10884f,0.108936f,0.109031f,0.109126f,0.109222f,0.109317f,0.109412f,0.109508f,0.109603f,0.109698f,0.109793f,0.109889f,0.109984f,0.110079f,0.110175f,0.11027f,0.110365f,0.11046f,0.110556f,0.110651f,0.110746f,0.110842f,0.110937f,0.111032f,0.111127f,0.111223f,0.111318f,0.111413f,0.111509f,0.111604f,0.111699f,0.111794f,0.11189f,0.111985f,0.11208f,0.112175f,0.112271f,0.112366f,0.112461f,0.112556f,0.112652f,0.112747f,0.112842f,0.112938f,0.113033f,0.113128f,0.113223f,0.113319f,0.113414f,0.113509f,0.113604f,0.1137f,0.113795f,0.11389f,0.113985f,0.114081f,0.114176f,0.114271f,0.114366f,0.114462f,0.114557f,0.114652f,0.114747f,0.114843f,0.114938f,0.115033f,0.115128f,0.115223f,0.115319f,0.115414f,0.115509f,0.115604f,0.1157f,0.115795f,0.11589f,0.115985f,0.116081f,0.116176f,0.116271f,0.116366f,0.116461f,0.116557f,0.116652f,0.116747f,0.116842f,0.116938f,0.117033f,0.117128f,0.117223f,0.117318f,0.117414f,0.117509f,0.117604f,0.117699f,0.117794f,0.11789f,0.117985f,0.11808f,0.118175f,0.11827f,0.118366f,0.118461f,0.118556f,0.118651f,0.118746f,0.118842f,0.118937f,0.119032f,0.119127f,0.119222f,0.119318f,0.119413f,0.119508f,0.119603f,0.119698f,0.119794f,0.119889f,0.119984f,0.120079f,0.120174f,0.120269f,0.120365f,0.12046f,0.120555f,0.12065f,0.120745f,0.120841f,0.120936f,0.121031f,0.121126f,0.121221f,0.121316f,0.121412f,0.121507f,0.121602f,0.121697f,0.121792f,0.121887f,0.121982f,0.122078f,0.122173f,0.122268f,0.122363f,0.122458f,0.122553f,0.122649f,0.122744f,0.122839f,0.122934f,0.123029f,0.123124f,0.123219f,0.123315f,0.12341f,0.123505f,0.1236f,0.123695f,0.12379f,0.123885f,0.123981f,0.124076f,0.124171f,0.124266f,0.124361f,0.124456f,0.124551f,0.124646f,0.124742f,0.124837f,0.124932f,0.125027f,0.125122f,0.125217f,0.125312f,0.125407f,0.125503f,0.125598f,0.125693f,0.125788f,0.125883f,0.125978f,0.126073f,0.126168f,0.126263f,0.126359f,0.126454f,0.126549f,0.126644f,0.126739f,0.126834f,0.126929f,0.127024f,0.127119f,0.127214f,0.12731f,0.127405f,0.1275f,0.127595f,0.12769f,0.127785f,0.12788f,0.127975f,0.12807f,0.128165f,0.12826f,0.128356f,0.128451f,0.128546f,0.128641f,0.128736f,0.128831f,0.128926f,0.129021f,0.129116f,0.129211f,0.129306f,0.129401f,0.129496f,0.129591f,0.129687f,0.129782f,0.129877f,0.129972f,0.130067f,0.130162f,0.130257f,0.130352f,0.130447f,0.130542f,0.130637f,0.130732f,0.130827f,0.130922f,0.131017f,0.131112f,0.131207f,0.131302f,0.131397f,0.131493f,0.131588f,0.131683f,0.131778f,0.131873f,0.131968f,0.132063f,0.132158f,0.132253f,0.132348f,0.132443f,0.132538f,0.132633f,0.132728f,0.132823f,0.132918f,0.133013f,0.133108f,0.133203f,0.133298f,0.133393f,0.133488f,0.133583f,0.133678f,0.133773f,0.133868f,0.133963f,0.134058f,0.134153f,0.134248f,0.134343f,0.134438f,0.134533f,0.134628f,0.134723f,0.134818f,0.134913f,0.135008f,0.135103f,0.135198f,0.135293f,0.135388f,0.135483f,0.135578f,0.135673f,0.135768f,0.135863f,0.135958f,0.136053f,0.136148f,0.136243f,0.136338f,0.136433f,0.136528f,0.136623f,0.136718f,0.136813f,0.136908f,0.137003f,0.137098f,0.137193f,0.137288f,0.137383f,0.137478f,0.137573f,0.137668f,0.137763f,0.137858f,0.137952f,0.138047f,0.138142f,0.138237f,0.138332f,0.138427f,0.138522f,0.138617f,0.138712f,0.138807f,0.138902f,0.138997f,0.139092f,0.139187f,0.139282f,0.139377f,0.139472f,0.139567f,0.139662f,0.139756f,0.139851f,0.139946f,0.140041f,0.140136f,0.140231f,0.140326f,0.140421f,0.140516f,0.140611f,0.140706f,0.140801f,0.140896f,0.14099f,0.141085f,0.14118f,0.141275f,0.14137f,0.141465f,0.14156f,0.141655f,0.14175f,0.141845f,0.14194f,0.142034f,0.142129f,0.142224f,0.142319f,0.142414f,0.142509f,0.142604f,0.142699f,0.142794f,0.142889f,0.142983f,0.143078f,0.143173f,0.143268f,0.143363f,0.143458f,0.143553f,0.143648f,0.143742f,0.143837f,0.143932f,0.144027f,0.144122f,0.144217f,0.144312f,0.144407f,0.144501f,0.144596f,0.144691f,0.144786f,0.144881f,0.144976f,0.145071f,0.145166f,0.14526f,0.145355f,0.14545f,0.145545f,0.14564f,0.145735f,0.145829f,0.145924f,0.146019f,0.146114f,0.146209f,0.146304f,0.146399f,0.146493f,0.146588f,0.146683f,0.146778f,0.146873f,0.146968f,0.147062f,0.147157f,0.147252f,0.147347f,0.147442f,0.147537f,0.147631f,0.147726f,0.147821f,0.147916f,0.148011f,0.148105f,0.1482f,0.148295f,0.14839f,0.148485f,0.14858f,0.148674f,0.148769f,0.148864f,0.148959f,0.149054f,0.149148f,0.149243f,0.149338f,0.149433f,0.149528f,0.149622f,0.149717f,0.149812f,0.149907f,0.150002f,0.150096f,0.150191f,0.150286f,0.150381f,0.150475f,0.15057f,0.150665f,0.15076f,0.150855f,0.150949f,0.151044f,0.151139f,0.151234f,0.151328f,0.151423f,0.151518f,0.151613f,0.151707f,0.151802f,0.151897f,0.151992f,0.152087f,0.152181f,0.152276f,0.152371f,0.152466f,0.15256f,0.152655f,0.15275f,0.152845f,0.152939f,0.153034f,0.153129f,0.153224f,0.153318f,0.153413f,0.153508f,0.153602f,0.153697f,0.153792f,0.153887f,0.153981f,0.154076f,0.154171f,0.154266f,0.15436f,0.154455f,0.15455f,0.154645f,0.154739f,0.154834f,0.154929f,0.155023f,0.155118f,0.155213f,0.155308f,0.155402f,0.155497f,0.155592f,0.155686f,0.155781f,0.155876f,0.15597f,0.156065f,0.15616f,0.156255f,0.156349f,0.156444f,0.156539f,0.156633f,0.156728f,0.156823f,0.156917f,0.157012f,0.157107f,0.157201f,0.157296f,0.157391f,0.157485f,0.15758f,0.157675f,0.15777f,0.157864f,0.157959f,0.158054f,0.158148f,0.158243f,0.158338f,0.158432f,0.158527f,0.158622f,0.158716f,0.158811f,0.158905f,0.159f,0.159095f,0.159189f,0.159284f,0.159379f,0.159473f,0.159568f,0.159663f,0.159757f,0.159852f,0.159947f,0.160041f,0.160136f,0.160231f,0.160325f,0.16042f,0.160514f,0.160609f,0.160704f,0.160798f,0.160893f,0.160988f,0.161082f,0.161177f,0.161271f,0.161366f,0.161461f,0.161555f,0.16165f,0.161744f,0.161839f,0.161934f,0.162028f,0.162123f,0.162218f,0.162312f,0.162407f,0.162501f,0.162596f,0.162691f,0.162785f,0.16288f,0.162974f,0.163069f,0.163163f,0.163258f,0.163353f,0.163447f,0.163542f,0.163636f,0.163731f,0.163826f,0.16392f,0.164015f,0.164109f,0.164204f,0.164298f,0.164393f,0.164488f,0.164582f,0.164677f,0.164771f,0.164866f,0.16496f,0.165055f,0.16515f,0.165244f,0.165339f,0.165433f,0.165528f,0.165622f,0.165717f,0.165811f,0.165906f,0.166f,0.166095f,0.16619f,0.166284f,0.166379f,0.166473f,0.166568f,0.166662f,0.166757f,0.166851f,0.166946f,0.16704f,0.167135f,0.167229f,0.167324f,0.167418f,0.167513f,0.167608f,0.167702f,0.167797f,0.167891f,0.167986f,0.16808f,0.168175f,0.168269f,0.168364f,0.168458f,0.168553f,0.168647f,0.168742f,0.168836f,0.168931f,0.169025f,0.16912f,0.169214f,0.169309f,0.169403f,0.169498f,0.169592f,0.169687f,0.169781f,0.169875f,0.16997f,0.170064f,0.170159f,0.170253f,0.170348f,0.170442f,0.170537f,0.170631f,0.170726f,0.17082f,0.170915f,0.171009f,0.171104f,0.171198f,0.171293f,0.171387f,0.171481f,0.171576f,0.17167f,0.171765f,0.171859f,0.171954f,0.172048f,0.172143f,0.172237f,0.172331f,0.172426f,0.17252f,0.172615f,0.172709f,0.172804f,0.172898f,0.172992f,0.173087f,0.173181f,0.173276f,0.17337f,0.173465f,0.173559f,0.173653f,0.173748f,0.173842f,0.173937f,0.174031f,0.174125f,0.17422f,0.174314f,0.174409f,0.174503f,0.174598f,0.174692f,0.174786f,0.174881f,0.174975f,0.17507f,0.175164f,0.175258f,0.175353f,0.175447f,0.175541f,0.175636f,0.17573f,0.175825f,0.175919f,0.176013f,0.176108f,0.176202f,0.176296f,0.176391f,0.176485f,0.17658f,0.176674f,0.176768f,0.176863f,0.176957f,0.177051f,0.177146f,0.17724f,0.177334f,0.177429f,0.177523f,0.177618f,0.177712f,0.177806f,0.177901f,0.177995f,0.178089f,0.178184f,0.178278f,0.178372f,0.178467f,0.178561f,0.178655f,0.17875f,0.178844f,0.178938f,0.179033f,0.179127f,0.179221f,0.179316f,0.17941f,0.179504f,0.179599f,0.179693f,0.179787f,0.179881f,0.179976f,0.18007f,0.180164f,0.180259f,0.180353f,0.180447f,0.180542f,0.180636f,0.18073f,0.180824f,0.180919f,0.181013f,0.181107f,0.181202f,0.181296f,0.18139f,0.181484f,0.181579f,0.181673f,0.181767f,0.181862f,0.181956f,0.18205f,0.182144f,0.182239f,0.182333f,0.182427f,0.182521f,0.182616f,0.18271f,0.182804f,0.182899f,0.182993f,0.183087f,0.183181f,0.183276f,0.18337f,0.183464f,0.183558f,0.183653f,0.183747f,0.183841f,0.183935f,0.184029f,0.184124f,0.184218f,0.184312f,0.184406f,0.184501f,0.184595f,0.184689f,0.184783f,0.184878f,0.184972f,0.185066f,0.18516f,0.185254f,0.185349f,0.185443f,0.185537f,0.185631f,0.185725f,0.18582f,0.185914f,0.186008f,0.186102f,0.186196f,0.186291f,0.186385f,0.186479f,0.186573f,0.186667f,0.186762f,0.186856f,0.18695f,0.187044f,0.187138f,0.187233f,0.187327f,0.187421f,0.187515f,0.187609f,0.187703f,0.187798f,0.187892f,0.187986f,0.18808f,0.188174f,0.188268f,0.188363f,0.188457f,0.188551f,0.188645f,0.188739f,0.188833f,0.188927f,0.189022f,0.189116f,0.18921f,0.189304f,0.189398f,0.189492f,0.189586f,0.189681f,0.189775f,0.189869f,0.189963f,0.190057f,0.190151f,0.190245f,0.190339f,0.190434f,0.190528f,0.190622f,0.190716f,0.19081f,0.190904f,0.190998f,0.191092f,0.191186f,0.191281f,0.191375f,0.191469f,0.191563f,0.191657f,0.191751f,0.191845f,0.191939f,0.192033f,0.192127f,0.192222f,0.192316f,0.19241f,0.192504f,0.192598f,0.192692f,0.192786f,0.19288f,0.192974f,0.193068f,0.193162f,0.193256f,0.19335f,0.193444f,0.193539f,0.193633f,0.193727f,0.193821f,0.193915f,0.194009f,0.194103f,0.194197f,0.194291f,0.194385f,0.194479f,0.194573f,0.194667f,0.194761f,0.194855f,0.194949f,0.195043f,0.195137f,0.195231f,0.195325f,0.195419f,0.195513f,0.195607f,0.195701f,0.195796f,0.19589f,0.195984f,0.196078f,0.196172f,0.196266f,0.19636f,0.196454f,0.196548f,0.196642f,0.196736f,0.19683f,0.196924f,0.197018f,0.197112f,0.197206f,0.1973f,0.197394f,0.197488f,0.197582f,0.197676f,0.197769f,0.197863f,0.197957f,0.198051f,0.198145f,0.198239f,0.198333f,0.198427f,0.198521f,0.198615f,0.198709f,0.198803f,0.198897f,0.198991f,0.199085f,0.199179f,0.199273f,0.199367f,0.199461f,0.199555f,0.199649f,0.199743f,0.199837f,0.199931f,0.200025f,0.200118f,0.200212f,0.200306f,0.2004f,0.200494f,0.200588f,0.200682f,0.200776f,0.20087f,0.200964f,0.201058f,0.201152f,0.201246f,0.201339f,0.201433f,0.201527f,0.201621f,0.201715f,0.201809f,0.201903f,0.201997f,0.202091f,0.202185f,0.202278f,0.202372f,0.202466f,0.20256f,0.202654f,0.202748f,0.202842f,0.202936f,0.203029f,0.203123f,0.203217f,0.203311f,0.203405f,0.203499f,0.203593f,0.203687f,0.20378f,0.203874f,0.203968f,0.204062f,0.204156f,0.20425f,0.204344f,0.204437f,0.204531f,0.204625f,0.204719f,0.204813f,0.204907f,0.205001f,0.205094f,0.205188f,0.205282f,0.205376f,0.20547f,0.205564f,0.205657f,0.205751f,0.205845f,0.205939f,0.206033f,0.206126f,0.20622f,0.206314f,0.206408f,0.206502f,0.206595f,0.206689f,0.206783f,0.206877f,0.206971f,0.207064f,0.207158f,0.207252f,0.207346f,0.20744f,0.207533f,0.207627f,0.207721f,0.207815f,0.207909f,0.208002f,0.208096f,0.20819f,0.208284f,0.208377f,0.208471f,0.208565f,0.208659f,0.208752f,0.208846f,0.20894f,0.209034f,0.209128f,0.209221f,0.209315f,0.209409f,0.209503f,0.209596f,0.20969f,0.209784f,0.209878f,0.209971f,0.210065f,0.210159f,0.210252f,0.210346f,0.21044f,0.210534f,0.210627f,0.210721f,0.210815f,0.210909f,0.211002f,0.211096f,0.21119f,0.211283f,0.211377f,0.211471f,0.211564f,0.211658f,0.211752f,0.211846f,0.211939f,0.212033f,0.212127f,0.21222f,0.212314f,0.212408f,0.212501f,0.212595f,0.212689f,0.212782f,0.212876f,0.21297f,0.213063f,0.213157f,0.213251f,0.213344f,0.213438f,0.213532f,0.213625f,0.213719f,0.213813f,0.213906f,0.214f,0.214094f,0.214187f,0.214281f,0.214375f,0.214468f,0.214562f,0.214656f,0.214749f,0.214843f,0.214937f,0.21503f,0.215124f,0.215217f,0.215311f,0.215405f,0.215498f,0.215592f,0.215686f,0.215779f,0.215873f,0.215966f,0.21606f,0.216154f,0.216247f,0.216341f,0.216434f,0.216528f,0.216622f,0.216715f,0.216809f,0.216902f,0.216996f,0.21709f,0.217183f,0.217277f,0.21737f,0.217464f,0.217557f,0.217651f,0.217745f,0.217838f,0.217932f,0.218025f,0.218119f,0.218212f,0.218306f,0.2184f,0.218493f,0.218587f,0.21868f,0.218774f,0.218867f,0.218961f,0.219054f,0.219148f,0.219242f,0.219335f,0.219429f,0.219522f,0.219616f,0.219709f,0.219803f,0.219896f,0.21999f,0.220083f,0.220177f,0.22027f,0.220364f,0.220457f,0.220551f,0.220644f,0.220738f,0.220831f,0.220925f,0.221018f,0.221112f,0.221205f,0.221299f,0.221392f,0.221486f,0.221579f,0.221673f,0.221766f,0.22186f,0.221953f,0.222047f,0.22214f,0.222234f,0.222327f,0.222421f,0.222514f,0.222608f,0.222701f,0.222795f,0.222888f,0.222982f,0.223075f,0.223169f,0.223262f,0.223355f,0.223449f,0.223542f,0.223636f,0.223729f,0.223823f,0.223916f,0.22401f,0.224103f,0.224196f,0.22429f,0.224383f,0.224477f,0.22457f,0.224664f,0.224757f,0.22485f,0.224944f,0.225037f,0.225131f,0.225224f,0.225317f,0.225411f,0.225504f,0.225598f,0.225691f,0.225784f,0.225878f,0.225971f,0.226065f,0.226158f,0.226251f,0.226345f,0.226438f,0.226532f,0.226625f,0.226718f,0.226812f,0.226905f,0.226998f,0.227092f,0.227185f,0.227279f,0.227372f,0.227465f,0.227559f,0.227652f,0.227745f,0.227839f,0.227932f,0.228025f,0.228119f,0.228212f,0.228305f,0.228399f,0.228492f,0.228585f,0.228679f,0.228772f,0.228865f,0.228959f,0.229052f,0.229145f,0.229239f,0.229332f,0.229425f,0.229519f,0.229612f,0.229705f,0.229799f,0.229892f,0.229985f,0.230079f,0.230172f,0.230265f,0.230358f,0.230452f,0.230545f,0.230638f,0.230732f,0.230825f,0.230918f,0.231011f,0.231105f,0.231198f,0.231291f,0.231385f,0.231478f,0.231571f,0.231664f,0.231758f,0.231851f,0.231944f,0.232037f,0.232131f,0.232224f,0.232317f,0.23241f,0.232504f,0.232597f,0.23269f,0.232783f,0.232877f,0.23297f,0.233063f,0.233156f,0.23325f,0.233343f,0.233436f,0.233529f,0.233623f,0.233716f,0.233809f,0.233902f,0.233995f,0.234089f,0.234182f,0.234275f,0.234368f,0.234461f,0.234555f,0.234648f,0.234741f,0.234834f,0.234927f,0.235021f,0.235114f,0.235207f,0.2353f,0.235393f,0.235486f,0.23558f,0.235673f,0.235766f,0.235859f,0.235952f,0.236046f,0.236139f,0.236232f,0.236325f,0.236418f,0.236511f,0.236604f,0.236698f,0.236791f,0.236884f,0.236977f,0.23707f,0.237163f,0.237256f,0.23735f,0.237443f,0.237536f,0.237629f,0.237722f,0.237815f,0.237908f,0.238001f,0.238095f,0.238188f,0.238281f,0.238374f,0.238467f,0.23856f,0.238653f,0.238746f,0.238839f,0.238933f,0.239026f,0.239119f,0.239212f,0.239305f,0.239398f,0.239491f,0.239584f,0.239677f,0.23977f,0.239863f,0.239956f,0.24005f,0.240143f,0.240236f,0.240329f,0.240422f,0.240515f,0.240608f,0.240701f,0.240794f,0.240887f,0.24098f,0.241073f,0.241166f,0.241259f,0.241352f,0.241445f,0.241538f,0.241631f,0.241724f,0.241818f,0.241911f,0.242004f,0.242097f,0.24219f,0.242283f,0.242376f,0.242469f,0.242562f,0.242655f,0.242748f,0.242841f,0.242934f,0.243027f,0.24312f,0.243213f,0.243306f,0.243399f,0.243492f,0.243585f,0.243678f,0.243771f,0.243864f,0.243957f,0.24405f,0.244143f,0.244236f,0.244328f,0.244421f,0.244514f,0.244607f,0.2447f,0.244793f,0.244886f,0.244979f,0.245072f,0.245165f,0.245258f,0.245351f,0.245444f,0.245537f,0.24563f,0.245723f,0.245816f,0.245909f,0.246002f,0.246094f,0.246187f,0.24628f,0.246373f,0.246466f,0.246559f,0.246652f,0.246745f,0.246838f,0.246931f,0.247024f,0.247116f,0.247209f,0.247302f,0.247395f,0.247488f,0.247581f,0.247674f,0.247767f,0.24786f,0.247953f,0.248045f,0.248138f,0.248231f,0.248324f,0.248417f,0.24851f,0.248603f,0.248695f,0.248788f,0.248881f,0.248974f,0.249067f,0.24916f,0.249253f,0.249345f,0.249438f,0.249531f,0.249624f,0.249717f,0.24981f,0.249902f,0.249995f,0.250088f,0.250181f,0.250274f,0.250367f,0.250459f,0.250552f,0.250645f,0.250738f,0.250831f,0.250923f,0.251016f,0.251109f,0.251202f,0.251295f,0.251388f,0.25148f,0.251573f,0.251666f,0.251759f,0.251851f,0.251944f,0.252037f,0.25213f,0.252223f,0.252315f,0.252408f,0.252501f,0.252594f,0.252686f,0.252779f,0.252872f,0.252965f,0.253057f,0.25315f,0.253243f,0.253336f,0.253428f,0.253521f,0.253614f,0.253707f,0.253799f,0.253892f,0.253985f,0.254078f,0.25417f,0.254263f,0.254356f,0.254448f,0.254541f,0.254634f,0.254727f,0.254819f,0.254912f,0.255005f,0.255097f,0.25519f,0.255283f,0.255376f,0.255468f,0.255561f,0.255654f,0.255746f,0.255839f,0.255932f,0.256024f,0.256117f,0.25621f,0.256302f,0.256395f,0.256488f,0.25658f,0.256673f,0.256766f,0.256858f,0.256951f,0.257044f,0.257136f,0.257229f,0.257322f,0.257414f,0.257507f,0.2576f,0.257692f,0.257785f,0.257877f,0.25797f,0.258063f,0.258155f,0.258248f,0.258341f,0.258433f,0.258526f,0.258618f,0.258711f,0.258804f,0.258896f,0.258989f,0.259081f,0.259174f,0.259267f,0.259359f,0.259452f,0.259544f,0.259637f,0.25973f,0.259822f,0.259915f,0.260007f,0.2601f,0.260192f,0.260285f,0.260378f,0.26047f,0.260563f,0.260655f,0.260748f,0.26084f,0.260933f,0.261026f,0.261118f,0.261211f,0.261303f,0.261396f,0.261488f,0.261581f,0.261673f,0.261766f,0.261858f,0.261951f,0.262043f,0.262136f,0.262228f,0.262321f,0.262413f,0.262506f,0.262598f,0.262691f,0.262783f,0.262876f,0.262969f,0.263061f,0.263154f,0.263246f,0.263339f,0.263431f,0.263523f,0.263616f,0.263708f,0.263801f,0.263893f,0.263986f,0.264078f,0.264171f,0.264263f,0.264356f,0.264448f,0.264541f,0.264633f,0.264726f,0.264818f,0.26491f,0.265003f,0.265095f,0.265188f,0.26528f,0.265373f,0.265465f,0.265558f,0.26565f,0.265742f,0.265835f,0.265927f,0.26602f,0.266112f,0.266205f,0.266297f,0.266389f,0.266482f,0.266574f,0.266667f,0.266759f,0.266851f,0.266944f,0.267036f,0.267129f,0.267221f,0.267313f,0.267406f,0.267498f,0.26759f,0.267683f,0.267775f,0.267868f,0.26796f,0.268052f,0.268145f,0.268237f,0.268329f,0.268422f,0.268514f,0.268606f,0.268699f,0.268791f,0.268883f,0.268976f,0.269068f,0.269161f,0.269253f,0.269345f,0.269438f,0.26953f,0.269622f,0.269715f,0.269807f,0.269899f,0.269991f,0.270084f,0.270176f,0.270268f,0.270361f,0.270453f,0.270545f,0.270638f,0.27073f,0.270822f,0.270914f,0.271007f,0.271099f,0.271191f,0.271284f,0.271376f,0.271468f,0.27156f,0.271653f,0.271745f,0.271837f,0.27193f,0.272022f,0.272114f,0.272206f,0.272299f,0.272391f,0.272483f,0.272575f,0.272667f,0.27276f,0.272852f,0.272944f,0.273036f,0.273129f,0.273221f,0.273313f,0.273405f,0.273498f,0.27359f,0.273682f,0.273774f,0.273866f,0.273959f,0.274051f,0.274143f,0.274235f,0.274327f,0.27442f,0.274512f,0.274604f,0.274696f,0.274788f,0.274881f,0.274973f,0.275065f,0.275157f,0.275249f,0.275341f,0.275434f,0.275526f,0.275618f,0.27571f,0.275802f,0.275894f,0.275987f,0.276079f,0.276171f,0.276263f,0.276355f,0.276447f,0.276539f,0.276632f,0.276724f,0.276816f,0.276908f,0.277f,0.277092f,0.277184f,0.277276f,0.277368f,0.277461f,0.277553f,0.277645f,0.277737f,0.277829f,0.277921f,0.278013f,0.278105f,0.278197f,0.278289f,0.278382f,0.278474f,0.278566f,0.278658f,0.27875f,0.278842f,0.278934f,0.279026f,0.279118f,0.27921f,0.279302f,0.279394f,0.279486f,0.279578f,0.279671f,0.279763f,0.279855f,0.279947f,0.280039f,0.280131f,0.280223f,0.280315f,0.280407f,0.280499f,0.280591f,0.280683f,0.280775f,0.280867f,0.280959f,0.281051f,0.281143f,0.281235f,0.281327f,0.281419f,0.281511f,0.281603f,0.281695f,0.281787f,0.281879f,0.281971f,0.282063f,0.282155f,0.282247f,0.282339f,0.282431f,0.282523f,0.282615f,0.282707f,0.282799f,0.282891f,0.282983f,0.283074f,0.283166f,0.283258f,0.28335f,0.283442f,0.283534f,0.283626f,0.283718f,0.28381f,0.283902f,0.283994f,0.284086f,0.284178f,0.28427f,0.284362f,0.284453f,0.284545f,0.284637f,0.284729f,0.284821f,0.284913f,0.285005f,0.285097f,0.285189f,0.285281f,0.285372f,0.285464f,0.285556f,0.285648f,0.28574f,0.285832f,0.285924f,0.286016f,0.286108f,0.286199f,0.286291f,0.286383f,0.286475f,0.286567f,0.286659f,0.286751f,0.286842f,0.286934f,0.287026f,0.287118f,0.28721f,0.287302f,0.287393f,0.287485f,0.287577f,0.287669f,0.287761f,0.287852f,0.287944f,0.288036f,0.288128f,0.28822f,0.288312f,0.288403f,0.288495f,0.288587f,0.288679f,0.288771f,0.288862f,0.288954f,0.289046f,0.289138f,0.289229f,0.289321f,0.289413f,0.289505f,0.289597f,0.289688f,0.28978f,0.289872f,0.289964f,0.290055f,0.290147f,0.290239f,0.290331f,0.290422f,0.290514f,0.290606f,0.290698f,0.290789f,0.290881f,0.290973f,0.291064f,0.291156f,0.291248f,0.29134f,0.291431f,0.291523f,0.291615f,0.291706f,0.291798f,0.29189f,0.291982f,0.292073f,0.292165f,0.292257f,0.292348f,0.29244f,0.292532f,0.292623f,0.292715f,0.292807f,0.292898f,0.29299f,0.293082f,0.293173f,0.293265f,0.293357f,0.293448f,0.29354f,0.293632f,0.293723f,0.293815f,0.293907f,0.293998f,0.29409f,0.294181f,0.294273f,0.294365f,0.294456f,0.294548f,0.29464f,0.294731f,0.294823f,0.294914f,0.295006f,0.295098f,0.295189f,0.295281f,0.295372f,0.295464f,0.295556f,0.295647f,0.295739f,0.29583f,0.295922f,0.296014f,0.296105f,0.296197f,0.296288f,0.29638f,0.296471f,0.296563f,0.296654f,0.296746f,0.296838f,0.296929f,0.297021f,0.297112f,0.297204f,0.297295f,0.297387f,0.297478f,0.29757f,0.297661f,0.297753f,0.297845f,0.297936f,0.298028f,0.298119f,0.298211f,0.298302f,0.298394f,0.298485f,0.298577f,0.298668f,0.29876f,0.298851f,0.298943f,0.299034f,0.299126f,0.299217f,0.299309f,0.2994f,0.299491f,0.299583f,0.299674f,0.299766f,0.299857f,0.299949f,0.30004f,0.300132f,0.300223f,0.300315f,0.300406f,0.300498f,0.300589f,0.30068f,0.300772f,0.300863f,0.300955f,0.301046f,0.301138f,0.301229f,0.30132f,0.301412f,0.301503f,0.301595f,0.301686f,0.301777f,0.301869f,0.30196f,0.302052f,0.302143f,0.302234f,0.302326f,0.302417f,0.302509f,0.3026f,0.302691f,0.302783f,0.302874f,0.302965f,0.303057f,0.303148f,0.30324f,0.303331f,0.303422f,0.303514f,0.303605f,0.303696f,0.303788f,0.303879f,0.30397f,0.304062f,0.304153f,0.304244f,0.304336f,0.304427f,0.304518f,0.30461f,0.304701f,0.304792f,0.304884f,0.304975f,0.305066f,0.305157f,0.305249f,0.30534f,0.305431f,0.305523f,0.305614f,0.305705f,0.305797f,0.305888f,0.305979f,0.30607f,0.306162f,0.306253f,0.306344f,0.306435f,0.306527f,0.306618f,0.306709f,0.3068f,0.306892f,0.306983f,0.307074f,0.307165f,0.307257f,0.307348f,0.307439f,0.30753f,0.307622f,0.307713f,0.307804f,0.307895f,0.307986f,0.308078f,0.308169f,0.30826f,0.308351f,0.308443f,0.308534f,0.308625f,0.308716f,0.308807f,0.308898f,0.30899f,0.309081f,0.309172f,0.309263f,0.309354f,0.309446f,0.309537f,0.309628f,0.309719f,0.30981f,0.309901f,0.309992f,0.310084f,0.310175f,0.310266f,0.310357f,0.310448f,0.310539f,0.31063f,0.310722f,0.310813f,0.310904f,0.310995f,0.311086f,0.311177f,0.311268f,0.311359f,0.311451f,0.311542f,0.311633f,0.311724f,0.311815f,0.311906f,0.311997f,0.312088f,0.312179f,0.31227f,0.312361f,0.312453f,0.312544f,0.312635f,0.312726f,0.312817f,0.312908f,0.312999f,0.31309f,0.313181f,0.313272f,0.313363f,0.313454f,0.313545f,0.313636f,0.313727f,0.313818f,0.313909f,0.314f,0.314091f,0.314182f,0.314273f,0.314364f,0.314455f,0.314546f,0.314637f,0.314728f,0.314819f,0.31491f,0.315001f,0.315092f,0.315183f,0.315274f,0.315365f,0.315456f,0.315547f,0.315638f,0.315729f,0.31582f,0.315911f,0.316002f,0.316093f,0.316184f,0.316275f,0.316366f,0.316457f,0.316548f,0.316639f,0.31673f,0.316821f,0.316912f,0.317003f,0.317094f,0.317184f,0.317275f,0.317366f,0.317457f,0.317548f,0.317639f,0.31773f,0.317821f,0.317912f,0.318003f,0.318094f,0.318184f,0.318275f,0.318366f,0.318457f,0.318548f,0.318639f,0.31873f,0.318821f,0.318911f,0.319002f,0.319093f,0.319184f,0.319275f,0.319366f,0.319457f,0.319547f,0.319638f,0.319729f,0.31982f,0.319911f,0.320002f,0.320092f,0.320183f,0.320274f,0.320365f,0.320456f,0.320547f,0.320637f,0.320728f,0.320819f,0.32091f,0.321001f,0.321091f,0.321182f,0.321273f,0.321364f,0.321455f,0.321545f,0.321636f,0.321727f,0.321818f,0.321909f,0.321999f,0.32209f,0.322181f,0.322272f,0.322362f,0.322453f,0.322544f,0.322635f,0.322725f,0.322816f,0.322907f,0.322998f,0.323088f,0.323179f,0.32327f,0.32336f,0.323451f,0.323542f,0.323633f,0.323723f,0.323814f,0.323905f,0.323995f,0.324086f,0.324177f,0.324268f,0.324358f,0.324449f,0.32454f,0.32463f,0.324721f,0.324812f,0.324902f,0.324993f,0.325084f,0.325174f,0.325265f,0.325356f,0.325446f,0.325537f,0.325628f,0.325718f,0.325809f,0.3259f,0.32599f,0.326081f,0.326171f,0.326262f,0.326353f,0.326443f,0.326534f,0.326625f,0.326715f,0.326806f,0.326896f,0.326987f,0.327078f,0.327168f,0.327259f,0.327349f,0.32744f,0.327531f,0.327621f,0.327712f,0.327802f,0.327893f,0.327983f,0.328074f,0.328165f,0.328255f,0.328346f,0.328436f,0.328527f,0.328617f,0.328708f,0.328798f,0.328889f,0.32898f,0.32907f,0.329161f,0.329251f,0.329342f,0.329432f,0.329523f,0.329613f,0.329704f,0.329794f,0.329885f,0.329975f,0.330066f,0.330156f,0.330247f,0.330337f,0.330428f,0.330518f,0.330609f,0.330699f,0.33079f,0.33088f,0.330971f,0.331061f,0.331152f,0.331242f,0.331332f,0.331423f,0.331513f,0.331604f,0.331694f,0.331785f,0.331875f,0.331966f,0.332056f,0.332146f,0.332237f,0.332327f,0.332418f,0.332508f,0.332599f,0.332689f,0.332779f,0.33287f,0.33296f,0.333051f,0.333141f,0.333231f,0.333322f,0.333412f,0.333503f,0.333593f,0.333683f,0.333774f,0.333864f,0.333954f,0.334045f,0.334135f,0.334226f,0.334316f,0.334406f,0.334497f,0.334587f,0.334677f,0.334768f,0.334858f,0.334948f,0.335039f,0.335129f,0.335219f,0.33531f,0.3354f,0.33549f,0.335581f,0.335671f,0.335761f,0.335852f,0.335942f,0.336032f,0.336122f,0.336213f,0.336303f,0.336393f,0.336484f,0.336574f,0.336664f,0.336754f,0.336845f,0.336935f,0.337025f,0.337116f,0.337206f,0.337296f,0.337386f,0.337477f,0.337567f,0.337657f,0.337747f,0.337838f,0.337928f,0.338018f,0.338108f,0.338198f,0.338289f,0.338379f,0.338469f,0.338559f,0.33865f,0.33874f,0.33883f,0.33892f,0.33901f,0.339101f,0.339191f,0.339281f,0.339371f,0.339461f,0.339551f,0.339642f,0.339732f,0.339822f,0.339912f,0.340002f,0.340092f,0.340183f,0.340273f,0.340363f,0.340453f,0.340543f,0.340633f,0.340724f,0.340814f,0.340904f,0.340994f,0.341084f,0.341174f,0.341264f,0.341354f,0.341445f,0.341535f,0.341625f,0.341715f,0.341805f,0.341895f,0.341985f,0.342075f,0.342165f,0.342255f,0.342345f,0.342436f,0.342526f,0.342616f,0.342706f,0.342796f,0.342886f,0.342976f,0.343066f,0.343156f,0.343246f,0.343336f,0.343426f,0.343516f,0.343606f,0.343696f,0.343786f,0.343876f,0.343966f,0.344056f,0.344146f,0.344236f,0.344326f,0.344416f,0.344506f,0.344596f,0.344686f,0.344776f,0.344866f,0.344956f,0.345046f,0.345136f,0.345226f,0.345316f,0.345406f,0.345496f,0.345586f,0.345676f,0.345766f,0.345856f,0.345946f,0.346036f,0.346126f,0.346216f,0.346306f,0.346396f,0.346486f,0.346576f,0.346666f,0.346756f,0.346846f,0.346935f,0.347025f,0.347115f,0.347205f,0.347295f,0.347385f,0.347475f,0.347565f,0.347655f,0.347745f,0.347834f,0.347924f,0.348014f,0.348104f,0.348194f,0.348284f,0.348374f,0.348464f,0.348553f,0.348643f,0.348733f,0.348823f,0.348913f,0.349003f,0.349093f,0.349182f,0.349272f,0.349362f,0.349452f,0.349542f,0.349632f,0.349721f,0.349811f,0.349901f,0.349991f,0.350081f,0.35017f,0.35026f,0.35035f,0.35044f,0.35053f,0.350619f,0.350709f,0.350799f,0.350889f,0.350979f,0.351068f,0.351158f,0.351248f,0.351338f,0.351427f,0.351517f,0.351607f,0.351697f,0.351786f,0.351876f,0.351966f,0.352056f,0.352145f,0.352235f,0.352325f,0.352415f,0.352504f,0.352594f,0.352684f,0.352773f,0.352863f,0.352953f,0.353043f,0.353132f,0.353222f,0.353312f,0.353401f,0.353491f,0.353581f,0.35367f,0.35376f,0.35385f,0.353939f,0.354029f,0.354119f,0.354208f,0.354298f,0.354388f,0.354477f,0.354567f,0.354657f,0.354746f,0.354836f,0.354926f,0.355015f,0.355105f,0.355194f,0.355284f,0.355374f,0.355463f,0.355553f,0.355642f,0.355732f,0.355822f,0.355911f,0.356001f,0.35609f,0.35618f,0.35627f,0.356359f,0.356449f,0.356538f,0.356628f,0.356717f,0.356807f,0.356897f,0.356986f,0.357076f,0.357165f,0.357255f,0.357344f,0.357434f,0.357523f,0.357613f,0.357703f,0.357792f,0.357882f,0.357971f,0.358061f,0.35815f,0.35824f,0.358329f,0.358419f,0.358508f,0.358598f,0.358687f,0.358777f,0.358866f,0.358956f,0.359045f,0.359135f,0.359224f,0.359314f,0.359403f,0.359492f,0.359582f,0.359671f,0.359761f,0.35985f,0.35994f,0.360029f,0.360119f,0.360208f,0.360298f,0.360387f,0.360476f,0.360566f,0.360655f,0.360745f,0.360834f,0.360923f,0.361013f,0.361102f,0.361192f,0.361281f,0.361371f,0.36146f,0.361549f,0.361639f,0.361728f,0.361817f,0.361907f,0.361996f,0.362086f,0.362175f,0.362264f,0.362354f,0.362443f,0.362532f,0.362622f,0.362711f,0.3628f,0.36289f,0.362979f,0.363068f,0.363158f,0.363247f,0.363336f,0.363426f,0.363515f,0.363604f,0.363694f,0.363783f,0.363872f,0.363962f,0.364051f,0.36414f,0.364229f,0.364319f,0.364408f,0.364497f,0.364587f,0.364676f,0.364765f,0.364854f,0.364944f,0.365033f,0.365122f,0.365211f,0.365301f,0.36539f,0.365479f,0.365568f,0.365658f,0.365747f,0.365836f,0.365925f,0.366015f,0.366104f,0.366193f,0.366282f,0.366371f,0.366461f,0.36655f,0.366639f,0.366728f,0.366817f,0.366907f,0.366996f,0.367085f,0.367174f,0.367263f,0.367352f,0.367442f,0.367531f,0.36762f,0.367709f,0.367798f,0.367887f,0.367977f,0.368066f,0.368155f,0.368244f,0.368333f,0.368422f,0.368511f,0.368601f,0.36869f,0.368779f,0.368868f,0.368957f,0.369046f,0.369135f,0.369224f,0.369313f,0.369402f,0.369492f,0.369581f,0.36967f,0.369759f,0.369848f,0.369937f,0.370026f,0.370115f,0.370204f,0.370293f,0.370382f,0.370471f,0.37056f,0.370649f,0.370739f,0.370828f,0.370917f,0.371006f,0.371095f,0.371184f,0.371273f,0.371362f,0.371451f,0.37154f,0.371629f,0.371718f,0.371807f,0.371896f,0.371985f,0.372074f,0.372163f,0.372252f,0.372341f,0.37243f,0.372519f,0.372608f,0.372697f,0.372786f,0.372874f,0.372963f,0.373052f,0.373141f,0.37323f,0.373319f,0.373408f,0.373497f,0.373586f,0.373675f,0.373764f,0.373853f,0.373942f,0.374031f,0.37412f,0.374209f,0.374297f,0.374386f,0.374475f,0.374564f,0.374653f,0.374742f,0.374831f,0.37492f,0.375009f,0.375097f,0.375186f,0.375275f,0.375364f,0.375453f,0.375542f,0.375631f,0.375719f,0.375808f,0.375897f,0.375986f,0.376075f,0.376164f,0.376253f,0.376341f,0.37643f,0.376519f,0.376608f,0.376697f,0.376785f,0.376874f,0.376963f,0.377052f,0.377141f,0.377229f,0.377318f,0.377407f,0.377496f,0.377585f,0.377673f,0.377762f,0.377851f,0.37794f,0.378028f,0.378117f,0.378206f,0.378295f,0.378383f,0.378472f,0.378561f,0.37865f,0.378738f,0.378827f,0.378916f,0.379005f,0.379093f,0.379182f,0.379271f,0.379359f,0.379448f,0.379537f,0.379625f,0.379714f,0.379803f,0.379892f,0.37998f,0.380069f,0.380158f,0.380246f,0.380335f,0.380424f,0.380512f,0.380601f,0.38069f,0.380778f,0.380867f,0.380956f,0.381044f,0.381133f,0.381221f,0.38131f,0.381399f,0.381487f,0.381576f,0.381665f,0.381753f,0.381842f,0.38193f,0.382019f,0.382108f,0.382196f,0.382285f,0.382373f,0.382462f,0.382551f,0.382639f,0.382728f,0.382816f,0.382905f,0.382993f,0.383082f,0.383171f,0.383259f,0.383348f,0.383436f,0.383525f,0.383613f,0.383702f,0.38379f,0.383879f,0.383967f,0.384056f,0.384144f,0.384233f,0.384321f,0.38441f,0.384499f,0.384587f,0.384676f,0.384764f,0.384852f,0.384941f,0.385029f,0.385118f,0.385206f,0.385295f,0.385383f,0.385472f,0.38556f,0.385649f,0.385737f,0.385826f,0.385914f,0.386003f,0.386091f,0.386179f,0.386268f,0.386356f,0.386445f,0.386533f,0.386622f,0.38671f,0.386798f,0.386887f,0.386975f,0.387064f,0.387152f,0.38724f,0.387329f,0.387417f,0.387506f,0.387594f,0.387682f,0.387771f,0.387859f,0.387947f,0.388036f,0.388124f,0.388213f,0.388301f,0.388389f,0.388478f,0.388566f,0.388654f,0.388743f,0.388831f,0.388919f,0.389008f,0.389096f,0.389184f,0.389273f,0.389361f,0.389449f,0.389537f,0.389626f,0.389714f,0.389802f,0.389891f,0.389979f,0.390067f,0.390155f,0.390244f,0.390332f,0.39042f,0.390509f,0.390597f,0.390685f,0.390773f,0.390862f,0.39095f,0.391038f,0.391126f,0.391215f,0.391303f,0.391391f,0.391479f,0.391567f,0.391656f,0.391744f,0.391832f,0.39192f,0.392008f,0.392097f,0.392185f,0.392273f,0.392361f,0.392449f,0.392538f,0.392626f,0.392714f,0.392802f,0.39289f,0.392978f,0.393067f,0.393155f,0.393243f,0.393331f,0.393419f,0.393507f,0.393595f,0.393684f,0.393772f,0.39386f,0.393948f,0.394036f,0.394124f,0.394212f,0.3943f,0.394389f,0.394477f,0.394565f,0.394653f,0.394741f,0.394829f,0.394917f,0.395005f,0.395093f,0.395181f,0.395269f,0.395357f,0.395446f,0.395534f,0.395622f,0.39571f,0.395798f,0.395886f,0.395974f,0.396062f,0.39615f,0.396238f,0.396326f,0.396414f,0.396502f,0.39659f,0.396678f,0.396766f,0.396854f,0.396942f,0.39703f,0.397118f,0.397206f,0.397294f,0.397382f,0.39747f,0.397558f,0.397646f,0.397734f,0.397822f,0.39791f,0.397998f,0.398086f,0.398174f,0.398262f,0.398349f,0.398437f,0.398525f,0.398613f,0.398701f,0.398789f,0.398877f,0.398965f,0.399053f,0.399141f,0.399229f,0.399317f,0.399404f,0.399492f,0.39958f,0.399668f,0.399756f,0.399844f,0.399932f,0.40002f,0.400108f,0.400195f,0.400283f,0.400371f,0.400459f,0.400547f,0.400635f,0.400723f,0.40081f,0.400898f,0.400986f,0.401074f,0.401162f,0.401249f,0.401337f,0.401425f,0.401513f,0.401601f,0.401689f,0.401776f,0.401864f,0.401952f,0.40204f,0.402127f,0.402215f,0.402303f,0.402391f,0.402479f,0.402566f,0.402654f,0.402742f,0.40283f,0.402917f,0.403005f,0.403093f,0.403181f,0.403268f,0.403356f,0.403444f,0.403531f,0.403619f,0.403707f,0.403795f,0.403882f,0.40397f,0.404058f,0.404145f,0.404233f,0.404321f,0.404408f,0.404496f,0.404584f,0.404672f,0.404759f,0.404847f,0.404935f,0.405022f,0.40511f,0.405198f,0.405285f,0.405373f,0.40546f,0.405548f,0.405636f,0.405723f,0.405811f,0.405899f,0.405986f,0.406074f,0.406161f,0.406249f,0.406337f,0.406424f,0.406512f,0.406599f,0.406687f,0.406775f,0.406862f,0.40695f,0.407037f,0.407125f,0.407212f,0.4073f,0.407388f,0.407475f,0.407563f,0.40765f,0.407738f,0.407825f,0.407913f,0.408f,0.408088f,0.408175f,0.408263f,0.40835f,0.408438f,0.408526f,0.408613f,0.408701f,0.408788f,0.408876f,0.408963f,0.409051f,0.409138f,0.409225f,0.409313f,0.4094f,0.409488f,0.409575f,0.409663f,0.40975f,0.409838f,0.409925f,0.410013f,0.4101f,0.410188f,0.410275f,0.410362f,0.41045f,0.410537f,0.410625f,0.410712f,0.410799f,0.410887f,0.410974f,0.411062f,0.411149f,0.411236f,0.411324f,0.411411f,0.411499f,0.411586f,0.411673f,0.411761f,0.411848f,0.411935f,0.412023f,0.41211f,0.412198f,0.412285f,0.412372f,0.41246f,0.412547f,0.412634f,0.412722f,0.412809f,0.412896f,0.412984f,0.413071f,0.413158f,0.413245f,0.413333f,0.41342f,0.413507f,0.413595f,0.413682f,0.413769f,0.413857f,0.413944f,0.414031f,0.414118f,0.414206f,0.414293f,0.41438f,0.414467f,0.414555f,0.414642f,0.414729f,0.414816f,0.414904f,0.414991f,0.415078f,0.415165f,0.415252f,0.41534f,0.415427f,0.415514f,0.415601f,0.415689f,0.415776f,0.415863f,0.41595f,0.416037f,0.416124f,0.416212f,0.416299f,0.416386f,0.416473f,0.41656f,0.416647f,0.416735f,0.416822f,0.416909f,0.416996f,0.417083f,0.41717f,0.417257f,0.417345f,0.417432f,0.417519f,0.417606f,0.417693f,0.41778f,0.417867f,0.417954f,0.418041f,0.418129f,0.418216f,0.418303f,0.41839f,0.418477f,0.418564f,0.418651f,0.418738f,0.418825f,0.418912f,0.418999f,0.419086f,0.419173f,0.41926f,0.419347f,0.419434f,0.419522f,0.419609f,0.419696f,0.419783f,0.41987f,0.419957f,0.420044f,0.420131f,0.420218f,0.420305f,0.420392f,0.420479f,0.420566f,0.420653f,0.42074f,0.420827f,0.420914f,0.421f,0.421087f,0.421174f,0.421261f,0.421348f,0.421435f,0.421522f,0.421609f,0.421696f,0.421783f,0.42187f,0.421957f,0.422044f,0.422131f,0.422218f,0.422304f,0.422391f,0.422478f,0.422565f,0.422652f,0.422739f,0.422826f,0.422913f,0.423f,0.423086f,0.423173f,0.42326f,0.423347f,0.423434f,0.423521f,0.423608f,0.423694f,0.423781f,0.423868f,0.423955f,0.424042f,0.424129f,0.424215f,0.424302f,0.424389f,0.424476f,0.424563f,0.424649f,0.424736f,0.424823f,0.42491f,0.424997f,0.425083f,0.42517f,0.425257f,0.425344f,0.425431f,0.425517f,0.425604f,0.425691f,0.425778f,0.425864f,0.425951f,0.426038f,0.426125f,0.426211f,0.426298f,0.426385f,0.426471f,0.426558f,0.426645f,0.426732f,0.426818f,0.426905f,0.426992f,0.427078f,0.427165f,0.427252f,0.427338f,0.427425f,0.427512f,0.427598f,0.427685f,0.427772f,0.427858f,0.427945f,0.428032f,0.428118f,0.428205f,0.428292f,0.428378f,0.428465f,0.428552f,0.428638f,0.428725f,0.428811f,0.428898f,0.428985f,0.429071f,0.429158f,0.429244f,0.429331f,0.429418f,0.429504f,0.429591f,0.429677f,0.429764f,0.42985f,0.429937f,0.430024f,0.43011f,0.430197f,0.430283f,0.43037f,0.430456f,0.430543f,0.430629f,0.430716f,0.430802f,0.430889f,0.430975f,0.431062f,0.431148f,0.431235f,0.431321f,0.431408f,0.431494f,0.431581f,0.431667f,0.431754f,0.43184f,0.431927f,0.432013f,0.4321f,0.432186f,0.432273f,0.432359f,0.432446f,0.432532f,0.432618f,0.432705f,0.432791f,0.432878f,0.432964f,0.433051f,0.433137f,0.433223f,0.43331f,0.433396f,0.433483f,0.433569f,0.433655f,0.433742f,0.433828f,0.433915f,0.434001f,0.434087f,0.434174f,0.43426f,0.434346f,0.434433f,0.434519f,0.434605f,0.434692f,0.434778f,0.434865f,0.434951f,0.435037f,0.435124f,0.43521f,0.435296f,0.435382f,0.435469f,0.435555f,0.435641f,0.435728f,0.435814f,0.4359f,0.435987f,0.436073f,0.436159f,0.436245f,0.436332f,0.436418f,0.436504f,0.43659f,0.436677f,0.436763f,0.436849f,0.436935f,0.437022f,0.437108f,0.437194f,0.43728f,0.437367f,0.437453f,0.437539f,0.437625f,0.437711f,0.437798f,0.437884f,0.43797f,0.438056f,0.438142f,0.438228f,0.438315f,0.438401f,0.438487f,0.438573f,0.438659f,0.438745f,0.438832f,0.438918f,0.439004f,0.43909f,0.439176f,0.439262f,0.439348f,0.439435f,0.439521f,0.439607f,0.439693f,0.439779f,0.439865f,0.439951f,0.440037f,0.440123f,0.44021f,0.440296f,0.440382f,0.440468f,0.440554f,0.44064f,0.440726f,0.440812f,0.440898f,0.440984f,0.44107f,0.441156f,0.441242f,0.441328f,0.441414f,0.4415f,0.441586f,0.441672f,0.441758f,0.441844f,0.44193f,0.442016f,0.442102f,0.442188f,0.442274f,0.44236f,0.442446f,0.442532f,0.442618f,0.442704f,0.44279f,0.442876f,0.442962f,0.443048f,0.443134f,0.44322f,0.443306f,0.443392f,0.443478f,0.443564f,0.44365f,0.443736f,0.443821f,0.443907f,0.443993f,0.444079f,0.444165f,0.444251f,0.444337f,0.444423f,0.444509f,0.444595f,0.44468f,0.444766f,0.444852f,0.444938f,0.445024f,0.44511f,0.445196f,0.445281f,0.445367f,0.445453f,0.445539f,0.445625f,0.445711f,0.445796f,0.445882f,0.445968f,0.446054f,0.44614f,0.446225f,0.446311f,0.446397f,0.446483f,0.446569f,0.446654f,0.44674f,0.446826f,0.446912f,0.446997f,0.447083f,0.447169f,0.447255f,0.447341f,0.447426f,0.447512f,0.447598f,0.447683f,0.447769f,0.447855f,0.447941f,0.448026f,0.448112f,0.448198f,0.448283f,0.448369f,0.448455f,0.448541f,0.448626f,0.448712f,0.448798f,0.448883f,0.448969f,0.449055f,0.44914f,0.449226f,0.449312f,0.449397f,0.449483f,0.449569f,0.449654f,0.44974f,0.449825f,0.449911f,0.449997f,0.450082f,0.450168f,0.450253f,0.450339f,0.450425f,0.45051f,0.450596f,0.450681f,0.450767f,0.450853f,0.450938f,0.451024f,0.451109f,0.451195f,0.45128f,0.451366f,0.451452f,0.451537f,0.451623f,0.451708f,0.451794f,0.451879f,0.451965f,0.45205f,0.452136f,0.452221f,0.452307f,0.452392f,0.452478f,0.452563f,0.452649f,0.452734f,0.45282f,0.452905f,0.452991f,0.453076f,0.453162f,0.453247f,0.453333f,0.453418f,0.453504f,0.453589f,0.453674f,0.45376f,0.453845f,0.453931f,0.454016f,0.454102f,0.454187f,0.454272f,0.454358f,0.454443f,0.454529f,0.454614f,0.454699f,0.454785f,0.45487f,0.454956f,0.455041f,0.455126f,0.455212f,0.455297f,0.455382f,0.455468f,0.455553f,0.455638f,0.455724f,0.455809f,0.455894f,0.45598f,0.456065f,0.45615f,0.456236f,0.456321f,0.456406f,0.456492f,0.456577f,0.456662f,0.456748f,0.456833f,0.456918f,0.457003f,0.457089f,0.457174f,0.457259f,0.457344f,0.45743f,0.457515f,0.4576f,0.457685f,0.457771f,0.457856f,0.457941f,0.458026f,0.458112f,0.458197f,0.458282f,0.458367f,0.458452f,0.458538f,0.458623f,0.458708f,0.458793f,0.458878f,0.458964f,0.459049f,0.459134f,0.459219f,0.459304f,0.459389f,0.459475f,0.45956f,0.459645f,0.45973f,0.459815f,0.4599f,0.459985f,0.460071f,0.460156f,0.460241f,0.460326f,0.460411f,0.460496f,0.460581f,0.460666f,0.460751f,0.460837f,0.460922f,0.461007f,0.461092f,0.461177f,0.461262f,0.461347f,0.461432f,0.461517f,0.461602f,0.461687f,0.461772f,0.461857f,0.461942f,0.462027f,0.462112f,0.462197f,0.462282f,0.462367f,0.462452f,0.462537f,0.462622f,0.462707f,0.462792f,0.462877f,0.462962f,0.463047f,0.463132f,0.463217f,0.463302f,0.463387f,0.463472f,0.463557f,0.463642f,0.463727f,0.463812f,0.463897f,0.463982f,0.464067f,0.464152f,0.464237f,0.464322f,0.464406f,0.464491f,0.464576f,0.464661f,0.464746f,0.464831f,0.464916f,0.465001f,0.465086f,0.46517f,0.465255f,0.46534f,0.465425f,0.46551f,0.465595f,0.46568f,0.465764f,0.465849f,0.465934f,0.466019f,0.466104f,0.466189f,0.466273f,0.466358f,0.466443f,0.466528f,0.466613f,0.466697f,0.466782f,0.466867f,0.466952f,0.467037f,0.467121f,0.467206f,0.467291f,0.467376f,0.46746f,0.467545f,0.46763f,0.467715f,0.467799f,0.467884f,0.467969f,0.468054f,0.468138f,0.468223f,0.468308f,0.468392f,0.468477f,0.468562f,0.468646f,0.468731f,0.468816f,0.468901f,0.468985f,0.46907f,0.469155f,0.469239f,0.469324f,0.469409f,0.469493f,0.469578f,0.469662f,0.469747f,0.469832f,0.469916f,0.470001f,0.470086f,0.47017f,0.470255f,0.470339f,0.470424f,0.470509f,0.470593f,0.470678f,0.470762f,0.470847f,0.470932f,0.471016f,0.471101f,0.471185f,0.47127f,0.471354f,0.471439f,0.471524f,0.471608f,0.471693f,0.471777f,0.471862f,0.471946f,0.472031f,0.472115f,0.4722f,0.472284f,0.472369f,0.472453f,0.472538f,0.472622f,0.472707f,0.472791f,0.472876f,0.47296f,0.473045f,0.473129f,0.473214f,0.473298f,0.473383f,0.473467f,0.473551f,0.473636f,0.47372f,0.473805f,0.473889f,0.473974f,0.474058f,0.474142f,0.474227f,0.474311f,0.474396f,0.47448f,0.474564f,0.474649f,0.474733f,0.474818f,0.474902f,0.474986f,0.475071f,0.475155f,0.475239f,0.475324f,0.475408f,0.475492f,0.475577f,0.475661f,0.475745f,0.47583f,0.475914f,0.475998f,0.476083f,0.476167f,0.476251f,0.476336f,0.47642f,0.476504f,0.476589f,0.476673f,0.476757f,0.476841f,0.476926f,0.47701f,0.477094f,0.477178f,0.477263f,0.477347f,0.477431f,0.477515f,0.4776f,0.477684f,0.477768f,0.477852f,0.477937f,0.478021f,0.478105f,0.478189f,0.478273f,0.478358f,0.478442f,0.478526f,0.47861f,0.478694f,0.478778f,0.478863f,0.478947f,0.479031f,0.479115f,0.479199f,0.479283f,0.479368f,0.479452f,0.479536f,0.47962f,0.479704f,0.479788f,0.479872f,0.479956f,0.480041f,0.480125f,0.480209f,0.480293f,0.480377f,0.480461f,0.480545f,0.480629f,0.480713f,0.480797f,0.480881f,0.480965f,0.48105f,0.481134f,0.481218f,0.481302f,0.481386f,0.48147f,0.481554f,0.481638f,0.481722f,0.481806f,0.48189f,0.481974f,0.482058f,0.482142f,0.482226f,0.48231f,0.482394f,0.482478f,0.482562f,0.482646f,0.48273f,0.482814f,0.482898f,0.482982f,0.483065f,0.483149f,0.483233f,0.483317f,0.483401f,0.483485f,0.483569f,0.483653f,0.483737f,0.483821f,0.483905f,0.483989f,0.484072f,0.484156f,0.48424f,0.484324f,0.484408f,0.484492f,0.484576f,0.48466f,0.484743f,0.484827f,0.484911f,0.484995f,0.485079f,0.485163f,0.485247f,0.48533f,0.485414f,0.485498f,0.485582f,0.485666f,0.485749f,0.485833f,0.485917f,0.486001f,0.486085f,0.486168f,0.486252f,0.486336f,0.48642f,0.486503f,0.486587f,0.486671f,0.486755f,0.486839f,0.486922f,0.487006f,0.48709f,0.487173f,0.487257f,0.487341f,0.487425f,0.487508f,0.487592f,0.487676f,0.487759f,0.487843f,0.487927f,0.48801f,0.488094f,0.488178f,0.488262f,0.488345f,0.488429f,0.488513f,0.488596f,0.48868f,0.488763f,0.488847f,0.488931f,0.489014f,0.489098f,0.489182f,0.489265f,0.489349f,0.489432f,0.489516f,0.4896f,0.489683f,0.489767f,0.48985f,0.489934f,0.490018f,0.490101f,0.490185f,0.490268f,0.490352f,0.490435f,0.490519f,0.490602f,0.490686f,0.49077f,0.490853f,0.490937f,0.49102f,0.491104f,0.491187f,0.491271f,0.491354f,0.491438f,0.491521f,0.491605f,0.491688f,0.491772f,0.491855f,0.491939f,0.492022f,0.492106f,0.492189f,0.492272f,0.492356f,0.492439f,0.492523f,0.492606f,0.49269f,0.492773f,0.492856f,0.49294f,0.493023f,0.493107f,0.49319f,0.493274f,0.493357f,0.49344f,0.493524f,0.493607f,0.49369f,0.493774f,0.493857f,0.493941f,0.494024f,0.494107f,0.494191f,0.494274f,0.494357f,0.494441f,0.494524f,0.494607f,0.494691f,0.494774f,0.494857f,0.494941f,0.495024f,0.495107f,0.49519f,0.495274f,0.495357f,0.49544f,0.495524f,0.495607f,0.49569f,0.495773f,0.495857f,0.49594f,0.496023f,0.496106f,0.49619f,0.496273f,0.496356f,0.496439f,0.496523f,0.496606f,0.496689f,0.496772f,0.496855f,0.496939f,0.497022f,0.497105f,0.497188f,0.497271f,0.497355f,0.497438f,0.497521f,0.497604f,0.497687f,0.49777f,0.497854f,0.497937f,0.49802f,0.498103f,0.498186f,0.498269f,0.498352f,0.498435f,0.498519f,0.498602f,0.498685f,0.498768f,0.498851f,0.498934f,0.499017f,0.4991f,0.499183f,0.499266f,0.499349f,0.499433f,0.499516f,0.499599f,0.499682f,0.499765f,0.499848f,0.499931f,0.500014f,0.500097f,0.50018f,0.500263f,0.500346f,0.500429f,0.500512f,0.500595f,0.500678f,0.500761f,0.500844f,0.500927f,0.50101f,0.501093f,0.501176f,0.501259f,0.501342f,0.501425f,0.501508f,0.501591f,0.501674f,0.501756f,0.501839f,0.501922f,0.502005f,0.502088f,0.502171f,0.502254f,0.502337f,0.50242f,0.502503f,0.502585f,0.502668f,0.502751f,0.502834f,0.502917f,0.503f,0.503083f,0.503166f,0.503248f,0.503331f,0.503414f,0.503497f,0.50358f,0.503663f,0.503745f,0.503828f,0.503911f,0.503994f,0.504077f,0.50416f,0.504242f,0.504325f,0.504408f,0.504491f,0.504573f,0.504656f,0.504739f,0.504822f,0.504905f,0.504987f,0.50507f,0.505153f,0.505235f,0.505318f,0.505401f,0.505484f,0.505566f,0.505649f,0.505732f,0.505815f,0.505897f,0.50598f,0.506063f,0.506145f,0.506228f,0.506311f,0.506393f,0.506476f,0.506559f,0.506641f,0.506724f,0.506807f,0.506889f,0.506972f,0.507055f,0.507137f,0.50722f,0.507302f,0.507385f,0.507468f,0.50755f,0.507633f,0.507716f,0.507798f,0.507881f,0.507963f,0.508046f,0.508128f,0.508211f,0.508294f,0.508376f,0.508459f,0.508541f,0.508624f,0.508706f,0.508789f,0.508871f,0.508954f,0.509036f,0.509119f,0.509202f,0.509284f,0.509367f,0.509449f,0.509531f,0.509614f,0.509696f,0.509779f,0.509861f,0.509944f,0.510026f,0.510109f,0.510191f,0.510274f,0.510356f,0.510439f,0.510521f,0.510604f,0.510686f,0.510768f,0.510851f,0.510933f,0.511016f,0.511098f,0.51118f,0.511263f,0.511345f,0.511428f,0.51151f,0.511592f,0.511675f,0.511757f,0.51184f,0.511922f,0.512004f,0.512087f,0.512169f,0.512251f,0.512334f,0.512416f,0.512498f,0.512581f,0.512663f,0.512745f,0.512828f,0.51291f,0.512992f,0.513074f,0.513157f,0.513239f,0.513321f,0.513404f,0.513486f,0.513568f,0.51365f,0.513733f,0.513815f,0.513897f,0.513979f,0.514062f,0.514144f,0.514226f,0.514308f,0.514391f,0.514473f,0.514555f,0.514637f,0.514719f,0.514802f,0.514884f,0.514966f,0.515048f,0.51513f,0.515212f,0.515295f,0.515377f,0.515459f,0.515541f,0.515623f,0.515705f,0.515788f,0.51587f,0.515952f,0.516034f,0.516116f,0.516198f,0.51628f,0.516362f,0.516445f,0.516527f,0.516609f,0.516691f,0.516773f,0.516855f,0.516937f,0.517019f,0.517101f,0.517183f,0.517265f,0.517347f,0.517429f,0.517511f,0.517593f,0.517675f,0.517757f,0.517839f,0.517922f,0.518004f,0.518086f,0.518167f,0.51825f,0.518332f,0.518414f,0.518496f,0.518577f,0.518659f,0.518741f,0.518823f,0.518905f,0.518987f,0.519069f,0.519151f,0.519233f,0.519315f,0.519397f,0.519479f,0.519561f,0.519643f,0.519725f,0.519807f,0.519888f,0.51997f,0.520052f,0.520134f,0.520216f,0.520298f,0.52038f,0.520462f,0.520543f,0.520625f,0.520707f,0.520789f,0.520871f,0.520953f,0.521035f,0.521116f,0.521198f,0.52128f,0.521362f,0.521444f,0.521525f,0.521607f,0.521689f,0.521771f,0.521853f,0.521934f,0.522016f,0.522098f,0.52218f,0.522262f,0.522343f,0.522425f,0.522507f,0.522588f,0.52267f,0.522752f,0.522834f,0.522915f,0.522997f,0.523079f,0.523161f,0.523242f,0.523324f,0.523406f,0.523487f,0.523569f,0.523651f,0.523732f,0.523814f,0.523896f,0.523977f,0.524059f,0.524141f,0.524222f,0.524304f,0.524386f,0.524467f,0.524549f,0.52463f,0.524712f,0.524794f,0.524875f,0.524957f,0.525039f,0.52512f,0.525202f,0.525283f,0.525365f,0.525446f,0.525528f,0.52561f,0.525691f,0.525773f,0.525854f,0.525936f,0.526017f,0.526099f,0.52618f,0.526262f,0.526343f,0.526425f,0.526507f,0.526588f,0.52667f,0.526751f,0.526833f,0.526914f,0.526995f,0.527077f,0.527158f,0.52724f,0.527321f,0.527403f,0.527484f,0.527566f,0.527647f,0.527729f,0.52781f,0.527891f,0.527973f,0.528054f,0.528136f,0.528217f,0.528299f,0.52838f,0.528461f,0.528543f,0.528624f,0.528705f,0.528787f,0.528868f,0.52895f,0.529031f,0.529112f,0.529194f,0.529275f,0.529356f,0.529438f,0.529519f,0.5296f,0.529682f,0.529763f,0.529844f,0.529926f,0.530007f,0.530088f,0.530169f,0.530251f,0.530332f,0.530413f,0.530495f,0.530576f,0.530657f,0.530738f,0.53082f,0.530901f,0.530982f,0.531063f,0.531145f,0.531226f,0.531307f,0.531388f,0.53147f,0.531551f,0.531632f,0.531713f,0.531794f,0.531875f,0.531957f,0.532038f,0.532119f,0.5322f,0.532281f,0.532363f,0.532444f,0.532525f,0.532606f,0.532687f,0.532768f,0.532849f,0.532931f,0.533012f,0.533093f,0.533174f,0.533255f,0.533336f,0.533417f,0.533498f,0.533579f,0.53366f,0.533742f,0.533823f,0.533904f,0.533985f,0.534066f,0.534147f,0.534228f,0.534309f,0.53439f,0.534471f,0.534552f,0.534633f,0.534714f,0.534795f,0.534876f,0.534957f,0.535038f,0.535119f,0.5352f,0.535281f,0.535362f,0.535443f,0.535524f,0.535605f,0.535686f,0.535767f,0.535848f,0.535929f,0.53601f,0.536091f,0.536172f,0.536252f,0.536334f,0.536414f,0.536495f,0.536576f,0.536657f,0.536738f,0.536819f,0.5369f,0.536981f,0.537062f,0.537142f,0.537223f,0.537304f,0.537385f,0.537466f,0.537547f,0.537628f,0.537708f,0.537789f,0.53787f,0.537951f,0.538032f,0.538112f,0.538193f,0.538274f,0.538355f,0.538436f,0.538516f,0.538597f,0.538678f,0.538759f,0.53884f,0.53892f,0.539001f,0.539082f,0.539163f,0.539243f,0.539324f,0.539405f,0.539486f,0.539566f,0.539647f,0.539728f,0.539808f,0.539889f,0.53997f,0.54005f,0.540131f,0.540212f,0.540293f,0.540373f,0.540454f,0.540534f,0.540615f,0.540696f,0.540776f,0.540857f,0.540938f,0.541018f,0.541099f,0.54118f,0.54126f,0.541341f,0.541421f,0.541502f,0.541583f,0.541663f,0.541744f,0.541824f,0.541905f,0.541986f,0.542066f,0.542147f,0.542227f,0.542308f,0.542388f,0.542469f,0.542549f,0.54263f,0.542711f,0.542791f,0.542872f,0.542952f,0.543033f,0.543113f,0.543194f,0.543274f,0.543355f,0.543435f,0.543516f,0.543596f,0.543676f,0.543757f,0.543837f,0.543918f,0.543998f,0.544079f,0.544159f,0.54424f,0.54432f,0.5444f,0.544481f,0.544561f,0.544642f,0.544722f,0.544803f,0.544883f,0.544963f,0.545044f,0.545124f,0.545204f,0.545285f,0.545365f,0.545446f,0.545526f,0.545606f,0.545687f,0.545767f,0.545847f,0.545928f,0.546008f,0.546088f,0.546169f,0.546249f,0.546329f,0.546409f,0.54649f,0.54657f,0.54665f,0.546731f,0.546811f,0.546891f,0.546971f,0.547052f,0.547132f,0.547212f,0.547292f,0.547373f,0.547453f,0.547533f,0.547613f,0.547694f,0.547774f,0.547854f,0.547934f,0.548014f,0.548095f,0.548175f,0.548255f,0.548335f,0.548415f,0.548495f,0.548576f,0.548656f,0.548736f,0.548816f,0.548896f,0.548976f,0.549056f,0.549137f,0.549217f,0.549297f,0.549377f,0.549457f,0.549537f,0.549617f,0.549697f,0.549777f,0.549858f,0.549938f,0.550018f,0.550098f,0.550178f,0.550258f,0.550338f,0.550418f,0.550498f,0.550578f,0.550658f,0.550738f,0.550818f,0.550898f,0.550978f,0.551058f,0.551138f,0.551218f,0.551298f,0.551378f,0.551458f,0.551538f,0.551618f,0.551698f,0.551778f,0.551858f,0.551938f,0.552018f,0.552098f,0.552178f,0.552258f,0.552338f,0.552418f,0.552497f,0.552577f,0.552657f,0.552737f,0.552817f,0.552897f,0.552977f,0.553057f,0.553137f,0.553216f,0.553296f,0.553376f,0.553456f,0.553536f,0.553616f,0.553695f,0.553775f,0.553855f,0.553935f,0.554015f,0.554095f,0.554174f,0.554254f,0.554334f,0.554414f,0.554494f,0.554573f,0.554653f,0.554733f,0.554813f,0.554892f,0.554972f,0.555052f,0.555132f,0.555211f,0.555291f,0.555371f,0.555451f,0.55553f,0.55561f,0.55569f,0.55577f,0.555849f,0.555929f,0.556009f,0.556088f,0.556168f,0.556248f,0.556327f,0.556407f,0.556487f,0.556566f,0.556646f,0.556726f,0.556805f,0.556885f,0.556965f,0.557044f,0.557124f,0.557203f,0.557283f,0.557363f,0.557442f,0.557522f,0.557601f,0.557681f,0.557761f,0.55784f,0.55792f,0.557999f,0.558079f,0.558158f,0.558238f,0.558317f,0.558397f,0.558476f,0.558556f,0.558636f,0.558715f,0.558795f,0.558874f,0.558954f,0.559033f,0.559113f,0.559192f,0.559272f,0.559351f,0.55943f,0.55951f,0.559589f,0.559669f,0.559748f,0.559828f,0.559907f,0.559987f,0.560066f,0.560145f,0.560225f,0.560304f,0.560384f,0.560463f,0.560542f,0.560622f,0.560701f,0.560781f,0.56086f,0.560939f,0.561019f,0.561098f,0.561177f,0.561257f,0.561336f,0.561416f,0.561495f,0.561574f,0.561654f,0.561733f,0.561812f,0.561891f,0.561971f,0.56205f,0.562129f,0.562209f,0.562288f,0.562367f,0.562446f,0.562526f,0.562605f,0.562684f,0.562764f,0.562843f,0.562922f,0.563001f,0.56308f,0.56316f,0.563239f,0.563318f,0.563397f,0.563477f,0.563556f,0.563635f,0.563714f,0.563793f,0.563873f,0.563952f,0.564031f,0.56411f,0.564189f,0.564268f,0.564348f,0.564427f,0.564506f,0.564585f,0.564664f,0.564743f,0.564822f,0.564901f,0.564981f,0.56506f,0.565139f,0.565218f,0.565297f,0.565376f,0.565455f,0.565534f,0.565613f,0.565692f,0.565771f,0.56585f,0.565929f,0.566008f,0.566088f,0.566167f,0.566246f,0.566325f,0.566404f,0.566483f,0.566562f,0.566641f,0.56672f,0.566799f,0.566878f,0.566957f,0.567036f,0.567114f,0.567194f,0.567272f,0.567351f,0.56743f,0.567509f,0.567588f,0.567667f,0.567746f,0.567825f,0.567904f,0.567983f,0.568062f,0.568141f,0.568219f,0.568298f,0.568377f,0.568456f,0.568535f,0.568614f,0.568693f,0.568772f,0.56885f,0.568929f,0.569008f,0.569087f,0.569166f,0.569245f,0.569323f,0.569402f,0.569481f,0.56956f,0.569639f,0.569718f,0.569796f,0.569875f,0.569954f,0.570033f,0.570111f,0.57019f,0.570269f,0.570348f,0.570426f,0.570505f,0.570584f,0.570663f,0.570741f,0.57082f,0.570899f,0.570978f,0.571056f,0.571135f,0.571214f,0.571292f,0.571371f,0.57145f,0.571528f,0.571607f,0.571686f,0.571764f,0.571843f,0.571922f,0.572f,0.572079f,0.572158f,0.572236f,0.572315f,0.572393f,0.572472f,0.572551f,0.572629f,0.572708f,0.572786f,0.572865f,0.572944f,0.573022f,0.573101f,0.573179f,0.573258f,0.573336f,0.573415f,0.573494f,0.573572f,0.573651f,0.573729f,0.573808f,0.573886f,0.573965f,0.574043f,0.574122f,0.5742f,0.574279f,0.574357f,0.574436f,0.574514f,0.574593f,0.574671f,0.57475f,0.574828f,0.574906f,0.574985f,0.575063f,0.575142f,0.57522f,0.575299f,0.575377f,0.575455f,0.575534f,0.575612f,0.575691f,0.575769f,0.575847f,0.575926f,0.576004f,0.576083f,0.576161f,0.576239f,0.576318f,0.576396f,0.576474f,0.576553f,0.576631f,0.576709f,0.576788f,0.576866f,0.576944f,0.577023f,0.577101f,0.577179f,0.577257f,0.577336f,0.577414f,0.577492f,0.57757f,0.577649f,0.577727f,0.577805f,0.577884f,0.577962f,0.57804f,0.578118f,0.578196f,0.578275f,0.578353f,0.578431f,0.578509f,0.578588f,0.578666f,0.578744f,0.578822f,0.5789f,0.578978f,0.579057f,0.579135f,0.579213f,0.579291f,0.579369f,0.579447f,0.579526f,0.579604f,0.579682f,0.57976f,0.579838f,0.579916f,0.579994f,0.580072f,0.58015f,0.580229f,0.580307f,0.580385f,0.580463f,0.580541f,0.580619f,0.580697f,0.580775f,0.580853f,0.580931f,0.581009f,0.581087f,0.581165f,0.581243f,0.581321f,0.581399f,0.581477f,0.581555f,0.581633f,0.581711f,0.581789f,0.581867f,0.581945f,0.582023f,0.582101f,0.582179f,0.582257f,0.582335f,0.582413f,0.582491f,0.582569f,0.582647f,0.582724f,0.582802f,0.58288f,0.582958f,0.583036f,0.583114f,0.583192f,0.58327f,0.583348f,0.583425f,0.583503f,0.583581f,0.583659f,0.583737f,0.583815f,0.583893f,0.58397f,0.584048f,0.584126f,0.584204f,0.584282f,0.584359f,0.584437f,0.584515f,0.584593f,0.584671f,0.584748f,0.584826f,0.584904f,0.584982f,0.585059f,0.585137f,0.585215f,0.585293f,0.58537f,0.585448f,0.585526f,0.585604f,0.585681f,0.585759f,0.585837f,0.585914f,0.585992f,0.58607f,0.586147f,0.586225f,0.586303f,0.58638f,0.586458f,0.586536f,0.586613f,0.586691f,0.586769f,0.586846f,0.586924f,0.587002f,0.587079f,0.587157f,0.587234f,0.587312f,0.58739f,0.587467f,0.587545f,0.587622f,0.5877f,0.587777f,0.587855f,0.587933f,0.58801f,0.588088f,0.588165f,0.588243f,0.58832f,0.588398f,0.588475f,0.588553f,0.58863f,0.588708f,0.588785f,0.588863f,0.58894f,0.589018f,0.589095f,0.589173f,0.58925f,0.589328f,0.589405f,0.589483f,0.58956f,0.589638f,0.589715f,0.589792f,0.58987f,0.589947f,0.590025f,0.590102f,0.590179f,0.590257f,0.590334f,0.590412f,0.590489f,0.590566f,0.590644f,0.590721f,0.590798f,0.590876f,0.590953f,0.59103f,0.591108f,0.591185f,0.591262f,0.59134f,0.591417f,0.591494f,0.591572f,0.591649f,0.591726f,0.591804f,0.591881f,0.591958f,0.592035f,0.592113f,0.59219f,0.592267f,0.592344f,0.592422f,0.592499f,0.592576f,0.592653f,0.592731f,0.592808f,0.592885f,0.592962f,0.593039f,0.593117f,0.593194f,0.593271f,0.593348f,0.593425f,0.593502f,0.59358f,0.593657f,0.593734f,0.593811f,0.593888f,0.593965f,0.594042f,0.59412f,0.594197f,0.594274f,0.594351f,0.594428f,0.594505f,0.594582f,0.594659f,0.594736f,0.594813f,0.59489f,0.594967f,0.595045f,0.595122f,0.595199f,0.595276f,0.595353f,0.59543f,0.595507f,0.595584f,0.595661f,0.595738f,0.595815f,0.595892f,0.595969f,0.596046f,0.596123f,0.5962f,0.596277f,0.596354f,0.596431f,0.596508f,0.596585f,0.596661f,0.596738f,0.596815f,0.596892f,0.596969f,0.597046f,0.597123f,0.5972f,0.597277f,0.597354f,0.597431f,0.597507f,0.597584f,0.597661f,0.597738f,0.597815f,0.597892f,0.597969f,0.598045f,0.598122f,0.598199f,0.598276f,0.598353f,0.59843f,0.598506f,0.598583f,0.59866f,0.598737f,0.598814f,0.59889f,0.598967f,0.599044f,0.599121f,0.599197f,0.599274f,0.599351f,0.599428f,0.599504f,0.599581f,0.599658f,0.599735f,0.599811f,0.599888f,0.599965f,0.600041f,0.600118f,0.600195f,0.600271f,0.600348f,0.600425f,0.600502f,0.600578f,0.600655f,0.600731f,0.600808f,0.600885f,0.600961f,0.601038f,0.601115f,0.601191f,0.601268f,0.601344f,0.601421f,0.601498f,0.601574f,0.601651f,0.601727f,0.601804f,0.601881f,0.601957f,0.602034f,0.60211f,0.602187f,0.602263f,0.60234f,0.602416f,0.602493f,0.602569f,0.602646f,0.602722f,0.602799f,0.602875f,0.602952f,0.603028f,0.603105f,0.603181f,0.603258f,0.603334f,0.603411f,0.603487f,0.603564f,0.60364f,0.603716f,0.603793f,0.603869f,0.603946f,0.604022f,0.604099f,0.604175f,0.604251f,0.604328f,0.604404f,0.604481f,0.604557f,0.604633f,0.60471f,0.604786f,0.604862f,0.604939f,0.605015f,0.605091f,0.605168f,0.605244f,0.60532f,0.605397f,0.605473f,0.605549f,0.605626f,0.605702f,0.605778f,0.605854f,0.605931f,0.606007f,0.606083f,0.606159f,0.606236f,0.606312f,0.606388f,0.606464f,0.606541f,0.606617f,0.606693f,0.606769f,0.606845f,0.606922f,0.606998f,0.607074f,0.60715f,0.607226f,0.607303f,0.607379f,0.607455f,0.607531f,0.607607f,0.607683f,0.607759f,0.607836f,0.607912f,0.607988f,0.608064f,0.60814f,0.608216f,0.608292f,0.608368f,0.608444f,0.608521f,0.608597f,0.608673f,0.608749f,0.608825f,0.608901f,0.608977f,0.609053f,0.609129f,0.609205f,0.609281f,0.609357f,0.609433f,0.609509f,0.609585f,0.609661f,0.609737f,0.609813f,0.609889f,0.609965f,0.610041f,0.610117f,0.610193f,0.610269f,0.610345f,0.610421f,0.610497f,0.610573f,0.610649f,0.610725f,0.6108f,0.610876f,0.610952f,0.611028f,0.611104f,0.61118f,0.611256f,0.611332f,0.611408f,0.611483f,0.611559f,0.611635f,0.611711f,0.611787f,0.611863f,0.611938f,0.612014f,0.61209f,0.612166f,0.612242f,0.612318f,0.612393f,0.612469f,0.612545f,0.612621f,0.612696f,0.612772f,0.612848f,0.612924f,0.612999f,0.613075f,0.613151f,0.613227f,0.613302f,0.613378f,0.613454f,0.61353f,0.613605f,0.613681f,0.613757f,0.613832f,0.613908f,0.613984f,0.614059f,0.614135f,0.614211f,0.614286f,0.614362f,0.614438f,0.614513f,0.614589f,0.614665f,0.61474f,0.614816f,0.614891f,0.614967f,0.615043f,0.615118f,0.615194f,0.615269f,0.615345f,0.615421f,0.615496f,0.615572f,0.615647f,0.615723f,0.615798f,0.615874f,0.615949f,0.616025f,0.6161f,0.616176f,0.616251f,0.616327f,0.616402f,0.616478f,0.616553f,0.616629f,0.616704f,0.61678f,0.616855f,0.616931f,0.617006f,0.617082f,0.617157f,0.617233f,0.617308f,0.617383f,0.617459f,0.617534f,0.61761f,0.617685f,0.61776f,0.617836f,0.617911f,0.617987f,0.618062f,0.618137f,0.618213f,0.618288f,0.618363f,0.618439f,0.618514f,0.618589f,0.618665f,0.61874f,0.618815f,0.618891f,0.618966f,0.619041f,0.619117f,0.619192f,0.619267f,0.619342f,0.619418f,0.619493f,0.619568f,0.619643f,0.619719f,0.619794f,0.619869f,0.619944f,0.62002f,0.620095f,0.62017f,0.620245f,0.62032f,0.620396f,0.620471f,0.620546f,0.620621f,0.620696f,0.620772f,0.620847f,0.620922f,0.620997f,0.621072f,0.621147f,0.621222f,0.621298f,0.621373f,0.621448f,0.621523f,0.621598f,0.621673f,0.621748f,0.621823f,0.621898f,0.621973f,0.622049f,0.622124f,0.622199f,0.622274f,0.622349f,0.622424f,0.622499f,0.622574f,0.622649f,0.622724f,0.622799f,0.622874f,0.622949f,0.623024f,0.623099f,0.623174f,0.623249f,0.623324f,0.623399f,0.623474f,0.623549f,0.623624f,0.623699f,0.623774f,0.623848f,0.623923f,0.623998f,0.624073f,0.624148f,0.624223f,0.624298f,0.624373f,0.624448f,0.624523f,0.624597f,0.624672f,0.624747f,0.624822f,0.624897f,0.624972f,0.625047f,0.625121f,0.625196f,0.625271f,0.625346f,0.625421f,0.625495f,0.62557f,0.625645f,0.62572f,0.625795f,0.62587f,0.625944f,0.626019f,0.626094f,0.626169f,0.626243f,0.626318f,0.626393f,0.626468f,0.626542f,0.626617f,0.626692f,0.626766f,0.626841f,0.626916f,0.62699f,0.627065f,0.62714f,0.627214f,0.627289f,0.627364f,0.627438f,0.627513f,0.627588f,0.627662f,0.627737f,0.627812f,0.627886f,0.627961f,0.628035f,0.62811f,0.628185f,0.628259f,0.628334f,0.628408f,0.628483f,0.628558f,0.628632f,0.628707f,0.628781f,0.628856f,0.62893f,0.629005f,0.629079f,0.629154f,0.629228f,0.629303f,0.629378f,0.629452f,0.629526f,0.629601f,0.629676f,0.62975f,0.629824f,0.629899f,0.629973f,0.630048f,0.630122f,0.630197f,0.630271f,0.630346f,0.63042f,0.630494f,0.630569f,0.630643f,0.630718f,0.630792f,0.630866f,0.630941f,0.631015f,0.63109f,0.631164f,0.631238f,0.631313f,0.631387f,0.631461f,0.631536f,0.63161f,0.631684f,0.631759f,0.631833f,0.631907f,0.631982f,0.632056f,0.63213f,0.632204f,0.632279f,0.632353f,0.632427f,0.632502f,0.632576f,0.63265f,0.632724f,0.632799f,0.632873f,0.632947f,0.633021f,0.633095f,0.63317f,0.633244f,0.633318f,0.633392f,0.633466f,0.633541f,0.633615f,0.633689f,0.633763f,0.633837f,0.633911f,0.633986f,0.63406f,0.634134f,0.634208f,0.634282f,0.634356f,0.63443f,0.634504f,0.634579f,0.634653f,0.634727f,0.634801f,0.634875f,0.634949f,0.635023f,0.635097f,0.635171f,0.635245f,0.635319f,0.635393f,0.635467f,0.635541f,0.635615f,0.635689f,0.635763f,0.635837f,0.635911f,0.635985f,0.636059f,0.636133f,0.636207f,0.636281f,0.636355f,0.636429f,0.636503f,0.636577f,0.636651f,0.636725f,0.636799f,0.636873f,0.636947f,0.637021f,0.637094f,0.637168f,0.637242f,0.637316f,0.63739f,0.637464f,0.637538f,0.637612f,0.637685f,0.637759f,0.637833f,0.637907f,0.637981f,0.638055f,0.638129f,0.638202f,0.638276f,0.63835f,0.638424f,0.638497f,0.638571f,0.638645f,0.638719f,0.638793f,0.638866f,0.63894f,0.639014f,0.639088f,0.639161f,0.639235f,0.639309f,0.639382f,0.639456f,0.63953f,0.639604f,0.639677f,0.639751f,0.639825f,0.639898f,0.639972f,0.640046f,0.640119f,0.640193f,0.640267f,0.64034f,0.640414f,0.640488f,0.640561f,0.640635f,0.640708f,0.640782f,0.640856f,0.640929f,0.641003f,0.641076f,0.64115f,0.641224f,0.641297f,0.641371f,0.641444f,0.641518f,0.641591f,0.641665f,0.641738f,0.641812f,0.641885f,0.641959f,0.642033f,0.642106f,0.642179f,0.642253f,0.642326f,0.6424f,0.642473f,0.642547f,0.64262f,0.642694f,0.642767f,0.642841f,0.642914f,0.642987f,0.643061f,0.643134f,0.643208f,0.643281f,0.643355f,0.643428f,0.643501f,0.643575f,0.643648f,0.643722f,0.643795f,0.643868f,0.643942f,0.644015f,0.644088f,0.644162f,0.644235f,0.644308f,0.644382f,0.644455f,0.644528f,0.644602f,0.644675f,0.644748f,0.644821f,0.644895f,0.644968f,0.645041f,0.645114f,0.645188f,0.645261f,0.645334f,0.645407f,0.645481f,0.645554f,0.645627f,0.6457f,0.645773f,0.645847f,0.64592f,0.645993f,0.646066f,0.646139f,0.646213f,0.646286f,0.646359f,0.646432f,0.646505f,0.646578f,0.646652f,0.646725f,0.646798f,0.646871f,0.646944f,0.647017f,0.64709f,0.647163f,0.647236f,0.647309f,0.647382f,0.647456f,0.647529f,0.647602f,0.647675f,0.647748f,0.647821f,0.647894f,0.647967f,0.64804f,0.648113f,0.648186f,0.648259f,0.648332f,0.648405f,0.648478f,0.648551f,0.648624f,0.648697f,0.64877f,0.648843f,0.648916f,0.648989f,0.649062f,0.649135f,0.649207f,0.64928f,0.649353f,0.649426f,0.649499f,0.649572f,0.649645f,0.649718f,0.649791f,0.649864f,0.649936f,0.650009f,0.650082f,0.650155f,0.650228f,0.650301f,0.650373f,0.650446f,0.650519f,0.650592f,0.650665f,0.650738f,0.65081f,0.650883f,0.650956f,0.651029f,0.651101f,0.651174f,0.651247f,0.65132f,0.651392f,0.651465f,0.651538f,0.651611f,0.651683f,0.651756f,0.651829f,0.651901f,0.651974f,0.652047f,0.65212f,0.652192f,0.652265f,0.652338f,0.65241f,0.652483f,0.652556f,0.652628f,0.652701f,0.652773f,0.652846f,0.652919f,0.652991f,0.653064f,0.653137f,0.653209f,0.653282f,0.653354f,0.653427f,0.653499f,0.653572f,0.653645f,0.653717f,0.65379f,0.653862f,0.653935f,0.654007f,0.65408f,0.654152f,0.654225f,0.654297f,0.65437f,0.654442f,0.654515f,0.654587f,0.65466f,0.654732f,0.654805f,0.654877f,0.65495f,0.655022f,0.655095f,0.655167f,0.655239f,0.655312f,0.655384f,0.655457f,0.655529f,0.655601f,0.655674f,0.655746f,0.655819f,0.655891f,0.655963f,0.656036f,0.656108f,0.65618f,0.656253f,0.656325f,0.656397f,0.65647f,0.656542f,0.656614f,0.656687f,0.656759f,0.656831f,0.656904f,0.656976f,0.657048f,0.65712f,0.657193f,0.657265f,0.657337f,0.657409f,0.657482f,0.657554f,0.657626f,0.657698f,0.657771f,0.657843f,0.657915f,0.657987f,0.658059f,0.658132f,0.658204f,0.658276f,0.658348f,0.65842f,0.658492f,0.658565f,0.658637f,0.658709f,0.658781f,0.658853f,0.658925f,0.658997f,0.659069f,0.659142f,0.659214f,0.659286f,0.659358f,0.65943f,0.659502f,0.659574f,0.659646f,0.659718f,0.65979f,0.659862f,0.659934f,0.660006f,0.660078f,0.66015f,0.660222f,0.660294f,0.660366f,0.660438f,0.66051f,0.660582f,0.660654f,0.660726f,0.660798f,0.66087f,0.660942f,0.661014f,0.661086f,0.661158f,0.66123f,0.661302f,0.661374f,0.661446f,0.661518f,0.661589f,0.661661f,0.661733f,0.661805f,0.661877f,0.661949f,0.662021f,0.662093f,0.662164f,0.662236f,0.662308f,0.66238f,0.662452f,0.662524f,0.662595f,0.662667f,0.662739f,0.662811f,0.662883f,0.662954f,0.663026f,0.663098f,0.66317f,0.663241f,0.663313f,0.663385f,0.663457f,0.663528f,0.6636f,0.663672f,0.663743f,0.663815f,0.663887f,0.663959f,0.66403f,0.664102f,0.664174f,0.664245f,0.664317f,0.664389f,0.66446f,0.664532f,0.664604f,0.664675f,0.664747f,0.664818f,0.66489f,0.664962f,0.665033f,0.665105f,0.665176f,0.665248f,0.66532f,0.665391f,0.665463f,0.665534f,0.665606f,0.665677f,0.665749f,0.66582f,0.665892f,0.665964f,0.666035f,0.666107f,0.666178f,0.66625f,0.666321f,0.666393f,0.666464f,0.666535f,0.666607f,0.666678f,0.66675f,0.666821f,0.666893f,0.666964f,0.667036f,0.667107f,0.667179f,0.66725f,0.667321f,0.667393f,0.667464f,0.667535f,0.667607f,0.667678f,0.66775f,0.667821f,0.667892f,0.667964f,0.668035f,0.668106f,0.668178f,0.668249f,0.66832f,0.668392f,0.668463f,0.668534f,0.668606f,0.668677f,0.668748f,0.668819f,0.668891f,0.668962f,0.669033f,0.669105f,0.669176f,0.669247f,0.669318f,0.669389f,0.669461f,0.669532f,0.669603f,0.669674f,0.669746f,0.669817f,0.669888f,0.669959f,0.67003f,0.670101f,0.670173f,0.670244f,0.670315f,0.670386f,0.670457f,0.670528f,0.670599f,0.670671f,0.670742f,0.670813f,0.670884f,0.670955f,0.671026f,0.671097f,0.671168f,0.671239f,0.67131f,0.671381f,0.671452f,0.671523f,0.671595f,0.671665f,0.671737f,0.671808f,0.671879f,0.67195f,0.672021f,0.672092f,0.672163f,0.672234f,0.672305f,0.672376f,0.672446f,0.672517f,0.672588f,0.672659f,0.67273f,0.672801f,0.672872f,0.672943f,0.673014f,0.673085f,0.673156f,0.673227f,0.673298f,0.673368f,0.673439f,0.67351f,0.673581f,0.673652f,0.673723f,0.673794f,0.673864f,0.673935f,0.674006f,0.674077f,0.674148f,0.674219f,0.674289f,0.67436f,0.674431f,0.674502f,0.674572f,0.674643f,0.674714f,0.674785f,0.674856f,0.674926f,0.674997f,0.675068f,0.675138f,0.675209f,0.67528f,0.675351f,0.675421f,0.675492f,0.675563f,0.675633f,0.675704f,0.675775f,0.675845f,0.675916f,0.675987f,0.676057f,0.676128f,0.676199f,0.676269f,0.67634f,0.676411f,0.676481f,0.676552f,0.676622f,0.676693f,0.676764f,0.676834f,0.676905f,0.676975f,0.677046f,0.677116f,0.677187f,0.677257f,0.677328f,0.677399f,0.677469f,0.67754f,0.67761f,0.677681f,0.677751f,0.677822f,0.677892f,0.677963f,0.678033f,0.678103f,0.678174f,0.678244f,0.678315f,0.678385f,0.678456f,0.678526f,0.678597f,0.678667f,0.678737f,0.678808f,0.678878f,0.678949f,0.679019f,0.679089f,0.67916f,0.67923f,0.6793f,0.679371f,0.679441f,0.679511f,0.679582f,0.679652f,0.679722f,0.679793f,0.679863f,0.679933f,0.680004f,0.680074f,0.680144f,0.680215f,0.680285f,0.680355f,0.680425f,0.680496f,0.680566f,0.680636f,0.680706f,0.680777f,0.680847f,0.680917f,0.680987f,0.681057f,0.681128f,0.681198f,0.681268f,0.681338f,0.681408f,0.681479f,0.681549f,0.681619f,0.681689f,0.681759f,0.681829f,0.681899f,0.68197f,0.68204f,0.68211f,0.68218f,0.68225f,0.68232f,0.68239f,0.68246f,0.68253f,0.6826f,0.68267f,0.682741f,0.682811f,0.682881f,0.682951f,0.683021f,0.683091f,0.683161f,0.683231f,0.683301f,0.683371f,0.683441f,0.683511f,0.683581f,0.683651f,0.683721f,0.683791f,0.683861f,0.68393f,0.684f,0.68407f,0.68414f,0.68421f,0.68428f,0.68435f,0.68442f,0.68449f,0.68456f,0.68463f,0.684699f,0.684769f,0.684839f,0.684909f,0.684979f,0.685049f,0.685119f,0.685188f,0.685258f,0.685328f,0.685398f,0.685468f,0.685538f,0.685607f,0.685677f,0.685747f,0.685817f,0.685886f,0.685956f,0.686026f,0.686096f,0.686165f,0.686235f,0.686305f,0.686375f,0.686444f,0.686514f,0.686584f,0.686653f,0.686723f,0.686793f,0.686863f,0.686932f,0.687002f,0.687072f,0.687141f,0.687211f,0.687281f,0.68735f,0.68742f,0.687489f,0.687559f,0.687629f,0.687698f,0.687768f,0.687837f,0.687907f,0.687977f,0.688046f,0.688116f,0.688185f,0.688255f,0.688324f,0.688394f,0.688464f,0.688533f,0.688603f,0.688672f,0.688742f,0.688811f,0.688881f,0.68895f,0.68902f,0.689089f,0.689159f,0.689228f,0.689297f,0.689367f,0.689436f,0.689506f,0.689575f,0.689645f,0.689714f,0.689784f,0.689853f,0.689922f,0.689992f,0.690061f,0.690131f,0.6902f,0.690269f,0.690339f,0.690408f,0.690477f,0.690547f,0.690616f,0.690685f,0.690755f,0.690824f,0.690893f,0.690963f,0.691032f,0.691101f,0.691171f,0.69124f,0.691309f,0.691378f,0.691448f,0.691517f,0.691586f,0.691655f,0.691725f,0.691794f,0.691863f,0.691932f,0.692002f,0.692071f,0.69214f,0.692209f,0.692278f,0.692348f,0.692417f,0.692486f,0.692555f,0.692624f,0.692693f,0.692762f,0.692832f,0.692901f,0.69297f,0.693039f,0.693108f,0.693177f,0.693246f,0.693315f,0.693385f,0.693454f,0.693523f,0.693592f,0.693661f,0.69373f,0.693799f,0.693868f,0.693937f,0.694006f,0.694075f,0.694144f,0.694213f,0.694282f,0.694351f,0.69442f,0.694489f,0.694558f,0.694627f,0.694696f,0.694765f,0.694834f,0.694903f,0.694972f,0.695041f,0.69511f,0.695179f,0.695247f,0.695316f,0.695385f,0.695454f,0.695523f,0.695592f,0.695661f,0.69573f,0.695799f,0.695867f,0.695936f,0.696005f,0.696074f,0.696143f,0.696212f,0.69628f,0.696349f,0.696418f,0.696487f,0.696556f,0.696624f,0.696693f,0.696762f,0.696831f,0.696899f,0.696968f,0.697037f,0.697106f,0.697174f,0.697243f,0.697312f,0.697381f,0.697449f,0.697518f,0.697587f,0.697655f,0.697724f,0.697793f,0.697861f,0.69793f,0.697999f,0.698067f,0.698136f,0.698205f,0.698273f,0.698342f,0.698411f,0.698479f,0.698548f,0.698616f,0.698685f,0.698754f,0.698822f,0.698891f,0.698959f,0.699028f,0.699096f,0.699165f,0.699234f,0.699302f,0.699371f,0.699439f,0.699508f,0.699576f,0.699645f,0.699713f,0.699782f,0.69985f,0.699919f,0.699987f,0.700056f,0.700124f,0.700192f,0.700261f,0.700329f,0.700398f,0.700466f,0.700535f,0.700603f,0.700671f,0.70074f,0.700808f,0.700877f,0.700945f,0.701013f,0.701082f,0.70115f,0.701218f,0.701287f,0.701355f,0.701424f,0.701492f,0.70156f,0.701628f,0.701697f,0.701765f,0.701833f,0.701902f,0.70197f,0.702038f,0.702107f,0.702175f,0.702243f,0.702311f,0.70238f,0.702448f,0.702516f,0.702584f,0.702652f,0.702721f,0.702789f,0.702857f,0.702925f,0.702993f,0.703062f,0.70313f,0.703198f,0.703266f,0.703334f,0.703402f,0.703471f,0.703539f,0.703607f,0.703675f,0.703743f,0.703811f,0.703879f,0.703947f,0.704015f,0.704084f,0.704152f,0.70422f,0.704288f,0.704356f,0.704424f,0.704492f,0.70456f,0.704628f,0.704696f,0.704764f,0.704832f,0.7049f,0.704968f,0.705036f,0.705104f,0.705172f,0.70524f,0.705308f,0.705376f,0.705444f,0.705512f,0.70558f,0.705648f,0.705716f,0.705784f,0.705851f,0.705919f,0.705987f,0.706055f,0.706123f,0.706191f,0.706259f,0.706327f,0.706395f,0.706462f,0.70653f,0.706598f,0.706666f,0.706734f,0.706802f,0.706869f,0.706937f,0.707005f,0.707073f,0.707141f,0.707209f,0.707276f,0.707344f,0.707412f,0.70748f,0.707547f,0.707615f,0.707683f,0.707751f,0.707818f,0.707886f,0.707954f,0.708021f,0.708089f,0.708157f,0.708224f,0.708292f,0.70836f,0.708428f,0.708495f,0.708563f,0.708631f,0.708698f,0.708766f,0.708833f,0.708901f,0.708969f,0.709036f,0.709104f,0.709171f,0.709239f,0.709307f,0.709374f,0.709442f,0.709509f,0.709577f,0.709644f,0.709712f,0.70978f,0.709847f,0.709915f,0.709982f,0.71005f,0.710117f,0.710185f,0.710252f,0.71032f,0.710387f,0.710455f,0.710522f,0.71059f,0.710657f,0.710724f,0.710792f,0.710859f,0.710927f,0.710994f,0.711062f,0.711129f,0.711196f,0.711264f,0.711331f,0.711398f,0.711466f,0.711533f,0.711601f,0.711668f,0.711735f,0.711803f,0.71187f,0.711937f,0.712005f,0.712072f,0.712139f,0.712207f,0.712274f,0.712341f,0.712408f,0.712476f,0.712543f,0.71261f,0.712678f,0.712745f,0.712812f,0.712879f,0.712947f,0.713014f,0.713081f,0.713148f,0.713215f,0.713283f,0.71335f,0.713417f,0.713484f,0.713551f,0.713618f,0.713686f,0.713753f,0.71382f,0.713887f,0.713954f,0.714021f,0.714088f,0.714156f,0.714223f,0.71429f,0.714357f,0.714424f,0.714491f,0.714558f,0.714625f,0.714692f,0.714759f,0.714826f,0.714893f,0.71496f,0.715027f,0.715094f,0.715161f,0.715228f,0.715295f,0.715362f,0.715429f,0.715496f,0.715563f,0.71563f,0.715697f,0.715764f,0.715831f,0.715898f,0.715965f,0.716032f,0.716099f,0.716166f,0.716233f,0.7163f,0.716367f,0.716434f,0.7165f,0.716567f,0.716634f,0.716701f,0.716768f,0.716835f,0.716902f,0.716968f,0.717035f,0.717102f,0.717169f,0.717236f,0.717303f,0.717369f,0.717436f,0.717503f,0.71757f,0.717636f,0.717703f,0.71777f,0.717837f,0.717903f,0.71797f,0.718037f,0.718104f,0.71817f,0.718237f,0.718304f,0.71837f,0.718437f,0.718504f,0.718571f,0.718637f,0.718704f,0.718771f,0.718837f,0.718904f,0.71897f,0.719037f,0.719104f,0.71917f,0.719237f,0.719304f,0.71937f,0.719437f,0.719503f,0.71957f,0.719636f,0.719703f,0.71977f,0.719836f,0.719903f,0.719969f,0.720036f,0.720102f,0.720169f,0.720235f,0.720302f,0.720368f,0.720435f,0.720501f,0.720568f,0.720634f,0.720701f,0.720767f,0.720834f,0.7209f,0.720967f,0.721033f,0.721099f,0.721166f,0.721232f,0.721299f,0.721365f,0.721431f,0.721498f,0.721564f,0.721631f,0.721697f,0.721763f,0.72183f,0.721896f,0.721962f,0.722029f,0.722095f,0.722161f,0.722228f,0.722294f,0.72236f,0.722427f,0.722493f,0.722559f,0.722625f,0.722692f,0.722758f,0.722824f,0.72289f,0.722957f,0.723023f,0.723089f,0.723155f,0.723222f,0.723288f,0.723354f,0.72342f,0.723486f,0.723553f,0.723619f,0.723685f,0.723751f,0.723817f,0.723883f,0.72395f,0.724016f,0.724082f,0.724148f,0.724214f,0.72428f,0.724346f,0.724412f,0.724478f,0.724545f,0.724611f,0.724677f,0.724743f,0.724809f,0.724875f,0.724941f,0.725007f,0.725073f,0.725139f,0.725205f,0.725271f,0.725337f,0.725403f,0.725469f,0.725535f,0.725601f,0.725667f,0.725733f,0.725799f,0.725865f,0.725931f,0.725997f,0.726063f,0.726129f,0.726194f,0.72626f,0.726326f,0.726392f,0.726458f,0.726524f,0.72659f,0.726656f,0.726721f,0.726787f,0.726853f,0.726919f,0.726985f,0.727051f,0.727117f,0.727182f,0.727248f,0.727314f,0.72738f,0.727446f,0.727511f,0.727577f,0.727643f,0.727709f,0.727774f,0.72784f,0.727906f,0.727972f,0.728037f,0.728103f,0.728169f,0.728234f,0.7283f,0.728366f,0.728432f,0.728497f,0.728563f,0.728629f,0.728694f,0.72876f,0.728826f,0.728891f,0.728957f,0.729022f,0.729088f,0.729154f,0.729219f,0.729285f,0.729351f,0.729416f,0.729482f,0.729547f,0.729613f,0.729678f,0.729744f,0.729809f,0.729875f,0.729941f,0.730006f,0.730072f,0.730137f,0.730203f,0.730268f,0.730334f,0.730399f,0.730465f,0.73053f,0.730596f,0.730661f,0.730726f,0.730792f,0.730857f,0.730923f,0.730988f,0.731054f,0.731119f,0.731184f,0.73125f,0.731315f,0.731381f,0.731446f,0.731511f,0.731577f,0.731642f,0.731707f,0.731773f,0.731838f,0.731903f,0.731969f,0.732034f,0.732099f,0.732165f,0.73223f,0.732295f,0.732361f,0.732426f,0.732491f,0.732556f,0.732622f,0.732687f,0.732752f,0.732817f,0.732883f,0.732948f,0.733013f,0.733078f,0.733144f,0.733209f,0.733274f,0.733339f,0.733404f,0.733469f,0.733535f,0.7336f,0.733665f,0.73373f,0.733795f,0.73386f,0.733925f,0.73399f,0.734056f,0.734121f,0.734186f,0.734251f,0.734316f,0.734381f,0.734446f,0.734511f,0.734576f,0.734641f,0.734706f,0.734771f,0.734836f,0.734901f,0.734966f,0.735031f,0.735097f,0.735161f,0.735226f,0.735291f,0.735356f,0.735421f,0.735486f,0.735551f,0.735616f,0.735681f,0.735746f,0.735811f,0.735876f,0.735941f,0.736006f,0.736071f,0.736136f,0.736201f,0.736265f,0.73633f,0.736395f,0.73646f,0.736525f,0.73659f,0.736655f,0.736719f,0.736784f,0.736849f,0.736914f,0.736979f,0.737043f,0.737108f,0.737173f,0.737238f,0.737303f,0.737367f,0.737432f,0.737497f,0.737562f,0.737626f,0.737691f,0.737756f,0.737821f,0.737885f,0.73795f,0.738015f,0.738079f,0.738144f,0.738209f,0.738273f,0.738338f,0.738403f,0.738467f,0.738532f,0.738597f,0.738661f,0.738726f,0.73879f,0.738855f,0.73892f,0.738984f,0.739049f,0.739113f,0.739178f,0.739243f,0.739307f,0.739372f,0.739436f,0.739501f,0.739565f,0.73963f,0.739694f,0.739759f,0.739823f,0.739888f,0.739952f,0.740017f,0.740081f,0.740146f,0.74021f,0.740275f,0.740339f,0.740404f,0.740468f,0.740532f,0.740597f,0.740661f,0.740726f,0.74079f,0.740855f,0.740919f,0.740983f,0.741048f,0.741112f,0.741176f,0.741241f,0.741305f,0.741369f,0.741434f,0.741498f,0.741562f,0.741627f,0.741691f,0.741755f,0.74182f,0.741884f,0.741948f,0.742013f,0.742077f,0.742141f,0.742205f,0.74227f,0.742334f,0.742398f,0.742462f,0.742527f,0.742591f,0.742655f,0.742719f,0.742783f,0.742848f,0.742912f,0.742976f,0.74304f,0.743104f,0.743168f,0.743232f,0.743297f,0.743361f,0.743425f,0.743489f,0.743553f,0.743617f,0.743681f,0.743745f,0.74381f,0.743874f,0.743938f,0.744002f,0.744066f,0.74413f,0.744194f,0.744258f,0.744322f,0.744386f,0.74445f,0.744514f,0.744578f,0.744642f,0.744706f,0.74477f,0.744834f,0.744898f,0.744962f,0.745026f,0.74509f,0.745154f,0.745218f,0.745282f,0.745346f,0.745409f,0.745473f,0.745537f,0.745601f,0.745665f,0.745729f,0.745793f,0.745857f,0.74592f,0.745984f,0.746048f,0.746112f,0.746176f,0.74624f,0.746303f,0.746367f,0.746431f,0.746495f,0.746559f,0.746623f,0.746686f,0.74675f,0.746814f,0.746878f,0.746941f,0.747005f,0.747069f,0.747132f,0.747196f,0.74726f,0.747324f,0.747387f,0.747451f,0.747515f,0.747578f,0.747642f,0.747706f,0.747769f,0.747833f,0.747897f,0.74796f,0.748024f,0.748088f,0.748151f,0.748215f,0.748278f,0.748342f,0.748406f,0.748469f,0.748533f,0.748596f,0.74866f,0.748723f,0.748787f,0.748851f,0.748914f,0.748978f,0.749041f,0.749105f,0.749168f,0.749232f,0.749295f,0.749359f,0.749422f,0.749486f,0.749549f,0.749613f,0.749676f,0.749739f,0.749803f,0.749866f,0.74993f,0.749993f,0.750057f,0.75012f,0.750183f,0.750247f,0.75031f,0.750374f,0.750437f,0.7505f,0.750564f,0.750627f,0.75069f,0.750754f,0.750817f,0.75088f,0.750944f,0.751007f,0.75107f,0.751134f,0.751197f,0.75126f,0.751323f,0.751387f,0.75145f,0.751513f,0.751576f,0.75164f,0.751703f,0.751766f,0.751829f,0.751893f,0.751956f,0.752019f,0.752082f,0.752145f,0.752208f,0.752272f,0.752335f,0.752398f,0.752461f,0.752524f,0.752587f,0.75265f,0.752714f,0.752777f,0.75284f,0.752903f,0.752966f,0.753029f,0.753092f,0.753155f,0.753218f,0.753281f,0.753344f,0.753408f,0.753471f,0.753534f,0.753597f,0.75366f,0.753723f,0.753786f,0.753849f,0.753912f,0.753975f,0.754038f,0.754101f,0.754164f,0.754226f,0.754289f,0.754352f,0.754415f,0.754478f,0.754541f,0.754604f,0.754667f,0.75473f,0.754793f,0.754856f,0.754919f,0.754981f,0.755044f,0.755107f,0.75517f,0.755233f,0.755296f,0.755358f,0.755421f,0.755484f,0.755547f,0.75561f,0.755673f,0.755735f,0.755798f,0.755861f,0.755924f,0.755986f,0.756049f,0.756112f,0.756175f,0.756237f,0.7563f,0.756363f,0.756425f,0.756488f,0.756551f,0.756614f,0.756676f,0.756739f,0.756802f,0.756864f,0.756927f,0.75699f,0.757052f,0.757115f,0.757178f,0.75724f,0.757303f,0.757365f,0.757428f,0.757491f,0.757553f,0.757616f,0.757678f,0.757741f,0.757803f,0.757866f,0.757929f,0.757991f,0.758054f,0.758116f,0.758179f,0.758241f,0.758304f,0.758366f,0.758429f,0.758491f,0.758554f,0.758616f,0.758679f,0.758741f,0.758803f,0.758866f,0.758928f,0.758991f,0.759053f,0.759116f,0.759178f,0.75924f,0.759303f,0.759365f,0.759428f,0.75949f,0.759552f,0.759615f,0.759677f,0.759739f,0.759802f,0.759864f,0.759926f,0.759989f,0.760051f,0.760113f,0.760176f,0.760238f,0.7603f,0.760362f,0.760425f,0.760487f,0.760549f,0.760611f,0.760674f,0.760736f,0.760798f,0.76086f,0.760923f,0.760985f,0.761047f,0.761109f,0.761171f,0.761233f,0.761296f,0.761358f,0.76142f,0.761482f,0.761544f,0.761606f,0.761669f,0.761731f,0.761793f,0.761855f,0.761917f,0.761979f,0.762041f,0.762103f,0.762165f,0.762227f,0.762289f,0.762351f,0.762414f,0.762475f,0.762538f,0.7626f,0.762662f,0.762724f,0.762786f,0.762848f,0.76291f,0.762972f,0.763034f,0.763095f,0.763157f,0.763219f,0.763281f,0.763343f,0.763405f,0.763467f,0.763529f,0.763591f,0.763653f,0.763715f,0.763777f,0.763839f,0.7639f,0.763962f,0.764024f,0.764086f,0.764148f,0.76421f,0.764271f,0.764333f,0.764395f,0.764457f,0.764519f,0.764581f,0.764642f,0.764704f,0.764766f,0.764828f,0.764889f,0.764951f,0.765013f,0.765075f,0.765136f,0.765198f,0.76526f,0.765322f,0.765383f,0.765445f,0.765507f,0.765568f,0.76563f,0.765692f,0.765753f,0.765815f,0.765877f,0.765938f,0.766f,0.766062f,0.766123f,0.766185f,0.766246f,0.766308f,0.76637f,0.766431f,0.766493f,0.766554f,0.766616f,0.766677f,0.766739f,0.766801f,0.766862f,0.766924f,0.766985f,0.767047f,0.767108f,0.76717f,0.767231f,0.767293f,0.767354f,0.767416f,0.767477f,0.767539f,0.7676f,0.767661f,0.767723f,0.767784f,0.767846f,0.767907f,0.767969f,0.76803f,0.768091f,0.768153f,0.768214f,0.768275f,0.768337f,0.768398f,0.76846f,0.768521f,0.768582f,0.768644f,0.768705f,0.768766f,0.768827f,0.768889f,0.76895f,0.769011f,0.769073f,0.769134f,0.769195f,0.769257f,0.769318f,0.769379f,0.76944f,0.769502f,0.769563f,0.769624f,0.769685f,0.769746f,0.769808f,0.769869f,0.76993f,0.769991f,0.770052f,0.770113f,0.770175f,0.770236f,0.770297f,0.770358f,0.770419f,0.77048f,0.770541f,0.770602f,0.770664f,0.770725f,0.770786f,0.770847f,0.770908f,0.770969f,0.77103f,0.771091f,0.771152f,0.771213f,0.771274f,0.771335f,0.771396f,0.771457f,0.771518f,0.771579f,0.77164f,0.771701f,0.771762f,0.771823f,0.771884f,0.771945f,0.772006f,0.772067f,0.772128f,0.772189f,0.77225f,0.772311f,0.772371f,0.772432f,0.772493f,0.772554f,0.772615f,0.772676f,0.772737f,0.772798f,0.772858f,0.772919f,0.77298f,0.773041f,0.773102f,0.773163f,0.773223f,0.773284f,0.773345f,0.773406f,0.773466f,0.773527f,0.773588f,0.773649f,0.773709f,0.77377f,0.773831f,0.773892f,0.773952f,0.774013f,0.774074f,0.774134f,0.774195f,0.774256f,0.774316f,0.774377f,0.774438f,0.774498f,0.774559f,0.77462f,0.77468f,0.774741f,0.774802f,0.774862f,0.774923f,0.774983f,0.775044f,0.775105f,0.775165f,0.775226f,0.775286f,0.775347f,0.775407f,0.775468f,0.775528f,0.775589f,0.775649f,0.77571f,0.77577f,0.775831f,0.775891f,0.775952f,0.776012f,0.776073f,0.776133f,0.776194f,0.776254f,0.776315f,0.776375f,0.776435f,0.776496f,0.776556f,0.776617f,0.776677f,0.776738f,0.776798f,0.776858f,0.776919f,0.776979f,0.777039f,0.7771f,0.77716f,0.77722f,0.777281f,0.777341f,0.777401f,0.777462f,0.777522f,0.777582f,0.777642f,0.777703f,0.777763f,0.777823f,0.777884f,0.777944f,0.778004f,0.778064f,0.778124f,0.778185f,0.778245f,0.778305f,0.778365f,0.778426f,0.778486f,0.778546f,0.778606f,0.778666f,0.778726f,0.778786f,0.778847f,0.778907f,0.778967f,0.779027f,0.779087f,0.779147f,0.779207f,0.779267f,0.779327f,0.779388f,0.779448f,0.779508f,0.779568f,0.779628f,0.779688f,0.779748f,0.779808f,0.779868f,0.779928f,0.779988f,0.780048f,0.780108f,0.780168f,0.780228f,0.780288f,0.780348f,0.780408f,0.780468f,0.780528f,0.780587f,0.780647f,0.780707f,0.780767f,0.780827f,0.780887f,0.780947f,0.781007f,0.781067f,0.781126f,0.781186f,0.781246f,0.781306f,0.781366f,0.781426f,0.781486f,0.781545f,0.781605f,0.781665f,0.781725f,0.781785f,0.781844f,0.781904f,0.781964f,0.782024f,0.782083f,0.782143f,0.782203f,0.782263f,0.782322f,0.782382f,0.782442f,0.782501f,0.782561f,0.782621f,0.78268f,0.78274f,0.7828f,0.782859f,0.782919f,0.782979f,0.783038f,0.783098f,0.783158f,0.783217f,0.783277f,0.783336f,0.783396f,0.783456f,0.783515f,0.783575f,0.783634f,0.783694f,0.783753f,0.783813f,0.783872f,0.783932f,0.783992f,0.784051f,0.784111f,0.78417f,0.78423f,0.784289f,0.784348f,0.784408f,0.784467f,0.784527f,0.784586f,0.784646f,0.784705f,0.784765f,0.784824f,0.784883f,0.784943f,0.785002f,0.785062f,0.785121f,0.78518f,0.78524f,0.785299f,0.785358f,0.785418f,0.785477f,0.785537f,0.785596f,0.785655f,0.785714f,0.785774f,0.785833f,0.785892f,0.785952f,0.786011f,0.78607f,0.786129f,0.786189f,0.786248f,0.786307f,0.786366f,0.786426f,0.786485f,0.786544f,0.786603f,0.786662f,0.786722f,0.786781f,0.78684f,0.786899f,0.786958f,0.787017f,0.787077f,0.787136f,0.787195f,0.787254f,0.787313f,0.787372f,0.787431f,0.78749f,0.787549f,0.787609f,0.787668f,0.787727f,0.787786f,0.787845f,0.787904f,0.787963f,0.788022f,0.788081f,0.78814f,0.788199f,0.788258f,0.788317f,0.788376f,0.788435f,0.788494f,0.788553f,0.788612f,0.788671f,0.78873f,0.788789f,0.788848f,0.788906f,0.788965f,0.789024f,0.789083f,0.789142f,0.789201f,0.78926f,0.789319f,0.789378f,0.789436f,0.789495f,0.789554f,0.789613f,0.789672f,0.789731f,0.789789f,0.789848f,0.789907f,0.789966f,0.790025f,0.790083f,0.790142f,0.790201f,0.79026f,0.790318f,0.790377f,0.790436f,0.790495f,0.790553f,0.790612f,0.790671f,0.790729f,0.790788f,0.790847f,0.790905f,0.790964f,0.791023f,0.791081f,0.79114f,0.791199f,0.791257f,0.791316f,0.791375f,0.791433f,0.791492f,0.79155f,0.791609f,0.791667f,0.791726f,0.791785f,0.791843f,0.791902f,0.79196f,0.792019f,0.792077f,0.792136f,0.792194f,0.792253f,0.792311f,0.79237f,0.792428f,0.792487f,0.792545f,0.792604f,0.792662f,0.792721f,0.792779f,0.792838f,0.792896f,0.792954f,0.793013f,0.793071f,0.79313f,0.793188f,0.793246f,0.793305f,0.793363f,0.793421f,0.79348f,0.793538f,0.793597f,0.793655f,0.793713f,0.793771f,0.79383f,0.793888f,0.793946f,0.794005f,0.794063f,0.794121f,0.794179f,0.794238f,0.794296f,0.794354f,0.794412f,0.794471f,0.794529f,0.794587f,0.794645f,0.794703f,0.794762f,0.79482f,0.794878f,0.794936f,0.794994f,0.795053f,0.795111f,0.795169f,0.795227f,0.795285f,0.795343f,0.795401f,0.795459f,0.795518f,0.795576f,0.795634f,0.795692f,0.79575f,0.795808f,0.795866f,0.795924f,0.795982f,0.79604f,0.796098f,0.796156f,0.796214f,0.796272f,0.79633f,0.796388f,0.796446f,0.796504f,0.796562f,0.79662f,0.796678f,0.796736f,0.796794f,0.796852f,0.79691f,0.796968f,0.797025f,0.797083f,0.797141f,0.797199f,0.797257f,0.797315f,0.797373f,0.797431f,0.797488f,0.797546f,0.797604f,0.797662f,0.79772f,0.797778f,0.797835f,0.797893f,0.797951f,0.798009f,0.798067f,0.798124f,0.798182f,0.79824f,0.798298f,0.798355f,0.798413f,0.798471f,0.798528f,0.798586f,0.798644f,0.798702f,0.798759f,0.798817f,0.798875f,0.798932f,0.79899f,0.799048f,0.799105f,0.799163f,0.799221f,0.799278f,0.799336f,0.799393f,0.799451f,0.799509f,0.799566f,0.799624f,0.799681f,0.799739f,0.799796f,0.799854f,0.799911f,0.799969f,0.800026f,0.800084f,0.800142f,0.800199f,0.800256f,0.800314f,0.800371f,0.800429f,0.800486f,0.800544f,0.800601f,0.800659f,0.800716f,0.800774f,0.800831f,0.800888f,0.800946f,0.801003f,0.801061f,0.801118f,0.801175f,0.801233f,0.80129f,0.801347f,0.801405f,0.801462f,0.80152f,0.801577f,0.801634f,0.801691f,0.801749f,0.801806f,0.801863f,0.801921f,0.801978f,0.802035f,0.802092f,0.80215f,0.802207f,0.802264f,0.802321f,0.802379f,0.802436f,0.802493f,0.80255f,0.802607f,0.802665f,0.802722f,0.802779f,0.802836f,0.802893f,0.802951f,0.803008f,0.803065f,0.803122f,0.803179f,0.803236f,0.803293f,0.80335f,0.803407f,0.803464f,0.803522f,0.803579f,0.803636f,0.803693f,0.80375f,0.803807f,0.803864f,0.803921f,0.803978f,0.804035f,0.804092f,0.804149f,0.804206f,0.804263f,0.80432f,0.804377f,0.804434f,0.804491f,0.804548f,0.804605f,0.804662f,0.804718f,0.804775f,0.804832f,0.804889f,0.804946f,0.805003f,0.80506f,0.805117f,0.805174f,0.80523f,0.805287f,0.805344f,0.805401f,0.805458f,0.805515f,0.805571f,0.805628f,0.805685f,0.805742f,0.805799f,0.805855f,0.805912f,0.805969f,0.806026f,0.806082f,0.806139f,0.806196f,0.806252f,0.806309f,0.806366f,0.806423f,0.806479f,0.806536f,0.806593f,0.806649f,0.806706f,0.806763f,0.806819f,0.806876f,0.806933f,0.806989f,0.807046f,0.807102f,0.807159f,0.807216f,0.807272f,0.807329f,0.807385f,0.807442f,0.807498f,0.807555f,0.807611f,0.807668f,0.807725f,0.807781f,0.807838f,0.807894f,0.807951f,0.808007f,0.808064f,0.80812f,0.808177f,0.808233f,0.808289f,0.808346f,0.808402f,0.808459f,0.808515f,0.808572f,0.808628f,0.808684f,0.808741f,0.808797f,0.808854f,0.80891f,0.808966f,0.809023f,0.809079f,0.809135f,0.809192f,0.809248f,0.809304f,0.809361f,0.809417f,0.809473f,0.809529f,0.809586f,0.809642f,0.809698f,0.809755f,0.809811f,0.809867f,0.809923f,0.80998f,0.810036f,0.810092f,0.810148f,0.810204f,0.810261f,0.810317f,0.810373f,0.810429f,0.810485f,0.810541f,0.810598f,0.810654f,0.81071f,0.810766f,0.810822f,0.810878f,0.810934f,0.81099f,0.811047f,0.811103f,0.811159f,0.811215f,0.811271f,0.811327f,0.811383f,0.811439f,0.811495f,0.811551f,0.811607f,0.811663f,0.811719f,0.811775f,0.811831f,0.811887f,0.811943f,0.811999f,0.812055f,0.812111f,0.812167f,0.812223f,0.812279f,0.812334f,0.81239f,0.812446f,0.812502f,0.812558f,0.812614f,0.81267f,0.812726f,0.812782f,0.812837f,0.812893f,0.812949f,0.813005f,0.813061f,0.813117f,0.813172f,0.813228f,0.813284f,0.81334f,0.813395f,0.813451f,0.813507f,0.813563f,0.813618f,0.813674f,0.81373f,0.813786f,0.813841f,0.813897f,0.813953f,0.814008f,0.814064f,0.81412f,0.814176f,0.814231f,0.814287f,0.814342f,0.814398f,0.814454f,0.814509f,0.814565f,0.814621f,0.814676f,0.814732f,0.814787f,0.814843f,0.814899f,0.814954f,0.81501f,0.815065f,0.815121f,0.815176f,0.815232f,0.815287f,0.815343f,0.815398f,0.815454f,0.815509f,0.815565f,0.81562f,0.815676f,0.815731f,0.815787f,0.815842f,0.815898f,0.815953f,0.816008f,0.816064f,0.816119f,0.816175f,0.81623f,0.816285f,0.816341f,0.816396f,0.816452f,0.816507f,0.816562f,0.816618f,0.816673f,0.816728f,0.816784f,0.816839f,0.816894f,0.816949f,0.817005f,0.81706f,0.817115f,0.817171f,0.817226f,0.817281f,0.817336f,0.817392f,0.817447f,0.817502f,0.817557f,0.817612f,0.817668f,0.817723f,0.817778f,0.817833f,0.817888f,0.817944f,0.817999f,0.818054f,0.818109f,0.818164f,0.818219f,0.818274f,0.818329f,0.818385f,0.81844f,0.818495f,0.81855f,0.818605f,0.81866f,0.818715f,0.81877f,0.818825f,0.81888f,0.818935f,0.81899f,0.819045f,0.8191f,0.819155f,0.81921f,0.819265f,0.81932f,0.819375f,0.81943f,0.819485f,0.81954f,0.819595f,0.81965f,0.819705f,0.81976f,0.819814f,0.819869f,0.819924f,0.819979f,0.820034f,0.820089f,0.820144f,0.820199f,0.820253f,0.820308f,0.820363f,0.820418f,0.820473f,0.820527f,0.820582f,0.820637f,0.820692f,0.820747f,0.820801f,0.820856f,0.820911f,0.820966f,0.82102f,0.821075f,0.82113f,0.821185f,0.821239f,0.821294f,0.821349f,0.821403f,0.821458f,0.821513f,0.821567f,0.821622f,0.821677f,0.821731f,0.821786f,0.821841f,0.821895f,0.82195f,0.822004f,0.822059f,0.822114f,0.822168f,0.822223f,0.822277f,0.822332f,0.822386f,0.822441f,0.822496f,0.82255f,0.822605f,0.822659f,0.822714f,0.822768f,0.822823f,0.822877f,0.822932f,0.822986f,0.82304f,0.823095f,0.823149f,0.823204f,0.823258f,0.823313f,0.823367f,0.823421f,0.823476f,0.82353f,0.823585f,0.823639f,0.823693f,0.823748f,0.823802f,0.823856f,0.823911f,0.823965f,0.824019f,0.824074f,0.824128f,0.824182f,0.824237f,0.824291f,0.824345f,0.824399f,0.824454f,0.824508f,0.824562f,0.824616f,0.824671f,0.824725f,0.824779f,0.824833f,0.824888f,0.824942f,0.824996f,0.82505f,0.825104f,0.825158f,0.825213f,0.825267f,0.825321f,0.825375f,0.825429f,0.825483f,0.825537f,0.825591f,0.825646f,0.8257f,0.825754f,0.825808f,0.825862f,0.825916f,0.82597f,0.826024f,0.826078f,0.826132f,0.826186f,0.82624f,0.826294f,0.826348f,0.826402f,0.826456f,0.82651f,0.826564f,0.826618f,0.826672f,0.826726f,0.82678f,0.826834f,0.826888f,0.826942f,0.826995f,0.827049f,0.827103f,0.827157f,0.827211f,0.827265f,0.827319f,0.827373f,0.827426f,0.82748f,0.827534f,0.827588f,0.827642f,0.827695f,0.827749f,0.827803f,0.827857f,0.827911f,0.827964f,0.828018f,0.828072f,0.828126f,0.828179f,0.828233f,0.828287f,0.828341f,0.828394f,0.828448f,0.828502f,0.828555f,0.828609f,0.828663f,0.828716f,0.82877f,0.828824f,0.828877f,0.828931f,0.828985f,0.829038f,0.829092f,0.829145f,0.829199f,0.829253f,0.829306f,0.82936f,0.829413f,0.829467f,0.82952f,0.829574f,0.829627f,0.829681f,0.829735f,0.829788f,0.829841f,0.829895f,0.829948f,0.830002f,0.830055f,0.830109f,0.830162f,0.830216f,0.830269f,0.830323f,0.830376f,0.830429f,0.830483f,0.830536f,0.83059f,0.830643f,0.830697f,0.83075f,0.830803f,0.830857f,0.83091f,0.830963f,0.831017f,0.83107f,0.831123f,0.831177f,0.83123f,0.831283f,0.831336f,0.83139f,0.831443f,0.831496f,0.83155f,0.831603f,0.831656f,0.831709f,0.831762f,0.831816f,0.831869f,0.831922f,0.831975f,0.832029f,0.832082f,0.832135f,0.832188f,0.832241f,0.832294f,0.832347f,0.832401f,0.832454f,0.832507f,0.83256f,0.832613f,0.832666f,0.832719f,0.832772f,0.832825f,0.832878f,0.832932f,0.832985f,0.833038f,0.833091f,0.833144f,0.833197f,0.83325f,0.833303f,0.833356f,0.833409f,0.833462f,0.833515f,0.833568f,0.833621f,0.833674f,0.833726f,0.833779f,0.833832f,0.833885f,0.833938f,0.833991f,0.834044f,0.834097f,0.83415f,0.834203f,0.834255f,0.834308f,0.834361f,0.834414f,0.834467f,0.83452f,0.834572f,0.834625f,0.834678f,0.834731f,0.834784f,0.834836f,0.834889f,0.834942f,0.834995f,0.835048f,0.8351f,0.835153f,0.835206f,0.835258f,0.835311f,0.835364f,0.835417f,0.835469f,0.835522f,0.835575f,0.835627f,0.83568f,0.835733f,0.835785f,0.835838f,0.835891f,0.835943f,0.835996f,0.836048f,0.836101f,0.836154f,0.836206f,0.836259f,0.836311f,0.836364f,0.836416f,0.836469f,0.836521f,0.836574f,0.836627f,0.836679f,0.836732f,0.836784f,0.836837f,0.836889f,0.836941f,0.836994f,0.837046f,0.837099f,0.837151f,0.837204f,0.837256f,0.837309f,0.837361f,0.837413f,0.837466f,0.837518f,0.837571f,0.837623f,0.837675f,0.837728f,0.83778f,0.837832f,0.837885f,0.837937f,0.837989f,0.838042f,0.838094f,0.838146f,0.838199f,0.838251f,0.838303f,0.838355f,0.838408f,0.83846f,0.838512f,0.838564f,0.838617f,0.838669f,0.838721f,0.838773f,0.838825f,0.838878f,0.83893f,0.838982f,0.839034f,0.839086f,0.839139f,0.839191f,0.839243f,0.839295f,0.839347f,0.839399f,0.839451f,0.839503f,0.839555f,0.839607f,0.83966f,0.839712f,0.839764f,0.839816f,0.839868f,0.83992f,0.839972f,0.840024f,0.840076f,0.840128f,0.84018f,0.840232f,0.840284f,0.840336f,0.840388f,0.84044f,0.840492f,0.840544f,0.840596f,0.840648f,0.840699f,0.840751f,0.840803f,0.840855f,0.840907f,0.840959f,0.841011f,0.841063f,0.841115f,0.841166f,0.841218f,0.84127f,0.841322f,0.841374f,0.841426f,0.841477f,0.841529f,0.841581f,0.841633f,0.841684f,0.841736f,0.841788f,0.84184f,0.841891f,0.841943f,0.841995f,0.842047f,0.842098f,0.84215f,0.842202f,0.842253f,0.842305f,0.842357f,0.842408f,0.84246f,0.842512f,0.842563f,0.842615f,0.842667f,0.842718f,0.84277f,0.842822f,0.842873f,0.842925f,0.842976f,0.843028f,0.843079f,0.843131f,0.843182f,0.843234f,0.843286f,0.843337f,0.843389f,0.84344f,0.843492f,0.843543f,0.843595f,0.843646f,0.843698f,0.843749f,0.8438f,0.843852f,0.843903f,0.843955f,0.844006f,0.844058f,0.844109f,0.84416f,0.844212f,0.844263f,0.844315f,0.844366f,0.844417f,0.844469f,0.84452f,0.844571f,0.844623f,0.844674f,0.844725f,0.844777f,0.844828f,0.844879f,0.844931f,0.844982f,0.845033f,0.845084f,0.845136f,0.845187f,0.845238f,0.845289f,0.845341f,0.845392f,0.845443f,0.845494f,0.845545f,0.845596f,0.845648f,0.845699f,0.84575f,0.845801f,0.845852f,0.845903f,0.845955f,0.846006f,0.846057f,0.846108f,0.846159f,0.84621f,0.846261f,0.846312f,0.846363f,0.846414f,0.846465f,0.846516f,0.846568f,0.846619f,0.84667f,0.846721f,0.846772f,0.846823f,0.846874f,0.846925f,0.846976f,0.847026f,0.847077f,0.847128f,0.847179f,0.84723f,0.847281f,0.847332f,0.847383f,0.847434f,0.847485f,0.847536f,0.847587f,0.847637f,0.847688f,0.847739f,0.84779f,0.847841f,0.847892f,0.847943f,0.847993f,0.848044f,0.848095f,0.848146f,0.848197f,0.848247f,0.848298f,0.848349f,0.8484f,0.84845f,0.848501f,0.848552f,0.848603f,0.848653f,0.848704f,0.848755f,0.848805f,0.848856f,0.848907f,0.848957f,0.849008f,0.849059f,0.849109f,0.84916f,0.849211f,0.849261f,0.849312f,0.849362f,0.849413f,0.849464f,0.849514f,0.849565f,0.849615f,0.849666f,0.849716f,0.849767f,0.849818f,0.849868f,0.849919f,0.849969f,0.85002f,0.85007f,0.850121f,0.850171f,0.850222f,0.850272f,0.850323f,0.850373f,0.850423f,0.850474f,0.850524f,0.850575f,0.850625f,0.850676f,0.850726f,0.850776f,0.850827f,0.850877f,0.850927f,0.850978f,0.851028f,0.851079f,0.851129f,0.851179f,0.851229f,0.85128f,0.85133f,0.85138f,0.851431f,0.851481f,0.851531f,0.851581f,0.851632f,0.851682f,0.851732f,0.851782f,0.851833f,0.851883f,0.851933f,0.851983f,0.852033f,0.852084f,0.852134f,0.852184f,0.852234f,0.852284f,0.852334f,0.852385f,0.852435f,0.852485f,0.852535f,0.852585f,0.852635f,0.852685f,0.852735f,0.852785f,0.852835f,0.852886f,0.852936f,0.852986f,0.853036f,0.853086f,0.853136f,0.853186f,0.853236f,0.853286f,0.853336f,0.853386f,0.853436f,0.853486f,0.853536f,0.853586f,0.853635f,0.853685f,0.853735f,0.853785f,0.853835f,0.853885f,0.853935f,0.853985f,0.854035f,0.854085f,0.854135f,0.854184f,0.854234f,0.854284f,0.854334f,0.854384f,0.854433f,0.854483f,0.854533f,0.854583f,0.854633f,0.854682f,0.854732f,0.854782f,0.854832f,0.854881f,0.854931f,0.854981f,0.855031f,0.85508f,0.85513f,0.85518f,0.855229f,0.855279f,0.855329f,0.855379f,0.855428f,0.855478f,0.855527f,0.855577f,0.855627f,0.855676f,0.855726f,0.855776f,0.855825f,0.855875f,0.855924f,0.855974f,0.856023f,0.856073f,0.856123f,0.856172f,0.856222f,0.856271f,0.856321f,0.85637f,0.85642f,0.856469f,0.856519f,0.856568f,0.856618f,0.856667f,0.856717f,0.856766f,0.856815f,0.856865f,0.856914f,0.856964f,0.857013f,0.857062f,0.857112f,0.857161f,0.857211f,0.85726f,0.857309f,0.857359f,0.857408f,0.857457f,0.857507f,0.857556f,0.857605f,0.857655f,0.857704f,0.857753f,0.857803f,0.857852f,0.857901f,0.85795f,0.858f,0.858049f,0.858098f,0.858147f,0.858196f,0.858246f,0.858295f,0.858344f,0.858393f,0.858442f,0.858492f,0.858541f,0.85859f,0.858639f,0.858688f,0.858737f,0.858787f,0.858836f,0.858885f,0.858934f,0.858983f,0.859032f,0.859081f,0.85913f,0.859179f,0.859228f,0.859277f,0.859326f,0.859375f,0.859424f,0.859473f,0.859522f,0.859571f,0.85962f,0.859669f,0.859718f,0.859767f,0.859816f,0.859865f,0.859914f,0.859963f,0.860012f,0.860061f,0.86011f,0.860159f,0.860208f,0.860256f,0.860305f,0.860354f,0.860403f,0.860452f,0.860501f,0.86055f,0.860599f,0.860647f,0.860696f,0.860745f,0.860794f,0.860843f,0.860891f,0.86094f,0.860989f,0.861038f,0.861086f,0.861135f,0.861184f,0.861233f,0.861281f,0.86133f,0.861379f,0.861427f,0.861476f,0.861525f,0.861573f,0.861622f,0.861671f,0.861719f,0.861768f,0.861817f,0.861865f,0.861914f,0.861963f,0.862011f,0.86206f,0.862108f,0.862157f,0.862206f,0.862254f,0.862303f,0.862351f,0.8624f,0.862448f,0.862497f,0.862545f,0.862594f,0.862642f,0.862691f,0.862739f,0.862788f,0.862836f,0.862885f,0.862933f,0.862981f,0.86303f,0.863078f,0.863127f,0.863175f,0.863224f,0.863272f,0.86332f,0.863369f,0.863417f,0.863466f,0.863514f,0.863562f,0.863611f,0.863659f,0.863707f,0.863756f,0.863804f,0.863852f,0.8639f,0.863949f,0.863997f,0.864045f,0.864094f,0.864142f,0.86419f,0.864238f,0.864286f,0.864335f,0.864383f,0.864431f,0.864479f,0.864528f,0.864576f,0.864624f,0.864672f,0.86472f,0.864768f,0.864816f,0.864865f,0.864913f,0.864961f,0.865009f,0.865057f,0.865105f,0.865153f,0.865201f,0.865249f,0.865297f,0.865345f,0.865394f,0.865442f,0.86549f,0.865538f,0.865586f,0.865634f,0.865682f,0.86573f,0.865778f,0.865826f,0.865874f,0.865921f,0.865969f,0.866017f,0.866065f,0.866113f,0.866161f,0.866209f,0.866257f,0.866305f,0.866353f,0.866401f,0.866449f,0.866496f,0.866544f,0.866592f,0.86664f,0.866688f,0.866736f,0.866783f,0.866831f,0.866879f,0.866927f,0.866975f,0.867022f,0.86707f,0.867118f,0.867166f,0.867213f,0.867261f,0.867309f,0.867357f,0.867404f,0.867452f,0.8675f,0.867547f,0.867595f,0.867643f,0.86769f,0.867738f,0.867786f,0.867833f,0.867881f,0.867929f,0.867976f,0.868024f,0.868071f,0.868119f,0.868167f,0.868214f,0.868262f,0.868309f,0.868357f,0.868404f,0.868452f,0.868499f,0.868547f,0.868594f,0.868642f,0.868689f,0.868737f,0.868784f,0.868832f,0.868879f,0.868927f,0.868974f,0.869022f,0.869069f,0.869117f,0.869164f,0.869211f,0.869259f,0.869306f,0.869354f,0.869401f,0.869448f,0.869496f,0.869543f,0.86959f,0.869638f,0.869685f,0.869732f,0.86978f,0.869827f,0.869874f,0.869922f,0.869969f,0.870016f,0.870063f,0.870111f,0.870158f,0.870205f,0.870252f,0.8703f,0.870347f,0.870394f,0.870441f,0.870488f,0.870536f,0.870583f,0.87063f,0.870677f,0.870724f,0.870771f,0.870818f,0.870866f,0.870913f,0.87096f,0.871007f,0.871054f,0.871101f,0.871148f,0.871195f,0.871242f,0.871289f,0.871337f,0.871384f,0.871431f,0.871478f,0.871525f,0.871572f,0.871619f,0.871666f,0.871713f,0.87176f,0.871807f,0.871853f,0.8719f,0.871947f,0.871994f,0.872041f,0.872088f,0.872135f,0.872182f,0.872229f,0.872276f,0.872323f,0.87237f,0.872416f,0.872463f,0.87251f,0.872557f,0.872604f,0.872651f,0.872697f,0.872744f,0.872791f,0.872838f,0.872885f,0.872931f,0.872978f,0.873025f,0.873072f,0.873118f,0.873165f,0.873212f,0.873259f,0.873305f,0.873352f,0.873399f,0.873445f,0.873492f,0.873539f,0.873585f,0.873632f,0.873679f,0.873725f,0.873772f,0.873819f,0.873865f,0.873912f,0.873958f,0.874005f,0.874052f,0.874098f,0.874145f,0.874191f,0.874238f,0.874284f,0.874331f,0.874377f,0.874424f,0.87447f,0.874517f,0.874563f,0.87461f,0.874656f,0.874703f,0.874749f,0.874796f,0.874842f,0.874889f,0.874935f,0.874982f,0.875028f,0.875074f,0.875121f,0.875167f,0.875214f,0.87526f,0.875306f,0.875353f,0.875399f,0.875445f,0.875492f,0.875538f,0.875584f,0.875631f,0.875677f,0.875723f,0.875769f,0.875816f,0.875862f,0.875908f,0.875955f,0.876001f,0.876047f,0.876093f,0.876139f,0.876186f,0.876232f,0.876278f,0.876324f,0.87637f,0.876417f,0.876463f,0.876509f,0.876555f,0.876601f,0.876647f,0.876693f,0.87674f,0.876786f,0.876832f,0.876878f,0.876924f,0.87697f,0.877016f,0.877062f,0.877108f,0.877154f,0.8772f,0.877246f,0.877292f,0.877338f,0.877384f,0.87743f,0.877476f,0.877522f,0.877568f,0.877614f,0.87766f,0.877706f,0.877752f,0.877798f,0.877844f,0.87789f,0.877936f,0.877982f,0.878028f,0.878073f,0.878119f,0.878165f,0.878211f,0.878257f,0.878303f,0.878349f,0.878394f,0.87844f,0.878486f,0.878532f,0.878578f,0.878623f,0.878669f,0.878715f,0.878761f,0.878806f,0.878852f,0.878898f,0.878944f,0.878989f,0.879035f,0.879081f,0.879126f,0.879172f,0.879218f,0.879264f,0.879309f,0.879355f,0.8794f,0.879446f,0.879492f,0.879537f,0.879583f,0.879629f,0.879674f,0.87972f,0.879765f,0.879811f,0.879857f,0.879902f,0.879948f,0.879993f,0.880039f,0.880084f,0.88013f,0.880175f,0.880221f,0.880266f,0.880312f,0.880357f,0.880403f,0.880448f,0.880494f,0.880539f,0.880584f,0.88063f,0.880675f,0.880721f,0.880766f,0.880812f,0.880857f,0.880902f,0.880948f,0.880993f,0.881038f,0.881084f,0.881129f,0.881174f,0.88122f,0.881265f,0.88131f,0.881356f,0.881401f,0.881446f,0.881492f,0.881537f,0.881582f,0.881627f,0.881673f,0.881718f,0.881763f,0.881808f,0.881853f,0.881899f,0.881944f,0.881989f,0.882034f,0.882079f,0.882125f,0.88217f,0.882215f,0.88226f,0.882305f,0.88235f,0.882395f,0.88244f,0.882486f,0.882531f,0.882576f,0.882621f,0.882666f,0.882711f,0.882756f,0.882801f,0.882846f,0.882891f,0.882936f,0.882981f,0.883026f,0.883071f,0.883116f,0.883161f,0.883206f,0.883251f,0.883296f,0.883341f,0.883386f,0.883431f,0.883476f,0.883521f,0.883565f,0.88361f,0.883655f,0.8837f,0.883745f,0.88379f,0.883835f,0.88388f,0.883924f,0.883969f,0.884014f,0.884059f,0.884104f,0.884148f,0.884193f,0.884238f,0.884283f,0.884328f,0.884372f,0.884417f,0.884462f,0.884507f,0.884551f,0.884596f,0.884641f,0.884685f,0.88473f,0.884775f,0.884819f,0.884864f,0.884909f,0.884953f,0.884998f,0.885043f,0.885087f,0.885132f,0.885177f,0.885221f,0.885266f,0.88531f,0.885355f,0.8854f,0.885444f,0.885489f,0.885533f,0.885578f,0.885622f,0.885667f,0.885711f,0.885756f,0.8858f,0.885845f,0.885889f,0.885934f,0.885978f,0.886023f,0.886067f,0.886111f,0.886156f,0.8862f,0.886245f,0.886289f,0.886334f,0.886378f,0.886422f,0.886467f,0.886511f,0.886555f,0.8866f,0.886644f,0.886688f,0.886733f,0.886777f,0.886821f,0.886866f,0.88691f,0.886954f,0.886999f,0.887043f,0.887087f,0.887131f,0.887176f,0.88722f,0.887264f,0.887308f,0.887352f,0.887397f,0.887441f,0.887485f,0.887529f,0.887573f,0.887618f,0.887662f,0.887706f,0.88775f,0.887794f,0.887838f,0.887882f,0.887926f,0.887971f,0.888015f,0.888059f,0.888103f,0.888147f,0.888191f,0.888235f,0.888279f,0.888323f,0.888367f,0.888411f,0.888455f,0.888499f,0.888543f,0.888587f,0.888631f,0.888675f,0.888719f,0.888763f,0.888807f,0.888851f,0.888895f,0.888939f,0.888983f,0.889026f,0.88907f,0.889114f,0.889158f,0.889202f,0.889246f,0.88929f,0.889333f,0.889377f,0.889421f,0.889465f,0.889509f,0.889553f,0.889596f,0.88964f,0.889684f,0.889728f,0.889771f,0.889815f,0.889859f,0.889903f,0.889946f,0.88999f,0.890034f,0.890078f,0.890121f,0.890165f,0.890209f,0.890252f,0.890296f,0.89034f,0.890383f,0.890427f,0.890471f,0.890514f,0.890558f,0.890601f,0.890645f,0.890689f,0.890732f,0.890776f,0.890819f,0.890863f,0.890906f,0.89095f,0.890993f,0.891037f,0.891081f,0.891124f,0.891168f,0.891211f,0.891255f,0.891298f,0.891341f,0.891385f,0.891428f,0.891472f,0.891515f,0.891559f,0.891602f,0.891645f,0.891689f,0.891732f,0.891776f,0.891819f,0.891862f,0.891906f,0.891949f,0.891992f,0.892036f,0.892079f,0.892122f,0.892166f,0.892209f,0.892252f,0.892296f,0.892339f,0.892382f,0.892425f,0.892469f,0.892512f,0.892555f,0.892598f,0.892642f,0.892685f,0.892728f,0.892771f,0.892814f,0.892858f,0.892901f,0.892944f,0.892987f,0.89303f,0.893073f,0.893117f,0.89316f,0.893203f,0.893246f,0.893289f,0.893332f,0.893375f,0.893418f,0.893461f,0.893504f,0.893547f,0.89359f,0.893633f,0.893677f,0.893719f,0.893762f,0.893806f,0.893849f,0.893891f,0.893934f,0.893977f,0.89402f,0.894063f,0.894106f,0.894149f,0.894192f,0.894235f,0.894278f,0.894321f,0.894364f,0.894407f,0.894449f,0.894492f,0.894535f,0.894578f,0.894621f,0.894664f,0.894707f,0.894749f,0.894792f,0.894835f,0.894878f,0.894921f,0.894963f,0.895006f,0.895049f,0.895092f,0.895134f,0.895177f,0.89522f,0.895263f,0.895305f,0.895348f,0.895391f,0.895433f,0.895476f,0.895519f,0.895561f,0.895604f,0.895647f,0.895689f,0.895732f,0.895775f,0.895817f,0.89586f,0.895902f,0.895945f,0.895988f,0.89603f,0.896073f,0.896115f,0.896158f,0.8962f,0.896243f,0.896285f,0.896328f,0.89637f,0.896413f,0.896455f,0.896498f,0.89654f,0.896583f,0.896625f,0.896668f,0.89671f,0.896753f,0.896795f,0.896837f,0.89688f,0.896922f,0.896965f,0.897007f,0.897049f,0.897092f,0.897134f,0.897176f,0.897219f,0.897261f,0.897303f,0.897346f,0.897388f,0.89743f,0.897473f,0.897515f,0.897557f,0.897599f,0.897642f,0.897684f,0.897726f,0.897768f,0.897811f,0.897853f,0.897895f,0.897937f,0.897979f,0.898022f,0.898064f,0.898106f,0.898148f,0.89819f,0.898232f,0.898275f,0.898317f,0.898359f,0.898401f,0.898443f,0.898485f,0.898527f,0.898569f,0.898611f,0.898653f,0.898696f,0.898738f,0.89878f,0.898822f,0.898864f,0.898906f,0.898948f,0.89899f,0.899032f,0.899074f,0.899116f,0.899158f,0.899199f,0.899241f,0.899283f,0.899325f,0.899367f,0.899409f,0.899451f,0.899493f,0.899535f,0.899577f,0.899619f,0.89966f,0.899702f,0.899744f,0.899786f,0.899828f,0.89987f,0.899911f,0.899953f,0.899995f,0.900037f,0.900079f,0.90012f,0.900162f,0.900204f,0.900246f,0.900287f,0.900329f,0.900371f,0.900412f,0.900454f,0.900496f,0.900538f,0.900579f,0.900621f,0.900663f,0.900704f,0.900746f,0.900788f,0.900829f,0.900871f,0.900912f,0.900954f,0.900996f,0.901037f,0.901079f,0.90112f,0.901162f,0.901204f,0.901245f,0.901287f,0.901328f,0.90137f,0.901411f,0.901453f,0.901494f,0.901536f,0.901577f,0.901619f,0.90166f,0.901702f,0.901743f,0.901784f,0.901826f,0.901867f,0.901909f,0.90195f,0.901991f,0.902033f,0.902074f,0.902116f,0.902157f,0.902198f,0.90224f,0.902281f,0.902322f,0.902364f,0.902405f,0.902446f,0.902488f,0.902529f,0.90257f,0.902611f,0.902653f,0.902694f,0.902735f,0.902776f,0.902818f,0.902859f,0.9029f,0.902941f,0.902983f,0.903024f,0.903065f,0.903106f,0.903147f,0.903188f,0.90323f,0.903271f,0.903312f,0.903353f,0.903394f,0.903435f,0.903476f,0.903517f,0.903558f,0.9036f,0.903641f,0.903682f,0.903723f,0.903764f,0.903805f,0.903846f,0.903887f,0.903928f,0.903969f,0.90401f,0.904051f,0.904092f,0.904133f,0.904174f,0.904215f,0.904256f,0.904297f,0.904337f,0.904378f,0.904419f,0.90446f,0.904501f,0.904542f,0.904583f,0.904624f,0.904665f,0.904705f,0.904746f,0.904787f,0.904828f,0.904869f,0.904909f,0.90495f,0.904991f,0.905032f,0.905073f,0.905113f,0.905154f,0.905195f,0.905236f,0.905276f,0.905317f,0.905358f,0.905399f,0.905439f,0.90548f,0.905521f,0.905561f,0.905602f,0.905643f,0.905683f,0.905724f,0.905765f,0.905805f,0.905846f,0.905886f,0.905927f,0.905968f,0.906008f,0.906049f,0.906089f,0.90613f,0.90617f,0.906211f,0.906251f,0.906292f,0.906333f,0.906373f,0.906414f,0.906454f,0.906495f,0.906535f,0.906576f,0.906616f,0.906656f,0.906697f,0.906737f,0.906778f,0.906818f,0.906859f,0.906899f,0.906939f,0.90698f,0.90702f,0.90706f,0.907101f,0.907141f,0.907182f,0.907222f,0.907262f,0.907302f,0.907343f,0.907383f,0.907423f,0.907464f,0.907504f,0.907544f,0.907584f,0.907625f,0.907665f,0.907705f,0.907745f,0.907786f,0.907826f,0.907866f,0.907906f,0.907946f,0.907987f,0.908027f,0.908067f,0.908107f,0.908147f,0.908187f,0.908227f,0.908268f,0.908308f,0.908348f,0.908388f,0.908428f,0.908468f,0.908508f,0.908548f,0.908588f,0.908628f,0.908668f,0.908708f,0.908748f,0.908788f,0.908828f,0.908868f,0.908908f,0.908948f,0.908988f,0.909028f,0.909068f,0.909108f,0.909148f,0.909188f,0.909228f,0.909268f,0.909308f,0.909348f,0.909387f,0.909427f,0.909467f,0.909507f,0.909547f,0.909587f,0.909627f,0.909666f,0.909706f,0.909746f,0.909786f,0.909826f,0.909865f,0.909905f,0.909945f,0.909985f,0.910024f,0.910064f,0.910104f,0.910144f,0.910183f,0.910223f,0.910263f,0.910302f,0.910342f,0.910382f,0.910421f,0.910461f,0.910501f,0.91054f,0.91058f,0.91062f,0.910659f,0.910699f,0.910739f,0.910778f,0.910818f,0.910857f,0.910897f,0.910936f,0.910976f,0.911015f,0.911055f,0.911094f,0.911134f,0.911174f,0.911213f,0.911252f,0.911292f,0.911331f,0.911371f,0.91141f,0.91145f,0.911489f,0.911529f,0.911568f,0.911608f,0.911647f,0.911686f,0.911726f,0.911765f,0.911804f,0.911844f,0.911883f,0.911923f,0.911962f,0.912001f,0.912041f,0.91208f,0.912119f,0.912158f,0.912198f,0.912237f,0.912276f,0.912316f,0.912355f,0.912394f,0.912433f,0.912473f,0.912512f,0.912551f,0.91259f,0.912629f,0.912669f,0.912708f,0.912747f,0.912786f,0.912825f,0.912864f,0.912904f,0.912943f,0.912982f,0.913021f,0.91306f,0.913099f,0.913138f,0.913177f,0.913216f,0.913255f,0.913294f,0.913333f,0.913373f,0.913412f,0.913451f,0.91349f,0.913529f,0.913568f,0.913607f,0.913646f,0.913684f,0.913723f,0.913762f,0.913801f,0.91384f,0.913879f,0.913918f,0.913957f,0.913996f,0.914035f,0.914074f,0.914113f,0.914151f,0.91419f,0.914229f,0.914268f,0.914307f,0.914346f,0.914385f,0.914423f,0.914462f,0.914501f,0.91454f,0.914578f,0.914617f,0.914656f,0.914695f,0.914733f,0.914772f,0.914811f,0.91485f,0.914888f,0.914927f,0.914966f,0.915004f,0.915043f,0.915082f,0.91512f,0.915159f,0.915198f,0.915236f,0.915275f,0.915314f,0.915352f,0.915391f,0.915429f,0.915468f,0.915507f,0.915545f,0.915584f,0.915622f,0.915661f,0.915699f,0.915738f,0.915776f,0.915815f,0.915853f,0.915892f,0.91593f,0.915969f,0.916007f,0.916046f,0.916084f,0.916123f,0.916161f,0.9162f,0.916238f,0.916276f,0.916315f,0.916353f,0.916391f,0.91643f,0.916468f,0.916507f,0.916545f,0.916583f,0.916622f,0.91666f,0.916698f,0.916737f,0.916775f,0.916813f,0.916851f,0.91689f,0.916928f,0.916966f,0.917004f,0.917043f,0.917081f,0.917119f,0.917157f,0.917196f,0.917234f,0.917272f,0.91731f,0.917348f,0.917386f,0.917425f,0.917463f,0.917501f,0.917539f,0.917577f,0.917615f,0.917653f,0.917691f,0.917729f,0.917768f,0.917806f,0.917844f,0.917882f,0.91792f,0.917958f,0.917996f,0.918034f,0.918072f,0.91811f,0.918148f,0.918186f,0.918224f,0.918262f,0.9183f,0.918338f,0.918376f,0.918414f,0.918452f,0.918489f,0.918527f,0.918565f,0.918603f,0.918641f,0.918679f,0.918717f,0.918755f,0.918792f,0.91883f,0.918868f,0.918906f,0.918944f,0.918982f,0.919019f,0.919057f,0.919095f,0.919133f,0.91917f,0.919208f,0.919246f,0.919284f,0.919321f,0.919359f,0.919397f,0.919435f,0.919472f,0.91951f,0.919548f,0.919585f,0.919623f,0.919661f,0.919698f,0.919736f,0.919774f,0.919811f,0.919849f,0.919886f,0.919924f,0.919962f,0.919999f,0.920037f,0.920074f,0.920112f,0.920149f,0.920187f,0.920224f,0.920262f,0.9203f,0.920337f,0.920375f,0.920412f,0.920449f,0.920487f,0.920524f,0.920562f,0.920599f,0.920637f,0.920674f,0.920712f,0.920749f,0.920786f,0.920824f,0.920861f,0.920899f,0.920936f,0.920973f,0.921011f,0.921048f,0.921085f,0.921123f,0.92116f,0.921197f,0.921235f,0.921272f,0.921309f,0.921346f,0.921384f,0.921421f,0.921458f,0.921495f,0.921533f,0.92157f,0.921607f,0.921644f,0.921682f,0.921719f,0.921756f,0.921793f,0.92183f,0.921867f,0.921905f,0.921942f,0.921979f,0.922016f,0.922053f,0.92209f,0.922127f,0.922164f,0.922201f,0.922238f,0.922275f,0.922313f,0.92235f,0.922387f,0.922424f,0.922461f,0.922498f,0.922535f,0.922572f,0.922609f,0.922646f,0.922683f,0.92272f,0.922757f,0.922794f,0.92283f,0.922867f,0.922904f,0.922941f,0.922978f,0.923015f,0.923052f,0.923089f,0.923126f,0.923162f,0.923199f,0.923236f,0.923273f,0.92331f,0.923347f,0.923383f,0.92342f,0.923457f,0.923494f,0.923531f,0.923567f,0.923604f,0.923641f,0.923678f,0.923714f,0.923751f,0.923788f,0.923824f,0.923861f,0.923898f,0.923935f,0.923971f,0.924008f,0.924045f,0.924081f,0.924118f,0.924154f,0.924191f,0.924228f,0.924264f,0.924301f,0.924338f,0.924374f,0.924411f,0.924447f,0.924484f,0.92452f,0.924557f,0.924593f,0.92463f,0.924666f,0.924703f,0.924739f,0.924776f,0.924812f,0.924849f,0.924885f,0.924922f,0.924958f,0.924995f,0.925031f,0.925067f,0.925104f,0.92514f,0.925177f,0.925213f,0.925249f,0.925286f,0.925322f,0.925358f,0.925395f,0.925431f,0.925467f,0.925504f,0.92554f,0.925576f,0.925613f,0.925649f,0.925685f,0.925722f,0.925758f,0.925794f,0.92583f,0.925866f,0.925903f,0.925939f,0.925975f,0.926011f,0.926048f,0.926084f,0.92612f,0.926156f,0.926192f,0.926228f,0.926264f,0.926301f,0.926337f,0.926373f,0.926409f,0.926445f,0.926481f,0.926517f,0.926553f,0.926589f,0.926625f,0.926661f,0.926697f,0.926733f,0.926769f,0.926805f,0.926841f,0.926877f,0.926913f,0.926949f,0.926985f,0.927021f,0.927057f,0.927093f,0.927129f,0.927165f,0.927201f,0.927237f,0.927273f,0.927309f,0.927345f,0.92738f,0.927416f,0.927452f,0.927488f,0.927524f,0.92756f,0.927596f,0.927631f,0.927667f,0.927703f,0.927739f,0.927774f,0.92781f,0.927846f,0.927882f,0.927918f,0.927953f,0.927989f,0.928025f,0.92806f,0.928096f,0.928132f,0.928168f,0.928203f,0.928239f,0.928275f,0.92831f,0.928346f,0.928381f,0.928417f,0.928453f,0.928488f,0.928524f,0.928559f,0.928595f,0.928631f,0.928666f,0.928702f,0.928737f,0.928773f,0.928808f,0.928844f,0.928879f,0.928915f,0.92895f,0.928986f,0.929021f,0.929057f,0.929092f,0.929128f,0.929163f,0.929199f,0.929234f,0.929269f,0.929305f,0.92934f,0.929376f,0.929411f,0.929447f,0.929482f,0.929517f,0.929553f,0.929588f,0.929623f,0.929659f,0.929694f,0.929729f,0.929765f,0.9298f,0.929835f,0.92987f,0.929906f,0.929941f,0.929976f,0.930011f,0.930047f,0.930082f,0.930117f,0.930152f,0.930187f,0.930223f,0.930258f,0.930293f,0.930328f,0.930363f,0.930398f,0.930434f,0.930469f,0.930504f,0.930539f,0.930574f,0.930609f,0.930644f,0.930679f,0.930714f,0.930749f,0.930785f,0.93082f,0.930855f,0.93089f,0.930925f,0.93096f,0.930995f,0.93103f,0.931065f,0.9311f,0.931135f,0.93117f,0.931204f,0.931239f,0.931274f,0.931309f,0.931344f,0.931379f,0.931414f,0.931449f,0.931484f,0.931519f,0.931553f,0.931588f,0.931623f,0.931658f,0.931693f,0.931728f,0.931763f,0.931797f,0.931832f,0.931867f,0.931902f,0.931936f,0.931971f,0.932006f,0.932041f,0.932075f,0.93211f,0.932145f,0.93218f,0.932214f,0.932249f,0.932284f,0.932318f,0.932353f,0.932388f,0.932422f,0.932457f,0.932492f,0.932526f,0.932561f,0.932595f,0.93263f,0.932665f,0.932699f,0.932734f,0.932768f,0.932803f,0.932837f,0.932872f,0.932907f,0.932941f,0.932976f,0.93301f,0.933045f,0.933079f,0.933114f,0.933148f,0.933182f,0.933217f,0.933251f,0.933286f,0.93332f,0.933355f,0.933389f,0.933423f,0.933458f,0.933492f,0.933527f,0.933561f,0.933595f,0.93363f,0.933664f,0.933698f,0.933733f,0.933767f,0.933801f,0.933836f,0.93387f,0.933904f,0.933938f,0.933973f,0.934007f,0.934041f,0.934075f,0.93411f,0.934144f,0.934178f,0.934212f,0.934247f,0.934281f,0.934315f,0.934349f,0.934383f,0.934417f,0.934452f,0.934486f,0.93452f,0.934554f,0.934588f,0.934622f,0.934656f,0.93469f,0.934724f,0.934758f,0.934792f,0.934827f,0.934861f,0.934895f,0.934929f,0.934963f,0.934997f,0.935031f,0.935065f,0.935099f,0.935133f,0.935167f,0.935201f,0.935234f,0.935268f,0.935302f,0.935336f,0.93537f,0.935404f,0.935438f,0.935472f,0.935506f,0.93554f,0.935573f,0.935607f,0.935641f,0.935675f,0.935709f,0.935743f,0.935776f,0.93581f,0.935844f,0.935878f,0.935912f,0.935945f,0.935979f,0.936013f,0.936047f,0.93608f,0.936114f,0.936148f,0.936181f,0.936215f,0.936249f,0.936283f,0.936316f,0.93635f,0.936383f,0.936417f,0.936451f,0.936484f,0.936518f,0.936552f,0.936585f,0.936619f,0.936652f,0.936686f,0.93672f,0.936753f,0.936787f,0.93682f,0.936854f,0.936887f,0.936921f,0.936954f,0.936988f,0.937021f,0.937055f,0.937088f,0.937122f,0.937155f,0.937189f,0.937222f,0.937256f,0.937289f,0.937322f,0.937356f,0.937389f,0.937423f,0.937456f,0.937489f,0.937523f,0.937556f,0.937589f,0.937623f,0.937656f,0.937689f,0.937723f,0.937756f,0.937789f,0.937822f,0.937856f,0.937889f,0.937922f,0.937955f,0.937989f,0.938022f,0.938055f,0.938088f,0.938122f,0.938155f,0.938188f,0.938221f,0.938254f,0.938287f,0.938321f,0.938354f,0.938387f,0.93842f,0.938453f,0.938486f,0.938519f,0.938552f,0.938586f,0.938619f,0.938652f,0.938685f,0.938718f,0.938751f,0.938784f,0.938817f,0.93885f,0.938883f,0.938916f,0.938949f,0.938982f,0.939015f,0.939048f,0.939081f,0.939114f,0.939147f,0.93918f,0.939213f,0.939246f,0.939278f,0.939311f,0.939344f,0.939377f,0.93941f,0.939443f,0.939476f,0.939508f,0.939541f,0.939574f,0.939607f,0.93964f,0.939673f,0.939705f,0.939738f,0.939771f,0.939804f,0.939836f,0.939869f,0.939902f,0.939935f,0.939967f,0.94f,0.940033f,0.940066f,0.940098f,0.940131f,0.940164f,0.940196f,0.940229f,0.940261f,0.940294f,0.940327f,0.940359f,0.940392f,0.940425f,0.940457f,0.94049f,0.940522f,0.940555f,0.940588f,0.94062f,0.940653f,0.940685f,0.940718f,0.94075f,0.940783f,0.940815f,0.940848f,0.94088f,0.940913f,0.940945f,0.940978f,0.94101f,0.941042f,0.941075f,0.941107f,0.94114f,0.941172f,0.941204f,0.941237f,0.941269f,0.941302f,0.941334f,0.941366f,0.941399f,0.941431f,0.941463f,0.941496f,0.941528f,0.94156f,0.941593f,0.941625f,0.941657f,0.941689f,0.941722f,0.941754f,0.941786f,0.941818f,0.94185f,0.941883f,0.941915f,0.941947f,0.941979f,0.942012f,0.942044f,0.942076f,0.942108f,0.94214f,0.942172f,0.942204f,0.942236f,0.942269f,0.942301f,0.942333f,0.942365f,0.942397f,0.942429f,0.942461f,0.942493f,0.942525f,0.942557f,0.942589f,0.942621f,0.942653f,0.942685f,0.942717f,0.942749f,0.942781f,0.942813f,0.942845f,0.942877f,0.942909f,0.942941f,0.942973f,0.943005f,0.943037f,0.943069f,0.9431f,0.943132f,0.943164f,0.943196f,0.943228f,0.94326f,0.943292f,0.943323f,0.943355f,0.943387f,0.943419f,0.943451f,0.943482f,0.943514f,0.943546f,0.943578f,0.943609f,0.943641f,0.943673f,0.943705f,0.943736f,0.943768f,0.9438f,0.943831f,0.943863f,0.943895f,0.943926f,0.943958f,0.94399f,0.944021f,0.944053f,0.944084f,0.944116f,0.944148f,0.944179f,0.944211f,0.944242f,0.944274f,0.944306f,0.944337f,0.944369f,0.9444f,0.944432f,0.944463f,0.944495f,0.944526f,0.944558f,0.944589f,0.944621f,0.944652f,0.944683f,0.944715f,0.944746f,0.944778f,0.944809f,0.944841f,0.944872f,0.944903f,0.944935f,0.944966f,0.944997f,0.945029f,0.94506f,0.945092f,0.945123f,0.945154f,0.945185f,0.945217f,0.945248f,0.945279f,0.945311f,0.945342f,0.945373f,0.945404f,0.945436f,0.945467f,0.945498f,0.945529f,0.945561f,0.945592f,0.945623f,0.945654f,0.945685f,0.945716f,0.945748f,0.945779f,0.94581f,0.945841f,0.945872f,0.945903f,0.945934f,0.945965f,0.945997f,0.946028f,0.946059f,0.94609f,0.946121f,0.946152f,0.946183f,0.946214f,0.946245f,0.946276f,0.946307f,0.946338f,0.946369f,0.9464f,0.946431f,0.946462f,0.946493f,0.946524f,0.946555f,0.946585f,0.946616f,0.946647f,0.946678f,0.946709f,0.94674f,0.946771f,0.946802f,0.946833f,0.946863f,0.946894f,0.946925f,0.946956f,0.946987f,0.947017f,0.947048f,0.947079f,0.94711f,0.947141f,0.947171f,0.947202f,0.947233f,0.947263f,0.947294f,0.947325f,0.947356f,0.947386f,0.947417f,0.947448f,0.947478f,0.947509f,0.94754f,0.94757f,0.947601f,0.947632f,0.947662f,0.947693f,0.947723f,0.947754f,0.947785f,0.947815f,0.947846f,0.947876f,0.947907f,0.947937f,0.947968f,0.947998f,0.948029f,0.948059f,0.94809f,0.94812f,0.948151f,0.948181f,0.948212f,0.948242f,0.948273f,0.948303f,0.948334f,0.948364f,0.948394f,0.948425f,0.948455f,0.948485f,0.948516f,0.948546f,0.948577f,0.948607f,0.948637f,0.948668f,0.948698f,0.948728f,0.948758f,0.948789f,0.948819f,0.948849f,0.94888f,0.94891f,0.94894f,0.94897f,0.949001f,0.949031f,0.949061f,0.949091f,0.949121f,0.949152f,0.949182f,0.949212f,0.949242f,0.949272f,0.949302f,0.949333f,0.949363f,0.949393f,0.949423f,0.949453f,0.949483f,0.949513f,0.949543f,0.949573f,0.949603f,0.949633f,0.949663f,0.949693f,0.949723f,0.949753f,0.949784f,0.949813f,0.949843f,0.949873f,0.949903f,0.949933f,0.949963f,0.949993f,0.950023f,0.950053f,0.950083f,0.950113f,0.950143f,0.950173f,0.950203f,0.950233f,0.950262f,0.950292f,0.950322f,0.950352f,0.950382f,0.950412f,0.950441f,0.950471f,0.950501f,0.950531f,0.950561f,0.95059f,0.95062f,0.95065f,0.95068f,0.950709f,0.950739f,0.950769f,0.950798f,0.950828f,0.950858f,0.950888f,0.950917f,0.950947f,0.950976f,0.951006f,0.951036f,0.951065f,0.951095f,0.951125f,0.951154f,0.951184f,0.951213f,0.951243f,0.951273f,0.951302f,0.951332f,0.951361f,0.951391f,0.95142f,0.95145f,0.951479f,0.951509f,0.951538f,0.951568f,0.951597f,0.951627f,0.951656f,0.951686f,0.951715f,0.951744f,0.951774f,0.951803f,0.951833f,0.951862f,0.951891f,0.951921f,0.95195f,0.95198f,0.952009f,0.952038f,0.952068f,0.952097f,0.952126f,0.952156f,0.952185f,0.952214f,0.952243f,0.952273f,0.952302f,0.952331f,0.95236f,0.95239f,0.952419f,0.952448f,0.952477f,0.952506f,0.952536f,0.952565f,0.952594f,0.952623f,0.952652f,0.952681f,0.952711f,0.95274f,0.952769f,0.952798f,0.952827f,0.952856f,0.952885f,0.952914f,0.952943f,0.952972f,0.953002f,0.953031f,0.95306f,0.953089f,0.953118f,0.953147f,0.953176f,0.953205f,0.953234f,0.953263f,0.953292f,0.953321f,0.953349f,0.953378f,0.953407f,0.953436f,0.953465f,0.953494f,0.953523f,0.953552f,0.953581f,0.95361f,0.953638f,0.953667f,0.953696f,0.953725f,0.953754f,0.953783f,0.953811f,0.95384f,0.953869f,0.953898f,0.953927f,0.953955f,0.953984f,0.954013f,0.954042f,0.95407f,0.954099f,0.954128f,0.954156f,0.954185f,0.954214f,0.954242f,0.954271f,0.9543f,0.954328f,0.954357f,0.954386f,0.954414f,0.954443f,0.954472f,0.9545f,0.954529f,0.954557f,0.954586f,0.954614f,0.954643f,0.954672f,0.9547f,0.954729f,0.954757f,0.954786f,0.954814f,0.954843f,0.954871f,0.9549f,0.954928f,0.954956f,0.954985f,0.955013f,0.955042f,0.95507f,0.955099f,0.955127f,0.955155f,0.955184f,0.955212f,0.95524f,0.955269f,0.955297f,0.955326f,0.955354f,0.955382f,0.95541f,0.955439f,0.955467f,0.955495f,0.955524f,0.955552f,0.95558f,0.955608f,0.955637f,0.955665f,0.955693f,0.955721f,0.95575f,0.955778f,0.955806f,0.955834f,0.955862f,0.955891f,0.955919f,0.955947f,0.955975f,0.956003f,0.956031f,0.956059f,0.956087f,0.956116f,0.956144f,0.956172f,0.9562f,0.956228f,0.956256f,0.956284f,0.956312f,0.95634f,0.956368f,0.956396f,0.956424f,0.956452f,0.95648f,0.956508f,0.956536f,0.956564f,0.956592f,0.95662f,0.956648f,0.956676f,0.956703f,0.956731f,0.956759f,0.956787f,0.956815f,0.956843f,0.956871f,0.956899f,0.956926f,0.956954f,0.956982f,0.95701f,0.957038f,0.957066f,0.957093f,0.957121f,0.957149f,0.957177f,0.957204f,0.957232f,0.95726f,0.957288f,0.957315f,0.957343f,0.957371f,0.957398f,0.957426f,0.957454f,0.957481f,0.957509f,0.957537f,0.957564f,0.957592f,0.95762f,0.957647f,0.957675f,0.957702f,0.95773f,0.957758f,0.957785f,0.957813f,0.95784f,0.957868f,0.957895f,0.957923f,0.95795f,0.957978f,0.958005f,0.958033f,0.95806f,0.958088f,0.958115f,0.958143f,0.95817f,0.958198f,0.958225f,0.958252f,0.95828f,0.958307f,0.958335f,0.958362f,0.958389f,0.958417f,0.958444f,0.958471f,0.958499f,0.958526f,0.958553f,0.958581f,0.958608f,0.958635f,0.958663f,0.95869f,0.958717f,0.958744f,0.958772f,0.958799f,0.958826f,0.958853f,0.958881f,0.958908f,0.958935f,0.958962f,0.958989f,0.959017f,0.959044f,0.959071f,0.959098f,0.959125f,0.959152f,0.959179f,0.959206f,0.959234f,0.959261f,0.959288f,0.959315f,0.959342f,0.959369f,0.959396f,0.959423f,0.95945f,0.959477f,0.959504f,0.959531f,0.959558f,0.959585f,0.959612f,0.959639f,0.959666f,0.959693f,0.95972f,0.959747f,0.959774f,0.959801f,0.959827f,0.959854f,0.959881f,0.959908f,0.959935f,0.959962f,0.959989f,0.960016f,0.960042f,0.960069f,0.960096f,0.960123f,0.96015f,0.960176f,0.960203f,0.96023f,0.960257f,0.960284f,0.96031f,0.960337f,0.960364f,0.96039f,0.960417f,0.960444f,0.960471f,0.960497f,0.960524f,0.960551f,0.960577f,0.960604f,0.960631f,0.960657f,0.960684f,0.96071f,0.960737f,0.960764f,0.96079f,0.960817f,0.960843f,0.96087f,0.960896f,0.960923f,0.96095f,0.960976f,0.961003f,0.961029f,0.961056f,0.961082f,0.961109f,0.961135f,0.961161f,0.961188f,0.961214f,0.961241f,0.961267f,0.961294f,0.96132f,0.961347f,0.961373f,0.961399f,0.961426f,0.961452f,0.961478f,0.961505f,0.961531f,0.961557f,0.961584f,0.96161f,0.961636f,0.961663f,0.961689f,0.961715f,0.961742f,0.961768f,0.961794f,0.96182f,0.961846f,0.961873f,0.961899f,0.961925f,0.961951f,0.961978f,0.962004f,0.96203f,0.962056f,0.962082f,0.962108f,0.962134f,0.962161f,0.962187f,0.962213f,0.962239f,0.962265f,0.962291f,0.962317f,0.962343f,0.962369f,0.962395f,0.962421f,0.962447f,0.962473f,0.962499f,0.962525f,0.962551f,0.962577f,0.962603f,0.962629f,0.962655f,0.962681f,0.962707f,0.962733f,0.962759f,0.962785f,0.962811f,0.962837f,0.962863f,0.962889f,0.962914f,0.96294f,0.962966f,0.962992f,0.963018f,0.963044f,0.96307f,0.963095f,0.963121f,0.963147f,0.963173f,0.963198f,0.963224f,0.96325f,0.963276f,0.963301f,0.963327f,0.963353f,0.963379f,0.963404f,0.96343f,0.963456f,0.963481f,0.963507f,0.963533f,0.963558f,0.963584f,0.96361f,0.963635f,0.963661f,0.963687f,0.963712f,0.963738f,0.963763f,0.963789f,0.963814f,0.96384f,0.963866f,0.963891f,0.963917f,0.963942f,0.963968f,0.963993f,0.964019f,0.964044f,0.96407f,0.964095f,0.964121f,0.964146f,0.964171f,0.964197f,0.964222f,0.964248f,0.964273f,0.964298f,0.964324f,0.964349f,0.964375f,0.9644f,0.964425f,0.964451f,0.964476f,0.964501f,0.964527f,0.964552f,0.964577f,0.964602f,0.964628f,0.964653f,0.964678f,0.964704f,0.964729f,0.964754f,0.964779f,0.964804f,0.96483f,0.964855f,0.96488f,0.964905f,0.96493f,0.964956f,0.964981f,0.965006f,0.965031f,0.965056f,0.965081f,0.965106f,0.965131f,0.965156f,0.965182f,0.965207f,0.965232f,0.965257f,0.965282f,0.965307f,0.965332f,0.965357f,0.965382f,0.965407f,0.965432f,0.965457f,0.965482f,0.965507f,0.965532f,0.965557f,0.965582f,0.965607f,0.965632f,0.965657f,0.965681f,0.965706f,0.965731f,0.965756f,0.965781f,0.965806f,0.965831f,0.965855f,0.96588f,0.965905f,0.96593f,0.965955f,0.96598f,0.966004f,0.966029f,0.966054f,0.966079f,0.966103f,0.966128f,0.966153f,0.966178f,0.966202f,0.966227f,0.966252f,0.966276f,0.966301f,0.966326f,0.96635f,0.966375f,0.9664f,0.966424f,0.966449f,0.966474f,0.966498f,0.966523f,0.966547f,0.966572f,0.966597f,0.966621f,0.966646f,0.96667f,0.966695f,0.966719f,0.966744f,0.966768f,0.966793f,0.966817f,0.966842f,0.966866f,0.966891f,0.966915f,0.96694f,0.966964f,0.966989f,0.967013f,0.967038f,0.967062f,0.967086f,0.967111f,0.967135f,0.96716f,0.967184f,0.967208f,0.967233f,0.967257f,0.967281f,0.967306f,0.96733f,0.967354f,0.967378f,0.967403f,0.967427f,0.967451f,0.967476f,0.9675f,0.967524f,0.967548f,0.967572f,0.967597f,0.967621f,0.967645f,0.967669f,0.967693f,0.967718f,0.967742f,0.967766f,0.96779f,0.967814f,0.967838f,0.967862f,0.967887f,0.967911f,0.967935f,0.967959f,0.967983f,0.968007f,0.968031f,0.968055f,0.968079f,0.968103f,0.968127f,0.968151f,0.968175f,0.968199f,0.968223f,0.968247f,0.968271f,0.968295f,0.968319f,0.968343f,0.968367f,0.968391f,0.968415f,0.968439f,0.968462f,0.968486f,0.96851f,0.968534f,0.968558f,0.968582f,0.968606f,0.968629f,0.968653f,0.968677f,0.968701f,0.968725f,0.968748f,0.968772f,0.968796f,0.96882f,0.968843f,0.968867f,0.968891f,0.968915f,0.968938f,0.968962f,0.968986f,0.969009f,0.969033f,0.969057f,0.969081f,0.969104f,0.969128f,0.969151f,0.969175f,0.969199f,0.969222f,0.969246f,0.969269f,0.969293f,0.969317f,0.96934f,0.969364f,0.969387f,0.969411f,0.969434f,0.969458f,0.969481f,0.969505f,0.969528f,0.969552f,0.969575f,0.969599f,0.969622f,0.969646f,0.969669f,0.969693f,0.969716f,0.969739f,0.969763f,0.969786f,0.96981f,0.969833f,0.969856f,0.96988f,0.969903f,0.969926f,0.96995f,0.969973f,0.969996f,0.97002f,0.970043f,0.970066f,0.970089f,0.970113f,0.970136f,0.970159f,0.970182f,0.970206f,0.970229f,0.970252f,0.970275f,0.970299f,0.970322f,0.970345f,0.970368f,0.970391f,0.970414f,0.970438f,0.970461f,0.970484f,0.970507f,0.97053f,0.970553f,0.970576f,0.970599f,0.970622f,0.970645f,0.970669f,0.970692f,0.970715f,0.970738f,0.970761f,0.970784f,0.970807f,0.97083f,0.970853f,0.970876f,0.970899f,0.970922f,0.970944f,0.970967f,0.97099f,0.971013f,0.971036f,0.971059f,0.971082f,0.971105f,0.971128f,0.971151f,0.971173f,0.971196f,0.971219f,0.971242f,0.971265f,0.971288f,0.97131f,0.971333f,0.971356f,0.971379f,0.971402f,0.971424f,0.971447f,0.97147f,0.971493f,0.971515f,0.971538f,0.971561f,0.971583f,0.971606f,0.971629f,0.971651f,0.971674f,0.971697f,0.971719f,0.971742f,0.971765f,0.971787f,0.97181f,0.971832f,0.971855f,0.971878f,0.9719f,0.971923f,0.971945f,0.971968f,0.97199f,0.972013f,0.972035f,0.972058f,0.97208f,0.972103f,0.972125f,0.972148f,0.97217f,0.972193f,0.972215f,0.972238f,0.97226f,0.972283f,0.972305f,0.972327f,0.97235f,0.972372f,0.972395f,0.972417f,0.972439f,0.972462f,0.972484f,0.972506f,0.972529f,0.972551f,0.972573f,0.972596f,0.972618f,0.97264f,0.972662f,0.972685f,0.972707f,0.972729f,0.972751f,0.972774f,0.972796f,0.972818f,0.97284f,0.972862f,0.972885f,0.972907f,0.972929f,0.972951f,0.972973f,0.972995f,0.973017f,0.97304f,0.973062f,0.973084f,0.973106f,0.973128f,0.97315f,0.973172f,0.973194f,0.973216f,0.973238f,0.97326f,0.973282f,0.973304f,0.973326f,0.973348f,0.97337f,0.973392f,0.973414f,0.973436f,0.973458f,0.97348f,0.973502f,0.973524f,0.973546f,0.973568f,0.97359f,0.973611f,0.973633f,0.973655f,0.973677f,0.973699f,0.973721f,0.973743f,0.973764f,0.973786f,0.973808f,0.97383f,0.973852f,0.973873f,0.973895f,0.973917f,0.973939f,0.97396f,0.973982f,0.974004f,0.974026f,0.974047f,0.974069f,0.974091f,0.974112f,0.974134f,0.974156f,0.974177f,0.974199f,0.974221f,0.974242f,0.974264f,0.974285f,0.974307f,0.974329f,0.97435f,0.974372f,0.974393f,0.974415f,0.974436f,0.974458f,0.974479f,0.974501f,0.974522f,0.974544f,0.974566f,0.974587f,0.974608f,0.97463f,0.974651f,0.974673f,0.974694f,0.974716f,0.974737f,0.974759f,0.97478f,0.974801f,0.974823f,0.974844f,0.974865f,0.974887f,0.974908f,0.974929f,0.974951f,0.974972f,0.974993f,0.975015f,0.975036f,0.975057f,0.975079f,0.9751f,0.975121f,0.975142f,0.975164f,0.975185f,0.975206f,0.975227f,0.975248f,0.97527f,0.975291f,0.975312f,0.975333f,0.975354f,0.975375f,0.975397f,0.975418f,0.975439f,0.97546f,0.975481f,0.975502f,0.975523f,0.975544f,0.975565f,0.975586f,0.975608f,0.975629f,0.97565f,0.975671f,0.975692f,0.975713f,0.975734f,0.975755f,0.975776f,0.975797f,0.975818f,0.975838f,0.975859f,0.97588f,0.975901f,0.975922f,0.975943f,0.975964f,0.975985f,0.976006f,0.976027f,0.976048f,0.976068f,0.976089f,0.97611f,0.976131f,0.976152f,0.976173f,0.976193f,0.976214f,0.976235f,0.976256f,0.976276f,0.976297f,0.976318f,0.976339f,0.976359f,0.97638f,0.976401f,0.976422f,0.976442f,0.976463f,0.976484f,0.976504f,0.976525f,0.976546f,0.976566f,0.976587f,0.976607f,0.976628f,0.976649f,0.976669f,0.97669f,0.97671f,0.976731f,0.976752f,0.976772f,0.976793f,0.976813f,0.976834f,0.976854f,0.976875f,0.976895f,0.976916f,0.976936f,0.976957f,0.976977f,0.976997f,0.977018f,0.977038f,0.977059f,0.977079f,0.9771f,0.97712f,0.97714f,0.977161f,0.977181f,0.977201f,0.977222f,0.977242f,0.977262f,0.977283f,0.977303f,0.977323f,0.977344f,0.977364f,0.977384f,0.977405f,0.977425f,0.977445f,0.977465f,0.977486f,0.977506f,0.977526f,0.977546f,0.977566f,0.977587f,0.977607f,0.977627f,0.977647f,0.977667f,0.977687f,0.977708f,0.977728f,0.977748f,0.977768f,0.977788f,0.977808f,0.977828f,0.977848f,0.977868f,0.977888f,0.977908f,0.977928f,0.977948f,0.977969f,0.977989f,0.978009f,0.978028f,0.978049f,0.978068f,0.978088f,0.978108f,0.978128f,0.978148f,0.978168f,0.978188f,0.978208f,0.978228f,0.978248f,0.978268f,0.978288f,0.978307f,0.978327f,0.978347f,0.978367f,0.978387f,0.978407f,0.978426f,0.978446f,0.978466f,0.978486f,0.978506f,0.978525f,0.978545f,0.978565f,0.978585f,0.978604f,0.978624f,0.978644f,0.978664f,0.978683f,0.978703f,0.978723f,0.978742f,0.978762f,0.978782f,0.978801f,0.978821f,0.97884f,0.97886f,0.97888f,0.978899f,0.978919f,0.978938f,0.978958f,0.978978f,0.978997f,0.979017f,0.979036f,0.979056f,0.979075f,0.979095f,0.979114f,0.979134f,0.979153f,0.979173f,0.979192f,0.979212f,0.979231f,0.97925f,0.97927f,0.979289f,0.979309f,0.979328f,0.979347f,0.979367f,0.979386f,0.979406f,0.979425f,0.979444f,0.979464f,0.979483f,0.979502f,0.979522f,0.979541f,0.97956f,0.979579f,0.979599f,0.979618f,0.979637f,0.979656f,0.979676f,0.979695f,0.979714f,0.979733f,0.979753f,0.979772f,0.979791f,0.97981f,0.979829f,0.979848f,0.979868f,0.979887f,0.979906f,0.979925f,0.979944f,0.979963f,0.979982f,0.980001f,0.98002f,0.980039f,0.980058f,0.980078f,0.980097f,0.980116f,0.980135f,0.980154f,0.980173f,0.980192f,0.980211f,0.98023f,0.980249f,0.980268f,0.980286f,0.980305f,0.980324f,0.980343f,0.980362f,0.980381f,0.9804f,0.980419f,0.980438f,0.980457f,0.980475f,0.980494f,0.980513f,0.980532f,0.980551f,0.98057f,0.980588f,0.980607f,0.980626f,0.980645f,0.980664f,0.980682f,0.980701f,0.98072f,0.980739f,0.980757f,0.980776f,0.980795f,0.980813f,0.980832f,0.980851f,0.980869f,0.980888f,0.980907f,0.980925f,0.980944f,0.980963f,0.980981f,0.981f,0.981018f,0.981037f,0.981056f,0.981074f,0.981093f,0.981111f,0.98113f,0.981148f,0.981167f,0.981185f,0.981204f,0.981222f,0.981241f,0.981259f,0.981278f,0.981296f,0.981315f,0.981333f,0.981352f,0.98137f,0.981388f,0.981407f,0.981425f,0.981444f,0.981462f,0.98148f,0.981499f,0.981517f,0.981535f,0.981554f,0.981572f,0.98159f,0.981609f,0.981627f,0.981645f,0.981664f,0.981682f,0.9817f,0.981718f,0.981737f,0.981755f,0.981773f,0.981791f,0.981809f,0.981828f,0.981846f,0.981864f,0.981882f,0.9819f,0.981919f,0.981937f,0.981955f,0.981973f,0.981991f,0.982009f,0.982027f,0.982045f,0.982063f,0.982082f,0.9821f,0.982118f,0.982136f,0.982154f,0.982172f,0.98219f,0.982208f,0.982226f,0.982244f,0.982262f,0.98228f,0.982298f,0.982316f,0.982334f,0.982352f,0.982369f,0.982387f,0.982405f,0.982423f,0.982441f,0.982459f,0.982477f,0.982495f,0.982513f,0.98253f,0.982548f,0.982566f,0.982584f,0.982602f,0.98262f,0.982637f,0.982655f,0.982673f,0.982691f,0.982708f,0.982726f,0.982744f,0.982762f,0.982779f,0.982797f,0.982815f,0.982832f,0.98285f,0.982868f,0.982885f,0.982903f,0.982921f,0.982938f,0.982956f,0.982974f,0.982991f,0.983009f,0.983026f,0.983044f,0.983062f,0.983079f,0.983097f,0.983114f,0.983132f,0.983149f,0.983167f,0.983184f,0.983202f,0.983219f,0.983237f,0.983254f,0.983272f,0.983289f,0.983307f,0.983324f,0.983342f,0.983359f,0.983376f,0.983394f,0.983411f,0.983429f,0.983446f,0.983463f,0.983481f,0.983498f,0.983515f,0.983533f,0.98355f,0.983567f,0.983585f,0.983602f,0.983619f,0.983637f,0.983654f,0.983671f,0.983688f,0.983706f,0.983723f,0.98374f,0.983757f,0.983774f,0.983792f,0.983809f,0.983826f,0.983843f,0.98386f,0.983877f,0.983895f,0.983912f,0.983929f,0.983946f,0.983963f,0.98398f,0.983997f,0.984014f,0.984031f,0.984048f,0.984066f,0.984083f,0.9841f,0.984117f,0.984134f,0.984151f,0.984168f,0.984185f,0.984202f,0.984219f,0.984236f,0.984253f,0.984269f,0.984286f,0.984303f,0.98432f,0.984337f,0.984354f,0.984371f,0.984388f,0.984405f,0.984421f,0.984438f,0.984455f,0.984472f,0.984489f,0.984506f,0.984523f,0.984539f,0.984556f,0.984573f,0.98459f,0.984606f,0.984623f,0.98464f,0.984657f,0.984673f,0.98469f,0.984707f,0.984724f,0.98474f,0.984757f,0.984774f,0.98479f,0.984807f,0.984823f,0.98484f,0.984857f,0.984873f,0.98489f,0.984907f,0.984923f,0.98494f,0.984956f,0.984973f,0.984989f,0.985006f,0.985022f,0.985039f,0.985056f,0.985072f,0.985089f,0.985105f,0.985122f,0.985138f,0.985154f,0.985171f,0.985187f,0.985204f,0.98522f,0.985237f,0.985253f,0.985269f,0.985286f,0.985302f,0.985319f,0.985335f,0.985351f,0.985368f,0.985384f,0.9854f,0.985417f,0.985433f,0.985449f,0.985466f,0.985482f,0.985498f,0.985514f,0.985531f,0.985547f,0.985563f,0.985579f,0.985596f,0.985612f,0.985628f,0.985644f,0.98566f,0.985677f,0.985693f,0.985709f,0.985725f,0.985741f,0.985757f,0.985773f,0.985789f,0.985806f,0.985822f,0.985838f,0.985854f,0.98587f,0.985886f,0.985902f,0.985918f,0.985934f,0.98595f,0.985966f,0.985982f,0.985998f,0.986014f,0.98603f,0.986046f,0.986062f,0.986078f,0.986094f,0.98611f,0.986126f,0.986142f,0.986157f,0.986173f,0.986189f,0.986205f,0.986221f,0.986237f,0.986253f,0.986269f,0.986284f,0.9863f,0.986316f,0.986332f,0.986348f,0.986363f,0.986379f,0.986395f,0.986411f,0.986426f,0.986442f,0.986458f,0.986474f,0.986489f,0.986505f,0.986521f,0.986536f,0.986552f,0.986568f,0.986583f,0.986599f,0.986615f,0.98663f,0.986646f,0.986662f,0.986677f,0.986693f,0.986708f,0.986724f,0.986739f,0.986755f,0.986771f,0.986786f,0.986802f,0.986817f,0.986833f,0.986848f,0.986864f,0.986879f,0.986895f,0.98691f,0.986926f,0.986941f,0.986956f,0.986972f,0.986987f,0.987003f,0.987018f,0.987033f,0.987049f,0.987064f,0.98708f,0.987095f,0.98711f,0.987126f,0.987141f,0.987156f,0.987172f,0.987187f,0.987202f,0.987217f,0.987233f,0.987248f,0.987263f,0.987279f,0.987294f,0.987309f,0.987324f,0.987339f,0.987355f,0.98737f,0.987385f,0.9874f,0.987415f,0.987431f,0.987446f,0.987461f,0.987476f,0.987491f,0.987506f,0.987521f,0.987536f,0.987552f,0.987567f,0.987582f,0.987597f,0.987612f,0.987627f,0.987642f,0.987657f,0.987672f,0.987687f,0.987702f,0.987717f,0.987732f,0.987747f,0.987762f,0.987777f,0.987792f,0.987807f,0.987821f,0.987836f,0.987851f,0.987866f,0.987881f,0.987896f,0.987911f,0.987926f,0.98794f,0.987955f,0.98797f,0.987985f,0.988f,0.988015f,0.988029f,0.988044f,0.988059f,0.988074f,0.988088f,0.988103f,0.988118f,0.988133f,0.988147f,0.988162f,0.988177f,0.988192f,0.988206f,0.988221f,0.988236f,0.98825f,0.988265f,0.98828f,0.988294f,0.988309f,0.988323f,0.988338f,0.988353f,0.988367f,0.988382f,0.988396f,0.988411f,0.988425f,0.98844f,0.988455f,0.988469f,0.988484f,0.988498f,0.988513f,0.988527f,0.988541f,0.988556f,0.98857f,0.988585f,0.988599f,0.988614f,0.988628f,0.988643f,0.988657f,0.988671f,0.988686f,0.9887f,0.988715f,0.988729f,0.988743f,0.988758f,0.988772f,0.988786f,0.988801f,0.988815f,0.988829f,0.988843f,0.988858f,0.988872f,0.988886f,0.9889f,0.988915f,0.988929f,0.988943f,0.988957f,0.988972f,0.988986f,0.989f,0.989014f,0.989028f,0.989042f,0.989057f,0.989071f,0.989085f,0.989099f,0.989113f,0.989127f,0.989141f,0.989155f,0.989169f,0.989184f,0.989198f,0.989212f,0.989226f,0.98924f,0.989254f,0.989268f,0.989282f,0.989296f,0.98931f,0.989324f,0.989338f,0.989352f,0.989366f,0.98938f,0.989393f,0.989407f,0.989421f,0.989435f,0.989449f,0.989463f,0.989477f,0.989491f,0.989505f,0.989518f,0.989532f,0.989546f,0.98956f,0.989574f,0.989588f,0.989601f,0.989615f,0.989629f,0.989643f,0.989656f,0.98967f,0.989684f,0.989698f,0.989711f,0.989725f,0.989739f,0.989752f,0.989766f,0.98978f,0.989794f,0.989807f,0.989821f,0.989834f,0.989848f,0.989862f,0.989875f,0.989889f,0.989902f,0.989916f,0.98993f,0.989943f,0.989957f,0.98997f,0.989984f,0.989997f,0.990011f,0.990025f,0.990038f,0.990051f,0.990065f,0.990078f,0.990092f,0.990105f,0.990119f,0.990132f,0.990146f,0.990159f,0.990173f,0.990186f,0.990199f,0.990213f,0.990226f,0.990239f,0.990253f,0.990266f,0.990279f,0.990293f,0.990306f,0.990319f,0.990333f,0.990346f,0.990359f,0.990373f,0.990386f,0.990399f,0.990412f,0.990426f,0.990439f,0.990452f,0.990465f,0.990479f,0.990492f,0.990505f,0.990518f,0.990531f,0.990544f,0.990558f,0.990571f,0.990584f,0.990597f,0.99061f,0.990623f,0.990636f,0.990649f,0.990662f,0.990675f,0.990689f,0.990702f,0.990715f,0.990728f,0.990741f,0.990754f,0.990767f,0.99078f,0.990793f,0.990806f,0.990819f,0.990832f,0.990844f,0.990857f,0.99087f,0.990883f,0.990896f,0.990909f,0.990922f,0.990935f,0.990948f,0.990961f,0.990973f,0.990986f,0.990999f,0.991012f,0.991025f,0.991038f,0.99105f,0.991063f,0.991076f,0.991089f,0.991102f,0.991114f,0.991127f,0.99114f,0.991153f,0.991165f,0.991178f,0.991191f,0.991203f,0.991216f,0.991229f,0.991241f,0.991254f,0.991267f,0.991279f,0.991292f,0.991305f,0.991317f,0.99133f,0.991342f,0.991355f,0.991368f,0.99138f,0.991393f,0.991405f,0.991418f,0.99143f,0.991443f,0.991455f,0.991468f,0.99148f,0.991493f,0.991505f,0.991518f,0.99153f,0.991543f,0.991555f,0.991567f,0.99158f,0.991592f,0.991605f,0.991617f,0.991629f,0.991642f,0.991654f,0.991667f,0.991679f,0.991691f,0.991704f,0.991716f,0.991728f,0.991741f,0.991753f,0.991765f,0.991777f,0.99179f,0.991802f,0.991814f,0.991826f,0.991839f,0.991851f,0.991863f,0.991875f,0.991887f,0.9919f,0.991912f,0.991924f,0.991936f,0.991948f,0.99196f,0.991973f,0.991985f,0.991997f,0.992009f,0.992021f,0.992033f,0.992045f,0.992057f,0.992069f,0.992081f,0.992093f,0.992105f,0.992117f,0.992129f,0.992141f,0.992153f,0.992165f,0.992177f,0.992189f,0.992201f,0.992213f,0.992225f,0.992237f,0.992249f,0.992261f,0.992273f,0.992285f,0.992297f,0.992308f,0.99232f,0.992332f,0.992344f,0.992356f,0.992368f,0.992379f,0.992391f,0.992403f,0.992415f,0.992427f,0.992438f,0.99245f,0.992462f,0.992474f,0.992485f,0.992497f,0.992509f,0.992521f,0.992532f,0.992544f,0.992556f,0.992567f,0.992579f,0.992591f,0.992602f,0.992614f,0.992626f,0.992637f,0.992649f,0.99266f,0.992672f,0.992684f,0.992695f,0.992707f,0.992718f,0.99273f,0.992741f,0.992753f,0.992764f,0.992776f,0.992787f,0.992799f,0.99281f,0.992822f,0.992833f,0.992845f,0.992856f,0.992868f,0.992879f,0.99289f,0.992902f,0.992913f,0.992925f,0.992936f,0.992947f,0.992959f,0.99297f,0.992981f,0.992993f,0.993004f,0.993015f,0.993027f,0.993038f,0.993049f,0.993061f,0.993072f,0.993083f,0.993094f,0.993106f,0.993117f,0.993128f,0.993139f,0.99315f,0.993162f,0.993173f,0.993184f,0.993195f,0.993206f,0.993218f,0.993229f,0.99324f,0.993251f,0.993262f,0.993273f,0.993284f,0.993295f,0.993306f,0.993317f,0.993329f,0.99334f,0.993351f,0.993362f,0.993373f,0.993384f,0.993395f,0.993406f,0.993417f,0.993428f,0.993439f,0.99345f,0.993461f,0.993472f,0.993482f,0.993493f,0.993504f,0.993515f,0.993526f,0.993537f,0.993548f,0.993559f,0.99357f,0.99358f,0.993591f,0.993602f,0.993613f,0.993624f,0.993635f,0.993645f,0.993656f,0.993667f,0.993678f,0.993688f,0.993699f,0.99371f,0.993721f,0.993731f,0.993742f,0.993753f,0.993764f,0.993774f,0.993785f,0.993796f,0.993806f,0.993817f,0.993827f,0.993838f,0.993849f,0.993859f,0.99387f,0.993881f,0.993891f,0.993902f,0.993912f,0.993923f,0.993933f,0.993944f,0.993954f,0.993965f,0.993975f,0.993986f,0.993997f,0.994007f,0.994017f,0.994028f,0.994038f,0.994049f,0.994059f,0.99407f,0.99408f,0.99409f,0.994101f,0.994111f,0.994122f,0.994132f,0.994142f,0.994153f,0.994163f,0.994173f,0.994184f,0.994194f,0.994204f,0.994215f,0.994225f,0.994235f,0.994246f,0.994256f,0.994266f,0.994276f,0.994287f,0.994297f,0.994307f,0.994317f,0.994327f,0.994338f,0.994348f,0.994358f,0.994368f,0.994378f,0.994388f,0.994399f,0.994409f,0.994419f,0.994429f,0.994439f,0.994449f,0.994459f,0.994469f,0.994479f,0.994489f,0.9945f,0.99451f,0.99452f,0.99453f,0.99454f,0.99455f,0.99456f,0.99457f,0.99458f,0.99459f,0.994599f,0.994609f,0.994619f,0.994629f,0.994639f,0.994649f,0.994659f,0.994669f,0.994679f,0.994689f,0.994699f,0.994708f,0.994718f,0.994728f,0.994738f,0.994748f,0.994757f,0.994767f,0.994777f,0.994787f,0.994797f,0.994806f,0.994816f,0.994826f,0.994836f,0.994845f,0.994855f,0.994865f,0.994874f,0.994884f,0.994894f,0.994904f,0.994913f,0.994923f,0.994932f,0.994942f,0.994952f,0.994961f,0.994971f,0.994981f,0.99499f,0.995f,0.995009f,0.995019f,0.995028f,0.995038f,0.995048f,0.995057f,0.995067f,0.995076f,0.995086f,0.995095f,0.995104f,0.995114f,0.995123f,0.995133f,0.995142f,0.995152f,0.995161f,0.995171f,0.99518f,0.995189f,0.995199f,0.995208f,0.995218f,0.995227f,0.995236f,0.995246f,0.995255f,0.995264f,0.995274f,0.995283f,0.995292f,0.995301f,0.995311f,0.99532f,0.995329f,0.995339f,0.995348f,0.995357f,0.995366f,0.995375f,0.995385f,0.995394f,0.995403f,0.995412f,0.995421f,0.995431f,0.99544f,0.995449f,0.995458f,0.995467f,0.995476f,0.995485f,0.995494f,0.995503f,0.995513f,0.995522f,0.995531f,0.99554f,0.995549f,0.995558f,0.995567f,0.995576f,0.995585f,0.995594f,0.995603f,0.995612f,0.995621f,0.99563f,0.995639f,0.995648f,0.995657f,0.995665f,0.995674f,0.995683f,0.995692f,0.995701f,0.99571f,0.995719f,0.995728f,0.995737f,0.995745f,0.995754f,0.995763f,0.995772f,0.995781f,0.995789f,0.995798f,0.995807f,0.995816f,0.995825f,0.995833f,0.995842f,0.995851f,0.995859f,0.995868f,0.995877f,0.995886f,0.995894f,0.995903f,0.995912f,0.99592f,0.995929f,0.995938f,0.995946f,0.995955f,0.995963f,0.995972f,0.995981f,0.995989f,0.995998f,0.996006f,0.996015f,0.996023f,0.996032f,0.99604f,0.996049f,0.996057f,0.996066f,0.996074f,0.996083f,0.996091f,0.9961f,0.996108f,0.996117f,0.996125f,0.996134f,0.996142f,0.99615f,0.996159f,0.996167f,0.996176f,0.996184f,0.996192f,0.996201f,0.996209f,0.996217f,0.996226f,0.996234f,0.996242f,0.996251f,0.996259f,0.996267f,0.996275f,0.996284f,0.996292f,0.9963f,0.996309f,0.996317f,0.996325f,0.996333f,0.996341f,0.99635f,0.996358f,0.996366f,0.996374f,0.996382f,0.99639f,0.996399f,0.996407f,0.996415f,0.996423f,0.996431f,0.996439f,0.996447f,0.996455f,0.996463f,0.996471f,0.996479f,0.996487f,0.996495f,0.996503f,0.996511f,0.996519f,0.996527f,0.996535f,0.996543f,0.996551f,0.996559f,0.996567f,0.996575f,0.996583f,0.996591f,0.996599f,0.996607f,0.996615f,0.996623f,0.99663f,0.996638f,0.996646f,0.996654f,0.996662f,0.99667f,0.996677f,0.996685f,0.996693f,0.996701f,0.996709f,0.996716f,0.996724f,0.996732f,0.99674f,0.996747f,0.996755f,0.996763f,0.99677f,0.996778f,0.996786f,0.996794f,0.996801f,0.996809f,0.996816f,0.996824f,0.996832f,0.996839f,0.996847f,0.996855f,0.996862f,0.99687f,0.996877f,0.996885f,0.996892f,0.9969f,0.996908f,0.996915f,0.996923f,0.99693f,0.996938f,0.996945f,0.996953f,0.99696f,0.996968f,0.996975f,0.996982f,0.99699f,0.996997f,0.997005f,0.997012f,0.99702f,0.997027f,0.997034f,0.997042f,0.997049f,0.997056f,0.997064f,0.997071f,0.997078f,0.997086f,0.997093f,0.9971f,0.997108f,0.997115f,0.997122f,0.997129f,0.997137f,0.997144f,0.997151f,0.997158f,0.997166f,0.997173f,0.99718f,0.997187f,0.997194f,0.997202f,0.997209f,0.997216f,0.997223f,0.99723f,0.997237f,0.997244f,0.997252f,0.997259f,0.997266f,0.997273f,0.99728f,0.997287f,0.997294f,0.997301f,0.997308f,0.997315f,0.997322f,0.997329f,0.997336f,0.997343f,0.99735f,0.997357f,0.997364f,0.997371f,0.997378f,0.997385f,0.997392f,0.997399f,0.997406f,0.997413f,0.997419f,0.997426f,0.997433f,0.99744f,0.997447f,0.997454f,0.99746f,0.997467f,0.997474f,0.997481f,0.997488f,0.997495f,0.997501f,0.997508f,0.997515f,0.997522f,0.997528f,0.997535f,0.997542f,0.997549f,0.997555f,0.997562f,0.997569f,0.997575f,0.997582f,0.997589f,0.997595f,0.997602f,0.997608f,0.997615f,0.997622f,0.997628f,0.997635f,0.997642f,0.997648f,0.997655f,0.997661f,0.997668f,0.997674f,0.997681f,0.997687f,0.997694f,0.9977f,0.997707f,0.997713f,0.99772f,0.997726f,0.997733f,0.997739f,0.997746f,0.997752f,0.997759f,0.997765f,0.997771f,0.997778f,0.997784f,0.99779f,0.997797f,0.997803f,0.99781f,0.997816f,0.997822f,0.997829f,0.997835f,0.997841f,0.997847f,0.997854f,0.99786f,0.997866f,0.997872f,0.997879f,0.997885f,0.997891f,0.997897f,0.997904f,0.99791f,0.997916f,0.997922f,0.997928f,0.997935f,0.997941f,0.997947f,0.997953f,0.997959f,0.997965f,0.997971f,0.997977f,0.997984f,0.99799f,0.997996f,0.998002f,0.998008f,0.998014f,0.99802f,0.998026f,0.998032f,0.998038f,0.998044f,0.99805f,0.998056f,0.998062f,0.998068f,0.998074f,0.99808f,0.998086f,0.998092f,0.998097f,0.998103f,0.998109f,0.998115f,0.998121f,0.998127f,0.998133f,0.998139f,0.998145f,0.99815f,0.998156f,0.998162f,0.998168f,0.998174f,0.998179f,0.998185f,0.998191f,0.998197f,0.998202f,0.998208f,0.998214f,0.99822f,0.998225f,0.998231f,0.998237f,0.998242f,0.998248f,0.998254f,0.998259f,0.998265f,0.998271f,0.998276f,0.998282f,0.998288f,0.998293f,0.998299f,0.998304f,0.99831f,0.998315f,0.998321f,0.998327f,0.998332f,0.998338f,0.998343f,0.998349f,0.998354f,0.99836f,0.998365f,0.998371f,0.998376f,0.998382f,0.998387f,0.998392f,0.998398f,0.998403f,0.998409f,0.998414f,0.99842f,0.998425f,0.99843f,0.998436f,0.998441f,0.998446f,0.998452f,0.998457f,0.998462f,0.998468f,0.998473f,0.998478f,0.998484f,0.998489f,0.998494f,0.998499f,0.998505f,0.99851f,0.998515f,0.99852f,0.998525f,0.998531f,0.998536f,0.998541f,0.998546f,0.998551f,0.998556f,0.998562f,0.998567f,0.998572f,0.998577f,0.998582f,0.998587f,0.998592f,0.998597f,0.998602f,0.998608f,0.998613f,0.998618f,0.998623f,0.998628f,0.998633f,0.998638f,0.998643f,0.998648f,0.998653f,0.998658f,0.998663f,0.998668f,0.998672f,0.998677f,0.998682f,0.998687f,0.998692f,0.998697f,0.998702f,0.998707f,0.998712f,0.998717f,0.998721f,0.998726f,0.998731f,0.998736f,0.998741f,0.998746f,0.99875f,0.998755f,0.99876f,0.998765f,0.998769f,0.998774f,0.998779f,0.998784f,0.998788f,0.998793f,0.998798f,0.998802f,0.998807f,0.998812f,0.998817f,0.998821f,0.998826f,0.99883f,0.998835f,0.99884f,0.998844f,0.998849f,0.998854f,0.998858f,0.998863f,0.998867f,0.998872f,0.998876f,0.998881f,0.998885f,0.99889f,0.998894f,0.998899f,0.998903f,0.998908f,0.998912f,0.998917f,0.998921f,0.998926f,0.99893f,0.998935f,0.998939f,0.998944f,0.998948f,0.998952f,0.998957f,0.998961f,0.998965f,0.99897f,0.998974f,0.998978f,0.998983f,0.998987f,0.998991f,0.998996f,0.999f,0.999004f,0.999009f,0.999013f,0.999017f,0.999021f,0.999026f,0.99903f,0.999034f,0.999038f,0.999042f,0.999047f,0.999051f,0.999055f,0.999059f,0.999063f,0.999067f,0.999072f,0.999076f,0.99908f,0.999084f,0.999088f,0.999092f,0.999096f,0.9991f,0.999104f,0.999108f,0.999112f,0.999116f,0.99912f,0.999124f,0.999128f,0.999132f,0.999136f,0.99914f,0.999144f,0.999148f,0.999152f,0.999156f,0.99916f,0.999164f,0.999168f,0.999172f,0.999176f,0.99918f,0.999184f,0.999187f,0.999191f,0.999195f,0.999199f,0.999203f,0.999207f,0.99921f,0.999214f,0.999218f,0.999222f,0.999226f,0.999229f,0.999233f,0.999237f,0.999241f,0.999244f,0.999248f,0.999252f,0.999256f,0.999259f,0.999263f,0.999267f,0.99927f,0.999274f,0.999278f,0.999281f,0.999285f,0.999288f,0.999292f,0.999296f,0.999299f,0.999303f,0.999306f,0.99931f,0.999314f,0.999317f,0.999321f,0.999324f,0.999328f,0.999331f,0.999335f,0.999338f,0.999342f,0.999345f,0.999349f,0.999352f,0.999355f,0.999359f,0.999362f,0.999366f,0.999369f,0.999373f,0.999376f,0.999379f,0.999383f,0.999386f,0.999389f,0.999393f,0.999396f,0.999399f,0.999403f,0.999406f,0.999409f,0.999413f,0.999416f,0.999419f,0.999422f,0.999426f,0.999429f,0.999432f,0.999435f,0.999439f,0.999442f,0.999445f,0.999448f,0.999451f,0.999455f,0.999458f,0.999461f,0.999464f,0.999467f,0.99947f,0.999473f,0.999477f,0.99948f,0.999483f,0.999486f,0.999489f,0.999492f,0.999495f,0.999498f,0.999501f,0.999504f,0.999507f,0.99951f,0.999513f,0.999516f,0.999519f,0.999522f,0.999525f,0.999528f,0.999531f,0.999534f,0.999537f,0.99954f,0.999543f,0.999545f,0.999548f,0.999551f,0.999554f,0.999557f,0.99956f,0.999563f,0.999565f,0.999568f,0.999571f,0.999574f,0.999577f,0.999579f,0.999582f,0.999585f,0.999588f,0.999591f,0.999593f,0.999596f,0.999599f,0.999601f,0.999604f,0.999607f,0.99961f,0.999612f,0.999615f,0.999618f,0.99962f,0.999623f,0.999625f,0.999628f,0.999631f,0.999633f,0.999636f,0.999638f,0.999641f,0.999644f,0.999646f,0.999649f,0.999651f,0.999654f,0.999656f,0.999659f,0.999661f,0.999664f,0.999666f,0.999669f,0.999671f,0.999674f,0.999676f,0.999678f,0.999681f,0.999683f,0.999686f,0.999688f,0.999691f,0.999693f,0.999695f,0.999698f,0.9997f,0.999702f,0.999705f,0.999707f,0.999709f,0.999712f,0.999714f,0.999716f,0.999718f,0.999721f,0.999723f,0.999725f,0.999727f,0.99973f,0.999732f,0.999734f,0.999736f,0.999739f,0.999741f,0.999743f,0.999745f,0.999747f,0.999749f,0.999752f,0.999754f,0.999756f,0.999758f,0.99976f,0.999762f,0.999764f,0.999766f,0.999768f,0.99977f,0.999772f,0.999775f,0.999777f,0.999779f,0.999781f,0.999783f,0.999785f,0.999787f,0.999789f,0.99979f,0.999792f,0.999794f,0.999796f,0.999798f,0.9998f,0.999802f,0.999804f,0.999806f,0.999808f,0.99981f,0.999812f,0.999813f,0.999815f,0.999817f,0.999819f,0.999821f,0.999823f,0.999824f,0.999826f,0.999828f,0.99983f,0.999831f,0.999833f,0.999835f,0.999837f,0.999838f,0.99984f,0.999842f,0.999844f,0.999845f,0.999847f,0.999849f,0.99985f,0.999852f,0.999854f,0.999855f,0.999857f,0.999858f,0.99986f,0.999862f,0.999863f,0.999865f,0.999866f,0.999868f,0.99987f,0.999871f,0.999873f,0.999874f,0.999876f,0.999877f,0.999879f,0.99988f,0.999882f,0.999883f,0.999885f,0.999886f,0.999887f,0.999889f,0.99989f,0.999892f,0.999893f,0.999894f,0.999896f,0.999897f,0.999899f,0.9999f,0.999901f,0.999903f,0.999904f,0.999905f,0.999907f,0.999908f,0.999909f,0.999911f,0.999912f,0.999913f,0.999914f,0.999916f,0.999917f,0.999918f,0.999919f,0.999921f,0.999922f,0.999923f,0.999924f,0.999925f,0.999926f,0.999928f,0.999929f,0.99993f,0.999931f,0.999932f,0.999933f,0.999934f,0.999935f,0.999937f,0.999938f,0.999939f,0.99994f,0.999941f,0.999942f,0.999943f,0.999944f,0.999945f,0.999946f,0.999947f,0.999948f,0.999949f,0.99995f,0.999951f,0.999952f,0.999953f,0.999954f,0.999955f,0.999955f,0.999956f,0.999957f,0.999958f,0.999959f,0.99996f,0.999961f,0.999961f,0.999962f,0.999963f,0.999964f,0.999965f,0.999966f,0.999966f,0.999967f,0.999968f,0.999969f,0.999969f,0.99997f,0.999971f,0.999972f,0.999972f,0.999973f,0.999974f,0.999974f,0.999975f,0.999976f,0.999977f,0.999977f,0.999978f,0.999978f,0.999979f,0.99998f,0.99998f,0.999981f,0.999981f,0.999982f,0.999983f,0.999983f,0.999984f,0.999984f,0.999985f,0.999985f,0.999986f,0.999986f,0.999987f,0.999987f,0.999988f,0.999988f,0.999989f,0.999989f,0.99999f,0.99999f,0.99999f,0.999991f,0.999991f,0.999992f,0.999992f,0.999992f,0.999993f,0.999993f,0.999994f,0.999994f,0.999994f,0.999995f,0.999995f,0.999995f,0.999995f,0.999996f,0.999996f,0.999996f,0.999997f,0.999997f,0.999997f,0.999997f,0.999997f,0.999998f,0.999998f,0.999998f,0.999998f,0.999998f,0.999999f,0.999999f,0.999999f,0.999999f,0.999999f,0.999999f,0.999999f,0.999999f,1.f,1.f,1.f,1.f,1.f,1.f,1.f,1.f,1.f,1.f,1.f,1.f,1.f,1.f,1.f,1.f,1.f,1.f,1.f,1.f,0.999999f,0.999999f,0.999999f,0.999999f,0.999999f,0.999999f,0.999999f,0.999999f,0.999998f,0.999998f,0.999998f,0.999998f,0.999998f,0.999997f,0.999997f,0.999997f,0.999997f,0.999997f,0.999996f,0.999996f,0.999996f,0.999995f,0.999995f,0.999995f,0.999995f,0.999994f,0.999994f,0.999994f,0.999993f,0.999993f,0.999992f,0.999992f,0.999992f,0.999991f,0.999991f,0.99999f,0.99999f,0.99999f,0.999989f,0.999989f,0.999988f,0.999988f,0.999987f,0.999987f,0.999986f,0.999986f,0.999985f,0.999985f,0.999984f,0.999984f,0.999983f,0.999983f,0.999982f,0.999981f,0.999981f,0.99998f,0.99998f,0.999979f,0.999978f,0.999978f,0.999977f,0.999977f,0.999976f,0.999975f,0.999974f,0.999974f,0.999973f,0.999972f,0.999972f,0.999971f,0.99997f,0.999969f,0.999969f,0.999968f,0.999967f,0.999966f,0.999966f,0.999965f,0.999964f,0.999963f,0.999962f,0.999961f,0.999961f,0.99996f,0.999959f,0.999958f,0.999957f,0.999956f,0.999955f,0.999955f,0.999954f,0.999953f,0.999952f,0.999951f,0.99995f,0.999949f,0.999948f,0.999947f,0.999946f,0.999945f,0.999944f,0.999943f,0.999942f,0.999941f,0.99994f,0.999939f,0.999938f,0.999937f,0.999935f,0.999934f,0.999933f,0.999932f,0.999931f,0.99993f,0.999929f,0.999928f,0.999926f,0.999925f,0.999924f,0.999923f,0.999922f,0.999921f,0.999919f,0.999918f,0.999917f,0.999916f,0.999914f,0.999913f,0.999912f,0.999911f,0.999909f,0.999908f,0.999907f,0.999905f,0.999904f,0.999903f,0.999901f,0.9999f,0.999899f,0.999897f,0.999896f,0.999894f,0.999893f,0.999892f,0.99989f,0.999889f,0.999887f,0.999886f,0.999885f,0.999883f,0.999882f,0.99988f,0.999879f,0.999877f,0.999876f,0.999874f,0.999873f,0.999871f,0.99987f,0.999868f,0.999866f,0.999865f,0.999863f,0.999862f,0.99986f,0.999858f,0.999857f,0.999855f,0.999854f,0.999852f,0.99985f,0.999849f,0.999847f,0.999845f,0.999844f,0.999842f,0.99984f,0.999838f,0.999837f,0.999835f,0.999833f,0.999831f,0.99983f,0.999828f,0.999826f,0.999824f,0.999823f,0.999821f,0.999819f,0.999817f,0.999815f,0.999813f,0.999812f,0.99981f,0.999808f,0.999806f,0.999804f,0.999802f,0.9998f,0.999798f,0.999796f,0.999794f,0.999792f,0.99979f,0.999789f,0.999787f,0.999785f,0.999783f,0.999781f,0.999779f,0.999777f,0.999775f,0.999772f,0.99977f,0.999768f,0.999766f,0.999764f,0.999762f,0.99976f,0.999758f,0.999756f,0.999754f,0.999752f,0.999749f,0.999747f,0.999745f,0.999743f,0.999741f,0.999739f,0.999736f,0.999734f,0.999732f,0.99973f,0.999727f,0.999725f,0.999723f,0.999721f,0.999718f,0.999716f,0.999714f,0.999712f,0.999709f,0.999707f,0.999705f,0.999702f,0.9997f,0.999698f,0.999695f,0.999693f,0.999691f,0.999688f,0.999686f,0.999683f,0.999681f,0.999678f,0.999676f,0.999674f,0.999671f,0.999669f,0.999666f,0.999664f,0.999661f,0.999659f,0.999656f,0.999654f,0.999651f,0.999649f,0.999646f,0.999644f,0.999641f,0.999638f,0.999636f,0.999633f,0.999631f,0.999628f,0.999625f,0.999623f,0.99962f,0.999618f,0.999615f,0.999612f,0.99961f,0.999607f,0.999604f,0.999601f,0.999599f,0.999596f,0.999593f,0.999591f,0.999588f,0.999585f,0.999582f,0.999579f,0.999577f,0.999574f,0.999571f,0.999568f,0.999565f,0.999563f,0.99956f,0.999557f,0.999554f,0.999551f,0.999548f,0.999545f,0.999543f,0.99954f,0.999537f,0.999534f,0.999531f,0.999528f,0.999525f,0.999522f,0.999519f,0.999516f,0.999513f,0.99951f,0.999507f,0.999504f,0.999501f,0.999498f,0.999495f,0.999492f,0.999489f,0.999486f,0.999483f,0.99948f,0.999477f,0.999473f,0.99947f,0.999467f,0.999464f,0.999461f,0.999458f,0.999455f,0.999451f,0.999448f,0.999445f,0.999442f,0.999439f,0.999435f,0.999432f,0.999429f,0.999426f,0.999422f,0.999419f,0.999416f,0.999413f,0.999409f,0.999406f,0.999403f,0.999399f,0.999396f,0.999393f,0.999389f,0.999386f,0.999383f,0.999379f,0.999376f,0.999373f,0.999369f,0.999366f,0.999362f,0.999359f,0.999355f,0.999352f,0.999349f,0.999345f,0.999342f,0.999338f,0.999335f,0.999331f,0.999328f,0.999324f,0.999321f,0.999317f,0.999314f,0.99931f,0.999306f,0.999303f,0.999299f,0.999296f,0.999292f,0.999288f,0.999285f,0.999281f,0.999278f,0.999274f,0.99927f,0.999267f,0.999263f,0.999259f,0.999256f,0.999252f,0.999248f,0.999244f,0.999241f,0.999237f,0.999233f,0.999229f,0.999226f,0.999222f,0.999218f,0.999214f,0.99921f,0.999207f,0.999203f,0.999199f,0.999195f,0.999191f,0.999187f,0.999184f,0.99918f,0.999176f,0.999172f,0.999168f,0.999164f,0.99916f,0.999156f,0.999152f,0.999148f,0.999144f,0.99914f,0.999136f,0.999132f,0.999128f,0.999124f,0.99912f,0.999116f,0.999112f,0.999108f,0.999104f,0.9991f,0.999096f,0.999092f,0.999088f,0.999084f,0.99908f,0.999076f,0.999072f,0.999067f,0.999063f,0.999059f,0.999055f,0.999051f,0.999047f,0.999042f,0.999038f,0.999034f,0.99903f,0.999026f,0.999021f,0.999017f,0.999013f,0.999009f,0.999004f,0.999f,0.998996f,0.998991f,0.998987f,0.998983f,0.998978f,0.998974f,0.99897f,0.998965f,0.998961f,0.998957f,0.998952f,0.998948f,0.998944f,0.998939f,0.998935f,0.99893f,0.998926f,0.998921f,0.998917f,0.998912f,0.998908f,0.998903f,0.998899f,0.998894f,0.99889f,0.998885f,0.998881f,0.998876f,0.998872f,0.998867f,0.998863f,0.998858f,0.998854f,0.998849f,0.998844f,0.99884f,0.998835f,0.99883f,0.998826f,0.998821f,0.998817f,0.998812f,0.998807f,0.998802f,0.998798f,0.998793f,0.998788f,0.998784f,0.998779f,0.998774f,0.998769f,0.998765f,0.99876f,0.998755f,0.99875f,0.998746f,0.998741f,0.998736f,0.998731f,0.998726f,0.998721f,0.998717f,0.998712f,0.998707f,0.998702f,0.998697f,0.998692f,0.998687f,0.998682f,0.998677f,0.998672f,0.998668f,0.998663f,0.998658f,0.998653f,0.998648f,0.998643f,0.998638f,0.998633f,0.998628f,0.998623f,0.998618f,0.998613f,0.998608f,0.998602f,0.998597f,0.998592f,0.998587f,0.998582f,0.998577f,0.998572f,0.998567f,0.998562f,0.998556f,0.998551f,0.998546f,0.998541f,0.998536f,0.998531f,0.998525f,0.99852f,0.998515f,0.99851f,0.998505f,0.998499f,0.998494f,0.998489f,0.998483f,0.998478f,0.998473f,0.998468f,0.998462f,0.998457f,0.998452f,0.998446f,0.998441f,0.998436f,0.99843f,0.998425f,0.99842f,0.998414f,0.998409f,0.998403f,0.998398f,0.998392f,0.998387f,0.998382f,0.998376f,0.998371f,0.998365f,0.99836f,0.998354f,0.998349f,0.998343f,0.998338f,0.998332f,0.998327f,0.998321f,0.998315f,0.99831f,0.998304f,0.998299f,0.998293f,0.998288f,0.998282f,0.998276f,0.998271f,0.998265f,0.998259f,0.998254f,0.998248f,0.998242f,0.998237f,0.998231f,0.998225f,0.99822f,0.998214f,0.998208f,0.998202f,0.998197f,0.998191f,0.998185f,0.998179f,0.998174f,0.998168f,0.998162f,0.998156f,0.99815f,0.998144f,0.998139f,0.998133f,0.998127f,0.998121f,0.998115f,0.998109f,0.998103f,0.998097f,0.998092f,0.998086f,0.99808f,0.998074f,0.998068f,0.998062f,0.998056f,0.99805f,0.998044f,0.998038f,0.998032f,0.998026f,0.99802f,0.998014f,0.998008f,0.998002f,0.997996f,0.99799f,0.997984f,0.997977f,0.997971f,0.997965f,0.997959f,0.997953f,0.997947f,0.997941f,0.997935f,0.997928f,0.997922f,0.997916f,0.99791f,0.997904f,0.997897f,0.997891f,0.997885f,0.997879f,0.997872f,0.997866f,0.99786f,0.997854f,0.997847f,0.997841f,0.997835f,0.997828f,0.997822f,0.997816f,0.99781f,0.997803f,0.997797f,0.99779f,0.997784f,0.997778f,0.997771f,0.997765f,0.997759f,0.997752f,0.997746f,0.997739f,0.997733f,0.997726f,0.99772f,0.997713f,0.997707f,0.9977f,0.997694f,0.997687f,0.997681f,0.997674f,0.997668f,0.997661f,0.997655f,0.997648f,0.997642f,0.997635f,0.997628f,0.997622f,0.997615f,0.997608f,0.997602f,0.997595f,0.997589f,0.997582f,0.997575f,0.997569f,0.997562f,0.997555f,0.997549f,0.997542f,0.997535f,0.997528f,0.997522f,0.997515f,0.997508f,0.997501f,0.997495f,0.997488f,0.997481f,0.997474f,0.997467f,0.99746f,0.997454f,0.997447f,0.99744f,0.997433f,0.997426f,0.997419f,0.997413f,0.997406f,0.997399f,0.997392f,0.997385f,0.997378f,0.997371f,0.997364f,0.997357f,0.99735f,0.997343f,0.997336f,0.997329f,0.997322f,0.997315f,0.997308f,0.997301f,0.997294f,0.997287f,0.99728f,0.997273f,0.997266f,0.997259f,0.997252f,0.997244f,0.997237f,0.99723f,0.997223f,0.997216f,0.997209f,0.997202f,0.997194f,0.997187f,0.99718f,0.997173f,0.997166f,0.997158f,0.997151f,0.997144f,0.997137f,0.997129f,0.997122f,0.997115f,0.997108f,0.9971f,0.997093f,0.997086f,0.997078f,0.997071f,0.997064f,0.997056f,0.997049f,0.997042f,0.997034f,0.997027f,0.99702f,0.997012f,0.997005f,0.996997f,0.99699f,0.996982f,0.996975f,0.996968f,0.99696f,0.996953f,0.996945f,0.996938f,0.99693f,0.996923f,0.996915f,0.996908f,0.9969f,0.996892f,0.996885f,0.996877f,0.99687f,0.996862f,0.996855f,0.996847f,0.996839f,0.996832f,0.996824f,0.996816f,0.996809f,0.996801f,0.996794f,0.996786f,0.996778f,0.99677f,0.996763f,0.996755f,0.996747f,0.99674f,0.996732f,0.996724f,0.996716f,0.996709f,0.996701f,0.996693f,0.996685f,0.996677f,0.99667f,0.996662f,0.996654f,0.996646f,0.996638f,0.99663f,0.996623f,0.996615f,0.996607f,0.996599f,0.996591f,0.996583f,0.996575f,0.996567f,0.996559f,0.996551f,0.996543f,0.996535f,0.996527f,0.996519f,0.996511f,0.996503f,0.996495f,0.996487f,0.996479f,0.996471f,0.996463f,0.996455f,0.996447f,0.996439f,0.996431f,0.996423f,0.996415f,0.996407f,0.996398f,0.99639f,0.996382f,0.996374f,0.996366f,0.996358f,0.99635f,0.996341f,0.996333f,0.996325f,0.996317f,0.996309f,0.9963f,0.996292f,0.996284f,0.996275f,0.996267f,0.996259f,0.996251f,0.996242f,0.996234f,0.996226f,0.996217f,0.996209f,0.996201f,0.996192f,0.996184f,0.996176f,0.996167f,0.996159f,0.99615f,0.996142f,0.996134f,0.996125f,0.996117f,0.996108f,0.9961f,0.996091f,0.996083f,0.996074f,0.996066f,0.996057f,0.996049f,0.99604f,0.996032f,0.996023f,0.996015f,0.996006f,0.995998f,0.995989f,0.995981f,0.995972f,0.995963f,0.995955f,0.995946f,0.995938f,0.995929f,0.99592f,0.995912f,0.995903f,0.995894f,0.995886f,0.995877f,0.995868f,0.995859f,0.995851f,0.995842f,0.995833f,0.995825f,0.995816f,0.995807f,0.995798f,0.995789f,0.995781f,0.995772f,0.995763f,0.995754f,0.995745f,0.995737f,0.995728f,0.995719f,0.99571f,0.995701f,0.995692f,0.995683f,0.995674f,0.995665f,0.995657f,0.995648f,0.995639f,0.99563f,0.995621f,0.995612f,0.995603f,0.995594f,0.995585f,0.995576f,0.995567f,0.995558f,0.995549f,0.99554f,0.995531f,0.995522f,0.995513f,0.995503f,0.995494f,0.995485f,0.995476f,0.995467f,0.995458f,0.995449f,0.99544f,0.995431f,0.995421f,0.995412f,0.995403f,0.995394f,0.995385f,0.995375f,0.995366f,0.995357f,0.995348f,0.995338f,0.995329f,0.99532f,0.995311f,0.995301f,0.995292f,0.995283f,0.995274f,0.995264f,0.995255f,0.995246f,0.995236f,0.995227f,0.995218f,0.995208f,0.995199f,0.995189f,0.99518f,0.995171f,0.995161f,0.995152f,0.995142f,0.995133f,0.995123f,0.995114f,0.995104f,0.995095f,0.995086f,0.995076f,0.995067f,0.995057f,0.995048f,0.995038f,0.995028f,0.995019f,0.995009f,0.995f,0.99499f,0.994981f,0.994971f,0.994961f,0.994952f,0.994942f,0.994932f,0.994923f,0.994913f,0.994904f,0.994894f,0.994884f,0.994874f,0.994865f,0.994855f,0.994845f,0.994836f,0.994826f,0.994816f,0.994806f,0.994797f,0.994787f,0.994777f,0.994767f,0.994757f,0.994748f,0.994738f,0.994728f,0.994718f,0.994708f,0.994699f,0.994689f,0.994679f,0.994669f,0.994659f,0.994649f,0.994639f,0.994629f,0.994619f,0.994609f,0.994599f,0.99459f,0.99458f,0.99457f,0.99456f,0.99455f,0.99454f,0.99453f,0.99452f,0.99451f,0.9945f,0.994489f,0.994479f,0.994469f,0.994459f,0.994449f,0.994439f,0.994429f,0.994419f,0.994409f,0.994399f,0.994388f,0.994378f,0.994368f,0.994358f,0.994348f,0.994338f,0.994327f,0.994317f,0.994307f,0.994297f,0.994287f,0.994276f,0.994266f,0.994256f,0.994246f,0.994235f,0.994225f,0.994215f,0.994204f,0.994194f,0.994184f,0.994173f,0.994163f,0.994153f,0.994142f,0.994132f,0.994122f,0.994111f,0.994101f,0.99409f,0.99408f,0.99407f,0.994059f,0.994049f,0.994038f,0.994028f,0.994017f,0.994007f,0.993996f,0.993986f,0.993975f,0.993965f,0.993954f,0.993944f,0.993933f,0.993923f,0.993912f,0.993902f,0.993891f,0.993881f,0.99387f,0.993859f,0.993849f,0.993838f,0.993827f,0.993817f,0.993806f,0.993796f,0.993785f,0.993774f,0.993763f,0.993753f,0.993742f,0.993731f,0.993721f,0.99371f,0.993699f,0.993688f,0.993678f,0.993667f,0.993656f,0.993645f,0.993635f,0.993624f,0.993613f,0.993602f,0.993591f,0.99358f,0.99357f,0.993559f,0.993548f,0.993537f,0.993526f,0.993515f,0.993504f,0.993493f,0.993482f,0.993472f,0.993461f,0.99345f,0.993439f,0.993428f,0.993417f,0.993406f,0.993395f,0.993384f,0.993373f,0.993362f,0.993351f,0.99334f,0.993329f,0.993317f,0.993306f,0.993295f,0.993284f,0.993273f,0.993262f,0.993251f,0.99324f,0.993229f,0.993218f,0.993206f,0.993195f,0.993184f,0.993173f,0.993162f,0.99315f,0.993139f,0.993128f,0.993117f,0.993106f,0.993094f,0.993083f,0.993072f,0.993061f,0.993049f,0.993038f,0.993027f,0.993015f,0.993004f,0.992993f,0.992981f,0.99297f,0.992959f,0.992947f,0.992936f,0.992925f,0.992913f,0.992902f,0.99289f,0.992879f,0.992868f,0.992856f,0.992845f,0.992833f,0.992822f,0.99281f,0.992799f,0.992787f,0.992776f,0.992764f,0.992753f,0.992741f,0.99273f,0.992718f,0.992707f,0.992695f,0.992684f,0.992672f,0.99266f,0.992649f,0.992637f,0.992626f,0.992614f,0.992602f,0.992591f,0.992579f,0.992567f,0.992556f,0.992544f,0.992532f,0.992521f,0.992509f,0.992497f,0.992485f,0.992474f,0.992462f,0.99245f,0.992438f,0.992427f,0.992415f,0.992403f,0.992391f,0.992379f,0.992368f,0.992356f,0.992344f,0.992332f,0.99232f,0.992308f,0.992297f,0.992285f,0.992273f,0.992261f,0.992249f,0.992237f,0.992225f,0.992213f,0.992201f,0.992189f,0.992177f,0.992165f,0.992153f,0.992141f,0.992129f,0.992117f,0.992105f,0.992093f,0.992081f,0.992069f,0.992057f,0.992045f,0.992033f,0.992021f,0.992009f,0.991997f,0.991985f,0.991973f,0.99196f,0.991948f,0.991936f,0.991924f,0.991912f,0.9919f,0.991887f,0.991875f,0.991863f,0.991851f,0.991839f,0.991826f,0.991814f,0.991802f,0.99179f,0.991777f,0.991765f,0.991753f,0.991741f,0.991728f,0.991716f,0.991704f,0.991691f,0.991679f,0.991667f,0.991654f,0.991642f,0.991629f,0.991617f,0.991605f,0.991592f,0.99158f,0.991567f,0.991555f,0.991543f,0.99153f,0.991518f,0.991505f,0.991493f,0.99148f,0.991468f,0.991455f,0.991443f,0.99143f,0.991418f,0.991405f,0.991393f,0.99138f,0.991368f,0.991355f,0.991342f,0.99133f,0.991317f,0.991305f,0.991292f,0.991279f,0.991267f,0.991254f,0.991241f,0.991229f,0.991216f,0.991203f,0.991191f,0.991178f,0.991165f,0.991153f,0.99114f,0.991127f,0.991114f,0.991102f,0.991089f,0.991076f,0.991063f,0.99105f,0.991038f,0.991025f,0.991012f,0.990999f,0.990986f,0.990973f,0.990961f,0.990948f,0.990935f,0.990922f,0.990909f,0.990896f,0.990883f,0.99087f,0.990857f,0.990844f,0.990832f,0.990819f,0.990806f,0.990793f,0.99078f,0.990767f,0.990754f,0.990741f,0.990728f,0.990715f,0.990702f,0.990689f,0.990675f,0.990662f,0.990649f,0.990636f,0.990623f,0.99061f,0.990597f,0.990584f,0.990571f,0.990557f,0.990544f,0.990531f,0.990518f,0.990505f,0.990492f,0.990478f,0.990465f,0.990452f,0.990439f,0.990426f,0.990412f,0.990399f,0.990386f,0.990373f,0.990359f,0.990346f,0.990333f,0.990319f,0.990306f,0.990293f,0.990279f,0.990266f,0.990253f,0.990239f,0.990226f,0.990213f,0.990199f,0.990186f,0.990173f,0.990159f,0.990146f,0.990132f,0.990119f,0.990105f,0.990092f,0.990078f,0.990065f,0.990051f,0.990038f,0.990024f,0.990011f,0.989997f,0.989984f,0.98997f,0.989957f,0.989943f,0.98993f,0.989916f,0.989902f,0.989889f,0.989875f,0.989862f,0.989848f,0.989834f,0.989821f,0.989807f,0.989793f,0.98978f,0.989766f,0.989752f,0.989739f,0.989725f,0.989711f,0.989698f,0.989684f,0.98967f,0.989656f,0.989643f,0.989629f,0.989615f,0.989601f,0.989588f,0.989574f,0.98956f,0.989546f,0.989532f,0.989518f,0.989505f,0.989491f,0.989477f,0.989463f,0.989449f,0.989435f,0.989421f,0.989407f,0.989393f,0.98938f,0.989366f,0.989352f,0.989338f,0.989324f,0.98931f,0.989296f,0.989282f,0.989268f,0.989254f,0.98924f,0.989226f,0.989212f,0.989198f,0.989184f,0.989169f,0.989155f,0.989141f,0.989127f,0.989113f,0.989099f,0.989085f,0.989071f,0.989057f,0.989042f,0.989028f,0.989014f,0.989f,0.988986f,0.988972f,0.988957f,0.988943f,0.988929f,0.988915f,0.9889f,0.988886f,0.988872f,0.988858f,0.988843f,0.988829f,0.988815f,0.988801f,0.988786f,0.988772f,0.988758f,0.988743f,0.988729f,0.988715f,0.9887f,0.988686f,0.988671f,0.988657f,0.988643f,0.988628f,0.988614f,0.988599f,0.988585f,0.98857f,0.988556f,0.988541f,0.988527f,0.988513f,0.988498f,0.988484f,0.988469f,0.988455f,0.98844f,0.988425f,0.988411f,0.988396f,0.988382f,0.988367f,0.988353f,0.988338f,0.988323f,0.988309f,0.988294f,0.98828f,0.988265f,0.98825f,0.988236f,0.988221f,0.988206f,0.988192f,0.988177f,0.988162f,0.988147f,0.988133f,0.988118f,0.988103f,0.988088f,0.988074f,0.988059f,0.988044f,0.988029f,0.988015f,0.988f,0.987985f,0.98797f,0.987955f,0.98794f,0.987926f,0.987911f,0.987896f,0.987881f,0.987866f,0.987851f,0.987836f,0.987821f,0.987807f,0.987792f,0.987777f,0.987762f,0.987747f,0.987732f,0.987717f,0.987702f,0.987687f,0.987672f,0.987657f,0.987642f,0.987627f,0.987612f,0.987597f,0.987582f,0.987567f,0.987551f,0.987536f,0.987521f,0.987506f,0.987491f,0.987476f,0.987461f,0.987446f,0.987431f,0.987415f,0.9874f,0.987385f,0.98737f,0.987355f,0.987339f,0.987324f,0.987309f,0.987294f,0.987279f,0.987263f,0.987248f,0.987233f,0.987217f,0.987202f,0.987187f,0.987172f,0.987156f,0.987141f,0.987126f,0.98711f,0.987095f,0.98708f,0.987064f,0.987049f,0.987033f,0.987018f,0.987003f,0.986987f,0.986972f,0.986956f,0.986941f,0.986926f,0.98691f,0.986895f,0.986879f,0.986864f,0.986848f,0.986833f,0.986817f,0.986802f,0.986786f,0.986771f,0.986755f,0.986739f,0.986724f,0.986708f,0.986693f,0.986677f,0.986662f,0.986646f,0.98663f,0.986615f,0.986599f,0.986583f,0.986568f,0.986552f,0.986536f,0.986521f,0.986505f,0.986489f,0.986474f,0.986458f,0.986442f,0.986426f,0.986411f,0.986395f,0.986379f,0.986363f,0.986348f,0.986332f,0.986316f,0.9863f,0.986284f,0.986269f,0.986253f,0.986237f,0.986221f,0.986205f,0.986189f,0.986173f,0.986157f,0.986142f,0.986126f,0.98611f,0.986094f,0.986078f,0.986062f,0.986046f,0.98603f,0.986014f,0.985998f,0.985982f,0.985966f,0.98595f,0.985934f,0.985918f,0.985902f,0.985886f,0.98587f,0.985854f,0.985838f,0.985822f,0.985806f,0.985789f,0.985773f,0.985757f,0.985741f,0.985725f,0.985709f,0.985693f,0.985676f,0.98566f,0.985644f,0.985628f,0.985612f,0.985596f,0.985579f,0.985563f,0.985547f,0.985531f,0.985514f,0.985498f,0.985482f,0.985466f,0.985449f,0.985433f,0.985417f,0.9854f,0.985384f,0.985368f,0.985351f,0.985335f,0.985319f,0.985302f,0.985286f,0.985269f,0.985253f,0.985237f,0.98522f,0.985204f,0.985187f,0.985171f,0.985154f,0.985138f,0.985122f,0.985105f,0.985089f,0.985072f,0.985056f,0.985039f,0.985022f,0.985006f,0.984989f,0.984973f,0.984956f,0.98494f,0.984923f,0.984907f,0.98489f,0.984873f,0.984857f,0.98484f,0.984823f,0.984807f,0.98479f,0.984774f,0.984757f,0.98474f,0.984723f,0.984707f,0.98469f,0.984673f,0.984657f,0.98464f,0.984623f,0.984606f,0.98459f,0.984573f,0.984556f,0.984539f,0.984522f,0.984506f,0.984489f,0.984472f,0.984455f,0.984438f,0.984421f,0.984405f,0.984388f,0.984371f,0.984354f,0.984337f,0.98432f,0.984303f,0.984286f,0.984269f,0.984253f,0.984236f,0.984219f,0.984202f,0.984185f,0.984168f,0.984151f,0.984134f,0.984117f,0.9841f,0.984083f,0.984066f,0.984048f,0.984031f,0.984014f,0.983997f,0.98398f,0.983963f,0.983946f,0.983929f,0.983912f,0.983895f,0.983877f,0.98386f,0.983843f,0.983826f,0.983809f,0.983792f,0.983774f,0.983757f,0.98374f,0.983723f,0.983706f,0.983688f,0.983671f,0.983654f,0.983636f,0.983619f,0.983602f,0.983585f,0.983567f,0.98355f,0.983533f,0.983515f,0.983498f,0.983481f,0.983463f,0.983446f,0.983429f,0.983411f,0.983394f,0.983376f,0.983359f,0.983342f,0.983324f,0.983307f,0.983289f,0.983272f,0.983254f,0.983237f,0.983219f,0.983202f,0.983184f,0.983167f,0.983149f,0.983132f,0.983114f,0.983097f,0.983079f,0.983062f,0.983044f,0.983026f,0.983009f,0.982991f,0.982974f,0.982956f,0.982938f,0.982921f,0.982903f,0.982885f,0.982868f,0.98285f,0.982832f,0.982815f,0.982797f,0.982779f,0.982762f,0.982744f,0.982726f,0.982708f,0.982691f,0.982673f,0.982655f,0.982637f,0.982619f,0.982602f,0.982584f,0.982566f,0.982548f,0.98253f,0.982513f,0.982495f,0.982477f,0.982459f,0.982441f,0.982423f,0.982405f,0.982387f,0.982369f,0.982351f,0.982334f,0.982316f,0.982298f,0.98228f,0.982262f,0.982244f,0.982226f,0.982208f,0.98219f,0.982172f,0.982154f,0.982136f,0.982118f,0.9821f,0.982081f,0.982063f,0.982045f,0.982027f,0.982009f,0.981991f,0.981973f,0.981955f,0.981937f,0.981919f,0.9819f,0.981882f,0.981864f,0.981846f,0.981828f,0.981809f,0.981791f,0.981773f,0.981755f,0.981737f,0.981718f,0.9817f,0.981682f,0.981664f,0.981645f,0.981627f,0.981609f,0.98159f,0.981572f,0.981554f,0.981535f,0.981517f,0.981499f,0.98148f,0.981462f,0.981444f,0.981425f,0.981407f,0.981388f,0.98137f,0.981352f,0.981333f,0.981315f,0.981296f,0.981278f,0.981259f,0.981241f,0.981222f,0.981204f,0.981185f,0.981167f,0.981148f,0.98113f,0.981111f,0.981093f,0.981074f,0.981055f,0.981037f,0.981018f,0.981f,0.980981f,0.980963f,0.980944f,0.980925f,0.980907f,0.980888f,0.980869f,0.980851f,0.980832f,0.980813f,0.980795f,0.980776f,0.980757f,0.980738f,0.98072f,0.980701f,0.980682f,0.980663f,0.980645f,0.980626f,0.980607f,0.980588f,0.98057f,0.980551f,0.980532f,0.980513f,0.980494f,0.980475f,0.980457f,0.980438f,0.980419f,0.9804f,0.980381f,0.980362f,0.980343f,0.980324f,0.980305f,0.980286f,0.980268f,0.980249f,0.98023f,0.980211f,0.980192f,0.980173f,0.980154f,0.980135f,0.980116f,0.980097f,0.980078f,0.980058f,0.980039f,0.98002f,0.980001f,0.979982f,0.979963f,0.979944f,0.979925f,0.979906f,0.979887f,0.979868f,0.979848f,0.979829f,0.97981f,0.979791f,0.979772f,0.979753f,0.979733f,0.979714f,0.979695f,0.979676f,0.979656f,0.979637f,0.979618f,0.979599f,0.979579f,0.97956f,0.979541f,0.979522f,0.979502f,0.979483f,0.979464f,0.979444f,0.979425f,0.979406f,0.979386f,0.979367f,0.979347f,0.979328f,0.979309f,0.979289f,0.97927f,0.97925f,0.979231f,0.979212f,0.979192f,0.979173f,0.979153f,0.979134f,0.979114f,0.979095f,0.979075f,0.979056f,0.979036f,0.979017f,0.978997f,0.978978f,0.978958f,0.978938f,0.978919f,0.978899f,0.97888f,0.97886f,0.97884f,0.978821f,0.978801f,0.978782f,0.978762f,0.978742f,0.978723f,0.978703f,0.978683f,0.978663f,0.978644f,0.978624f,0.978604f,0.978585f,0.978565f,0.978545f,0.978525f,0.978506f,0.978486f,0.978466f,0.978446f,0.978426f,0.978407f,0.978387f,0.978367f,0.978347f,0.978327f,0.978307f,0.978288f,0.978268f,0.978248f,0.978228f,0.978208f,0.978188f,0.978168f,0.978148f,0.978128f,0.978108f,0.978088f,0.978068f,0.978049f,0.978028f,0.978009f,0.977988f,0.977969f,0.977948f,0.977928f,0.977908f,0.977888f,0.977868f,0.977848f,0.977828f,0.977808f,0.977788f,0.977768f,0.977748f,0.977728f,0.977708f,0.977687f,0.977667f,0.977647f,0.977627f,0.977607f,0.977587f,0.977566f,0.977546f,0.977526f,0.977506f,0.977486f,0.977465f,0.977445f,0.977425f,0.977405f,0.977384f,0.977364f,0.977344f,0.977323f,0.977303f,0.977283f,0.977262f,0.977242f,0.977222f,0.977201f,0.977181f,0.977161f,0.97714f,0.97712f,0.9771f,0.977079f,0.977059f,0.977038f,0.977018f,0.976997f,0.976977f,0.976957f,0.976936f,0.976916f,0.976895f,0.976875f,0.976854f,0.976834f,0.976813f,0.976793f,0.976772f,0.976752f,0.976731f,0.97671f,0.97669f,0.976669f,0.976649f,0.976628f,0.976607f,0.976587f,0.976566f,0.976546f,0.976525f,0.976504f,0.976484f,0.976463f,0.976442f,0.976421f,0.976401f,0.97638f,0.976359f,0.976339f,0.976318f,0.976297f,0.976276f,0.976256f,0.976235f,0.976214f,0.976193f,0.976173f,0.976152f,0.976131f,0.97611f,0.976089f,0.976068f,0.976048f,0.976027f,0.976006f,0.975985f,0.975964f,0.975943f,0.975922f,0.975901f,0.97588f,0.975859f,0.975838f,0.975818f,0.975797f,0.975776f,0.975755f,0.975734f,0.975713f,0.975692f,0.975671f,0.97565f,0.975629f,0.975608f,0.975586f,0.975565f,0.975544f,0.975523f,0.975502f,0.975481f,0.97546f,0.975439f,0.975418f,0.975397f,0.975375f,0.975354f,0.975333f,0.975312f,0.975291f,0.97527f,0.975248f,0.975227f,0.975206f,0.975185f,0.975164f,0.975142f,0.975121f,0.9751f,0.975079f,0.975057f,0.975036f,0.975015f,0.974993f,0.974972f,0.974951f,0.974929f,0.974908f,0.974887f,0.974865f,0.974844f,0.974823f,0.974801f,0.97478f,0.974758f,0.974737f,0.974716f,0.974694f,0.974673f,0.974651f,0.97463f,0.974608f,0.974587f,0.974565f,0.974544f,0.974522f,0.974501f,0.974479f,0.974458f,0.974436f,0.974415f,0.974393f,0.974372f,0.97435f,0.974329f,0.974307f,0.974285f,0.974264f,0.974242f,0.974221f,0.974199f,0.974177f,0.974156f,0.974134f,0.974112f,0.974091f,0.974069f,0.974047f,0.974026f,0.974004f,0.973982f,0.97396f,0.973939f,0.973917f,0.973895f,0.973873f,0.973852f,0.97383f,0.973808f,0.973786f,0.973764f,0.973743f,0.973721f,0.973699f,0.973677f,0.973655f,0.973633f,0.973611f,0.97359f,0.973568f,0.973546f,0.973524f,0.973502f,0.97348f,0.973458f,0.973436f,0.973414f,0.973392f,0.97337f,0.973348f,0.973326f,0.973304f,0.973282f,0.97326f,0.973238f,0.973216f,0.973194f,0.973172f,0.97315f,0.973128f,0.973106f,0.973084f,0.973062f,0.97304f,0.973017f,0.972995f,0.972973f,0.972951f,0.972929f,0.972907f,0.972885f,0.972862f,0.97284f,0.972818f,0.972796f,0.972774f,0.972751f,0.972729f,0.972707f,0.972685f,0.972662f,0.97264f,0.972618f,0.972596f,0.972573f,0.972551f,0.972529f,0.972506f,0.972484f,0.972462f,0.972439f,0.972417f,0.972395f,0.972372f,0.97235f,0.972327f,0.972305f,0.972283f,0.97226f,0.972238f,0.972215f,0.972193f,0.97217f,0.972148f,0.972125f,0.972103f,0.97208f,0.972058f,0.972035f,0.972013f,0.97199f,0.971968f,0.971945f,0.971923f,0.9719f,0.971878f,0.971855f,0.971832f,0.97181f,0.971787f,0.971765f,0.971742f,0.971719f,0.971697f,0.971674f,0.971651f,0.971629f,0.971606f,0.971583f,0.971561f,0.971538f,0.971515f,0.971493f,0.97147f,0.971447f,0.971424f,0.971402f,0.971379f,0.971356f,0.971333f,0.97131f,0.971288f,0.971265f,0.971242f,0.971219f,0.971196f,0.971173f,0.971151f,0.971128f,0.971105f,0.971082f,0.971059f,0.971036f,0.971013f,0.97099f,0.970967f,0.970944f,0.970922f,0.970899f,0.970876f,0.970853f,0.97083f,0.970807f,0.970784f,0.970761f,0.970738f,0.970715f,0.970692f,0.970668f,0.970645f,0.970622f,0.970599f,0.970576f,0.970553f,0.97053f,0.970507f,0.970484f,0.970461f,0.970438f,0.970414f,0.970391f,0.970368f,0.970345f,0.970322f,0.970299f,0.970275f,0.970252f,0.970229f,0.970206f,0.970182f,0.970159f,0.970136f,0.970113f,0.970089f,0.970066f,0.970043f,0.97002f,0.969996f,0.969973f,0.96995f,0.969926f,0.969903f,0.96988f,0.969856f,0.969833f,0.96981f,0.969786f,0.969763f,0.969739f,0.969716f,0.969693f,0.969669f,0.969646f,0.969622f,0.969599f,0.969575f,0.969552f,0.969528f,0.969505f,0.969481f,0.969458f,0.969434f,0.969411f,0.969387f,0.969364f,0.96934f,0.969317f,0.969293f,0.969269f,0.969246f,0.969222f,0.969199f,0.969175f,0.969151f,0.969128f,0.969104f,0.96908f,0.969057f,0.969033f,0.969009f,0.968986f,0.968962f,0.968938f,0.968915f,0.968891f,0.968867f,0.968843f,0.96882f,0.968796f,0.968772f,0.968748f,0.968725f,0.968701f,0.968677f,0.968653f,0.968629f,0.968606f,0.968582f,0.968558f,0.968534f,0.96851f,0.968486f,0.968462f,0.968439f,0.968415f,0.968391f,0.968367f,0.968343f,0.968319f,0.968295f,0.968271f,0.968247f,0.968223f,0.968199f,0.968175f,0.968151f,0.968127f,0.968103f,0.968079f,0.968055f,0.968031f,0.968007f,0.967983f,0.967959f,0.967935f,0.967911f,0.967887f,0.967862f,0.967838f,0.967814f,0.96779f,0.967766f,0.967742f,0.967718f,0.967693f,0.967669f,0.967645f,0.967621f,0.967597f,0.967572f,0.967548f,0.967524f,0.9675f,0.967475f,0.967451f,0.967427f,0.967403f,0.967378f,0.967354f,0.96733f,0.967305f,0.967281f,0.967257f,0.967233f,0.967208f,0.967184f,0.967159f,0.967135f,0.967111f,0.967086f,0.967062f,0.967037f,0.967013f,0.966989f,0.966964f,0.96694f,0.966915f,0.966891f,0.966866f,0.966842f,0.966817f,0.966793f,0.966768f,0.966744f,0.966719f,0.966695f,0.96667f,0.966646f,0.966621f,0.966597f,0.966572f,0.966547f,0.966523f,0.966498f,0.966474f,0.966449f,0.966424f,0.9664f,0.966375f,0.96635f,0.966326f,0.966301f,0.966276f,0.966252f,0.966227f,0.966202f,0.966178f,0.966153f,0.966128f,0.966103f,0.966079f,0.966054f,0.966029f,0.966004f,0.96598f,0.965955f,0.96593f,0.965905f,0.96588f,0.965855f,0.965831f,0.965806f,0.965781f,0.965756f,0.965731f,0.965706f,0.965681f,0.965656f,0.965632f,0.965607f,0.965582f,0.965557f,0.965532f,0.965507f,0.965482f,0.965457f,0.965432f,0.965407f,0.965382f,0.965357f,0.965332f,0.965307f,0.965282f,0.965257f,0.965232f,0.965207f,0.965182f,0.965156f,0.965131f,0.965106f,0.965081f,0.965056f,0.965031f,0.965006f,0.964981f,0.964956f,0.96493f,0.964905f,0.96488f,0.964855f,0.96483f,0.964804f,0.964779f,0.964754f,0.964729f,0.964703f,0.964678f,0.964653f,0.964628f,0.964602f,0.964577f,0.964552f,0.964527f,0.964501f,0.964476f,0.964451f,0.964425f,0.9644f,0.964375f,0.964349f,0.964324f,0.964298f,0.964273f,0.964248f,0.964222f,0.964197f,0.964171f,0.964146f,0.96412f,0.964095f,0.96407f,0.964044f,0.964019f,0.963993f,0.963968f,0.963942f,0.963917f,0.963891f,0.963865f,0.96384f,0.963814f,0.963789f,0.963763f,0.963738f,0.963712f,0.963686f,0.963661f,0.963635f,0.96361f,0.963584f,0.963558f,0.963533f,0.963507f,0.963481f,0.963456f,0.96343f,0.963404f,0.963379f,0.963353f,0.963327f,0.963301f,0.963276f,0.96325f,0.963224f,0.963198f,0.963173f,0.963147f,0.963121f,0.963095f,0.963069f,0.963044f,0.963018f,0.962992f,0.962966f,0.96294f,0.962914f,0.962889f,0.962863f,0.962837f,0.962811f,0.962785f,0.962759f,0.962733f,0.962707f,0.962681f,0.962655f,0.962629f,0.962603f,0.962577f,0.962551f,0.962525f,0.962499f,0.962473f,0.962447f,0.962421f,0.962395f,0.962369f,0.962343f,0.962317f,0.962291f,0.962265f,0.962239f,0.962213f,0.962187f,0.962161f,0.962134f,0.962108f,0.962082f,0.962056f,0.96203f,0.962004f,0.961977f,0.961951f,0.961925f,0.961899f,0.961873f,0.961846f,0.96182f,0.961794f,0.961768f,0.961741f,0.961715f,0.961689f,0.961663f,0.961636f,0.96161f,0.961584f,0.961557f,0.961531f,0.961505f,0.961478f,0.961452f,0.961426f,0.961399f,0.961373f,0.961347f,0.96132f,0.961294f,0.961267f,0.961241f,0.961214f,0.961188f,0.961161f,0.961135f,0.961109f,0.961082f,0.961056f,0.961029f,0.961003f,0.960976f,0.96095f,0.960923f,0.960896f,0.96087f,0.960843f,0.960817f,0.96079f,0.960764f,0.960737f,0.96071f,0.960684f,0.960657f,0.960631f,0.960604f,0.960577f,0.960551f,0.960524f,0.960497f,0.960471f,0.960444f,0.960417f,0.96039f,0.960364f,0.960337f,0.96031f,0.960284f,0.960257f,0.96023f,0.960203f,0.960176f,0.96015f,0.960123f,0.960096f,0.960069f,0.960042f,0.960016f,0.959989f,0.959962f,0.959935f,0.959908f,0.959881f,0.959854f,0.959827f,0.959801f,0.959774f,0.959747f,0.95972f,0.959693f,0.959666f,0.959639f,0.959612f,0.959585f,0.959558f,0.959531f,0.959504f,0.959477f,0.95945f,0.959423f,0.959396f,0.959369f,0.959342f,0.959315f,0.959288f,0.959261f,0.959234f,0.959206f,0.959179f,0.959152f,0.959125f,0.959098f,0.959071f,0.959044f,0.959016f,0.958989f,0.958962f,0.958935f,0.958908f,0.95888f,0.958853f,0.958826f,0.958799f,0.958772f,0.958744f,0.958717f,0.95869f,0.958663f,0.958635f,0.958608f,0.958581f,0.958553f,0.958526f,0.958499f,0.958471f,0.958444f,0.958417f,0.958389f,0.958362f,0.958335f,0.958307f,0.95828f,0.958252f,0.958225f,0.958197f,0.95817f,0.958143f,0.958115f,0.958088f,0.95806f,0.958033f,0.958005f,0.957978f,0.95795f,0.957923f,0.957895f,0.957868f,0.95784f,0.957813f,0.957785f,0.957757f,0.95773f,0.957702f,0.957675f,0.957647f,0.95762f,0.957592f,0.957564f,0.957537f,0.957509f,0.957481f,0.957454f,0.957426f,0.957398f,0.957371f,0.957343f,0.957315f,0.957287f,0.95726f,0.957232f,0.957204f,0.957177f,0.957149f,0.957121f,0.957093f,0.957065f,0.957038f,0.95701f,0.956982f,0.956954f,0.956926f,0.956899f,0.956871f,0.956843f,0.956815f,0.956787f,0.956759f,0.956731f,0.956703f,0.956676f,0.956648f,0.95662f,0.956592f,0.956564f,0.956536f,0.956508f,0.95648f,0.956452f,0.956424f,0.956396f,0.956368f,0.95634f,0.956312f,0.956284f,0.956256f,0.956228f,0.9562f,0.956172f,0.956144f,0.956115f,0.956087f,0.956059f,0.956031f,0.956003f,0.955975f,0.955947f,0.955919f,0.95589f,0.955862f,0.955834f,0.955806f,0.955778f,0.95575f,0.955721f,0.955693f,0.955665f,0.955637f,0.955608f,0.95558f,0.955552f,0.955524f,0.955495f,0.955467f,0.955439f,0.95541f,0.955382f,0.955354f,0.955326f,0.955297f,0.955269f,0.95524f,0.955212f,0.955184f,0.955155f,0.955127f,0.955099f,0.95507f,0.955042f,0.955013f,0.954985f,0.954956f,0.954928f,0.954899f,0.954871f,0.954843f,0.954814f,0.954786f,0.954757f,0.954728f,0.9547f,0.954671f,0.954643f,0.954614f,0.954586f,0.954557f,0.954529f,0.9545f,0.954471f,0.954443f,0.954414f,0.954386f,0.954357f,0.954328f,0.9543f,0.954271f,0.954242f,0.954214f,0.954185f,0.954156f,0.954128f,0.954099f,0.95407f,0.954042f,0.954013f,0.953984f,0.953955f,0.953927f,0.953898f,0.953869f,0.95384f,0.953811f,0.953783f,0.953754f,0.953725f,0.953696f,0.953667f,0.953638f,0.95361f,0.953581f,0.953552f,0.953523f,0.953494f,0.953465f,0.953436f,0.953407f,0.953378f,0.953349f,0.953321f,0.953292f,0.953263f,0.953234f,0.953205f,0.953176f,0.953147f,0.953118f,0.953089f,0.95306f,0.953031f,0.953002f,0.952972f,0.952943f,0.952914f,0.952885f,0.952856f,0.952827f,0.952798f,0.952769f,0.95274f,0.952711f,0.952681f,0.952652f,0.952623f,0.952594f,0.952565f,0.952536f,0.952506f,0.952477f,0.952448f,0.952419f,0.95239f,0.95236f,0.952331f,0.952302f,0.952273f,0.952243f,0.952214f,0.952185f,0.952155f,0.952126f,0.952097f,0.952068f,0.952038f,0.952009f,0.95198f,0.95195f,0.951921f,0.951891f,0.951862f,0.951833f,0.951803f,0.951774f,0.951744f,0.951715f,0.951686f,0.951656f,0.951627f,0.951597f,0.951568f,0.951538f,0.951509f,0.951479f,0.95145f,0.95142f,0.951391f,0.951361f,0.951332f,0.951302f,0.951273f,0.951243f,0.951213f,0.951184f,0.951154f,0.951125f,0.951095f,0.951065f,0.951036f,0.951006f,0.950976f,0.950947f,0.950917f,0.950888f,0.950858f,0.950828f,0.950798f,0.950769f,0.950739f,0.950709f,0.95068f,0.95065f,0.95062f,0.95059f,0.950561f,0.950531f,0.950501f,0.950471f,0.950441f,0.950412f,0.950382f,0.950352f,0.950322f,0.950292f,0.950262f,0.950233f,0.950203f,0.950173f,0.950143f,0.950113f,0.950083f,0.950053f,0.950023f,0.949993f,0.949963f,0.949933f,0.949903f,0.949873f,0.949843f,0.949813f,0.949784f,0.949753f,0.949723f,0.949693f,0.949663f,0.949633f,0.949603f,0.949573f,0.949543f,0.949513f,0.949483f,0.949453f,0.949423f,0.949393f,0.949363f,0.949332f,0.949302f,0.949272f,0.949242f,0.949212f,0.949182f,0.949152f,0.949121f,0.949091f,0.949061f,0.949031f,0.949001f,0.94897f,0.94894f,0.94891f,0.94888f,0.948849f,0.948819f,0.948789f,0.948758f,0.948728f,0.948698f,0.948668f,0.948637f,0.948607f,0.948577f,0.948546f,0.948516f,0.948485f,0.948455f,0.948425f,0.948394f,0.948364f,0.948333f,0.948303f,0.948273f,0.948242f,0.948212f,0.948181f,0.948151f,0.94812f,0.94809f,0.948059f,0.948029f,0.947998f,0.947968f,0.947937f,0.947907f,0.947876f,0.947846f,0.947815f,0.947784f,0.947754f,0.947723f,0.947693f,0.947662f,0.947632f,0.947601f,0.94757f,0.94754f,0.947509f,0.947478f,0.947448f,0.947417f,0.947386f,0.947356f,0.947325f,0.947294f,0.947263f,0.947233f,0.947202f,0.947171f,0.947141f,0.94711f,0.947079f,0.947048f,0.947017f,0.946987f,0.946956f,0.946925f,0.946894f,0.946863f,0.946832f,0.946802f,0.946771f,0.94674f,0.946709f,0.946678f,0.946647f,0.946616f,0.946585f,0.946554f,0.946524f,0.946493f,0.946462f,0.946431f,0.9464f,0.946369f,0.946338f,0.946307f,0.946276f,0.946245f,0.946214f,0.946183f,0.946152f,0.946121f,0.94609f,0.946059f,0.946028f,0.945996f,0.945965f,0.945934f,0.945903f,0.945872f,0.945841f,0.94581f,0.945779f,0.945748f,0.945716f,0.945685f,0.945654f,0.945623f,0.945592f,0.945561f,0.945529f,0.945498f,0.945467f,0.945436f,0.945404f,0.945373f,0.945342f,0.945311f,0.945279f,0.945248f,0.945217f,0.945185f,0.945154f,0.945123f,0.945092f,0.94506f,0.945029f,0.944997f,0.944966f,0.944935f,0.944903f,0.944872f,0.944841f,0.944809f,0.944778f,0.944746f,0.944715f,0.944683f,0.944652f,0.944621f,0.944589f,0.944558f,0.944526f,0.944495f,0.944463f,0.944432f,0.9444f,0.944369f,0.944337f,0.944306f,0.944274f,0.944242f,0.944211f,0.944179f,0.944148f,0.944116f,0.944084f,0.944053f,0.944021f,0.94399f,0.943958f,0.943926f,0.943895f,0.943863f,0.943831f,0.9438f,0.943768f,0.943736f,0.943704f,0.943673f,0.943641f,0.943609f,0.943578f,0.943546f,0.943514f,0.943482f,0.943451f,0.943419f,0.943387f,0.943355f,0.943323f,0.943291f,0.94326f,0.943228f,0.943196f,0.943164f,0.943132f,0.9431f,0.943069f,0.943037f,0.943005f,0.942973f,0.942941f,0.942909f,0.942877f,0.942845f,0.942813f,0.942781f,0.942749f,0.942717f,0.942685f,0.942653f,0.942621f,0.942589f,0.942557f,0.942525f,0.942493f,0.942461f,0.942429f,0.942397f,0.942365f,0.942333f,0.942301f,0.942269f,0.942236f,0.942204f,0.942172f,0.94214f,0.942108f,0.942076f,0.942044f,0.942011f,0.941979f,0.941947f,0.941915f,0.941883f,0.94185f,0.941818f,0.941786f,0.941754f,0.941722f,0.941689f,0.941657f,0.941625f,0.941592f,0.94156f,0.941528f,0.941496f,0.941463f,0.941431f,0.941399f,0.941366f,0.941334f,0.941302f,0.941269f,0.941237f,0.941204f,0.941172f,0.94114f,0.941107f,0.941075f,0.941042f,0.94101f,0.940978f,0.940945f,0.940913f,0.94088f,0.940848f,0.940815f,0.940783f,0.94075f,0.940718f,0.940685f,0.940653f,0.94062f,0.940587f,0.940555f,0.940522f,0.94049f,0.940457f,0.940425f,0.940392f,0.940359f,0.940327f,0.940294f,0.940261f,0.940229f,0.940196f,0.940164f,0.940131f,0.940098f,0.940066f,0.940033f,0.94f,0.939967f,0.939935f,0.939902f,0.939869f,0.939836f,0.939804f,0.939771f,0.939738f,0.939705f,0.939673f,0.93964f,0.939607f,0.939574f,0.939541f,0.939508f,0.939476f,0.939443f,0.93941f,0.939377f,0.939344f,0.939311f,0.939278f,0.939246f,0.939213f,0.93918f,0.939147f,0.939114f,0.939081f,0.939048f,0.939015f,0.938982f,0.938949f,0.938916f,0.938883f,0.93885f,0.938817f,0.938784f,0.938751f,0.938718f,0.938685f,0.938652f,0.938619f,0.938586f,0.938552f,0.938519f,0.938486f,0.938453f,0.93842f,0.938387f,0.938354f,0.938321f,0.938287f,0.938254f,0.938221f,0.938188f,0.938155f,0.938122f,0.938088f,0.938055f,0.938022f,0.937989f,0.937955f,0.937922f,0.937889f,0.937856f,0.937822f,0.937789f,0.937756f,0.937723f,0.937689f,0.937656f,0.937623f,0.937589f,0.937556f,0.937523f,0.937489f,0.937456f,0.937422f,0.937389f,0.937356f,0.937322f,0.937289f,0.937255f,0.937222f,0.937189f,0.937155f,0.937122f,0.937088f,0.937055f,0.937021f,0.936988f,0.936954f,0.936921f,0.936887f,0.936854f,0.93682f,0.936787f,0.936753f,0.93672f,0.936686f,0.936652f,0.936619f,0.936585f,0.936552f,0.936518f,0.936484f,0.936451f,0.936417f,0.936383f,0.93635f,0.936316f,0.936283f,0.936249f,0.936215f,0.936181f,0.936148f,0.936114f,0.93608f,0.936047f,0.936013f,0.935979f,0.935945f,0.935912f,0.935878f,0.935844f,0.93581f,0.935776f,0.935743f,0.935709f,0.935675f,0.935641f,0.935607f,0.935573f,0.93554f,0.935506f,0.935472f,0.935438f,0.935404f,0.93537f,0.935336f,0.935302f,0.935268f,0.935234f,0.9352f,0.935166f,0.935133f,0.935099f,0.935065f,0.935031f,0.934997f,0.934963f,0.934929f,0.934895f,0.934861f,0.934826f,0.934792f,0.934758f,0.934724f,0.93469f,0.934656f,0.934622f,0.934588f,0.934554f,0.93452f,0.934486f,0.934451f,0.934417f,0.934383f,0.934349f,0.934315f,0.934281f,0.934246f,0.934212f,0.934178f,0.934144f,0.93411f,0.934075f,0.934041f,0.934007f,0.933973f,0.933938f,0.933904f,0.93387f,0.933836f,0.933801f,0.933767f,0.933733f,0.933698f,0.933664f,0.93363f,0.933595f,0.933561f,0.933527f,0.933492f,0.933458f,0.933423f,0.933389f,0.933355f,0.93332f,0.933286f,0.933251f,0.933217f,0.933182f,0.933148f,0.933114f,0.933079f,0.933045f,0.93301f,0.932976f,0.932941f,0.932907f,0.932872f,0.932837f,0.932803f,0.932768f,0.932734f,0.932699f,0.932665f,0.93263f,0.932595f,0.932561f,0.932526f,0.932492f,0.932457f,0.932422f,0.932388f,0.932353f,0.932318f,0.932284f,0.932249f,0.932214f,0.93218f,0.932145f,0.93211f,0.932075f,0.932041f,0.932006f,0.931971f,0.931936f,0.931902f,0.931867f,0.931832f,0.931797f,0.931762f,0.931728f,0.931693f,0.931658f,0.931623f,0.931588f,0.931553f,0.931519f,0.931484f,0.931449f,0.931414f,0.931379f,0.931344f,0.931309f,0.931274f,0.931239f,0.931204f,0.93117f,0.931135f,0.9311f,0.931065f,0.93103f,0.930995f,0.93096f,0.930925f,0.93089f,0.930854f,0.93082f,0.930784f,0.930749f,0.930714f,0.930679f,0.930644f,0.930609f,0.930574f,0.930539f,0.930504f,0.930469f,0.930434f,0.930398f,0.930363f,0.930328f,0.930293f,0.930258f,0.930223f,0.930187f,0.930152f,0.930117f,0.930082f,0.930047f,0.930011f,0.929976f,0.929941f,0.929906f,0.92987f,0.929835f,0.9298f,0.929764f,0.929729f,0.929694f,0.929659f,0.929623f,0.929588f,0.929552f,0.929517f,0.929482f,0.929446f,0.929411f,0.929376f,0.92934f,0.929305f,0.929269f,0.929234f,0.929199f,0.929163f,0.929128f,0.929092f,0.929057f,0.929021f,0.928986f,0.92895f,0.928915f,0.928879f,0.928844f,0.928808f,0.928773f,0.928737f,0.928702f,0.928666f,0.928631f,0.928595f,0.928559f,0.928524f,0.928488f,0.928453f,0.928417f,0.928381f,0.928346f,0.92831f,0.928274f,0.928239f,0.928203f,0.928168f,0.928132f,0.928096f,0.92806f,0.928025f,0.927989f,0.927953f,0.927918f,0.927882f,0.927846f,0.92781f,0.927774f,0.927739f,0.927703f,0.927667f,0.927631f,0.927595f,0.92756f,0.927524f,0.927488f,0.927452f,0.927416f,0.92738f,0.927345f,0.927309f,0.927273f,0.927237f,0.927201f,0.927165f,0.927129f,0.927093f,0.927057f,0.927021f,0.926985f,0.926949f,0.926913f,0.926877f,0.926841f,0.926805f,0.926769f,0.926733f,0.926697f,0.926661f,0.926625f,0.926589f,0.926553f,0.926517f,0.926481f,0.926445f,0.926409f,0.926373f,0.926337f,0.926301f,0.926264f,0.926228f,0.926192f,0.926156f,0.92612f,0.926084f,0.926048f,0.926011f,0.925975f,0.925939f,0.925903f,0.925866f,0.92583f,0.925794f,0.925758f,0.925722f,0.925685f,0.925649f,0.925613f,0.925576f,0.92554f,0.925504f,0.925467f,0.925431f,0.925395f,0.925358f,0.925322f,0.925286f,0.925249f,0.925213f,0.925177f,0.92514f,0.925104f,0.925067f,0.925031f,0.924995f,0.924958f,0.924922f,0.924885f,0.924849f,0.924812f,0.924776f,0.924739f,0.924703f,0.924666f,0.92463f,0.924593f,0.924557f,0.92452f,0.924484f,0.924447f,0.924411f,0.924374f,0.924337f,0.924301f,0.924264f,0.924228f,0.924191f,0.924154f,0.924118f,0.924081f,0.924044f,0.924008f,0.923971f,0.923935f,0.923898f,0.923861f,0.923824f,0.923788f,0.923751f,0.923714f,0.923678f,0.923641f,0.923604f,0.923567f,0.923531f,0.923494f,0.923457f,0.92342f,0.923383f,0.923347f,0.92331f,0.923273f,0.923236f,0.923199f,0.923162f,0.923126f,0.923089f,0.923052f,0.923015f,0.922978f,0.922941f,0.922904f,0.922867f,0.92283f,0.922794f,0.922757f,0.92272f,0.922683f,0.922646f,0.922609f,0.922572f,0.922535f,0.922498f,0.922461f,0.922424f,0.922387f,0.92235f,0.922313f,0.922275f,0.922238f,0.922201f,0.922164f,0.922127f,0.92209f,0.922053f,0.922016f,0.921979f,0.921942f,0.921905f,0.921867f,0.92183f,0.921793f,0.921756f,0.921719f,0.921682f,0.921644f,0.921607f,0.92157f,0.921533f,0.921495f,0.921458f,0.921421f,0.921384f,0.921346f,0.921309f,0.921272f,0.921235f,0.921197f,0.92116f,0.921123f,0.921085f,0.921048f,0.921011f,0.920973f,0.920936f,0.920898f,0.920861f,0.920824f,0.920786f,0.920749f,0.920712f,0.920674f,0.920637f,0.920599f,0.920562f,0.920524f,0.920487f,0.920449f,0.920412f,0.920375f,0.920337f,0.920299f,0.920262f,0.920224f,0.920187f,0.920149f,0.920112f,0.920074f,0.920037f,0.919999f,0.919962f,0.919924f,0.919886f,0.919849f,0.919811f,0.919774f,0.919736f,0.919698f,0.919661f,0.919623f,0.919585f,0.919548f,0.91951f,0.919472f,0.919435f,0.919397f,0.919359f,0.919321f,0.919284f,0.919246f,0.919208f,0.91917f,0.919133f,0.919095f,0.919057f,0.919019f,0.918982f,0.918944f,0.918906f,0.918868f,0.91883f,0.918792f,0.918755f,0.918717f,0.918679f,0.918641f,0.918603f,0.918565f,0.918527f,0.918489f,0.918451f,0.918414f,0.918376f,0.918338f,0.9183f,0.918262f,0.918224f,0.918186f,0.918148f,0.91811f,0.918072f,0.918034f,0.917996f,0.917958f,0.91792f,0.917882f,0.917844f,0.917806f,0.917768f,0.917729f,0.917691f,0.917653f,0.917615f,0.917577f,0.917539f,0.917501f,0.917463f,0.917425f,0.917386f,0.917348f,0.91731f,0.917272f,0.917234f,0.917195f,0.917157f,0.917119f,0.917081f,0.917043f,0.917004f,0.916966f,0.916928f,0.91689f,0.916851f,0.916813f,0.916775f,0.916736f,0.916698f,0.91666f,0.916622f,0.916583f,0.916545f,0.916507f,0.916468f,0.91643f,0.916391f,0.916353f,0.916315f,0.916276f,0.916238f,0.9162f,0.916161f,0.916123f,0.916084f,0.916046f,0.916007f,0.915969f,0.91593f,0.915892f,0.915853f,0.915815f,0.915776f,0.915738f,0.915699f,0.915661f,0.915622f,0.915584f,0.915545f,0.915507f,0.915468f,0.915429f,0.915391f,0.915352f,0.915314f,0.915275f,0.915236f,0.915198f,0.915159f,0.91512f,0.915082f,0.915043f,0.915004f,0.914966f,0.914927f,0.914888f,0.91485f,0.914811f,0.914772f,0.914733f,0.914695f,0.914656f,0.914617f,0.914578f,0.91454f,0.914501f,0.914462f,0.914423f,0.914384f,0.914346f,0.914307f,0.914268f,0.914229f,0.91419f,0.914151f,0.914113f,0.914074f,0.914035f,0.913996f,0.913957f,0.913918f,0.913879f,0.91384f,0.913801f,0.913762f,0.913723f,0.913684f,0.913646f,0.913607f,0.913568f,0.913529f,0.91349f,0.913451f,0.913411f,0.913373f,0.913333f,0.913294f,0.913255f,0.913216f,0.913177f,0.913138f,0.913099f,0.91306f,0.913021f,0.912982f,0.912943f,0.912903f,0.912864f,0.912825f,0.912786f,0.912747f,0.912708f,0.912669f,0.912629f,0.91259f,0.912551f,0.912512f,0.912472f,0.912433f,0.912394f,0.912355f,0.912316f,0.912276f,0.912237f,0.912198f,0.912158f,0.912119f,0.91208f,0.912041f,0.912001f,0.911962f,0.911923f,0.911883f,0.911844f,0.911804f,0.911765f,0.911726f,0.911686f,0.911647f,0.911608f,0.911568f,0.911529f,0.911489f,0.91145f,0.91141f,0.911371f,0.911331f,0.911292f,0.911252f,0.911213f,0.911174f,0.911134f,0.911094f,0.911055f,0.911015f,0.910976f,0.910936f,0.910897f,0.910857f,0.910818f,0.910778f,0.910738f,0.910699f,0.910659f,0.91062f,0.91058f,0.91054f,0.910501f,0.910461f,0.910421f,0.910382f,0.910342f,0.910302f,0.910263f,0.910223f,0.910183f,0.910144f,0.910104f,0.910064f,0.910024f,0.909985f,0.909945f,0.909905f,0.909865f,0.909826f,0.909786f,0.909746f,0.909706f,0.909666f,0.909627f,0.909587f,0.909547f,0.909507f,0.909467f,0.909427f,0.909387f,0.909348f,0.909308f,0.909268f,0.909228f,0.909188f,0.909148f,0.909108f,0.909068f,0.909028f,0.908988f,0.908948f,0.908908f,0.908868f,0.908828f,0.908788f,0.908748f,0.908708f,0.908668f,0.908628f,0.908588f,0.908548f,0.908508f,0.908468f,0.908428f,0.908388f,0.908348f,0.908308f,0.908268f,0.908227f,0.908187f,0.908147f,0.908107f,0.908067f,0.908027f,0.907987f,0.907946f,0.907906f,0.907866f,0.907826f,0.907786f,0.907745f,0.907705f,0.907665f,0.907625f,0.907584f,0.907544f,0.907504f,0.907464f,0.907423f,0.907383f,0.907343f,0.907302f,0.907262f,0.907222f,0.907181f,0.907141f,0.907101f,0.90706f,0.90702f,0.90698f,0.906939f,0.906899f,0.906858f,0.906818f,0.906778f,0.906737f,0.906697f,0.906656f,0.906616f,0.906576f,0.906535f,0.906494f,0.906454f,0.906413f,0.906373f,0.906333f,0.906292f,0.906252f,0.906211f,0.90617f,0.90613f,0.906089f,0.906049f,0.906008f,0.905968f,0.905927f,0.905886f,0.905846f,0.905805f,0.905765f,0.905724f,0.905683f,0.905643f,0.905602f,0.905561f,0.905521f,0.90548f,0.905439f,0.905399f,0.905358f,0.905317f,0.905276f,0.905236f,0.905195f,0.905154f,0.905113f,0.905073f,0.905032f,0.904991f,0.90495f,0.904909f,0.904869f,0.904828f,0.904787f,0.904746f,0.904705f,0.904665f,0.904624f,0.904583f,0.904542f,0.904501f,0.90446f,0.904419f,0.904378f,0.904337f,0.904297f,0.904256f,0.904215f,0.904174f,0.904133f,0.904092f,0.904051f,0.90401f,0.903969f,0.903928f,0.903887f,0.903846f,0.903805f,0.903764f,0.903723f,0.903682f,0.903641f,0.9036f,0.903558f,0.903517f,0.903476f,0.903435f,0.903394f,0.903353f,0.903312f,0.903271f,0.903229f,0.903188f,0.903147f,0.903106f,0.903065f,0.903024f,0.902983f,0.902941f,0.9029f,0.902859f,0.902818f,0.902776f,0.902735f,0.902694f,0.902653f,0.902611f,0.90257f,0.902529f,0.902488f,0.902446f,0.902405f,0.902364f,0.902322f,0.902281f,0.90224f,0.902198f,0.902157f,0.902116f,0.902074f,0.902033f,0.901991f,0.90195f,0.901909f,0.901867f,0.901826f,0.901784f,0.901743f,0.901702f,0.90166f,0.901619f,0.901577f,0.901536f,0.901494f,0.901453f,0.901411f,0.90137f,0.901328f,0.901287f,0.901245f,0.901203f,0.901162f,0.90112f,0.901079f,0.901037f,0.900996f,0.900954f,0.900912f,0.900871f,0.900829f,0.900788f,0.900746f,0.900704f,0.900663f,0.900621f,0.900579f,0.900538f,0.900496f,0.900454f,0.900412f,0.900371f,0.900329f,0.900287f,0.900246f,0.900204f,0.900162f,0.90012f,0.900079f,0.900037f,0.899995f,0.899953f,0.899911f,0.89987f,0.899828f,0.899786f,0.899744f,0.899702f,0.89966f,0.899619f,0.899577f,0.899535f,0.899493f,0.899451f,0.899409f,0.899367f,0.899325f,0.899283f,0.899241f,0.899199f,0.899157f,0.899116f,0.899074f,0.899032f,0.89899f,0.898948f,0.898906f,0.898864f,0.898822f,0.89878f,0.898737f,0.898695f,0.898653f,0.898611f,0.898569f,0.898527f,0.898485f,0.898443f,0.898401f,0.898359f,0.898317f,0.898275f,0.898232f,0.89819f,0.898148f,0.898106f,0.898064f,0.898022f,0.897979f,0.897937f,0.897895f,0.897853f,0.897811f,0.897768f,0.897726f,0.897684f,0.897642f,0.897599f,0.897557f,0.897515f,0.897473f,0.89743f,0.897388f,0.897346f,0.897303f,0.897261f,0.897219f,0.897176f,0.897134f,0.897092f,0.897049f,0.897007f,0.896965f,0.896922f,0.89688f,0.896837f,0.896795f,0.896753f,0.89671f,0.896668f,0.896625f,0.896583f,0.89654f,0.896498f,0.896455f,0.896413f,0.89637f,0.896328f,0.896285f,0.896243f,0.8962f,0.896158f,0.896115f,0.896073f,0.89603f,0.895988f,0.895945f,0.895902f,0.89586f,0.895817f,0.895774f,0.895732f,0.895689f,0.895647f,0.895604f,0.895561f,0.895519f,0.895476f,0.895433f,0.895391f,0.895348f,0.895305f,0.895263f,0.89522f,0.895177f,0.895134f,0.895092f,0.895049f,0.895006f,0.894963f,0.894921f,0.894878f,0.894835f,0.894792f,0.894749f,0.894706f,0.894664f,0.894621f,0.894578f,0.894535f,0.894492f,0.89445f,0.894407f,0.894364f,0.894321f,0.894278f,0.894235f,0.894192f,0.894149f,0.894106f,0.894063f,0.89402f,0.893977f,0.893934f,0.893891f,0.893848f,0.893806f,0.893763f,0.893719f,0.893676f,0.893633f,0.89359f,0.893547f,0.893504f,0.893461f,0.893418f,0.893375f,0.893332f,0.893289f,0.893246f,0.893203f,0.89316f,0.893117f,0.893073f,0.89303f,0.892987f,0.892944f,0.892901f,0.892858f,0.892814f,0.892771f,0.892728f,0.892685f,0.892642f,0.892598f,0.892555f,0.892512f,0.892469f,0.892425f,0.892382f,0.892339f,0.892296f,0.892252f,0.892209f,0.892166f,0.892122f,0.892079f,0.892036f,0.891992f,0.891949f,0.891906f,0.891862f,0.891819f,0.891776f,0.891732f,0.891689f,0.891645f,0.891602f,0.891559f,0.891515f,0.891472f,0.891428f,0.891385f,0.891341f,0.891298f,0.891254f,0.891211f,0.891167f,0.891124f,0.89108f,0.891037f,0.890993f,0.89095f,0.890906f,0.890863f,0.890819f,0.890776f,0.890732f,0.890689f,0.890645f,0.890601f,0.890558f,0.890514f,0.890471f,0.890427f,0.890383f,0.89034f,0.890296f,0.890252f,0.890209f,0.890165f,0.890121f,0.890078f,0.890034f,0.88999f,0.889946f,0.889903f,0.889859f,0.889815f,0.889771f,0.889728f,0.889684f,0.88964f,0.889596f,0.889553f,0.889509f,0.889465f,0.889421f,0.889377f,0.889333f,0.88929f,0.889246f,0.889202f,0.889158f,0.889114f,0.88907f,0.889026f,0.888982f,0.888939f,0.888895f,0.888851f,0.888807f,0.888763f,0.888719f,0.888675f,0.888631f,0.888587f,0.888543f,0.888499f,0.888455f,0.888411f,0.888367f,0.888323f,0.888279f,0.888235f,0.888191f,0.888147f,0.888103f,0.888059f,0.888015f,0.887971f,0.887926f,0.887882f,0.887838f,0.887794f,0.88775f,0.887706f,0.887662f,0.887618f,0.887573f,0.887529f,0.887485f,0.887441f,0.887397f,0.887352f,0.887308f,0.887264f,0.88722f,0.887176f,0.887131f,0.887087f,0.887043f,0.886998f,0.886954f,0.88691f,0.886866f,0.886821f,0.886777f,0.886733f,0.886688f,0.886644f,0.8866f,0.886555f,0.886511f,0.886467f,0.886422f,0.886378f,0.886333f,0.886289f,0.886245f,0.8862f,0.886156f,0.886111f,0.886067f,0.886023f,0.885978f,0.885934f,0.885889f,0.885845f,0.8858f,0.885756f,0.885711f,0.885667f,0.885622f,0.885578f,0.885533f,0.885489f,0.885444f,0.885399f,0.885355f,0.88531f,0.885266f,0.885221f,0.885176f,0.885132f,0.885087f,0.885043f,0.884998f,0.884953f,0.884909f,0.884864f,0.884819f,0.884775f,0.88473f,0.884685f,0.884641f,0.884596f,0.884551f,0.884506f,0.884462f,0.884417f,0.884372f,0.884328f,0.884283f,0.884238f,0.884193f,0.884148f,0.884104f,0.884059f,0.884014f,0.883969f,0.883924f,0.88388f,0.883835f,0.88379f,0.883745f,0.8837f,0.883655f,0.88361f,0.883565f,0.883521f,0.883476f,0.883431f,0.883386f,0.883341f,0.883296f,0.883251f,0.883206f,0.883161f,0.883116f,0.883071f,0.883026f,0.882981f,0.882936f,0.882891f,0.882846f,0.882801f,0.882756f,0.882711f,0.882666f,0.882621f,0.882576f,0.882531f,0.882486f,0.88244f,0.882395f,0.88235f,0.882305f,0.88226f,0.882215f,0.88217f,0.882125f,0.882079f,0.882034f,0.881989f,0.881944f,0.881899f,0.881853f,0.881808f,0.881763f,0.881718f,0.881673f,0.881627f,0.881582f,0.881537f,0.881491f,0.881446f,0.881401f,0.881356f,0.88131f,0.881265f,0.88122f,0.881174f,0.881129f,0.881084f,0.881038f,0.880993f,0.880948f,0.880902f,0.880857f,0.880812f,0.880766f,0.880721f,0.880675f,0.88063f,0.880585f,0.880539f,0.880494f,0.880448f,0.880403f,0.880357f,0.880312f,0.880266f,0.880221f,0.880175f,0.88013f,0.880084f,0.880039f,0.879993f,0.879948f,0.879902f,0.879857f,0.879811f,0.879765f,0.87972f,0.879674f,0.879629f,0.879583f,0.879537f,0.879492f,0.879446f,0.8794f,0.879355f,0.879309f,0.879264f,0.879218f,0.879172f,0.879126f,0.879081f,0.879035f,0.878989f,0.878944f,0.878898f,0.878852f,0.878806f,0.878761f,0.878715f,0.878669f,0.878623f,0.878578f,0.878532f,0.878486f,0.87844f,0.878394f,0.878349f,0.878303f,0.878257f,0.878211f,0.878165f,0.878119f,0.878073f,0.878028f,0.877982f,0.877936f,0.87789f,0.877844f,0.877798f,0.877752f,0.877706f,0.87766f,0.877614f,0.877568f,0.877522f,0.877476f,0.87743f,0.877384f,0.877338f,0.877292f,0.877246f,0.8772f,0.877154f,0.877108f,0.877062f,0.877016f,0.87697f,0.876924f,0.876878f,0.876832f,0.876786f,0.87674f,0.876693f,0.876647f,0.876601f,0.876555f,0.876509f,0.876463f,0.876417f,0.87637f,0.876324f,0.876278f,0.876232f,0.876186f,0.876139f,0.876093f,0.876047f,0.876001f,0.875954f,0.875908f,0.875862f,0.875816f,0.875769f,0.875723f,0.875677f,0.87563f,0.875584f,0.875538f,0.875492f,0.875445f,0.875399f,0.875353f,0.875306f,0.87526f,0.875213f,0.875167f,0.875121f,0.875074f,0.875028f,0.874982f,0.874935f,0.874889f,0.874842f,0.874796f,0.874749f,0.874703f,0.874656f,0.87461f,0.874563f,0.874517f,0.87447f,0.874424f,0.874377f,0.874331f,0.874284f,0.874238f,0.874191f,0.874145f,0.874098f,0.874052f,0.874005f,0.873958f,0.873912f,0.873865f,0.873818f,0.873772f,0.873725f,0.873679f,0.873632f,0.873585f,0.873539f,0.873492f,0.873445f,0.873399f,0.873352f,0.873305f,0.873259f,0.873212f,0.873165f,0.873118f,0.873072f,0.873025f,0.872978f,0.872931f,0.872885f,0.872838f,0.872791f,0.872744f,0.872697f,0.872651f,0.872604f,0.872557f,0.87251f,0.872463f,0.872416f,0.87237f,0.872323f,0.872276f,0.872229f,0.872182f,0.872135f,0.872088f,0.872041f,0.871994f,0.871947f,0.8719f,0.871853f,0.871806f,0.87176f,0.871713f,0.871666f,0.871619f,0.871571f,0.871525f,0.871477f,0.871431f,0.871383f,0.871336f,0.871289f,0.871242f,0.871195f,0.871148f,0.871101f,0.871054f,0.871007f,0.87096f,0.870913f,0.870866f,0.870818f,0.870771f,0.870724f,0.870677f,0.87063f,0.870583f,0.870536f,0.870488f,0.870441f,0.870394f,0.870347f,0.8703f,0.870252f,0.870205f,0.870158f,0.870111f,0.870063f,0.870016f,0.869969f,0.869922f,0.869874f,0.869827f,0.86978f,0.869732f,0.869685f,0.869638f,0.86959f,0.869543f,0.869496f,0.869448f,0.869401f,0.869354f,0.869306f,0.869259f,0.869211f,0.869164f,0.869117f,0.869069f,0.869022f,0.868974f,0.868927f,0.868879f,0.868832f,0.868784f,0.868737f,0.868689f,0.868642f,0.868594f,0.868547f,0.868499f,0.868452f,0.868404f,0.868357f,0.868309f,0.868262f,0.868214f,0.868167f,0.868119f,0.868071f,0.868024f,0.867976f,0.867929f,0.867881f,0.867833f,0.867786f,0.867738f,0.86769f,0.867643f,0.867595f,0.867547f,0.8675f,0.867452f,0.867404f,0.867356f,0.867309f,0.867261f,0.867213f,0.867166f,0.867118f,0.86707f,0.867022f,0.866974f,0.866927f,0.866879f,0.866831f,0.866783f,0.866736f,0.866688f,0.86664f,0.866592f,0.866544f,0.866496f,0.866449f,0.866401f,0.866353f,0.866305f,0.866257f,0.866209f,0.866161f,0.866113f,0.866065f,0.866017f,0.865969f,0.865921f,0.865874f,0.865826f,0.865778f,0.86573f,0.865682f,0.865634f,0.865586f,0.865538f,0.86549f,0.865442f,0.865393f,0.865345f,0.865297f,0.865249f,0.865201f,0.865153f,0.865105f,0.865057f,0.865009f,0.864961f,0.864913f,0.864865f,0.864816f,0.864768f,0.86472f,0.864672f,0.864624f,0.864576f,0.864527f,0.864479f,0.864431f,0.864383f,0.864335f,0.864286f,0.864238f,0.86419f,0.864142f,0.864093f,0.864045f,0.863997f,0.863949f,0.8639f,0.863852f,0.863804f,0.863755f,0.863707f,0.863659f,0.863611f,0.863562f,0.863514f,0.863465f,0.863417f,0.863369f,0.86332f,0.863272f,0.863224f,0.863175f,0.863127f,0.863078f,0.86303f,0.862981f,0.862933f,0.862885f,0.862836f,0.862788f,0.862739f,0.862691f,0.862642f,0.862594f,0.862545f,0.862497f,0.862448f,0.8624f,0.862351f,0.862303f,0.862254f,0.862205f,0.862157f,0.862108f,0.86206f,0.862011f,0.861963f,0.861914f,0.861865f,0.861817f,0.861768f,0.861719f,0.861671f,0.861622f,0.861574f,0.861525f,0.861476f,0.861427f,0.861379f,0.86133f,0.861281f,0.861233f,0.861184f,0.861135f,0.861086f,0.861038f,0.860989f,0.86094f,0.860891f,0.860843f,0.860794f,0.860745f,0.860696f,0.860647f,0.860598f,0.86055f,0.860501f,0.860452f,0.860403f,0.860354f,0.860305f,0.860256f,0.860208f,0.860159f,0.86011f,0.860061f,0.860012f,0.859963f,0.859914f,0.859865f,0.859816f,0.859767f,0.859718f,0.859669f,0.85962f,0.859571f,0.859522f,0.859473f,0.859424f,0.859375f,0.859326f,0.859277f,0.859228f,0.859179f,0.85913f,0.859081f,0.859032f,0.858983f,0.858934f,0.858885f,0.858836f,0.858787f,0.858737f,0.858688f,0.858639f,0.85859f,0.858541f,0.858492f,0.858442f,0.858393f,0.858344f,0.858295f,0.858246f,0.858196f,0.858147f,0.858098f,0.858049f,0.858f,0.85795f,0.857901f,0.857852f,0.857803f,0.857753f,0.857704f,0.857655f,0.857605f,0.857556f,0.857507f,0.857457f,0.857408f,0.857359f,0.857309f,0.85726f,0.857211f,0.857161f,0.857112f,0.857062f,0.857013f,0.856964f,0.856914f,0.856865f,0.856815f,0.856766f,0.856716f,0.856667f,0.856618f,0.856568f,0.856519f,0.856469f,0.85642f,0.85637f,0.856321f,0.856271f,0.856222f,0.856172f,0.856123f,0.856073f,0.856023f,0.855974f,0.855924f,0.855875f,0.855825f,0.855776f,0.855726f,0.855676f,0.855627f,0.855577f,0.855527f,0.855478f,0.855428f,0.855378f,0.855329f,0.855279f,0.855229f,0.85518f,0.85513f,0.85508f,0.855031f,0.854981f,0.854931f,0.854881f,0.854832f,0.854782f,0.854732f,0.854682f,0.854633f,0.854583f,0.854533f,0.854483f,0.854433f,0.854384f,0.854334f,0.854284f,0.854234f,0.854184f,0.854134f,0.854085f,0.854035f,0.853985f,0.853935f,0.853885f,0.853835f,0.853785f,0.853735f,0.853685f,0.853635f,0.853586f,0.853536f,0.853486f,0.853436f,0.853386f,0.853336f,0.853286f,0.853236f,0.853186f,0.853136f,0.853086f,0.853036f,0.852986f,0.852936f,0.852886f,0.852835f,0.852785f,0.852735f,0.852685f,0.852635f,0.852585f,0.852535f,0.852485f,0.852435f,0.852385f,0.852334f,0.852284f,0.852234f,0.852184f,0.852134f,0.852084f,0.852033f,0.851983f,0.851933f,0.851883f,0.851833f,0.851782f,0.851732f,0.851682f,0.851632f,0.851581f,0.851531f,0.851481f,0.851431f,0.85138f,0.85133f,0.85128f,0.851229f,0.851179f,0.851129f,0.851078f,0.851028f,0.850978f,0.850927f,0.850877f,0.850827f,0.850776f,0.850726f,0.850675f,0.850625f,0.850575f,0.850524f,0.850474f,0.850423f,0.850373f,0.850322f,0.850272f,0.850222f,0.850171f,0.850121f,0.85007f,0.85002f,0.849969f,0.849919f,0.849868f,0.849818f,0.849767f,0.849716f,0.849666f,0.849615f,0.849565f,0.849514f,0.849464f,0.849413f,0.849362f,0.849312f,0.849261f,0.849211f,0.84916f,0.849109f,0.849059f,0.849008f,0.848957f,0.848907f,0.848856f,0.848805f,0.848755f,0.848704f,0.848653f,0.848602f,0.848552f,0.848501f,0.84845f,0.8484f,0.848349f,0.848298f,0.848247f,0.848196f,0.848146f,0.848095f,0.848044f,0.847993f,0.847943f,0.847892f,0.847841f,0.84779f,0.847739f,0.847688f,0.847637f,0.847587f,0.847536f,0.847485f,0.847434f,0.847383f,0.847332f,0.847281f,0.84723f,0.847179f,0.847128f,0.847077f,0.847026f,0.846975f,0.846924f,0.846874f,0.846823f,0.846772f,0.846721f,0.84667f,0.846618f,0.846567f,0.846516f,0.846465f,0.846414f,0.846363f,0.846312f,0.846261f,0.84621f,0.846159f,0.846108f,0.846057f,0.846006f,0.845955f,0.845903f,0.845852f,0.845801f,0.84575f,0.845699f,0.845648f,0.845596f,0.845545f,0.845494f,0.845443f,0.845392f,0.84534f,0.845289f,0.845238f,0.845187f,0.845136f,0.845084f,0.845033f,0.844982f,0.84493f,0.844879f,0.844828f,0.844777f,0.844725f,0.844674f,0.844623f,0.844571f,0.84452f,0.844469f,0.844417f,0.844366f,0.844315f,0.844263f,0.844212f,0.84416f,0.844109f,0.844058f,0.844006f,0.843955f,0.843903f,0.843852f,0.8438f,0.843749f,0.843697f,0.843646f,0.843595f,0.843543f,0.843492f,0.84344f,0.843389f,0.843337f,0.843285f,0.843234f,0.843182f,0.843131f,0.843079f,0.843028f,0.842976f,0.842925f,0.842873f,0.842821f,0.84277f,0.842718f,0.842667f,0.842615f,0.842563f,0.842512f,0.84246f,0.842408f,0.842357f,0.842305f,0.842253f,0.842202f,0.84215f,0.842098f,0.842047f,0.841995f,0.841943f,0.841891f,0.84184f,0.841788f,0.841736f,0.841684f,0.841633f,0.841581f,0.841529f,0.841477f,0.841425f,0.841374f,0.841322f,0.84127f,0.841218f,0.841166f,0.841114f,0.841063f,0.841011f,0.840959f,0.840907f,0.840855f,0.840803f,0.840751f,0.840699f,0.840647f,0.840596f,0.840544f,0.840492f,0.84044f,0.840388f,0.840336f,0.840284f,0.840232f,0.84018f,0.840128f,0.840076f,0.840024f,0.839972f,0.83992f,0.839868f,0.839816f,0.839764f,0.839712f,0.83966f,0.839607f,0.839555f,0.839503f,0.839451f,0.839399f,0.839347f,0.839295f,0.839243f,0.839191f,0.839138f,0.839086f,0.839034f,0.838982f,0.83893f,0.838878f,0.838825f,0.838773f,0.838721f,0.838669f,0.838617f,0.838564f,0.838512f,0.83846f,0.838408f,0.838355f,0.838303f,0.838251f,0.838198f,0.838146f,0.838094f,0.838042f,0.837989f,0.837937f,0.837885f,0.837832f,0.83778f,0.837728f,0.837675f,0.837623f,0.837571f,0.837518f,0.837466f,0.837413f,0.837361f,0.837309f,0.837256f,0.837204f,0.837151f,0.837099f,0.837046f,0.836994f,0.836941f,0.836889f,0.836836f,0.836784f,0.836732f,0.836679f,0.836627f,0.836574f,0.836521f,0.836469f,0.836416f,0.836364f,0.836311f,0.836259f,0.836206f,0.836153f,0.836101f,0.836048f,0.835996f,0.835943f,0.835891f,0.835838f,0.835785f,0.835733f,0.83568f,0.835627f,0.835575f,0.835522f,0.835469f,0.835417f,0.835364f,0.835311f,0.835258f,0.835206f,0.835153f,0.8351f,0.835048f,0.834995f,0.834942f,0.834889f,0.834836f,0.834784f,0.834731f,0.834678f,0.834625f,0.834572f,0.83452f,0.834467f,0.834414f,0.834361f,0.834308f,0.834255f,0.834203f,0.83415f,0.834097f,0.834044f,0.833991f,0.833938f,0.833885f,0.833832f,0.833779f,0.833726f,0.833674f,0.83362f,0.833568f,0.833515f,0.833462f,0.833409f,0.833356f,0.833303f,0.83325f,0.833197f,0.833144f,0.833091f,0.833038f,0.832985f,0.832931f,0.832878f,0.832825f,0.832772f,0.832719f,0.832666f,0.832613f,0.83256f,0.832507f,0.832454f,0.832401f,0.832347f,0.832294f,0.832241f,0.832188f,0.832135f,0.832082f,0.832028f,0.831975f,0.831922f,0.831869f,0.831816f,0.831762f,0.831709f,0.831656f,0.831603f,0.83155f,0.831496f,0.831443f,0.83139f,0.831336f,0.831283f,0.83123f,0.831177f,0.831123f,0.83107f,0.831016f,0.830963f,0.83091f,0.830857f,0.830803f,0.83075f,0.830696f,0.830643f,0.83059f,0.830536f,0.830483f,0.830429f,0.830376f,0.830323f,0.830269f,0.830216f,0.830162f,0.830109f,0.830055f,0.830002f,0.829948f,0.829895f,0.829841f,0.829788f,0.829734f,0.829681f,0.829627f,0.829574f,0.82952f,0.829467f,0.829413f,0.82936f,0.829306f,0.829252f,0.829199f,0.829145f,0.829092f,0.829038f,0.828985f,0.828931f,0.828877f,0.828824f,0.82877f,0.828716f,0.828663f,0.828609f,0.828555f,0.828502f,0.828448f,0.828394f,0.828341f,0.828287f,0.828233f,0.828179f,0.828126f,0.828072f,0.828018f,0.827964f,0.827911f,0.827857f,0.827803f,0.827749f,0.827695f,0.827642f,0.827588f,0.827534f,0.82748f,0.827426f,0.827372f,0.827319f,0.827265f,0.827211f,0.827157f,0.827103f,0.827049f,0.826995f,0.826941f,0.826888f,0.826834f,0.82678f,0.826726f,0.826672f,0.826618f,0.826564f,0.82651f,0.826456f,0.826402f,0.826348f,0.826294f,0.82624f,0.826186f,0.826132f,0.826078f,0.826024f,0.82597f,0.825916f,0.825862f,0.825808f,0.825754f,0.8257f,0.825646f,0.825591f,0.825537f,0.825483f,0.825429f,0.825375f,0.825321f,0.825267f,0.825213f,0.825158f,0.825104f,0.82505f,0.824996f,0.824942f,0.824887f,0.824833f,0.824779f,0.824725f,0.824671f,0.824616f,0.824562f,0.824508f,0.824454f,0.824399f,0.824345f,0.824291f,0.824237f,0.824182f,0.824128f,0.824074f,0.824019f,0.823965f,0.823911f,0.823856f,0.823802f,0.823748f,0.823693f,0.823639f,0.823584f,0.82353f,0.823476f,0.823421f,0.823367f,0.823313f,0.823258f,0.823204f,0.823149f,0.823095f,0.82304f,0.822986f,0.822931f,0.822877f,0.822823f,0.822768f,0.822713f,0.822659f,0.822604f,0.82255f,0.822495f,0.822441f,0.822386f,0.822332f,0.822277f,0.822223f,0.822168f,0.822114f,0.822059f,0.822004f,0.82195f,0.821895f,0.821841f,0.821786f,0.821731f,0.821677f,0.821622f,0.821567f,0.821513f,0.821458f,0.821403f,0.821349f,0.821294f,0.821239f,0.821185f,0.82113f,0.821075f,0.82102f,0.820966f,0.820911f,0.820856f,0.820801f,0.820747f,0.820692f,0.820637f,0.820582f,0.820527f,0.820473f,0.820418f,0.820363f,0.820308f,0.820253f,0.820199f,0.820144f,0.820089f,0.820034f,0.819979f,0.819924f,0.819869f,0.819814f,0.81976f,0.819705f,0.81965f,0.819595f,0.81954f,0.819485f,0.81943f,0.819375f,0.81932f,0.819265f,0.81921f,0.819155f,0.8191f,0.819045f,0.81899f,0.818935f,0.81888f,0.818825f,0.81877f,0.818715f,0.81866f,0.818605f,0.81855f,0.818495f,0.81844f,0.818385f,0.818329f,0.818274f,0.818219f,0.818164f,0.818109f,0.818054f,0.817999f,0.817944f,0.817888f,0.817833f,0.817778f,0.817723f,0.817668f,0.817612f,0.817557f,0.817502f,0.817447f,0.817391f,0.817336f,0.817281f,0.817226f,0.817171f,0.817115f,0.81706f,0.817005f,0.816949f,0.816894f,0.816839f,0.816784f,0.816728f,0.816673f,0.816618f,0.816562f,0.816507f,0.816451f,0.816396f,0.816341f,0.816285f,0.81623f,0.816175f,0.816119f,0.816064f,0.816008f,0.815953f,0.815898f,0.815842f,0.815787f,0.815731f,0.815676f,0.81562f,0.815565f,0.815509f,0.815454f,0.815398f,0.815343f,0.815287f,0.815232f,0.815176f,0.815121f,0.815065f,0.81501f,0.814954f,0.814899f,0.814843f,0.814787f,0.814732f,0.814676f,0.814621f,0.814565f,0.814509f,0.814454f,0.814398f,0.814342f,0.814287f,0.814231f,0.814175f,0.81412f,0.814064f,0.814008f,0.813953f,0.813897f,0.813841f,0.813786f,0.81373f,0.813674f,0.813618f,0.813563f,0.813507f,0.813451f,0.813395f,0.81334f,0.813284f,0.813228f,0.813172f,0.813116f,0.813061f,0.813005f,0.812949f,0.812893f,0.812837f,0.812782f,0.812726f,0.81267f,0.812614f,0.812558f,0.812502f,0.812446f,0.81239f,0.812334f,0.812279f,0.812223f,0.812167f,0.812111f,0.812055f,0.811999f,0.811943f,0.811887f,0.811831f,0.811775f,0.811719f,0.811663f,0.811607f,0.811551f,0.811495f,0.811439f,0.811383f,0.811327f,0.811271f,0.811215f,0.811159f,0.811103f,0.811046f,0.81099f,0.810934f,0.810878f,0.810822f,0.810766f,0.81071f,0.810654f,0.810598f,0.810541f,0.810485f,0.810429f,0.810373f,0.810317f,0.81026f,0.810204f,0.810148f,0.810092f,0.810036f,0.80998f,0.809923f,0.809867f,0.809811f,0.809754f,0.809698f,0.809642f,0.809586f,0.809529f,0.809473f,0.809417f,0.809361f,0.809304f,0.809248f,0.809192f,0.809135f,0.809079f,0.809023f,0.808966f,0.80891f,0.808853f,0.808797f,0.808741f,0.808684f,0.808628f,0.808572f,0.808515f,0.808459f,0.808402f,0.808346f,0.808289f,0.808233f,0.808177f,0.80812f,0.808064f,0.808007f,0.80795f,0.807894f,0.807838f,0.807781f,0.807725f,0.807668f,0.807612f,0.807555f,0.807498f,0.807442f,0.807385f,0.807329f,0.807272f,0.807216f,0.807159f,0.807102f,0.807046f,0.806989f,0.806932f,0.806876f,0.806819f,0.806763f,0.806706f,0.806649f,0.806593f,0.806536f,0.806479f,0.806423f,0.806366f,0.806309f,0.806252f,0.806196f,0.806139f,0.806082f,0.806025f,0.805969f,0.805912f,0.805855f,0.805798f,0.805742f,0.805685f,0.805628f,0.805571f,0.805514f,0.805458f,0.805401f,0.805344f,0.805287f,0.80523f,0.805173f,0.805117f,0.80506f,0.805003f,0.804946f,0.804889f,0.804832f,0.804775f,0.804718f,0.804661f,0.804605f,0.804548f,0.804491f,0.804434f,0.804377f,0.80432f,0.804263f,0.804206f,0.804149f,0.804092f,0.804035f,0.803978f,0.803921f,0.803864f,0.803807f,0.80375f,0.803693f,0.803636f,0.803579f,0.803522f,0.803464f,0.803407f,0.80335f,0.803293f,0.803236f,0.803179f,0.803122f,0.803065f,0.803008f,0.80295f,0.802893f,0.802836f,0.802779f,0.802722f,0.802665f,0.802607f,0.80255f,0.802493f,0.802436f,0.802379f,0.802321f,0.802264f,0.802207f,0.80215f,0.802092f,0.802035f,0.801978f,0.801921f,0.801863f,0.801806f,0.801749f,0.801691f,0.801634f,0.801577f,0.801519f,0.801462f,0.801405f,0.801347f,0.80129f,0.801233f,0.801175f,0.801118f,0.801061f,0.801003f,0.800946f,0.800888f,0.800831f,0.800774f,0.800716f,0.800659f,0.800601f,0.800544f,0.800486f,0.800429f,0.800371f,0.800314f,0.800256f,0.800199f,0.800141f,0.800084f,0.800026f,0.799969f,0.799911f,0.799854f,0.799796f,0.799739f,0.799681f,0.799624f,0.799566f,0.799508f,0.799451f,0.799393f,0.799336f,0.799278f,0.79922f,0.799163f,0.799105f,0.799048f,0.79899f,0.798932f,0.798875f,0.798817f,0.798759f,0.798701f,0.798644f,0.798586f,0.798528f,0.798471f,0.798413f,0.798355f,0.798297f,0.79824f,0.798182f,0.798124f,0.798066f,0.798009f,0.797951f,0.797893f,0.797835f,0.797777f,0.79772f,0.797662f,0.797604f,0.797546f,0.797488f,0.797431f,0.797373f,0.797315f,0.797257f,0.797199f,0.797141f,0.797083f,0.797025f,0.796968f,0.79691f,0.796852f,0.796794f,0.796736f,0.796678f,0.79662f,0.796562f,0.796504f,0.796446f,0.796388f,0.79633f,0.796272f,0.796214f,0.796156f,0.796098f,0.79604f,0.795982f,0.795924f,0.795866f,0.795808f,0.79575f,0.795692f,0.795634f,0.795576f,0.795517f,0.795459f,0.795401f,0.795343f,0.795285f,0.795227f,0.795169f,0.795111f,0.795052f,0.794994f,0.794936f,0.794878f,0.79482f,0.794762f,0.794703f,0.794645f,0.794587f,0.794529f,0.794471f,0.794412f,0.794354f,0.794296f,0.794238f,0.794179f,0.794121f,0.794063f,0.794005f,0.793946f,0.793888f,0.79383f,0.793771f,0.793713f,0.793655f,0.793596f,0.793538f,0.79348f,0.793421f,0.793363f,0.793305f,0.793246f,0.793188f,0.793129f,0.793071f,0.793013f,0.792954f,0.792896f,0.792838f,0.792779f,0.792721f,0.792662f,0.792604f,0.792545f,0.792487f,0.792428f,0.79237f,0.792311f,0.792253f,0.792194f,0.792136f,0.792077f,0.792019f,0.79196f,0.791902f,0.791843f,0.791785f,0.791726f,0.791667f,0.791609f,0.79155f,0.791492f,0.791433f,0.791375f,0.791316f,0.791257f,0.791199f,0.79114f,0.791081f,0.791023f,0.790964f,0.790905f,0.790847f,0.790788f,0.790729f,0.790671f,0.790612f,0.790553f,0.790495f,0.790436f,0.790377f,0.790318f,0.79026f,0.790201f,0.790142f,0.790083f,0.790025f,0.789966f,0.789907f,0.789848f,0.789789f,0.78973f,0.789672f,0.789613f,0.789554f,0.789495f,0.789436f,0.789377f,0.789319f,0.78926f,0.789201f,0.789142f,0.789083f,0.789024f,0.788965f,0.788906f,0.788847f,0.788789f,0.78873f,0.788671f,0.788612f,0.788553f,0.788494f,0.788435f,0.788376f,0.788317f,0.788258f,0.788199f,0.78814f,0.788081f,0.788022f,0.787963f,0.787904f,0.787845f,0.787786f,0.787727f,0.787668f,0.787609f,0.787549f,0.78749f,0.787431f,0.787372f,0.787313f,0.787254f,0.787195f,0.787136f,0.787077f,0.787017f,0.786958f,0.786899f,0.78684f,0.786781f,0.786722f,0.786662f,0.786603f,0.786544f,0.786485f,0.786426f,0.786366f,0.786307f,0.786248f,0.786189f,0.786129f,0.78607f,0.786011f,0.785952f,0.785892f,0.785833f,0.785774f,0.785714f,0.785655f,0.785596f,0.785536f,0.785477f,0.785418f,0.785358f,0.785299f,0.78524f,0.78518f,0.785121f,0.785062f,0.785002f,0.784943f,0.784883f,0.784824f,0.784765f,0.784705f,0.784646f,0.784586f,0.784527f,0.784467f,0.784408f,0.784348f,0.784289f,0.78423f,0.78417f,0.78411f,0.784051f,0.783991f,0.783932f,0.783872f,0.783813f,0.783753f,0.783694f,0.783634f,0.783575f,0.783515f,0.783456f,0.783396f,0.783336f,0.783277f,0.783217f,0.783157f,0.783098f,0.783038f,0.782979f,0.782919f,0.782859f,0.7828f,0.78274f,0.78268f,0.782621f,0.782561f,0.782501f,0.782442f,0.782382f,0.782322f,0.782263f,0.782203f,0.782143f,0.782083f,0.782024f,0.781964f,0.781904f,0.781844f,0.781785f,0.781725f,0.781665f,0.781605f,0.781545f,0.781485f,0.781426f,0.781366f,0.781306f,0.781246f,0.781186f,0.781126f,0.781067f,0.781007f,0.780947f,0.780887f,0.780827f,0.780767f,0.780707f,0.780647f,0.780587f,0.780527f,0.780468f,0.780408f,0.780348f,0.780288f,0.780228f,0.780168f,0.780108f,0.780048f,0.779988f,0.779928f,0.779868f,0.779808f,0.779748f,0.779688f,0.779628f,0.779568f,0.779508f,0.779448f,0.779387f,0.779327f,0.779267f,0.779207f,0.779147f,0.779087f,0.779027f,0.778967f,0.778907f,0.778847f,0.778786f,0.778726f,0.778666f,0.778606f,0.778546f,0.778486f,0.778425f,0.778365f,0.778305f,0.778245f,0.778185f,0.778124f,0.778064f,0.778004f,0.777944f,0.777884f,0.777823f,0.777763f,0.777703f,0.777642f,0.777582f,0.777522f,0.777462f,0.777401f,0.777341f,0.777281f,0.77722f,0.77716f,0.7771f,0.777039f,0.776979f,0.776919f,0.776858f,0.776798f,0.776737f,0.776677f,0.776617f,0.776556f,0.776496f,0.776436f,0.776375f,0.776315f,0.776254f,0.776194f,0.776133f,0.776073f,0.776012f,0.775952f,0.775891f,0.775831f,0.77577f,0.77571f,0.775649f,0.775589f,0.775528f,0.775468f,0.775407f,0.775347f,0.775286f,0.775226f,0.775165f,0.775105f,0.775044f,0.774983f,0.774923f,0.774862f,0.774801f,0.774741f,0.77468f,0.77462f,0.774559f,0.774498f,0.774438f,0.774377f,0.774316f,0.774256f,0.774195f,0.774134f,0.774074f,0.774013f,0.773952f,0.773892f,0.773831f,0.77377f,0.773709f,0.773649f,0.773588f,0.773527f,0.773466f,0.773406f,0.773345f,0.773284f,0.773223f,0.773162f,0.773102f,0.773041f,0.77298f,0.772919f,0.772858f,0.772797f,0.772737f,0.772676f,0.772615f,0.772554f,0.772493f,0.772432f,0.772371f,0.77231f,0.77225f,0.772189f,0.772128f,0.772067f,0.772006f,0.771945f,0.771884f,0.771823f,0.771762f,0.771701f,0.77164f,0.771579f,0.771518f,0.771457f,0.771396f,0.771335f,0.771274f,0.771213f,0.771152f,0.771091f,0.77103f,0.770969f,0.770908f,0.770847f,0.770786f,0.770725f,0.770664f,0.770602f,0.770541f,0.77048f,0.770419f,0.770358f,0.770297f,0.770236f,0.770175f,0.770113f,0.770052f,0.769991f,0.76993f,0.769869f,0.769807f,0.769746f,0.769685f,0.769624f,0.769563f,0.769501f,0.76944f,0.769379f,0.769318f,0.769256f,0.769195f,0.769134f,0.769073f,0.769011f,0.76895f,0.768889f,0.768827f,0.768766f,0.768705f,0.768644f,0.768582f,0.768521f,0.768459f,0.768398f,0.768337f,0.768275f,0.768214f,0.768153f,0.768091f,0.76803f,0.767968f,0.767907f,0.767846f,0.767784f,0.767723f,0.767661f,0.7676f,0.767539f,0.767477f,0.767416f,0.767354f,0.767293f,0.767231f,0.76717f,0.767108f,0.767047f,0.766985f,0.766924f,0.766862f,0.766801f,0.766739f,0.766677f,0.766616f,0.766554f,0.766493f,0.766431f,0.76637f,0.766308f,0.766246f,0.766185f,0.766123f,0.766062f,0.766f,0.765938f,0.765877f,0.765815f,0.765753f,0.765692f,0.76563f,0.765568f,0.765507f,0.765445f,0.765383f,0.765321f,0.76526f,0.765198f,0.765136f,0.765075f,0.765013f,0.764951f,0.764889f,0.764828f,0.764766f,0.764704f,0.764642f,0.764581f,0.764519f,0.764457f,0.764395f,0.764333f,0.764271f,0.76421f,0.764148f,0.764086f,0.764024f,0.763962f,0.7639f,0.763838f,0.763777f,0.763715f,0.763653f,0.763591f,0.763529f,0.763467f,0.763405f,0.763343f,0.763281f,0.763219f,0.763157f,0.763095f,0.763033f,0.762971f,0.762909f,0.762848f,0.762786f,0.762724f,0.762662f,0.7626f,0.762537f,0.762475f,0.762413f,0.762351f,0.762289f,0.762227f,0.762165f,0.762103f,0.762041f,0.761979f,0.761917f,0.761855f,0.761793f,0.761731f,0.761669f,0.761606f,0.761544f,0.761482f,0.76142f,0.761358f,0.761296f,0.761233f,0.761171f,0.761109f,0.761047f,0.760985f,0.760922f,0.76086f,0.760798f,0.760736f,0.760674f,0.760611f,0.760549f,0.760487f,0.760425f,0.760362f,0.7603f,0.760238f,0.760176f,0.760113f,0.760051f,0.759989f,0.759926f,0.759864f,0.759802f,0.759739f,0.759677f,0.759615f,0.759552f,0.75949f,0.759427f,0.759365f,0.759303f,0.75924f,0.759178f,0.759116f,0.759053f,0.758991f,0.758928f,0.758866f,0.758803f,0.758741f,0.758679f,0.758616f,0.758554f,0.758491f,0.758429f,0.758366f,0.758304f,0.758241f,0.758179f,0.758116f,0.758054f,0.757991f,0.757928f,0.757866f,0.757803f,0.757741f,0.757678f,0.757616f,0.757553f,0.75749f,0.757428f,0.757365f,0.757303f,0.75724f,0.757178f,0.757115f,0.757052f,0.75699f,0.756927f,0.756864f,0.756802f,0.756739f,0.756676f,0.756614f,0.756551f,0.756488f,0.756425f,0.756363f,0.7563f,0.756237f,0.756175f,0.756112f,0.756049f,0.755986f,0.755924f,0.755861f,0.755798f,0.755735f,0.755673f,0.75561f,0.755547f,0.755484f,0.755421f,0.755358f,0.755296f,0.755233f,0.75517f,0.755107f,0.755044f,0.754981f,0.754918f,0.754856f,0.754793f,0.75473f,0.754667f,0.754604f,0.754541f,0.754478f,0.754415f,0.754352f,0.754289f,0.754226f,0.754164f,0.754101f,0.754038f,0.753975f,0.753911f,0.753849f,0.753786f,0.753723f,0.75366f,0.753597f,0.753534f,0.753471f,0.753407f,0.753344f,0.753281f,0.753218f,0.753155f,0.753092f,0.753029f,0.752966f,0.752903f,0.75284f,0.752777f,0.752714f,0.75265f,0.752587f,0.752524f,0.752461f,0.752398f,0.752335f,0.752272f,0.752208f,0.752145f,0.752082f,0.752019f,0.751956f,0.751892f,0.751829f,0.751766f,0.751703f,0.75164f,0.751576f,0.751513f,0.75145f,0.751386f,0.751323f,0.75126f,0.751197f,0.751133f,0.75107f,0.751007f,0.750944f,0.75088f,0.750817f,0.750754f,0.75069f,0.750627f,0.750564f,0.7505f,0.750437f,0.750373f,0.75031f,0.750247f,0.750183f,0.75012f,0.750057f,0.749993f,0.74993f,0.749866f,0.749803f,0.749739f,0.749676f,0.749612f,0.749549f,0.749486f,0.749422f,0.749359f,0.749295f,0.749232f,0.749168f,0.749105f,0.749041f,0.748978f,0.748914f,0.74885f,0.748787f,0.748723f,0.74866f,0.748596f,0.748533f,0.748469f,0.748406f,0.748342f,0.748278f,0.748215f,0.748151f,0.748088f,0.748024f,0.74796f,0.747897f,0.747833f,0.747769f,0.747706f,0.747642f,0.747578f,0.747515f,0.747451f,0.747387f,0.747324f,0.74726f,0.747196f,0.747132f,0.747069f,0.747005f,0.746941f,0.746878f,0.746814f,0.74675f,0.746686f,0.746622f,0.746559f,0.746495f,0.746431f,0.746367f,0.746303f,0.74624f,0.746176f,0.746112f,0.746048f,0.745984f,0.74592f,0.745857f,0.745793f,0.745729f,0.745665f,0.745601f,0.745537f,0.745473f,0.745409f,0.745345f,0.745282f,0.745218f,0.745154f,0.74509f,0.745026f,0.744962f,0.744898f,0.744834f,0.74477f,0.744706f,0.744642f,0.744578f,0.744514f,0.74445f,0.744386f,0.744322f,0.744258f,0.744194f,0.74413f,0.744066f,0.744002f,0.743938f,0.743874f,0.74381f,0.743745f,0.743681f,0.743617f,0.743553f,0.743489f,0.743425f,0.743361f,0.743297f,0.743233f,0.743168f,0.743104f,0.74304f,0.742976f,0.742912f,0.742848f,0.742783f,0.742719f,0.742655f,0.742591f,0.742526f,0.742462f,0.742398f,0.742334f,0.74227f,0.742205f,0.742141f,0.742077f,0.742013f,0.741948f,0.741884f,0.74182f,0.741755f,0.741691f,0.741627f,0.741562f,0.741498f,0.741434f,0.741369f,0.741305f,0.741241f,0.741176f,0.741112f,0.741048f,0.740983f,0.740919f,0.740855f,0.74079f,0.740726f,0.740661f,0.740597f,0.740532f,0.740468f,0.740404f,0.740339f,0.740275f,0.74021f,0.740146f,0.740081f,0.740017f,0.739952f,0.739888f,0.739823f,0.739759f,0.739694f,0.73963f,0.739565f,0.739501f,0.739436f,0.739372f,0.739307f,0.739242f,0.739178f,0.739113f,0.739049f,0.738984f,0.73892f,0.738855f,0.73879f,0.738726f,0.738661f,0.738597f,0.738532f,0.738467f,0.738403f,0.738338f,0.738273f,0.738209f,0.738144f,0.738079f,0.738015f,0.73795f,0.737885f,0.73782f,0.737756f,0.737691f,0.737626f,0.737562f,0.737497f,0.737432f,0.737367f,0.737302f,0.737238f,0.737173f,0.737108f,0.737043f,0.736979f,0.736914f,0.736849f,0.736784f,0.736719f,0.736654f,0.73659f,0.736525f,0.73646f,0.736395f,0.73633f,0.736265f,0.7362f,0.736136f,0.736071f,0.736006f,0.735941f,0.735876f,0.735811f,0.735746f,0.735681f,0.735616f,0.735551f,0.735486f,0.735421f,0.735356f,0.735291f,0.735226f,0.735161f,0.735096f,0.735031f,0.734966f,0.734901f,0.734836f,0.734771f,0.734706f,0.734641f,0.734576f,0.734511f,0.734446f,0.734381f,0.734316f,0.734251f,0.734186f,0.734121f,0.734056f,0.73399f,0.733925f,0.73386f,0.733795f,0.73373f,0.733665f,0.7336f,0.733535f,0.733469f,0.733404f,0.733339f,0.733274f,0.733209f,0.733143f,0.733078f,0.733013f,0.732948f,0.732883f,0.732817f,0.732752f,0.732687f,0.732622f,0.732556f,0.732491f,0.732426f,0.732361f,0.732295f,0.73223f,0.732165f,0.732099f,0.732034f,0.731969f,0.731903f,0.731838f,0.731773f,0.731707f,0.731642f,0.731577f,0.731511f,0.731446f,0.731381f,0.731315f,0.73125f,0.731184f,0.731119f,0.731053f,0.730988f,0.730923f,0.730857f,0.730792f,0.730726f,0.730661f,0.730595f,0.73053f,0.730465f,0.730399f,0.730334f,0.730268f,0.730203f,0.730137f,0.730071f,0.730006f,0.72994f,0.729875f,0.729809f,0.729744f,0.729678f,0.729613f,0.729547f,0.729482f,0.729416f,0.72935f,0.729285f,0.729219f,0.729154f,0.729088f,0.729022f,0.728957f,0.728891f,0.728826f,0.72876f,0.728694f,0.728629f,0.728563f,0.728497f,0.728431f,0.728366f,0.7283f,0.728234f,0.728169f,0.728103f,0.728037f,0.727971f,0.727906f,0.72784f,0.727774f,0.727709f,0.727643f,0.727577f,0.727511f,0.727445f,0.72738f,0.727314f,0.727248f,0.727182f,0.727116f,0.727051f,0.726985f,0.726919f,0.726853f,0.726787f,0.726721f,0.726656f,0.72659f,0.726524f,0.726458f,0.726392f,0.726326f,0.72626f,0.726194f,0.726128f,0.726063f,0.725997f,0.725931f,0.725865f,0.725799f,0.725733f,0.725667f,0.725601f,0.725535f,0.725469f,0.725403f,0.725337f,0.725271f,0.725205f,0.725139f,0.725073f,0.725007f,0.724941f,0.724875f,0.724809f,0.724743f,0.724677f,0.724611f,0.724544f,0.724478f,0.724412f,0.724346f,0.72428f,0.724214f,0.724148f,0.724082f,0.724016f,0.723949f,0.723883f,0.723817f,0.723751f,0.723685f,0.723619f,0.723553f,0.723486f,0.72342f,0.723354f,0.723288f,0.723222f,0.723155f,0.723089f,0.723023f,0.722957f,0.72289f,0.722824f,0.722758f,0.722692f,0.722625f,0.722559f,0.722493f,0.722427f,0.72236f,0.722294f,0.722228f,0.722161f,0.722095f,0.722029f,0.721962f,0.721896f,0.72183f,0.721763f,0.721697f,0.721631f,0.721564f,0.721498f,0.721431f,0.721365f,0.721299f,0.721232f,0.721166f,0.721099f,0.721033f,0.720966f,0.7209f,0.720834f,0.720767f,0.720701f,0.720634f,0.720568f,0.720501f,0.720435f,0.720368f,0.720302f,0.720235f,0.720169f,0.720102f,0.720036f,0.719969f,0.719903f,0.719836f,0.71977f,0.719703f,0.719636f,0.71957f,0.719503f,0.719437f,0.71937f,0.719303f,0.719237f,0.71917f,0.719104f,0.719037f,0.71897f,0.718904f,0.718837f,0.71877f,0.718704f,0.718637f,0.71857f,0.718504f,0.718437f,0.71837f,0.718304f,0.718237f,0.71817f,0.718104f,0.718037f,0.71797f,0.717903f,0.717837f,0.71777f,0.717703f,0.717636f,0.71757f,0.717503f,0.717436f,0.717369f,0.717303f,0.717236f,0.717169f,0.717102f,0.717035f,0.716968f,0.716902f,0.716835f,0.716768f,0.716701f,0.716634f,0.716567f,0.7165f,0.716433f,0.716367f,0.7163f,0.716233f,0.716166f,0.716099f,0.716032f,0.715965f,0.715898f,0.715831f,0.715764f,0.715697f,0.71563f,0.715563f,0.715496f,0.715429f,0.715362f,0.715295f,0.715228f,0.715162f,0.715094f,0.715027f,0.71496f,0.714893f,0.714826f,0.714759f,0.714692f,0.714625f,0.714558f,0.714491f,0.714424f,0.714357f,0.71429f,0.714223f,0.714156f,0.714088f,0.714021f,0.713954f,0.713887f,0.71382f,0.713753f,0.713686f,0.713618f,0.713551f,0.713484f,0.713417f,0.71335f,0.713282f,0.713215f,0.713148f,0.713081f,0.713014f,0.712946f,0.712879f,0.712812f,0.712745f,0.712677f,0.71261f,0.712543f,0.712476f,0.712408f,0.712341f,0.712274f,0.712207f,0.712139f,0.712072f,0.712005f,0.711937f,0.71187f,0.711803f,0.711735f,0.711668f,0.711601f,0.711533f,0.711466f,0.711399f,0.711331f,0.711264f,0.711196f,0.711129f,0.711061f,0.710994f,0.710927f,0.710859f,0.710792f,0.710724f,0.710657f,0.710589f,0.710522f,0.710455f,0.710387f,0.71032f,0.710252f,0.710185f,0.710117f,0.71005f,0.709982f,0.709915f,0.709847f,0.70978f,0.709712f,0.709644f,0.709577f,0.709509f,0.709442f,0.709374f,0.709307f,0.709239f,0.709171f,0.709104f,0.709036f,0.708969f,0.708901f,0.708833f,0.708766f,0.708698f,0.708631f,0.708563f,0.708495f,0.708427f,0.70836f,0.708292f,0.708224f,0.708157f,0.708089f,0.708021f,0.707954f,0.707886f,0.707818f,0.70775f,0.707683f,0.707615f,0.707547f,0.707479f,0.707412f,0.707344f,0.707276f,0.707208f,0.707141f,0.707073f,0.707005f,0.706937f,0.706869f,0.706802f,0.706734f,0.706666f,0.706598f,0.70653f,0.706463f,0.706394f,0.706327f,0.706259f,0.706191f,0.706123f,0.706055f,0.705987f,0.705919f,0.705851f,0.705783f,0.705716f,0.705648f,0.70558f,0.705512f,0.705444f,0.705376f,0.705308f,0.70524f,0.705172f,0.705104f,0.705036f,0.704968f,0.7049f,0.704832f,0.704764f,0.704696f,0.704628f,0.70456f,0.704492f,0.704424f,0.704356f,0.704288f,0.70422f,0.704152f,0.704084f,0.704015f,0.703947f,0.703879f,0.703811f,0.703743f,0.703675f,0.703607f,0.703539f,0.703471f,0.703402f,0.703334f,0.703266f,0.703198f,0.70313f,0.703062f,0.702993f,0.702925f,0.702857f,0.702789f,0.702721f,0.702652f,0.702584f,0.702516f,0.702448f,0.702379f,0.702311f,0.702243f,0.702175f,0.702106f,0.702038f,0.70197f,0.701902f,0.701833f,0.701765f,0.701697f,0.701628f,0.70156f,0.701492f,0.701423f,0.701355f,0.701287f,0.701218f,0.70115f,0.701082f,0.701013f,0.700945f,0.700876f,0.700808f,0.70074f,0.700671f,0.700603f,0.700535f,0.700466f,0.700398f,0.700329f,0.700261f,0.700192f,0.700124f,0.700055f,0.699987f,0.699919f,0.69985f,0.699781f,0.699713f,0.699645f,0.699576f,0.699508f,0.699439f,0.699371f,0.699302f,0.699233f,0.699165f,0.699096f,0.699028f,0.698959f,0.698891f,0.698822f,0.698754f,0.698685f,0.698616f,0.698548f,0.698479f,0.698411f,0.698342f,0.698273f,0.698205f,0.698136f,0.698067f,0.697999f,0.69793f,0.697861f,0.697793f,0.697724f,0.697655f,0.697587f,0.697518f,0.697449f,0.697381f,0.697312f,0.697243f,0.697174f,0.697106f,0.697037f,0.696968f,0.696899f,0.696831f,0.696762f,0.696693f,0.696624f,0.696556f,0.696487f,0.696418f,0.696349f,0.69628f,0.696212f,0.696143f,0.696074f,0.696005f,0.695936f,0.695867f,0.695798f,0.69573f,0.695661f,0.695592f,0.695523f,0.695454f,0.695385f,0.695316f,0.695247f,0.695178f,0.69511f,0.695041f,0.694972f,0.694903f,0.694834f,0.694765f,0.694696f,0.694627f,0.694558f,0.694489f,0.69442f,0.694351f,0.694282f,0.694213f,0.694144f,0.694075f,0.694006f,0.693937f,0.693868f,0.693799f,0.69373f,0.693661f,0.693592f,0.693523f,0.693453f,0.693384f,0.693315f,0.693246f,0.693177f,0.693108f,0.693039f,0.69297f,0.692901f,0.692832f,0.692762f,0.692693f,0.692624f,0.692555f,0.692486f,0.692417f,0.692347f,0.692278f,0.692209f,0.69214f,0.692071f,0.692001f,0.691932f,0.691863f,0.691794f,0.691725f,0.691655f,0.691586f,0.691517f,0.691447f,0.691378f,0.691309f,0.69124f,0.691171f,0.691101f,0.691032f,0.690963f,0.690893f,0.690824f,0.690755f,0.690685f,0.690616f,0.690547f,0.690477f,0.690408f,0.690338f,0.690269f,0.6902f,0.69013f,0.690061f,0.689992f,0.689922f,0.689853f,0.689783f,0.689714f,0.689645f,0.689575f,0.689506f,0.689436f,0.689367f,0.689297f,0.689228f,0.689158f,0.689089f,0.68902f,0.68895f,0.688881f,0.688811f,0.688742f,0.688672f,0.688602f,0.688533f,0.688463f,0.688394f,0.688324f,0.688255f,0.688185f,0.688116f,0.688046f,0.687977f,0.687907f,0.687837f,0.687768f,0.687698f,0.687629f,0.687559f,0.687489f,0.68742f,0.68735f,0.68728f,0.687211f,0.687141f,0.687072f,0.687002f,0.686932f,0.686862f,0.686793f,0.686723f,0.686653f,0.686584f,0.686514f,0.686444f,0.686375f,0.686305f,0.686235f,0.686165f,0.686096f,0.686026f,0.685956f,0.685886f,0.685817f,0.685747f,0.685677f,0.685607f,0.685537f,0.685468f,0.685398f,0.685328f,0.685258f,0.685188f,0.685118f,0.685049f,0.684979f,0.684909f,0.684839f,0.684769f,0.684699f,0.684629f,0.68456f,0.68449f,0.68442f,0.68435f,0.68428f,0.68421f,0.68414f,0.68407f,0.684f,0.68393f,0.68386f,0.683791f,0.683721f,0.683651f,0.683581f,0.683511f,0.683441f,0.683371f,0.683301f,0.683231f,0.683161f,0.683091f,0.683021f,0.68295f,0.68288f,0.68281f,0.68274f,0.68267f,0.6826f,0.68253f,0.68246f,0.68239f,0.68232f,0.68225f,0.68218f,0.68211f,0.68204f,0.68197f,0.681899f,0.681829f,0.681759f,0.681689f,0.681619f,0.681549f,0.681479f,0.681408f,0.681338f,0.681268f,0.681198f,0.681128f,0.681057f,0.680987f,0.680917f,0.680847f,0.680776f,0.680706f,0.680636f,0.680566f,0.680496f,0.680425f,0.680355f,0.680285f,0.680215f,0.680144f,0.680074f,0.680004f,0.679933f,0.679863f,0.679793f,0.679722f,0.679652f,0.679582f,0.679511f,0.679441f,0.679371f,0.6793f,0.67923f,0.67916f,0.679089f,0.679019f,0.678948f,0.678878f,0.678808f,0.678737f,0.678667f,0.678597f,0.678526f,0.678456f,0.678385f,0.678315f,0.678244f,0.678174f,0.678103f,0.678033f,0.677963f,0.677892f,0.677821f,0.677751f,0.67768f,0.67761f,0.67754f,0.677469f,0.677399f,0.677328f,0.677257f,0.677187f,0.677116f,0.677046f,0.676975f,0.676905f,0.676834f,0.676763f,0.676693f,0.676622f,0.676552f,0.676481f,0.67641f,0.67634f,0.676269f,0.676199f,0.676128f,0.676057f,0.675987f,0.675916f,0.675845f,0.675775f,0.675704f,0.675633f,0.675563f,0.675492f,0.675421f,0.675351f,0.67528f,0.675209f,0.675139f,0.675068f,0.674997f,0.674926f,0.674855f,0.674785f,0.674714f,0.674643f,0.674573f,0.674502f,0.674431f,0.67436f,0.674289f,0.674218f,0.674148f,0.674077f,0.674006f,0.673935f,0.673864f,0.673793f,0.673723f,0.673652f,0.673581f,0.67351f,0.673439f,0.673368f,0.673297f,0.673227f,0.673156f,0.673085f,0.673014f,0.672943f,0.672872f,0.672801f,0.67273f,0.672659f,0.672588f,0.672517f,0.672446f,0.672376f,0.672305f,0.672234f,0.672162f,0.672091f,0.67202f,0.67195f,0.671879f,0.671808f,0.671737f,0.671666f,0.671594f,0.671523f,0.671452f,0.671381f,0.67131f,0.671239f,0.671168f,0.671097f,0.671026f,0.670955f,0.670884f,0.670813f,0.670742f,0.670671f,0.670599f,0.670528f,0.670457f,0.670386f,0.670315f,0.670244f,0.670173f,0.670101f,0.67003f,0.669959f,0.669888f,0.669817f,0.669745f,0.669674f,0.669603f,0.669532f,0.669461f,0.669389f,0.669318f,0.669247f,0.669176f,0.669104f,0.669033f,0.668962f,0.668891f,0.668819f,0.668748f,0.668677f,0.668606f,0.668534f,0.668463f,0.668392f,0.66832f,0.668249f,0.668178f,0.668106f,0.668035f,0.667964f,0.667892f,0.667821f,0.66775f,0.667678f,0.667607f,0.667535f,0.667464f,0.667393f,0.667321f,0.66725f,0.667179f,0.667107f,0.667036f,0.666964f,0.666893f,0.666821f,0.66675f,0.666678f,0.666607f,0.666535f,0.666464f,0.666392f,0.666321f,0.66625f,0.666178f,0.666107f,0.666035f,0.665964f,0.665892f,0.66582f,0.665749f,0.665677f,0.665606f,0.665534f,0.665463f,0.665391f,0.665319f,0.665248f,0.665176f,0.665105f,0.665033f,0.664962f,0.66489f,0.664818f,0.664747f,0.664675f,0.664603f,0.664532f,0.66446f,0.664389f,0.664317f,0.664245f,0.664174f,0.664102f,0.66403f,0.663958f,0.663887f,0.663815f,0.663743f,0.663672f,0.6636f,0.663528f,0.663456f,0.663385f,0.663313f,0.663241f,0.66317f,0.663098f,0.663026f,0.662954f,0.662882f,0.662811f,0.662739f,0.662667f,0.662595f,0.662524f,0.662452f,0.66238f,0.662308f,0.662236f,0.662164f,0.662093f,0.662021f,0.661949f,0.661877f,0.661805f,0.661733f,0.661661f,0.661589f,0.661518f,0.661446f,0.661374f,0.661302f,0.66123f,0.661158f,0.661086f,0.661014f,0.660942f,0.66087f,0.660798f,0.660726f,0.660654f,0.660582f,0.66051f,0.660438f,0.660366f,0.660294f,0.660222f,0.66015f,0.660078f,0.660006f,0.659934f,0.659862f,0.65979f,0.659718f,0.659646f,0.659574f,0.659502f,0.65943f,0.659358f,0.659286f,0.659214f,0.659142f,0.659069f,0.658997f,0.658925f,0.658853f,0.658781f,0.658709f,0.658637f,0.658565f,0.658492f,0.65842f,0.658348f,0.658276f,0.658204f,0.658132f,0.658059f,0.657987f,0.657915f,0.657843f,0.65777f,0.657698f,0.657626f,0.657554f,0.657482f,0.657409f,0.657337f,0.657265f,0.657193f,0.65712f,0.657048f,0.656976f,0.656904f,0.656831f,0.656759f,0.656687f,0.656614f,0.656542f,0.65647f,0.656397f,0.656325f,0.656253f,0.65618f,0.656108f,0.656036f,0.655963f,0.655891f,0.655819f,0.655746f,0.655674f,0.655601f,0.655529f,0.655457f,0.655384f,0.655312f,0.655239f,0.655167f,0.655095f,0.655022f,0.65495f,0.654877f,0.654805f,0.654732f,0.65466f,0.654587f,0.654515f,0.654442f,0.65437f,0.654297f,0.654225f,0.654152f,0.65408f,0.654007f,0.653935f,0.653862f,0.65379f,0.653717f,0.653644f,0.653572f,0.653499f,0.653427f,0.653354f,0.653282f,0.653209f,0.653137f,0.653064f,0.652991f,0.652919f,0.652846f,0.652773f,0.652701f,0.652628f,0.652556f,0.652483f,0.65241f,0.652337f,0.652265f,0.652192f,0.65212f,0.652047f,0.651974f,0.651901f,0.651829f,0.651756f,0.651683f,0.651611f,0.651538f,0.651465f,0.651392f,0.65132f,0.651247f,0.651174f,0.651101f,0.651029f,0.650956f,0.650883f,0.65081f,0.650737f,0.650665f,0.650592f,0.650519f,0.650446f,0.650373f,0.650301f,0.650228f,0.650155f,0.650082f,0.650009f,0.649936f,0.649863f,0.649791f,0.649718f,0.649645f,0.649572f,0.649499f,0.649426f,0.649353f,0.64928f,0.649207f,0.649135f,0.649062f,0.648988f,0.648916f,0.648843f,0.64877f,0.648697f,0.648624f,0.648551f,0.648478f,0.648405f,0.648332f,0.648259f,0.648186f,0.648113f,0.64804f,0.647967f,0.647894f,0.647821f,0.647748f,0.647675f,0.647602f,0.647529f,0.647456f,0.647382f,0.647309f,0.647236f,0.647163f,0.64709f,0.647017f,0.646944f,0.646871f,0.646798f,0.646725f,0.646652f,0.646578f,0.646505f,0.646432f,0.646359f,0.646286f,0.646213f,0.646139f,0.646066f,0.645993f,0.64592f,0.645847f,0.645773f,0.6457f,0.645627f,0.645554f,0.645481f,0.645407f,0.645334f,0.645261f,0.645188f,0.645114f,0.645041f,0.644968f,0.644895f,0.644821f,0.644748f,0.644675f,0.644601f,0.644528f,0.644455f,0.644382f,0.644308f,0.644235f,0.644161f,0.644088f,0.644015f,0.643942f,0.643868f,0.643795f,0.643722f,0.643648f,0.643575f,0.643501f,0.643428f,0.643355f,0.643281f,0.643208f,0.643134f,0.643061f,0.642987f,0.642914f,0.642841f,0.642767f,0.642694f,0.64262f,0.642547f,0.642473f,0.6424f,0.642326f,0.642253f,0.642179f,0.642106f,0.642032f,0.641959f,0.641885f,0.641812f,0.641738f,0.641665f,0.641591f,0.641518f,0.641444f,0.641371f,0.641297f,0.641223f,0.64115f,0.641076f,0.641003f,0.640929f,0.640856f,0.640782f,0.640708f,0.640635f,0.640561f,0.640487f,0.640414f,0.64034f,0.640267f,0.640193f,0.640119f,0.640046f,0.639972f,0.639898f,0.639825f,0.639751f,0.639677f,0.639604f,0.63953f,0.639456f,0.639382f,0.639309f,0.639235f,0.639161f,0.639088f,0.639014f,0.63894f,0.638866f,0.638792f,0.638719f,0.638645f,0.638571f,0.638497f,0.638424f,0.63835f,0.638276f,0.638202f,0.638128f,0.638055f,0.637981f,0.637907f,0.637833f,0.637759f,0.637685f,0.637612f,0.637538f,0.637464f,0.63739f,0.637316f,0.637242f,0.637168f,0.637094f,0.63702f,0.636947f,0.636873f,0.636799f,0.636725f,0.636651f,0.636577f,0.636503f,0.636429f,0.636355f,0.636281f,0.636207f,0.636133f,0.636059f,0.635985f,0.635911f,0.635837f,0.635763f,0.635689f,0.635615f,0.635541f,0.635467f,0.635393f,0.635319f,0.635245f,0.635171f,0.635097f,0.635023f,0.634949f,0.634875f,0.634801f,0.634727f,0.634652f,0.634578f,0.634504f,0.63443f,0.634356f,0.634282f,0.634208f,0.634134f,0.63406f,0.633985f,0.633911f,0.633837f,0.633763f,0.633689f,0.633615f,0.63354f,0.633466f,0.633392f,0.633318f,0.633244f,0.63317f,0.633095f,0.633021f,0.632947f,0.632873f,0.632798f,0.632724f,0.63265f,0.632576f,0.632502f,0.632427f,0.632353f,0.632279f,0.632204f,0.63213f,0.632056f,0.631982f,0.631907f,0.631833f,0.631759f,0.631684f,0.63161f,0.631536f,0.631461f,0.631387f,0.631313f,0.631238f,0.631164f,0.631089f,0.631015f,0.630941f,0.630866f,0.630792f,0.630718f,0.630643f,0.630569f,0.630494f,0.63042f,0.630345f,0.630271f,0.630197f,0.630122f,0.630048f,0.629973f,0.629899f,0.629824f,0.62975f,0.629675f,0.629601f,0.629526f,0.629452f,0.629378f,0.629303f,0.629228f,0.629154f,0.629079f,0.629005f,0.62893f,0.628856f,0.628781f,0.628707f,0.628632f,0.628558f,0.628483f,0.628408f,0.628334f,0.628259f,0.628185f,0.62811f,0.628035f,0.627961f,0.627886f,0.627812f,0.627737f,0.627662f,0.627588f,0.627513f,0.627438f,0.627364f,0.627289f,0.627214f,0.62714f,0.627065f,0.62699f,0.626916f,0.626841f,0.626766f,0.626692f,0.626617f,0.626542f,0.626467f,0.626393f,0.626318f,0.626243f,0.626168f,0.626094f,0.626019f,0.625944f,0.625869f,0.625795f,0.62572f,0.625645f,0.62557f,0.625495f,0.625421f,0.625346f,0.625271f,0.625196f,0.625121f,0.625046f,0.624972f,0.624897f,0.624822f,0.624747f,0.624672f,0.624597f,0.624522f,0.624448f,0.624373f,0.624298f,0.624223f,0.624148f,0.624073f,0.623998f,0.623923f,0.623848f,0.623773f,0.623699f,0.623624f,0.623549f,0.623474f,0.623399f,0.623324f,0.623249f,0.623174f,0.623099f,0.623024f,0.622949f,0.622874f,0.622799f,0.622724f,0.622649f,0.622574f,0.622499f,0.622424f,0.622349f,0.622274f,0.622199f,0.622124f,0.622048f,0.621973f,0.621898f,0.621823f,0.621748f,0.621673f,0.621598f,0.621523f,0.621448f,0.621373f,0.621297f,0.621222f,0.621147f,0.621072f,0.620997f,0.620922f,0.620847f,0.620771f,0.620696f,0.620621f,0.620546f,0.620471f,0.620396f,0.62032f,0.620245f,0.62017f,0.620095f,0.62002f,0.619944f,0.619869f,0.619794f,0.619719f,0.619643f,0.619568f,0.619493f,0.619418f,0.619342f,0.619267f,0.619192f,0.619117f,0.619041f,0.618966f,0.618891f,0.618815f,0.61874f,0.618665f,0.618589f,0.618514f,0.618439f,0.618363f,0.618288f,0.618213f,0.618137f,0.618062f,0.617987f,0.617911f,0.617836f,0.61776f,0.617685f,0.61761f,0.617534f,0.617459f,0.617383f,0.617308f,0.617232f,0.617157f,0.617082f,0.617006f,0.616931f,0.616855f,0.61678f,0.616704f,0.616629f,0.616553f,0.616478f,0.616402f,0.616327f,0.616251f,0.616176f,0.6161f,0.616025f,0.615949f,0.615874f,0.615798f,0.615723f,0.615647f,0.615572f,0.615496f,0.615421f,0.615345f,0.615269f,0.615194f,0.615118f,0.615043f,0.614967f,0.614891f,0.614816f,0.61474f,0.614664f,0.614589f,0.614513f,0.614438f,0.614362f,0.614286f,0.614211f,0.614135f,0.614059f,0.613984f,0.613908f,0.613832f,0.613757f,0.613681f,0.613605f,0.613529f,0.613454f,0.613378f,0.613302f,0.613227f,0.613151f,0.613075f,0.612999f,0.612924f,0.612848f,0.612772f,0.612696f,0.612621f,0.612545f,0.612469f,0.612393f,0.612317f,0.612242f,0.612166f,0.61209f,0.612014f,0.611938f,0.611863f,0.611787f,0.611711f,0.611635f,0.611559f,0.611483f,0.611407f,0.611332f,0.611256f,0.61118f,0.611104f,0.611028f,0.610952f,0.610876f,0.6108f,0.610724f,0.610649f,0.610573f,0.610497f,0.610421f,0.610345f,0.610269f,0.610193f,0.610117f,0.610041f,0.609965f,0.609889f,0.609813f,0.609737f,0.609661f,0.609585f,0.609509f,0.609433f,0.609357f,0.609281f,0.609205f,0.609129f,0.609053f,0.608977f,0.608901f,0.608825f,0.608749f,0.608673f,0.608597f,0.60852f,0.608444f,0.608368f,0.608292f,0.608216f,0.60814f,0.608064f,0.607988f,0.607912f,0.607836f,0.607759f,0.607683f,0.607607f,0.607531f,0.607455f,0.607379f,0.607302f,0.607226f,0.60715f,0.607074f,0.606998f,0.606922f,0.606845f,0.606769f,0.606693f,0.606617f,0.606541f,0.606464f,0.606388f,0.606312f,0.606236f,0.606159f,0.606083f,0.606007f,0.605931f,0.605854f,0.605778f,0.605702f,0.605626f,0.605549f,0.605473f,0.605397f,0.60532f,0.605244f,0.605168f,0.605091f,0.605015f,0.604939f,0.604862f,0.604786f,0.60471f,0.604633f,0.604557f,0.604481f,0.604404f,0.604328f,0.604251f,0.604175f,0.604098f,0.604022f,0.603946f,0.603869f,0.603793f,0.603716f,0.60364f,0.603563f,0.603487f,0.603411f,0.603334f,0.603258f,0.603181f,0.603105f,0.603028f,0.602952f,0.602875f,0.602799f,0.602722f,0.602646f,0.602569f,0.602493f,0.602416f,0.60234f,0.602263f,0.602187f,0.60211f,0.602034f,0.601957f,0.60188f,0.601804f,0.601727f,0.601651f,0.601574f,0.601498f,0.601421f,0.601344f,0.601268f,0.601191f,0.601115f,0.601038f,0.600961f,0.600885f,0.600808f,0.600731f,0.600655f,0.600578f,0.600501f,0.600425f,0.600348f,0.600271f,0.600195f,0.600118f,0.600041f,0.599965f,0.599888f,0.599811f,0.599735f,0.599658f,0.599581f,0.599504f,0.599428f,0.599351f,0.599274f,0.599197f,0.599121f,0.599044f,0.598967f,0.59889f,0.598814f,0.598737f,0.59866f,0.598583f,0.598506f,0.59843f,0.598353f,0.598276f,0.598199f,0.598122f,0.598045f,0.597969f,0.597892f,0.597815f,0.597738f,0.597661f,0.597584f,0.597507f,0.59743f,0.597354f,0.597277f,0.5972f,0.597123f,0.597046f,0.596969f,0.596892f,0.596815f,0.596738f,0.596661f,0.596584f,0.596508f,0.596431f,0.596354f,0.596277f,0.5962f,0.596123f,0.596046f,0.595969f,0.595892f,0.595815f,0.595738f,0.595661f,0.595584f,0.595507f,0.59543f,0.595353f,0.595276f,0.595199f,0.595122f,0.595044f,0.594967f,0.59489f,0.594813f,0.594736f,0.594659f,0.594582f,0.594505f,0.594428f,0.594351f,0.594274f,0.594197f,0.594119f,0.594042f,0.593965f,0.593888f,0.593811f,0.593734f,0.593657f,0.593579f,0.593502f,0.593425f,0.593348f,0.593271f,0.593194f,0.593116f,0.593039f,0.592962f,0.592885f,0.592808f,0.592731f,0.592653f,0.592576f,0.592499f,0.592421f,0.592344f,0.592267f,0.59219f,0.592113f,0.592035f,0.591958f,0.591881f,0.591803f,0.591726f,0.591649f,0.591572f,0.591494f,0.591417f,0.59134f,0.591262f,0.591185f,0.591108f,0.59103f,0.590953f,0.590876f,0.590798f,0.590721f,0.590644f,0.590566f,0.590489f,0.590411f,0.590334f,0.590257f,0.590179f,0.590102f,0.590024f,0.589947f,0.58987f,0.589792f,0.589715f,0.589637f,0.58956f,0.589483f,0.589405f,0.589328f,0.58925f,0.589173f,0.589095f,0.589018f,0.58894f,0.588863f,0.588785f,0.588708f,0.58863f,0.588553f,0.588475f,0.588398f,0.58832f,0.588243f,0.588165f,0.588088f,0.58801f,0.587933f,0.587855f,0.587777f,0.5877f,0.587622f,0.587545f,0.587467f,0.58739f,0.587312f,0.587234f,0.587157f,0.587079f,0.587002f,0.586924f,0.586846f,0.586769f,0.586691f,0.586613f,0.586536f,0.586458f,0.58638f,0.586303f,0.586225f,0.586147f,0.58607f,0.585992f,0.585914f,0.585837f,0.585759f,0.585681f,0.585603f,0.585526f,0.585448f,0.58537f,0.585293f,0.585215f,0.585137f,0.585059f,0.584982f,0.584904f,0.584826f,0.584748f,0.584671f,0.584593f,0.584515f,0.584437f,0.584359f,0.584282f,0.584204f,0.584126f,0.584048f,0.58397f,0.583893f,0.583815f,0.583737f,0.583659f,0.583581f,0.583503f,0.583425f,0.583348f,0.58327f,0.583192f,0.583114f,0.583036f,0.582958f,0.58288f,0.582802f,0.582724f,0.582647f,0.582568f,0.582491f,0.582413f,0.582335f,0.582257f,0.582179f,0.582101f,0.582023f,0.581945f,0.581867f,0.581789f,0.581711f,0.581633f,0.581555f,0.581477f,0.581399f,0.581321f,0.581243f,0.581165f,0.581087f,0.581009f,0.580931f,0.580853f,0.580775f,0.580697f,0.580619f,0.580541f,0.580463f,0.580385f,0.580307f,0.580228f,0.58015f,0.580072f,0.579994f,0.579916f,0.579838f,0.57976f,0.579682f,0.579604f,0.579526f,0.579447f,0.579369f,0.579291f,0.579213f,0.579135f,0.579057f,0.578978f,0.5789f,0.578822f,0.578744f,0.578666f,0.578587f,0.578509f,0.578431f,0.578353f,0.578275f,0.578197f,0.578118f,0.57804f,0.577962f,0.577883f,0.577805f,0.577727f,0.577649f,0.577571f,0.577492f,0.577414f,0.577336f,0.577257f,0.577179f,0.577101f,0.577023f,0.576944f,0.576866f,0.576787f,0.576709f,0.576631f,0.576553f,0.576474f,0.576396f,0.576318f,0.576239f,0.576161f,0.576082f,0.576004f,0.575926f,0.575847f,0.575769f,0.575691f,0.575612f,0.575534f,0.575455f,0.575377f,0.575299f,0.57522f,0.575142f,0.575063f,0.574985f,0.574906f,0.574828f,0.574749f,0.574671f,0.574593f,0.574514f,0.574436f,0.574357f,0.574279f,0.5742f,0.574122f,0.574043f,0.573965f,0.573886f,0.573808f,0.573729f,0.57365f,0.573572f,0.573493f,0.573415f,0.573336f,0.573258f,0.573179f,0.573101f,0.573022f,0.572944f,0.572865f,0.572786f,0.572708f,0.572629f,0.572551f,0.572472f,0.572393f,0.572315f,0.572236f,0.572158f,0.572079f,0.572f,0.571922f,0.571843f,0.571764f,0.571686f,0.571607f,0.571528f,0.57145f,0.571371f,0.571292f,0.571214f,0.571135f,0.571056f,0.570977f,0.570899f,0.57082f,0.570741f,0.570663f,0.570584f,0.570505f,0.570426f,0.570348f,0.570269f,0.57019f,0.570111f,0.570033f,0.569954f,0.569875f,0.569796f,0.569717f,0.569639f,0.56956f,0.569481f,0.569402f,0.569324f,0.569245f,0.569166f,0.569087f,0.569008f,0.568929f,0.56885f,0.568772f,0.568693f,0.568614f,0.568535f,0.568456f,0.568377f,0.568298f,0.568219f,0.568141f,0.568062f,0.567983f,0.567904f,0.567825f,0.567746f,0.567667f,0.567588f,0.567509f,0.56743f,0.567351f,0.567272f,0.567193f,0.567114f,0.567035f,0.566957f,0.566878f,0.566799f,0.566719f,0.56664f,0.566562f,0.566483f,0.566404f,0.566325f,0.566246f,0.566167f,0.566087f,0.566008f,0.565929f,0.56585f,0.565771f,0.565692f,0.565613f,0.565534f,0.565455f,0.565376f,0.565297f,0.565218f,0.565139f,0.56506f,0.564981f,0.564901f,0.564822f,0.564743f,0.564664f,0.564585f,0.564506f,0.564427f,0.564348f,0.564268f,0.564189f,0.56411f,0.564031f,0.563952f,0.563873f,0.563793f,0.563714f,0.563635f,0.563556f,0.563476f,0.563397f,0.563318f,0.563239f,0.56316f,0.56308f,0.563001f,0.562922f,0.562843f,0.562763f,0.562684f,0.562605f,0.562526f,0.562446f,0.562367f,0.562288f,0.562209f,0.562129f,0.56205f,0.561971f,0.561891f,0.561812f,0.561733f,0.561654f,0.561574f,0.561495f,0.561415f,0.561336f,0.561257f,0.561177f,0.561098f,0.561019f,0.560939f,0.56086f,0.560781f,0.560701f,0.560622f,0.560542f,0.560463f,0.560384f,0.560304f,0.560225f,0.560145f,0.560066f,0.559987f,0.559907f,0.559828f,0.559748f,0.559669f,0.559589f,0.55951f,0.55943f,0.559351f,0.559271f,0.559192f,0.559113f,0.559033f,0.558953f,0.558874f,0.558794f,0.558715f,0.558635f,0.558556f,0.558477f,0.558397f,0.558317f,0.558238f,0.558158f,0.558079f,0.557999f,0.55792f,0.55784f,0.55776f,0.557681f,0.557601f,0.557522f,0.557442f,0.557362f,0.557283f,0.557203f,0.557124f,0.557044f,0.556964f,0.556885f,0.556805f,0.556726f,0.556646f,0.556566f,0.556486f,0.556407f,0.556327f,0.556248f,0.556168f,0.556088f,0.556009f,0.555929f,0.555849f,0.555769f,0.55569f,0.55561f,0.55553f,0.555451f,0.555371f,0.555291f,0.555211f,0.555132f,0.555052f,0.554972f,0.554892f,0.554813f,0.554733f,0.554653f,0.554573f,0.554493f,0.554414f,0.554334f,0.554254f,0.554174f,0.554095f,0.554015f,0.553935f,0.553855f,0.553775f,0.553695f,0.553616f,0.553536f,0.553456f,0.553376f,0.553296f,0.553216f,0.553136f,0.553057f,0.552977f,0.552897f,0.552817f,0.552737f,0.552657f,0.552577f,0.552497f,0.552417f,0.552337f,0.552258f,0.552178f,0.552098f,0.552018f,0.551938f,0.551858f,0.551778f,0.551698f,0.551618f,0.551538f,0.551458f,0.551378f,0.551298f,0.551218f,0.551138f,0.551058f,0.550978f,0.550898f,0.550818f,0.550738f,0.550658f,0.550578f,0.550498f,0.550418f,0.550338f,0.550258f,0.550178f,0.550098f,0.550018f,0.549937f,0.549857f,0.549777f,0.549697f,0.549617f,0.549537f,0.549457f,0.549377f,0.549297f,0.549217f,0.549137f,0.549056f,0.548976f,0.548896f,0.548816f,0.548736f,0.548656f,0.548576f,0.548495f,0.548415f,0.548335f,0.548255f,0.548175f,0.548094f,0.548014f,0.547934f,0.547854f,0.547774f,0.547693f,0.547613f,0.547533f,0.547453f,0.547373f,0.547292f,0.547212f,0.547132f,0.547052f,0.546971f,0.546891f,0.546811f,0.54673f,0.54665f,0.54657f,0.54649f,0.546409f,0.546329f,0.546249f,0.546169f,0.546088f,0.546008f,0.545927f,0.545847f,0.545767f,0.545687f,0.545606f,0.545526f,0.545445f,0.545365f,0.545285f,0.545204f,0.545124f,0.545044f,0.544963f,0.544883f,0.544802f,0.544722f,0.544642f,0.544561f,0.544481f,0.5444f,0.54432f,0.54424f,0.544159f,0.544079f,0.543998f,0.543918f,0.543837f,0.543757f,0.543676f,0.543596f,0.543515f,0.543435f,0.543354f,0.543274f,0.543194f,0.543113f,0.543033f,0.542952f,0.542871f,0.542791f,0.54271f,0.54263f,0.542549f,0.542469f,0.542388f,0.542308f,0.542227f,0.542147f,0.542066f,0.541986f,0.541905f,0.541824f,0.541744f,0.541663f,0.541583f,0.541502f,0.541421f,0.541341f,0.54126f,0.54118f,0.541099f,0.541018f,0.540938f,0.540857f,0.540776f,0.540696f,0.540615f,0.540534f,0.540454f,0.540373f,0.540292f,0.540212f,0.540131f,0.54005f,0.53997f,0.539889f,0.539808f,0.539728f,0.539647f,0.539566f,0.539485f,0.539405f,0.539324f,0.539243f,0.539163f,0.539082f,0.539001f,0.53892f,0.538839f,0.538759f,0.538678f,0.538597f,0.538516f,0.538436f,0.538355f,0.538274f,0.538193f,0.538112f,0.538032f,0.537951f,0.53787f,0.537789f,0.537708f,0.537627f,0.537547f,0.537466f,0.537385f,0.537304f,0.537223f,0.537142f,0.537062f,0.536981f,0.5369f,0.536819f,0.536738f,0.536657f,0.536576f,0.536495f,0.536414f,0.536333f,0.536252f,0.536171f,0.536091f,0.53601f,0.535929f,0.535848f,0.535767f,0.535686f,0.535605f,0.535524f,0.535443f,0.535362f,0.535281f,0.5352f,0.535119f,0.535038f,0.534957f,0.534876f,0.534795f,0.534714f,0.534633f,0.534552f,0.534471f,0.53439f,0.534309f,0.534228f,0.534147f,0.534066f,0.533985f,0.533904f,0.533823f,0.533741f,0.53366f,0.533579f,0.533498f,0.533417f,0.533336f,0.533255f,0.533174f,0.533093f,0.533012f,0.53293f,0.532849f,0.532768f,0.532687f,0.532606f,0.532525f,0.532444f,0.532362f,0.532281f,0.5322f,0.532119f,0.532038f,0.531957f,0.531876f,0.531794f,0.531713f,0.531632f,0.531551f,0.531469f,0.531388f,0.531307f,0.531226f,0.531144f,0.531063f,0.530982f,0.530901f,0.53082f,0.530738f,0.530657f,0.530576f,0.530494f,0.530413f,0.530332f,0.530251f,0.530169f,0.530088f,0.530007f,0.529926f,0.529844f,0.529763f,0.529682f,0.5296f,0.529519f,0.529438f,0.529356f,0.529275f,0.529193f,0.529112f,0.529031f,0.528949f,0.528868f,0.528787f,0.528705f,0.528624f,0.528543f,0.528461f,0.52838f,0.528298f,0.528217f,0.528136f,0.528054f,0.527973f,0.527891f,0.52781f,0.527728f,0.527647f,0.527566f,0.527484f,0.527403f,0.527321f,0.52724f,0.527158f,0.527077f,0.526995f,0.526914f,0.526832f,0.526751f,0.52667f,0.526588f,0.526506f,0.526425f,0.526343f,0.526262f,0.52618f,0.526099f,0.526017f,0.525936f,0.525854f,0.525773f,0.525691f,0.525609f,0.525528f,0.525446f,0.525365f,0.525283f,0.525202f,0.52512f,0.525038f,0.524957f,0.524875f,0.524794f,0.524712f,0.524631f,0.524549f,0.524467f,0.524386f,0.524304f,0.524222f,0.524141f,0.524059f,0.523977f,0.523896f,0.523814f,0.523732f,0.523651f,0.523569f,0.523487f,0.523406f,0.523324f,0.523242f,0.52316f,0.523079f,0.522997f,0.522915f,0.522834f,0.522752f,0.52267f,0.522588f,0.522507f,0.522425f,0.522343f,0.522261f,0.52218f,0.522098f,0.522016f,0.521934f,0.521852f,0.521771f,0.521689f,0.521607f,0.521525f,0.521444f,0.521362f,0.52128f,0.521198f,0.521116f,0.521034f,0.520953f,0.520871f,0.520789f,0.520707f,0.520625f,0.520543f,0.520461f,0.52038f,0.520298f,0.520216f,0.520134f,0.520052f,0.51997f,0.519888f,0.519806f,0.519725f,0.519643f,0.519561f,0.519479f,0.519397f,0.519315f,0.519233f,0.519151f,0.519069f,0.518987f,0.518905f,0.518823f,0.518741f,0.518659f,0.518577f,0.518495f,0.518413f,0.518331f,0.518249f,0.518167f,0.518086f,0.518004f,0.517921f,0.517839f,0.517757f,0.517675f,0.517593f,0.517511f,0.517429f,0.517347f,0.517265f,0.517183f,0.517101f,0.517019f,0.516937f,0.516855f,0.516773f,0.516691f,0.516609f,0.516526f,0.516444f,0.516362f,0.51628f,0.516198f,0.516116f,0.516034f,0.515952f,0.51587f,0.515787f,0.515705f,0.515623f,0.515541f,0.515459f,0.515377f,0.515294f,0.515212f,0.51513f,0.515048f,0.514966f,0.514884f,0.514802f,0.514719f,0.514637f,0.514555f,0.514473f,0.51439f,0.514308f,0.514226f,0.514144f,0.514062f,0.513979f,0.513897f,0.513815f,0.513733f,0.51365f,0.513568f,0.513486f,0.513404f,0.513321f,0.513239f,0.513157f,0.513074f,0.512992f,0.51291f,0.512828f,0.512745f,0.512663f,0.51258f,0.512498f,0.512416f,0.512334f,0.512251f,0.512169f,0.512087f,0.512004f,0.511922f,0.511839f,0.511757f,0.511675f,0.511592f,0.51151f,0.511428f,0.511345f,0.511263f,0.51118f,0.511098f,0.511016f,0.510933f,0.510851f,0.510768f,0.510686f,0.510603f,0.510521f,0.510439f,0.510356f,0.510274f,0.510191f,0.510109f,0.510026f,0.509944f,0.509861f,0.509779f,0.509696f,0.509614f,0.509531f,0.509449f,0.509367f,0.509284f,0.509201f,0.509119f,0.509036f,0.508954f,0.508871f,0.508789f,0.508706f,0.508624f,0.508541f,0.508459f,0.508376f,0.508294f,0.508211f,0.508128f,0.508046f,0.507963f,0.507881f,0.507798f,0.507715f,0.507633f,0.50755f,0.507468f,0.507385f,0.507302f,0.50722f,0.507137f,0.507055f,0.506972f,0.506889f,0.506807f,0.506724f,0.506641f,0.506559f,0.506476f,0.506393f,0.506311f,0.506228f,0.506145f,0.506063f,0.50598f,0.505897f,0.505814f,0.505732f,0.505649f,0.505566f,0.505484f,0.505401f,0.505318f,0.505235f,0.505153f,0.50507f,0.504987f,0.504904f,0.504822f,0.504739f,0.504656f,0.504573f,0.504491f,0.504408f,0.504325f,0.504242f,0.50416f,0.504077f,0.503994f,0.503911f,0.503828f,0.503745f,0.503663f,0.50358f,0.503497f,0.503414f,0.503331f,0.503248f,0.503165f,0.503083f,0.503f,0.502917f,0.502834f,0.502751f,0.502668f,0.502585f,0.502503f,0.50242f,0.502337f,0.502254f,0.502171f,0.502088f,0.502005f,0.501922f,0.501839f,0.501756f,0.501673f,0.50159f,0.501508f,0.501425f,0.501342f,0.501259f,0.501176f,0.501093f,0.50101f,0.500927f,0.500844f,0.500761f,0.500678f,0.500595f,0.500512f,0.500429f,0.500346f,0.500263f,0.50018f,0.500097f,0.500014f,0.499931f,0.499848f,0.499765f,0.499682f,0.499599f,0.499516f,0.499433f,0.49935f,0.499266f,0.499183f,0.4991f,0.499017f,0.498934f,0.498851f,0.498768f,0.498685f,0.498602f,0.498518f,0.498435f,0.498352f,0.498269f,0.498186f,0.498103f,0.49802f,0.497937f,0.497853f,0.49777f,0.497687f,0.497604f,0.497521f,0.497438f,0.497355f,0.497271f,0.497188f,0.497105f,0.497022f,0.496939f,0.496855f,0.496772f,0.496689f,0.496606f,0.496522f,0.496439f,0.496356f,0.496273f,0.49619f,0.496106f,0.496023f,0.49594f,0.495857f,0.495773f,0.49569f,0.495607f,0.495524f,0.49544f,0.495357f,0.495274f,0.49519f,0.495107f,0.495024f,0.494941f,0.494857f,0.494774f,0.494691f,0.494607f,0.494524f,0.494441f,0.494357f,0.494274f,0.494191f,0.494107f,0.494024f,0.49394f,0.493857f,0.493774f,0.49369f,0.493607f,0.493524f,0.49344f,0.493357f,0.493273f,0.49319f,0.493107f,0.493023f,0.49294f,0.492856f,0.492773f,0.49269f,0.492606f,0.492523f,0.492439f,0.492356f,0.492272f,0.492189f,0.492106f,0.492022f,0.491939f,0.491855f,0.491772f,0.491688f,0.491605f,0.491521f,0.491438f,0.491354f,0.491271f,0.491187f,0.491104f,0.49102f,0.490937f,0.490853f,0.49077f,0.490686f,0.490602f,0.490519f,0.490435f,0.490352f,0.490268f,0.490185f,0.490101f,0.490018f,0.489934f,0.48985f,0.489767f,0.489683f,0.4896f,0.489516f,0.489432f,0.489349f,0.489265f,0.489181f,0.489098f,0.489014f,0.488931f,0.488847f,0.488763f,0.48868f,0.488596f,0.488512f,0.488429f,0.488345f,0.488261f,0.488178f,0.488094f,0.48801f,0.487927f,0.487843f,0.487759f,0.487676f,0.487592f,0.487508f,0.487425f,0.487341f,0.487257f,0.487173f,0.48709f,0.487006f,0.486922f,0.486838f,0.486755f,0.486671f,0.486587f,0.486503f,0.48642f,0.486336f,0.486252f,0.486168f,0.486085f,0.486001f,0.485917f,0.485833f,0.485749f,0.485666f,0.485582f,0.485498f,0.485414f,0.48533f,0.485247f,0.485163f,0.485079f,0.484995f,0.484911f,0.484827f,0.484743f,0.48466f,0.484576f,0.484492f,0.484408f,0.484324f,0.48424f,0.484156f,0.484072f,0.483989f,0.483905f,0.483821f,0.483737f,0.483653f,0.483569f,0.483485f,0.483401f,0.483317f,0.483233f,0.483149f,0.483065f,0.482981f,0.482897f,0.482814f,0.48273f,0.482646f,0.482562f,0.482478f,0.482394f,0.48231f,0.482226f,0.482142f,0.482058f,0.481974f,0.48189f,0.481806f,0.481722f,0.481638f,0.481554f,0.48147f,0.481386f,0.481302f,0.481218f,0.481134f,0.481049f,0.480965f,0.480881f,0.480797f,0.480713f,0.480629f,0.480545f,0.480461f,0.480377f,0.480293f,0.480209f,0.480125f,0.48004f,0.479956f,0.479872f,0.479788f,0.479704f,0.47962f,0.479536f,0.479452f,0.479367f,0.479283f,0.479199f,0.479115f,0.479031f,0.478947f,0.478863f,0.478778f,0.478694f,0.47861f,0.478526f,0.478442f,0.478357f,0.478273f,0.478189f,0.478105f,0.478021f,0.477937f,0.477852f,0.477768f,0.477684f,0.4776f,0.477515f,0.477431f,0.477347f,0.477263f,0.477178f,0.477094f,0.47701f,0.476925f,0.476841f,0.476757f,0.476673f,0.476588f,0.476504f,0.47642f,0.476335f,0.476251f,0.476167f,0.476083f,0.475998f,0.475914f,0.47583f,0.475745f,0.475661f,0.475577f,0.475492f,0.475408f,0.475324f,0.475239f,0.475155f,0.475071f,0.474986f,0.474902f,0.474817f,0.474733f,0.474649f,0.474564f,0.47448f,0.474396f,0.474311f,0.474227f,0.474142f,0.474058f,0.473974f,0.473889f,0.473805f,0.47372f,0.473636f,0.473551f,0.473467f,0.473382f,0.473298f,0.473214f,0.473129f,0.473045f,0.47296f,0.472876f,0.472791f,0.472707f,0.472622f,0.472538f,0.472453f,0.472369f,0.472284f,0.4722f,0.472115f,0.472031f,0.471946f,0.471862f,0.471777f,0.471693f,0.471608f,0.471523f,0.471439f,0.471354f,0.47127f,0.471185f,0.471101f,0.471016f,0.470932f,0.470847f,0.470762f,0.470678f,0.470593f,0.470509f,0.470424f,0.470339f,0.470255f,0.47017f,0.470086f,0.470001f,0.469916f,0.469832f,0.469747f,0.469662f,0.469578f,0.469493f,0.469408f,0.469324f,0.469239f,0.469155f,0.46907f,0.468985f,0.468901f,0.468816f,0.468731f,0.468646f,0.468562f,0.468477f,0.468392f,0.468308f,0.468223f,0.468138f,0.468053f,0.467969f,0.467884f,0.467799f,0.467715f,0.46763f,0.467545f,0.46746f,0.467375f,0.467291f,0.467206f,0.467121f,0.467036f,0.466952f,0.466867f,0.466782f,0.466697f,0.466612f,0.466528f,0.466443f,0.466358f,0.466273f,0.466189f,0.466104f,0.466019f,0.465934f,0.465849f,0.465764f,0.46568f,0.465595f,0.46551f,0.465425f,0.46534f,0.465255f,0.46517f,0.465086f,0.465001f,0.464916f,0.464831f,0.464746f,0.464661f,0.464576f,0.464491f,0.464406f,0.464321f,0.464237f,0.464152f,0.464067f,0.463982f,0.463897f,0.463812f,0.463727f,0.463642f,0.463557f,0.463472f,0.463387f,0.463302f,0.463217f,0.463132f,0.463047f,0.462962f,0.462877f,0.462792f,0.462707f,0.462622f,0.462537f,0.462452f,0.462367f,0.462282f,0.462197f,0.462112f,0.462027f,0.461942f,0.461857f,0.461772f,0.461687f,0.461602f,0.461517f,0.461432f,0.461347f,0.461262f,0.461177f,0.461092f,0.461007f,0.460922f,0.460837f,0.460751f,0.460666f,0.460581f,0.460496f,0.460411f,0.460326f,0.460241f,0.460156f,0.460071f,0.459985f,0.4599f,0.459815f,0.45973f,0.459645f,0.45956f,0.459475f,0.459389f,0.459304f,0.459219f,0.459134f,0.459049f,0.458964f,0.458878f,0.458793f,0.458708f,0.458623f,0.458537f,0.458452f,0.458367f,0.458282f,0.458197f,0.458112f,0.458026f,0.457941f,0.457856f,0.457771f,0.457685f,0.4576f,0.457515f,0.45743f,0.457344f,0.457259f,0.457174f,0.457089f,0.457003f,0.456918f,0.456833f,0.456747f,0.456662f,0.456577f,0.456491f,0.456406f,0.456321f,0.456236f,0.45615f,0.456065f,0.45598f,0.455894f,0.455809f,0.455724f,0.455638f,0.455553f,0.455468f,0.455382f,0.455297f,0.455212f,0.455126f,0.455041f,0.454955f,0.45487f,0.454785f,0.454699f,0.454614f,0.454529f,0.454443f,0.454358f,0.454272f,0.454187f,0.454101f,0.454016f,0.453931f,0.453845f,0.45376f,0.453674f,0.453589f,0.453503f,0.453418f,0.453333f,0.453247f,0.453162f,0.453076f,0.452991f,0.452905f,0.45282f,0.452734f,0.452649f,0.452563f,0.452478f,0.452392f,0.452307f,0.452221f,0.452136f,0.45205f,0.451965f,0.451879f,0.451794f,0.451708f,0.451622f,0.451537f,0.451451f,0.451366f,0.45128f,0.451195f,0.451109f,0.451024f,0.450938f,0.450852f,0.450767f,0.450681f,0.450596f,0.45051f,0.450425f,0.450339f,0.450253f,0.450168f,0.450082f,0.449997f,0.449911f,0.449825f,0.44974f,0.449654f,0.449568f,0.449483f,0.449397f,0.449311f,0.449226f,0.44914f,0.449055f,0.448969f,0.448883f,0.448797f,0.448712f,0.448626f,0.44854f,0.448455f,0.448369f,0.448283f,0.448198f,0.448112f,0.448026f,0.447941f,0.447855f,0.447769f,0.447683f,0.447598f,0.447512f,0.447426f,0.44734f,0.447255f,0.447169f,0.447083f,0.446997f,0.446912f,0.446826f,0.44674f,0.446654f,0.446569f,0.446483f,0.446397f,0.446311f,0.446225f,0.446139f,0.446054f,0.445968f,0.445882f,0.445796f,0.445711f,0.445625f,0.445539f,0.445453f,0.445367f,0.445281f,0.445195f,0.44511f,0.445024f,0.444938f,0.444852f,0.444766f,0.44468f,0.444594f,0.444509f,0.444423f,0.444337f,0.444251f,0.444165f,0.444079f,0.443993f,0.443907f,0.443821f,0.443735f,0.44365f,0.443564f,0.443478f,0.443392f,0.443306f,0.44322f,0.443134f,0.443048f,0.442962f,0.442876f,0.44279f,0.442704f,0.442618f,0.442532f,0.442446f,0.44236f,0.442274f,0.442188f,0.442102f,0.442016f,0.44193f,0.441844f,0.441758f,0.441672f,0.441586f,0.4415f,0.441414f,0.441328f,0.441242f,0.441156f,0.44107f,0.440984f,0.440898f,0.440812f,0.440726f,0.44064f,0.440554f,0.440468f,0.440382f,0.440295f,0.440209f,0.440123f,0.440037f,0.439951f,0.439865f,0.439779f,0.439693f,0.439607f,0.439521f,0.439435f,0.439348f,0.439262f,0.439176f,0.43909f,0.439004f,0.438918f,0.438832f,0.438745f,0.438659f,0.438573f,0.438487f,0.438401f,0.438315f,0.438228f,0.438142f,0.438056f,0.43797f,0.437884f,0.437797f,0.437711f,0.437625f,0.437539f,0.437453f,0.437366f,0.43728f,0.437194f,0.437108f,0.437021f,0.436935f,0.436849f,0.436763f,0.436677f,0.43659f,0.436504f,0.436418f,0.436331f,0.436245f,0.436159f,0.436073f,0.435986f,0.4359f,0.435814f,0.435728f,0.435641f,0.435555f,0.435469f,0.435382f,0.435296f,0.43521f,0.435124f,0.435037f,0.434951f,0.434864f,0.434778f,0.434692f,0.434605f,0.434519f,0.434433f,0.434346f,0.43426f,0.434174f,0.434087f,0.434001f,0.433915f,0.433828f,0.433742f,0.433655f,0.433569f,0.433483f,0.433396f,0.43331f,0.433223f,0.433137f,0.433051f,0.432964f,0.432878f,0.432791f,0.432705f,0.432618f,0.432532f,0.432446f,0.432359f,0.432273f,0.432186f,0.4321f,0.432013f,0.431927f,0.43184f,0.431754f,0.431667f,0.431581f,0.431494f,0.431408f,0.431321f,0.431235f,0.431148f,0.431062f,0.430975f,0.430889f,0.430802f,0.430716f,0.430629f,0.430543f,0.430456f,0.43037f,0.430283f,0.430197f,0.43011f,0.430023f,0.429937f,0.42985f,0.429764f,0.429677f,0.429591f,0.429504f,0.429417f,0.429331f,0.429244f,0.429158f,0.429071f,0.428985f,0.428898f,0.428811f,0.428725f,0.428638f,0.428551f,0.428465f,0.428378f,0.428292f,0.428205f,0.428118f,0.428032f,0.427945f,0.427858f,0.427772f,0.427685f,0.427598f,0.427512f,0.427425f,0.427338f,0.427252f,0.427165f,0.427078f,0.426992f,0.426905f,0.426818f,0.426732f,0.426645f,0.426558f,0.426471f,0.426385f,0.426298f,0.426211f,0.426125f,0.426038f,0.425951f,0.425864f,0.425777f,0.425691f,0.425604f,0.425517f,0.425431f,0.425344f,0.425257f,0.42517f,0.425083f,0.424997f,0.42491f,0.424823f,0.424736f,0.42465f,0.424563f,0.424476f,0.424389f,0.424302f,0.424215f,0.424129f,0.424042f,0.423955f,0.423868f,0.423781f,0.423694f,0.423607f,0.423521f,0.423434f,0.423347f,0.42326f,0.423173f,0.423086f,0.422999f,0.422913f,0.422826f,0.422739f,0.422652f,0.422565f,0.422478f,0.422391f,0.422304f,0.422217f,0.422131f,0.422044f,0.421957f,0.42187f,0.421783f,0.421696f,0.421609f,0.421522f,0.421435f,0.421348f,0.421261f,0.421174f,0.421087f,0.421f,0.420913f,0.420826f,0.420739f,0.420653f,0.420566f,0.420479f,0.420392f,0.420304f,0.420217f,0.420131f,0.420044f,0.419957f,0.41987f,0.419783f,0.419696f,0.419608f,0.419521f,0.419434f,0.419347f,0.41926f,0.419173f,0.419086f,0.418999f,0.418912f,0.418825f,0.418738f,0.418651f,0.418564f,0.418477f,0.41839f,0.418303f,0.418215f,0.418128f,0.418041f,0.417954f,0.417867f,0.41778f,0.417693f,0.417606f,0.417519f,0.417432f,0.417344f,0.417257f,0.41717f,0.417083f,0.416996f,0.416909f,0.416822f,0.416734f,0.416647f,0.41656f,0.416473f,0.416386f,0.416299f,0.416212f,0.416124f,0.416037f,0.41595f,0.415863f,0.415776f,0.415688f,0.415601f,0.415514f,0.415427f,0.41534f,0.415252f,0.415165f,0.415078f,0.414991f,0.414904f,0.414816f,0.414729f,0.414642f,0.414555f,0.414467f,0.41438f,0.414293f,0.414206f,0.414118f,0.414031f,0.413944f,0.413856f,0.413769f,0.413682f,0.413595f,0.413507f,0.41342f,0.413333f,0.413245f,0.413158f,0.413071f,0.412983f,0.412896f,0.412809f,0.412722f,0.412634f,0.412547f,0.412459f,0.412372f,0.412285f,0.412198f,0.41211f,0.412023f,0.411936f,0.411848f,0.411761f,0.411673f,0.411586f,0.411499f,0.411411f,0.411324f,0.411236f,0.411149f,0.411062f,0.410974f,0.410887f,0.410799f,0.410712f,0.410625f,0.410537f,0.41045f,0.410362f,0.410275f,0.410187f,0.4101f,0.410013f,0.409925f,0.409838f,0.40975f,0.409663f,0.409575f,0.409488f,0.4094f,0.409313f,0.409225f,0.409138f,0.40905f,0.408963f,0.408875f,0.408788f,0.4087f,0.408613f,0.408525f,0.408438f,0.40835f,0.408263f,0.408175f,0.408088f,0.408f,0.407913f,0.407825f,0.407738f,0.40765f,0.407563f,0.407475f,0.407387f,0.4073f,0.407212f,0.407125f,0.407037f,0.40695f,0.406862f,0.406774f,0.406687f,0.406599f,0.406512f,0.406424f,0.406337f,0.406249f,0.406161f,0.406074f,0.405986f,0.405899f,0.405811f,0.405723f,0.405636f,0.405548f,0.40546f,0.405373f,0.405285f,0.405197f,0.40511f,0.405022f,0.404935f,0.404847f,0.404759f,0.404671f,0.404584f,0.404496f,0.404408f,0.404321f,0.404233f,0.404145f,0.404058f,0.40397f,0.403882f,0.403795f,0.403707f,0.403619f,0.403531f,0.403444f,0.403356f,0.403268f,0.40318f,0.403093f,0.403005f,0.402917f,0.40283f,0.402742f,0.402654f,0.402566f,0.402478f,0.402391f,0.402303f,0.402215f,0.402127f,0.40204f,0.401952f,0.401864f,0.401776f,0.401688f,0.401601f,0.401513f,0.401425f,0.401337f,0.401249f,0.401161f,0.401074f,0.400986f,0.400898f,0.40081f,0.400722f,0.400635f,0.400547f,0.400459f,0.400371f,0.400283f,0.400195f,0.400107f,0.40002f,0.399932f,0.399844f,0.399756f,0.399668f,0.39958f,0.399492f,0.399404f,0.399317f,0.399229f,0.399141f,0.399053f,0.398965f,0.398877f,0.398789f,0.398701f,0.398613f,0.398525f,0.398437f,0.398349f,0.398261f,0.398173f,0.398086f,0.397998f,0.39791f,0.397822f,0.397734f,0.397646f,0.397558f,0.39747f,0.397382f,0.397294f,0.397206f,0.397118f,0.39703f,0.396942f,0.396854f,0.396766f,0.396678f,0.39659f,0.396502f,0.396414f,0.396326f,0.396238f,0.39615f,0.396062f,0.395974f,0.395886f,0.395798f,0.39571f,0.395622f,0.395533f,0.395445f,0.395357f,0.395269f,0.395181f,0.395093f,0.395005f,0.394917f,0.394829f,0.394741f,0.394653f,0.394565f,0.394477f,0.394389f,0.3943f,0.394212f,0.394124f,0.394036f,0.393948f,0.39386f,0.393772f,0.393684f,0.393595f,0.393507f,0.393419f,0.393331f,0.393243f,0.393155f,0.393067f,0.392978f,0.39289f,0.392802f,0.392714f,0.392626f,0.392537f,0.392449f,0.392361f,0.392273f,0.392185f,0.392097f,0.392008f,0.39192f,0.391832f,0.391744f,0.391656f,0.391567f,0.391479f,0.391391f,0.391303f,0.391214f,0.391126f,0.391038f,0.39095f,0.390862f,0.390773f,0.390685f,0.390597f,0.390508f,0.39042f,0.390332f,0.390244f,0.390155f,0.390067f,0.389979f,0.38989f,0.389802f,0.389714f,0.389626f,0.389537f,0.389449f,0.389361f,0.389273f,0.389184f,0.389096f,0.389007f,0.388919f,0.388831f,0.388743f,0.388654f,0.388566f,0.388477f,0.388389f,0.388301f,0.388212f,0.388124f,0.388036f,0.387947f,0.387859f,0.387771f,0.387682f,0.387594f,0.387505f,0.387417f,0.387329f,0.38724f,0.387152f,0.387064f,0.386975f,0.386887f,0.386798f,0.38671f,0.386622f,0.386533f,0.386445f,0.386356f,0.386268f,0.386179f,0.386091f,0.386002f,0.385914f,0.385826f,0.385737f,0.385649f,0.38556f,0.385472f,0.385383f,0.385295f,0.385206f,0.385118f,0.385029f,0.384941f,0.384852f,0.384764f,0.384675f,0.384587f,0.384498f,0.38441f,0.384321f,0.384233f,0.384144f,0.384056f,0.383967f,0.383879f,0.38379f,0.383702f,0.383613f,0.383525f,0.383436f,0.383348f,0.383259f,0.38317f,0.383082f,0.382993f,0.382905f,0.382816f,0.382728f,0.382639f,0.38255f,0.382462f,0.382373f,0.382285f,0.382196f,0.382108f,0.382019f,0.38193f,0.381842f,0.381753f,0.381665f,0.381576f,0.381487f,0.381399f,0.38131f,0.381221f,0.381133f,0.381044f,0.380955f,0.380867f,0.380778f,0.38069f,0.380601f,0.380512f,0.380423f,0.380335f,0.380246f,0.380158f,0.380069f,0.37998f,0.379891f,0.379803f,0.379714f,0.379625f,0.379537f,0.379448f,0.379359f,0.379271f,0.379182f,0.379093f,0.379004f,0.378916f,0.378827f,0.378738f,0.37865f,0.378561f,0.378472f,0.378383f,0.378294f,0.378206f,0.378117f,0.378028f,0.37794f,0.377851f,0.377762f,0.377673f,0.377584f,0.377496f,0.377407f,0.377318f,0.377229f,0.377141f,0.377052f,0.376963f,0.376874f,0.376785f,0.376697f,0.376608f,0.376519f,0.37643f,0.376341f,0.376252f,0.376164f,0.376075f,0.375986f,0.375897f,0.375808f,0.375719f,0.375631f,0.375542f,0.375453f,0.375364f,0.375275f,0.375186f,0.375097f,0.375009f,0.37492f,0.374831f,0.374742f,0.374653f,0.374564f,0.374475f,0.374386f,0.374297f,0.374209f,0.374119f,0.374031f,0.373942f,0.373853f,0.373764f,0.373675f,0.373586f,0.373497f,0.373408f,0.373319f,0.37323f,0.373141f,0.373052f,0.372963f,0.372874f,0.372786f,0.372696f,0.372607f,0.372519f,0.37243f,0.372341f,0.372252f,0.372163f,0.372074f,0.371985f,0.371896f,0.371807f,0.371718f,0.371629f,0.37154f,0.371451f,0.371362f,0.371273f,0.371184f,0.371095f,0.371006f,0.370917f,0.370827f,0.370738f,0.370649f,0.37056f,0.370471f,0.370382f,0.370293f,0.370204f,0.370115f,0.370026f,0.369937f,0.369848f,0.369759f,0.36967f,0.369581f,0.369492f,0.369402f,0.369313f,0.369224f,0.369135f,0.369046f,0.368957f,0.368868f,0.368779f,0.36869f,0.368601f,0.368511f,0.368422f,0.368333f,0.368244f,0.368155f,0.368066f,0.367977f,0.367887f,0.367798f,0.367709f,0.36762f,0.367531f,0.367442f,0.367352f,0.367263f,0.367174f,0.367085f,0.366996f,0.366906f,0.366817f,0.366728f,0.366639f,0.36655f,0.366461f,0.366371f,0.366282f,0.366193f,0.366104f,0.366014f,0.365925f,0.365836f,0.365747f,0.365658f,0.365568f,0.365479f,0.36539f,0.365301f,0.365211f,0.365122f,0.365033f,0.364944f,0.364854f,0.364765f,0.364676f,0.364586f,0.364497f,0.364408f,0.364319f,0.364229f,0.36414f,0.364051f,0.363961f,0.363872f,0.363783f,0.363694f,0.363604f,0.363515f,0.363426f,0.363336f,0.363247f,0.363158f,0.363068f,0.362979f,0.36289f,0.3628f,0.362711f,0.362622f,0.362532f,0.362443f,0.362354f,0.362264f,0.362175f,0.362086f,0.361996f,0.361907f,0.361817f,0.361728f,0.361639f,0.361549f,0.36146f,0.361371f,0.361281f,0.361192f,0.361102f,0.361013f,0.360923f,0.360834f,0.360745f,0.360655f,0.360566f,0.360476f,0.360387f,0.360297f,0.360208f,0.360119f,0.360029f,0.35994f,0.35985f,0.359761f,0.359671f,0.359582f,0.359492f,0.359403f,0.359314f,0.359224f,0.359135f,0.359045f,0.358955f,0.358866f,0.358777f,0.358687f,0.358598f,0.358508f,0.358419f,0.358329f,0.35824f,0.35815f,0.358061f,0.357971f,0.357882f,0.357792f,0.357703f,0.357613f,0.357523f,0.357434f,0.357344f,0.357255f,0.357165f,0.357076f,0.356986f,0.356897f,0.356807f,0.356717f,0.356628f,0.356538f,0.356449f,0.356359f,0.35627f,0.35618f,0.35609f,0.356001f,0.355911f,0.355822f,0.355732f,0.355642f,0.355553f,0.355463f,0.355373f,0.355284f,0.355194f,0.355105f,0.355015f,0.354925f,0.354836f,0.354746f,0.354656f,0.354567f,0.354477f,0.354388f,0.354298f,0.354208f,0.354119f,0.354029f,0.353939f,0.35385f,0.35376f,0.35367f,0.353581f,0.353491f,0.353401f,0.353312f,0.353222f,0.353132f,0.353042f,0.352953f,0.352863f,0.352773f,0.352684f,0.352594f,0.352504f,0.352414f,0.352325f,0.352235f,0.352145f,0.352056f,0.351966f,0.351876f,0.351786f,0.351697f,0.351607f,0.351517f,0.351427f,0.351338f,0.351248f,0.351158f,0.351068f,0.350978f,0.350889f,0.350799f,0.350709f,0.350619f,0.35053f,0.35044f,0.35035f,0.35026f,0.35017f,0.350081f,0.349991f,0.349901f,0.349811f,0.349721f,0.349631f,0.349542f,0.349452f,0.349362f,0.349272f,0.349182f,0.349093f,0.349003f,0.348913f,0.348823f,0.348733f,0.348643f,0.348553f,0.348464f,0.348374f,0.348284f,0.348194f,0.348104f,0.348014f,0.347924f,0.347834f,0.347745f,0.347655f,0.347565f,0.347475f,0.347385f,0.347295f,0.347205f,0.347115f,0.347025f,0.346935f,0.346846f,0.346756f,0.346666f,0.346576f,0.346486f,0.346396f,0.346306f,0.346216f,0.346126f,0.346036f,0.345946f,0.345856f,0.345766f,0.345676f,0.345586f,0.345496f,0.345406f,0.345316f,0.345226f,0.345136f,0.345046f,0.344956f,0.344866f,0.344776f,0.344686f,0.344597f,0.344506f,0.344416f,0.344326f,0.344236f,0.344146f,0.344056f,0.343966f,0.343876f,0.343786f,0.343696f,0.343606f,0.343516f,0.343426f,0.343336f,0.343246f,0.343156f,0.343066f,0.342976f,0.342886f,0.342796f,0.342706f,0.342616f,0.342526f,0.342436f,0.342345f,0.342255f,0.342165f,0.342075f,0.341985f,0.341895f,0.341805f,0.341715f,0.341625f,0.341534f,0.341444f,0.341354f,0.341264f,0.341174f,0.341084f,0.340994f,0.340904f,0.340813f,0.340723f,0.340633f,0.340543f,0.340453f,0.340363f,0.340273f,0.340182f,0.340092f,0.340002f,0.339912f,0.339822f,0.339732f,0.339642f,0.339551f,0.339461f,0.339371f,0.339281f,0.339191f,0.3391f,0.33901f,0.33892f,0.33883f,0.33874f,0.338649f,0.338559f,0.338469f,0.338379f,0.338289f,0.338198f,0.338108f,0.338018f,0.337928f,0.337837f,0.337747f,0.337657f,0.337567f,0.337477f,0.337386f,0.337296f,0.337206f,0.337115f,0.337025f,0.336935f,0.336845f,0.336754f,0.336664f,0.336574f,0.336483f,0.336393f,0.336303f,0.336213f,0.336122f,0.336032f,0.335942f,0.335852f,0.335761f,0.335671f,0.335581f,0.33549f,0.3354f,0.33531f,0.335219f,0.335129f,0.335039f,0.334948f,0.334858f,0.334768f,0.334677f,0.334587f,0.334497f,0.334406f,0.334316f,0.334225f,0.334135f,0.334045f,0.333954f,0.333864f,0.333774f,0.333683f,0.333593f,0.333502f,0.333412f,0.333322f,0.333231f,0.333141f,0.333051f,0.33296f,0.33287f,0.332779f,0.332689f,0.332598f,0.332508f,0.332418f,0.332327f,0.332237f,0.332146f,0.332056f,0.331965f,0.331875f,0.331785f,0.331694f,0.331604f,0.331513f,0.331423f,0.331332f,0.331242f,0.331151f,0.331061f,0.330971f,0.33088f,0.33079f,0.330699f,0.330609f,0.330518f,0.330428f,0.330337f,0.330247f,0.330156f,0.330066f,0.329975f,0.329885f,0.329794f,0.329704f,0.329613f,0.329523f,0.329432f,0.329342f,0.329251f,0.32916f,0.32907f,0.328979f,0.328889f,0.328798f,0.328708f,0.328617f,0.328527f,0.328436f,0.328346f,0.328255f,0.328164f,0.328074f,0.327983f,0.327893f,0.327802f,0.327712f,0.327621f,0.32753f,0.32744f,0.327349f,0.327259f,0.327168f,0.327078f,0.326987f,0.326896f,0.326806f,0.326715f,0.326624f,0.326534f,0.326443f,0.326353f,0.326262f,0.326171f,0.326081f,0.32599f,0.325899f,0.325809f,0.325718f,0.325628f,0.325537f,0.325446f,0.325355f,0.325265f,0.325174f,0.325084f,0.324993f,0.324902f,0.324811f,0.324721f,0.32463f,0.32454f,0.324449f,0.324358f,0.324268f,0.324177f,0.324086f,0.323995f,0.323905f,0.323814f,0.323723f,0.323633f,0.323542f,0.323451f,0.32336f,0.32327f,0.323179f,0.323088f,0.322997f,0.322907f,0.322816f,0.322725f,0.322634f,0.322544f,0.322453f,0.322362f,0.322271f,0.322181f,0.32209f,0.321999f,0.321908f,0.321818f,0.321727f,0.321636f,0.321545f,0.321455f,0.321364f,0.321273f,0.321182f,0.321091f,0.321001f,0.32091f,0.320819f,0.320728f,0.320637f,0.320547f,0.320456f,0.320365f,0.320274f,0.320183f,0.320092f,0.320002f,0.319911f,0.31982f,0.319729f,0.319638f,0.319547f,0.319457f,0.319366f,0.319275f,0.319184f,0.319093f,0.319002f,0.318911f,0.31882f,0.31873f,0.318639f,0.318548f,0.318457f,0.318366f,0.318275f,0.318184f,0.318093f,0.318003f,0.317912f,0.317821f,0.31773f,0.317639f,0.317548f,0.317457f,0.317366f,0.317275f,0.317184f,0.317093f,0.317003f,0.316912f,0.316821f,0.31673f,0.316639f,0.316548f,0.316457f,0.316366f,0.316275f,0.316184f,0.316093f,0.316002f,0.315911f,0.31582f,0.315729f,0.315638f,0.315547f,0.315456f,0.315365f,0.315274f,0.315183f,0.315092f,0.315001f,0.31491f,0.314819f,0.314728f,0.314637f,0.314546f,0.314455f,0.314364f,0.314273f,0.314182f,0.314091f,0.314f,0.313909f,0.313818f,0.313727f,0.313636f,0.313545f,0.313454f,0.313363f,0.313272f,0.313181f,0.31309f,0.312999f,0.312908f,0.312817f,0.312726f,0.312635f,0.312544f,0.312453f,0.312361f,0.31227f,0.312179f,0.312088f,0.311997f,0.311906f,0.311815f,0.311724f,0.311633f,0.311541f,0.31145f,0.311359f,0.311268f,0.311177f,0.311086f,0.310995f,0.310904f,0.310813f,0.310721f,0.31063f,0.310539f,0.310448f,0.310357f,0.310266f,0.310175f,0.310083f,0.309992f,0.309901f,0.30981f,0.309719f,0.309628f,0.309537f,0.309445f,0.309354f,0.309263f,0.309172f,0.309081f,0.30899f,0.308898f,0.308807f,0.308716f,0.308625f,0.308534f,0.308442f,0.308351f,0.30826f,0.308169f,0.308078f,0.307986f,0.307895f,0.307804f,0.307713f,0.307622f,0.30753f,0.307439f,0.307348f,0.307257f,0.307165f,0.307074f,0.306983f,0.306892f,0.3068f,0.306709f,0.306618f,0.306527f,0.306435f,0.306344f,0.306253f,0.306162f,0.30607f,0.305979f,0.305888f,0.305797f,0.305705f,0.305614f,0.305523f,0.305431f,0.30534f,0.305249f,0.305157f,0.305066f,0.304975f,0.304883f,0.304792f,0.304701f,0.30461f,0.304518f,0.304427f,0.304336f,0.304244f,0.304153f,0.304062f,0.30397f,0.303879f,0.303788f,0.303696f,0.303605f,0.303513f,0.303422f,0.303331f,0.303239f,0.303148f,0.303057f,0.302965f,0.302874f,0.302783f,0.302691f,0.3026f,0.302509f,0.302417f,0.302326f,0.302234f,0.302143f,0.302051f,0.30196f,0.301869f,0.301777f,0.301686f,0.301595f,0.301503f,0.301412f,0.30132f,0.301229f,0.301137f,0.301046f,0.300955f,0.300863f,0.300772f,0.30068f,0.300589f,0.300497f,0.300406f,0.300315f,0.300223f,0.300132f,0.30004f,0.299949f,0.299857f,0.299766f,0.299674f,0.299583f,0.299491f,0.2994f,0.299309f,0.299217f,0.299125f,0.299034f,0.298942f,0.298851f,0.29876f,0.298668f,0.298577f,0.298485f,0.298393f,0.298302f,0.29821f,0.298119f,0.298027f,0.297936f,0.297844f,0.297753f,0.297662f,0.29757f,0.297478f,0.297387f,0.297295f,0.297204f,0.297112f,0.297021f,0.296929f,0.296837f,0.296746f,0.296654f,0.296563f,0.296471f,0.29638f,0.296288f,0.296197f,0.296105f,0.296013f,0.295922f,0.29583f,0.295739f,0.295647f,0.295556f,0.295464f,0.295372f,0.295281f,0.295189f,0.295098f,0.295006f,0.294914f,0.294823f,0.294731f,0.294639f,0.294548f,0.294456f,0.294365f,0.294273f,0.294181f,0.29409f,0.293998f,0.293906f,0.293815f,0.293723f,0.293632f,0.29354f,0.293448f,0.293357f,0.293265f,0.293173f,0.293082f,0.29299f,0.292898f,0.292807f,0.292715f,0.292623f,0.292532f,0.29244f,0.292348f,0.292256f,0.292165f,0.292073f,0.291981f,0.29189f,0.291798f,0.291706f,0.291615f,0.291523f,0.291431f,0.29134f,0.291248f,0.291156f,0.291064f,0.290973f,0.290881f,0.290789f,0.290697f,0.290606f,0.290514f,0.290422f,0.290331f,0.290239f,0.290147f,0.290055f,0.289963f,0.289872f,0.28978f,0.289688f,0.289597f,0.289505f,0.289413f,0.289321f,0.289229f,0.289138f,0.289046f,0.288954f,0.288862f,0.28877f,0.288679f,0.288587f,0.288495f,0.288403f,0.288311f,0.28822f,0.288128f,0.288036f,0.287944f,0.287852f,0.287761f,0.287669f,0.287577f,0.287485f,0.287393f,0.287302f,0.28721f,0.287118f,0.287026f,0.286934f,0.286842f,0.28675f,0.286659f,0.286567f,0.286475f,0.286383f,0.286291f,0.286199f,0.286107f,0.286016f,0.285924f,0.285832f,0.28574f,0.285648f,0.285556f,0.285464f,0.285372f,0.285281f,0.285189f,0.285097f,0.285005f,0.284913f,0.284821f,0.284729f,0.284637f,0.284545f,0.284453f,0.284362f,0.284269f,0.284178f,0.284086f,0.283994f,0.283902f,0.28381f,0.283718f,0.283626f,0.283534f,0.283442f,0.28335f,0.283258f,0.283166f,0.283074f,0.282983f,0.282891f,0.282798f,0.282707f,0.282615f,0.282523f,0.282431f,0.282339f,0.282247f,0.282155f,0.282063f,0.281971f,0.281879f,0.281787f,0.281695f,0.281603f,0.281511f,0.281419f,0.281327f,0.281235f,0.281143f,0.281051f,0.280959f,0.280867f,0.280775f,0.280683f,0.280591f,0.280499f,0.280407f,0.280315f,0.280223f,0.280131f,0.280039f,0.279947f,0.279854f,0.279762f,0.27967f,0.279578f,0.279486f,0.279394f,0.279302f,0.27921f,0.279118f,0.279026f,0.278934f,0.278842f,0.27875f,0.278658f,0.278566f,0.278474f,0.278381f,0.278289f,0.278197f,0.278105f,0.278013f,0.277921f,0.277829f,0.277737f,0.277645f,0.277553f,0.27746f,0.277368f,0.277276f,0.277184f,0.277092f,0.277f,0.276908f,0.276816f,0.276724f,0.276631f,0.276539f,0.276447f,0.276355f,0.276263f,0.276171f,0.276078f,0.275986f,0.275894f,0.275802f,0.27571f,0.275618f,0.275526f,0.275434f,0.275341f,0.275249f,0.275157f,0.275065f,0.274973f,0.27488f,0.274788f,0.274696f,0.274604f,0.274512f,0.274419f,0.274327f,0.274235f,0.274143f,0.274051f,0.273959f,0.273866f,0.273774f,0.273682f,0.27359f,0.273497f,0.273405f,0.273313f,0.273221f,0.273128f,0.273036f,0.272944f,0.272852f,0.27276f,0.272667f,0.272575f,0.272483f,0.272391f,0.272298f,0.272206f,0.272114f,0.272022f,0.271929f,0.271837f,0.271745f,0.271652f,0.27156f,0.271468f,0.271376f,0.271284f,0.271191f,0.271099f,0.271007f,0.270914f,0.270822f,0.27073f,0.270637f,0.270545f,0.270453f,0.270361f,0.270268f,0.270176f,0.270084f,0.269991f,0.269899f,0.269807f,0.269714f,0.269622f,0.26953f,0.269437f,0.269345f,0.269253f,0.26916f,0.269068f,0.268976f,0.268883f,0.268791f,0.268699f,0.268606f,0.268514f,0.268422f,0.268329f,0.268237f,0.268145f,0.268052f,0.26796f,0.267867f,0.267775f,0.267683f,0.26759f,0.267498f,0.267406f,0.267313f,0.267221f,0.267128f,0.267036f,0.266944f,0.266851f,0.266759f,0.266667f,0.266574f,0.266482f,0.266389f,0.266297f,0.266204f,0.266112f,0.26602f,0.265927f,0.265835f,0.265742f,0.26565f,0.265557f,0.265465f,0.265373f,0.26528f,0.265188f,0.265095f,0.265003f,0.26491f,0.264818f,0.264725f,0.264633f,0.264541f,0.264448f,0.264356f,0.264263f,0.264171f,0.264078f,0.263986f,0.263893f,0.263801f,0.263708f,0.263616f,0.263523f,0.263431f,0.263338f,0.263246f,0.263153f,0.263061f,0.262968f,0.262876f,0.262784f,0.262691f,0.262598f,0.262506f,0.262413f,0.262321f,0.262228f,0.262136f,0.262043f,0.261951f,0.261858f,0.261766f,0.261673f,0.261581f,0.261488f,0.261396f,0.261303f,0.26121f,0.261118f,0.261025f,0.260933f,0.26084f,0.260748f,0.260655f,0.260563f,0.26047f,0.260377f,0.260285f,0.260192f,0.2601f,0.260007f,0.259915f,0.259822f,0.259729f,0.259637f,0.259544f,0.259452f,0.259359f,0.259267f,0.259174f,0.259081f,0.258989f,0.258896f,0.258803f,0.258711f,0.258618f,0.258526f,0.258433f,0.258341f,0.258248f,0.258155f,0.258063f,0.25797f,0.257877f,0.257785f,0.257692f,0.2576f,0.257507f,0.257414f,0.257321f,0.257229f,0.257136f,0.257044f,0.256951f,0.256858f,0.256766f,0.256673f,0.25658f,0.256488f,0.256395f,0.256302f,0.25621f,0.256117f,0.256024f,0.255931f,0.255839f,0.255746f,0.255654f,0.255561f,0.255468f,0.255376f,0.255283f,0.25519f,0.255097f,0.255005f,0.254912f,0.254819f,0.254727f,0.254634f,0.254541f,0.254448f,0.254356f,0.254263f,0.25417f,0.254077f,0.253985f,0.253892f,0.253799f,0.253706f,0.253614f,0.253521f,0.253428f,0.253336f,0.253243f,0.25315f,0.253057f,0.252964f,0.252872f,0.252779f,0.252686f,0.252594f,0.252501f,0.252408f,0.252315f,0.252222f,0.25213f,0.252037f,0.251944f,0.251851f,0.251759f,0.251666f,0.251573f,0.25148f,0.251387f,0.251295f,0.251202f,0.251109f,0.251016f,0.250923f,0.250831f,0.250738f,0.250645f,0.250552f,0.250459f,0.250367f,0.250274f,0.250181f,0.250088f,0.249995f,0.249902f,0.24981f,0.249717f,0.249624f,0.249531f,0.249438f,0.249345f,0.249252f,0.24916f,0.249067f,0.248974f,0.248881f,0.248788f,0.248695f,0.248603f,0.24851f,0.248417f,0.248324f,0.248231f,0.248138f,0.248045f,0.247952f,0.24786f,0.247767f,0.247674f,0.247581f,0.247488f,0.247395f,0.247302f,0.247209f,0.247116f,0.247023f,0.246931f,0.246838f,0.246745f,0.246652f,0.246559f,0.246466f,0.246373f,0.24628f,0.246187f,0.246094f,0.246001f,0.245908f,0.245816f,0.245723f,0.24563f,0.245537f,0.245444f,0.245351f,0.245258f,0.245165f,0.245072f,0.244979f,0.244886f,0.244793f,0.2447f,0.244607f,0.244514f,0.244421f,0.244328f,0.244235f,0.244143f,0.24405f,0.243956f,0.243863f,0.24377f,0.243678f,0.243585f,0.243492f,0.243399f,0.243306f,0.243213f,0.24312f,0.243027f,0.242934f,0.242841f,0.242748f,0.242655f,0.242562f,0.242468f,0.242375f,0.242282f,0.242189f,0.242097f,0.242004f,0.241911f,0.241818f,0.241724f,0.241631f,0.241538f,0.241445f,0.241352f,0.241259f,0.241166f,0.241073f,0.24098f,0.240887f,0.240794f,0.240701f,0.240608f,0.240515f,0.240422f,0.240329f,0.240236f,0.240142f,0.240049f,0.239956f,0.239863f,0.23977f,0.239677f,0.239584f,0.239491f,0.239398f,0.239305f,0.239212f,0.239119f,0.239026f,0.238933f,0.238839f,0.238746f,0.238653f,0.23856f,0.238467f,0.238374f,0.238281f,0.238188f,0.238095f,0.238001f,0.237908f,0.237815f,0.237722f,0.237629f,0.237536f,0.237443f,0.23735f,0.237256f,0.237163f,0.23707f,0.236977f,0.236884f,0.236791f,0.236698f,0.236604f,0.236511f,0.236418f,0.236325f,0.236232f,0.236139f,0.236045f,0.235952f,0.235859f,0.235766f,0.235673f,0.23558f,0.235486f,0.235393f,0.2353f,0.235207f,0.235114f,0.235021f,0.234927f,0.234834f,0.234741f,0.234648f,0.234555f,0.234461f,0.234368f,0.234275f,0.234182f,0.234088f,0.233995f,0.233902f,0.233809f,0.233716f,0.233622f,0.233529f,0.233436f,0.233343f,0.233249f,0.233156f,0.233063f,0.23297f,0.232877f,0.232783f,0.23269f,0.232597f,0.232504f,0.23241f,0.232317f,0.232224f,0.232131f,0.232037f,0.231944f,0.231851f,0.231758f,0.231664f,0.231571f,0.231478f,0.231385f,0.231291f,0.231198f,0.231105f,0.231011f,0.230918f,0.230825f,0.230732f,0.230638f,0.230545f,0.230452f,0.230358f,0.230265f,0.230172f,0.230078f,0.229985f,0.229892f,0.229799f,0.229705f,0.229612f,0.229519f,0.229425f,0.229332f,0.229239f,0.229145f,0.229052f,0.228959f,0.228865f,0.228772f,0.228679f,0.228585f,0.228492f,0.228399f,0.228305f,0.228212f,0.228119f,0.228025f,0.227932f,0.227839f,0.227745f,0.227652f,0.227559f,0.227465f,0.227372f,0.227278f,0.227185f,0.227092f,0.226998f,0.226905f,0.226812f,0.226718f,0.226625f,0.226531f,0.226438f,0.226345f,0.226251f,0.226158f,0.226065f,0.225971f,0.225878f,0.225784f,0.225691f,0.225598f,0.225504f,0.225411f,0.225317f,0.225224f,0.22513f,0.225037f,0.224944f,0.22485f,0.224757f,0.224664f,0.22457f,0.224477f,0.224383f,0.22429f,0.224196f,0.224103f,0.224009f,0.223916f,0.223823f,0.223729f,0.223636f,0.223542f,0.223449f,0.223355f,0.223262f,0.223168f,0.223075f,0.222982f,0.222888f,0.222795f,0.222701f,0.222608f,0.222514f,0.222421f,0.222327f,0.222234f,0.22214f,0.222047f,0.221953f,0.22186f,0.221766f,0.221673f,0.221579f,0.221486f,0.221392f,0.221299f,0.221205f,0.221112f,0.221018f,0.220925f,0.220831f,0.220738f,0.220644f,0.220551f,0.220457f,0.220364f,0.22027f,0.220177f,0.220083f,0.21999f,0.219896f,0.219803f,0.219709f,0.219616f,0.219522f,0.219429f,0.219335f,0.219242f,0.219148f,0.219054f,0.218961f,0.218867f,0.218774f,0.21868f,0.218587f,0.218493f,0.218399f,0.218306f,0.218212f,0.218119f,0.218025f,0.217932f,0.217838f,0.217745f,0.217651f,0.217557f,0.217464f,0.21737f,0.217277f,0.217183f,0.21709f,0.216996f,0.216902f,0.216809f,0.216715f,0.216622f,0.216528f,0.216434f,0.216341f,0.216247f,0.216153f,0.21606f,0.215966f,0.215873f,0.215779f,0.215685f,0.215592f,0.215498f,0.215405f,0.215311f,0.215217f,0.215124f,0.21503f,0.214936f,0.214843f,0.214749f,0.214656f,0.214562f,0.214468f,0.214375f,0.214281f,0.214187f,0.214094f,0.214f,0.213906f,0.213813f,0.213719f,0.213625f,0.213532f,0.213438f,0.213344f,0.213251f,0.213157f,0.213063f,0.21297f,0.212876f,0.212782f,0.212689f,0.212595f,0.212501f,0.212408f,0.212314f,0.21222f,0.212127f,0.212033f,0.211939f,0.211846f,0.211752f,0.211658f,0.211564f,0.211471f,0.211377f,0.211283f,0.21119f,0.211096f,0.211002f,0.210909f,0.210815f,0.210721f,0.210627f,0.210534f,0.21044f,0.210346f,0.210252f,0.210159f,0.210065f,0.209971f,0.209877f,0.209784f,0.20969f,0.209596f,0.209503f,0.209409f,0.209315f,0.209221f,0.209127f,0.209034f,0.20894f,0.208846f,0.208752f,0.208659f,0.208565f,0.208471f,0.208377f,0.208284f,0.20819f,0.208096f,0.208002f,0.207909f,0.207815f,0.207721f,0.207627f,0.207533f,0.20744f,0.207346f,0.207252f,0.207158f,0.207064f,0.206971f,0.206877f,0.206783f,0.206689f,0.206595f,0.206502f,0.206408f,0.206314f,0.20622f,0.206126f,0.206032f,0.205939f,0.205845f,0.205751f,0.205657f,0.205563f,0.20547f,0.205376f,0.205282f,0.205188f,0.205094f,0.205f,0.204907f,0.204813f,0.204719f,0.204625f,0.204531f,0.204437f,0.204344f,0.20425f,0.204156f,0.204062f,0.203968f,0.203874f,0.20378f,0.203687f,0.203593f,0.203499f,0.203405f,0.203311f,0.203217f,0.203123f,0.203029f,0.202936f,0.202842f,0.202748f,0.202654f,0.20256f,0.202466f,0.202372f,0.202278f,0.202184f,0.202091f,0.201997f,0.201903f,0.201809f,0.201715f,0.201621f,0.201527f,0.201433f,0.201339f,0.201245f,0.201152f,0.201058f,0.200964f,0.20087f,0.200776f,0.200682f,0.200588f,0.200494f,0.2004f,0.200306f,0.200212f,0.200118f,0.200024f,0.19993f,0.199837f,0.199743f,0.199649f,0.199555f,0.199461f,0.199367f,0.199273f,0.199179f,0.199085f,0.198991f,0.198897f,0.198803f,0.198709f,0.198615f,0.198521f,0.198427f,0.198333f,0.198239f,0.198145f,0.198051f,0.197957f,0.197863f,0.197769f,0.197675f,0.197581f,0.197488f,0.197394f,0.1973f,0.197205f,0.197111f,0.197017f,0.196923f,0.19683f,0.196736f,0.196642f,0.196548f,0.196453f,0.196359f,0.196265f,0.196171f,0.196077f,0.195983f,0.19589f,0.195796f,0.195701f,0.195607f,0.195513f,0.195419f,0.195325f,0.195231f,0.195137f,0.195043f,0.194949f,0.194855f,0.194761f,0.194667f,0.194573f,0.194479f,0.194385f,0.194291f,0.194197f,0.194103f,0.194009f,0.193915f,0.193821f,0.193727f,0.193633f,0.193539f,0.193445f,0.19335f,0.193256f,0.193162f,0.193068f,0.192974f,0.19288f,0.192786f,0.192692f,0.192598f,0.192504f,0.19241f,0.192316f,0.192221f,0.192127f,0.192033f,0.191939f,0.191845f,0.191751f,0.191657f,0.191563f,0.191469f,0.191375f,0.191281f,0.191187f,0.191092f,0.190998f,0.190904f,0.19081f,0.190716f,0.190622f,0.190528f,0.190434f,0.190339f,0.190245f,0.190151f,0.190057f,0.189963f,0.189869f,0.189775f,0.189681f,0.189586f,0.189492f,0.189398f,0.189304f,0.18921f,0.189116f,0.189022f,0.188927f,0.188833f,0.188739f,0.188645f,0.188551f,0.188457f,0.188362f,0.188268f,0.188174f,0.18808f,0.187986f,0.187892f,0.187797f,0.187703f,0.187609f,0.187515f,0.187421f,0.187327f,0.187232f,0.187138f,0.187044f,0.18695f,0.186856f,0.186762f,0.186667f,0.186573f,0.186479f,0.186385f,0.186291f,0.186196f,0.186102f,0.186008f,0.185914f,0.185819f,0.185725f,0.185631f,0.185537f,0.185443f,0.185349f,0.185254f,0.18516f,0.185066f,0.184972f,0.184877f,0.184783f,0.184689f,0.184595f,0.184501f,0.184406f,0.184312f,0.184218f,0.184124f,0.184029f,0.183935f,0.183841f,0.183747f,0.183653f,0.183558f,0.183464f,0.18337f,0.183275f,0.183181f,0.183087f,0.182993f,0.182899f,0.182804f,0.18271f,0.182616f,0.182521f,0.182427f,0.182333f,0.182239f,0.182144f,0.18205f,0.181956f,0.181861f,0.181767f,0.181673f,0.181579f,0.181484f,0.18139f,0.181296f,0.181201f,0.181107f,0.181013f,0.180919f,0.180824f,0.18073f,0.180636f,0.180542f,0.180447f,0.180353f,0.180259f,0.180164f,0.18007f,0.179976f,0.179881f,0.179787f,0.179693f,0.179598f,0.179504f,0.17941f,0.179315f,0.179221f,0.179127f,0.179033f,0.178938f,0.178844f,0.178749f,0.178655f,0.178561f,0.178467f,0.178372f,0.178278f,0.178183f,0.178089f,0.177995f,0.1779f,0.177806f,0.177712f,0.177618f,0.177523f,0.177429f,0.177334f,0.17724f,0.177146f,0.177051f,0.176957f,0.176863f,0.176768f,0.176674f,0.176579f,0.176485f,0.176391f,0.176296f,0.176202f,0.176108f,0.176013f,0.175919f,0.175824f,0.17573f,0.175636f,0.175541f,0.175447f,0.175353f,0.175258f,0.175164f,0.175069f,0.174975f,0.174881f,0.174786f,0.174692f,0.174597f,0.174503f,0.174409f,0.174314f,0.17422f,0.174125f,0.174031f,0.173937f,0.173842f,0.173748f,0.173653f,0.173559f,0.173464f,0.17337f,0.173276f,0.173181f,0.173087f,0.172992f,0.172898f,0.172803f,0.172709f,0.172615f,0.17252f,0.172426f,0.172331f,0.172237f,0.172143f,0.172048f,0.171954f,0.171859f,0.171765f,0.17167f,0.171576f,0.171481f,0.171387f,0.171292f,0.171198f,0.171103f,0.171009f,0.170915f,0.17082f,0.170726f,0.170631f,0.170537f,0.170442f,0.170348f,0.170253f,0.170159f,0.170064f,0.16997f,0.169875f,0.169781f,0.169686f,0.169592f,0.169497f,0.169403f,0.169309f,0.169214f,0.16912f,0.169025f,0.16893f,0.168836f,0.168741f,0.168647f,0.168553f,0.168458f,0.168364f,0.168269f,0.168174f,0.16808f,0.167985f,0.167891f,0.167796f,0.167702f,0.167608f,0.167513f,0.167418f,0.167324f,0.167229f,0.167135f,0.16704f,0.166946f,0.166851f,0.166757f,0.166662f,0.166568f,0.166473f,0.166379f,0.166284f,0.16619f,0.166095f,0.166f,0.165906f,0.165811f,0.165717f,0.165622f,0.165528f,0.165433f,0.165339f,0.165244f,0.165149f,0.165055f,0.16496f,0.164866f,0.164771f,0.164677f,0.164582f,0.164487f,0.164393f,0.164298f,0.164204f,0.164109f,0.164015f,0.16392f,0.163826f,0.163731f,0.163636f,0.163542f,0.163447f,0.163353f,0.163258f,0.163163f,0.163069f,0.162974f,0.16288f,0.162785f,0.16269f,0.162596f,0.162501f,0.162407f,0.162312f,0.162218f,0.162123f,0.162028f,0.161934f,0.161839f,0.161744f,0.16165f,0.161555f,0.161461f,0.161366f,0.161271f,0.161177f,0.161082f,0.160987f,0.160893f,0.160798f,0.160704f,0.160609f,0.160514f,0.16042f,0.160325f,0.16023f,0.160136f,0.160041f,0.159947f,0.159852f,0.159757f,0.159663f,0.159568f,0.159473f,0.159379f,0.159284f,0.159189f,0.159095f,0.159f,0.158905f,0.158811f,0.158716f,0.158621f,0.158527f,0.158432f,0.158337f,0.158243f,0.158148f,0.158053f,0.157959f,0.157864f,0.157769f,0.157675f,0.15758f,0.157485f,0.157391f,0.157296f,0.157201f,0.157107f,0.157012f,0.156917f,0.156823f,0.156728f,0.156633f,0.156539f,0.156444f,0.156349f,0.156255f,0.15616f,0.156065f,0.15597f,0.155876f,0.155781f,0.155686f,0.155592f,0.155497f,0.155402f,0.155307f,0.155213f,0.155118f,0.155023f,0.154929f,0.154834f,0.154739f,0.154645f,0.15455f,0.154455f,0.15436f,0.154266f,0.154171f,0.154076f,0.153981f,0.153887f,0.153792f,0.153697f,0.153602f,0.153508f,0.153413f,0.153318f,0.153224f,0.153129f,0.153034f,0.152939f,0.152844f,0.15275f,0.152655f,0.15256f,0.152466f,0.152371f,0.152276f,0.152181f,0.152086f,0.151992f,0.151897f,0.151802f,0.151707f,0.151613f,0.151518f,0.151423f,0.151328f,0.151234f,0.151139f,0.151044f,0.150949f,0.150855f,0.15076f,0.150665f,0.15057f,0.150475f,0.150381f,0.150286f,0.150191f,0.150096f,0.150002f,0.149907f,0.149812f,0.149717f,0.149622f,0.149527f,0.149433f,0.149338f,0.149243f,0.149148f,0.149053f,0.148959f,0.148864f,0.148769f,0.148674f,0.14858f,0.148485f,0.14839f,0.148295f,0.1482f,0.148105f,0.148011f,0.147916f,0.147821f,0.147726f,0.147631f,0.147536f,0.147442f,0.147347f,0.147252f,0.147157f,0.147062f,0.146968f,0.146873f,0.146778f,0.146683f,0.146588f,0.146493f,0.146398f,0.146304f,0.146209f,0.146114f,0.146019f,0.145924f,0.145829f,0.145735f,0.14564f,0.145545f,0.14545f,0.145355f,0.14526f,0.145165f,0.145071f,0.144976f,0.144881f,0.144786f,0.144691f,0.144596f,0.144501f,0.144406f,0.144312f,0.144217f,0.144122f,0.144027f,0.143932f,0.143837f,0.143742f,0.143647f,0.143553f,0.143458f,0.143363f,0.143268f,0.143173f,0.143078f,0.142983f,0.142888f,0.142794f,0.142699f,0.142604f,0.142509f,0.142414f,0.142319f,0.142224f,0.142129f,0.142034f,0.141939f,0.141845f,0.14175f,0.141655f,0.14156f,0.141465f,0.14137f,0.141275f,0.14118f,0.141085f,0.14099f,0.140896f,0.140801f,0.140706f,0.140611f,0.140516f,0.140421f,0.140326f,0.140231f,0.140136f,0.140041f,0.139946f,0.139851f,0.139756f,0.139661f,0.139567f,0.139472f,0.139377f,0.139282f,0.139187f,0.139092f,0.138997f,0.138902f,0.138807f,0.138712f,0.138617f,0.138522f,0.138427f,0.138332f,0.138237f,0.138142f,0.138047f,0.137952f,0.137858f,0.137763f,0.137667f,0.137572f,0.137478f,0.137383f,0.137288f,0.137193f,0.137098f,0.137003f,0.136908f,0.136813f,0.136718f,0.136623f,0.136528f,0.136433f,0.136338f,0.136243f,0.136148f,0.136053f,0.135958f,0.135863f,0.135768f,0.135673f,0.135578f,0.135483f,0.135388f,0.135293f,0.135198f,0.135103f,0.135008f,0.134913f,0.134818f,0.134723f,0.134628f,0.134533f,0.134438f,0.134343f,0.134248f,0.134153f,0.134058f,0.133963f,0.133868f,0.133773f,0.133678f,0.133583f,0.133488f,0.133393f,0.133298f,0.133203f,0.133108f,0.133013f,0.132918f,0.132823f,0.132728f,0.132633f,0.132538f,0.132443f,0.132348f,0.132253f,0.132158f,0.132063f,0.131968f,0.131873f,0.131778f,0.131683f,0.131588f,0.131492f,0.131397f,0.131302f,0.131207f,0.131112f,0.131017f,0.130922f,0.130827f,0.130732f,0.130637f,0.130542f,0.130447f,0.130352f,0.130257f,0.130162f,0.130067f,0.129972f,0.129876f,0.129781f,0.129686f,0.129591f,0.129496f,0.129401f,0.129306f,0.129211f,0.129116f,0.129021f,0.128926f,0.128831f,0.128736f,0.128641f,0.128546f,0.12845f,0.128355f,0.12826f,0.128165f,0.12807f,0.127975f,0.12788f,0.127785f,0.12769f,0.127595f,0.1275f,0.127405f,0.127309f,0.127214f,0.127119f,0.127024f,0.126929f,0.126834f,0.126739f,0.126644f,0.126549f,0.126454f,0.126359f,0.126263f,0.126168f,0.126073f,0.125978f,0.125883f,0.125788f,0.125693f,0.125598f,0.125503f,0.125407f,0.125312f,0.125217f,0.125122f,0.125027f,0.124932f,0.124837f,0.124742f,0.124646f,0.124551f,0.124456f,0.124361f,0.124266f,0.124171f,0.124076f,0.123981f,0.123885f,0.12379f,0.123695f,0.1236f,0.123505f,0.12341f,0.123315f,0.123219f,0.123124f,0.123029f,0.122934f,0.122839f,0.122744f,0.122648f,0.122553f,0.122458f,0.122363f,0.122268f,0.122173f,0.122078f,0.121982f,0.121887f,0.121792f,0.121697f,0.121602f,0.121506f,0.121411f,0.121316f,0.121221f,0.121126f,0.121031f,0.120936f,0.120841f,0.120745f,0.12065f,0.120555f,0.12046f,0.120365f,0.120269f,0.120174f,0.120079f,0.119984f,0.119889f,0.119793f,0.119698f,0.119603f,0.119508f,0.119413f,0.119318f,0.119222f,0.119127f,0.119032f,0.118937f,0.118842f,0.118746f,0.118651f,0.118556f,0.118461f,0.118366f,0.11827f,0.118175f,0.11808f,0.117985f,0.11789f,0.117794f,0.117699f,0.117604f,0.117509f,0.117414f,0.117318f,0.117223f,0.117128f,0.117033f,0.116937f,0.116842f,0.116747f,0.116652f,0.116557f,0.116461f,0.116366f,0.116271f,0.116176f,0.11608f,0.115985f,0.11589f,0.115795f,0.1157f,0.115604f,0.115509f,0.115414f,0.115319f,0.115223f,0.115128f,0.115033f,0.114938f,0.114843f,0.114747f,0.114652f,0.114557f,0.114461f,0.114366f,0.114271f,0.114176f,0.114081f,0.113985f,0.11389f,0.113795f,0.113699f,0.113604f,0.113509f,0.113414f,0.113319f,0.113223f,0.113128f,0.113033f,0.112937f,0.112842f,0.112747f,0.112652f,0.112556f,0.112461f,0.112366f,0.112271f,0.112175f,0.11208f,0.111985f,0.11189f,0.111794f,0.111699f,0.111604f,0.111508f,0.111413f,0.111318f,0.111223f,0.111127f,0.111032f,0.110937f,0.110842f,0.110746f,0.110651f,0.110556f,0.11046f,0.110365f,0.11027f,0.110175f,0.110079f,0.109984f,0.109889f,0.109793f,0.109698f,0.109603f,0.109507f,0.109412f,0.109317f,0.109221f,0.109126f,0.109031f,0.108936f,0.10884f,0.108745f,0.10865f,0.108555f,0.108459f,0.108364f,0.108268f,0.108173f,0.108078f,0.107983f,0.107887f,0.107792f,0.107696f,0.107601f,0.107506f,0.107411f,0.107315f,0.10722f,0.107125f,0.107029f,0.106934f,0.106839f,0.106743f,0.106648f,0.106553f,0.106457f,0.106362f,0.106267f,0.106171f,0.106076f,0.105981f,0.105885f,0.10579f,0.105695f,0.105599f,0.105504f,0.105409f,0.105313f,0.105218f,0.105123f,0.105027f,0.104932f,0.104837f,0.104741f,0.104646f,0.104551f,0.104455f,0.10436f,0.104265f,0.104169f,0.104074f,0.103979f,0.103883f,0.103788f,0.103692f,0.103597f,0.103502f,0.103406f,0.103311f,0.103216f,0.10312f,0.103025f,0.10293f,0.102834f,0.102739f,0.102644f,0.102548f,0.102453f,0.102357f,0.102262f,0.102167f,0.102071f,0.101976f,0.101881f,0.101785f,0.10169f,0.101594f,0.101499f,0.101404f,0.101308f,0.101213f,0.101117f,0.101022f,0.100927f,0.100831f,0.100736f,0.10064f,0.100545f,0.10045f,0.100354f,0.100259f,0.100164f,0.100068f,.0999727f,.0998774f,.099782f,.0996866f,.0995913f,.0994959f,.0994005f,.0993052f,.0992095f,.0991142f,.0990188f,.0989234f,.098828f,.0987327f,.0986373f,.0985419f,.0984463f,.0983509f,.0982555f,.0981602f,.0980648f,.0979694f,.097874f,.0977786f,.097683f,.0975876f,.0974922f,.0973969f,.0973015f,.0972061f,.0971107f,.0970153f,.0969197f,.0968243f,.0967289f,.0966335f,.0965381f,.0964427f,.0963473f,.0962519f,.0961562f,.0960608f,.0959654f,.09587f,.0957746f,.0956792f,.0955838f,.0954884f,.0953928f,.0952974f,.095202f,.0951066f,.0950111f,.0949157f,.0948203f,.0947249f,.0946293f,.0945338f,.0944384f,.094343f,.0942476f,.0941522f,.0940568f,.0939613f,.0938657f,.0937703f,.0936748f,.0935794f,.093484f,.0933886f,.0932931f,.0931977f,.093102f,.0930066f,.0929112f,.0928158f,.0927203f,.0926249f,.0925295f,.092434f,.0923384f,.0922429f,.0921475f,.092052f,.0919566f,.0918612f,.0917657f,.0916703f,.0915746f,.0914792f,.0913837f,.0912883f,.0911928f,.0910974f,.091002f,.0909065f,.0908108f,.0907154f,.0906199f,.0905245f,.090429f,.0903336f,.0902381f,.0901427f,.0900472f,.0899515f,.0898561f,.0897606f,.0896651f,.0895697f,.0894742f,.0893788f,.0892833f,.0891876f,.0890921f,.0889967f,.0889012f,.0888058f,.0887103f,.0886148f,.0885193f,.0884236f,.0883282f,.0882327f,.0881372f,.0880418f,.0879463f,.0878508f,.0877553f,.0876596f,.0875641f,.0874687f,.0873732f,.0872777f,.0871822f,.0870868f,.0869913f,.0868956f,.0868001f,.0867046f,.0866091f,.0865136f,.0864181f,.0863227f,.0862272f,.0861314f,.086036f,.0859405f,.085845f,.0857495f,.085654f,.0855585f,.085463f,.0853673f,.0852718f,.0851763f,.0850808f,.0849853f,.0848898f,.0847943f,.0846988f,.0846031f,.0845076f,.0844121f,.0843166f,.0842211f,.0841255f,.08403f,.0839345f,.0838388f,.0837433f,.0836478f,.0835523f,.0834568f,.0833612f,.0832657f,.0831702f,.0830745f,.082979f,.0828834f,.0827879f,.0826924f,.0825969f,.0825014f,.0824059f,.0823101f,.0822146f,.0821191f,.0820235f,.081928f,.0818325f,.081737f,.0816415f,.0815457f,.0814502f,.0813546f,.0812591f,.0811636f,.0810681f,.0809725f,.080877f,.0807812f,.0806857f,.0805902f,.0804946f,.0803991f,.0803036f,.080208f,.0801125f,.0800167f,.0799212f,.0798256f,.0797301f,.0796346f,.079539f,.0794435f,.0793479f,.0792524f,.0791566f,.0790611f,.0789655f,.07887f,.0787744f,.0786789f,.0785833f,.0784878f,.078392f,.0782965f,.0782009f,.0781054f,.0780098f,.0779143f,.0778187f,.0777232f,.0776274f,.0775318f,.0774362f,.0773407f,.0772451f,.0771496f,.077054f,.0769585f,.0768627f,.0767671f,.0766715f,.076576f,.0764804f,.0763848f,.0762893f,.0761937f,.0760979f,.0760023f,.0759068f,.0758112f,.0757156f,.0756201f,.0755245f,.0754289f,.0753331f,.0752375f,.075142f,.0750464f,.0749508f,.0748553f,.0747597f,.0746641f,.0745683f,.0744727f,.0743771f,.0742816f,.074186f,.0740904f,.0739948f,.0738992f,.0738034f,.0737078f,.0736122f,.0735167f,.0734211f,.0733255f,.0732299f,.0731343f,.0730385f,.0729429f,.0728473f,.0727517f,.0726561f,.0725605f,.0724649f,.0723694f,.0722735f,.0721779f,.0720823f,.0719867f,.0718911f,.0717955f,.0716999f,.0716043f,.0715085f,.0714129f,.0713173f,.0712217f,.0711261f,.0710305f,.0709349f,.0708393f,.0707435f,.0706479f,.0705523f,.0704566f,.070361f,.0702654f,.0701698f,.0700742f,.0699784f,.0698828f,.0697872f,.0696915f,.0695959f,.0695003f,.0694047f,.0693091f,.0692132f,.0691176f,.069022f,.0689264f,.0688308f,.0687352f,.0686395f,.0685439f,.0684483f,.0683524f,.0682568f,.0681612f,.0680656f,.06797f,.0678743f,.0677787f,.0676831f,.0675872f,.0674916f,.067396f,.0673003f,.0672047f,.0671091f,.0670135f,.0669178f,.066822f,.0667263f,.0666307f,.0665351f,.0664394f,.0663438f,.0662482f,.0661525f,.0660567f,.065961f,.0658654f,.0657698f,.0656741f,.0655785f,.0654828f,.0653872f,.0652913f,.0651957f,.0651001f,.0650044f,.0649088f,.0648131f,.0647175f,.0646218f,.064526f,.0644303f,.0643347f,.064239f,.0641434f,.0640477f,.0639521f,.0638564f,.0637605f,.0636649f,.0635692f,.0634736f,.0633779f,.0632823f,.0631866f,.063091f,.0629951f,.0628994f,.0628038f,.0627081f,.0626125f,.0625168f,.0624212f,.0623255f,.0622296f,.0621339f,.0620383f,.0619426f,.061847f,.0617513f,.0616556f,.06156f,.0614641f,.0613684f,.0612728f,.0611771f,.0610814f,.0609858f,.0608901f,.0607944f,.0606985f,.0606029f,.0605072f,.0604115f,.0603158f,.0602202f,.0601245f,.0600288f,.0599329f,.0598373f,.0597416f,.0596459f,.0595502f,.0594546f,.0593589f,.0592632f,.0591673f,.0590716f,.0589759f,.0588803f,.0587846f,.0586889f,.0585932f,.0584975f,.0584016f,.0583059f,.0582103f,.0581146f,.0580189f,.0579232f,.0578275f,.0577318f,.0576362f,.0575402f,.0574446f,.0573489f,.0572532f,.0571575f,.0570618f,.0569661f,.0568704f,.0567745f,.0566788f,.0565831f,.0564874f,.0563917f,.056296f,.0562004f,.0561047f,.0560087f,.055913f,.0558173f,.0557216f,.0556259f,.0555303f,.0554346f,.0553389f,.0552429f,.0551472f,.0550515f,.0549558f,.0548601f,.0547644f,.0546687f,.054573f,.0544771f,.0543814f,.0542857f,.05419f,.0540943f,.0539986f,.0539029f,.0538072f,.0537112f,.0536155f,.0535198f,.0534241f,.0533284f,.0532327f,.053137f,.0530413f,.0529453f,.0528496f,.0527539f,.0526582f,.0525625f,.0524668f,.052371f,.0522753f,.0521794f,.0520837f,.051988f,.0518922f,.0517965f,.0517008f,.0516051f,.0515094f,.0514134f,.0513177f,.051222f,.0511263f,.0510305f,.0509348f,.0508391f,.0507434f,.0506474f,.0505517f,.050456f,.0503603f,.0502645f,.0501688f,.0500731f,.0499774f,.0498814f,.0497857f,.04969f,.0495942f,.0494985f,.0494028f,.049307f,.0492113f,.0491154f,.0490196f,.0489239f,.0488282f,.0487324f,.0486367f,.048541f,.0484452f,.0483493f,.0482535f,.0481578f,.0480621f,.0479663f,.0478706f,.0477749f,.0476791f,.0475834f,.0474874f,.0473917f,.047296f,.0472002f,.0471045f,.0470087f,.046913f,.0468173f,.0467213f,.0466255f,.0465298f,.0464341f,.0463383f,.0462426f,.0461468f,.0460511f,.0459551f,.0458594f,.0457636f,.0456679f,.0455721f,.0454764f,.0453806f,.0452849f,.0451889f,.0450932f,.0449974f,.0449017f,.0448059f,.0447102f,.0446144f,.0445187f,.0444227f,.0443269f,.0442312f,.0441354f,.0440397f,.0439439f,.0438482f,.0437524f,.0436564f,.0435607f,.0434649f,.0433692f,.0432734f,.0431777f,.0430819f,.0429862f,.0428902f,.0427944f,.0426987f,.0426029f,.0425071f,.0424114f,.0423156f,.0422199f,.0421239f,.0420281f,.0419324f,.0418366f,.0417408f,.0416451f,.0415493f,.0414536f,.0413576f,.0412618f,.041166f,.0410703f,.0409745f,.0408787f,.040783f,.0406872f,.0405912f,.0404954f,.0403997f,.0403039f,.0402081f,.0401124f,.0400166f,.0399208f,.0398248f,.0397291f,.0396333f,.0395375f,.0394418f,.039346f,.0392502f,.0391544f,.0390584f,.0389627f,.0388669f,.0387711f,.0386753f,.0385796f,.0384838f,.038388f,.038292f,.0381962f,.0381005f,.0380047f,.0379089f,.0378131f,.0377174f,.0376216f,.0375256f,.0374298f,.037334f,.0372382f,.0371425f,.0370467f,.0369509f,.0368551f,.0367594f,.0366633f,.0365676f,.0364718f,.036376f,.0362802f,.0361844f,.0360886f,.0359929f,.0358968f,.0358011f,.0357053f,.0356095f,.0355137f,.0354179f,.0353221f,.0352264f,.0351303f,.0350346f,.0349388f,.034843f,.0347472f,.0346514f,.0345556f,.0344598f,.0343638f,.034268f,.0341722f,.0340764f,.0339807f,.0338849f,.0337891f,.0336933f,.0335973f,.0335015f,.0334057f,.0333099f,.0332141f,.0331183f,.0330225f,.0329267f,.0328307f,.0327349f,.0326391f,.0325433f,.0324475f,.0323517f,.0322559f,.0321601f,.0320641f,.0319683f,.0318725f,.0317767f,.0316809f,.0315851f,.0314893f,.0313935f,.0312975f,.0312017f,.0311059f,.0310101f,.0309143f,.0308185f,.0307227f,.0306269f,.0305309f,.0304351f,.0303393f,.0302435f,.0301477f,.0300519f,.0299561f,.0298603f,.0297642f,.0296684f,.0295726f,.0294768f,.029381f,.0292852f,.0291894f,.0290936f,.0289976f,.0289018f,.028806f,.0287101f,.0286143f,.0285185f,.0284227f,.0283269f,.0282309f,.0281351f,.0280393f,.0279435f,.0278477f,.0277518f,.027656f,.0275602f,.0274642f,.0273684f,.0272726f,.0271768f,.027081f,.0269851f,.0268893f,.0267935f,.0266975f,.0266017f,.0265059f,.02641f,.0263142f,.0262184f,.0261226f,.0260268f,.025931f,.0258349f,.0257391f,.0256433f,.0255475f,.0254517f,.0253559f,.0252601f,.0251642f,.0250682f,.0249724f,.0248766f,.0247807f,.0246849f,.0245891f,.0244933f,.0243975f,.0243014f,.0242056f,.0241098f,.024014f,.0239182f,.0238224f,.0237265f,.0236307f,.0235347f,.0234388f,.023343f,.0232472f,.0231514f,.0230556f,.0229598f,.0228639f,.0227679f,.0226721f,.0225762f,.0224804f,.0223846f,.0222888f,.022193f,.0220971f,.0220011f,.0219053f,.0218094f,.0217136f,.0216178f,.021522f,.0214261f,.0213303f,.0212343f,.0211384f,.0210426f,.0209468f,.020851f,.0207551f,.0206593f,.0205635f,.0204674f,.0203716f,.0202758f,.02018f,.0200841f,.0199883f,.0198925f,.0197967f,.0197006f,.0196048f,.0195089f,.0194131f,.0193173f,.0192215f,.0191256f,.0190298f,.0189337f,.0188379f,.0187421f,.0186463f,.0185504f,.0184546f,.0183588f,.018263f,.0181669f,.0180711f,.0179752f,.0178794f,.0177836f,.0176877f,.0175919f,.0174961f,.0174f,.0173042f,.0172084f,.0171125f,.0170167f,.0169209f,.016825f,.0167292f,.0166331f,.0165373f,.0164415f,.0163456f,.0162498f,.016154f,.0160581f,.0159623f,.0158665f,.0157704f,.0156746f,.0155787f,.0154829f,.0153871f,.0152912f,.0151954f,.0150996f,.0150035f,.0149077f,.0148118f,.014716f,.0146202f,.0145243f,.0144285f,.0143327f,.0142366f,.0141408f,.0140449f,.0139491f,.0138533f,.0137574f,.0136616f,.0135658f,.0134697f,.0133738f,.013278f,.0131822f,.0130863f,.0129905f,.0128947f,.0127988f,.0127028f,.0126069f,.0125111f,.0124152f,.0123194f,.0122236f,.0121277f,.0120319f,.0119358f,.01184f,.0117441f,.0116483f,.0115525f,.0114566f,.0113608f,.011265f,.0111689f,.011073f,.0109772f,.0108814f,.0107855f,.0106897f,.0105938f,.010498f,.0104019f,.0103061f,.0102102f,.0101144f,.0100186f,.00992273f,.00982689f,.00973105f,.00963497f,.00953913f,.00944329f,.00934745f,.00925161f,.00915577f,.00905993f,.00896409f,.00886801f,.00877217f,.00867633f,.00858049f,.00848465f,.00838881f,.00829297f,.00819713f,.00810105f,.00800521f,.00790937f,.00781353f,.00771768f,.00762184f,.007526f,.00743016f,.00733408f,.00723824f,.0071424f,.00704655f,.00695071f,.00685487f,.00675903f,.00666319f,.00656711f,.00647126f,.00637542f,.00627958f,.00618374f,.00608789f,.00599205f,.00589621f,.00580013f,.00570428f,.00560844f,.0055126f,.00541676f,.00532091f,.00522507f,.00512923f,.00503338f,.0049373f,.00484146f,.00474562f,.00464977f,.00455393f,.00445809f,.00436224f,.0042664f,.00417032f,.00407447f,.00397863f,.00388279f,.00378694f,.0036911f,.00359526f,.00349941f,.00340333f,.00330749f,.00321164f,.0031158f,.00301996f,.00292411f,.00282827f,.00273242f,.00263634f,.0025405f,.00244465f,.00234881f,.00225297f,.00215712f,.00206128f,.00196543f,.00186935f,.00177351f,.00167766f,.00158182f,.00148597f,.00139013f,.00129429f,.00119844f,.00110236f,.00100652f,.000910671f,.000814827f,.000718983f,.000623139f,.000527294f,.00043145f,.000335368f,.000239523f,.000143679f,4.78347e-05f,0.f,-.000143854f,-.000239698f,-.000335542f,-.000431625f,-.000527469f,-.000623314f,-.000719158f,-.000815002f,-.000910846f,-.00100669f,-.00110253f,-.00119862f,-.00129446f,-.00139031f,-.00148615f,-.00158199f,-.00167784f,-.00177368f,-.00186953f,-.00196561f,-.00206145f,-.0021573f,-.00225314f,-.00234899f,-.00244483f,-.00254067f,-.00263652f,-.0027326f,-.00282844f,-.00292429f,-.00302013f,-.00311597f,-.00321182f,-.00330766f,-.00340351f,-.00349959f,-.00359543f,-.00369128f,-.00378712f,-.00388296f,-.00397881f,-.00407465f,-.00417049f,-.00426657f,-.00436242f,-.00445826f,-.0045541f,-.00464995f,-.00474579f,-.00484163f,-.00493748f,-.00503356f,-.0051294f,-.00522525f,-.00532109f,-.00541693f,-.00551277f,-.00560862f,-.00570446f,-.0058003f,-.00589638f,-.00599223f,-.00608807f,-.00618391f,-.00627975f,-.0063756f,-.00647144f,-.00656728f,-.00666336f,-.0067592f,-.00685504f,-.00695089f,-.00704673f,-.00714257f,-.00723841f,-.00733425f,-.00743033f,-.00752618f,-.00762202f,-.00771786f,-.0078137f,-.00790954f,-.00800538f,-.00810122f,-.0081973f,-.00829314f,-.00838898f,-.00848483f,-.00858067f,-.00867651f,-.00877235f,-.00886819f,-.00896427f,-.00906011f,-.00915595f,-.00925179f,-.00934763f,-.00944347f,-.00953931f,-.00963515f,-.00973123f,-.00982707f,-.00992291f,-.0100187f,-.0101146f,-.0102104f,-.0103063f,-.0104021f,-.0104982f,-.010594f,-.0106899f,-.0107857f,-.0108815f,-.0109774f,-.0110732f,-.0111691f,-.0112651f,-.011361f,-.0114568f,-.0115526f,-.0116485f,-.0117443f,-.0118402f,-.011936f,-.0120321f,-.0121279f,-.0122237f,-.0123196f,-.0124154f,-.0125113f,-.0126071f,-.0127029f,-.012799f,-.0128948f,-.0129907f,-.0130865f,-.0131823f,-.0132782f,-.013374f,-.0134699f,-.0135659f,-.0136618f,-.0137576f,-.0138534f,-.0139493f,-.0140451f,-.0141409f,-.0142368f,-.0143328f,-.0144287f,-.0145245f,-.0146203f,-.0147162f,-.014812f,-.0149078f,-.0150037f,-.0150998f,-.0151956f,-.0152914f,-.0153873f,-.0154831f,-.0155789f,-.0156748f,-.0157706f,-.0158667f,-.0159625f,-.0160583f,-.0161542f,-.01625f,-.0163458f,-.0164416f,-.0165375f,-.0166333f,-.0167294f,-.0168252f,-.016921f,-.0170169f,-.0171127f,-.0172085f,-.0173044f,-.0174002f,-.0174963f,-.0175921f,-.0176879f,-.0177837f,-.0178796f,-.0179754f,-.0180712f,-.0181671f,-.0182631f,-.018359f,-.0184548f,-.0185506f,-.0186464f,-.0187423f,-.0188381f,-.0189339f,-.01903f,-.0191258f,-.0192216f,-.0193175f,-.0194133f,-.0195091f,-.0196049f,-.0197008f,-.0197968f,-.0198927f,-.0199885f,-.0200843f,-.0201801f,-.020276f,-.0203718f,-.0204676f,-.0205637f,-.0206595f,-.0207553f,-.0208511f,-.020947f,-.0210428f,-.0211386f,-.0212344f,-.0213305f,-.0214263f,-.0215221f,-.021618f,-.0217138f,-.0218096f,-.0219054f,-.0220012f,-.0220973f,-.0221931f,-.0222889f,-.0223848f,-.0224806f,-.0225764f,-.0226722f,-.022768f,-.0228641f,-.0229599f,-.0230557f,-.0231516f,-.0232474f,-.0233432f,-.023439f,-.0235348f,-.0236309f,-.0237267f,-.0238225f,-.0239183f,-.0240142f,-.02411f,-.0242058f,-.0243016f,-.0243977f,-.0244935f,-.0245893f,-.0246851f,-.0247809f,-.0248767f,-.0249726f,-.0250684f,-.0251644f,-.0252602f,-.025356f,-.0254519f,-.0255477f,-.0256435f,-.0257393f,-.0258351f,-.0259312f,-.026027f,-.0261228f,-.0262186f,-.0263144f,-.0264102f,-.026506f,-.0266018f,-.0266977f,-.0267937f,-.0268895f,-.0269853f,-.0270811f,-.0271769f,-.0272727f,-.0273686f,-.0274644f,-.0275604f,-.0276562f,-.027752f,-.0278478f,-.0279436f,-.0280394f,-.0281352f,-.0282311f,-.0283271f,-.0284229f,-.0285187f,-.0286145f,-.0287103f,-.0288061f,-.0289019f,-.0289977f,-.0290938f,-.0291896f,-.0292854f,-.0293812f,-.029477f,-.0295728f,-.0296686f,-.0297644f,-.0298604f,-.0299562f,-.030052f,-.0301478f,-.0302436f,-.0303394f,-.0304352f,-.030531f,-.0306271f,-.0307229f,-.0308187f,-.0309145f,-.0310103f,-.0311061f,-.0312019f,-.0312977f,-.0313937f,-.0314895f,-.0315853f,-.0316811f,-.0317769f,-.0318727f,-.0319685f,-.0320643f,-.0321603f,-.0322561f,-.0323519f,-.0324477f,-.0325435f,-.0326393f,-.0327351f,-.0328309f,-.0329269f,-.0330227f,-.0331185f,-.0332143f,-.0333101f,-.0334059f,-.0335016f,-.0335974f,-.0336935f,-.0337893f,-.033885f,-.0339808f,-.0340766f,-.0341724f,-.0342682f,-.034364f,-.03446f,-.0345558f,-.0346516f,-.0347474f,-.0348432f,-.0349389f,-.0350347f,-.0351305f,-.0352265f,-.0353223f,-.0354181f,-.0355139f,-.0356097f,-.0357055f,-.0358012f,-.035897f,-.035993f,-.0360888f,-.0361846f,-.0362804f,-.0363762f,-.0364719f,-.0365677f,-.0366635f,-.0367595f,-.0368553f,-.0369511f,-.0370469f,-.0371426f,-.0372384f,-.0373342f,-.03743f,-.0375258f,-.0376218f,-.0377175f,-.0378133f,-.0379091f,-.0380049f,-.0381006f,-.0381964f,-.0382922f,-.0383882f,-.038484f,-.0385798f,-.0386755f,-.0387713f,-.0388671f,-.0389628f,-.0390586f,-.0391546f,-.0392504f,-.0393462f,-.0394419f,-.0395377f,-.0396335f,-.0397292f,-.039825f,-.039921f,-.0400168f,-.0401125f,-.0402083f,-.0403041f,-.0403998f,-.0404956f,-.0405914f,-.0406874f,-.0407831f,-.0408789f,-.0409747f,-.0410704f,-.0411662f,-.041262f,-.0413577f,-.0414537f,-.0415495f,-.0416453f,-.041741f,-.0418368f,-.0419325f,-.0420283f,-.0421241f,-.04222f,-.0423158f,-.0424116f,-.0425073f,-.0426031f,-.0426988f,-.0427946f,-.0428904f,-.0429863f,-.0430821f,-.0431779f,-.0432736f,-.0433694f,-.0434651f,-.0435609f,-.0436566f,-.0437526f,-.0438484f,-.0439441f,-.0440399f,-.0441356f,-.0442314f,-.0443271f,-.0444229f,-.0445189f,-.0446146f,-.0447104f,-.0448061f,-.0449019f,-.0449976f,-.0450933f,-.0451891f,-.0452851f,-.0453808f,-.0454766f,-.0455723f,-.0456681f,-.0457638f,-.0458595f,-.0459553f,-.0460513f,-.046147f,-.0462428f,-.0463385f,-.0464342f,-.04653f,-.0466257f,-.0467215f,-.0468174f,-.0469132f,-.0470089f,-.0471047f,-.0472004f,-.0472961f,-.0473919f,-.0474876f,-.0475836f,-.0476793f,-.047775f,-.0478708f,-.0479665f,-.0480622f,-.048158f,-.0482537f,-.0483494f,-.0484454f,-.0485411f,-.0486369f,-.0487326f,-.0488283f,-.0489241f,-.0490198f,-.0491155f,-.0492115f,-.0493072f,-.0494029f,-.0494987f,-.0495944f,-.0496901f,-.0497859f,-.0498816f,-.0499775f,-.0500733f,-.050169f,-.0502647f,-.0503604f,-.0504562f,-.0505519f,-.0506476f,-.0507436f,-.0508393f,-.050935f,-.0510307f,-.0511264f,-.0512222f,-.0513179f,-.0514136f,-.0515096f,-.0516053f,-.051701f,-.0517967f,-.0518924f,-.0519881f,-.0520838f,-.0521796f,-.0522755f,-.0523712f,-.0524669f,-.0525626f,-.0526584f,-.0527541f,-.0528498f,-.0529455f,-.0530414f,-.0531371f,-.0532329f,-.0533286f,-.0534243f,-.05352f,-.0536157f,-.0537114f,-.0538073f,-.053903f,-.0539987f,-.0540944f,-.0541902f,-.0542859f,-.0543816f,-.0544773f,-.0545732f,-.0546689f,-.0547646f,-.0548603f,-.054956f,-.0550517f,-.0551474f,-.0552431f,-.055339f,-.0554347f,-.0555304f,-.0556261f,-.0557218f,-.0558175f,-.0559132f,-.0560089f,-.0561048f,-.0562005f,-.0562962f,-.0563919f,-.0564876f,-.0565833f,-.056679f,-.0567747f,-.0568706f,-.0569663f,-.057062f,-.0571577f,-.0572534f,-.057349f,-.0574447f,-.0575404f,-.0576363f,-.057732f,-.0578277f,-.0579234f,-.0580191f,-.0581148f,-.0582104f,-.0583061f,-.0584018f,-.0584977f,-.0585934f,-.0586891f,-.0587848f,-.0588804f,-.0589761f,-.0590718f,-.0591675f,-.0592634f,-.0593591f,-.0594547f,-.0595504f,-.0596461f,-.0597418f,-.0598374f,-.0599331f,-.060029f,-.0601247f,-.0602203f,-.060316f,-.0604117f,-.0605074f,-.060603f,-.0606987f,-.0607946f,-.0608903f,-.0609859f,-.0610816f,-.0611773f,-.0612729f,-.0613686f,-.0614643f,-.0615602f,-.0616558f,-.0617515f,-.0618471f,-.0619428f,-.0620385f,-.0621341f,-.0622298f,-.0623257f,-.0624213f,-.062517f,-.0626126f,-.0627083f,-.062804f,-.0628996f,-.0629953f,-.0630912f,-.0631868f,-.0632825f,-.0633781f,-.0634738f,-.0635694f,-.0636651f,-.0637607f,-.0638566f,-.0639523f,-.0640479f,-.0641435f,-.0642392f,-.0643348f,-.0644305f,-.0645261f,-.064622f,-.0647177f,-.0648133f,-.0649089f,-.0650046f,-.0651002f,-.0651959f,-.0652915f,-.0653874f,-.065483f,-.0655787f,-.0656743f,-.0657699f,-.0658656f,-.0659612f,-.0660568f,-.0661527f,-.0662483f,-.066344f,-.0664396f,-.0665352f,-.0666309f,-.0667265f,-.0668221f,-.066918f,-.0670136f,-.0671093f,-.0672049f,-.0673005f,-.0673961f,-.0674918f,-.0675874f,-.0676833f,-.0677789f,-.0678745f,-.0679701f,-.0680658f,-.0681614f,-.068257f,-.0683526f,-.0684485f,-.0685441f,-.0686397f,-.0687353f,-.0688309f,-.0689266f,-.0690222f,-.0691178f,-.0692134f,-.0693093f,-.0694049f,-.0695005f,-.0695961f,-.0696917f,-.0697873f,-.0698829f,-.0699785f,-.0700744f,-.07017f,-.0702656f,-.0703612f,-.0704568f,-.0705524f,-.070648f,-.0707436f,-.0708395f,-.0709351f,-.0710307f,-.0711263f,-.0712219f,-.0713175f,-.0714131f,-.0715087f,-.0716045f,-.0717001f,-.0717957f,-.0718913f,-.0719869f,-.0720825f,-.0721781f,-.0722737f,-.0723695f,-.0724651f,-.0725607f,-.0726563f,-.0727519f,-.0728475f,-.0729431f,-.0730387f,-.0731345f,-.0732301f,-.0733257f,-.0734212f,-.0735168f,-.0736124f,-.073708f,-.0738036f,-.0738994f,-.073995f,-.0740906f,-.0741861f,-.0742817f,-.0743773f,-.0744729f,-.0745685f,-.0746643f,-.0747598f,-.0748554f,-.074951f,-.0750466f,-.0751422f,-.0752377f,-.0753333f,-.0754291f,-.0755247f,-.0756202f,-.0757158f,-.0758114f,-.075907f,-.0760025f,-.0760981f,-.0761939f,-.0762895f,-.076385f,-.0764806f,-.0765761f,-.0766717f,-.0767673f,-.0768628f,-.0769586f,-.0770542f,-.0771497f,-.0772453f,-.0773409f,-.0774364f,-.077532f,-.0776275f,-.0777233f,-.0778189f,-.0779144f,-.07801f,-.0781055f,-.0782011f,-.0782966f,-.0783922f,-.078488f,-.0785835f,-.0786791f,-.0787746f,-.0788702f,-.0789657f,-.0790613f,-.0791568f,-.0792526f,-.0793481f,-.0794437f,-.0795392f,-.0796347f,-.0797303f,-.0798258f,-.0799214f,-.0800169f,-.0801127f,-.0802082f,-.0803037f,-.0803993f,-.0804948f,-.0805903f,-.0806859f,-.0807814f,-.0808772f,-.0809727f,-.0810682f,-.0811638f,-.0812593f,-.0813548f,-.0814503f,-.0815459f,-.0816416f,-.0817372f,-.0818327f,-.0819282f,-.0820237f,-.0821192f,-.0822148f,-.0823103f,-.082406f,-.0825016f,-.0825971f,-.0826926f,-.0827881f,-.0828836f,-.0829791f,-.0830747f,-.0831704f,-.0832659f,-.0833614f,-.0834569f,-.0835524f,-.083648f,-.0837435f,-.083839f,-.0839347f,-.0840302f,-.0841257f,-.0842212f,-.0843167f,-.0844122f,-.0845077f,-.0846032f,-.084699f,-.0847945f,-.08489f,-.0849855f,-.085081f,-.0851765f,-.085272f,-.0853674f,-.0854632f,-.0855587f,-.0856542f,-.0857497f,-.0858452f,-.0859406f,-.0860361f,-.0861316f,-.0862273f,-.0863228f,-.0864183f,-.0865138f,-.0866093f,-.0867048f,-.0868003f,-.0868957f,-.0869915f,-.0870869f,-.0871824f,-.0872779f,-.0873734f,-.0874688f,-.0875643f,-.0876598f,-.0877555f,-.087851f,-.0879465f,-.0880419f,-.0881374f,-.0882329f,-.0883283f,-.0884238f,-.0885195f,-.088615f,-.0887105f,-.0888059f,-.0889014f,-.0889968f,-.0890923f,-.0891878f,-.0892835f,-.0893789f,-.0894744f,-.0895699f,-.0896653f,-.0897608f,-.0898562f,-.0899517f,-.0900474f,-.0901428f,-.0902383f,-.0903337f,-.0904292f,-.0905246f,-.0906201f,-.0907155f,-.090811f,-.0909067f,-.0910021f,-.0910976f,-.091193f,-.0912885f,-.0913839f,-.0914793f,-.0915748f,-.0916705f,-.0917659f,-.0918613f,-.0919568f,-.0920522f,-.0921477f,-.0922431f,-.0923385f,-.0924342f,-.0925296f,-.0926251f,-.0927205f,-.0928159f,-.0929114f,-.0930068f,-.0931022f,-.0931979f,-.0932933f,-.0933887f,-.0934842f,-.0935796f,-.093675f,-.0937704f,-.0938659f,-.0939615f,-.0940569f,-.0941524f,-.0942478f,-.0943432f,-.0944386f,-.094534f,-.0946294f,-.0947251f,-.0948205f,-.0949159f,-.0950113f,-.0951067f,-.0952021f,-.0952975f,-.095393f,-.0954886f,-.095584f,-.0956794f,-.0957748f,-.0958702f,-.0959656f,-.096061f,-.0961564f,-.0962521f,-.0963475f,-.0964429f,-.0965383f,-.0966337f,-.096729f,-.0968244f,-.0969198f,-.0970155f,-.0971109f,-.0972062f,-.0973016f,-.097397f,-.0974924f,-.0975878f,-.0976832f,-.0977788f,-.0978742f,-.0979696f,-.098065f,-.0981603f,-.0982557f,-.0983511f,-.0984465f,-.0985421f,-.0986375f,-.0987329f,-.0988282f,-.0989236f,-.099019f,-.0991143f,-.0992097f,-.0993053f,-.0994007f,-.0994961f,-.0995914f,-.0996868f,-.0997822f,-.0998775f,-.0999729f,-0.100068f,-0.100164f,-0.100259f,-0.100355f,-0.10045f,-0.100545f,-0.100641f,-0.100736f,-0.100831f,-0.100927f,-0.101022f,-0.101118f,-0.101213f,-0.101308f,-0.101404f,-0.101499f,-0.101594f,-0.10169f,-0.101785f,-0.101881f,-0.101976f,-0.102071f,-0.102167f,-0.102262f,-0.102357f,-0.102453f,-0.102548f,-0.102644f,-0.102739f,-0.102834f,-0.10293f,-0.103025f,-0.10312f,-0.103216f,-0.103311f,-0.103407f,-0.103502f,-0.103597f,-0.103693f,-0.103788f,-0.103883f,-0.103979f,-0.104074f,-0.104169f,-0.104265f,-0.10436f,-0.104455f,-0.104551f,-0.104646f,-0.104742f,-0.104837f,-0.104932f,-0.105028f,-0.105123f,-0.105218f,-0.105313f,-0.105409f,-0.105504f,-0.1056f,-0.105695f,-0.10579f,-0.105886f,-0.105981f,-0.106076f,-0.106171f,-0.106267f,-0.106362f,-0.106458f,-0.106553f,-0.106648f,-0.106744f,-0.106839f,-0.106934f,-0.10703f,-0.107125f,-0.10722f,-0.107316f,-0.107411f,-0.107506f,-0.107601f,-0.107697f,-0.107792f,-0.107887f,-0.107983f,-0.108078f,-0.108173f,-0.108269f,-0.108364f,-0.108459f,-0.108555f,-0.10865f,-0.108745f,-0.108841f,-0.108936f,-0.109031f,-0.109126f,-0.109222f,-0.109317f,-0.109412f,-0.109508f,-0.109603f,-0.109698f,-0.109793f,-0.109889f,-0.109984f,-0.110079f,-0.110175f,-0.11027f,-0.110365f,-0.110461f,-0.110556f,-0.110651f,-0.110746f,-0.110842f,-0.110937f,-0.111032f,-0.111128f,-0.111223f,-0.111318f,-0.111413f,-0.111509f,-0.111604f,-0.111699f,-0.111795f,-0.11189f,-0.111985f,-0.11208f,-0.112175f,-0.112271f,-0.112366f,-0.112461f,-0.112557f,-0.112652f,-0.112747f,-0.112842f,-0.112938f,-0.113033f,-0.113128f,-0.113224f,-0.113319f,-0.113414f,-0.113509f,-0.113604f,-0.1137f,-0.113795f,-0.11389f,-0.113986f,-0.114081f,-0.114176f,-0.114271f,-0.114366f,-0.114462f,-0.114557f,-0.114652f,-0.114747f,-0.114843f,-0.114938f,-0.115033f,-0.115128f,-0.115224f,-0.115319f,-0.115414f,-0.115509f,-0.115605f,-0.1157f,-0.115795f,-0.11589f,-0.115985f,-0.116081f,-0.116176f,-0.116271f,-0.116366f,-0.116462f,-0.116557f,-0.116652f,-0.116747f,-0.116842f,-0.116938f,-0.117033f,-0.117128f,-0.117223f,-0.117319f,-0.117414f,-0.117509f,-0.117604f,-0.117699f,-0.117795f,-0.11789f,-0.117985f,-0.11808f,-0.118175f,-0.118271f,-0.118366f,-0.118461f,-0.118556f,-0.118651f,-0.118747f,-0.118842f,-0.118937f,-0.119032f,-0.119127f,-0.119222f,-0.119318f,-0.119413f,-0.119508f,-0.119603f,-0.119698f,-0.119794f,-0.119889f,-0.119984f,-0.120079f,-0.120174f,-0.12027f,-0.120365f,-0.12046f,-0.120555f,-0.12065f,-0.120745f,-0.120841f,-0.120936f,-0.121031f,-0.121126f,-0.121221f,-0.121316f,-0.121412f,-0.121507f,-0.121602f,-0.121697f,-0.121792f,-0.121887f,-0.121983f,-0.122078f,-0.122173f,-0.122268f,-0.122363f,-0.122458f,-0.122554f,-0.122649f,-0.122744f,-0.122839f,-0.122934f,-0.123029f,-0.123124f,-0.12322f,-0.123315f,-0.12341f,-0.123505f,-0.1236f,-0.123695f,-0.12379f,-0.123885f,-0.123981f,-0.124076f,-0.124171f,-0.124266f,-0.124361f,-0.124456f,-0.124551f,-0.124646f,-0.124742f,-0.124837f,-0.124932f,-0.125027f,-0.125122f,-0.125217f,-0.125312f,-0.125407f,-0.125503f,-0.125598f,-0.125693f,-0.125788f,-0.125883f,-0.125978f,-0.126073f,-0.126168f,-0.126264f,-0.126359f,-0.126454f,-0.126549f,-0.126644f,-0.126739f,-0.126834f,-0.126929f,-0.127024f,-0.12712f,-0.127215f,-0.12731f,-0.127405f,-0.1275f,-0.127595f,-0.12769f,-0.127785f,-0.12788f,-0.127975f,-0.12807f,-0.128165f,-0.12826f,-0.128356f,-0.128451f,-0.128546f,-0.128641f,-0.128736f,-0.128831f,-0.128926f,-0.129021f,-0.129116f,-0.129211f,-0.129306f,-0.129401f,-0.129497f,-0.129592f,-0.129687f,-0.129782f,-0.129877f,-0.129972f,-0.130067f,-0.130162f,-0.130257f,-0.130352f,-0.130447f,-0.130542f,-0.130637f,-0.130732f,-0.130827f,-0.130922f,-0.131017f,-0.131112f,-0.131207f,-0.131302f,-0.131398f,-0.131493f,-0.131588f,-0.131683f,-0.131778f,-0.131873f,-0.131968f,-0.132063f,-0.132158f,-0.132253f,-0.132348f,-0.132443f,-0.132538f,-0.132633f,-0.132728f,-0.132823f,-0.132918f,-0.133013f,-0.133108f,-0.133203f,-0.133298f,-0.133393f,-0.133488f,-0.133583f,-0.133678f,-0.133773f,-0.133868f,-0.133963f,-0.134058f,-0.134153f,-0.134248f,-0.134343f,-0.134438f,-0.134533f,-0.134628f,-0.134723f,-0.134818f,-0.134913f,-0.135008f,-0.135103f,-0.135198f,-0.135293f,-0.135388f,-0.135483f,-0.135578f,-0.135673f,-0.135768f,-0.135863f,-0.135958f,-0.136053f,-0.136148f,-0.136243f,-0.136338f,-0.136433f,-0.136528f,-0.136623f,-0.136718f,-0.136813f,-0.136908f,-0.137003f,-0.137098f,-0.137193f,-0.137288f,-0.137383f,-0.137478f,-0.137573f,-0.137668f,-0.137763f,-0.137858f,-0.137953f,-0.138048f,-0.138142f,-0.138237f,-0.138332f,-0.138427f,-0.138522f,-0.138617f,-0.138712f,-0.138807f,-0.138902f,-0.138997f,-0.139092f,-0.139187f,-0.139282f,-0.139377f,-0.139472f,-0.139567f,-0.139662f,-0.139756f,-0.139851f,-0.139946f,-0.140041f,-0.140136f,-0.140231f,-0.140326f,-0.140421f,-0.140516f,-0.140611f,-0.140706f,-0.140801f,-0.140896f,-0.140991f,-0.141085f,-0.14118f,-0.141275f,-0.14137f,-0.141465f,-0.14156f,-0.141655f,-0.14175f,-0.141845f,-0.14194f,-0.142035f,-0.142129f,-0.142224f,-0.142319f,-0.142414f,-0.142509f,-0.142604f,-0.142699f,-0.142794f,-0.142889f,-0.142983f,-0.143078f,-0.143173f,-0.143268f,-0.143363f,-0.143458f,-0.143553f,-0.143648f,-0.143742f,-0.143837f,-0.143932f,-0.144027f,-0.144122f,-0.144217f,-0.144312f,-0.144407f,-0.144501f,-0.144596f,-0.144691f,-0.144786f,-0.144881f,-0.144976f,-0.145071f,-0.145166f,-0.14526f,-0.145355f,-0.14545f,-0.145545f,-0.14564f,-0.145735f,-0.14583f,-0.145924f,-0.146019f,-0.146114f,-0.146209f,-0.146304f,-0.146399f,-0.146493f,-0.146588f,-0.146683f,-0.146778f,-0.146873f,-0.146968f,-0.147063f,-0.147157f,-0.147252f,-0.147347f,-0.147442f,-0.147537f,-0.147631f,-0.147726f,-0.147821f,-0.147916f,-0.148011f,-0.148106f,-0.1482f,-0.148295f,-0.14839f,-0.148485f,-0.14858f,-0.148674f,-0.148769f,-0.148864f,-0.148959f,-0.149054f,-0.149148f,-0.149243f,-0.149338f,-0.149433f,-0.149528f,-0.149622f,-0.149717f,-0.149812f,-0.149907f,-0.150002f,-0.150096f,-0.150191f,-0.150286f,-0.150381f,-0.150475f,-0.15057f,-0.150665f,-0.15076f,-0.150855f,-0.150949f,-0.151044f,-0.151139f,-0.151234f,-0.151328f,-0.151423f,-0.151518f,-0.151613f,-0.151708f,-0.151802f,-0.151897f,-0.151992f,-0.152087f,-0.152181f,-0.152276f,-0.152371f,-0.152466f,-0.15256f,-0.152655f,-0.15275f,-0.152845f,-0.152939f,-0.153034f,-0.153129f,-0.153224f,-0.153318f,-0.153413f,-0.153508f,-0.153603f,-0.153697f,-0.153792f,-0.153887f,-0.153982f,-0.154076f,-0.154171f,-0.154266f,-0.15436f,-0.154455f,-0.15455f,-0.154645f,-0.154739f,-0.154834f,-0.154929f,-0.155023f,-0.155118f,-0.155213f,-0.155307f,-0.155402f,-0.155497f,-0.155592f,-0.155686f,-0.155781f,-0.155876f,-0.15597f,-0.156065f,-0.15616f,-0.156255f,-0.156349f,-0.156444f,-0.156539f,-0.156633f,-0.156728f,-0.156823f,-0.156918f,-0.157012f,-0.157107f,-0.157202f,-0.157296f,-0.157391f,-0.157485f,-0.15758f,-0.157675f,-0.15777f,-0.157864f,-0.157959f,-0.158054f,-0.158148f,-0.158243f,-0.158338f,-0.158432f,-0.158527f,-0.158622f,-0.158716f,-0.158811f,-0.158906f,-0.159f,-0.159095f,-0.15919f,-0.159284f,-0.159379f,-0.159473f,-0.159568f,-0.159663f,-0.159757f,-0.159852f,-0.159947f,-0.160041f,-0.160136f,-0.160231f,-0.160325f,-0.16042f,-0.160514f,-0.160609f,-0.160704f,-0.160798f,-0.160893f,-0.160988f,-0.161082f,-0.161177f,-0.161271f,-0.161366f,-0.161461f,-0.161555f,-0.16165f,-0.161745f,-0.161839f,-0.161934f,-0.162028f,-0.162123f,-0.162218f,-0.162312f,-0.162407f,-0.162501f,-0.162596f,-0.162691f,-0.162785f,-0.16288f,-0.162975f,-0.163069f,-0.163164f,-0.163258f,-0.163353f,-0.163447f,-0.163542f,-0.163636f,-0.163731f,-0.163826f,-0.16392f,-0.164015f,-0.164109f,-0.164204f,-0.164298f,-0.164393f,-0.164488f,-0.164582f,-0.164677f,-0.164771f,-0.164866f,-0.16496f,-0.165055f,-0.16515f,-0.165244f,-0.165339f,-0.165433f,-0.165528f,-0.165622f,-0.165717f,-0.165811f,-0.165906f,-0.166f,-0.166095f,-0.16619f,-0.166284f,-0.166379f,-0.166473f,-0.166568f,-0.166662f,-0.166757f,-0.166851f,-0.166946f,-0.16704f,-0.167135f,-0.167229f,-0.167324f,-0.167418f,-0.167513f,-0.167608f,-0.167702f,-0.167797f,-0.167891f,-0.167986f,-0.16808f,-0.168175f,-0.168269f,-0.168364f,-0.168458f,-0.168553f,-0.168647f,-0.168742f,-0.168836f,-0.168931f,-0.169025f,-0.16912f,-0.169214f,-0.169309f,-0.169403f,-0.169498f,-0.169592f,-0.169687f,-0.169781f,-0.169876f,-0.16997f,-0.170065f,-0.170159f,-0.170253f,-0.170348f,-0.170442f,-0.170537f,-0.170631f,-0.170726f,-0.17082f,-0.170915f,-0.171009f,-0.171104f,-0.171198f,-0.171292f,-0.171387f,-0.171482f,-0.171576f,-0.17167f,-0.171765f,-0.171859f,-0.171954f,-0.172048f,-0.172143f,-0.172237f,-0.172332f,-0.172426f,-0.17252f,-0.172615f,-0.172709f,-0.172804f,-0.172898f,-0.172993f,-0.173087f,-0.173181f,-0.173276f,-0.17337f,-0.173465f,-0.173559f,-0.173654f,-0.173748f,-0.173842f,-0.173937f,-0.174031f,-0.174126f,-0.17422f,-0.174314f,-0.174409f,-0.174503f,-0.174598f,-0.174692f,-0.174786f,-0.174881f,-0.174975f,-0.17507f,-0.175164f,-0.175258f,-0.175353f,-0.175447f,-0.175542f,-0.175636f,-0.17573f,-0.175825f,-0.175919f,-0.176014f,-0.176108f,-0.176202f,-0.176297f,-0.176391f,-0.176485f,-0.17658f,-0.176674f,-0.176768f,-0.176863f,-0.176957f,-0.177051f,-0.177146f,-0.17724f,-0.177334f,-0.177429f,-0.177523f,-0.177618f,-0.177712f,-0.177806f,-0.177901f,-0.177995f,-0.178089f,-0.178184f,-0.178278f,-0.178372f,-0.178467f,-0.178561f,-0.178655f,-0.17875f,-0.178844f,-0.178938f,-0.179033f,-0.179127f,-0.179221f,-0.179316f,-0.17941f,-0.179504f,-0.179599f,-0.179693f,-0.179787f,-0.179882f,-0.179976f,-0.18007f,-0.180164f,-0.180259f,-0.180353f,-0.180447f,-0.180542f,-0.180636f,-0.18073f,-0.180825f,-0.180919f,-0.181013f,-0.181107f,-0.181202f,-0.181296f,-0.18139f,-0.181485f,-0.181579f,-0.181673f,-0.181767f,-0.181862f,-0.181956f,-0.18205f,-0.182145f,-0.182239f,-0.182333f,-0.182427f,-0.182522f,-0.182616f,-0.18271f,-0.182804f,-0.182899f,-0.182993f,-0.183087f,-0.183181f,-0.183276f,-0.18337f,-0.183464f,-0.183558f,-0.183653f,-0.183747f,-0.183841f,-0.183935f,-0.18403f,-0.184124f,-0.184218f,-0.184312f,-0.184407f,-0.184501f,-0.184595f,-0.184689f,-0.184783f,-0.184878f,-0.184972f,-0.185066f,-0.18516f,-0.185255f,-0.185349f,-0.185443f,-0.185537f,-0.185631f,-0.185725f,-0.18582f,-0.185914f,-0.186008f,-0.186102f,-0.186197f,-0.186291f,-0.186385f,-0.186479f,-0.186573f,-0.186668f,-0.186762f,-0.186856f,-0.18695f,-0.187044f,-0.187138f,-0.187233f,-0.187327f,-0.187421f,-0.187515f,-0.187609f,-0.187703f,-0.187798f,-0.187892f,-0.187986f,-0.18808f,-0.188174f,-0.188269f,-0.188363f,-0.188457f,-0.188551f,-0.188645f,-0.188739f,-0.188833f,-0.188928f,-0.189022f,-0.189116f,-0.18921f,-0.189304f,-0.189398f,-0.189492f,-0.189586f,-0.189681f,-0.189775f,-0.189869f,-0.189963f,-0.190057f,-0.190151f,-0.190245f,-0.190339f,-0.190434f,-0.190528f,-0.190622f,-0.190716f,-0.19081f,-0.190904f,-0.190998f,-0.191092f,-0.191187f,-0.191281f,-0.191375f,-0.191469f,-0.191563f,-0.191657f,-0.191751f,-0.191845f,-0.191939f,-0.192034f,-0.192128f,-0.192222f,-0.192316f,-0.19241f,-0.192504f,-0.192598f,-0.192692f,-0.192786f,-0.19288f,-0.192974f,-0.193068f,-0.193162f,-0.193256f,-0.19335f,-0.193445f,-0.193539f,-0.193633f,-0.193727f,-0.193821f,-0.193915f,-0.194009f,-0.194103f,-0.194197f,-0.194291f,-0.194385f,-0.194479f,-0.194573f,-0.194667f,-0.194761f,-0.194855f,-0.194949f,-0.195043f,-0.195137f,-0.195231f,-0.195325f,-0.195419f,-0.195513f,-0.195607f,-0.195701f,-0.195796f,-0.19589f,-0.195984f,-0.196078f,-0.196172f,-0.196266f,-0.19636f,-0.196454f,-0.196548f,-0.196642f,-0.196736f,-0.19683f,-0.196924f,-0.197018f,-0.197112f,-0.197206f,-0.1973f,-0.197394f,-0.197488f,-0.197582f,-0.197676f,-0.19777f,-0.197863f,-0.197957f,-0.198052f,-0.198146f,-0.19824f,-0.198333f,-0.198427f,-0.198521f,-0.198615f,-0.198709f,-0.198803f,-0.198897f,-0.198991f,-0.199085f,-0.199179f,-0.199273f,-0.199367f,-0.199461f,-0.199555f,-0.199649f,-0.199743f,-0.199837f,-0.199931f,-0.200025f,-0.200118f,-0.200212f,-0.200306f,-0.2004f,-0.200494f,-0.200588f,-0.200682f,-0.200776f,-0.20087f,-0.200964f,-0.201058f,-0.201152f,-0.201246f,-0.20134f,-0.201433f,-0.201527f,-0.201621f,-0.201715f,-0.201809f,-0.201903f,-0.201997f,-0.202091f,-0.202185f,-0.202278f,-0.202372f,-0.202466f,-0.20256f,-0.202654f,-0.202748f,-0.202842f,-0.202936f,-0.20303f,-0.203123f,-0.203217f,-0.203311f,-0.203405f,-0.203499f,-0.203593f,-0.203687f,-0.203781f,-0.203874f,-0.203968f,-0.204062f,-0.204156f,-0.20425f,-0.204344f,-0.204438f,-0.204531f,-0.204625f,-0.204719f,-0.204813f,-0.204907f,-0.205001f,-0.205094f,-0.205188f,-0.205282f,-0.205376f,-0.20547f,-0.205563f,-0.205658f,-0.205751f,-0.205845f,-0.205939f,-0.206033f,-0.206126f,-0.20622f,-0.206314f,-0.206408f,-0.206502f,-0.206596f,-0.206689f,-0.206783f,-0.206877f,-0.206971f,-0.207064f,-0.207158f,-0.207252f,-0.207346f,-0.20744f,-0.207534f,-0.207627f,-0.207721f,-0.207815f,-0.207909f,-0.208002f,-0.208096f,-0.20819f,-0.208284f,-0.208377f,-0.208471f,-0.208565f,-0.208659f,-0.208753f,-0.208846f,-0.20894f,-0.209034f,-0.209128f,-0.209221f,-0.209315f,-0.209409f,-0.209503f,-0.209596f,-0.20969f,-0.209784f,-0.209878f,-0.209971f,-0.210065f,-0.210159f,-0.210253f,-0.210346f,-0.21044f,-0.210534f,-0.210627f,-0.210721f,-0.210815f,-0.210909f,-0.211002f,-0.211096f,-0.21119f,-0.211283f,-0.211377f,-0.211471f,-0.211564f,-0.211658f,-0.211752f,-0.211846f,-0.211939f,-0.212033f,-0.212127f,-0.21222f,-0.212314f,-0.212408f,-0.212502f,-0.212595f,-0.212689f,-0.212783f,-0.212876f,-0.21297f,-0.213063f,-0.213157f,-0.213251f,-0.213345f,-0.213438f,-0.213532f,-0.213626f,-0.213719f,-0.213813f,-0.213907f,-0.214f,-0.214094f,-0.214188f,-0.214281f,-0.214375f,-0.214468f,-0.214562f,-0.214656f,-0.214749f,-0.214843f,-0.214937f,-0.21503f,-0.215124f,-0.215217f,-0.215311f,-0.215405f,-0.215498f,-0.215592f,-0.215686f,-0.215779f,-0.215873f,-0.215966f,-0.21606f,-0.216154f,-0.216247f,-0.216341f,-0.216435f,-0.216528f,-0.216622f,-0.216715f,-0.216809f,-0.216902f,-0.216996f,-0.21709f,-0.217183f,-0.217277f,-0.21737f,-0.217464f,-0.217557f,-0.217651f,-0.217745f,-0.217838f,-0.217932f,-0.218025f,-0.218119f,-0.218213f,-0.218306f,-0.2184f,-0.218493f,-0.218587f,-0.21868f,-0.218774f,-0.218867f,-0.218961f,-0.219054f,-0.219148f,-0.219242f,-0.219335f,-0.219429f,-0.219522f,-0.219616f,-0.219709f,-0.219803f,-0.219896f,-0.21999f,-0.220084f,-0.220177f,-0.22027f,-0.220364f,-0.220457f,-0.220551f,-0.220644f,-0.220738f,-0.220832f,-0.220925f,-0.221019f,-0.221112f,-0.221206f,-0.221299f,-0.221392f,-0.221486f,-0.22158f,-0.221673f,-0.221767f,-0.22186f,-0.221953f,-0.222047f,-0.22214f,-0.222234f,-0.222327f,-0.222421f,-0.222514f,-0.222608f,-0.222701f,-0.222795f,-0.222888f,-0.222982f,-0.223075f,-0.223169f,-0.223262f,-0.223355f,-0.223449f,-0.223542f,-0.223636f,-0.223729f,-0.223823f,-0.223916f,-0.22401f,-0.224103f,-0.224196f,-0.22429f,-0.224383f,-0.224477f,-0.22457f,-0.224664f,-0.224757f,-0.22485f,-0.224944f,-0.225037f,-0.225131f,-0.225224f,-0.225318f,-0.225411f,-0.225504f,-0.225598f,-0.225691f,-0.225784f,-0.225878f,-0.225971f,-0.226065f,-0.226158f,-0.226252f,-0.226345f,-0.226438f,-0.226532f,-0.226625f,-0.226718f,-0.226812f,-0.226905f,-0.226999f,-0.227092f,-0.227185f,-0.227279f,-0.227372f,-0.227465f,-0.227559f,-0.227652f,-0.227745f,-0.227839f,-0.227932f,-0.228025f,-0.228119f,-0.228212f,-0.228306f,-0.228399f,-0.228492f,-0.228586f,-0.228679f,-0.228772f,-0.228865f,-0.228959f,-0.229052f,-0.229146f,-0.229239f,-0.229332f,-0.229425f,-0.229519f,-0.229612f,-0.229705f,-0.229799f,-0.229892f,-0.229985f,-0.230079f,-0.230172f,-0.230265f,-0.230358f,-0.230452f,-0.230545f,-0.230638f,-0.230732f,-0.230825f,-0.230918f,-0.231012f,-0.231105f,-0.231198f,-0.231291f,-0.231385f,-0.231478f,-0.231571f,-0.231664f,-0.231758f,-0.231851f,-0.231944f,-0.232038f,-0.232131f,-0.232224f,-0.232317f,-0.232411f,-0.232504f,-0.232597f,-0.23269f,-0.232784f,-0.232877f,-0.23297f,-0.233063f,-0.233156f,-0.23325f,-0.233343f,-0.233436f,-0.233529f,-0.233623f,-0.233716f,-0.233809f,-0.233902f,-0.233995f,-0.234089f,-0.234182f,-0.234275f,-0.234368f,-0.234462f,-0.234555f,-0.234648f,-0.234741f,-0.234834f,-0.234927f,-0.235021f,-0.235114f,-0.235207f,-0.2353f,-0.235393f,-0.235487f,-0.23558f,-0.235673f,-0.235766f,-0.235859f,-0.235952f,-0.236046f,-0.236139f,-0.236232f,-0.236325f,-0.236418f,-0.236511f,-0.236605f,-0.236698f,-0.236791f,-0.236884f,-0.236977f,-0.23707f,-0.237163f,-0.237256f,-0.23735f,-0.237443f,-0.237536f,-0.237629f,-0.237722f,-0.237815f,-0.237908f,-0.238001f,-0.238095f,-0.238188f,-0.238281f,-0.238374f,-0.238467f,-0.23856f,-0.238653f,-0.238746f,-0.23884f,-0.238933f,-0.239026f,-0.239119f,-0.239212f,-0.239305f,-0.239398f,-0.239491f,-0.239584f,-0.239677f,-0.23977f,-0.239864f,-0.239957f,-0.24005f,-0.240143f,-0.240236f,-0.240329f,-0.240422f,-0.240515f,-0.240608f,-0.240701f,-0.240794f,-0.240887f,-0.24098f,-0.241073f,-0.241166f,-0.241259f,-0.241352f,-0.241445f,-0.241538f,-0.241631f,-0.241724f,-0.241818f,-0.241911f,-0.242004f,-0.242097f,-0.24219f,-0.242283f,-0.242376f,-0.242469f,-0.242562f,-0.242655f,-0.242748f,-0.242841f,-0.242934f,-0.243027f,-0.24312f,-0.243213f,-0.243306f,-0.243399f,-0.243492f,-0.243585f,-0.243678f,-0.243771f,-0.243864f,-0.243957f,-0.24405f,-0.244143f,-0.244236f,-0.244329f,-0.244422f,-0.244514f,-0.244607f,-0.2447f,-0.244793f,-0.244886f,-0.244979f,-0.245072f,-0.245165f,-0.245258f,-0.245351f,-0.245444f,-0.245537f,-0.24563f,-0.245723f,-0.245816f,-0.245909f,-0.246002f,-0.246094f,-0.246187f,-0.24628f,-0.246373f,-0.246466f,-0.246559f,-0.246652f,-0.246745f,-0.246838f,-0.246931f,-0.247024f,-0.247117f,-0.24721f,-0.247302f,-0.247395f,-0.247488f,-0.247581f,-0.247674f,-0.247767f,-0.24786f,-0.247953f,-0.248045f,-0.248138f,-0.248231f,-0.248324f,-0.248417f,-0.24851f,-0.248603f,-0.248696f,-0.248788f,-0.248881f,-0.248974f,-0.249067f,-0.24916f,-0.249253f,-0.249346f,-0.249438f,-0.249531f,-0.249624f,-0.249717f,-0.24981f,-0.249902f,-0.249995f,-0.250088f,-0.250181f,-0.250274f,-0.250367f,-0.250459f,-0.250552f,-0.250645f,-0.250738f,-0.250831f,-0.250924f,-0.251016f,-0.251109f,-0.251202f,-0.251295f,-0.251388f,-0.25148f,-0.251573f,-0.251666f,-0.251759f,-0.251852f,-0.251944f,-0.252037f,-0.25213f,-0.252223f,-0.252316f,-0.252408f,-0.252501f,-0.252594f,-0.252686f,-0.252779f,-0.252872f,-0.252965f,-0.253058f,-0.25315f,-0.253243f,-0.253336f,-0.253428f,-0.253521f,-0.253614f,-0.253707f,-0.2538f,-0.253892f,-0.253985f,-0.254078f,-0.25417f,-0.254263f,-0.254356f,-0.254448f,-0.254541f,-0.254634f,-0.254727f,-0.254819f,-0.254912f,-0.255005f,-0.255097f,-0.25519f,-0.255283f,-0.255376f,-0.255468f,-0.255561f,-0.255654f,-0.255746f,-0.255839f,-0.255932f,-0.256025f,-0.256117f,-0.25621f,-0.256302f,-0.256395f,-0.256488f,-0.25658f,-0.256673f,-0.256766f,-0.256858f,-0.256951f,-0.257044f,-0.257136f,-0.257229f,-0.257322f,-0.257414f,-0.257507f,-0.2576f,-0.257692f,-0.257785f,-0.257877f,-0.25797f,-0.258063f,-0.258155f,-0.258248f,-0.258341f,-0.258433f,-0.258526f,-0.258618f,-0.258711f,-0.258804f,-0.258896f,-0.258989f,-0.259082f,-0.259174f,-0.259267f,-0.259359f,-0.259452f,-0.259544f,-0.259637f,-0.25973f,-0.259822f,-0.259915f,-0.260007f,-0.2601f,-0.260193f,-0.260285f,-0.260378f,-0.26047f,-0.260563f,-0.260655f,-0.260748f,-0.260841f,-0.260933f,-0.261026f,-0.261118f,-0.261211f,-0.261303f,-0.261396f,-0.261488f,-0.261581f,-0.261673f,-0.261766f,-0.261858f,-0.261951f,-0.262044f,-0.262136f,-0.262229f,-0.262321f,-0.262414f,-0.262506f,-0.262599f,-0.262691f,-0.262784f,-0.262876f,-0.262969f,-0.263061f,-0.263154f,-0.263246f,-0.263339f,-0.263431f,-0.263524f,-0.263616f,-0.263709f,-0.263801f,-0.263893f,-0.263986f,-0.264078f,-0.264171f,-0.264263f,-0.264356f,-0.264448f,-0.264541f,-0.264633f,-0.264726f,-0.264818f,-0.26491f,-0.265003f,-0.265096f,-0.265188f,-0.26528f,-0.265373f,-0.265465f,-0.265558f,-0.26565f,-0.265743f,-0.265835f,-0.265927f,-0.26602f,-0.266112f,-0.266205f,-0.266297f,-0.266389f,-0.266482f,-0.266574f,-0.266667f,-0.266759f,-0.266851f,-0.266944f,-0.267036f,-0.267129f,-0.267221f,-0.267313f,-0.267406f,-0.267498f,-0.267591f,-0.267683f,-0.267775f,-0.267868f,-0.26796f,-0.268052f,-0.268145f,-0.268237f,-0.26833f,-0.268422f,-0.268514f,-0.268606f,-0.268699f,-0.268791f,-0.268884f,-0.268976f,-0.269068f,-0.269161f,-0.269253f,-0.269345f,-0.269437f,-0.26953f,-0.269622f,-0.269715f,-0.269807f,-0.269899f,-0.269991f,-0.270084f,-0.270176f,-0.270269f,-0.270361f,-0.270453f,-0.270545f,-0.270638f,-0.27073f,-0.270822f,-0.270914f,-0.271007f,-0.271099f,-0.271191f,-0.271284f,-0.271376f,-0.271468f,-0.27156f,-0.271653f,-0.271745f,-0.271837f,-0.27193f,-0.272022f,-0.272114f,-0.272206f,-0.272299f,-0.272391f,-0.272483f,-0.272575f,-0.272668f,-0.27276f,-0.272852f,-0.272944f,-0.273036f,-0.273129f,-0.273221f,-0.273313f,-0.273405f,-0.273498f,-0.27359f,-0.273682f,-0.273774f,-0.273866f,-0.273959f,-0.274051f,-0.274143f,-0.274235f,-0.274327f,-0.27442f,-0.274512f,-0.274604f,-0.274696f,-0.274789f,-0.274881f,-0.274973f,-0.275065f,-0.275157f,-0.275249f,-0.275341f,-0.275434f,-0.275526f,-0.275618f,-0.27571f,-0.275802f,-0.275894f,-0.275987f,-0.276079f,-0.276171f,-0.276263f,-0.276355f,-0.276447f,-0.276539f,-0.276632f,-0.276724f,-0.276816f,-0.276908f,-0.277f,-0.277092f,-0.277184f,-0.277276f,-0.277369f,-0.277461f,-0.277553f,-0.277645f,-0.277737f,-0.277829f,-0.277921f,-0.278013f,-0.278105f,-0.278197f,-0.278289f,-0.278382f,-0.278474f,-0.278566f,-0.278658f,-0.27875f,-0.278842f,-0.278934f,-0.279026f,-0.279118f,-0.27921f,-0.279302f,-0.279394f,-0.279486f,-0.279579f,-0.279671f,-0.279763f,-0.279855f,-0.279947f,-0.280039f,-0.280131f,-0.280223f,-0.280315f,-0.280407f,-0.280499f,-0.280591f,-0.280683f,-0.280775f,-0.280867f,-0.280959f,-0.281051f,-0.281143f,-0.281235f,-0.281327f,-0.281419f,-0.281511f,-0.281603f,-0.281695f,-0.281787f,-0.281879f,-0.281971f,-0.282063f,-0.282155f,-0.282247f,-0.282339f,-0.282431f,-0.282523f,-0.282615f,-0.282707f,-0.282799f,-0.282891f,-0.282983f,-0.283075f,-0.283167f,-0.283258f,-0.28335f,-0.283442f,-0.283534f,-0.283626f,-0.283718f,-0.28381f,-0.283902f,-0.283994f,-0.284086f,-0.284178f,-0.28427f,-0.284362f,-0.284454f,-0.284546f,-0.284637f,-0.284729f,-0.284821f,-0.284913f,-0.285005f,-0.285097f,-0.285189f,-0.285281f,-0.285373f,-0.285464f,-0.285556f,-0.285648f,-0.28574f,-0.285832f,-0.285924f,-0.286016f,-0.286108f,-0.286199f,-0.286291f,-0.286383f,-0.286475f,-0.286567f,-0.286659f,-0.286751f,-0.286842f,-0.286934f,-0.287026f,-0.287118f,-0.28721f,-0.287302f,-0.287394f,-0.287485f,-0.287577f,-0.287669f,-0.287761f,-0.287853f,-0.287944f,-0.288036f,-0.288128f,-0.28822f,-0.288312f,-0.288403f,-0.288495f,-0.288587f,-0.288679f,-0.28877f,-0.288862f,-0.288954f,-0.289046f,-0.289138f,-0.289229f,-0.289321f,-0.289413f,-0.289505f,-0.289597f,-0.289688f,-0.28978f,-0.289872f,-0.289964f,-0.290055f,-0.290147f,-0.290239f,-0.290331f,-0.290422f,-0.290514f,-0.290606f,-0.290698f,-0.290789f,-0.290881f,-0.290973f,-0.291065f,-0.291156f,-0.291248f,-0.29134f,-0.291431f,-0.291523f,-0.291615f,-0.291706f,-0.291798f,-0.29189f,-0.291982f,-0.292073f,-0.292165f,-0.292257f,-0.292348f,-0.29244f,-0.292532f,-0.292623f,-0.292715f,-0.292807f,-0.292898f,-0.29299f,-0.293082f,-0.293173f,-0.293265f,-0.293357f,-0.293448f,-0.29354f,-0.293632f,-0.293723f,-0.293815f,-0.293907f,-0.293998f,-0.29409f,-0.294182f,-0.294273f,-0.294365f,-0.294456f,-0.294548f,-0.29464f,-0.294731f,-0.294823f,-0.294915f,-0.295006f,-0.295098f,-0.295189f,-0.295281f,-0.295372f,-0.295464f,-0.295556f,-0.295647f,-0.295739f,-0.29583f,-0.295922f,-0.296014f,-0.296105f,-0.296197f,-0.296288f,-0.29638f,-0.296472f,-0.296563f,-0.296655f,-0.296746f,-0.296838f,-0.296929f,-0.297021f,-0.297112f,-0.297204f,-0.297295f,-0.297387f,-0.297478f,-0.29757f,-0.297662f,-0.297753f,-0.297845f,-0.297936f,-0.298028f,-0.298119f,-0.298211f,-0.298302f,-0.298394f,-0.298485f,-0.298577f,-0.298668f,-0.29876f,-0.298851f,-0.298943f,-0.299034f,-0.299126f,-0.299217f,-0.299309f,-0.2994f,-0.299492f,-0.299583f,-0.299674f,-0.299766f,-0.299857f,-0.299949f,-0.30004f,-0.300132f,-0.300223f,-0.300315f,-0.300406f,-0.300498f,-0.300589f,-0.300681f,-0.300772f,-0.300863f,-0.300955f,-0.301046f,-0.301138f,-0.301229f,-0.30132f,-0.301412f,-0.301503f,-0.301595f,-0.301686f,-0.301778f,-0.301869f,-0.30196f,-0.302052f,-0.302143f,-0.302235f,-0.302326f,-0.302417f,-0.302509f,-0.3026f,-0.302691f,-0.302783f,-0.302874f,-0.302966f,-0.303057f,-0.303148f,-0.30324f,-0.303331f,-0.303422f,-0.303514f,-0.303605f,-0.303696f,-0.303788f,-0.303879f,-0.30397f,-0.304062f,-0.304153f,-0.304244f,-0.304336f,-0.304427f,-0.304518f,-0.30461f,-0.304701f,-0.304792f,-0.304884f,-0.304975f,-0.305066f,-0.305158f,-0.305249f,-0.30534f,-0.305431f,-0.305523f,-0.305614f,-0.305705f,-0.305797f,-0.305888f,-0.305979f,-0.30607f,-0.306162f,-0.306253f,-0.306344f,-0.306435f,-0.306527f,-0.306618f,-0.306709f,-0.306801f,-0.306892f,-0.306983f,-0.307074f,-0.307165f,-0.307257f,-0.307348f,-0.307439f,-0.30753f,-0.307622f,-0.307713f,-0.307804f,-0.307895f,-0.307987f,-0.308078f,-0.308169f,-0.30826f,-0.308351f,-0.308443f,-0.308534f,-0.308625f,-0.308716f,-0.308807f,-0.308899f,-0.30899f,-0.309081f,-0.309172f,-0.309263f,-0.309354f,-0.309446f,-0.309537f,-0.309628f,-0.309719f,-0.30981f,-0.309901f,-0.309993f,-0.310084f,-0.310175f,-0.310266f,-0.310357f,-0.310448f,-0.310539f,-0.310631f,-0.310722f,-0.310813f,-0.310904f,-0.310995f,-0.311086f,-0.311177f,-0.311268f,-0.311359f,-0.311451f,-0.311542f,-0.311633f,-0.311724f,-0.311815f,-0.311906f,-0.311997f,-0.312088f,-0.312179f,-0.31227f,-0.312361f,-0.312453f,-0.312544f,-0.312635f,-0.312726f,-0.312817f,-0.312908f,-0.312999f,-0.31309f,-0.313181f,-0.313272f,-0.313363f,-0.313454f,-0.313545f,-0.313636f,-0.313727f,-0.313818f,-0.31391f,-0.314001f,-0.314092f,-0.314182f,-0.314273f,-0.314364f,-0.314455f,-0.314546f,-0.314638f,-0.314729f,-0.31482f,-0.314911f,-0.315002f,-0.315092f,-0.315183f,-0.315274f,-0.315366f,-0.315457f,-0.315547f,-0.315638f,-0.315729f,-0.31582f,-0.315911f,-0.316002f,-0.316093f,-0.316184f,-0.316275f,-0.316366f,-0.316457f,-0.316548f,-0.316639f,-0.31673f,-0.316821f,-0.316912f,-0.317003f,-0.317094f,-0.317185f,-0.317275f,-0.317366f,-0.317457f,-0.317548f,-0.317639f,-0.31773f,-0.317821f,-0.317912f,-0.318003f,-0.318094f,-0.318184f,-0.318275f,-0.318366f,-0.318457f,-0.318548f,-0.318639f,-0.31873f,-0.318821f,-0.318911f,-0.319002f,-0.319093f,-0.319184f,-0.319275f,-0.319366f,-0.319457f,-0.319548f,-0.319638f,-0.319729f,-0.31982f,-0.319911f,-0.320002f,-0.320093f,-0.320183f,-0.320274f,-0.320365f,-0.320456f,-0.320547f,-0.320638f,-0.320728f,-0.320819f,-0.32091f,-0.321001f,-0.321091f,-0.321182f,-0.321273f,-0.321364f,-0.321455f,-0.321545f,-0.321636f,-0.321727f,-0.321818f,-0.321908f,-0.321999f,-0.32209f,-0.322181f,-0.322272f,-0.322362f,-0.322453f,-0.322544f,-0.322635f,-0.322725f,-0.322816f,-0.322907f,-0.322998f,-0.323088f,-0.323179f,-0.32327f,-0.32336f,-0.323451f,-0.323542f,-0.323633f,-0.323723f,-0.323814f,-0.323905f,-0.323995f,-0.324086f,-0.324177f,-0.324268f,-0.324358f,-0.324449f,-0.32454f,-0.32463f,-0.324721f,-0.324812f,-0.324903f,-0.324993f,-0.325084f,-0.325174f,-0.325265f,-0.325356f,-0.325446f,-0.325537f,-0.325628f,-0.325718f,-0.325809f,-0.3259f,-0.32599f,-0.326081f,-0.326171f,-0.326262f,-0.326353f,-0.326443f,-0.326534f,-0.326625f,-0.326715f,-0.326806f,-0.326896f,-0.326987f,-0.327078f,-0.327168f,-0.327259f,-0.327349f,-0.32744f,-0.327531f,-0.327621f,-0.327712f,-0.327802f,-0.327893f,-0.327984f,-0.328074f,-0.328165f,-0.328255f,-0.328346f,-0.328436f,-0.328527f,-0.328618f,-0.328708f,-0.328799f,-0.328889f,-0.32898f,-0.32907f,-0.329161f,-0.329251f,-0.329342f,-0.329432f,-0.329523f,-0.329613f,-0.329704f,-0.329794f,-0.329885f,-0.329975f,-0.330066f,-0.330156f,-0.330247f,-0.330337f,-0.330428f,-0.330518f,-0.330609f,-0.330699f,-0.33079f,-0.33088f,-0.330971f,-0.331061f,-0.331152f,-0.331242f,-0.331332f,-0.331423f,-0.331514f,-0.331604f,-0.331694f,-0.331785f,-0.331875f,-0.331966f,-0.332056f,-0.332146f,-0.332237f,-0.332327f,-0.332418f,-0.332508f,-0.332599f,-0.332689f,-0.332779f,-0.33287f,-0.33296f,-0.333051f,-0.333141f,-0.333232f,-0.333322f,-0.333412f,-0.333503f,-0.333593f,-0.333684f,-0.333774f,-0.333864f,-0.333955f,-0.334045f,-0.334135f,-0.334226f,-0.334316f,-0.334406f,-0.334497f,-0.334587f,-0.334677f,-0.334768f,-0.334858f,-0.334948f,-0.335039f,-0.335129f,-0.33522f,-0.33531f,-0.3354f,-0.33549f,-0.335581f,-0.335671f,-0.335761f,-0.335852f,-0.335942f,-0.336032f,-0.336123f,-0.336213f,-0.336303f,-0.336393f,-0.336484f,-0.336574f,-0.336664f,-0.336755f,-0.336845f,-0.336935f,-0.337025f,-0.337116f,-0.337206f,-0.337296f,-0.337386f,-0.337477f,-0.337567f,-0.337657f,-0.337747f,-0.337838f,-0.337928f,-0.338018f,-0.338108f,-0.338199f,-0.338289f,-0.338379f,-0.338469f,-0.338559f,-0.33865f,-0.33874f,-0.33883f,-0.33892f,-0.33901f,-0.339101f,-0.339191f,-0.339281f,-0.339371f,-0.339461f,-0.339552f,-0.339642f,-0.339732f,-0.339822f,-0.339912f,-0.340002f,-0.340092f,-0.340183f,-0.340273f,-0.340363f,-0.340453f,-0.340543f,-0.340633f,-0.340724f,-0.340814f,-0.340904f,-0.340994f,-0.341084f,-0.341174f,-0.341264f,-0.341354f,-0.341445f,-0.341535f,-0.341625f,-0.341715f,-0.341805f,-0.341895f,-0.341985f,-0.342075f,-0.342165f,-0.342255f,-0.342345f,-0.342436f,-0.342526f,-0.342616f,-0.342706f,-0.342796f,-0.342886f,-0.342976f,-0.343066f,-0.343156f,-0.343246f,-0.343336f,-0.343426f,-0.343516f,-0.343606f,-0.343696f,-0.343786f,-0.343877f,-0.343967f,-0.344057f,-0.344147f,-0.344237f,-0.344327f,-0.344416f,-0.344506f,-0.344597f,-0.344687f,-0.344777f,-0.344867f,-0.344957f,-0.345047f,-0.345136f,-0.345226f,-0.345317f,-0.345407f,-0.345496f,-0.345586f,-0.345676f,-0.345766f,-0.345856f,-0.345946f,-0.346036f,-0.346126f,-0.346216f,-0.346306f,-0.346396f,-0.346486f,-0.346576f,-0.346666f,-0.346756f,-0.346846f,-0.346936f,-0.347025f,-0.347115f,-0.347205f,-0.347295f,-0.347385f,-0.347475f,-0.347565f,-0.347655f,-0.347745f,-0.347835f,-0.347924f,-0.348014f,-0.348104f,-0.348194f,-0.348284f,-0.348374f,-0.348464f,-0.348554f,-0.348643f,-0.348733f,-0.348823f,-0.348913f,-0.349003f,-0.349093f,-0.349183f,-0.349272f,-0.349362f,-0.349452f,-0.349542f,-0.349632f,-0.349722f,-0.349811f,-0.349901f,-0.349991f,-0.350081f,-0.35017f,-0.35026f,-0.35035f,-0.35044f,-0.35053f,-0.35062f,-0.350709f,-0.350799f,-0.350889f,-0.350979f,-0.351068f,-0.351158f,-0.351248f,-0.351338f,-0.351427f,-0.351517f,-0.351607f,-0.351697f,-0.351786f,-0.351876f,-0.351966f,-0.352056f,-0.352145f,-0.352235f,-0.352325f,-0.352415f,-0.352504f,-0.352594f,-0.352684f,-0.352774f,-0.352863f,-0.352953f,-0.353043f,-0.353132f,-0.353222f,-0.353312f,-0.353401f,-0.353491f,-0.353581f,-0.35367f,-0.35376f,-0.35385f,-0.353939f,-0.354029f,-0.354119f,-0.354208f,-0.354298f,-0.354388f,-0.354477f,-0.354567f,-0.354657f,-0.354746f,-0.354836f,-0.354926f,-0.355015f,-0.355105f,-0.355194f,-0.355284f,-0.355374f,-0.355463f,-0.355553f,-0.355643f,-0.355732f,-0.355822f,-0.355911f,-0.356001f,-0.35609f,-0.35618f,-0.35627f,-0.356359f,-0.356449f,-0.356538f,-0.356628f,-0.356718f,-0.356807f,-0.356897f,-0.356986f,-0.357076f,-0.357165f,-0.357255f,-0.357344f,-0.357434f,-0.357523f,-0.357613f,-0.357703f,-0.357792f,-0.357882f,-0.357971f,-0.358061f,-0.35815f,-0.35824f,-0.358329f,-0.358419f,-0.358508f,-0.358598f,-0.358687f,-0.358777f,-0.358866f,-0.358956f,-0.359045f,-0.359135f,-0.359224f,-0.359314f,-0.359403f,-0.359493f,-0.359582f,-0.359671f,-0.359761f,-0.35985f,-0.35994f,-0.360029f,-0.360119f,-0.360208f,-0.360298f,-0.360387f,-0.360476f,-0.360566f,-0.360655f,-0.360745f,-0.360834f,-0.360924f,-0.361013f,-0.361102f,-0.361192f,-0.361281f,-0.361371f,-0.36146f,-0.361549f,-0.361639f,-0.361728f,-0.361817f,-0.361907f,-0.361996f,-0.362086f,-0.362175f,-0.362264f,-0.362354f,-0.362443f,-0.362532f,-0.362622f,-0.362711f,-0.362801f,-0.36289f,-0.362979f,-0.363068f,-0.363158f,-0.363247f,-0.363336f,-0.363426f,-0.363515f,-0.363604f,-0.363694f,-0.363783f,-0.363872f,-0.363962f,-0.364051f,-0.36414f,-0.36423f,-0.364319f,-0.364408f,-0.364497f,-0.364587f,-0.364676f,-0.364765f,-0.364855f,-0.364944f,-0.365033f,-0.365122f,-0.365211f,-0.365301f,-0.36539f,-0.365479f,-0.365569f,-0.365658f,-0.365747f,-0.365836f,-0.365925f,-0.366015f,-0.366104f,-0.366193f,-0.366282f,-0.366372f,-0.366461f,-0.36655f,-0.366639f,-0.366728f,-0.366817f,-0.366907f,-0.366996f,-0.367085f,-0.367174f,-0.367263f,-0.367353f,-0.367442f,-0.367531f,-0.36762f,-0.367709f,-0.367798f,-0.367888f,-0.367977f,-0.368066f,-0.368155f,-0.368244f,-0.368333f,-0.368422f,-0.368512f,-0.368601f,-0.36869f,-0.368779f,-0.368868f,-0.368957f,-0.369046f,-0.369135f,-0.369224f,-0.369314f,-0.369403f,-0.369492f,-0.369581f,-0.36967f,-0.369759f,-0.369848f,-0.369937f,-0.370026f,-0.370115f,-0.370204f,-0.370293f,-0.370382f,-0.370471f,-0.37056f,-0.37065f,-0.370739f,-0.370828f,-0.370917f,-0.371006f,-0.371095f,-0.371184f,-0.371273f,-0.371362f,-0.371451f,-0.37154f,-0.371629f,-0.371718f,-0.371807f,-0.371896f,-0.371985f,-0.372074f,-0.372163f,-0.372252f,-0.372341f,-0.37243f,-0.372519f,-0.372608f,-0.372697f,-0.372786f,-0.372875f,-0.372964f,-0.373053f,-0.373141f,-0.37323f,-0.373319f,-0.373408f,-0.373497f,-0.373586f,-0.373675f,-0.373764f,-0.373853f,-0.373942f,-0.374031f,-0.37412f,-0.374209f,-0.374298f,-0.374386f,-0.374475f,-0.374564f,-0.374653f,-0.374742f,-0.374831f,-0.37492f,-0.375009f,-0.375098f,-0.375186f,-0.375275f,-0.375364f,-0.375453f,-0.375542f,-0.375631f,-0.37572f,-0.375808f,-0.375897f,-0.375986f,-0.376075f,-0.376164f,-0.376253f,-0.376342f,-0.37643f,-0.376519f,-0.376608f,-0.376697f,-0.376785f,-0.376874f,-0.376963f,-0.377052f,-0.377141f,-0.37723f,-0.377318f,-0.377407f,-0.377496f,-0.377585f,-0.377673f,-0.377762f,-0.377851f,-0.37794f,-0.378028f,-0.378117f,-0.378206f,-0.378295f,-0.378383f,-0.378472f,-0.378561f,-0.37865f,-0.378738f,-0.378827f,-0.378916f,-0.379005f,-0.379093f,-0.379182f,-0.379271f,-0.37936f,-0.379448f,-0.379537f,-0.379626f,-0.379714f,-0.379803f,-0.379892f,-0.37998f,-0.380069f,-0.380158f,-0.380246f,-0.380335f,-0.380424f,-0.380512f,-0.380601f,-0.38069f,-0.380778f,-0.380867f,-0.380956f,-0.381044f,-0.381133f,-0.381221f,-0.38131f,-0.381399f,-0.381487f,-0.381576f,-0.381665f,-0.381753f,-0.381842f,-0.38193f,-0.382019f,-0.382108f,-0.382196f,-0.382285f,-0.382374f,-0.382462f,-0.382551f,-0.382639f,-0.382728f,-0.382816f,-0.382905f,-0.382994f,-0.383082f,-0.383171f,-0.383259f,-0.383348f,-0.383436f,-0.383525f,-0.383613f,-0.383702f,-0.38379f,-0.383879f,-0.383967f,-0.384056f,-0.384144f,-0.384233f,-0.384322f,-0.38441f,-0.384499f,-0.384587f,-0.384676f,-0.384764f,-0.384852f,-0.384941f,-0.38503f,-0.385118f,-0.385207f,-0.385295f,-0.385383f,-0.385472f,-0.38556f,-0.385649f,-0.385737f,-0.385826f,-0.385914f,-0.386003f,-0.386091f,-0.386179f,-0.386268f,-0.386357f,-0.386445f,-0.386533f,-0.386622f,-0.38671f,-0.386798f,-0.386887f,-0.386975f,-0.387064f,-0.387152f,-0.387241f,-0.387329f,-0.387417f,-0.387506f,-0.387594f,-0.387682f,-0.387771f,-0.387859f,-0.387948f,-0.388036f,-0.388124f,-0.388213f,-0.388301f,-0.388389f,-0.388478f,-0.388566f,-0.388654f,-0.388743f,-0.388831f,-0.388919f,-0.389008f,-0.389096f,-0.389184f,-0.389273f,-0.389361f,-0.389449f,-0.389538f,-0.389626f,-0.389714f,-0.389802f,-0.389891f,-0.389979f,-0.390067f,-0.390156f,-0.390244f,-0.390332f,-0.39042f,-0.390509f,-0.390597f,-0.390685f,-0.390773f,-0.390862f,-0.39095f,-0.391038f,-0.391126f,-0.391215f,-0.391303f,-0.391391f,-0.391479f,-0.391568f,-0.391656f,-0.391744f,-0.391832f,-0.39192f,-0.392008f,-0.392097f,-0.392185f,-0.392273f,-0.392361f,-0.392449f,-0.392538f,-0.392626f,-0.392714f,-0.392802f,-0.39289f,-0.392979f,-0.393067f,-0.393155f,-0.393243f,-0.393331f,-0.393419f,-0.393508f,-0.393596f,-0.393684f,-0.393772f,-0.39386f,-0.393948f,-0.394036f,-0.394124f,-0.394213f,-0.394301f,-0.394389f,-0.394477f,-0.394565f,-0.394653f,-0.394741f,-0.394829f,-0.394917f,-0.395005f,-0.395093f,-0.395181f,-0.395269f,-0.395358f,-0.395446f,-0.395534f,-0.395622f,-0.39571f,-0.395798f,-0.395886f,-0.395974f,-0.396062f,-0.39615f,-0.396238f,-0.396326f,-0.396414f,-0.396502f,-0.39659f,-0.396678f,-0.396766f,-0.396854f,-0.396942f,-0.39703f,-0.397118f,-0.397206f,-0.397294f,-0.397382f,-0.39747f,-0.397558f,-0.397646f,-0.397734f,-0.397822f,-0.39791f,-0.397998f,-0.398086f,-0.398174f,-0.398262f,-0.398349f,-0.398437f,-0.398526f,-0.398613f,-0.398701f,-0.398789f,-0.398877f,-0.398965f,-0.399053f,-0.399141f,-0.399229f,-0.399317f,-0.399405f,-0.399492f,-0.39958f,-0.399668f,-0.399756f,-0.399844f,-0.399932f,-0.40002f,-0.400108f,-0.400195f,-0.400283f,-0.400371f,-0.400459f,-0.400547f,-0.400635f,-0.400723f,-0.40081f,-0.400898f,-0.400986f,-0.401074f,-0.401162f,-0.401249f,-0.401337f,-0.401425f,-0.401513f,-0.401601f,-0.401689f,-0.401776f,-0.401864f,-0.401952f,-0.40204f,-0.402128f,-0.402215f,-0.402303f,-0.402391f,-0.402479f,-0.402566f,-0.402654f,-0.402742f,-0.40283f,-0.402917f,-0.403005f,-0.403093f,-0.403181f,-0.403268f,-0.403356f,-0.403444f,-0.403532f,-0.403619f,-0.403707f,-0.403795f,-0.403882f,-0.40397f,-0.404058f,-0.404146f,-0.404233f,-0.404321f,-0.404409f,-0.404496f,-0.404584f,-0.404672f,-0.404759f,-0.404847f,-0.404935f,-0.405022f,-0.40511f,-0.405198f,-0.405285f,-0.405373f,-0.40546f,-0.405548f,-0.405636f,-0.405723f,-0.405811f,-0.405899f,-0.405986f,-0.406074f,-0.406161f,-0.406249f,-0.406337f,-0.406424f,-0.406512f,-0.4066f,-0.406687f,-0.406775f,-0.406862f,-0.40695f,-0.407037f,-0.407125f,-0.407213f,-0.4073f,-0.407388f,-0.407475f,-0.407563f,-0.40765f,-0.407738f,-0.407825f,-0.407913f,-0.408f,-0.408088f,-0.408175f,-0.408263f,-0.40835f,-0.408438f,-0.408526f,-0.408613f,-0.408701f,-0.408788f,-0.408876f,-0.408963f,-0.40905f,-0.409138f,-0.409226f,-0.409313f,-0.409401f,-0.409488f,-0.409575f,-0.409663f,-0.40975f,-0.409838f,-0.409925f,-0.410013f,-0.4101f,-0.410188f,-0.410275f,-0.410362f,-0.41045f,-0.410537f,-0.410625f,-0.410712f,-0.4108f,-0.410887f,-0.410974f,-0.411062f,-0.411149f,-0.411237f,-0.411324f,-0.411411f,-0.411499f,-0.411586f,-0.411673f,-0.411761f,-0.411848f,-0.411936f,-0.412023f,-0.41211f,-0.412198f,-0.412285f,-0.412372f,-0.41246f,-0.412547f,-0.412634f,-0.412722f,-0.412809f,-0.412896f,-0.412984f,-0.413071f,-0.413158f,-0.413245f,-0.413333f,-0.41342f,-0.413508f,-0.413595f,-0.413682f,-0.413769f,-0.413857f,-0.413944f,-0.414031f,-0.414118f,-0.414206f,-0.414293f,-0.41438f,-0.414467f,-0.414555f,-0.414642f,-0.414729f,-0.414816f,-0.414904f,-0.414991f,-0.415078f,-0.415165f,-0.415253f,-0.41534f,-0.415427f,-0.415514f,-0.415601f,-0.415689f,-0.415776f,-0.415863f,-0.41595f,-0.416037f,-0.416125f,-0.416212f,-0.416299f,-0.416386f,-0.416473f,-0.41656f,-0.416647f,-0.416735f,-0.416822f,-0.416909f,-0.416996f,-0.417083f,-0.41717f,-0.417258f,-0.417345f,-0.417432f,-0.417519f,-0.417606f,-0.417693f,-0.41778f,-0.417867f,-0.417954f,-0.418041f,-0.418129f,-0.418216f,-0.418303f,-0.41839f,-0.418477f,-0.418564f,-0.418651f,-0.418738f,-0.418825f,-0.418912f,-0.418999f,-0.419086f,-0.419173f,-0.419261f,-0.419348f,-0.419435f,-0.419522f,-0.419609f,-0.419696f,-0.419783f,-0.41987f,-0.419957f,-0.420044f,-0.420131f,-0.420218f,-0.420305f,-0.420392f,-0.420479f,-0.420566f,-0.420653f,-0.42074f,-0.420827f,-0.420914f,-0.421f,-0.421088f,-0.421175f,-0.421261f,-0.421348f,-0.421435f,-0.421522f,-0.421609f,-0.421696f,-0.421783f,-0.42187f,-0.421957f,-0.422044f,-0.422131f,-0.422218f,-0.422304f,-0.422391f,-0.422478f,-0.422565f,-0.422652f,-0.422739f,-0.422826f,-0.422913f,-0.423f,-0.423086f,-0.423174f,-0.42326f,-0.423347f,-0.423434f,-0.423521f,-0.423608f,-0.423694f,-0.423781f,-0.423868f,-0.423955f,-0.424042f,-0.424129f,-0.424216f,-0.424302f,-0.424389f,-0.424476f,-0.424563f,-0.42465f,-0.424736f,-0.424823f,-0.42491f,-0.424997f,-0.425083f,-0.42517f,-0.425257f,-0.425344f,-0.425431f,-0.425517f,-0.425604f,-0.425691f,-0.425778f,-0.425864f,-0.425951f,-0.426038f,-0.426125f,-0.426211f,-0.426298f,-0.426385f,-0.426471f,-0.426558f,-0.426645f,-0.426732f,-0.426818f,-0.426905f,-0.426992f,-0.427078f,-0.427165f,-0.427252f,-0.427338f,-0.427425f,-0.427512f,-0.427599f,-0.427685f,-0.427772f,-0.427858f,-0.427945f,-0.428032f,-0.428119f,-0.428205f,-0.428292f,-0.428378f,-0.428465f,-0.428552f,-0.428638f,-0.428725f,-0.428812f,-0.428898f,-0.428985f,-0.429071f,-0.429158f,-0.429244f,-0.429331f,-0.429418f,-0.429504f,-0.429591f,-0.429677f,-0.429764f,-0.429851f,-0.429937f,-0.430024f,-0.43011f,-0.430197f,-0.430283f,-0.43037f,-0.430456f,-0.430543f,-0.430629f,-0.430716f,-0.430802f,-0.430889f,-0.430976f,-0.431062f,-0.431149f,-0.431235f,-0.431322f,-0.431408f,-0.431494f,-0.431581f,-0.431668f,-0.431754f,-0.43184f,-0.431927f,-0.432013f,-0.4321f,-0.432186f,-0.432273f,-0.432359f,-0.432446f,-0.432532f,-0.432619f,-0.432705f,-0.432791f,-0.432878f,-0.432964f,-0.433051f,-0.433137f,-0.433224f,-0.43331f,-0.433396f,-0.433483f,-0.433569f,-0.433656f,-0.433742f,-0.433828f,-0.433915f,-0.434001f,-0.434087f,-0.434174f,-0.43426f,-0.434347f,-0.434433f,-0.434519f,-0.434606f,-0.434692f,-0.434778f,-0.434865f,-0.434951f,-0.435037f,-0.435124f,-0.43521f,-0.435296f,-0.435383f,-0.435469f,-0.435555f,-0.435641f,-0.435728f,-0.435814f,-0.4359f,-0.435987f,-0.436073f,-0.436159f,-0.436245f,-0.436332f,-0.436418f,-0.436504f,-0.436591f,-0.436677f,-0.436763f,-0.436849f,-0.436935f,-0.437022f,-0.437108f,-0.437194f,-0.43728f,-0.437367f,-0.437453f,-0.437539f,-0.437625f,-0.437711f,-0.437798f,-0.437884f,-0.43797f,-0.438056f,-0.438142f,-0.438229f,-0.438315f,-0.438401f,-0.438487f,-0.438573f,-0.438659f,-0.438746f,-0.438832f,-0.438918f,-0.439004f,-0.43909f,-0.439176f,-0.439263f,-0.439349f,-0.439435f,-0.439521f,-0.439607f,-0.439693f,-0.439779f,-0.439865f,-0.439951f,-0.440037f,-0.440124f,-0.44021f,-0.440296f,-0.440382f,-0.440468f,-0.440554f,-0.44064f,-0.440726f,-0.440812f,-0.440898f,-0.440984f,-0.44107f,-0.441156f,-0.441242f,-0.441328f,-0.441414f,-0.4415f,-0.441586f,-0.441672f,-0.441758f,-0.441844f,-0.44193f,-0.442017f,-0.442103f,-0.442189f,-0.442274f,-0.44236f,-0.442446f,-0.442532f,-0.442618f,-0.442704f,-0.44279f,-0.442876f,-0.442962f,-0.443048f,-0.443134f,-0.44322f,-0.443306f,-0.443392f,-0.443478f,-0.443564f,-0.44365f,-0.443736f,-0.443822f,-0.443907f,-0.443993f,-0.444079f,-0.444165f,-0.444251f,-0.444337f,-0.444423f,-0.444509f,-0.444595f,-0.44468f,-0.444766f,-0.444852f,-0.444938f,-0.445024f,-0.44511f,-0.445196f,-0.445281f,-0.445367f,-0.445453f,-0.445539f,-0.445625f,-0.445711f,-0.445796f,-0.445882f,-0.445968f,-0.446054f,-0.44614f,-0.446226f,-0.446311f,-0.446397f,-0.446483f,-0.446569f,-0.446654f,-0.44674f,-0.446826f,-0.446912f,-0.446998f,-0.447083f,-0.447169f,-0.447255f,-0.447341f,-0.447426f,-0.447512f,-0.447598f,-0.447684f,-0.447769f,-0.447855f,-0.447941f,-0.448026f,-0.448112f,-0.448198f,-0.448284f,-0.448369f,-0.448455f,-0.448541f,-0.448626f,-0.448712f,-0.448798f,-0.448883f,-0.448969f,-0.449055f,-0.44914f,-0.449226f,-0.449312f,-0.449397f,-0.449483f,-0.449569f,-0.449654f,-0.44974f,-0.449826f,-0.449911f,-0.449997f,-0.450082f,-0.450168f,-0.450253f,-0.450339f,-0.450425f,-0.45051f,-0.450596f,-0.450682f,-0.450767f,-0.450853f,-0.450938f,-0.451024f,-0.451109f,-0.451195f,-0.451281f,-0.451366f,-0.451452f,-0.451537f,-0.451623f,-0.451708f,-0.451794f,-0.451879f,-0.451965f,-0.45205f,-0.452136f,-0.452221f,-0.452307f,-0.452393f,-0.452478f,-0.452563f,-0.452649f,-0.452734f,-0.45282f,-0.452905f,-0.452991f,-0.453076f,-0.453162f,-0.453247f,-0.453333f,-0.453418f,-0.453504f,-0.453589f,-0.453674f,-0.45376f,-0.453845f,-0.453931f,-0.454016f,-0.454102f,-0.454187f,-0.454272f,-0.454358f,-0.454443f,-0.454529f,-0.454614f,-0.454699f,-0.454785f,-0.45487f,-0.454956f,-0.455041f,-0.455126f,-0.455212f,-0.455297f,-0.455382f,-0.455468f,-0.455553f,-0.455638f,-0.455724f,-0.455809f,-0.455895f,-0.45598f,-0.456065f,-0.45615f,-0.456236f,-0.456321f,-0.456406f,-0.456492f,-0.456577f,-0.456662f,-0.456748f,-0.456833f,-0.456918f,-0.457003f,-0.457089f,-0.457174f,-0.457259f,-0.457345f,-0.45743f,-0.457515f,-0.4576f,-0.457686f,-0.457771f,-0.457856f,-0.457941f,-0.458027f,-0.458112f,-0.458197f,-0.458282f,-0.458367f,-0.458452f,-0.458538f,-0.458623f,-0.458708f,-0.458793f,-0.458879f,-0.458964f,-0.459049f,-0.459134f,-0.459219f,-0.459304f,-0.45939f,-0.459475f,-0.45956f,-0.459645f,-0.45973f,-0.459815f,-0.4599f,-0.459986f,-0.460071f,-0.460156f,-0.460241f,-0.460326f,-0.460411f,-0.460496f,-0.460581f,-0.460667f,-0.460752f,-0.460837f,-0.460922f,-0.461007f,-0.461092f,-0.461177f,-0.461262f,-0.461347f,-0.461432f,-0.461517f,-0.461602f,-0.461687f,-0.461772f,-0.461857f,-0.461942f,-0.462028f,-0.462113f,-0.462198f,-0.462283f,-0.462368f,-0.462452f,-0.462537f,-0.462622f,-0.462708f,-0.462793f,-0.462878f,-0.462962f,-0.463047f,-0.463132f,-0.463217f,-0.463302f,-0.463387f,-0.463472f,-0.463557f,-0.463642f,-0.463727f,-0.463812f,-0.463897f,-0.463982f,-0.464067f,-0.464152f,-0.464237f,-0.464322f,-0.464407f,-0.464491f,-0.464576f,-0.464661f,-0.464746f,-0.464831f,-0.464916f,-0.465001f,-0.465086f,-0.465171f,-0.465255f,-0.46534f,-0.465425f,-0.46551f,-0.465595f,-0.46568f,-0.465764f,-0.465849f,-0.465934f,-0.466019f,-0.466104f,-0.466189f,-0.466274f,-0.466358f,-0.466443f,-0.466528f,-0.466613f,-0.466697f,-0.466782f,-0.466867f,-0.466952f,-0.467037f,-0.467121f,-0.467206f,-0.467291f,-0.467376f,-0.46746f,-0.467545f,-0.46763f,-0.467715f,-0.467799f,-0.467884f,-0.467969f,-0.468054f,-0.468138f,-0.468223f,-0.468308f,-0.468392f,-0.468477f,-0.468562f,-0.468647f,-0.468731f,-0.468816f,-0.468901f,-0.468985f,-0.46907f,-0.469155f,-0.469239f,-0.469324f,-0.469409f,-0.469493f,-0.469578f,-0.469663f,-0.469747f,-0.469832f,-0.469916f,-0.470001f,-0.470086f,-0.47017f,-0.470255f,-0.47034f,-0.470424f,-0.470509f,-0.470593f,-0.470678f,-0.470762f,-0.470847f,-0.470932f,-0.471016f,-0.471101f,-0.471185f,-0.47127f,-0.471355f,-0.471439f,-0.471524f,-0.471608f,-0.471693f,-0.471777f,-0.471862f,-0.471946f,-0.472031f,-0.472115f,-0.4722f,-0.472284f,-0.472369f,-0.472453f,-0.472538f,-0.472622f,-0.472707f,-0.472791f,-0.472876f,-0.47296f,-0.473045f,-0.473129f,-0.473214f,-0.473298f,-0.473383f,-0.473467f,-0.473551f,-0.473636f,-0.47372f,-0.473805f,-0.473889f,-0.473974f,-0.474058f,-0.474142f,-0.474227f,-0.474311f,-0.474396f,-0.47448f,-0.474565f,-0.474649f,-0.474733f,-0.474818f,-0.474902f,-0.474986f,-0.475071f,-0.475155f,-0.47524f,-0.475324f,-0.475408f,-0.475493f,-0.475577f,-0.475661f,-0.475746f,-0.47583f,-0.475914f,-0.475999f,-0.476083f,-0.476167f,-0.476251f,-0.476336f,-0.47642f,-0.476504f,-0.476589f,-0.476673f,-0.476757f,-0.476841f,-0.476926f,-0.47701f,-0.477094f,-0.477179f,-0.477263f,-0.477347f,-0.477431f,-0.477515f,-0.4776f,-0.477684f,-0.477768f,-0.477852f,-0.477937f,-0.478021f,-0.478105f,-0.478189f,-0.478273f,-0.478358f,-0.478442f,-0.478526f,-0.47861f,-0.478694f,-0.478779f,-0.478863f,-0.478947f,-0.479031f,-0.479115f,-0.479199f,-0.479284f,-0.479368f,-0.479452f,-0.479536f,-0.47962f,-0.479704f,-0.479788f,-0.479872f,-0.479957f,-0.480041f,-0.480125f,-0.480209f,-0.480293f,-0.480377f,-0.480461f,-0.480545f,-0.480629f,-0.480713f,-0.480797f,-0.480881f,-0.480965f,-0.481049f,-0.481134f,-0.481218f,-0.481302f,-0.481386f,-0.48147f,-0.481554f,-0.481638f,-0.481722f,-0.481806f,-0.48189f,-0.481974f,-0.482058f,-0.482142f,-0.482226f,-0.48231f,-0.482394f,-0.482478f,-0.482562f,-0.482646f,-0.48273f,-0.482814f,-0.482898f,-0.482982f,-0.483065f,-0.483149f,-0.483233f,-0.483317f,-0.483401f,-0.483485f,-0.483569f,-0.483653f,-0.483737f,-0.483821f,-0.483905f,-0.483989f,-0.484073f,-0.484156f,-0.48424f,-0.484324f,-0.484408f,-0.484492f,-0.484576f,-0.48466f,-0.484744f,-0.484827f,-0.484911f,-0.484995f,-0.485079f,-0.485163f,-0.485247f,-0.48533f,-0.485414f,-0.485498f,-0.485582f,-0.485666f,-0.485749f,-0.485833f,-0.485917f,-0.486001f,-0.486085f,-0.486168f,-0.486252f,-0.486336f,-0.48642f,-0.486503f,-0.486587f,-0.486671f,-0.486755f,-0.486839f,-0.486922f,-0.487006f,-0.48709f,-0.487173f,-0.487257f,-0.487341f,-0.487425f,-0.487508f,-0.487592f,-0.487676f,-0.487759f,-0.487843f,-0.487927f,-0.488011f,-0.488094f,-0.488178f,-0.488262f,-0.488345f,-0.488429f,-0.488512f,-0.488596f,-0.48868f,-0.488764f,-0.488847f,-0.488931f,-0.489014f,-0.489098f,-0.489182f,-0.489265f,-0.489349f,-0.489433f,-0.489516f,-0.4896f,-0.489683f,-0.489767f,-0.48985f,-0.489934f,-0.490018f,-0.490101f,-0.490185f,-0.490268f,-0.490352f,-0.490435f,-0.490519f,-0.490603f,-0.490686f,-0.49077f,-0.490853f,-0.490937f,-0.49102f,-0.491104f,-0.491187f,-0.491271f,-0.491354f,-0.491438f,-0.491521f,-0.491605f,-0.491688f,-0.491772f,-0.491855f,-0.491939f,-0.492022f,-0.492106f,-0.492189f,-0.492273f,-0.492356f,-0.492439f,-0.492523f,-0.492606f,-0.49269f,-0.492773f,-0.492857f,-0.49294f,-0.493023f,-0.493107f,-0.49319f,-0.493274f,-0.493357f,-0.49344f,-0.493524f,-0.493607f,-0.493691f,-0.493774f,-0.493857f,-0.493941f,-0.494024f,-0.494107f,-0.494191f,-0.494274f,-0.494357f,-0.494441f,-0.494524f,-0.494607f,-0.494691f,-0.494774f,-0.494857f,-0.494941f,-0.495024f,-0.495107f,-0.495191f,-0.495274f,-0.495357f,-0.49544f,-0.495524f,-0.495607f,-0.49569f,-0.495773f,-0.495857f,-0.49594f,-0.496023f,-0.496107f,-0.49619f,-0.496273f,-0.496356f,-0.496439f,-0.496523f,-0.496606f,-0.496689f,-0.496772f,-0.496856f,-0.496939f,-0.497022f,-0.497105f,-0.497188f,-0.497271f,-0.497355f,-0.497438f,-0.497521f,-0.497604f,-0.497687f,-0.49777f,-0.497854f,-0.497937f,-0.49802f,-0.498103f,-0.498186f,-0.498269f,-0.498352f,-0.498436f,-0.498519f,-0.498602f,-0.498685f,-0.498768f,-0.498851f,-0.498934f,-0.499017f,-0.4991f,-0.499183f,-0.499266f,-0.49935f,-0.499433f,-0.499516f,-0.499599f,-0.499682f,-0.499765f,-0.499848f,-0.499931f,-0.500014f,-0.500097f,-0.50018f,-0.500263f,-0.500346f,-0.500429f,-0.500512f,-0.500595f,-0.500678f,-0.500761f,-0.500844f,-0.500927f,-0.50101f,-0.501093f,-0.501176f,-0.501259f,-0.501342f,-0.501425f,-0.501508f,-0.501591f,-0.501674f,-0.501756f,-0.501839f,-0.501922f,-0.502005f,-0.502088f,-0.502171f,-0.502254f,-0.502337f,-0.50242f,-0.502503f,-0.502586f,-0.502668f,-0.502751f,-0.502834f,-0.502917f,-0.503f,-0.503083f,-0.503166f,-0.503248f,-0.503331f,-0.503414f,-0.503497f,-0.50358f,-0.503663f,-0.503745f,-0.503828f,-0.503911f,-0.503994f,-0.504077f,-0.50416f,-0.504242f,-0.504325f,-0.504408f,-0.504491f,-0.504573f,-0.504656f,-0.504739f,-0.504822f,-0.504905f,-0.504987f,-0.50507f,-0.505153f,-0.505235f,-0.505318f,-0.505401f,-0.505484f,-0.505567f,-0.505649f,-0.505732f,-0.505815f,-0.505897f,-0.50598f,-0.506063f,-0.506145f,-0.506228f,-0.506311f,-0.506393f,-0.506476f,-0.506559f,-0.506641f,-0.506724f,-0.506807f,-0.506889f,-0.506972f,-0.507055f,-0.507137f,-0.50722f,-0.507302f,-0.507385f,-0.507468f,-0.50755f,-0.507633f,-0.507716f,-0.507798f,-0.507881f,-0.507963f,-0.508046f,-0.508129f,-0.508211f,-0.508294f,-0.508376f,-0.508459f,-0.508541f,-0.508624f,-0.508707f,-0.508789f,-0.508872f,-0.508954f,-0.509037f,-0.509119f,-0.509202f,-0.509284f,-0.509367f,-0.509449f,-0.509532f,-0.509614f,-0.509697f,-0.509779f,-0.509861f,-0.509944f,-0.510027f,-0.510109f,-0.510191f,-0.510274f,-0.510356f,-0.510439f,-0.510521f,-0.510604f,-0.510686f,-0.510769f,-0.510851f,-0.510933f,-0.511016f,-0.511098f,-0.511181f,-0.511263f,-0.511345f,-0.511428f,-0.51151f,-0.511593f,-0.511675f,-0.511757f,-0.51184f,-0.511922f,-0.512004f,-0.512087f,-0.512169f,-0.512251f,-0.512334f,-0.512416f,-0.512498f,-0.512581f,-0.512663f,-0.512745f,-0.512828f,-0.51291f,-0.512992f,-0.513075f,-0.513157f,-0.513239f,-0.513321f,-0.513404f,-0.513486f,-0.513568f,-0.51365f,-0.513733f,-0.513815f,-0.513897f,-0.513979f,-0.514062f,-0.514144f,-0.514226f,-0.514308f,-0.514391f,-0.514473f,-0.514555f,-0.514637f,-0.51472f,-0.514802f,-0.514884f,-0.514966f,-0.515048f,-0.51513f,-0.515212f,-0.515295f,-0.515377f,-0.515459f,-0.515541f,-0.515623f,-0.515705f,-0.515788f,-0.51587f,-0.515952f,-0.516034f,-0.516116f,-0.516198f,-0.51628f,-0.516362f,-0.516445f,-0.516527f,-0.516609f,-0.516691f,-0.516773f,-0.516855f,-0.516937f,-0.517019f,-0.517101f,-0.517183f,-0.517265f,-0.517347f,-0.517429f,-0.517511f,-0.517594f,-0.517676f,-0.517758f,-0.517839f,-0.517922f,-0.518004f,-0.518086f,-0.518168f,-0.51825f,-0.518332f,-0.518414f,-0.518496f,-0.518577f,-0.51866f,-0.518742f,-0.518824f,-0.518905f,-0.518987f,-0.519069f,-0.519151f,-0.519233f,-0.519315f,-0.519397f,-0.519479f,-0.519561f,-0.519643f,-0.519725f,-0.519807f,-0.519888f,-0.51997f,-0.520052f,-0.520134f,-0.520216f,-0.520298f,-0.52038f,-0.520462f,-0.520543f,-0.520625f,-0.520707f,-0.520789f,-0.520871f,-0.520953f,-0.521035f,-0.521116f,-0.521198f,-0.52128f,-0.521362f,-0.521444f,-0.521526f,-0.521607f,-0.521689f,-0.521771f,-0.521853f,-0.521934f,-0.522016f,-0.522098f,-0.52218f,-0.522262f,-0.522343f,-0.522425f,-0.522507f,-0.522588f,-0.52267f,-0.522752f,-0.522834f,-0.522915f,-0.522997f,-0.523079f,-0.523161f,-0.523242f,-0.523324f,-0.523406f,-0.523487f,-0.523569f,-0.523651f,-0.523732f,-0.523814f,-0.523896f,-0.523978f,-0.524059f,-0.524141f,-0.524222f,-0.524304f,-0.524386f,-0.524467f,-0.524549f,-0.524631f,-0.524712f,-0.524794f,-0.524875f,-0.524957f,-0.525039f,-0.52512f,-0.525202f,-0.525283f,-0.525365f,-0.525447f,-0.525528f,-0.52561f,-0.525691f,-0.525773f,-0.525854f,-0.525936f,-0.526017f,-0.526099f,-0.526181f,-0.526262f,-0.526344f,-0.526425f,-0.526506f,-0.526588f,-0.52667f,-0.526751f,-0.526833f,-0.526914f,-0.526995f,-0.527077f,-0.527158f,-0.52724f,-0.527322f,-0.527403f,-0.527484f,-0.527566f,-0.527647f,-0.527729f,-0.52781f,-0.527892f,-0.527973f,-0.528054f,-0.528136f,-0.528217f,-0.528299f,-0.52838f,-0.528461f,-0.528543f,-0.528624f,-0.528706f,-0.528787f,-0.528868f,-0.52895f,-0.529031f,-0.529112f,-0.529194f,-0.529275f,-0.529356f,-0.529438f,-0.529519f,-0.5296f,-0.529682f,-0.529763f,-0.529844f,-0.529926f,-0.530007f,-0.530088f,-0.53017f,-0.530251f,-0.530332f,-0.530413f,-0.530495f,-0.530576f,-0.530657f,-0.530739f,-0.53082f,-0.530901f,-0.530982f,-0.531063f,-0.531145f,-0.531226f,-0.531307f,-0.531388f,-0.53147f,-0.531551f,-0.531632f,-0.531713f,-0.531794f,-0.531876f,-0.531957f,-0.532038f,-0.532119f,-0.5322f,-0.532281f,-0.532363f,-0.532444f,-0.532525f,-0.532606f,-0.532687f,-0.532768f,-0.532849f,-0.532931f,-0.533012f,-0.533093f,-0.533174f,-0.533255f,-0.533336f,-0.533417f,-0.533498f,-0.533579f,-0.53366f,-0.533742f,-0.533823f,-0.533904f,-0.533985f,-0.534066f,-0.534147f,-0.534228f,-0.534309f,-0.53439f,-0.534471f,-0.534552f,-0.534633f,-0.534714f,-0.534795f,-0.534876f,-0.534957f,-0.535038f,-0.535119f,-0.5352f,-0.535281f,-0.535362f,-0.535443f,-0.535524f,-0.535605f,-0.535686f,-0.535767f,-0.535848f,-0.535929f,-0.53601f,-0.536091f,-0.536172f,-0.536253f,-0.536333f,-0.536415f,-0.536495f,-0.536576f,-0.536657f,-0.536738f,-0.536819f,-0.5369f,-0.536981f,-0.537062f,-0.537143f,-0.537223f,-0.537304f,-0.537385f,-0.537466f,-0.537547f,-0.537628f,-0.537709f,-0.537789f,-0.53787f,-0.537951f,-0.538032f,-0.538113f,-0.538193f,-0.538274f,-0.538355f,-0.538436f,-0.538517f,-0.538597f,-0.538678f,-0.538759f,-0.53884f,-0.53892f,-0.539001f,-0.539082f,-0.539163f,-0.539243f,-0.539324f,-0.539405f,-0.539486f,-0.539566f,-0.539647f,-0.539728f,-0.539809f,-0.539889f,-0.53997f,-0.540051f,-0.540131f,-0.540212f,-0.540293f,-0.540373f,-0.540454f,-0.540535f,-0.540615f,-0.540696f,-0.540776f,-0.540857f,-0.540938f,-0.541019f,-0.541099f,-0.54118f,-0.54126f,-0.541341f,-0.541422f,-0.541502f,-0.541583f,-0.541663f,-0.541744f,-0.541825f,-0.541905f,-0.541986f,-0.542066f,-0.542147f,-0.542227f,-0.542308f,-0.542388f,-0.542469f,-0.54255f,-0.54263f,-0.542711f,-0.542791f,-0.542872f,-0.542952f,-0.543033f,-0.543113f,-0.543194f,-0.543274f,-0.543355f,-0.543435f,-0.543516f,-0.543596f,-0.543677f,-0.543757f,-0.543837f,-0.543918f,-0.543998f,-0.544079f,-0.544159f,-0.54424f,-0.54432f,-0.544401f,-0.544481f,-0.544561f,-0.544642f,-0.544722f,-0.544803f,-0.544883f,-0.544963f,-0.545044f,-0.545124f,-0.545205f,-0.545285f,-0.545365f,-0.545446f,-0.545526f,-0.545606f,-0.545687f,-0.545767f,-0.545847f,-0.545928f,-0.546008f,-0.546088f,-0.546169f,-0.546249f,-0.546329f,-0.54641f,-0.54649f,-0.54657f,-0.54665f,-0.546731f,-0.546811f,-0.546891f,-0.546971f,-0.547052f,-0.547132f,-0.547212f,-0.547292f,-0.547373f,-0.547453f,-0.547533f,-0.547613f,-0.547694f,-0.547774f,-0.547854f,-0.547934f,-0.548014f,-0.548095f,-0.548175f,-0.548255f,-0.548335f,-0.548415f,-0.548496f,-0.548576f,-0.548656f,-0.548736f,-0.548816f,-0.548896f,-0.548976f,-0.549057f,-0.549137f,-0.549217f,-0.549297f,-0.549377f,-0.549457f,-0.549537f,-0.549617f,-0.549697f,-0.549778f,-0.549858f,-0.549938f,-0.550018f,-0.550098f,-0.550178f,-0.550258f,-0.550338f,-0.550418f,-0.550498f,-0.550578f,-0.550658f,-0.550738f,-0.550818f,-0.550898f,-0.550978f,-0.551058f,-0.551138f,-0.551218f,-0.551298f,-0.551378f,-0.551458f,-0.551538f,-0.551618f,-0.551698f,-0.551778f,-0.551858f,-0.551938f,-0.552018f,-0.552098f,-0.552178f,-0.552258f,-0.552338f,-0.552418f,-0.552497f,-0.552577f,-0.552657f,-0.552737f,-0.552817f,-0.552897f,-0.552977f,-0.553057f,-0.553137f,-0.553216f,-0.553296f,-0.553376f,-0.553456f,-0.553536f,-0.553616f,-0.553696f,-0.553775f,-0.553855f,-0.553935f,-0.554015f,-0.554095f,-0.554175f,-0.554254f,-0.554334f,-0.554414f,-0.554494f,-0.554574f,-0.554653f,-0.554733f,-0.554813f,-0.554893f,-0.554972f,-0.555052f,-0.555132f,-0.555212f,-0.555291f,-0.555371f,-0.555451f,-0.55553f,-0.55561f,-0.55569f,-0.55577f,-0.555849f,-0.555929f,-0.556009f,-0.556088f,-0.556168f,-0.556248f,-0.556327f,-0.556407f,-0.556487f,-0.556566f,-0.556646f,-0.556726f,-0.556805f,-0.556885f,-0.556965f,-0.557044f,-0.557124f,-0.557204f,-0.557283f,-0.557363f,-0.557442f,-0.557522f,-0.557601f,-0.557681f,-0.55776f,-0.55784f,-0.55792f,-0.557999f,-0.558079f,-0.558158f,-0.558238f,-0.558317f,-0.558397f,-0.558477f,-0.558556f,-0.558636f,-0.558715f,-0.558795f,-0.558874f,-0.558954f,-0.559033f,-0.559113f,-0.559192f,-0.559272f,-0.559351f,-0.559431f,-0.55951f,-0.559589f,-0.559669f,-0.559748f,-0.559828f,-0.559907f,-0.559987f,-0.560066f,-0.560145f,-0.560225f,-0.560304f,-0.560384f,-0.560463f,-0.560543f,-0.560622f,-0.560701f,-0.560781f,-0.56086f,-0.560939f,-0.561019f,-0.561098f,-0.561178f,-0.561257f,-0.561336f,-0.561416f,-0.561495f,-0.561574f,-0.561654f,-0.561733f,-0.561812f,-0.561892f,-0.561971f,-0.56205f,-0.562129f,-0.562209f,-0.562288f,-0.562367f,-0.562447f,-0.562526f,-0.562605f,-0.562684f,-0.562764f,-0.562843f,-0.562922f,-0.563001f,-0.563081f,-0.56316f,-0.563239f,-0.563318f,-0.563397f,-0.563477f,-0.563556f,-0.563635f,-0.563714f,-0.563793f,-0.563873f,-0.563952f,-0.564031f,-0.56411f,-0.564189f,-0.564269f,-0.564348f,-0.564427f,-0.564506f,-0.564585f,-0.564664f,-0.564743f,-0.564822f,-0.564902f,-0.564981f,-0.56506f,-0.565139f,-0.565218f,-0.565297f,-0.565376f,-0.565455f,-0.565534f,-0.565613f,-0.565692f,-0.565771f,-0.56585f,-0.565929f,-0.566009f,-0.566087f,-0.566167f,-0.566246f,-0.566325f,-0.566404f,-0.566483f,-0.566562f,-0.566641f,-0.56672f,-0.566799f,-0.566878f,-0.566957f,-0.567036f,-0.567115f,-0.567194f,-0.567272f,-0.567351f,-0.56743f,-0.567509f,-0.567588f,-0.567667f,-0.567746f,-0.567825f,-0.567904f,-0.567983f,-0.568062f,-0.568141f,-0.56822f,-0.568299f,-0.568377f,-0.568456f,-0.568535f,-0.568614f,-0.568693f,-0.568772f,-0.568851f,-0.568929f,-0.569008f,-0.569087f,-0.569166f,-0.569245f,-0.569324f,-0.569402f,-0.569481f,-0.56956f,-0.569639f,-0.569718f,-0.569796f,-0.569875f,-0.569954f,-0.570033f,-0.570112f,-0.57019f,-0.570269f,-0.570348f,-0.570426f,-0.570505f,-0.570584f,-0.570663f,-0.570742f,-0.57082f,-0.570899f,-0.570978f,-0.571056f,-0.571135f,-0.571214f,-0.571292f,-0.571371f,-0.57145f,-0.571528f,-0.571607f,-0.571686f,-0.571764f,-0.571843f,-0.571922f,-0.572f,-0.572079f,-0.572158f,-0.572236f,-0.572315f,-0.572393f,-0.572472f,-0.572551f,-0.572629f,-0.572708f,-0.572787f,-0.572865f,-0.572944f,-0.573022f,-0.573101f,-0.573179f,-0.573258f,-0.573337f,-0.573415f,-0.573494f,-0.573572f,-0.573651f,-0.573729f,-0.573808f,-0.573886f,-0.573965f,-0.574043f,-0.574122f,-0.5742f,-0.574279f,-0.574357f,-0.574436f,-0.574514f,-0.574593f,-0.574671f,-0.57475f,-0.574828f,-0.574906f,-0.574985f,-0.575063f,-0.575142f,-0.57522f,-0.575299f,-0.575377f,-0.575455f,-0.575534f,-0.575612f,-0.575691f,-0.575769f,-0.575848f,-0.575926f,-0.576004f,-0.576083f,-0.576161f,-0.576239f,-0.576318f,-0.576396f,-0.576474f,-0.576553f,-0.576631f,-0.576709f,-0.576788f,-0.576866f,-0.576944f,-0.577023f,-0.577101f,-0.577179f,-0.577257f,-0.577336f,-0.577414f,-0.577492f,-0.577571f,-0.577649f,-0.577727f,-0.577805f,-0.577884f,-0.577962f,-0.57804f,-0.578118f,-0.578197f,-0.578275f,-0.578353f,-0.578431f,-0.578509f,-0.578588f,-0.578666f,-0.578744f,-0.578822f,-0.5789f,-0.578979f,-0.579057f,-0.579135f,-0.579213f,-0.579291f,-0.579369f,-0.579448f,-0.579526f,-0.579604f,-0.579682f,-0.57976f,-0.579838f,-0.579916f,-0.579994f,-0.580072f,-0.580151f,-0.580229f,-0.580307f,-0.580385f,-0.580463f,-0.580541f,-0.580619f,-0.580697f,-0.580775f,-0.580853f,-0.580931f,-0.581009f,-0.581087f,-0.581165f,-0.581243f,-0.581321f,-0.581399f,-0.581477f,-0.581555f,-0.581633f,-0.581711f,-0.581789f,-0.581867f,-0.581945f,-0.582023f,-0.582101f,-0.582179f,-0.582257f,-0.582335f,-0.582413f,-0.582491f,-0.582569f,-0.582647f,-0.582725f,-0.582802f,-0.58288f,-0.582958f,-0.583036f,-0.583114f,-0.583192f,-0.58327f,-0.583348f,-0.583426f,-0.583503f,-0.583581f,-0.583659f,-0.583737f,-0.583815f,-0.583893f,-0.583971f,-0.584048f,-0.584126f,-0.584204f,-0.584282f,-0.584359f,-0.584437f,-0.584515f,-0.584593f,-0.584671f,-0.584749f,-0.584826f,-0.584904f,-0.584982f,-0.585059f,-0.585137f,-0.585215f,-0.585293f,-0.585371f,-0.585448f,-0.585526f,-0.585604f,-0.585681f,-0.585759f,-0.585837f,-0.585915f,-0.585992f,-0.58607f,-0.586147f,-0.586225f,-0.586303f,-0.586381f,-0.586458f,-0.586536f,-0.586614f,-0.586691f,-0.586769f,-0.586846f,-0.586924f,-0.587002f,-0.587079f,-0.587157f,-0.587234f,-0.587312f,-0.58739f,-0.587467f,-0.587545f,-0.587623f,-0.5877f,-0.587778f,-0.587855f,-0.587933f,-0.58801f,-0.588088f,-0.588165f,-0.588243f,-0.58832f,-0.588398f,-0.588475f,-0.588553f,-0.58863f,-0.588708f,-0.588785f,-0.588863f,-0.588941f,-0.589018f,-0.589095f,-0.589173f,-0.58925f,-0.589328f,-0.589405f,-0.589483f,-0.58956f,-0.589638f,-0.589715f,-0.589792f,-0.58987f,-0.589947f,-0.590025f,-0.590102f,-0.59018f,-0.590257f,-0.590334f,-0.590412f,-0.590489f,-0.590566f,-0.590644f,-0.590721f,-0.590799f,-0.590876f,-0.590953f,-0.59103f,-0.591108f,-0.591185f,-0.591262f,-0.59134f,-0.591417f,-0.591494f,-0.591572f,-0.591649f,-0.591726f,-0.591804f,-0.591881f,-0.591958f,-0.592035f,-0.592113f,-0.59219f,-0.592267f,-0.592344f,-0.592422f,-0.592499f,-0.592576f,-0.592653f,-0.592731f,-0.592808f,-0.592885f,-0.592962f,-0.593039f,-0.593117f,-0.593194f,-0.593271f,-0.593348f,-0.593425f,-0.593502f,-0.59358f,-0.593657f,-0.593734f,-0.593811f,-0.593888f,-0.593965f,-0.594043f,-0.59412f,-0.594197f,-0.594274f,-0.594351f,-0.594428f,-0.594505f,-0.594582f,-0.594659f,-0.594736f,-0.594813f,-0.59489f,-0.594968f,-0.595045f,-0.595122f,-0.595199f,-0.595276f,-0.595353f,-0.59543f,-0.595507f,-0.595584f,-0.595661f,-0.595738f,-0.595815f,-0.595892f,-0.595969f,-0.596046f,-0.596123f,-0.5962f,-0.596277f,-0.596354f,-0.596431f,-0.596508f,-0.596585f,-0.596662f,-0.596738f,-0.596815f,-0.596892f,-0.596969f,-0.597046f,-0.597123f,-0.5972f,-0.597277f,-0.597354f,-0.597431f,-0.597507f,-0.597584f,-0.597661f,-0.597738f,-0.597815f,-0.597892f,-0.597969f,-0.598045f,-0.598122f,-0.598199f,-0.598276f,-0.598353f,-0.59843f,-0.598506f,-0.598583f,-0.59866f,-0.598737f,-0.598814f,-0.59889f,-0.598967f,-0.599044f,-0.599121f,-0.599198f,-0.599274f,-0.599351f,-0.599428f,-0.599505f,-0.599581f,-0.599658f,-0.599735f,-0.599811f,-0.599888f,-0.599965f,-0.600041f,-0.600118f,-0.600195f,-0.600272f,-0.600348f,-0.600425f,-0.600502f,-0.600578f,-0.600655f,-0.600732f,-0.600808f,-0.600885f,-0.600961f,-0.601038f,-0.601115f,-0.601191f,-0.601268f,-0.601345f,-0.601421f,-0.601498f,-0.601574f,-0.601651f,-0.601727f,-0.601804f,-0.601881f,-0.601957f,-0.602034f,-0.60211f,-0.602187f,-0.602263f,-0.60234f,-0.602416f,-0.602493f,-0.60257f,-0.602646f,-0.602723f,-0.602799f,-0.602875f,-0.602952f,-0.603028f,-0.603105f,-0.603181f,-0.603258f,-0.603334f,-0.603411f,-0.603487f,-0.603564f,-0.60364f,-0.603716f,-0.603793f,-0.603869f,-0.603946f,-0.604022f,-0.604099f,-0.604175f,-0.604251f,-0.604328f,-0.604404f,-0.604481f,-0.604557f,-0.604633f,-0.60471f,-0.604786f,-0.604862f,-0.604939f,-0.605015f,-0.605091f,-0.605168f,-0.605244f,-0.60532f,-0.605397f,-0.605473f,-0.605549f,-0.605626f,-0.605702f,-0.605778f,-0.605854f,-0.605931f,-0.606007f,-0.606083f,-0.606159f,-0.606236f,-0.606312f,-0.606388f,-0.606464f,-0.606541f,-0.606617f,-0.606693f,-0.606769f,-0.606846f,-0.606922f,-0.606998f,-0.607074f,-0.60715f,-0.607226f,-0.607303f,-0.607379f,-0.607455f,-0.607531f,-0.607607f,-0.607683f,-0.60776f,-0.607836f,-0.607912f,-0.607988f,-0.608064f,-0.60814f,-0.608216f,-0.608292f,-0.608368f,-0.608445f,-0.608521f,-0.608597f,-0.608673f,-0.608749f,-0.608825f,-0.608901f,-0.608977f,-0.609053f,-0.609129f,-0.609205f,-0.609281f,-0.609357f,-0.609433f,-0.609509f,-0.609585f,-0.609661f,-0.609737f,-0.609813f,-0.609889f,-0.609965f,-0.610041f,-0.610117f,-0.610193f,-0.610269f,-0.610345f,-0.610421f,-0.610497f,-0.610573f,-0.610649f,-0.610725f,-0.610801f,-0.610876f,-0.610952f,-0.611028f,-0.611104f,-0.61118f,-0.611256f,-0.611332f,-0.611408f,-0.611483f,-0.611559f,-0.611635f,-0.611711f,-0.611787f,-0.611863f,-0.611939f,-0.612014f,-0.61209f,-0.612166f,-0.612242f,-0.612318f,-0.612393f,-0.612469f,-0.612545f,-0.612621f,-0.612697f,-0.612772f,-0.612848f,-0.612924f,-0.613f,-0.613075f,-0.613151f,-0.613227f,-0.613302f,-0.613378f,-0.613454f,-0.61353f,-0.613605f,-0.613681f,-0.613757f,-0.613832f,-0.613908f,-0.613984f,-0.614059f,-0.614135f,-0.614211f,-0.614287f,-0.614362f,-0.614438f,-0.614513f,-0.614589f,-0.614665f,-0.61474f,-0.614816f,-0.614892f,-0.614967f,-0.615043f,-0.615118f,-0.615194f,-0.615269f,-0.615345f,-0.615421f,-0.615496f,-0.615572f,-0.615647f,-0.615723f,-0.615798f,-0.615874f,-0.615949f,-0.616025f,-0.616101f,-0.616176f,-0.616252f,-0.616327f,-0.616403f,-0.616478f,-0.616553f,-0.616629f,-0.616705f,-0.61678f,-0.616855f,-0.616931f,-0.617006f,-0.617082f,-0.617157f,-0.617233f,-0.617308f,-0.617383f,-0.617459f,-0.617534f,-0.61761f,-0.617685f,-0.61776f,-0.617836f,-0.617911f,-0.617987f,-0.618062f,-0.618137f,-0.618213f,-0.618288f,-0.618363f,-0.618439f,-0.618514f,-0.61859f,-0.618665f,-0.61874f,-0.618815f,-0.618891f,-0.618966f,-0.619041f,-0.619117f,-0.619192f,-0.619267f,-0.619342f,-0.619418f,-0.619493f,-0.619568f,-0.619643f,-0.619719f,-0.619794f,-0.619869f,-0.619944f,-0.62002f,-0.620095f,-0.62017f,-0.620245f,-0.620321f,-0.620396f,-0.620471f,-0.620546f,-0.620621f,-0.620696f,-0.620772f,-0.620847f,-0.620922f,-0.620997f,-0.621072f,-0.621147f,-0.621222f,-0.621298f,-0.621373f,-0.621448f,-0.621523f,-0.621598f,-0.621673f,-0.621748f,-0.621823f,-0.621898f,-0.621973f,-0.622048f,-0.622124f,-0.622199f,-0.622274f,-0.622349f,-0.622424f,-0.622499f,-0.622574f,-0.622649f,-0.622724f,-0.622799f,-0.622874f,-0.622949f,-0.623024f,-0.623099f,-0.623174f,-0.623249f,-0.623324f,-0.623399f,-0.623474f,-0.623549f,-0.623624f,-0.623699f,-0.623774f,-0.623848f,-0.623924f,-0.623998f,-0.624073f,-0.624148f,-0.624223f,-0.624298f,-0.624373f,-0.624448f,-0.624523f,-0.624598f,-0.624672f,-0.624747f,-0.624822f,-0.624897f,-0.624972f,-0.625047f,-0.625121f,-0.625196f,-0.625271f,-0.625346f,-0.625421f,-0.625496f,-0.62557f,-0.625645f,-0.62572f,-0.625795f,-0.62587f,-0.625944f,-0.626019f,-0.626094f,-0.626169f,-0.626243f,-0.626318f,-0.626393f,-0.626468f,-0.626542f,-0.626617f,-0.626692f,-0.626766f,-0.626841f,-0.626916f,-0.626991f,-0.627065f,-0.62714f,-0.627215f,-0.627289f,-0.627364f,-0.627438f,-0.627513f,-0.627588f,-0.627663f,-0.627737f,-0.627812f,-0.627886f,-0.627961f,-0.628036f,-0.62811f,-0.628185f,-0.628259f,-0.628334f,-0.628409f,-0.628483f,-0.628558f,-0.628632f,-0.628707f,-0.628781f,-0.628856f,-0.628931f,-0.629005f,-0.62908f,-0.629154f,-0.629229f,-0.629303f,-0.629378f,-0.629452f,-0.629527f,-0.629601f,-0.629676f,-0.62975f,-0.629824f,-0.629899f,-0.629974f,-0.630048f,-0.630122f,-0.630197f,-0.630271f,-0.630346f,-0.63042f,-0.630494f,-0.630569f,-0.630643f,-0.630718f,-0.630792f,-0.630867f,-0.630941f,-0.631015f,-0.63109f,-0.631164f,-0.631238f,-0.631313f,-0.631387f,-0.631461f,-0.631536f,-0.63161f,-0.631684f,-0.631759f,-0.631833f,-0.631907f,-0.631982f,-0.632056f,-0.63213f,-0.632204f,-0.632279f,-0.632353f,-0.632427f,-0.632502f,-0.632576f,-0.63265f,-0.632724f,-0.632799f,-0.632873f,-0.632947f,-0.633021f,-0.633096f,-0.63317f,-0.633244f,-0.633318f,-0.633392f,-0.633466f,-0.633541f,-0.633615f,-0.633689f,-0.633763f,-0.633837f,-0.633911f,-0.633986f,-0.63406f,-0.634134f,-0.634208f,-0.634282f,-0.634356f,-0.63443f,-0.634504f,-0.634579f,-0.634653f,-0.634727f,-0.634801f,-0.634875f,-0.634949f,-0.635023f,-0.635097f,-0.635171f,-0.635245f,-0.635319f,-0.635393f,-0.635467f,-0.635541f,-0.635615f,-0.635689f,-0.635763f,-0.635837f,-0.635911f,-0.635985f,-0.636059f,-0.636133f,-0.636207f,-0.636281f,-0.636355f,-0.636429f,-0.636503f,-0.636577f,-0.636651f,-0.636725f,-0.636799f,-0.636873f,-0.636947f,-0.637021f,-0.637094f,-0.637169f,-0.637242f,-0.637316f,-0.63739f,-0.637464f,-0.637538f,-0.637612f,-0.637685f,-0.637759f,-0.637833f,-0.637907f,-0.637981f,-0.638055f,-0.638129f,-0.638202f,-0.638276f,-0.63835f,-0.638424f,-0.638498f,-0.638571f,-0.638645f,-0.638719f,-0.638793f,-0.638866f,-0.63894f,-0.639014f,-0.639088f,-0.639161f,-0.639235f,-0.639309f,-0.639383f,-0.639456f,-0.63953f,-0.639604f,-0.639677f,-0.639751f,-0.639825f,-0.639898f,-0.639972f,-0.640046f,-0.64012f,-0.640193f,-0.640267f,-0.64034f,-0.640414f,-0.640488f,-0.640561f,-0.640635f,-0.640708f,-0.640782f,-0.640856f,-0.640929f,-0.641003f,-0.641076f,-0.64115f,-0.641224f,-0.641297f,-0.641371f,-0.641444f,-0.641518f,-0.641591f,-0.641665f,-0.641738f,-0.641812f,-0.641885f,-0.641959f,-0.642033f,-0.642106f,-0.64218f,-0.642253f,-0.642326f,-0.6424f,-0.642473f,-0.642547f,-0.64262f,-0.642694f,-0.642767f,-0.642841f,-0.642914f,-0.642988f,-0.643061f,-0.643135f,-0.643208f,-0.643281f,-0.643355f,-0.643428f,-0.643501f,-0.643575f,-0.643648f,-0.643722f,-0.643795f,-0.643868f,-0.643942f,-0.644015f,-0.644088f,-0.644162f,-0.644235f,-0.644308f,-0.644382f,-0.644455f,-0.644528f,-0.644602f,-0.644675f,-0.644748f,-0.644821f,-0.644895f,-0.644968f,-0.645041f,-0.645115f,-0.645188f,-0.645261f,-0.645334f,-0.645407f,-0.645481f,-0.645554f,-0.645627f,-0.6457f,-0.645774f,-0.645847f,-0.64592f,-0.645993f,-0.646066f,-0.64614f,-0.646213f,-0.646286f,-0.646359f,-0.646432f,-0.646505f,-0.646578f,-0.646652f,-0.646725f,-0.646798f,-0.646871f,-0.646944f,-0.647017f,-0.64709f,-0.647163f,-0.647237f,-0.64731f,-0.647383f,-0.647456f,-0.647529f,-0.647602f,-0.647675f,-0.647748f,-0.647821f,-0.647894f,-0.647967f,-0.64804f,-0.648113f,-0.648186f,-0.648259f,-0.648332f,-0.648405f,-0.648478f,-0.648551f,-0.648624f,-0.648697f,-0.64877f,-0.648843f,-0.648916f,-0.648989f,-0.649062f,-0.649135f,-0.649208f,-0.64928f,-0.649353f,-0.649426f,-0.649499f,-0.649572f,-0.649645f,-0.649718f,-0.649791f,-0.649864f,-0.649936f,-0.650009f,-0.650082f,-0.650155f,-0.650228f,-0.650301f,-0.650374f,-0.650446f,-0.650519f,-0.650592f,-0.650665f,-0.650737f,-0.65081f,-0.650883f,-0.650956f,-0.651029f,-0.651101f,-0.651174f,-0.651247f,-0.65132f,-0.651393f,-0.651465f,-0.651538f,-0.651611f,-0.651683f,-0.651756f,-0.651829f,-0.651901f,-0.651974f,-0.652047f,-0.65212f,-0.652192f,-0.652265f,-0.652338f,-0.65241f,-0.652483f,-0.652556f,-0.652628f,-0.652701f,-0.652774f,-0.652846f,-0.652919f,-0.652991f,-0.653064f,-0.653137f,-0.653209f,-0.653282f,-0.653354f,-0.653427f,-0.6535f,-0.653572f,-0.653645f,-0.653717f,-0.65379f,-0.653862f,-0.653935f,-0.654007f,-0.65408f,-0.654152f,-0.654225f,-0.654298f,-0.65437f,-0.654442f,-0.654515f,-0.654587f,-0.65466f,-0.654732f,-0.654805f,-0.654877f,-0.65495f,-0.655022f,-0.655095f,-0.655167f,-0.655239f,-0.655312f,-0.655384f,-0.655457f,-0.655529f,-0.655602f,-0.655674f,-0.655746f,-0.655819f,-0.655891f,-0.655963f,-0.656036f,-0.656108f,-0.656181f,-0.656253f,-0.656325f,-0.656397f,-0.65647f,-0.656542f,-0.656615f,-0.656687f,-0.656759f,-0.656831f,-0.656904f,-0.656976f,-0.657048f,-0.65712f,-0.657193f,-0.657265f,-0.657337f,-0.65741f,-0.657482f,-0.657554f,-0.657626f,-0.657698f,-0.657771f,-0.657843f,-0.657915f,-0.657987f,-0.658059f,-0.658132f,-0.658204f,-0.658276f,-0.658348f,-0.65842f,-0.658493f,-0.658565f,-0.658637f,-0.658709f,-0.658781f,-0.658853f,-0.658925f,-0.658997f,-0.65907f,-0.659142f,-0.659214f,-0.659286f,-0.659358f,-0.65943f,-0.659502f,-0.659574f,-0.659646f,-0.659718f,-0.65979f,-0.659862f,-0.659934f,-0.660006f,-0.660078f,-0.660151f,-0.660222f,-0.660294f,-0.660366f,-0.660438f,-0.66051f,-0.660582f,-0.660654f,-0.660726f,-0.660798f,-0.66087f,-0.660942f,-0.661014f,-0.661086f,-0.661158f,-0.66123f,-0.661302f,-0.661374f,-0.661446f,-0.661518f,-0.66159f,-0.661661f,-0.661733f,-0.661805f,-0.661877f,-0.661949f,-0.662021f,-0.662093f,-0.662164f,-0.662236f,-0.662308f,-0.66238f,-0.662452f,-0.662524f,-0.662595f,-0.662667f,-0.662739f,-0.662811f,-0.662883f,-0.662954f,-0.663026f,-0.663098f,-0.66317f,-0.663241f,-0.663313f,-0.663385f,-0.663457f,-0.663528f,-0.6636f,-0.663672f,-0.663744f,-0.663815f,-0.663887f,-0.663959f,-0.66403f,-0.664102f,-0.664174f,-0.664245f,-0.664317f,-0.664389f,-0.66446f,-0.664532f,-0.664604f,-0.664675f,-0.664747f,-0.664819f,-0.66489f,-0.664962f,-0.665033f,-0.665105f,-0.665176f,-0.665248f,-0.66532f,-0.665391f,-0.665463f,-0.665534f,-0.665606f,-0.665677f,-0.665749f,-0.66582f,-0.665892f,-0.665964f,-0.666035f,-0.666107f,-0.666178f,-0.66625f,-0.666321f,-0.666393f,-0.666464f,-0.666536f,-0.666607f,-0.666679f,-0.66675f,-0.666821f,-0.666893f,-0.666964f,-0.667036f,-0.667107f,-0.667179f,-0.66725f,-0.667321f,-0.667393f,-0.667464f,-0.667535f,-0.667607f,-0.667678f,-0.66775f,-0.667821f,-0.667892f,-0.667964f,-0.668035f,-0.668106f,-0.668178f,-0.668249f,-0.66832f,-0.668392f,-0.668463f,-0.668534f,-0.668606f,-0.668677f,-0.668748f,-0.66882f,-0.668891f,-0.668962f,-0.669033f,-0.669105f,-0.669176f,-0.669247f,-0.669318f,-0.66939f,-0.669461f,-0.669532f,-0.669603f,-0.669674f,-0.669746f,-0.669817f,-0.669888f,-0.669959f,-0.67003f,-0.670102f,-0.670173f,-0.670244f,-0.670315f,-0.670386f,-0.670457f,-0.670528f,-0.6706f,-0.670671f,-0.670742f,-0.670813f,-0.670884f,-0.670955f,-0.671026f,-0.671097f,-0.671168f,-0.671239f,-0.67131f,-0.671381f,-0.671452f,-0.671523f,-0.671595f,-0.671666f,-0.671737f,-0.671808f,-0.671879f,-0.67195f,-0.672021f,-0.672092f,-0.672163f,-0.672234f,-0.672305f,-0.672376f,-0.672447f,-0.672517f,-0.672588f,-0.672659f,-0.67273f,-0.672801f,-0.672872f,-0.672943f,-0.673014f,-0.673085f,-0.673156f,-0.673227f,-0.673298f,-0.673368f,-0.673439f,-0.67351f,-0.673581f,-0.673652f,-0.673723f,-0.673794f,-0.673864f,-0.673935f,-0.674006f,-0.674077f,-0.674148f,-0.674219f,-0.674289f,-0.67436f,-0.674431f,-0.674502f,-0.674573f,-0.674643f,-0.674714f,-0.674785f,-0.674856f,-0.674926f,-0.674997f,-0.675068f,-0.675139f,-0.675209f,-0.67528f,-0.675351f,-0.675421f,-0.675492f,-0.675563f,-0.675633f,-0.675704f,-0.675775f,-0.675846f,-0.675916f,-0.675987f,-0.676057f,-0.676128f,-0.676199f,-0.676269f,-0.67634f,-0.676411f,-0.676481f,-0.676552f,-0.676622f,-0.676693f,-0.676764f,-0.676834f,-0.676905f,-0.676975f,-0.677046f,-0.677116f,-0.677187f,-0.677257f,-0.677328f,-0.677399f,-0.677469f,-0.67754f,-0.67761f,-0.677681f,-0.677751f,-0.677822f,-0.677892f,-0.677963f,-0.678033f,-0.678104f,-0.678174f,-0.678244f,-0.678315f,-0.678385f,-0.678456f,-0.678526f,-0.678597f,-0.678667f,-0.678737f,-0.678808f,-0.678878f,-0.678949f,-0.679019f,-0.679089f,-0.67916f,-0.67923f,-0.679301f,-0.679371f,-0.679441f,-0.679512f,-0.679582f,-0.679652f,-0.679723f,-0.679793f,-0.679863f,-0.679933f,-0.680004f,-0.680074f,-0.680144f,-0.680215f,-0.680285f,-0.680355f,-0.680425f,-0.680496f,-0.680566f,-0.680636f,-0.680706f,-0.680777f,-0.680847f,-0.680917f,-0.680987f,-0.681058f,-0.681128f,-0.681198f,-0.681268f,-0.681338f,-0.681409f,-0.681479f,-0.681549f,-0.681619f,-0.681689f,-0.681759f,-0.681829f,-0.681899f,-0.68197f,-0.68204f,-0.68211f,-0.68218f,-0.68225f,-0.68232f,-0.68239f,-0.68246f,-0.68253f,-0.6826f,-0.682671f,-0.682741f,-0.682811f,-0.682881f,-0.682951f,-0.683021f,-0.683091f,-0.683161f,-0.683231f,-0.683301f,-0.683371f,-0.683441f,-0.683511f,-0.683581f,-0.683651f,-0.683721f,-0.683791f,-0.683861f,-0.683931f,-0.684f,-0.68407f,-0.68414f,-0.68421f,-0.68428f,-0.68435f,-0.68442f,-0.68449f,-0.68456f,-0.68463f,-0.684699f,-0.684769f,-0.684839f,-0.684909f,-0.684979f,-0.685049f,-0.685119f,-0.685188f,-0.685258f,-0.685328f,-0.685398f,-0.685468f,-0.685538f,-0.685607f,-0.685677f,-0.685747f,-0.685817f,-0.685887f,-0.685956f,-0.686026f,-0.686096f,-0.686166f,-0.686235f,-0.686305f,-0.686375f,-0.686445f,-0.686514f,-0.686584f,-0.686654f,-0.686723f,-0.686793f,-0.686863f,-0.686932f,-0.687002f,-0.687072f,-0.687141f,-0.687211f,-0.687281f,-0.68735f,-0.68742f,-0.687489f,-0.687559f,-0.687629f,-0.687698f,-0.687768f,-0.687838f,-0.687907f,-0.687977f,-0.688046f,-0.688116f,-0.688185f,-0.688255f,-0.688325f,-0.688394f,-0.688464f,-0.688533f,-0.688603f,-0.688672f,-0.688742f,-0.688811f,-0.688881f,-0.68895f,-0.68902f,-0.689089f,-0.689159f,-0.689228f,-0.689298f,-0.689367f,-0.689436f,-0.689506f,-0.689575f,-0.689645f,-0.689714f,-0.689784f,-0.689853f,-0.689922f,-0.689992f,-0.690061f,-0.690131f,-0.6902f,-0.690269f,-0.690339f,-0.690408f,-0.690477f,-0.690547f,-0.690616f,-0.690685f,-0.690755f,-0.690824f,-0.690893f,-0.690963f,-0.691032f,-0.691101f,-0.691171f,-0.69124f,-0.691309f,-0.691378f,-0.691448f,-0.691517f,-0.691586f,-0.691656f,-0.691725f,-0.691794f,-0.691863f,-0.691932f,-0.692002f,-0.692071f,-0.69214f,-0.692209f,-0.692278f,-0.692348f,-0.692417f,-0.692486f,-0.692555f,-0.692624f,-0.692693f,-0.692763f,-0.692832f,-0.692901f,-0.69297f,-0.693039f,-0.693108f,-0.693177f,-0.693246f,-0.693316f,-0.693385f,-0.693454f,-0.693523f,-0.693592f,-0.693661f,-0.69373f,-0.693799f,-0.693868f,-0.693937f,-0.694006f,-0.694075f,-0.694144f,-0.694213f,-0.694282f,-0.694351f,-0.69442f,-0.694489f,-0.694558f,-0.694627f,-0.694696f,-0.694765f,-0.694834f,-0.694903f,-0.694972f,-0.695041f,-0.69511f,-0.695179f,-0.695247f,-0.695316f,-0.695385f,-0.695454f,-0.695523f,-0.695592f,-0.695661f,-0.69573f,-0.695799f,-0.695867f,-0.695936f,-0.696005f,-0.696074f,-0.696143f,-0.696212f,-0.69628f,-0.696349f,-0.696418f,-0.696487f,-0.696556f,-0.696624f,-0.696693f,-0.696762f,-0.696831f,-0.696899f,-0.696968f,-0.697037f,-0.697106f,-0.697175f,-0.697243f,-0.697312f,-0.697381f,-0.697449f,-0.697518f,-0.697587f,-0.697656f,-0.697724f,-0.697793f,-0.697861f,-0.69793f,-0.697999f,-0.698067f,-0.698136f,-0.698205f,-0.698273f,-0.698342f,-0.698411f,-0.698479f,-0.698548f,-0.698616f,-0.698685f,-0.698754f,-0.698822f,-0.698891f,-0.698959f,-0.699028f,-0.699096f,-0.699165f,-0.699233f,-0.699302f,-0.699371f,-0.699439f,-0.699508f,-0.699576f,-0.699645f,-0.699713f,-0.699782f,-0.69985f,-0.699919f,-0.699987f,-0.700056f,-0.700124f,-0.700192f,-0.700261f,-0.700329f,-0.700398f,-0.700466f,-0.700535f,-0.700603f,-0.700671f,-0.70074f,-0.700808f,-0.700877f,-0.700945f,-0.701014f,-0.701082f,-0.70115f,-0.701218f,-0.701287f,-0.701355f,-0.701423f,-0.701492f,-0.70156f,-0.701629f,-0.701697f,-0.701765f,-0.701833f,-0.701902f,-0.70197f,-0.702038f,-0.702107f,-0.702175f,-0.702243f,-0.702311f,-0.70238f,-0.702448f,-0.702516f,-0.702584f,-0.702653f,-0.702721f,-0.702789f,-0.702857f,-0.702925f,-0.702993f,-0.703062f,-0.70313f,-0.703198f,-0.703266f,-0.703334f,-0.703403f,-0.703471f,-0.703539f,-0.703607f,-0.703675f,-0.703743f,-0.703811f,-0.703879f,-0.703947f,-0.704016f,-0.704084f,-0.704152f,-0.70422f,-0.704288f,-0.704356f,-0.704424f,-0.704492f,-0.70456f,-0.704628f,-0.704696f,-0.704764f,-0.704832f,-0.7049f,-0.704968f,-0.705036f,-0.705104f,-0.705172f,-0.70524f,-0.705308f,-0.705376f,-0.705444f,-0.705512f,-0.70558f,-0.705648f,-0.705716f,-0.705784f,-0.705851f,-0.70592f,-0.705987f,-0.706055f,-0.706123f,-0.706191f,-0.706259f,-0.706327f,-0.706395f,-0.706463f,-0.70653f,-0.706598f,-0.706666f,-0.706734f,-0.706802f,-0.706869f,-0.706937f,-0.707005f,-0.707073f,-0.707141f,-0.707209f,-0.707276f,-0.707344f,-0.707412f,-0.70748f,-0.707547f,-0.707615f,-0.707683f,-0.707751f,-0.707818f,-0.707886f,-0.707954f,-0.708021f,-0.708089f,-0.708157f,-0.708225f,-0.708292f,-0.70836f,-0.708428f,-0.708495f,-0.708563f,-0.708631f,-0.708698f,-0.708766f,-0.708833f,-0.708901f,-0.708969f,-0.709036f,-0.709104f,-0.709172f,-0.709239f,-0.709307f,-0.709374f,-0.709442f,-0.709509f,-0.709577f,-0.709644f,-0.709712f,-0.70978f,-0.709847f,-0.709915f,-0.709982f,-0.71005f,-0.710117f,-0.710185f,-0.710252f,-0.71032f,-0.710387f,-0.710455f,-0.710522f,-0.71059f,-0.710657f,-0.710724f,-0.710792f,-0.710859f,-0.710927f,-0.710994f,-0.711062f,-0.711129f,-0.711196f,-0.711264f,-0.711331f,-0.711399f,-0.711466f,-0.711533f,-0.711601f,-0.711668f,-0.711735f,-0.711803f,-0.71187f,-0.711937f,-0.712005f,-0.712072f,-0.712139f,-0.712207f,-0.712274f,-0.712341f,-0.712408f,-0.712476f,-0.712543f,-0.71261f,-0.712678f,-0.712745f,-0.712812f,-0.712879f,-0.712946f,-0.713014f,-0.713081f,-0.713148f,-0.713215f,-0.713283f,-0.71335f,-0.713417f,-0.713484f,-0.713551f,-0.713619f,-0.713686f,-0.713753f,-0.71382f,-0.713887f,-0.713954f,-0.714021f,-0.714089f,-0.714156f,-0.714223f,-0.71429f,-0.714357f,-0.714424f,-0.714491f,-0.714558f,-0.714625f,-0.714692f,-0.714759f,-0.714826f,-0.714893f,-0.71496f,-0.715027f,-0.715094f,-0.715162f,-0.715229f,-0.715296f,-0.715363f,-0.71543f,-0.715496f,-0.715563f,-0.71563f,-0.715698f,-0.715764f,-0.715831f,-0.715898f,-0.715965f,-0.716032f,-0.716099f,-0.716166f,-0.716233f,-0.7163f,-0.716367f,-0.716434f,-0.7165f,-0.716567f,-0.716634f,-0.716701f,-0.716768f,-0.716835f,-0.716902f,-0.716968f,-0.717035f,-0.717102f,-0.717169f,-0.717236f,-0.717303f,-0.717369f,-0.717436f,-0.717503f,-0.71757f,-0.717636f,-0.717703f,-0.71777f,-0.717837f,-0.717904f,-0.71797f,-0.718037f,-0.718104f,-0.71817f,-0.718237f,-0.718304f,-0.71837f,-0.718437f,-0.718504f,-0.718571f,-0.718637f,-0.718704f,-0.718771f,-0.718837f,-0.718904f,-0.718971f,-0.719037f,-0.719104f,-0.71917f,-0.719237f,-0.719304f,-0.71937f,-0.719437f,-0.719503f,-0.71957f,-0.719637f,-0.719703f,-0.71977f,-0.719836f,-0.719903f,-0.719969f,-0.720036f,-0.720102f,-0.720169f,-0.720235f,-0.720302f,-0.720368f,-0.720435f,-0.720501f,-0.720568f,-0.720634f,-0.720701f,-0.720767f,-0.720834f,-0.7209f,-0.720967f,-0.721033f,-0.7211f,-0.721166f,-0.721232f,-0.721299f,-0.721365f,-0.721431f,-0.721498f,-0.721564f,-0.721631f,-0.721697f,-0.721763f,-0.72183f,-0.721896f,-0.721962f,-0.722029f,-0.722095f,-0.722162f,-0.722228f,-0.722294f,-0.72236f,-0.722427f,-0.722493f,-0.722559f,-0.722625f,-0.722692f,-0.722758f,-0.722824f,-0.722891f,-0.722957f,-0.723023f,-0.723089f,-0.723155f,-0.723222f,-0.723288f,-0.723354f,-0.72342f,-0.723486f,-0.723553f,-0.723619f,-0.723685f,-0.723751f,-0.723817f,-0.723884f,-0.72395f,-0.724016f,-0.724082f,-0.724148f,-0.724214f,-0.72428f,-0.724346f,-0.724412f,-0.724479f,-0.724545f,-0.724611f,-0.724677f,-0.724743f,-0.724809f,-0.724875f,-0.724941f,-0.725007f,-0.725073f,-0.725139f,-0.725205f,-0.725271f,-0.725337f,-0.725403f,-0.725469f,-0.725535f,-0.725601f,-0.725667f,-0.725733f,-0.725799f,-0.725865f,-0.725931f,-0.725997f,-0.726063f,-0.726129f,-0.726194f,-0.72626f,-0.726326f,-0.726392f,-0.726458f,-0.726524f,-0.72659f,-0.726656f,-0.726722f,-0.726787f,-0.726853f,-0.726919f,-0.726985f,-0.727051f,-0.727117f,-0.727182f,-0.727248f,-0.727314f,-0.72738f,-0.727446f,-0.727511f,-0.727577f,-0.727643f,-0.727709f,-0.727774f,-0.72784f,-0.727906f,-0.727972f,-0.728037f,-0.728103f,-0.728169f,-0.728235f,-0.7283f,-0.728366f,-0.728432f,-0.728497f,-0.728563f,-0.728629f,-0.728694f,-0.72876f,-0.728826f,-0.728891f,-0.728957f,-0.729022f,-0.729088f,-0.729154f,-0.729219f,-0.729285f,-0.729351f,-0.729416f,-0.729482f,-0.729547f,-0.729613f,-0.729678f,-0.729744f,-0.72981f,-0.729875f,-0.729941f,-0.730006f,-0.730072f,-0.730137f,-0.730203f,-0.730268f,-0.730334f,-0.730399f,-0.730465f,-0.73053f,-0.730596f,-0.730661f,-0.730727f,-0.730792f,-0.730857f,-0.730923f,-0.730988f,-0.731054f,-0.731119f,-0.731185f,-0.73125f,-0.731315f,-0.731381f,-0.731446f,-0.731511f,-0.731577f,-0.731642f,-0.731708f,-0.731773f,-0.731838f,-0.731904f,-0.731969f,-0.732034f,-0.732099f,-0.732165f,-0.73223f,-0.732295f,-0.732361f,-0.732426f,-0.732491f,-0.732556f,-0.732622f,-0.732687f,-0.732752f,-0.732818f,-0.732883f,-0.732948f,-0.733013f,-0.733078f,-0.733144f,-0.733209f,-0.733274f,-0.733339f,-0.733404f,-0.733469f,-0.733535f,-0.7336f,-0.733665f,-0.73373f,-0.733795f,-0.73386f,-0.733926f,-0.733991f,-0.734056f,-0.734121f,-0.734186f,-0.734251f,-0.734316f,-0.734381f,-0.734446f,-0.734511f,-0.734576f,-0.734641f,-0.734706f,-0.734771f,-0.734836f,-0.734902f,-0.734967f,-0.735032f,-0.735097f,-0.735162f,-0.735227f,-0.735291f,-0.735356f,-0.735422f,-0.735486f,-0.735551f,-0.735616f,-0.735681f,-0.735746f,-0.735811f,-0.735876f,-0.735941f,-0.736006f,-0.736071f,-0.736136f,-0.736201f,-0.736265f,-0.73633f,-0.736395f,-0.73646f,-0.736525f,-0.73659f,-0.736655f,-0.736719f,-0.736784f,-0.736849f,-0.736914f,-0.736979f,-0.737043f,-0.737108f,-0.737173f,-0.737238f,-0.737303f,-0.737367f,-0.737432f,-0.737497f,-0.737562f,-0.737626f,-0.737691f,-0.737756f,-0.737821f,-0.737885f,-0.73795f,-0.738015f,-0.738079f,-0.738144f,-0.738209f,-0.738273f,-0.738338f,-0.738403f,-0.738467f,-0.738532f,-0.738597f,-0.738661f,-0.738726f,-0.738791f,-0.738855f,-0.73892f,-0.738984f,-0.739049f,-0.739114f,-0.739178f,-0.739243f,-0.739307f,-0.739372f,-0.739436f,-0.739501f,-0.739565f,-0.73963f,-0.739694f,-0.739759f,-0.739823f,-0.739888f,-0.739952f,-0.740017f,-0.740081f,-0.740146f,-0.74021f,-0.740275f,-0.740339f,-0.740404f,-0.740468f,-0.740533f,-0.740597f,-0.740661f,-0.740726f,-0.74079f,-0.740855f,-0.740919f,-0.740983f,-0.741048f,-0.741112f,-0.741177f,-0.741241f,-0.741305f,-0.74137f,-0.741434f,-0.741498f,-0.741562f,-0.741627f,-0.741691f,-0.741756f,-0.74182f,-0.741884f,-0.741948f,-0.742013f,-0.742077f,-0.742141f,-0.742206f,-0.74227f,-0.742334f,-0.742398f,-0.742462f,-0.742527f,-0.742591f,-0.742655f,-0.742719f,-0.742783f,-0.742848f,-0.742912f,-0.742976f,-0.74304f,-0.743104f,-0.743168f,-0.743233f,-0.743297f,-0.743361f,-0.743425f,-0.743489f,-0.743553f,-0.743617f,-0.743681f,-0.743746f,-0.74381f,-0.743874f,-0.743938f,-0.744002f,-0.744066f,-0.74413f,-0.744194f,-0.744258f,-0.744322f,-0.744386f,-0.74445f,-0.744514f,-0.744578f,-0.744642f,-0.744706f,-0.74477f,-0.744834f,-0.744898f,-0.744962f,-0.745026f,-0.74509f,-0.745154f,-0.745218f,-0.745282f,-0.745346f,-0.745409f,-0.745473f,-0.745537f,-0.745601f,-0.745665f,-0.745729f,-0.745793f,-0.745857f,-0.745921f,-0.745984f,-0.746048f,-0.746112f,-0.746176f,-0.74624f,-0.746304f,-0.746367f,-0.746431f,-0.746495f,-0.746559f,-0.746623f,-0.746686f,-0.74675f,-0.746814f,-0.746878f,-0.746941f,-0.747005f,-0.747069f,-0.747133f,-0.747196f,-0.74726f,-0.747324f,-0.747387f,-0.747451f,-0.747515f,-0.747578f,-0.747642f,-0.747706f,-0.747769f,-0.747833f,-0.747897f,-0.74796f,-0.748024f,-0.748088f,-0.748151f,-0.748215f,-0.748278f,-0.748342f,-0.748406f,-0.748469f,-0.748533f,-0.748596f,-0.74866f,-0.748724f,-0.748787f,-0.748851f,-0.748914f,-0.748978f,-0.749041f,-0.749105f,-0.749168f,-0.749232f,-0.749295f,-0.749359f,-0.749422f,-0.749486f,-0.749549f,-0.749613f,-0.749676f,-0.749739f,-0.749803f,-0.749866f,-0.74993f,-0.749993f,-0.750057f,-0.75012f,-0.750183f,-0.750247f,-0.75031f,-0.750373f,-0.750437f,-0.7505f,-0.750564f,-0.750627f,-0.75069f,-0.750754f,-0.750817f,-0.75088f,-0.750944f,-0.751007f,-0.75107f,-0.751134f,-0.751197f,-0.75126f,-0.751323f,-0.751387f,-0.75145f,-0.751513f,-0.751576f,-0.75164f,-0.751703f,-0.751766f,-0.751829f,-0.751893f,-0.751956f,-0.752019f,-0.752082f,-0.752145f,-0.752209f,-0.752272f,-0.752335f,-0.752398f,-0.752461f,-0.752524f,-0.752587f,-0.752651f,-0.752714f,-0.752777f,-0.75284f,-0.752903f,-0.752966f,-0.753029f,-0.753092f,-0.753155f,-0.753218f,-0.753281f,-0.753344f,-0.753407f,-0.753471f,-0.753534f,-0.753597f,-0.75366f,-0.753723f,-0.753786f,-0.753849f,-0.753912f,-0.753975f,-0.754038f,-0.754101f,-0.754164f,-0.754227f,-0.754289f,-0.754352f,-0.754415f,-0.754478f,-0.754541f,-0.754604f,-0.754667f,-0.75473f,-0.754793f,-0.754856f,-0.754919f,-0.754981f,-0.755044f,-0.755107f,-0.75517f,-0.755233f,-0.755296f,-0.755359f,-0.755421f,-0.755484f,-0.755547f,-0.75561f,-0.755673f,-0.755735f,-0.755798f,-0.755861f,-0.755924f,-0.755986f,-0.756049f,-0.756112f,-0.756175f,-0.756237f,-0.7563f,-0.756363f,-0.756426f,-0.756488f,-0.756551f,-0.756614f,-0.756676f,-0.756739f,-0.756802f,-0.756864f,-0.756927f,-0.75699f,-0.757052f,-0.757115f,-0.757178f,-0.75724f,-0.757303f,-0.757365f,-0.757428f,-0.757491f,-0.757553f,-0.757616f,-0.757678f,-0.757741f,-0.757804f,-0.757866f,-0.757929f,-0.757991f,-0.758054f,-0.758116f,-0.758179f,-0.758241f,-0.758304f,-0.758366f,-0.758429f,-0.758491f,-0.758554f,-0.758616f,-0.758678f,-0.758741f,-0.758804f,-0.758866f,-0.758928f,-0.758991f,-0.759053f,-0.759116f,-0.759178f,-0.75924f,-0.759303f,-0.759365f,-0.759428f,-0.75949f,-0.759552f,-0.759615f,-0.759677f,-0.759739f,-0.759802f,-0.759864f,-0.759926f,-0.759989f,-0.760051f,-0.760113f,-0.760176f,-0.760238f,-0.7603f,-0.760362f,-0.760425f,-0.760487f,-0.760549f,-0.760611f,-0.760674f,-0.760736f,-0.760798f,-0.760861f,-0.760923f,-0.760985f,-0.761047f,-0.761109f,-0.761171f,-0.761234f,-0.761296f,-0.761358f,-0.76142f,-0.761482f,-0.761544f,-0.761606f,-0.761668f,-0.761731f,-0.761793f,-0.761855f,-0.761917f,-0.761979f,-0.762041f,-0.762103f,-0.762165f,-0.762227f,-0.762289f,-0.762352f,-0.762414f,-0.762476f,-0.762538f,-0.7626f,-0.762662f,-0.762724f,-0.762785f,-0.762848f,-0.76291f,-0.762972f,-0.763034f,-0.763096f,-0.763158f,-0.763219f,-0.763281f,-0.763343f,-0.763405f,-0.763467f,-0.763529f,-0.763591f,-0.763653f,-0.763715f,-0.763777f,-0.763839f,-0.763901f,-0.763962f,-0.764024f,-0.764086f,-0.764148f,-0.76421f,-0.764272f,-0.764333f,-0.764395f,-0.764457f,-0.764519f,-0.764581f,-0.764642f,-0.764704f,-0.764766f,-0.764828f,-0.76489f,-0.764951f,-0.765013f,-0.765075f,-0.765137f,-0.765198f,-0.76526f,-0.765322f,-0.765383f,-0.765445f,-0.765507f,-0.765568f,-0.76563f,-0.765692f,-0.765753f,-0.765815f,-0.765877f,-0.765938f,-0.766f,-0.766062f,-0.766123f,-0.766185f,-0.766246f,-0.766308f,-0.76637f,-0.766431f,-0.766493f,-0.766554f,-0.766616f,-0.766677f,-0.766739f,-0.766801f,-0.766862f,-0.766924f,-0.766985f,-0.767047f,-0.767108f,-0.76717f,-0.767231f,-0.767293f,-0.767354f,-0.767416f,-0.767477f,-0.767538f,-0.7676f,-0.767661f,-0.767723f,-0.767785f,-0.767846f,-0.767907f,-0.767969f,-0.76803f,-0.768091f,-0.768153f,-0.768214f,-0.768276f,-0.768337f,-0.768398f,-0.76846f,-0.768521f,-0.768582f,-0.768644f,-0.768705f,-0.768766f,-0.768828f,-0.768889f,-0.76895f,-0.769012f,-0.769073f,-0.769134f,-0.769195f,-0.769257f,-0.769318f,-0.769379f,-0.76944f,-0.769501f,-0.769563f,-0.769624f,-0.769685f,-0.769746f,-0.769808f,-0.769869f,-0.76993f,-0.769991f,-0.770052f,-0.770114f,-0.770175f,-0.770236f,-0.770297f,-0.770358f,-0.770419f,-0.77048f,-0.770541f,-0.770602f,-0.770663f,-0.770725f,-0.770786f,-0.770847f,-0.770908f,-0.770969f,-0.77103f,-0.771091f,-0.771152f,-0.771213f,-0.771274f,-0.771335f,-0.771396f,-0.771457f,-0.771518f,-0.771579f,-0.77164f,-0.771701f,-0.771762f,-0.771823f,-0.771884f,-0.771945f,-0.772006f,-0.772067f,-0.772128f,-0.772189f,-0.77225f,-0.772311f,-0.772371f,-0.772432f,-0.772493f,-0.772554f,-0.772615f,-0.772676f,-0.772737f,-0.772798f,-0.772859f,-0.772919f,-0.77298f,-0.773041f,-0.773102f,-0.773163f,-0.773223f,-0.773284f,-0.773345f,-0.773406f,-0.773466f,-0.773527f,-0.773588f,-0.773649f,-0.77371f,-0.77377f,-0.773831f,-0.773892f,-0.773952f,-0.774013f,-0.774074f,-0.774135f,-0.774195f,-0.774256f,-0.774316f,-0.774377f,-0.774438f,-0.774498f,-0.774559f,-0.77462f,-0.774681f,-0.774741f,-0.774802f,-0.774862f,-0.774923f,-0.774984f,-0.775044f,-0.775105f,-0.775165f,-0.775226f,-0.775286f,-0.775347f,-0.775407f,-0.775468f,-0.775528f,-0.775589f,-0.775649f,-0.77571f,-0.775771f,-0.775831f,-0.775892f,-0.775952f,-0.776013f,-0.776073f,-0.776133f,-0.776194f,-0.776254f,-0.776315f,-0.776375f,-0.776435f,-0.776496f,-0.776556f,-0.776617f,-0.776677f,-0.776738f,-0.776798f,-0.776858f,-0.776919f,-0.776979f,-0.777039f,-0.7771f,-0.77716f,-0.77722f,-0.777281f,-0.777341f,-0.777401f,-0.777462f,-0.777522f,-0.777582f,-0.777643f,-0.777703f,-0.777763f,-0.777823f,-0.777884f,-0.777944f,-0.778004f,-0.778064f,-0.778125f,-0.778185f,-0.778245f,-0.778305f,-0.778365f,-0.778425f,-0.778486f,-0.778546f,-0.778606f,-0.778666f,-0.778726f,-0.778787f,-0.778847f,-0.778907f,-0.778967f,-0.779027f,-0.779087f,-0.779147f,-0.779207f,-0.779267f,-0.779327f,-0.779387f,-0.779447f,-0.779508f,-0.779568f,-0.779628f,-0.779688f,-0.779748f,-0.779808f,-0.779868f,-0.779928f,-0.779988f,-0.780048f,-0.780108f,-0.780168f,-0.780228f,-0.780288f,-0.780348f,-0.780408f,-0.780468f,-0.780528f,-0.780588f,-0.780648f,-0.780707f,-0.780767f,-0.780827f,-0.780887f,-0.780947f,-0.781007f,-0.781067f,-0.781126f,-0.781186f,-0.781246f,-0.781306f,-0.781366f,-0.781426f,-0.781485f,-0.781546f,-0.781605f,-0.781665f,-0.781725f,-0.781785f,-0.781844f,-0.781904f,-0.781964f,-0.782024f,-0.782083f,-0.782143f,-0.782203f,-0.782263f,-0.782322f,-0.782382f,-0.782442f,-0.782502f,-0.782561f,-0.782621f,-0.782681f,-0.78274f,-0.7828f,-0.78286f,-0.782919f,-0.782979f,-0.783038f,-0.783098f,-0.783158f,-0.783217f,-0.783277f,-0.783336f,-0.783396f,-0.783456f,-0.783515f,-0.783575f,-0.783634f,-0.783694f,-0.783754f,-0.783813f,-0.783873f,-0.783932f,-0.783992f,-0.784051f,-0.784111f,-0.78417f,-0.78423f,-0.784289f,-0.784348f,-0.784408f,-0.784468f,-0.784527f,-0.784586f,-0.784646f,-0.784705f,-0.784765f,-0.784824f,-0.784883f,-0.784943f,-0.785002f,-0.785062f,-0.785121f,-0.78518f,-0.78524f,-0.785299f,-0.785359f,-0.785418f,-0.785477f,-0.785537f,-0.785596f,-0.785655f,-0.785715f,-0.785774f,-0.785833f,-0.785892f,-0.785952f,-0.786011f,-0.78607f,-0.786129f,-0.786189f,-0.786248f,-0.786307f,-0.786367f,-0.786426f,-0.786485f,-0.786544f,-0.786603f,-0.786663f,-0.786722f,-0.786781f,-0.78684f,-0.786899f,-0.786958f,-0.787017f,-0.787077f,-0.787136f,-0.787195f,-0.787254f,-0.787313f,-0.787372f,-0.787431f,-0.787491f,-0.78755f,-0.787609f,-0.787668f,-0.787727f,-0.787786f,-0.787845f,-0.787904f,-0.787963f,-0.788022f,-0.788081f,-0.78814f,-0.788199f,-0.788258f,-0.788317f,-0.788376f,-0.788435f,-0.788494f,-0.788553f,-0.788612f,-0.788671f,-0.78873f,-0.788789f,-0.788848f,-0.788906f,-0.788965f,-0.789024f,-0.789083f,-0.789142f,-0.789201f,-0.78926f,-0.789319f,-0.789378f,-0.789437f,-0.789495f,-0.789554f,-0.789613f,-0.789672f,-0.789731f,-0.789789f,-0.789848f,-0.789907f,-0.789966f,-0.790025f,-0.790083f,-0.790142f,-0.790201f,-0.79026f,-0.790318f,-0.790377f,-0.790436f,-0.790495f,-0.790553f,-0.790612f,-0.790671f,-0.790729f,-0.790788f,-0.790847f,-0.790905f,-0.790964f,-0.791023f,-0.791082f,-0.79114f,-0.791199f,-0.791257f,-0.791316f,-0.791375f,-0.791433f,-0.791492f,-0.79155f,-0.791609f,-0.791668f,-0.791726f,-0.791785f,-0.791843f,-0.791902f,-0.79196f,-0.792019f,-0.792077f,-0.792136f,-0.792194f,-0.792253f,-0.792311f,-0.79237f,-0.792428f,-0.792487f,-0.792545f,-0.792604f,-0.792662f,-0.792721f,-0.792779f,-0.792837f,-0.792896f,-0.792955f,-0.793013f,-0.793071f,-0.79313f,-0.793188f,-0.793246f,-0.793305f,-0.793363f,-0.793422f,-0.79348f,-0.793538f,-0.793596f,-0.793655f,-0.793713f,-0.793771f,-0.79383f,-0.793888f,-0.793947f,-0.794005f,-0.794063f,-0.794121f,-0.79418f,-0.794238f,-0.794296f,-0.794354f,-0.794412f,-0.794471f,-0.794529f,-0.794587f,-0.794645f,-0.794703f,-0.794762f,-0.79482f,-0.794878f,-0.794936f,-0.794995f,-0.795053f,-0.795111f,-0.795169f,-0.795227f,-0.795285f,-0.795343f,-0.795401f,-0.795459f,-0.795518f,-0.795576f,-0.795634f,-0.795692f,-0.79575f,-0.795808f,-0.795866f,-0.795924f,-0.795982f,-0.79604f,-0.796098f,-0.796156f,-0.796214f,-0.796272f,-0.79633f,-0.796388f,-0.796446f,-0.796504f,-0.796562f,-0.79662f,-0.796678f,-0.796736f,-0.796794f,-0.796852f,-0.79691f,-0.796968f,-0.797026f,-0.797083f,-0.797141f,-0.797199f,-0.797257f,-0.797315f,-0.797373f,-0.797431f,-0.797488f,-0.797546f,-0.797604f,-0.797662f,-0.79772f,-0.797778f,-0.797836f,-0.797893f,-0.797951f,-0.798009f,-0.798067f,-0.798124f,-0.798182f,-0.79824f,-0.798298f,-0.798355f,-0.798413f,-0.798471f,-0.798528f,-0.798586f,-0.798644f,-0.798702f,-0.798759f,-0.798817f,-0.798875f,-0.798932f,-0.79899f,-0.799048f,-0.799105f,-0.799163f,-0.79922f,-0.799278f,-0.799336f,-0.799393f,-0.799451f,-0.799509f,-0.799566f,-0.799624f,-0.799681f,-0.799739f,-0.799796f,-0.799854f,-0.799911f,-0.799969f,-0.800027f,-0.800084f,-0.800142f,-0.800199f,-0.800256f,-0.800314f,-0.800371f,-0.800429f,-0.800487f,-0.800544f,-0.800601f,-0.800659f,-0.800716f,-0.800774f,-0.800831f,-0.800889f,-0.800946f,-0.801003f,-0.801061f,-0.801118f,-0.801175f,-0.801233f,-0.80129f,-0.801347f,-0.801405f,-0.801462f,-0.80152f,-0.801577f,-0.801634f,-0.801692f,-0.801749f,-0.801806f,-0.801863f,-0.801921f,-0.801978f,-0.802035f,-0.802092f,-0.80215f,-0.802207f,-0.802264f,-0.802322f,-0.802379f,-0.802436f,-0.802493f,-0.80255f,-0.802608f,-0.802665f,-0.802722f,-0.802779f,-0.802836f,-0.802893f,-0.80295f,-0.803008f,-0.803065f,-0.803122f,-0.803179f,-0.803236f,-0.803293f,-0.80335f,-0.803408f,-0.803465f,-0.803522f,-0.803579f,-0.803636f,-0.803693f,-0.80375f,-0.803807f,-0.803864f,-0.803921f,-0.803978f,-0.804035f,-0.804092f,-0.804149f,-0.804206f,-0.804263f,-0.80432f,-0.804377f,-0.804434f,-0.804491f,-0.804548f,-0.804605f,-0.804662f,-0.804718f,-0.804775f,-0.804832f,-0.804889f,-0.804946f,-0.805003f,-0.80506f,-0.805117f,-0.805174f,-0.80523f,-0.805287f,-0.805344f,-0.805401f,-0.805458f,-0.805515f,-0.805571f,-0.805628f,-0.805685f,-0.805742f,-0.805798f,-0.805855f,-0.805912f,-0.805969f,-0.806026f,-0.806082f,-0.806139f,-0.806196f,-0.806253f,-0.806309f,-0.806366f,-0.806423f,-0.806479f,-0.806536f,-0.806593f,-0.806649f,-0.806706f,-0.806763f,-0.806819f,-0.806876f,-0.806933f,-0.806989f,-0.807046f,-0.807103f,-0.807159f,-0.807216f,-0.807272f,-0.807329f,-0.807385f,-0.807442f,-0.807498f,-0.807555f,-0.807611f,-0.807668f,-0.807724f,-0.807781f,-0.807838f,-0.807894f,-0.807951f,-0.808007f,-0.808064f,-0.80812f,-0.808177f,-0.808233f,-0.808289f,-0.808346f,-0.808402f,-0.808459f,-0.808515f,-0.808572f,-0.808628f,-0.808684f,-0.808741f,-0.808797f,-0.808854f,-0.80891f,-0.808966f,-0.809023f,-0.809079f,-0.809135f,-0.809192f,-0.809248f,-0.809304f,-0.809361f,-0.809417f,-0.809473f,-0.809529f,-0.809586f,-0.809642f,-0.809699f,-0.809755f,-0.809811f,-0.809867f,-0.809923f,-0.80998f,-0.810036f,-0.810092f,-0.810148f,-0.810204f,-0.810261f,-0.810317f,-0.810373f,-0.810429f,-0.810485f,-0.810542f,-0.810598f,-0.810654f,-0.81071f,-0.810766f,-0.810822f,-0.810878f,-0.810934f,-0.81099f,-0.811047f,-0.811103f,-0.811159f,-0.811215f,-0.811271f,-0.811327f,-0.811383f,-0.811439f,-0.811495f,-0.811551f,-0.811607f,-0.811663f,-0.811719f,-0.811775f,-0.811831f,-0.811887f,-0.811943f,-0.811999f,-0.812055f,-0.812111f,-0.812167f,-0.812223f,-0.812279f,-0.812335f,-0.812391f,-0.812446f,-0.812502f,-0.812558f,-0.812614f,-0.81267f,-0.812726f,-0.812782f,-0.812837f,-0.812893f,-0.812949f,-0.813005f,-0.813061f,-0.813116f,-0.813172f,-0.813228f,-0.813284f,-0.81334f,-0.813396f,-0.813451f,-0.813507f,-0.813563f,-0.813619f,-0.813674f,-0.81373f,-0.813786f,-0.813841f,-0.813897f,-0.813953f,-0.814008f,-0.814064f,-0.81412f,-0.814176f,-0.814231f,-0.814287f,-0.814343f,-0.814398f,-0.814454f,-0.814509f,-0.814565f,-0.814621f,-0.814676f,-0.814732f,-0.814787f,-0.814843f,-0.814898f,-0.814954f,-0.81501f,-0.815065f,-0.815121f,-0.815176f,-0.815232f,-0.815287f,-0.815343f,-0.815398f,-0.815454f,-0.815509f,-0.815565f,-0.81562f,-0.815676f,-0.815731f,-0.815787f,-0.815842f,-0.815898f,-0.815953f,-0.816009f,-0.816064f,-0.816119f,-0.816175f,-0.81623f,-0.816285f,-0.816341f,-0.816396f,-0.816452f,-0.816507f,-0.816562f,-0.816618f,-0.816673f,-0.816728f,-0.816783f,-0.816839f,-0.816894f,-0.81695f,-0.817005f,-0.81706f,-0.817115f,-0.817171f,-0.817226f,-0.817281f,-0.817336f,-0.817392f,-0.817447f,-0.817502f,-0.817557f,-0.817612f,-0.817668f,-0.817723f,-0.817778f,-0.817833f,-0.817888f,-0.817944f,-0.817999f,-0.818054f,-0.818109f,-0.818164f,-0.818219f,-0.818274f,-0.818329f,-0.818384f,-0.81844f,-0.818495f,-0.81855f,-0.818605f,-0.81866f,-0.818715f,-0.81877f,-0.818825f,-0.81888f,-0.818935f,-0.81899f,-0.819045f,-0.8191f,-0.819155f,-0.81921f,-0.819265f,-0.81932f,-0.819375f,-0.81943f,-0.819485f,-0.81954f,-0.819595f,-0.81965f,-0.819705f,-0.81976f,-0.819815f,-0.819869f,-0.819924f,-0.819979f,-0.820034f,-0.820089f,-0.820144f,-0.820199f,-0.820253f,-0.820308f,-0.820363f,-0.820418f,-0.820473f,-0.820528f,-0.820582f,-0.820637f,-0.820692f,-0.820747f,-0.820801f,-0.820856f,-0.820911f,-0.820966f,-0.82102f,-0.821075f,-0.82113f,-0.821185f,-0.821239f,-0.821294f,-0.821349f,-0.821404f,-0.821458f,-0.821513f,-0.821567f,-0.821622f,-0.821677f,-0.821731f,-0.821786f,-0.821841f,-0.821895f,-0.82195f,-0.822004f,-0.822059f,-0.822114f,-0.822168f,-0.822223f,-0.822277f,-0.822332f,-0.822387f,-0.822441f,-0.822496f,-0.82255f,-0.822605f,-0.822659f,-0.822714f,-0.822768f,-0.822823f,-0.822877f,-0.822931f,-0.822986f,-0.823041f,-0.823095f,-0.82315f,-0.823204f,-0.823258f,-0.823313f,-0.823367f,-0.823421f,-0.823476f,-0.82353f,-0.823585f,-0.823639f,-0.823693f,-0.823748f,-0.823802f,-0.823856f,-0.823911f,-0.823965f,-0.82402f,-0.824074f,-0.824128f,-0.824182f,-0.824237f,-0.824291f,-0.824345f,-0.824399f,-0.824454f,-0.824508f,-0.824562f,-0.824616f,-0.824671f,-0.824725f,-0.824779f,-0.824833f,-0.824888f,-0.824942f,-0.824996f,-0.82505f,-0.825104f,-0.825158f,-0.825213f,-0.825267f,-0.825321f,-0.825375f,-0.825429f,-0.825483f,-0.825537f,-0.825591f,-0.825645f,-0.8257f,-0.825754f,-0.825808f,-0.825862f,-0.825916f,-0.82597f,-0.826024f,-0.826078f,-0.826132f,-0.826186f,-0.82624f,-0.826294f,-0.826348f,-0.826402f,-0.826456f,-0.82651f,-0.826564f,-0.826618f,-0.826672f,-0.826726f,-0.82678f,-0.826834f,-0.826888f,-0.826942f,-0.826995f,-0.827049f,-0.827103f,-0.827157f,-0.827211f,-0.827265f,-0.827319f,-0.827372f,-0.827427f,-0.82748f,-0.827534f,-0.827588f,-0.827642f,-0.827696f,-0.827749f,-0.827803f,-0.827857f,-0.827911f,-0.827964f,-0.828018f,-0.828072f,-0.828126f,-0.828179f,-0.828233f,-0.828287f,-0.828341f,-0.828394f,-0.828448f,-0.828502f,-0.828555f,-0.828609f,-0.828663f,-0.828716f,-0.82877f,-0.828824f,-0.828877f,-0.828931f,-0.828984f,-0.829038f,-0.829092f,-0.829146f,-0.829199f,-0.829253f,-0.829306f,-0.82936f,-0.829413f,-0.829467f,-0.82952f,-0.829574f,-0.829627f,-0.829681f,-0.829735f,-0.829788f,-0.829841f,-0.829895f,-0.829948f,-0.830002f,-0.830056f,-0.830109f,-0.830162f,-0.830216f,-0.830269f,-0.830323f,-0.830376f,-0.83043f,-0.830483f,-0.830536f,-0.83059f,-0.830643f,-0.830696f,-0.83075f,-0.830803f,-0.830857f,-0.83091f,-0.830963f,-0.831017f,-0.83107f,-0.831123f,-0.831177f,-0.83123f,-0.831283f,-0.831336f,-0.83139f,-0.831443f,-0.831496f,-0.831549f,-0.831603f,-0.831656f,-0.831709f,-0.831763f,-0.831816f,-0.831869f,-0.831922f,-0.831975f,-0.832029f,-0.832082f,-0.832135f,-0.832188f,-0.832241f,-0.832294f,-0.832347f,-0.832401f,-0.832454f,-0.832507f,-0.83256f,-0.832613f,-0.832666f,-0.832719f,-0.832772f,-0.832825f,-0.832879f,-0.832932f,-0.832985f,-0.833038f,-0.833091f,-0.833144f,-0.833197f,-0.83325f,-0.833303f,-0.833356f,-0.833409f,-0.833462f,-0.833515f,-0.833568f,-0.833621f,-0.833674f,-0.833727f,-0.833779f,-0.833832f,-0.833885f,-0.833938f,-0.833991f,-0.834044f,-0.834097f,-0.83415f,-0.834203f,-0.834255f,-0.834309f,-0.834361f,-0.834414f,-0.834467f,-0.83452f,-0.834573f,-0.834625f,-0.834678f,-0.834731f,-0.834784f,-0.834836f,-0.834889f,-0.834942f,-0.834995f,-0.835047f,-0.8351f,-0.835153f,-0.835206f,-0.835259f,-0.835311f,-0.835364f,-0.835417f,-0.835469f,-0.835522f,-0.835575f,-0.835627f,-0.83568f,-0.835733f,-0.835785f,-0.835838f,-0.83589f,-0.835943f,-0.835996f,-0.836049f,-0.836101f,-0.836154f,-0.836206f,-0.836259f,-0.836311f,-0.836364f,-0.836416f,-0.836469f,-0.836522f,-0.836574f,-0.836627f,-0.836679f,-0.836731f,-0.836784f,-0.836837f,-0.836889f,-0.836942f,-0.836994f,-0.837047f,-0.837099f,-0.837151f,-0.837204f,-0.837256f,-0.837309f,-0.837361f,-0.837413f,-0.837466f,-0.837518f,-0.837571f,-0.837623f,-0.837675f,-0.837728f,-0.83778f,-0.837833f,-0.837885f,-0.837937f,-0.837989f,-0.838042f,-0.838094f,-0.838146f,-0.838199f,-0.838251f,-0.838303f,-0.838355f,-0.838408f,-0.83846f,-0.838512f,-0.838565f,-0.838617f,-0.838669f,-0.838721f,-0.838773f,-0.838826f,-0.838878f,-0.83893f,-0.838982f,-0.839034f,-0.839086f,-0.839138f,-0.839191f,-0.839243f,-0.839295f,-0.839347f,-0.839399f,-0.839451f,-0.839503f,-0.839556f,-0.839608f,-0.83966f,-0.839712f,-0.839764f,-0.839816f,-0.839868f,-0.83992f,-0.839972f,-0.840024f,-0.840076f,-0.840128f,-0.84018f,-0.840232f,-0.840284f,-0.840336f,-0.840388f,-0.84044f,-0.840492f,-0.840544f,-0.840596f,-0.840648f,-0.840699f,-0.840751f,-0.840803f,-0.840855f,-0.840907f,-0.840959f,-0.841011f,-0.841063f,-0.841115f,-0.841166f,-0.841218f,-0.84127f,-0.841322f,-0.841374f,-0.841426f,-0.841477f,-0.841529f,-0.841581f,-0.841633f,-0.841684f,-0.841736f,-0.841788f,-0.84184f,-0.841892f,-0.841943f,-0.841995f,-0.842047f,-0.842098f,-0.84215f,-0.842202f,-0.842254f,-0.842305f,-0.842357f,-0.842408f,-0.84246f,-0.842512f,-0.842563f,-0.842615f,-0.842667f,-0.842718f,-0.84277f,-0.842822f,-0.842873f,-0.842925f,-0.842976f,-0.843028f,-0.843079f,-0.843131f,-0.843183f,-0.843234f,-0.843286f,-0.843337f,-0.843389f,-0.84344f,-0.843492f,-0.843543f,-0.843595f,-0.843646f,-0.843698f,-0.843749f,-0.843801f,-0.843852f,-0.843903f,-0.843955f,-0.844006f,-0.844058f,-0.844109f,-0.84416f,-0.844212f,-0.844263f,-0.844315f,-0.844366f,-0.844417f,-0.844469f,-0.84452f,-0.844571f,-0.844623f,-0.844674f,-0.844725f,-0.844777f,-0.844828f,-0.844879f,-0.844931f,-0.844982f,-0.845033f,-0.845084f,-0.845136f,-0.845187f,-0.845238f,-0.845289f,-0.845341f,-0.845392f,-0.845443f,-0.845494f,-0.845545f,-0.845597f,-0.845648f,-0.845699f,-0.84575f,-0.845801f,-0.845852f,-0.845903f,-0.845955f,-0.846006f,-0.846057f,-0.846108f,-0.846159f,-0.84621f,-0.846261f,-0.846312f,-0.846363f,-0.846414f,-0.846465f,-0.846516f,-0.846568f,-0.846619f,-0.84667f,-0.846721f,-0.846772f,-0.846823f,-0.846874f,-0.846925f,-0.846976f,-0.847027f,-0.847078f,-0.847128f,-0.847179f,-0.84723f,-0.847281f,-0.847332f,-0.847383f,-0.847434f,-0.847485f,-0.847536f,-0.847587f,-0.847637f,-0.847688f,-0.847739f,-0.84779f,-0.847841f,-0.847892f,-0.847943f,-0.847993f,-0.848044f,-0.848095f,-0.848146f,-0.848197f,-0.848247f,-0.848298f,-0.848349f,-0.8484f,-0.84845f,-0.848501f,-0.848552f,-0.848603f,-0.848653f,-0.848704f,-0.848755f,-0.848805f,-0.848856f,-0.848907f,-0.848957f,-0.849008f,-0.849059f,-0.849109f,-0.84916f,-0.849211f,-0.849261f,-0.849312f,-0.849363f,-0.849413f,-0.849464f,-0.849514f,-0.849565f,-0.849615f,-0.849666f,-0.849717f,-0.849767f,-0.849818f,-0.849868f,-0.849919f,-0.849969f,-0.85002f,-0.85007f,-0.850121f,-0.850171f,-0.850222f,-0.850272f,-0.850323f,-0.850373f,-0.850424f,-0.850474f,-0.850524f,-0.850575f,-0.850625f,-0.850676f,-0.850726f,-0.850776f,-0.850827f,-0.850877f,-0.850927f,-0.850978f,-0.851028f,-0.851079f,-0.851129f,-0.851179f,-0.85123f,-0.85128f,-0.85133f,-0.85138f,-0.851431f,-0.851481f,-0.851531f,-0.851581f,-0.851632f,-0.851682f,-0.851732f,-0.851783f,-0.851833f,-0.851883f,-0.851933f,-0.851983f,-0.852034f,-0.852084f,-0.852134f,-0.852184f,-0.852234f,-0.852284f,-0.852334f,-0.852385f,-0.852435f,-0.852485f,-0.852535f,-0.852585f,-0.852635f,-0.852685f,-0.852735f,-0.852786f,-0.852836f,-0.852886f,-0.852936f,-0.852986f,-0.853036f,-0.853086f,-0.853136f,-0.853186f,-0.853236f,-0.853286f,-0.853336f,-0.853386f,-0.853436f,-0.853486f,-0.853536f,-0.853586f,-0.853636f,-0.853685f,-0.853735f,-0.853785f,-0.853835f,-0.853885f,-0.853935f,-0.853985f,-0.854035f,-0.854085f,-0.854134f,-0.854185f,-0.854234f,-0.854284f,-0.854334f,-0.854384f,-0.854434f,-0.854483f,-0.854533f,-0.854583f,-0.854633f,-0.854683f,-0.854732f,-0.854782f,-0.854832f,-0.854881f,-0.854931f,-0.854981f,-0.855031f,-0.855081f,-0.85513f,-0.85518f,-0.85523f,-0.855279f,-0.855329f,-0.855379f,-0.855428f,-0.855478f,-0.855527f,-0.855577f,-0.855627f,-0.855676f,-0.855726f,-0.855775f,-0.855825f,-0.855875f,-0.855924f,-0.855974f,-0.856024f,-0.856073f,-0.856123f,-0.856172f,-0.856222f,-0.856271f,-0.856321f,-0.85637f,-0.85642f,-0.856469f,-0.856519f,-0.856568f,-0.856618f,-0.856667f,-0.856717f,-0.856766f,-0.856816f,-0.856865f,-0.856914f,-0.856964f,-0.857013f,-0.857063f,-0.857112f,-0.857161f,-0.857211f,-0.85726f,-0.857309f,-0.857359f,-0.857408f,-0.857458f,-0.857507f,-0.857556f,-0.857605f,-0.857655f,-0.857704f,-0.857753f,-0.857803f,-0.857852f,-0.857901f,-0.85795f,-0.858f,-0.858049f,-0.858098f,-0.858147f,-0.858197f,-0.858246f,-0.858295f,-0.858344f,-0.858393f,-0.858443f,-0.858492f,-0.858541f,-0.85859f,-0.858639f,-0.858688f,-0.858737f,-0.858787f,-0.858836f,-0.858885f,-0.858934f,-0.858983f,-0.859032f,-0.859081f,-0.85913f,-0.859179f,-0.859228f,-0.859277f,-0.859326f,-0.859375f,-0.859424f,-0.859473f,-0.859522f,-0.859571f,-0.85962f,-0.859669f,-0.859718f,-0.859767f,-0.859816f,-0.859865f,-0.859914f,-0.859963f,-0.860012f,-0.860061f,-0.86011f,-0.860159f,-0.860208f,-0.860257f,-0.860305f,-0.860354f,-0.860403f,-0.860452f,-0.860501f,-0.86055f,-0.860599f,-0.860647f,-0.860696f,-0.860745f,-0.860794f,-0.860843f,-0.860891f,-0.86094f,-0.860989f,-0.861038f,-0.861086f,-0.861135f,-0.861184f,-0.861233f,-0.861281f,-0.86133f,-0.861379f,-0.861428f,-0.861476f,-0.861525f,-0.861574f,-0.861622f,-0.861671f,-0.861719f,-0.861768f,-0.861817f,-0.861865f,-0.861914f,-0.861963f,-0.862011f,-0.86206f,-0.862108f,-0.862157f,-0.862206f,-0.862254f,-0.862303f,-0.862351f,-0.8624f,-0.862448f,-0.862497f,-0.862545f,-0.862594f,-0.862642f,-0.862691f,-0.862739f,-0.862788f,-0.862836f,-0.862885f,-0.862933f,-0.862982f,-0.86303f,-0.863079f,-0.863127f,-0.863175f,-0.863224f,-0.863272f,-0.86332f,-0.863369f,-0.863417f,-0.863466f,-0.863514f,-0.863562f,-0.863611f,-0.863659f,-0.863707f,-0.863756f,-0.863804f,-0.863852f,-0.863901f,-0.863949f,-0.863997f,-0.864045f,-0.864094f,-0.864142f,-0.86419f,-0.864238f,-0.864286f,-0.864335f,-0.864383f,-0.864431f,-0.864479f,-0.864528f,-0.864576f,-0.864624f,-0.864672f,-0.86472f,-0.864768f,-0.864817f,-0.864865f,-0.864913f,-0.864961f,-0.865009f,-0.865057f,-0.865105f,-0.865153f,-0.865201f,-0.865249f,-0.865298f,-0.865346f,-0.865394f,-0.865442f,-0.86549f,-0.865538f,-0.865586f,-0.865634f,-0.865682f,-0.86573f,-0.865778f,-0.865826f,-0.865874f,-0.865921f,-0.865969f,-0.866017f,-0.866066f,-0.866113f,-0.866161f,-0.866209f,-0.866257f,-0.866305f,-0.866353f,-0.866401f,-0.866449f,-0.866496f,-0.866544f,-0.866592f,-0.86664f,-0.866688f,-0.866736f,-0.866783f,-0.866831f,-0.866879f,-0.866927f,-0.866975f,-0.867022f,-0.86707f,-0.867118f,-0.867166f,-0.867213f,-0.867261f,-0.867309f,-0.867357f,-0.867404f,-0.867452f,-0.8675f,-0.867547f,-0.867595f,-0.867643f,-0.867691f,-0.867738f,-0.867786f,-0.867833f,-0.867881f,-0.867929f,-0.867976f,-0.868024f,-0.868071f,-0.868119f,-0.868167f,-0.868214f,-0.868262f,-0.868309f,-0.868357f,-0.868405f,-0.868452f,-0.8685f,-0.868547f,-0.868595f,-0.868642f,-0.86869f,-0.868737f,-0.868784f,-0.868832f,-0.868879f,-0.868927f,-0.868974f,-0.869022f,-0.869069f,-0.869117f,-0.869164f,-0.869212f,-0.869259f,-0.869306f,-0.869354f,-0.869401f,-0.869448f,-0.869496f,-0.869543f,-0.86959f,-0.869638f,-0.869685f,-0.869732f,-0.86978f,-0.869827f,-0.869874f,-0.869922f,-0.869969f,-0.870016f,-0.870063f,-0.870111f,-0.870158f,-0.870205f,-0.870252f,-0.8703f,-0.870347f,-0.870394f,-0.870441f,-0.870488f,-0.870536f,-0.870583f,-0.87063f,-0.870677f,-0.870724f,-0.870771f,-0.870819f,-0.870866f,-0.870913f,-0.87096f,-0.871007f,-0.871054f,-0.871101f,-0.871148f,-0.871195f,-0.871242f,-0.871289f,-0.871336f,-0.871383f,-0.871431f,-0.871478f,-0.871525f,-0.871572f,-0.871619f,-0.871666f,-0.871713f,-0.87176f,-0.871807f,-0.871853f,-0.8719f,-0.871947f,-0.871994f,-0.872041f,-0.872088f,-0.872135f,-0.872182f,-0.872229f,-0.872276f,-0.872323f,-0.87237f,-0.872416f,-0.872463f,-0.87251f,-0.872557f,-0.872604f,-0.872651f,-0.872697f,-0.872744f,-0.872791f,-0.872838f,-0.872885f,-0.872931f,-0.872978f,-0.873025f,-0.873072f,-0.873118f,-0.873165f,-0.873212f,-0.873259f,-0.873305f,-0.873352f,-0.873399f,-0.873445f,-0.873492f,-0.873539f,-0.873585f,-0.873632f,-0.873679f,-0.873725f,-0.873772f,-0.873819f,-0.873865f,-0.873912f,-0.873958f,-0.874005f,-0.874052f,-0.874098f,-0.874145f,-0.874191f,-0.874238f,-0.874284f,-0.874331f,-0.874377f,-0.874424f,-0.874471f,-0.874517f,-0.874564f,-0.87461f,-0.874656f,-0.874703f,-0.874749f,-0.874796f,-0.874842f,-0.874889f,-0.874935f,-0.874981f,-0.875028f,-0.875074f,-0.875121f,-0.875167f,-0.875214f,-0.87526f,-0.875306f,-0.875353f,-0.875399f,-0.875445f,-0.875492f,-0.875538f,-0.875584f,-0.875631f,-0.875677f,-0.875723f,-0.875769f,-0.875816f,-0.875862f,-0.875908f,-0.875955f,-0.876001f,-0.876047f,-0.876093f,-0.87614f,-0.876186f,-0.876232f,-0.876278f,-0.876324f,-0.87637f,-0.876417f,-0.876463f,-0.876509f,-0.876555f,-0.876601f,-0.876647f,-0.876694f,-0.87674f,-0.876786f,-0.876832f,-0.876878f,-0.876924f,-0.87697f,-0.877016f,-0.877062f,-0.877108f,-0.877154f,-0.8772f,-0.877246f,-0.877292f,-0.877338f,-0.877384f,-0.87743f,-0.877476f,-0.877522f,-0.877568f,-0.877614f,-0.87766f,-0.877706f,-0.877752f,-0.877798f,-0.877844f,-0.87789f,-0.877936f,-0.877982f,-0.878027f,-0.878073f,-0.878119f,-0.878165f,-0.878211f,-0.878257f,-0.878303f,-0.878349f,-0.878394f,-0.87844f,-0.878486f,-0.878532f,-0.878578f,-0.878623f,-0.878669f,-0.878715f,-0.878761f,-0.878806f,-0.878852f,-0.878898f,-0.878944f,-0.87899f,-0.879035f,-0.879081f,-0.879127f,-0.879172f,-0.879218f,-0.879264f,-0.879309f,-0.879355f,-0.8794f,-0.879446f,-0.879492f,-0.879537f,-0.879583f,-0.879629f,-0.879674f,-0.87972f,-0.879766f,-0.879811f,-0.879857f,-0.879902f,-0.879948f,-0.879993f,-0.880039f,-0.880084f,-0.88013f,-0.880175f,-0.880221f,-0.880266f,-0.880312f,-0.880357f,-0.880403f,-0.880448f,-0.880494f,-0.880539f,-0.880585f,-0.88063f,-0.880675f,-0.880721f,-0.880766f,-0.880812f,-0.880857f,-0.880902f,-0.880948f,-0.880993f,-0.881038f,-0.881084f,-0.881129f,-0.881175f,-0.88122f,-0.881265f,-0.881311f,-0.881356f,-0.881401f,-0.881446f,-0.881492f,-0.881537f,-0.881582f,-0.881627f,-0.881673f,-0.881718f,-0.881763f,-0.881808f,-0.881854f,-0.881899f,-0.881944f,-0.881989f,-0.882034f,-0.882079f,-0.882125f,-0.88217f,-0.882215f,-0.88226f,-0.882305f,-0.88235f,-0.882395f,-0.88244f,-0.882486f,-0.882531f,-0.882576f,-0.882621f,-0.882666f,-0.882711f,-0.882756f,-0.882801f,-0.882846f,-0.882891f,-0.882936f,-0.882981f,-0.883026f,-0.883071f,-0.883116f,-0.883161f,-0.883206f,-0.883251f,-0.883296f,-0.883341f,-0.883386f,-0.883431f,-0.883476f,-0.883521f,-0.883566f,-0.88361f,-0.883655f,-0.8837f,-0.883745f,-0.88379f,-0.883835f,-0.88388f,-0.883924f,-0.883969f,-0.884014f,-0.884059f,-0.884104f,-0.884149f,-0.884193f,-0.884238f,-0.884283f,-0.884328f,-0.884372f,-0.884417f,-0.884462f,-0.884507f,-0.884551f,-0.884596f,-0.884641f,-0.884685f,-0.88473f,-0.884775f,-0.88482f,-0.884864f,-0.884909f,-0.884953f,-0.884998f,-0.885043f,-0.885087f,-0.885132f,-0.885177f,-0.885221f,-0.885266f,-0.88531f,-0.885355f,-0.885399f,-0.885444f,-0.885489f,-0.885533f,-0.885578f,-0.885622f,-0.885667f,-0.885711f,-0.885756f,-0.8858f,-0.885845f,-0.885889f,-0.885934f,-0.885978f,-0.886023f,-0.886067f,-0.886111f,-0.886156f,-0.8862f,-0.886245f,-0.886289f,-0.886334f,-0.886378f,-0.886422f,-0.886467f,-0.886511f,-0.886555f,-0.8866f,-0.886644f,-0.886688f,-0.886733f,-0.886777f,-0.886821f,-0.886866f,-0.88691f,-0.886954f,-0.886999f,-0.887043f,-0.887087f,-0.887131f,-0.887176f,-0.88722f,-0.887264f,-0.887308f,-0.887352f,-0.887397f,-0.887441f,-0.887485f,-0.887529f,-0.887573f,-0.887618f,-0.887662f,-0.887706f,-0.88775f,-0.887794f,-0.887838f,-0.887882f,-0.887927f,-0.887971f,-0.888015f,-0.888059f,-0.888103f,-0.888147f,-0.888191f,-0.888235f,-0.888279f,-0.888323f,-0.888367f,-0.888411f,-0.888455f,-0.888499f,-0.888543f,-0.888587f,-0.888631f,-0.888675f,-0.888719f,-0.888763f,-0.888807f,-0.888851f,-0.888895f,-0.888939f,-0.888982f,-0.889027f,-0.88907f,-0.889114f,-0.889158f,-0.889202f,-0.889246f,-0.88929f,-0.889334f,-0.889377f,-0.889421f,-0.889465f,-0.889509f,-0.889553f,-0.889596f,-0.88964f,-0.889684f,-0.889728f,-0.889772f,-0.889815f,-0.889859f,-0.889903f,-0.889947f,-0.88999f,-0.890034f,-0.890078f,-0.890121f,-0.890165f,-0.890209f,-0.890252f,-0.890296f,-0.89034f,-0.890383f,-0.890427f,-0.890471f,-0.890514f,-0.890558f,-0.890602f,-0.890645f,-0.890689f,-0.890732f,-0.890776f,-0.890819f,-0.890863f,-0.890906f,-0.89095f,-0.890993f,-0.891037f,-0.89108f,-0.891124f,-0.891168f,-0.891211f,-0.891255f,-0.891298f,-0.891342f,-0.891385f,-0.891428f,-0.891472f,-0.891515f,-0.891559f,-0.891602f,-0.891645f,-0.891689f,-0.891732f,-0.891776f,-0.891819f,-0.891863f,-0.891906f,-0.891949f,-0.891993f,-0.892036f,-0.892079f,-0.892123f,-0.892166f,-0.892209f,-0.892252f,-0.892296f,-0.892339f,-0.892382f,-0.892425f,-0.892469f,-0.892512f,-0.892555f,-0.892599f,-0.892642f,-0.892685f,-0.892728f,-0.892771f,-0.892815f,-0.892858f,-0.892901f,-0.892944f,-0.892987f,-0.89303f,-0.893073f,-0.893116f,-0.89316f,-0.893203f,-0.893246f,-0.893289f,-0.893332f,-0.893375f,-0.893418f,-0.893461f,-0.893504f,-0.893547f,-0.89359f,-0.893633f,-0.893676f,-0.893719f,-0.893762f,-0.893805f,-0.893848f,-0.893891f,-0.893935f,-0.893978f,-0.89402f,-0.894063f,-0.894106f,-0.894149f,-0.894192f,-0.894235f,-0.894278f,-0.894321f,-0.894364f,-0.894407f,-0.894449f,-0.894492f,-0.894535f,-0.894578f,-0.894621f,-0.894664f,-0.894707f,-0.89475f,-0.894792f,-0.894835f,-0.894878f,-0.894921f,-0.894963f,-0.895006f,-0.895049f,-0.895092f,-0.895134f,-0.895177f,-0.89522f,-0.895263f,-0.895305f,-0.895348f,-0.895391f,-0.895433f,-0.895476f,-0.895519f,-0.895561f,-0.895604f,-0.895647f,-0.895689f,-0.895732f,-0.895775f,-0.895817f,-0.89586f,-0.895902f,-0.895945f,-0.895988f,-0.89603f,-0.896073f,-0.896115f,-0.896158f,-0.8962f,-0.896243f,-0.896285f,-0.896328f,-0.89637f,-0.896413f,-0.896455f,-0.896498f,-0.89654f,-0.896583f,-0.896625f,-0.896668f,-0.89671f,-0.896753f,-0.896795f,-0.896838f,-0.89688f,-0.896922f,-0.896965f,-0.897007f,-0.897049f,-0.897092f,-0.897134f,-0.897176f,-0.897219f,-0.897261f,-0.897303f,-0.897346f,-0.897388f,-0.89743f,-0.897473f,-0.897515f,-0.897557f,-0.8976f,-0.897642f,-0.897684f,-0.897726f,-0.897768f,-0.897811f,-0.897853f,-0.897895f,-0.897937f,-0.897979f,-0.898022f,-0.898064f,-0.898106f,-0.898148f,-0.89819f,-0.898233f,-0.898275f,-0.898317f,-0.898359f,-0.898401f,-0.898443f,-0.898485f,-0.898527f,-0.898569f,-0.898611f,-0.898653f,-0.898695f,-0.898738f,-0.89878f,-0.898822f,-0.898864f,-0.898906f,-0.898948f,-0.89899f,-0.899032f,-0.899074f,-0.899116f,-0.899158f,-0.899199f,-0.899241f,-0.899283f,-0.899325f,-0.899367f,-0.899409f,-0.899451f,-0.899493f,-0.899535f,-0.899577f,-0.899619f,-0.89966f,-0.899702f,-0.899744f,-0.899786f,-0.899828f,-0.89987f,-0.899911f,-0.899953f,-0.899995f,-0.900037f,-0.900079f,-0.90012f,-0.900162f,-0.900204f,-0.900246f,-0.900287f,-0.900329f,-0.900371f,-0.900413f,-0.900454f,-0.900496f,-0.900538f,-0.900579f,-0.900621f,-0.900663f,-0.900704f,-0.900746f,-0.900788f,-0.900829f,-0.900871f,-0.900913f,-0.900954f,-0.900996f,-0.901037f,-0.901079f,-0.90112f,-0.901162f,-0.901204f,-0.901245f,-0.901287f,-0.901328f,-0.90137f,-0.901411f,-0.901453f,-0.901494f,-0.901536f,-0.901577f,-0.901619f,-0.90166f,-0.901702f,-0.901743f,-0.901784f,-0.901826f,-0.901867f,-0.901909f,-0.90195f,-0.901991f,-0.902033f,-0.902074f,-0.902116f,-0.902157f,-0.902198f,-0.90224f,-0.902281f,-0.902322f,-0.902364f,-0.902405f,-0.902446f,-0.902488f,-0.902529f,-0.90257f,-0.902611f,-0.902653f,-0.902694f,-0.902735f,-0.902777f,-0.902818f,-0.902859f,-0.9029f,-0.902941f,-0.902983f,-0.903024f,-0.903065f,-0.903106f,-0.903147f,-0.903188f,-0.90323f,-0.903271f,-0.903312f,-0.903353f,-0.903394f,-0.903435f,-0.903476f,-0.903517f,-0.903559f,-0.9036f,-0.903641f,-0.903682f,-0.903723f,-0.903764f,-0.903805f,-0.903846f,-0.903887f,-0.903928f,-0.903969f,-0.90401f,-0.904051f,-0.904092f,-0.904133f,-0.904174f,-0.904215f,-0.904256f,-0.904297f,-0.904337f,-0.904378f,-0.904419f,-0.90446f,-0.904501f,-0.904542f,-0.904583f,-0.904624f,-0.904665f,-0.904705f,-0.904746f,-0.904787f,-0.904828f,-0.904869f,-0.90491f,-0.90495f,-0.904991f,-0.905032f,-0.905073f,-0.905113f,-0.905154f,-0.905195f,-0.905236f,-0.905276f,-0.905317f,-0.905358f,-0.905398f,-0.905439f,-0.90548f,-0.905521f,-0.905561f,-0.905602f,-0.905643f,-0.905683f,-0.905724f,-0.905765f,-0.905805f,-0.905846f,-0.905886f,-0.905927f,-0.905968f,-0.906008f,-0.906049f,-0.906089f,-0.90613f,-0.906171f,-0.906211f,-0.906252f,-0.906292f,-0.906333f,-0.906373f,-0.906414f,-0.906454f,-0.906495f,-0.906535f,-0.906575f,-0.906616f,-0.906656f,-0.906697f,-0.906737f,-0.906778f,-0.906818f,-0.906859f,-0.906899f,-0.906939f,-0.90698f,-0.90702f,-0.90706f,-0.907101f,-0.907141f,-0.907182f,-0.907222f,-0.907262f,-0.907302f,-0.907343f,-0.907383f,-0.907423f,-0.907464f,-0.907504f,-0.907544f,-0.907585f,-0.907625f,-0.907665f,-0.907705f,-0.907745f,-0.907786f,-0.907826f,-0.907866f,-0.907906f,-0.907946f,-0.907987f,-0.908027f,-0.908067f,-0.908107f,-0.908147f,-0.908187f,-0.908228f,-0.908268f,-0.908308f,-0.908348f,-0.908388f,-0.908428f,-0.908468f,-0.908508f,-0.908548f,-0.908588f,-0.908628f,-0.908668f,-0.908708f,-0.908748f,-0.908788f,-0.908828f,-0.908868f,-0.908908f,-0.908948f,-0.908988f,-0.909028f,-0.909068f,-0.909108f,-0.909148f,-0.909188f,-0.909228f,-0.909268f,-0.909308f,-0.909348f,-0.909388f,-0.909427f,-0.909467f,-0.909507f,-0.909547f,-0.909587f,-0.909627f,-0.909666f,-0.909706f,-0.909746f,-0.909786f,-0.909826f,-0.909865f,-0.909905f,-0.909945f,-0.909985f,-0.910025f,-0.910064f,-0.910104f,-0.910144f,-0.910183f,-0.910223f,-0.910263f,-0.910302f,-0.910342f,-0.910382f,-0.910421f,-0.910461f,-0.910501f,-0.91054f,-0.91058f,-0.91062f,-0.910659f,-0.910699f,-0.910739f,-0.910778f,-0.910818f,-0.910857f,-0.910897f,-0.910936f,-0.910976f,-0.911015f,-0.911055f,-0.911094f,-0.911134f,-0.911173f,-0.911213f,-0.911253f,-0.911292f,-0.911332f,-0.911371f,-0.91141f,-0.91145f,-0.911489f,-0.911529f,-0.911568f,-0.911608f,-0.911647f,-0.911686f,-0.911726f,-0.911765f,-0.911804f,-0.911844f,-0.911883f,-0.911923f,-0.911962f,-0.912001f,-0.912041f,-0.91208f,-0.912119f,-0.912158f,-0.912198f,-0.912237f,-0.912276f,-0.912316f,-0.912355f,-0.912394f,-0.912433f,-0.912472f,-0.912512f,-0.912551f,-0.91259f,-0.912629f,-0.912669f,-0.912708f,-0.912747f,-0.912786f,-0.912825f,-0.912864f,-0.912904f,-0.912943f,-0.912982f,-0.913021f,-0.91306f,-0.913099f,-0.913138f,-0.913177f,-0.913216f,-0.913255f,-0.913294f,-0.913334f,-0.913373f,-0.913412f,-0.913451f,-0.91349f,-0.913529f,-0.913568f,-0.913607f,-0.913646f,-0.913684f,-0.913723f,-0.913762f,-0.913801f,-0.91384f,-0.913879f,-0.913918f,-0.913957f,-0.913996f,-0.914035f,-0.914074f,-0.914113f,-0.914151f,-0.91419f,-0.914229f,-0.914268f,-0.914307f,-0.914346f,-0.914384f,-0.914423f,-0.914462f,-0.914501f,-0.91454f,-0.914579f,-0.914617f,-0.914656f,-0.914695f,-0.914734f,-0.914772f,-0.914811f,-0.91485f,-0.914888f,-0.914927f,-0.914966f,-0.915004f,-0.915043f,-0.915082f,-0.915121f,-0.915159f,-0.915198f,-0.915236f,-0.915275f,-0.915314f,-0.915352f,-0.915391f,-0.915429f,-0.915468f,-0.915507f,-0.915545f,-0.915584f,-0.915622f,-0.915661f,-0.915699f,-0.915738f,-0.915776f,-0.915815f,-0.915853f,-0.915892f,-0.91593f,-0.915969f,-0.916007f,-0.916046f,-0.916084f,-0.916123f,-0.916161f,-0.916199f,-0.916238f,-0.916276f,-0.916315f,-0.916353f,-0.916392f,-0.91643f,-0.916468f,-0.916507f,-0.916545f,-0.916583f,-0.916622f,-0.91666f,-0.916698f,-0.916737f,-0.916775f,-0.916813f,-0.916851f,-0.91689f,-0.916928f,-0.916966f,-0.917005f,-0.917043f,-0.917081f,-0.917119f,-0.917157f,-0.917196f,-0.917234f,-0.917272f,-0.91731f,-0.917348f,-0.917386f,-0.917425f,-0.917463f,-0.917501f,-0.917539f,-0.917577f,-0.917615f,-0.917653f,-0.917691f,-0.91773f,-0.917768f,-0.917806f,-0.917844f,-0.917882f,-0.91792f,-0.917958f,-0.917996f,-0.918034f,-0.918072f,-0.91811f,-0.918148f,-0.918186f,-0.918224f,-0.918262f,-0.9183f,-0.918338f,-0.918376f,-0.918414f,-0.918452f,-0.918489f,-0.918527f,-0.918565f,-0.918603f,-0.918641f,-0.918679f,-0.918717f,-0.918755f,-0.918793f,-0.91883f,-0.918868f,-0.918906f,-0.918944f,-0.918982f,-0.919019f,-0.919057f,-0.919095f,-0.919133f,-0.91917f,-0.919208f,-0.919246f,-0.919284f,-0.919321f,-0.919359f,-0.919397f,-0.919435f,-0.919472f,-0.91951f,-0.919548f,-0.919585f,-0.919623f,-0.919661f,-0.919698f,-0.919736f,-0.919774f,-0.919811f,-0.919849f,-0.919886f,-0.919924f,-0.919962f,-0.919999f,-0.920037f,-0.920074f,-0.920112f,-0.92015f,-0.920187f,-0.920225f,-0.920262f,-0.9203f,-0.920337f,-0.920375f,-0.920412f,-0.920449f,-0.920487f,-0.920524f,-0.920562f,-0.920599f,-0.920637f,-0.920674f,-0.920712f,-0.920749f,-0.920786f,-0.920824f,-0.920861f,-0.920899f,-0.920936f,-0.920973f,-0.921011f,-0.921048f,-0.921085f,-0.921123f,-0.92116f,-0.921197f,-0.921235f,-0.921272f,-0.921309f,-0.921346f,-0.921384f,-0.921421f,-0.921458f,-0.921495f,-0.921533f,-0.92157f,-0.921607f,-0.921644f,-0.921681f,-0.921719f,-0.921756f,-0.921793f,-0.92183f,-0.921867f,-0.921905f,-0.921942f,-0.921979f,-0.922016f,-0.922053f,-0.92209f,-0.922127f,-0.922164f,-0.922201f,-0.922238f,-0.922275f,-0.922313f,-0.92235f,-0.922387f,-0.922424f,-0.922461f,-0.922498f,-0.922535f,-0.922572f,-0.922609f,-0.922646f,-0.922683f,-0.92272f,-0.922757f,-0.922794f,-0.92283f,-0.922867f,-0.922904f,-0.922941f,-0.922978f,-0.923015f,-0.923052f,-0.923089f,-0.923126f,-0.923163f,-0.923199f,-0.923236f,-0.923273f,-0.92331f,-0.923347f,-0.923383f,-0.92342f,-0.923457f,-0.923494f,-0.923531f,-0.923567f,-0.923604f,-0.923641f,-0.923678f,-0.923714f,-0.923751f,-0.923788f,-0.923825f,-0.923861f,-0.923898f,-0.923935f,-0.923971f,-0.924008f,-0.924045f,-0.924081f,-0.924118f,-0.924155f,-0.924191f,-0.924228f,-0.924264f,-0.924301f,-0.924338f,-0.924374f,-0.924411f,-0.924447f,-0.924484f,-0.92452f,-0.924557f,-0.924593f,-0.92463f,-0.924666f,-0.924703f,-0.92474f,-0.924776f,-0.924812f,-0.924849f,-0.924885f,-0.924922f,-0.924958f,-0.924995f,-0.925031f,-0.925067f,-0.925104f,-0.92514f,-0.925177f,-0.925213f,-0.925249f,-0.925286f,-0.925322f,-0.925359f,-0.925395f,-0.925431f,-0.925468f,-0.925504f,-0.92554f,-0.925576f,-0.925613f,-0.925649f,-0.925685f,-0.925722f,-0.925758f,-0.925794f,-0.92583f,-0.925866f,-0.925903f,-0.925939f,-0.925975f,-0.926011f,-0.926048f,-0.926084f,-0.92612f,-0.926156f,-0.926192f,-0.926228f,-0.926264f,-0.926301f,-0.926337f,-0.926373f,-0.926409f,-0.926445f,-0.926481f,-0.926517f,-0.926553f,-0.926589f,-0.926625f,-0.926661f,-0.926697f,-0.926733f,-0.926769f,-0.926805f,-0.926841f,-0.926877f,-0.926913f,-0.926949f,-0.926985f,-0.927021f,-0.927057f,-0.927093f,-0.927129f,-0.927165f,-0.927201f,-0.927237f,-0.927273f,-0.927309f,-0.927345f,-0.927381f,-0.927416f,-0.927452f,-0.927488f,-0.927524f,-0.92756f,-0.927595f,-0.927631f,-0.927667f,-0.927703f,-0.927739f,-0.927775f,-0.92781f,-0.927846f,-0.927882f,-0.927918f,-0.927953f,-0.927989f,-0.928025f,-0.92806f,-0.928096f,-0.928132f,-0.928167f,-0.928203f,-0.928239f,-0.928275f,-0.92831f,-0.928346f,-0.928382f,-0.928417f,-0.928453f,-0.928488f,-0.928524f,-0.928559f,-0.928595f,-0.928631f,-0.928666f,-0.928702f,-0.928737f,-0.928773f,-0.928809f,-0.928844f,-0.928879f,-0.928915f,-0.92895f,-0.928986f,-0.929021f,-0.929057f,-0.929092f,-0.929128f,-0.929163f,-0.929199f,-0.929234f,-0.929269f,-0.929305f,-0.92934f,-0.929376f,-0.929411f,-0.929447f,-0.929482f,-0.929517f,-0.929553f,-0.929588f,-0.929623f,-0.929659f,-0.929694f,-0.929729f,-0.929765f,-0.9298f,-0.929835f,-0.92987f,-0.929906f,-0.929941f,-0.929976f,-0.930011f,-0.930047f,-0.930082f,-0.930117f,-0.930152f,-0.930187f,-0.930223f,-0.930258f,-0.930293f,-0.930328f,-0.930363f,-0.930398f,-0.930434f,-0.930469f,-0.930504f,-0.930539f,-0.930574f,-0.930609f,-0.930644f,-0.930679f,-0.930714f,-0.930749f,-0.930785f,-0.93082f,-0.930855f,-0.93089f,-0.930925f,-0.93096f,-0.930995f,-0.93103f,-0.931065f,-0.9311f,-0.931135f,-0.93117f,-0.931205f,-0.931239f,-0.931274f,-0.931309f,-0.931344f,-0.931379f,-0.931414f,-0.931449f,-0.931484f,-0.931519f,-0.931553f,-0.931588f,-0.931623f,-0.931658f,-0.931693f,-0.931728f,-0.931763f,-0.931797f,-0.931832f,-0.931867f,-0.931902f,-0.931936f,-0.931971f,-0.932006f,-0.932041f,-0.932075f,-0.93211f,-0.932145f,-0.93218f,-0.932214f,-0.932249f,-0.932284f,-0.932318f,-0.932353f,-0.932388f,-0.932422f,-0.932457f,-0.932492f,-0.932526f,-0.932561f,-0.932595f,-0.93263f,-0.932665f,-0.932699f,-0.932734f,-0.932768f,-0.932803f,-0.932838f,-0.932872f,-0.932907f,-0.932941f,-0.932976f,-0.93301f,-0.933045f,-0.933079f,-0.933114f,-0.933148f,-0.933182f,-0.933217f,-0.933251f,-0.933286f,-0.93332f,-0.933355f,-0.933389f,-0.933424f,-0.933458f,-0.933492f,-0.933527f,-0.933561f,-0.933595f,-0.93363f,-0.933664f,-0.933698f,-0.933733f,-0.933767f,-0.933801f,-0.933836f,-0.93387f,-0.933904f,-0.933939f,-0.933973f,-0.934007f,-0.934041f,-0.934075f,-0.93411f,-0.934144f,-0.934178f,-0.934212f,-0.934247f,-0.934281f,-0.934315f,-0.934349f,-0.934383f,-0.934417f,-0.934452f,-0.934486f,-0.93452f,-0.934554f,-0.934588f,-0.934622f,-0.934656f,-0.93469f,-0.934724f,-0.934758f,-0.934792f,-0.934826f,-0.934861f,-0.934895f,-0.934929f,-0.934963f,-0.934997f,-0.935031f,-0.935065f,-0.935099f,-0.935133f,-0.935167f,-0.935201f,-0.935234f,-0.935268f,-0.935302f,-0.935336f,-0.93537f,-0.935404f,-0.935438f,-0.935472f,-0.935506f,-0.93554f,-0.935574f,-0.935607f,-0.935641f,-0.935675f,-0.935709f,-0.935743f,-0.935776f,-0.93581f,-0.935844f,-0.935878f,-0.935912f,-0.935945f,-0.935979f,-0.936013f,-0.936047f,-0.93608f,-0.936114f,-0.936148f,-0.936182f,-0.936215f,-0.936249f,-0.936283f,-0.936316f,-0.93635f,-0.936384f,-0.936417f,-0.936451f,-0.936484f,-0.936518f,-0.936552f,-0.936585f,-0.936619f,-0.936653f,-0.936686f,-0.93672f,-0.936753f,-0.936787f,-0.93682f,-0.936854f,-0.936887f,-0.936921f,-0.936954f,-0.936988f,-0.937021f,-0.937055f,-0.937088f,-0.937122f,-0.937155f,-0.937189f,-0.937222f,-0.937256f,-0.937289f,-0.937322f,-0.937356f,-0.937389f,-0.937423f,-0.937456f,-0.937489f,-0.937523f,-0.937556f,-0.937589f,-0.937623f,-0.937656f,-0.937689f,-0.937723f,-0.937756f,-0.937789f,-0.937823f,-0.937856f,-0.937889f,-0.937922f,-0.937956f,-0.937989f,-0.938022f,-0.938055f,-0.938088f,-0.938122f,-0.938155f,-0.938188f,-0.938221f,-0.938254f,-0.938288f,-0.938321f,-0.938354f,-0.938387f,-0.93842f,-0.938453f,-0.938486f,-0.938519f,-0.938553f,-0.938586f,-0.938619f,-0.938652f,-0.938685f,-0.938718f,-0.938751f,-0.938784f,-0.938817f,-0.93885f,-0.938883f,-0.938916f,-0.938949f,-0.938982f,-0.939015f,-0.939048f,-0.939081f,-0.939114f,-0.939147f,-0.93918f,-0.939213f,-0.939245f,-0.939278f,-0.939311f,-0.939344f,-0.939377f,-0.93941f,-0.939443f,-0.939476f,-0.939509f,-0.939541f,-0.939574f,-0.939607f,-0.93964f,-0.939673f,-0.939705f,-0.939738f,-0.939771f,-0.939804f,-0.939837f,-0.939869f,-0.939902f,-0.939935f,-0.939967f,-0.94f,-0.940033f,-0.940066f,-0.940098f,-0.940131f,-0.940164f,-0.940196f,-0.940229f,-0.940261f,-0.940294f,-0.940327f,-0.94036f,-0.940392f,-0.940425f,-0.940457f,-0.94049f,-0.940522f,-0.940555f,-0.940588f,-0.94062f,-0.940653f,-0.940685f,-0.940718f,-0.94075f,-0.940783f,-0.940815f,-0.940848f,-0.94088f,-0.940913f,-0.940945f,-0.940978f,-0.94101f,-0.941042f,-0.941075f,-0.941107f,-0.94114f,-0.941172f,-0.941204f,-0.941237f,-0.941269f,-0.941302f,-0.941334f,-0.941366f,-0.941399f,-0.941431f,-0.941463f,-0.941496f,-0.941528f,-0.94156f,-0.941593f,-0.941625f,-0.941657f,-0.941689f,-0.941722f,-0.941754f,-0.941786f,-0.941818f,-0.94185f,-0.941883f,-0.941915f,-0.941947f,-0.941979f,-0.942012f,-0.942044f,-0.942076f,-0.942108f,-0.94214f,-0.942172f,-0.942204f,-0.942237f,-0.942269f,-0.942301f,-0.942333f,-0.942365f,-0.942397f,-0.942429f,-0.942461f,-0.942493f,-0.942525f,-0.942557f,-0.942589f,-0.942621f,-0.942653f,-0.942685f,-0.942717f,-0.942749f,-0.942781f,-0.942813f,-0.942845f,-0.942877f,-0.942909f,-0.942941f,-0.942973f,-0.943005f,-0.943037f,-0.943069f,-0.9431f,-0.943132f,-0.943164f,-0.943196f,-0.943228f,-0.94326f,-0.943291f,-0.943323f,-0.943355f,-0.943387f,-0.943419f,-0.943451f,-0.943482f,-0.943514f,-0.943546f,-0.943578f,-0.943609f,-0.943641f,-0.943673f,-0.943705f,-0.943736f,-0.943768f,-0.9438f,-0.943831f,-0.943863f,-0.943895f,-0.943926f,-0.943958f,-0.94399f,-0.944021f,-0.944053f,-0.944085f,-0.944116f,-0.944148f,-0.944179f,-0.944211f,-0.944242f,-0.944274f,-0.944306f,-0.944337f,-0.944369f,-0.9444f,-0.944432f,-0.944463f,-0.944495f,-0.944526f,-0.944558f,-0.944589f,-0.944621f,-0.944652f,-0.944684f,-0.944715f,-0.944746f,-0.944778f,-0.944809f,-0.944841f,-0.944872f,-0.944903f,-0.944935f,-0.944966f,-0.944997f,-0.945029f,-0.94506f,-0.945092f,-0.945123f,-0.945154f,-0.945186f,-0.945217f,-0.945248f,-0.945279f,-0.945311f,-0.945342f,-0.945373f,-0.945404f,-0.945436f,-0.945467f,-0.945498f,-0.945529f,-0.945561f,-0.945592f,-0.945623f,-0.945654f,-0.945685f,-0.945717f,-0.945748f,-0.945779f,-0.94581f,-0.945841f,-0.945872f,-0.945903f,-0.945934f,-0.945965f,-0.945996f,-0.946028f,-0.946059f,-0.94609f,-0.946121f,-0.946152f,-0.946183f,-0.946214f,-0.946245f,-0.946276f,-0.946307f,-0.946338f,-0.946369f,-0.9464f,-0.946431f,-0.946462f,-0.946493f,-0.946524f,-0.946555f,-0.946586f,-0.946616f,-0.946647f,-0.946678f,-0.946709f,-0.94674f,-0.946771f,-0.946802f,-0.946833f,-0.946863f,-0.946894f,-0.946925f,-0.946956f,-0.946987f,-0.947018f,-0.947048f,-0.947079f,-0.94711f,-0.947141f,-0.947171f,-0.947202f,-0.947233f,-0.947264f,-0.947294f,-0.947325f,-0.947356f,-0.947386f,-0.947417f,-0.947448f,-0.947478f,-0.947509f,-0.94754f,-0.94757f,-0.947601f,-0.947632f,-0.947662f,-0.947693f,-0.947723f,-0.947754f,-0.947785f,-0.947815f,-0.947846f,-0.947876f,-0.947907f,-0.947937f,-0.947968f,-0.947998f,-0.948029f,-0.948059f,-0.94809f,-0.94812f,-0.948151f,-0.948181f,-0.948212f,-0.948242f,-0.948273f,-0.948303f,-0.948333f,-0.948364f,-0.948394f,-0.948425f,-0.948455f,-0.948485f,-0.948516f,-0.948546f,-0.948577f,-0.948607f,-0.948637f,-0.948668f,-0.948698f,-0.948728f,-0.948758f,-0.948789f,-0.948819f,-0.948849f,-0.94888f,-0.94891f,-0.94894f,-0.94897f,-0.949001f,-0.949031f,-0.949061f,-0.949091f,-0.949121f,-0.949152f,-0.949182f,-0.949212f,-0.949242f,-0.949272f,-0.949302f,-0.949333f,-0.949363f,-0.949393f,-0.949423f,-0.949453f,-0.949483f,-0.949513f,-0.949543f,-0.949573f,-0.949603f,-0.949633f,-0.949663f,-0.949694f,-0.949723f,-0.949754f,-0.949784f,-0.949813f,-0.949843f,-0.949873f,-0.949903f,-0.949933f,-0.949963f,-0.949993f,-0.950023f,-0.950053f,-0.950083f,-0.950113f,-0.950143f,-0.950173f,-0.950203f,-0.950233f,-0.950262f,-0.950292f,-0.950322f,-0.950352f,-0.950382f,-0.950412f,-0.950441f,-0.950471f,-0.950501f,-0.950531f,-0.950561f,-0.95059f,-0.95062f,-0.95065f,-0.95068f,-0.950709f,-0.950739f,-0.950769f,-0.950798f,-0.950828f,-0.950858f,-0.950888f,-0.950917f,-0.950947f,-0.950977f,-0.951006f,-0.951036f,-0.951065f,-0.951095f,-0.951125f,-0.951154f,-0.951184f,-0.951213f,-0.951243f,-0.951273f,-0.951302f,-0.951332f,-0.951361f,-0.951391f,-0.95142f,-0.95145f,-0.951479f,-0.951509f,-0.951538f,-0.951568f,-0.951597f,-0.951627f,-0.951656f,-0.951686f,-0.951715f,-0.951744f,-0.951774f,-0.951803f,-0.951833f,-0.951862f,-0.951892f,-0.951921f,-0.95195f,-0.95198f,-0.952009f,-0.952038f,-0.952068f,-0.952097f,-0.952126f,-0.952156f,-0.952185f,-0.952214f,-0.952243f,-0.952273f,-0.952302f,-0.952331f,-0.952361f,-0.95239f,-0.952419f,-0.952448f,-0.952477f,-0.952507f,-0.952536f,-0.952565f,-0.952594f,-0.952623f,-0.952652f,-0.952681f,-0.952711f,-0.95274f,-0.952769f,-0.952798f,-0.952827f,-0.952856f,-0.952885f,-0.952914f,-0.952944f,-0.952973f,-0.953002f,-0.953031f,-0.95306f,-0.953089f,-0.953118f,-0.953147f,-0.953176f,-0.953205f,-0.953234f,-0.953263f,-0.953292f,-0.953321f,-0.95335f,-0.953378f,-0.953407f,-0.953436f,-0.953465f,-0.953494f,-0.953523f,-0.953552f,-0.953581f,-0.95361f,-0.953638f,-0.953667f,-0.953696f,-0.953725f,-0.953754f,-0.953783f,-0.953811f,-0.95384f,-0.953869f,-0.953898f,-0.953927f,-0.953955f,-0.953984f,-0.954013f,-0.954042f,-0.95407f,-0.954099f,-0.954128f,-0.954156f,-0.954185f,-0.954214f,-0.954243f,-0.954271f,-0.9543f,-0.954328f,-0.954357f,-0.954386f,-0.954414f,-0.954443f,-0.954472f,-0.9545f,-0.954529f,-0.954557f,-0.954586f,-0.954614f,-0.954643f,-0.954671f,-0.9547f,-0.954729f,-0.954757f,-0.954786f,-0.954814f,-0.954843f,-0.954871f,-0.9549f,-0.954928f,-0.954956f,-0.954985f,-0.955013f,-0.955042f,-0.95507f,-0.955099f,-0.955127f,-0.955155f,-0.955184f,-0.955212f,-0.955241f,-0.955269f,-0.955297f,-0.955326f,-0.955354f,-0.955382f,-0.955411f,-0.955439f,-0.955467f,-0.955495f,-0.955524f,-0.955552f,-0.95558f,-0.955609f,-0.955637f,-0.955665f,-0.955693f,-0.955721f,-0.95575f,-0.955778f,-0.955806f,-0.955834f,-0.955862f,-0.955891f,-0.955919f,-0.955947f,-0.955975f,-0.956003f,-0.956031f,-0.956059f,-0.956088f,-0.956116f,-0.956144f,-0.956172f,-0.9562f,-0.956228f,-0.956256f,-0.956284f,-0.956312f,-0.95634f,-0.956368f,-0.956396f,-0.956424f,-0.956452f,-0.95648f,-0.956508f,-0.956536f,-0.956564f,-0.956592f,-0.95662f,-0.956648f,-0.956676f,-0.956703f,-0.956731f,-0.956759f,-0.956787f,-0.956815f,-0.956843f,-0.956871f,-0.956899f,-0.956926f,-0.956954f,-0.956982f,-0.95701f,-0.957038f,-0.957066f,-0.957093f,-0.957121f,-0.957149f,-0.957177f,-0.957204f,-0.957232f,-0.95726f,-0.957288f,-0.957315f,-0.957343f,-0.957371f,-0.957398f,-0.957426f,-0.957454f,-0.957481f,-0.957509f,-0.957537f,-0.957564f,-0.957592f,-0.95762f,-0.957647f,-0.957675f,-0.957702f,-0.95773f,-0.957758f,-0.957785f,-0.957813f,-0.95784f,-0.957868f,-0.957895f,-0.957923f,-0.95795f,-0.957978f,-0.958005f,-0.958033f,-0.95806f,-0.958088f,-0.958115f,-0.958143f,-0.95817f,-0.958198f,-0.958225f,-0.958252f,-0.95828f,-0.958307f,-0.958335f,-0.958362f,-0.958389f,-0.958417f,-0.958444f,-0.958471f,-0.958499f,-0.958526f,-0.958553f,-0.958581f,-0.958608f,-0.958635f,-0.958663f,-0.95869f,-0.958717f,-0.958744f,-0.958772f,-0.958799f,-0.958826f,-0.958853f,-0.958881f,-0.958908f,-0.958935f,-0.958962f,-0.958989f,-0.959017f,-0.959044f,-0.959071f,-0.959098f,-0.959125f,-0.959152f,-0.959179f,-0.959207f,-0.959234f,-0.959261f,-0.959288f,-0.959315f,-0.959342f,-0.959369f,-0.959396f,-0.959423f,-0.95945f,-0.959477f,-0.959504f,-0.959531f,-0.959558f,-0.959585f,-0.959612f,-0.959639f,-0.959666f,-0.959693f,-0.95972f,-0.959747f,-0.959774f,-0.959801f,-0.959827f,-0.959854f,-0.959881f,-0.959908f,-0.959935f,-0.959962f,-0.959989f,-0.960016f,-0.960042f,-0.960069f,-0.960096f,-0.960123f,-0.96015f,-0.960177f,-0.960203f,-0.96023f,-0.960257f,-0.960284f,-0.96031f,-0.960337f,-0.960364f,-0.96039f,-0.960417f,-0.960444f,-0.960471f,-0.960497f,-0.960524f,-0.960551f,-0.960577f,-0.960604f,-0.960631f,-0.960657f,-0.960684f,-0.96071f,-0.960737f,-0.960764f,-0.96079f,-0.960817f,-0.960843f,-0.96087f,-0.960896f,-0.960923f,-0.96095f,-0.960976f,-0.961003f,-0.961029f,-0.961056f,-0.961082f,-0.961109f,-0.961135f,-0.961162f,-0.961188f,-0.961214f,-0.961241f,-0.961267f,-0.961294f,-0.96132f,-0.961347f,-0.961373f,-0.961399f,-0.961426f,-0.961452f,-0.961478f,-0.961505f,-0.961531f,-0.961557f,-0.961584f,-0.96161f,-0.961636f,-0.961663f,-0.961689f,-0.961715f,-0.961741f,-0.961768f,-0.961794f,-0.96182f,-0.961847f,-0.961873f,-0.961899f,-0.961925f,-0.961951f,-0.961978f,-0.962004f,-0.96203f,-0.962056f,-0.962082f,-0.962108f,-0.962134f,-0.962161f,-0.962187f,-0.962213f,-0.962239f,-0.962265f,-0.962291f,-0.962317f,-0.962343f,-0.962369f,-0.962395f,-0.962421f,-0.962447f,-0.962473f,-0.962499f,-0.962525f,-0.962551f,-0.962577f,-0.962604f,-0.962629f,-0.962655f,-0.962681f,-0.962707f,-0.962733f,-0.962759f,-0.962785f,-0.962811f,-0.962837f,-0.962863f,-0.962889f,-0.962914f,-0.96294f,-0.962966f,-0.962992f,-0.963018f,-0.963044f,-0.96307f,-0.963095f,-0.963121f,-0.963147f,-0.963173f,-0.963199f,-0.963224f,-0.96325f,-0.963276f,-0.963301f,-0.963327f,-0.963353f,-0.963379f,-0.963404f,-0.96343f,-0.963456f,-0.963481f,-0.963507f,-0.963533f,-0.963558f,-0.963584f,-0.96361f,-0.963635f,-0.963661f,-0.963687f,-0.963712f,-0.963738f,-0.963763f,-0.963789f,-0.963814f,-0.96384f,-0.963866f,-0.963891f,-0.963917f,-0.963942f,-0.963968f,-0.963993f,-0.964019f,-0.964044f,-0.96407f,-0.964095f,-0.96412f,-0.964146f,-0.964171f,-0.964197f,-0.964222f,-0.964248f,-0.964273f,-0.964298f,-0.964324f,-0.964349f,-0.964375f,-0.9644f,-0.964425f,-0.964451f,-0.964476f,-0.964501f,-0.964527f,-0.964552f,-0.964577f,-0.964602f,-0.964628f,-0.964653f,-0.964678f,-0.964704f,-0.964729f,-0.964754f,-0.964779f,-0.964804f,-0.96483f,-0.964855f,-0.96488f,-0.964905f,-0.96493f,-0.964956f,-0.964981f,-0.965006f,-0.965031f,-0.965056f,-0.965081f,-0.965106f,-0.965132f,-0.965157f,-0.965182f,-0.965207f,-0.965232f,-0.965257f,-0.965282f,-0.965307f,-0.965332f,-0.965357f,-0.965382f,-0.965407f,-0.965432f,-0.965457f,-0.965482f,-0.965507f,-0.965532f,-0.965557f,-0.965582f,-0.965607f,-0.965632f,-0.965657f,-0.965681f,-0.965706f,-0.965731f,-0.965756f,-0.965781f,-0.965806f,-0.965831f,-0.965855f,-0.96588f,-0.965905f,-0.96593f,-0.965955f,-0.96598f,-0.966004f,-0.966029f,-0.966054f,-0.966079f,-0.966103f,-0.966128f,-0.966153f,-0.966178f,-0.966202f,-0.966227f,-0.966252f,-0.966277f,-0.966301f,-0.966326f,-0.966351f,-0.966375f,-0.9664f,-0.966424f,-0.966449f,-0.966474f,-0.966498f,-0.966523f,-0.966547f,-0.966572f,-0.966597f,-0.966621f,-0.966646f,-0.96667f,-0.966695f,-0.96672f,-0.966744f,-0.966769f,-0.966793f,-0.966817f,-0.966842f,-0.966866f,-0.966891f,-0.966915f,-0.96694f,-0.966964f,-0.966989f,-0.967013f,-0.967037f,-0.967062f,-0.967086f,-0.967111f,-0.967135f,-0.96716f,-0.967184f,-0.967208f,-0.967233f,-0.967257f,-0.967281f,-0.967306f,-0.96733f,-0.967354f,-0.967378f,-0.967403f,-0.967427f,-0.967451f,-0.967476f,-0.9675f,-0.967524f,-0.967548f,-0.967573f,-0.967597f,-0.967621f,-0.967645f,-0.967669f,-0.967693f,-0.967718f,-0.967742f,-0.967766f,-0.96779f,-0.967814f,-0.967838f,-0.967862f,-0.967887f,-0.967911f,-0.967935f,-0.967959f,-0.967983f,-0.968007f,-0.968031f,-0.968055f,-0.968079f,-0.968103f,-0.968127f,-0.968151f,-0.968175f,-0.968199f,-0.968223f,-0.968247f,-0.968271f,-0.968295f,-0.968319f,-0.968343f,-0.968367f,-0.968391f,-0.968415f,-0.968439f,-0.968462f,-0.968486f,-0.96851f,-0.968534f,-0.968558f,-0.968582f,-0.968606f,-0.968629f,-0.968653f,-0.968677f,-0.968701f,-0.968725f,-0.968748f,-0.968772f,-0.968796f,-0.96882f,-0.968844f,-0.968867f,-0.968891f,-0.968915f,-0.968938f,-0.968962f,-0.968986f,-0.96901f,-0.969033f,-0.969057f,-0.969081f,-0.969104f,-0.969128f,-0.969151f,-0.969175f,-0.969199f,-0.969222f,-0.969246f,-0.969269f,-0.969293f,-0.969317f,-0.96934f,-0.969364f,-0.969387f,-0.969411f,-0.969434f,-0.969458f,-0.969481f,-0.969505f,-0.969528f,-0.969552f,-0.969575f,-0.969599f,-0.969622f,-0.969646f,-0.969669f,-0.969693f,-0.969716f,-0.969739f,-0.969763f,-0.969786f,-0.96981f,-0.969833f,-0.969856f,-0.96988f,-0.969903f,-0.969926f,-0.96995f,-0.969973f,-0.969996f,-0.97002f,-0.970043f,-0.970066f,-0.970089f,-0.970113f,-0.970136f,-0.970159f,-0.970183f,-0.970206f,-0.970229f,-0.970252f,-0.970275f,-0.970299f,-0.970322f,-0.970345f,-0.970368f,-0.970391f,-0.970414f,-0.970438f,-0.970461f,-0.970484f,-0.970507f,-0.97053f,-0.970553f,-0.970576f,-0.970599f,-0.970622f,-0.970645f,-0.970669f,-0.970692f,-0.970715f,-0.970738f,-0.970761f,-0.970784f,-0.970807f,-0.97083f,-0.970853f,-0.970876f,-0.970899f,-0.970922f,-0.970945f,-0.970967f,-0.97099f,-0.971013f,-0.971036f,-0.971059f,-0.971082f,-0.971105f,-0.971128f,-0.971151f,-0.971173f,-0.971196f,-0.971219f,-0.971242f,-0.971265f,-0.971288f,-0.97131f,-0.971333f,-0.971356f,-0.971379f,-0.971402f,-0.971424f,-0.971447f,-0.97147f,-0.971493f,-0.971515f,-0.971538f,-0.971561f,-0.971583f,-0.971606f,-0.971629f,-0.971651f,-0.971674f,-0.971697f,-0.971719f,-0.971742f,-0.971765f,-0.971787f,-0.97181f,-0.971832f,-0.971855f,-0.971878f,-0.9719f,-0.971923f,-0.971945f,-0.971968f,-0.97199f,-0.972013f,-0.972036f,-0.972058f,-0.972081f,-0.972103f,-0.972125f,-0.972148f,-0.97217f,-0.972193f,-0.972215f,-0.972238f,-0.97226f,-0.972283f,-0.972305f,-0.972327f,-0.97235f,-0.972372f,-0.972395f,-0.972417f,-0.972439f,-0.972462f,-0.972484f,-0.972506f,-0.972529f,-0.972551f,-0.972573f,-0.972596f,-0.972618f,-0.97264f,-0.972662f,-0.972685f,-0.972707f,-0.972729f,-0.972751f,-0.972774f,-0.972796f,-0.972818f,-0.97284f,-0.972862f,-0.972885f,-0.972907f,-0.972929f,-0.972951f,-0.972973f,-0.972995f,-0.973017f,-0.97304f,-0.973062f,-0.973084f,-0.973106f,-0.973128f,-0.97315f,-0.973172f,-0.973194f,-0.973216f,-0.973238f,-0.97326f,-0.973282f,-0.973304f,-0.973326f,-0.973348f,-0.97337f,-0.973392f,-0.973414f,-0.973436f,-0.973458f,-0.97348f,-0.973502f,-0.973524f,-0.973546f,-0.973568f,-0.97359f,-0.973611f,-0.973633f,-0.973655f,-0.973677f,-0.973699f,-0.973721f,-0.973743f,-0.973764f,-0.973786f,-0.973808f,-0.97383f,-0.973852f,-0.973873f,-0.973895f,-0.973917f,-0.973939f,-0.97396f,-0.973982f,-0.974004f,-0.974026f,-0.974047f,-0.974069f,-0.974091f,-0.974112f,-0.974134f,-0.974156f,-0.974177f,-0.974199f,-0.974221f,-0.974242f,-0.974264f,-0.974285f,-0.974307f,-0.974329f,-0.97435f,-0.974372f,-0.974393f,-0.974415f,-0.974436f,-0.974458f,-0.974479f,-0.974501f,-0.974523f,-0.974544f,-0.974566f,-0.974587f,-0.974608f,-0.97463f,-0.974651f,-0.974673f,-0.974694f,-0.974716f,-0.974737f,-0.974759f,-0.97478f,-0.974801f,-0.974823f,-0.974844f,-0.974865f,-0.974887f,-0.974908f,-0.97493f,-0.974951f,-0.974972f,-0.974993f,-0.975015f,-0.975036f,-0.975057f,-0.975079f,-0.9751f,-0.975121f,-0.975142f,-0.975164f,-0.975185f,-0.975206f,-0.975227f,-0.975248f,-0.97527f,-0.975291f,-0.975312f,-0.975333f,-0.975354f,-0.975375f,-0.975397f,-0.975418f,-0.975439f,-0.97546f,-0.975481f,-0.975502f,-0.975523f,-0.975544f,-0.975565f,-0.975587f,-0.975608f,-0.975629f,-0.97565f,-0.975671f,-0.975692f,-0.975713f,-0.975734f,-0.975755f,-0.975776f,-0.975797f,-0.975818f,-0.975838f,-0.97586f,-0.97588f,-0.975901f,-0.975922f,-0.975943f,-0.975964f,-0.975985f,-0.976006f,-0.976027f,-0.976048f,-0.976068f,-0.976089f,-0.97611f,-0.976131f,-0.976152f,-0.976173f,-0.976193f,-0.976214f,-0.976235f,-0.976256f,-0.976276f,-0.976297f,-0.976318f,-0.976339f,-0.976359f,-0.97638f,-0.976401f,-0.976422f,-0.976442f,-0.976463f,-0.976484f,-0.976504f,-0.976525f,-0.976546f,-0.976566f,-0.976587f,-0.976607f,-0.976628f,-0.976649f,-0.976669f,-0.97669f,-0.97671f,-0.976731f,-0.976752f,-0.976772f,-0.976793f,-0.976813f,-0.976834f,-0.976854f,-0.976875f,-0.976895f,-0.976916f,-0.976936f,-0.976957f,-0.976977f,-0.976997f,-0.977018f,-0.977038f,-0.977059f,-0.977079f,-0.9771f,-0.97712f,-0.97714f,-0.977161f,-0.977181f,-0.977202f,-0.977222f,-0.977242f,-0.977263f,-0.977283f,-0.977303f,-0.977323f,-0.977344f,-0.977364f,-0.977384f,-0.977405f,-0.977425f,-0.977445f,-0.977465f,-0.977486f,-0.977506f,-0.977526f,-0.977546f,-0.977566f,-0.977587f,-0.977607f,-0.977627f,-0.977647f,-0.977667f,-0.977687f,-0.977708f,-0.977728f,-0.977748f,-0.977768f,-0.977788f,-0.977808f,-0.977828f,-0.977848f,-0.977868f,-0.977888f,-0.977908f,-0.977929f,-0.977949f,-0.977969f,-0.977989f,-0.978009f,-0.978029f,-0.978049f,-0.978068f,-0.978088f,-0.978108f,-0.978128f,-0.978148f,-0.978168f,-0.978188f,-0.978208f,-0.978228f,-0.978248f,-0.978268f,-0.978288f,-0.978307f,-0.978327f,-0.978347f,-0.978367f,-0.978387f,-0.978407f,-0.978426f,-0.978446f,-0.978466f,-0.978486f,-0.978506f,-0.978525f,-0.978545f,-0.978565f,-0.978585f,-0.978604f,-0.978624f,-0.978644f,-0.978664f,-0.978683f,-0.978703f,-0.978723f,-0.978742f,-0.978762f,-0.978782f,-0.978801f,-0.978821f,-0.97884f,-0.97886f,-0.97888f,-0.978899f,-0.978919f,-0.978938f,-0.978958f,-0.978978f,-0.978997f,-0.979017f,-0.979036f,-0.979056f,-0.979075f,-0.979095f,-0.979114f,-0.979134f,-0.979153f,-0.979173f,-0.979192f,-0.979212f,-0.979231f,-0.97925f,-0.97927f,-0.979289f,-0.979309f,-0.979328f,-0.979347f,-0.979367f,-0.979386f,-0.979406f,-0.979425f,-0.979444f,-0.979464f,-0.979483f,-0.979502f,-0.979522f,-0.979541f,-0.97956f,-0.979579f,-0.979599f,-0.979618f,-0.979637f,-0.979656f,-0.979676f,-0.979695f,-0.979714f,-0.979733f,-0.979753f,-0.979772f,-0.979791f,-0.97981f,-0.979829f,-0.979848f,-0.979868f,-0.979887f,-0.979906f,-0.979925f,-0.979944f,-0.979963f,-0.979982f,-0.980001f,-0.98002f,-0.980039f,-0.980059f,-0.980078f,-0.980097f,-0.980116f,-0.980135f,-0.980154f,-0.980173f,-0.980192f,-0.980211f,-0.98023f,-0.980249f,-0.980268f,-0.980286f,-0.980305f,-0.980324f,-0.980343f,-0.980362f,-0.980381f,-0.9804f,-0.980419f,-0.980438f,-0.980457f,-0.980475f,-0.980494f,-0.980513f,-0.980532f,-0.980551f,-0.98057f,-0.980588f,-0.980607f,-0.980626f,-0.980645f,-0.980664f,-0.980682f,-0.980701f,-0.98072f,-0.980739f,-0.980757f,-0.980776f,-0.980795f,-0.980813f,-0.980832f,-0.980851f,-0.980869f,-0.980888f,-0.980907f,-0.980925f,-0.980944f,-0.980963f,-0.980981f,-0.981f,-0.981018f,-0.981037f,-0.981056f,-0.981074f,-0.981093f,-0.981111f,-0.98113f,-0.981148f,-0.981167f,-0.981185f,-0.981204f,-0.981222f,-0.981241f,-0.981259f,-0.981278f,-0.981296f,-0.981315f,-0.981333f,-0.981352f,-0.98137f,-0.981388f,-0.981407f,-0.981425f,-0.981444f,-0.981462f,-0.98148f,-0.981499f,-0.981517f,-0.981535f,-0.981554f,-0.981572f,-0.98159f,-0.981609f,-0.981627f,-0.981645f,-0.981664f,-0.981682f,-0.9817f,-0.981718f,-0.981737f,-0.981755f,-0.981773f,-0.981791f,-0.981809f,-0.981828f,-0.981846f,-0.981864f,-0.981882f,-0.9819f,-0.981919f,-0.981937f,-0.981955f,-0.981973f,-0.981991f,-0.982009f,-0.982027f,-0.982045f,-0.982063f,-0.982081f,-0.9821f,-0.982118f,-0.982136f,-0.982154f,-0.982172f,-0.98219f,-0.982208f,-0.982226f,-0.982244f,-0.982262f,-0.98228f,-0.982298f,-0.982316f,-0.982334f,-0.982352f,-0.982369f,-0.982387f,-0.982405f,-0.982423f,-0.982441f,-0.982459f,-0.982477f,-0.982495f,-0.982513f,-0.98253f,-0.982548f,-0.982566f,-0.982584f,-0.982602f,-0.982619f,-0.982637f,-0.982655f,-0.982673f,-0.982691f,-0.982708f,-0.982726f,-0.982744f,-0.982762f,-0.982779f,-0.982797f,-0.982815f,-0.982832f,-0.98285f,-0.982868f,-0.982885f,-0.982903f,-0.982921f,-0.982938f,-0.982956f,-0.982974f,-0.982991f,-0.983009f,-0.983027f,-0.983044f,-0.983062f,-0.983079f,-0.983097f,-0.983114f,-0.983132f,-0.983149f,-0.983167f,-0.983184f,-0.983202f,-0.983219f,-0.983237f,-0.983254f,-0.983272f,-0.983289f,-0.983307f,-0.983324f,-0.983342f,-0.983359f,-0.983376f,-0.983394f,-0.983411f,-0.983429f,-0.983446f,-0.983463f,-0.983481f,-0.983498f,-0.983515f,-0.983533f,-0.98355f,-0.983567f,-0.983585f,-0.983602f,-0.983619f,-0.983637f,-0.983654f,-0.983671f,-0.983688f,-0.983706f,-0.983723f,-0.98374f,-0.983757f,-0.983774f,-0.983792f,-0.983809f,-0.983826f,-0.983843f,-0.98386f,-0.983878f,-0.983895f,-0.983912f,-0.983929f,-0.983946f,-0.983963f,-0.98398f,-0.983997f,-0.984014f,-0.984031f,-0.984048f,-0.984066f,-0.984083f,-0.9841f,-0.984117f,-0.984134f,-0.984151f,-0.984168f,-0.984185f,-0.984202f,-0.984219f,-0.984236f,-0.984253f,-0.984269f,-0.984286f,-0.984303f,-0.98432f,-0.984337f,-0.984354f,-0.984371f,-0.984388f,-0.984405f,-0.984422f,-0.984438f,-0.984455f,-0.984472f,-0.984489f,-0.984506f,-0.984523f,-0.984539f,-0.984556f,-0.984573f,-0.98459f,-0.984606f,-0.984623f,-0.98464f,-0.984657f,-0.984673f,-0.98469f,-0.984707f,-0.984724f,-0.98474f,-0.984757f,-0.984774f,-0.98479f,-0.984807f,-0.984823f,-0.98484f,-0.984857f,-0.984873f,-0.98489f,-0.984907f,-0.984923f,-0.98494f,-0.984956f,-0.984973f,-0.984989f,-0.985006f,-0.985023f,-0.985039f,-0.985056f,-0.985072f,-0.985089f,-0.985105f,-0.985122f,-0.985138f,-0.985154f,-0.985171f,-0.985187f,-0.985204f,-0.98522f,-0.985237f,-0.985253f,-0.985269f,-0.985286f,-0.985302f,-0.985319f,-0.985335f,-0.985351f,-0.985368f,-0.985384f,-0.9854f,-0.985417f,-0.985433f,-0.985449f,-0.985466f,-0.985482f,-0.985498f,-0.985514f,-0.985531f,-0.985547f,-0.985563f,-0.985579f,-0.985596f,-0.985612f,-0.985628f,-0.985644f,-0.98566f,-0.985676f,-0.985693f,-0.985709f,-0.985725f,-0.985741f,-0.985757f,-0.985773f,-0.985789f,-0.985806f,-0.985822f,-0.985838f,-0.985854f,-0.98587f,-0.985886f,-0.985902f,-0.985918f,-0.985934f,-0.98595f,-0.985966f,-0.985982f,-0.985998f,-0.986014f,-0.98603f,-0.986046f,-0.986062f,-0.986078f,-0.986094f,-0.98611f,-0.986126f,-0.986142f,-0.986157f,-0.986173f,-0.986189f,-0.986205f,-0.986221f,-0.986237f,-0.986253f,-0.986269f,-0.986284f,-0.9863f,-0.986316f,-0.986332f,-0.986348f,-0.986363f,-0.986379f,-0.986395f,-0.986411f,-0.986426f,-0.986442f,-0.986458f,-0.986474f,-0.986489f,-0.986505f,-0.986521f,-0.986536f,-0.986552f,-0.986568f,-0.986583f,-0.986599f,-0.986615f,-0.98663f,-0.986646f,-0.986662f,-0.986677f,-0.986693f,-0.986708f,-0.986724f,-0.986739f,-0.986755f,-0.986771f,-0.986786f,-0.986802f,-0.986817f,-0.986833f,-0.986848f,-0.986864f,-0.986879f,-0.986895f,-0.98691f,-0.986926f,-0.986941f,-0.986956f,-0.986972f,-0.986987f,-0.987003f,-0.987018f,-0.987034f,-0.987049f,-0.987064f,-0.98708f,-0.987095f,-0.98711f,-0.987126f,-0.987141f,-0.987156f,-0.987172f,-0.987187f,-0.987202f,-0.987217f,-0.987233f,-0.987248f,-0.987263f,-0.987279f,-0.987294f,-0.987309f,-0.987324f,-0.987339f,-0.987355f,-0.98737f,-0.987385f,-0.9874f,-0.987415f,-0.987431f,-0.987446f,-0.987461f,-0.987476f,-0.987491f,-0.987506f,-0.987521f,-0.987536f,-0.987552f,-0.987567f,-0.987582f,-0.987597f,-0.987612f,-0.987627f,-0.987642f,-0.987657f,-0.987672f,-0.987687f,-0.987702f,-0.987717f,-0.987732f,-0.987747f,-0.987762f,-0.987777f,-0.987792f,-0.987807f,-0.987822f,-0.987836f,-0.987851f,-0.987866f,-0.987881f,-0.987896f,-0.987911f,-0.987926f,-0.98794f,-0.987955f,-0.98797f,-0.987985f,-0.988f,-0.988015f,-0.988029f,-0.988044f,-0.988059f,-0.988074f,-0.988089f,-0.988103f,-0.988118f,-0.988133f,-0.988147f,-0.988162f,-0.988177f,-0.988192f,-0.988206f,-0.988221f,-0.988236f,-0.98825f,-0.988265f,-0.98828f,-0.988294f,-0.988309f,-0.988323f,-0.988338f,-0.988353f,-0.988367f,-0.988382f,-0.988396f,-0.988411f,-0.988425f,-0.98844f,-0.988454f,-0.988469f,-0.988484f,-0.988498f,-0.988513f,-0.988527f,-0.988542f,-0.988556f,-0.98857f,-0.988585f,-0.988599f,-0.988614f,-0.988628f,-0.988643f,-0.988657f,-0.988671f,-0.988686f,-0.9887f,-0.988715f,-0.988729f,-0.988743f,-0.988758f,-0.988772f,-0.988786f,-0.988801f,-0.988815f,-0.988829f,-0.988843f,-0.988858f,-0.988872f,-0.988886f,-0.9889f,-0.988915f,-0.988929f,-0.988943f,-0.988957f,-0.988972f,-0.988986f,-0.989f,-0.989014f,-0.989028f,-0.989042f,-0.989057f,-0.989071f,-0.989085f,-0.989099f,-0.989113f,-0.989127f,-0.989141f,-0.989155f,-0.98917f,-0.989184f,-0.989198f,-0.989212f,-0.989226f,-0.98924f,-0.989254f,-0.989268f,-0.989282f,-0.989296f,-0.98931f,-0.989324f,-0.989338f,-0.989352f,-0.989366f,-0.98938f,-0.989394f,-0.989407f,-0.989421f,-0.989435f,-0.989449f,-0.989463f,-0.989477f,-0.989491f,-0.989505f,-0.989518f,-0.989532f,-0.989546f,-0.98956f,-0.989574f,-0.989588f,-0.989601f,-0.989615f,-0.989629f,-0.989643f,-0.989656f,-0.98967f,-0.989684f,-0.989698f,-0.989711f,-0.989725f,-0.989739f,-0.989752f,-0.989766f,-0.98978f,-0.989793f,-0.989807f,-0.989821f,-0.989834f,-0.989848f,-0.989862f,-0.989875f,-0.989889f,-0.989903f,-0.989916f,-0.98993f,-0.989943f,-0.989957f,-0.98997f,-0.989984f,-0.989997f,-0.990011f,-0.990024f,-0.990038f,-0.990052f,-0.990065f,-0.990078f,-0.990092f,-0.990105f,-0.990119f,-0.990132f,-0.990146f,-0.990159f,-0.990173f,-0.990186f,-0.990199f,-0.990213f,-0.990226f,-0.990239f,-0.990253f,-0.990266f,-0.990279f,-0.990293f,-0.990306f,-0.990319f,-0.990333f,-0.990346f,-0.990359f,-0.990373f,-0.990386f,-0.990399f,-0.990412f,-0.990426f,-0.990439f,-0.990452f,-0.990465f,-0.990479f,-0.990492f,-0.990505f,-0.990518f,-0.990531f,-0.990544f,-0.990558f,-0.990571f,-0.990584f,-0.990597f,-0.99061f,-0.990623f,-0.990636f,-0.990649f,-0.990662f,-0.990675f,-0.990689f,-0.990702f,-0.990715f,-0.990728f,-0.990741f,-0.990754f,-0.990767f,-0.99078f,-0.990793f,-0.990806f,-0.990819f,-0.990832f,-0.990844f,-0.990857f,-0.99087f,-0.990883f,-0.990896f,-0.990909f,-0.990922f,-0.990935f,-0.990948f,-0.990961f,-0.990973f,-0.990986f,-0.990999f,-0.991012f,-0.991025f,-0.991038f,-0.99105f,-0.991063f,-0.991076f,-0.991089f,-0.991102f,-0.991114f,-0.991127f,-0.99114f,-0.991153f,-0.991165f,-0.991178f,-0.991191f,-0.991203f,-0.991216f,-0.991229f,-0.991241f,-0.991254f,-0.991267f,-0.991279f,-0.991292f,-0.991305f,-0.991317f,-0.99133f,-0.991342f,-0.991355f,-0.991368f,-0.99138f,-0.991393f,-0.991405f,-0.991418f,-0.99143f,-0.991443f,-0.991455f,-0.991468f,-0.99148f,-0.991493f,-0.991505f,-0.991518f,-0.99153f,-0.991543f,-0.991555f,-0.991567f,-0.99158f,-0.991592f,-0.991605f,-0.991617f,-0.991629f,-0.991642f,-0.991654f,-0.991667f,-0.991679f,-0.991691f,-0.991704f,-0.991716f,-0.991728f,-0.991741f,-0.991753f,-0.991765f,-0.991777f,-0.99179f,-0.991802f,-0.991814f,-0.991826f,-0.991839f,-0.991851f,-0.991863f,-0.991875f,-0.991887f,-0.9919f,-0.991912f,-0.991924f,-0.991936f,-0.991948f,-0.99196f,-0.991973f,-0.991985f,-0.991997f,-0.992009f,-0.992021f,-0.992033f,-0.992045f,-0.992057f,-0.992069f,-0.992081f,-0.992093f,-0.992105f,-0.992117f,-0.992129f,-0.992141f,-0.992153f,-0.992165f,-0.992177f,-0.992189f,-0.992201f,-0.992213f,-0.992225f,-0.992237f,-0.992249f,-0.992261f,-0.992273f,-0.992285f,-0.992297f,-0.992308f,-0.99232f,-0.992332f,-0.992344f,-0.992356f,-0.992368f,-0.992379f,-0.992391f,-0.992403f,-0.992415f,-0.992427f,-0.992438f,-0.99245f,-0.992462f,-0.992474f,-0.992485f,-0.992497f,-0.992509f,-0.992521f,-0.992532f,-0.992544f,-0.992556f,-0.992567f,-0.992579f,-0.992591f,-0.992602f,-0.992614f,-0.992626f,-0.992637f,-0.992649f,-0.99266f,-0.992672f,-0.992684f,-0.992695f,-0.992707f,-0.992718f,-0.99273f,-0.992741f,-0.992753f,-0.992764f,-0.992776f,-0.992787f,-0.992799f,-0.99281f,-0.992822f,-0.992833f,-0.992845f,-0.992856f,-0.992868f,-0.992879f,-0.99289f,-0.992902f,-0.992913f,-0.992925f,-0.992936f,-0.992947f,-0.992959f,-0.99297f,-0.992981f,-0.992993f,-0.993004f,-0.993015f,-0.993027f,-0.993038f,-0.993049f,-0.993061f,-0.993072f,-0.993083f,-0.993094f,-0.993106f,-0.993117f,-0.993128f,-0.993139f,-0.99315f,-0.993162f,-0.993173f,-0.993184f,-0.993195f,-0.993206f,-0.993218f,-0.993229f,-0.99324f,-0.993251f,-0.993262f,-0.993273f,-0.993284f,-0.993295f,-0.993306f,-0.993317f,-0.993329f,-0.99334f,-0.993351f,-0.993362f,-0.993373f,-0.993384f,-0.993395f,-0.993406f,-0.993417f,-0.993428f,-0.993439f,-0.99345f,-0.993461f,-0.993472f,-0.993482f,-0.993493f,-0.993504f,-0.993515f,-0.993526f,-0.993537f,-0.993548f,-0.993559f,-0.99357f,-0.99358f,-0.993591f,-0.993602f,-0.993613f,-0.993624f,-0.993635f,-0.993645f,-0.993656f,-0.993667f,-0.993678f,-0.993688f,-0.993699f,-0.99371f,-0.993721f,-0.993731f,-0.993742f,-0.993753f,-0.993764f,-0.993774f,-0.993785f,-0.993796f,-0.993806f,-0.993817f,-0.993827f,-0.993838f,-0.993849f,-0.993859f,-0.99387f,-0.993881f,-0.993891f,-0.993902f,-0.993912f,-0.993923f,-0.993933f,-0.993944f,-0.993954f,-0.993965f,-0.993975f,-0.993986f,-0.993997f,-0.994007f,-0.994017f,-0.994028f,-0.994038f,-0.994049f,-0.994059f,-0.99407f,-0.99408f,-0.99409f,-0.994101f,-0.994111f,-0.994122f,-0.994132f,-0.994142f,-0.994153f,-0.994163f,-0.994173f,-0.994184f,-0.994194f,-0.994204f,-0.994215f,-0.994225f,-0.994235f,-0.994246f,-0.994256f,-0.994266f,-0.994276f,-0.994287f,-0.994297f,-0.994307f,-0.994317f,-0.994327f,-0.994338f,-0.994348f,-0.994358f,-0.994368f,-0.994378f,-0.994388f,-0.994399f,-0.994409f,-0.994419f,-0.994429f,-0.994439f,-0.994449f,-0.994459f,-0.994469f,-0.994479f,-0.994489f,-0.9945f,-0.99451f,-0.99452f,-0.99453f,-0.99454f,-0.99455f,-0.99456f,-0.99457f,-0.99458f,-0.99459f,-0.994599f,-0.994609f,-0.994619f,-0.994629f,-0.994639f,-0.994649f,-0.994659f,-0.994669f,-0.994679f,-0.994689f,-0.994699f,-0.994708f,-0.994718f,-0.994728f,-0.994738f,-0.994748f,-0.994758f,-0.994767f,-0.994777f,-0.994787f,-0.994797f,-0.994806f,-0.994816f,-0.994826f,-0.994836f,-0.994845f,-0.994855f,-0.994865f,-0.994874f,-0.994884f,-0.994894f,-0.994904f,-0.994913f,-0.994923f,-0.994933f,-0.994942f,-0.994952f,-0.994961f,-0.994971f,-0.994981f,-0.99499f,-0.995f,-0.995009f,-0.995019f,-0.995028f,-0.995038f,-0.995048f,-0.995057f,-0.995067f,-0.995076f,-0.995086f,-0.995095f,-0.995105f,-0.995114f,-0.995123f,-0.995133f,-0.995142f,-0.995152f,-0.995161f,-0.995171f,-0.99518f,-0.995189f,-0.995199f,-0.995208f,-0.995218f,-0.995227f,-0.995236f,-0.995246f,-0.995255f,-0.995264f,-0.995274f,-0.995283f,-0.995292f,-0.995301f,-0.995311f,-0.99532f,-0.995329f,-0.995339f,-0.995348f,-0.995357f,-0.995366f,-0.995375f,-0.995385f,-0.995394f,-0.995403f,-0.995412f,-0.995421f,-0.995431f,-0.99544f,-0.995449f,-0.995458f,-0.995467f,-0.995476f,-0.995485f,-0.995494f,-0.995503f,-0.995513f,-0.995522f,-0.995531f,-0.99554f,-0.995549f,-0.995558f,-0.995567f,-0.995576f,-0.995585f,-0.995594f,-0.995603f,-0.995612f,-0.995621f,-0.99563f,-0.995639f,-0.995648f,-0.995657f,-0.995665f,-0.995674f,-0.995683f,-0.995692f,-0.995701f,-0.99571f,-0.995719f,-0.995728f,-0.995737f,-0.995745f,-0.995754f,-0.995763f,-0.995772f,-0.995781f,-0.995789f,-0.995798f,-0.995807f,-0.995816f,-0.995825f,-0.995833f,-0.995842f,-0.995851f,-0.995859f,-0.995868f,-0.995877f,-0.995886f,-0.995894f,-0.995903f,-0.995912f,-0.99592f,-0.995929f,-0.995937f,-0.995946f,-0.995955f,-0.995963f,-0.995972f,-0.995981f,-0.995989f,-0.995998f,-0.996006f,-0.996015f,-0.996023f,-0.996032f,-0.99604f,-0.996049f,-0.996057f,-0.996066f,-0.996074f,-0.996083f,-0.996091f,-0.9961f,-0.996108f,-0.996117f,-0.996125f,-0.996134f,-0.996142f,-0.99615f,-0.996159f,-0.996167f,-0.996176f,-0.996184f,-0.996192f,-0.996201f,-0.996209f,-0.996217f,-0.996226f,-0.996234f,-0.996242f,-0.996251f,-0.996259f,-0.996267f,-0.996276f,-0.996284f,-0.996292f,-0.9963f,-0.996309f,-0.996317f,-0.996325f,-0.996333f,-0.996341f,-0.99635f,-0.996358f,-0.996366f,-0.996374f,-0.996382f,-0.99639f,-0.996399f,-0.996407f,-0.996415f,-0.996423f,-0.996431f,-0.996439f,-0.996447f,-0.996455f,-0.996463f,-0.996471f,-0.996479f,-0.996487f,-0.996495f,-0.996503f,-0.996511f,-0.996519f,-0.996527f,-0.996535f,-0.996543f,-0.996551f,-0.996559f,-0.996567f,-0.996575f,-0.996583f,-0.996591f,-0.996599f,-0.996607f,-0.996615f,-0.996623f,-0.99663f,-0.996638f,-0.996646f,-0.996654f,-0.996662f,-0.99667f,-0.996677f,-0.996685f,-0.996693f,-0.996701f,-0.996709f,-0.996716f,-0.996724f,-0.996732f,-0.99674f,-0.996747f,-0.996755f,-0.996763f,-0.99677f,-0.996778f,-0.996786f,-0.996794f,-0.996801f,-0.996809f,-0.996816f,-0.996824f,-0.996832f,-0.996839f,-0.996847f,-0.996855f,-0.996862f,-0.99687f,-0.996877f,-0.996885f,-0.996892f,-0.9969f,-0.996908f,-0.996915f,-0.996923f,-0.99693f,-0.996938f,-0.996945f,-0.996953f,-0.99696f,-0.996967f,-0.996975f,-0.996982f,-0.99699f,-0.996997f,-0.997005f,-0.997012f,-0.99702f,-0.997027f,-0.997034f,-0.997042f,-0.997049f,-0.997056f,-0.997064f,-0.997071f,-0.997078f,-0.997086f,-0.997093f,-0.9971f,-0.997108f,-0.997115f,-0.997122f,-0.997129f,-0.997137f,-0.997144f,-0.997151f,-0.997158f,-0.997166f,-0.997173f,-0.99718f,-0.997187f,-0.997194f,-0.997202f,-0.997209f,-0.997216f,-0.997223f,-0.99723f,-0.997237f,-0.997244f,-0.997252f,-0.997259f,-0.997266f,-0.997273f,-0.99728f,-0.997287f,-0.997294f,-0.997301f,-0.997308f,-0.997315f,-0.997322f,-0.997329f,-0.997336f,-0.997343f,-0.99735f,-0.997357f,-0.997364f,-0.997371f,-0.997378f,-0.997385f,-0.997392f,-0.997399f,-0.997406f,-0.997413f,-0.997419f,-0.997426f,-0.997433f,-0.99744f,-0.997447f,-0.997454f,-0.997461f,-0.997467f,-0.997474f,-0.997481f,-0.997488f,-0.997495f,-0.997501f,-0.997508f,-0.997515f,-0.997522f,-0.997528f,-0.997535f,-0.997542f,-0.997549f,-0.997555f,-0.997562f,-0.997569f,-0.997575f,-0.997582f,-0.997589f,-0.997595f,-0.997602f,-0.997608f,-0.997615f,-0.997622f,-0.997628f,-0.997635f,-0.997642f,-0.997648f,-0.997655f,-0.997661f,-0.997668f,-0.997674f,-0.997681f,-0.997687f,-0.997694f,-0.9977f,-0.997707f,-0.997713f,-0.99772f,-0.997726f,-0.997733f,-0.997739f,-0.997746f,-0.997752f,-0.997759f,-0.997765f,-0.997771f,-0.997778f,-0.997784f,-0.99779f,-0.997797f,-0.997803f,-0.99781f,-0.997816f,-0.997822f,-0.997828f,-0.997835f,-0.997841f,-0.997847f,-0.997854f,-0.99786f,-0.997866f,-0.997873f,-0.997879f,-0.997885f,-0.997891f,-0.997897f,-0.997904f,-0.99791f,-0.997916f,-0.997922f,-0.997928f,-0.997935f,-0.997941f,-0.997947f,-0.997953f,-0.997959f,-0.997965f,-0.997971f,-0.997977f,-0.997984f,-0.99799f,-0.997996f,-0.998002f,-0.998008f,-0.998014f,-0.99802f,-0.998026f,-0.998032f,-0.998038f,-0.998044f,-0.99805f,-0.998056f,-0.998062f,-0.998068f,-0.998074f,-0.99808f,-0.998086f,-0.998092f,-0.998097f,-0.998103f,-0.998109f,-0.998115f,-0.998121f,-0.998127f,-0.998133f,-0.998139f,-0.998144f,-0.99815f,-0.998156f,-0.998162f,-0.998168f,-0.998174f,-0.998179f,-0.998185f,-0.998191f,-0.998197f,-0.998202f,-0.998208f,-0.998214f,-0.99822f,-0.998225f,-0.998231f,-0.998237f,-0.998242f,-0.998248f,-0.998254f,-0.998259f,-0.998265f,-0.998271f,-0.998276f,-0.998282f,-0.998288f,-0.998293f,-0.998299f,-0.998304f,-0.99831f,-0.998315f,-0.998321f,-0.998327f,-0.998332f,-0.998338f,-0.998343f,-0.998349f,-0.998354f,-0.99836f,-0.998365f,-0.998371f,-0.998376f,-0.998382f,-0.998387f,-0.998392f,-0.998398f,-0.998403f,-0.998409f,-0.998414f,-0.99842f,-0.998425f,-0.99843f,-0.998436f,-0.998441f,-0.998446f,-0.998452f,-0.998457f,-0.998462f,-0.998468f,-0.998473f,-0.998478f,-0.998484f,-0.998489f,-0.998494f,-0.998499f,-0.998505f,-0.99851f,-0.998515f,-0.99852f,-0.998525f,-0.998531f,-0.998536f,-0.998541f,-0.998546f,-0.998551f,-0.998556f,-0.998562f,-0.998567f,-0.998572f,-0.998577f,-0.998582f,-0.998587f,-0.998592f,-0.998597f,-0.998603f,-0.998608f,-0.998613f,-0.998618f,-0.998623f,-0.998628f,-0.998633f,-0.998638f,-0.998643f,-0.998648f,-0.998653f,-0.998658f,-0.998663f,-0.998668f,-0.998672f,-0.998677f,-0.998682f,-0.998687f,-0.998692f,-0.998697f,-0.998702f,-0.998707f,-0.998712f,-0.998717f,-0.998721f,-0.998726f,-0.998731f,-0.998736f,-0.998741f,-0.998746f,-0.99875f,-0.998755f,-0.99876f,-0.998765f,-0.998769f,-0.998774f,-0.998779f,-0.998784f,-0.998788f,-0.998793f,-0.998798f,-0.998802f,-0.998807f,-0.998812f,-0.998817f,-0.998821f,-0.998826f,-0.99883f,-0.998835f,-0.99884f,-0.998844f,-0.998849f,-0.998854f,-0.998858f,-0.998863f,-0.998867f,-0.998872f,-0.998876f,-0.998881f,-0.998885f,-0.99889f,-0.998894f,-0.998899f,-0.998903f,-0.998908f,-0.998912f,-0.998917f,-0.998921f,-0.998926f,-0.99893f,-0.998935f,-0.998939f,-0.998944f,-0.998948f,-0.998952f,-0.998957f,-0.998961f,-0.998965f,-0.99897f,-0.998974f,-0.998978f,-0.998983f,-0.998987f,-0.998991f,-0.998996f,-0.999f,-0.999004f,-0.999009f,-0.999013f,-0.999017f,-0.999021f,-0.999026f,-0.99903f,-0.999034f,-0.999038f,-0.999042f,-0.999047f,-0.999051f,-0.999055f,-0.999059f,-0.999063f,-0.999067f,-0.999072f,-0.999076f,-0.99908f,-0.999084f,-0.999088f,-0.999092f,-0.999096f,-0.9991f,-0.999104f,-0.999108f,-0.999112f,-0.999116f,-0.99912f,-0.999124f,-0.999128f,-0.999132f,-0.999136f,-0.99914f,-0.999144f,-0.999148f,-0.999152f,-0.999156f,-0.99916f,-0.999164f,-0.999168f,-0.999172f,-0.999176f,-0.99918f,-0.999184f,-0.999187f,-0.999191f,-0.999195f,-0.999199f,-0.999203f,-0.999207f,-0.99921f,-0.999214f,-0.999218f,-0.999222f,-0.999226f,-0.999229f,-0.999233f,-0.999237f,-0.999241f,-0.999244f,-0.999248f,-0.999252f,-0.999256f,-0.999259f,-0.999263f,-0.999267f,-0.99927f,-0.999274f,-0.999278f,-0.999281f,-0.999285f,-0.999288f,-0.999292f,-0.999296f,-0.999299f,-0.999303f,-0.999306f,-0.99931f,-0.999314f,-0.999317f,-0.999321f,-0.999324f,-0.999328f,-0.999331f,-0.999335f,-0.999338f,-0.999342f,-0.999345f,-0.999349f,-0.999352f,-0.999355f,-0.999359f,-0.999362f,-0.999366f,-0.999369f,-0.999373f,-0.999376f,-0.999379f,-0.999383f,-0.999386f,-0.999389f,-0.999393f,-0.999396f,-0.999399f,-0.999403f,-0.999406f,-0.999409f,-0.999413f,-0.999416f,-0.999419f,-0.999422f,-0.999426f,-0.999429f,-0.999432f,-0.999435f,-0.999439f,-0.999442f,-0.999445f,-0.999448f,-0.999451f,-0.999455f,-0.999458f,-0.999461f,-0.999464f,-0.999467f,-0.99947f,-0.999473f,-0.999477f,-0.99948f,-0.999483f,-0.999486f,-0.999489f,-0.999492f,-0.999495f,-0.999498f,-0.999501f,-0.999504f,-0.999507f,-0.99951f,-0.999513f,-0.999516f,-0.999519f,-0.999522f,-0.999525f,-0.999528f,-0.999531f,-0.999534f,-0.999537f,-0.99954f,-0.999543f,-0.999545f,-0.999548f,-0.999551f,-0.999554f,-0.999557f,-0.99956f,-0.999563f,-0.999565f,-0.999568f,-0.999571f,-0.999574f,-0.999577f,-0.999579f,-0.999582f,-0.999585f,-0.999588f,-0.999591f,-0.999593f,-0.999596f,-0.999599f,-0.999601f,-0.999604f,-0.999607f,-0.99961f,-0.999612f,-0.999615f,-0.999618f,-0.99962f,-0.999623f,-0.999625f,-0.999628f,-0.999631f,-0.999633f,-0.999636f,-0.999638f,-0.999641f,-0.999644f,-0.999646f,-0.999649f,-0.999651f,-0.999654f,-0.999656f,-0.999659f,-0.999661f,-0.999664f,-0.999666f,-0.999669f,-0.999671f,-0.999674f,-0.999676f,-0.999678f,-0.999681f,-0.999683f,-0.999686f,-0.999688f,-0.999691f,-0.999693f,-0.999695f,-0.999698f,-0.9997f,-0.999702f,-0.999705f,-0.999707f,-0.999709f,-0.999712f,-0.999714f,-0.999716f,-0.999718f,-0.999721f,-0.999723f,-0.999725f,-0.999728f,-0.99973f,-0.999732f,-0.999734f,-0.999736f,-0.999739f,-0.999741f,-0.999743f,-0.999745f,-0.999747f,-0.999749f,-0.999752f,-0.999754f,-0.999756f,-0.999758f,-0.99976f,-0.999762f,-0.999764f,-0.999766f,-0.999768f,-0.99977f,-0.999772f,-0.999775f,-0.999777f,-0.999779f,-0.999781f,-0.999783f,-0.999785f,-0.999787f,-0.999789f,-0.999791f,-0.999792f,-0.999794f,-0.999796f,-0.999798f,-0.9998f,-0.999802f,-0.999804f,-0.999806f,-0.999808f,-0.99981f,-0.999812f,-0.999813f,-0.999815f,-0.999817f,-0.999819f,-0.999821f,-0.999823f,-0.999824f,-0.999826f,-0.999828f,-0.99983f,-0.999831f,-0.999833f,-0.999835f,-0.999837f,-0.999838f,-0.99984f,-0.999842f,-0.999844f,-0.999845f,-0.999847f,-0.999849f,-0.99985f,-0.999852f,-0.999854f,-0.999855f,-0.999857f,-0.999858f,-0.99986f,-0.999862f,-0.999863f,-0.999865f,-0.999866f,-0.999868f,-0.99987f,-0.999871f,-0.999873f,-0.999874f,-0.999876f,-0.999877f,-0.999879f,-0.99988f,-0.999882f,-0.999883f,-0.999885f,-0.999886f,-0.999887f,-0.999889f,-0.99989f,-0.999892f,-0.999893f,-0.999894f,-0.999896f,-0.999897f,-0.999899f,-0.9999f,-0.999901f,-0.999903f,-0.999904f,-0.999905f,-0.999907f,-0.999908f,-0.999909f,-0.999911f,-0.999912f,-0.999913f,-0.999914f,-0.999916f,-0.999917f,-0.999918f,-0.999919f,-0.999921f,-0.999922f,-0.999923f,-0.999924f,-0.999925f,-0.999926f,-0.999928f,-0.999929f,-0.99993f,-0.999931f,-0.999932f,-0.999933f,-0.999934f,-0.999935f,-0.999937f,-0.999938f,-0.999939f,-0.99994f,-0.999941f,-0.999942f,-0.999943f,-0.999944f,-0.999945f,-0.999946f,-0.999947f,-0.999948f,-0.999949f,-0.99995f,-0.999951f,-0.999952f,-0.999953f,-0.999954f,-0.999955f,-0.999955f,-0.999956f,-0.999957f,-0.999958f,-0.999959f,-0.99996f,-0.999961f,-0.999961f,-0.999962f,-0.999963f,-0.999964f,-0.999965f,-0.999966f,-0.999966f,-0.999967f,-0.999968f,-0.999969f,-0.999969f,-0.99997f,-0.999971f,-0.999972f,-0.999972f,-0.999973f,-0.999974f,-0.999974f,-0.999975f,-0.999976f,-0.999977f,-0.999977f,-0.999978f,-0.999978f,-0.999979f,-0.99998f,-0.99998f,-0.999981f,-0.999981f,-0.999982f,-0.999983f,-0.999983f,-0.999984f,-0.999984f,-0.999985f,-0.999985f,-0.999986f,-0.999986f,-0.999987f,-0.999987f,-0.999988f,-0.999988f,-0.999989f,-0.999989f,-0.99999f,-0.99999f,-0.99999f,-0.999991f,-0.999991f,-0.999992f,-0.999992f,-0.999992f,-0.999993f,-0.999993f,-0.999994f,-0.999994f,-0.999994f,-0.999995f,-0.999995f,-0.999995f,-0.999995f,-0.999996f,-0.999996f,-0.999996f,-0.999997f,-0.999997f,-0.999997f,-0.999997f,-0.999997f,-0.999998f,-0.999998f,-0.999998f,-0.999998f,-0.999998f,-0.999999f,-0.999999f,-0.999999f,-0.999999f,-0.999999f,-0.999999f,-0.999999f,-1.f,-1.f,-1.f,-1.f,-1.f,-1.f,-1.f,-1.f,-1.f,-1.f,-1.f,-1.f,-1.f,-1.f,-1.f,-1.f,-1.f,-1.f,-1.f,-1.f,-1.f,-1.f,-0.999999f,-0.999999f,-0.999999f,-0.999999f,-0.999999f,-0.999999f,-0.999999f,-0.999998f,-0.999998f,-0.999998f,-0.999998f,-0.999998f,-0.999997f,-0.999997f,-0.999997f,-0.999997f,-0.999997f,-0.999996f,-0.999996f,-0.999996f,-0.999995f,-0.999995f,-0.999995f,-0.999995f,-0.999994f,-0.999994f,-0.999994f,-0.999993f,-0.999993f,-0.999992f,-0.999992f,-0.999992f,-0.999991f,-0.999991f,-0.99999f,-0.99999f,-0.99999f,-0.999989f,-0.999989f,-0.999988f,-0.999988f,-0.999987f,-0.999987f,-0.999986f,-0.999986f,-0.999985f,-0.999985f,-0.999984f,-0.999984f,-0.999983f,-0.999983f,-0.999982f,-0.999981f,-0.999981f,-0.99998f,-0.99998f,-0.999979f,-0.999978f,-0.999978f,-0.999977f,-0.999977f,-0.999976f,-0.999975f,-0.999974f,-0.999974f,-0.999973f,-0.999972f,-0.999972f,-0.999971f,-0.99997f,-0.999969f,-0.999969f,-0.999968f,-0.999967f,-0.999966f,-0.999966f,-0.999965f,-0.999964f,-0.999963f,-0.999962f,-0.999961f,-0.999961f,-0.99996f,-0.999959f,-0.999958f,-0.999957f,-0.999956f,-0.999955f,-0.999955f,-0.999954f,-0.999953f,-0.999952f,-0.999951f,-0.99995f,-0.999949f,-0.999948f,-0.999947f,-0.999946f,-0.999945f,-0.999944f,-0.999943f,-0.999942f,-0.999941f,-0.99994f,-0.999939f,-0.999938f,-0.999937f,-0.999935f,-0.999934f,-0.999933f,-0.999932f,-0.999931f,-0.99993f,-0.999929f,-0.999928f,-0.999926f,-0.999925f,-0.999924f,-0.999923f,-0.999922f,-0.999921f,-0.999919f,-0.999918f,-0.999917f,-0.999916f,-0.999914f,-0.999913f,-0.999912f,-0.999911f,-0.999909f,-0.999908f,-0.999907f,-0.999905f,-0.999904f,-0.999903f,-0.999901f,-0.9999f,-0.999899f,-0.999897f,-0.999896f,-0.999894f,-0.999893f,-0.999892f,-0.99989f,-0.999889f,-0.999887f,-0.999886f,-0.999885f,-0.999883f,-0.999882f,-0.99988f,-0.999879f,-0.999877f,-0.999876f,-0.999874f,-0.999873f,-0.999871f,-0.99987f,-0.999868f,-0.999866f,-0.999865f,-0.999863f,-0.999862f,-0.99986f,-0.999858f,-0.999857f,-0.999855f,-0.999854f,-0.999852f,-0.99985f,-0.999849f,-0.999847f,-0.999845f,-0.999844f,-0.999842f,-0.99984f,-0.999838f,-0.999837f,-0.999835f,-0.999833f,-0.999831f,-0.99983f,-0.999828f,-0.999826f,-0.999824f,-0.999823f,-0.999821f,-0.999819f,-0.999817f,-0.999815f,-0.999813f,-0.999812f,-0.99981f,-0.999808f,-0.999806f,-0.999804f,-0.999802f,-0.9998f,-0.999798f,-0.999796f,-0.999794f,-0.999792f,-0.99979f,-0.999789f,-0.999787f,-0.999785f,-0.999783f,-0.999781f,-0.999779f,-0.999777f,-0.999775f,-0.999772f,-0.99977f,-0.999768f,-0.999766f,-0.999764f,-0.999762f,-0.99976f,-0.999758f,-0.999756f,-0.999754f,-0.999752f,-0.999749f,-0.999747f,-0.999745f,-0.999743f,-0.999741f,-0.999739f,-0.999736f,-0.999734f,-0.999732f,-0.99973f,-0.999727f,-0.999725f,-0.999723f,-0.999721f,-0.999718f,-0.999716f,-0.999714f,-0.999712f,-0.999709f,-0.999707f,-0.999705f,-0.999702f,-0.9997f,-0.999698f,-0.999695f,-0.999693f,-0.999691f,-0.999688f,-0.999686f,-0.999683f,-0.999681f,-0.999678f,-0.999676f,-0.999674f,-0.999671f,-0.999669f,-0.999666f,-0.999664f,-0.999661f,-0.999659f,-0.999656f,-0.999654f,-0.999651f,-0.999649f,-0.999646f,-0.999644f,-0.999641f,-0.999638f,-0.999636f,-0.999633f,-0.999631f,-0.999628f,-0.999625f,-0.999623f,-0.99962f,-0.999618f,-0.999615f,-0.999612f,-0.999609f,-0.999607f,-0.999604f,-0.999601f,-0.999599f,-0.999596f,-0.999593f,-0.999591f,-0.999588f,-0.999585f,-0.999582f,-0.999579f,-0.999577f,-0.999574f,-0.999571f,-0.999568f,-0.999565f,-0.999563f,-0.99956f,-0.999557f,-0.999554f,-0.999551f,-0.999548f,-0.999545f,-0.999543f,-0.99954f,-0.999537f,-0.999534f,-0.999531f,-0.999528f,-0.999525f,-0.999522f,-0.999519f,-0.999516f,-0.999513f,-0.99951f,-0.999507f,-0.999504f,-0.999501f,-0.999498f,-0.999495f,-0.999492f,-0.999489f,-0.999486f,-0.999483f,-0.99948f,-0.999477f,-0.999473f,-0.99947f,-0.999467f,-0.999464f,-0.999461f,-0.999458f,-0.999455f,-0.999451f,-0.999448f,-0.999445f,-0.999442f,-0.999439f,-0.999435f,-0.999432f,-0.999429f,-0.999426f,-0.999422f,-0.999419f,-0.999416f,-0.999413f,-0.999409f,-0.999406f,-0.999403f,-0.999399f,-0.999396f,-0.999393f,-0.999389f,-0.999386f,-0.999383f,-0.999379f,-0.999376f,-0.999373f,-0.999369f,-0.999366f,-0.999362f,-0.999359f,-0.999355f,-0.999352f,-0.999349f,-0.999345f,-0.999342f,-0.999338f,-0.999335f,-0.999331f,-0.999328f,-0.999324f,-0.999321f,-0.999317f,-0.999314f,-0.99931f,-0.999306f,-0.999303f,-0.999299f,-0.999296f,-0.999292f,-0.999288f,-0.999285f,-0.999281f,-0.999278f,-0.999274f,-0.99927f,-0.999267f,-0.999263f,-0.999259f,-0.999256f,-0.999252f,-0.999248f,-0.999244f,-0.999241f,-0.999237f,-0.999233f,-0.999229f,-0.999226f,-0.999222f,-0.999218f,-0.999214f,-0.99921f,-0.999207f,-0.999203f,-0.999199f,-0.999195f,-0.999191f,-0.999187f,-0.999184f,-0.99918f,-0.999176f,-0.999172f,-0.999168f,-0.999164f,-0.99916f,-0.999156f,-0.999152f,-0.999148f,-0.999144f,-0.99914f,-0.999136f,-0.999132f,-0.999128f,-0.999124f,-0.99912f,-0.999116f,-0.999112f,-0.999108f,-0.999104f,-0.9991f,-0.999096f,-0.999092f,-0.999088f,-0.999084f,-0.99908f,-0.999076f,-0.999072f,-0.999067f,-0.999063f,-0.999059f,-0.999055f,-0.999051f,-0.999047f,-0.999042f,-0.999038f,-0.999034f,-0.99903f,-0.999026f,-0.999021f,-0.999017f,-0.999013f,-0.999009f,-0.999004f,-0.999f,-0.998996f,-0.998991f,-0.998987f,-0.998983f,-0.998978f,-0.998974f,-0.99897f,-0.998965f,-0.998961f,-0.998957f,-0.998952f,-0.998948f,-0.998944f,-0.998939f,-0.998935f,-0.99893f,-0.998926f,-0.998921f,-0.998917f,-0.998912f,-0.998908f,-0.998903f,-0.998899f,-0.998894f,-0.99889f,-0.998885f,-0.998881f,-0.998876f,-0.998872f,-0.998867f,-0.998863f,-0.998858f,-0.998854f,-0.998849f,-0.998844f,-0.99884f,-0.998835f,-0.99883f,-0.998826f,-0.998821f,-0.998817f,-0.998812f,-0.998807f,-0.998802f,-0.998798f,-0.998793f,-0.998788f,-0.998784f,-0.998779f,-0.998774f,-0.998769f,-0.998765f,-0.99876f,-0.998755f,-0.99875f,-0.998746f,-0.998741f,-0.998736f,-0.998731f,-0.998726f,-0.998721f,-0.998717f,-0.998712f,-0.998707f,-0.998702f,-0.998697f,-0.998692f,-0.998687f,-0.998682f,-0.998677f,-0.998672f,-0.998668f,-0.998663f,-0.998658f,-0.998653f,-0.998648f,-0.998643f,-0.998638f,-0.998633f,-0.998628f,-0.998623f,-0.998618f,-0.998613f,-0.998608f,-0.998602f,-0.998597f,-0.998592f,-0.998587f,-0.998582f,-0.998577f,-0.998572f,-0.998567f,-0.998562f,-0.998556f,-0.998551f,-0.998546f,-0.998541f,-0.998536f,-0.998531f,-0.998525f,-0.99852f,-0.998515f,-0.99851f,-0.998505f,-0.998499f,-0.998494f,-0.998489f,-0.998484f,-0.998478f,-0.998473f,-0.998468f,-0.998462f,-0.998457f,-0.998452f,-0.998446f,-0.998441f,-0.998436f,-0.99843f,-0.998425f,-0.99842f,-0.998414f,-0.998409f,-0.998403f,-0.998398f,-0.998392f,-0.998387f,-0.998382f,-0.998376f,-0.998371f,-0.998365f,-0.99836f,-0.998354f,-0.998349f,-0.998343f,-0.998338f,-0.998332f,-0.998327f,-0.998321f,-0.998315f,-0.99831f,-0.998304f,-0.998299f,-0.998293f,-0.998288f,-0.998282f,-0.998276f,-0.998271f,-0.998265f,-0.998259f,-0.998254f,-0.998248f,-0.998242f,-0.998237f,-0.998231f,-0.998225f,-0.99822f,-0.998214f,-0.998208f,-0.998202f,-0.998197f,-0.998191f,-0.998185f,-0.998179f,-0.998174f,-0.998168f,-0.998162f,-0.998156f,-0.99815f,-0.998144f,-0.998139f,-0.998133f,-0.998127f,-0.998121f,-0.998115f,-0.998109f,-0.998103f,-0.998097f,-0.998092f,-0.998086f,-0.99808f,-0.998074f,-0.998068f,-0.998062f,-0.998056f,-0.99805f,-0.998044f,-0.998038f,-0.998032f,-0.998026f,-0.99802f,-0.998014f,-0.998008f,-0.998002f,-0.997996f,-0.99799f,-0.997984f,-0.997977f,-0.997971f,-0.997965f,-0.997959f,-0.997953f,-0.997947f,-0.997941f,-0.997935f,-0.997928f,-0.997922f,-0.997916f,-0.99791f,-0.997904f,-0.997897f,-0.997891f,-0.997885f,-0.997879f,-0.997872f,-0.997866f,-0.99786f,-0.997854f,-0.997847f,-0.997841f,-0.997835f,-0.997828f,-0.997822f,-0.997816f,-0.997809f,-0.997803f,-0.997797f,-0.99779f,-0.997784f,-0.997778f,-0.997771f,-0.997765f,-0.997759f,-0.997752f,-0.997746f,-0.997739f,-0.997733f,-0.997726f,-0.99772f,-0.997713f,-0.997707f,-0.9977f,-0.997694f,-0.997687f,-0.997681f,-0.997674f,-0.997668f,-0.997661f,-0.997655f,-0.997648f,-0.997642f,-0.997635f,-0.997628f,-0.997622f,-0.997615f,-0.997608f,-0.997602f,-0.997595f,-0.997589f,-0.997582f,-0.997575f,-0.997569f,-0.997562f,-0.997555f,-0.997548f,-0.997542f,-0.997535f,-0.997528f,-0.997522f,-0.997515f,-0.997508f,-0.997501f,-0.997495f,-0.997488f,-0.997481f,-0.997474f,-0.997467f,-0.99746f,-0.997454f,-0.997447f,-0.99744f,-0.997433f,-0.997426f,-0.997419f,-0.997413f,-0.997406f,-0.997399f,-0.997392f,-0.997385f,-0.997378f,-0.997371f,-0.997364f,-0.997357f,-0.99735f,-0.997343f,-0.997336f,-0.997329f,-0.997322f,-0.997315f,-0.997308f,-0.997301f,-0.997294f,-0.997287f,-0.99728f,-0.997273f,-0.997266f,-0.997259f,-0.997252f,-0.997244f,-0.997237f,-0.99723f,-0.997223f,-0.997216f,-0.997209f,-0.997202f,-0.997194f,-0.997187f,-0.99718f,-0.997173f,-0.997166f,-0.997158f,-0.997151f,-0.997144f,-0.997137f,-0.997129f,-0.997122f,-0.997115f,-0.997108f,-0.9971f,-0.997093f,-0.997086f,-0.997078f,-0.997071f,-0.997064f,-0.997056f,-0.997049f,-0.997042f,-0.997034f,-0.997027f,-0.99702f,-0.997012f,-0.997005f,-0.996997f,-0.99699f,-0.996982f,-0.996975f,-0.996967f,-0.99696f,-0.996953f,-0.996945f,-0.996938f,-0.99693f,-0.996923f,-0.996915f,-0.996908f,-0.9969f,-0.996892f,-0.996885f,-0.996877f,-0.99687f,-0.996862f,-0.996855f,-0.996847f,-0.996839f,-0.996832f,-0.996824f,-0.996816f,-0.996809f,-0.996801f,-0.996794f,-0.996786f,-0.996778f,-0.99677f,-0.996763f,-0.996755f,-0.996747f,-0.99674f,-0.996732f,-0.996724f,-0.996716f,-0.996709f,-0.996701f,-0.996693f,-0.996685f,-0.996677f,-0.99667f,-0.996662f,-0.996654f,-0.996646f,-0.996638f,-0.99663f,-0.996623f,-0.996615f,-0.996607f,-0.996599f,-0.996591f,-0.996583f,-0.996575f,-0.996567f,-0.996559f,-0.996551f,-0.996543f,-0.996535f,-0.996527f,-0.996519f,-0.996511f,-0.996503f,-0.996495f,-0.996487f,-0.996479f,-0.996471f,-0.996463f,-0.996455f,-0.996447f,-0.996439f,-0.996431f,-0.996423f,-0.996415f,-0.996407f,-0.996398f,-0.99639f,-0.996382f,-0.996374f,-0.996366f,-0.996358f,-0.99635f,-0.996341f,-0.996333f,-0.996325f,-0.996317f,-0.996309f,-0.9963f,-0.996292f,-0.996284f,-0.996275f,-0.996267f,-0.996259f,-0.996251f,-0.996242f,-0.996234f,-0.996226f,-0.996217f,-0.996209f,-0.996201f,-0.996192f,-0.996184f,-0.996176f,-0.996167f,-0.996159f,-0.99615f,-0.996142f,-0.996134f,-0.996125f,-0.996117f,-0.996108f,-0.9961f,-0.996091f,-0.996083f,-0.996074f,-0.996066f,-0.996057f,-0.996049f,-0.99604f,-0.996032f,-0.996023f,-0.996015f,-0.996006f,-0.995998f,-0.995989f,-0.995981f,-0.995972f,-0.995963f,-0.995955f,-0.995946f,-0.995937f,-0.995929f,-0.99592f,-0.995912f,-0.995903f,-0.995894f,-0.995886f,-0.995877f,-0.995868f,-0.995859f,-0.995851f,-0.995842f,-0.995833f,-0.995824f,-0.995816f,-0.995807f,-0.995798f,-0.995789f,-0.995781f,-0.995772f,-0.995763f,-0.995754f,-0.995745f,-0.995737f,-0.995728f,-0.995719f,-0.99571f,-0.995701f,-0.995692f,-0.995683f,-0.995674f,-0.995665f,-0.995657f,-0.995648f,-0.995639f,-0.99563f,-0.995621f,-0.995612f,-0.995603f,-0.995594f,-0.995585f,-0.995576f,-0.995567f,-0.995558f,-0.995549f,-0.99554f,-0.995531f,-0.995522f,-0.995513f,-0.995503f,-0.995494f,-0.995485f,-0.995476f,-0.995467f,-0.995458f,-0.995449f,-0.99544f,-0.995431f,-0.995421f,-0.995412f,-0.995403f,-0.995394f,-0.995385f,-0.995375f,-0.995366f,-0.995357f,-0.995348f,-0.995339f,-0.995329f,-0.99532f,-0.995311f,-0.995301f,-0.995292f,-0.995283f,-0.995274f,-0.995264f,-0.995255f,-0.995246f,-0.995236f,-0.995227f,-0.995218f,-0.995208f,-0.995199f,-0.995189f,-0.99518f,-0.995171f,-0.995161f,-0.995152f,-0.995142f,-0.995133f,-0.995123f,-0.995114f,-0.995104f,-0.995095f,-0.995086f,-0.995076f,-0.995067f,-0.995057f,-0.995048f,-0.995038f,-0.995028f,-0.995019f,-0.995009f,-0.995f,-0.99499f,-0.994981f,-0.994971f,-0.994961f,-0.994952f,-0.994942f,-0.994932f,-0.994923f,-0.994913f,-0.994904f,-0.994894f,-0.994884f,-0.994874f,-0.994865f,-0.994855f,-0.994845f,-0.994836f,-0.994826f,-0.994816f,-0.994806f,-0.994797f,-0.994787f,-0.994777f,-0.994767f,-0.994757f,-0.994748f,-0.994738f,-0.994728f,-0.994718f,-0.994708f,-0.994699f,-0.994689f,-0.994679f,-0.994669f,-0.994659f,-0.994649f,-0.994639f,-0.994629f,-0.994619f,-0.994609f,-0.994599f,-0.99459f,-0.994579f,-0.99457f,-0.99456f,-0.99455f,-0.99454f,-0.99453f,-0.99452f,-0.99451f,-0.994499f,-0.994489f,-0.994479f,-0.994469f,-0.994459f,-0.994449f,-0.994439f,-0.994429f,-0.994419f,-0.994409f,-0.994399f,-0.994388f,-0.994378f,-0.994368f,-0.994358f,-0.994348f,-0.994338f,-0.994327f,-0.994317f,-0.994307f,-0.994297f,-0.994287f,-0.994276f,-0.994266f,-0.994256f,-0.994246f,-0.994235f,-0.994225f,-0.994215f,-0.994204f,-0.994194f,-0.994184f,-0.994173f,-0.994163f,-0.994153f,-0.994142f,-0.994132f,-0.994122f,-0.994111f,-0.994101f,-0.99409f,-0.99408f,-0.99407f,-0.994059f,-0.994049f,-0.994038f,-0.994028f,-0.994017f,-0.994007f,-0.993996f,-0.993986f,-0.993975f,-0.993965f,-0.993954f,-0.993944f,-0.993933f,-0.993923f,-0.993912f,-0.993902f,-0.993891f,-0.993881f,-0.99387f,-0.993859f,-0.993849f,-0.993838f,-0.993827f,-0.993817f,-0.993806f,-0.993795f,-0.993785f,-0.993774f,-0.993763f,-0.993753f,-0.993742f,-0.993731f,-0.993721f,-0.99371f,-0.993699f,-0.993688f,-0.993678f,-0.993667f,-0.993656f,-0.993645f,-0.993635f,-0.993624f,-0.993613f,-0.993602f,-0.993591f,-0.99358f,-0.99357f,-0.993559f,-0.993548f,-0.993537f,-0.993526f,-0.993515f,-0.993504f,-0.993493f,-0.993482f,-0.993471f,-0.993461f,-0.99345f,-0.993439f,-0.993428f,-0.993417f,-0.993406f,-0.993395f,-0.993384f,-0.993373f,-0.993362f,-0.993351f,-0.99334f,-0.993329f,-0.993317f,-0.993306f,-0.993295f,-0.993284f,-0.993273f,-0.993262f,-0.993251f,-0.99324f,-0.993229f,-0.993218f,-0.993206f,-0.993195f,-0.993184f,-0.993173f,-0.993162f,-0.99315f,-0.993139f,-0.993128f,-0.993117f,-0.993106f,-0.993094f,-0.993083f,-0.993072f,-0.993061f,-0.993049f,-0.993038f,-0.993027f,-0.993015f,-0.993004f,-0.992993f,-0.992981f,-0.99297f,-0.992959f,-0.992947f,-0.992936f,-0.992925f,-0.992913f,-0.992902f,-0.99289f,-0.992879f,-0.992868f,-0.992856f,-0.992845f,-0.992833f,-0.992822f,-0.99281f,-0.992799f,-0.992787f,-0.992776f,-0.992764f,-0.992753f,-0.992741f,-0.99273f,-0.992718f,-0.992707f,-0.992695f,-0.992683f,-0.992672f,-0.99266f,-0.992649f,-0.992637f,-0.992626f,-0.992614f,-0.992602f,-0.992591f,-0.992579f,-0.992567f,-0.992556f,-0.992544f,-0.992532f,-0.992521f,-0.992509f,-0.992497f,-0.992485f,-0.992474f,-0.992462f,-0.99245f,-0.992438f,-0.992427f,-0.992415f,-0.992403f,-0.992391f,-0.992379f,-0.992368f,-0.992356f,-0.992344f,-0.992332f,-0.99232f,-0.992308f,-0.992297f,-0.992285f,-0.992273f,-0.992261f,-0.992249f,-0.992237f,-0.992225f,-0.992213f,-0.992201f,-0.992189f,-0.992177f,-0.992165f,-0.992153f,-0.992141f,-0.992129f,-0.992117f,-0.992105f,-0.992093f,-0.992081f,-0.992069f,-0.992057f,-0.992045f,-0.992033f,-0.992021f,-0.992009f,-0.991997f,-0.991985f,-0.991973f,-0.99196f,-0.991948f,-0.991936f,-0.991924f,-0.991912f,-0.9919f,-0.991887f,-0.991875f,-0.991863f,-0.991851f,-0.991839f,-0.991826f,-0.991814f,-0.991802f,-0.99179f,-0.991777f,-0.991765f,-0.991753f,-0.991741f,-0.991728f,-0.991716f,-0.991704f,-0.991691f,-0.991679f,-0.991667f,-0.991654f,-0.991642f,-0.991629f,-0.991617f,-0.991605f,-0.991592f,-0.99158f,-0.991567f,-0.991555f,-0.991543f,-0.99153f,-0.991518f,-0.991505f,-0.991493f,-0.99148f,-0.991468f,-0.991455f,-0.991443f,-0.99143f,-0.991418f,-0.991405f,-0.991393f,-0.99138f,-0.991367f,-0.991355f,-0.991342f,-0.99133f,-0.991317f,-0.991305f,-0.991292f,-0.991279f,-0.991267f,-0.991254f,-0.991241f,-0.991229f,-0.991216f,-0.991203f,-0.991191f,-0.991178f,-0.991165f,-0.991152f,-0.99114f,-0.991127f,-0.991114f,-0.991102f,-0.991089f,-0.991076f,-0.991063f,-0.99105f,-0.991038f,-0.991025f,-0.991012f,-0.990999f,-0.990986f,-0.990973f,-0.990961f,-0.990948f,-0.990935f,-0.990922f,-0.990909f,-0.990896f,-0.990883f,-0.99087f,-0.990857f,-0.990844f,-0.990832f,-0.990819f,-0.990806f,-0.990793f,-0.99078f,-0.990767f,-0.990754f,-0.990741f,-0.990728f,-0.990715f,-0.990701f,-0.990689f,-0.990675f,-0.990662f,-0.990649f,-0.990636f,-0.990623f,-0.99061f,-0.990597f,-0.990584f,-0.990571f,-0.990557f,-0.990544f,-0.990531f,-0.990518f,-0.990505f,-0.990492f,-0.990478f,-0.990465f,-0.990452f,-0.990439f,-0.990426f,-0.990412f,-0.990399f,-0.990386f,-0.990373f,-0.990359f,-0.990346f,-0.990333f,-0.990319f,-0.990306f,-0.990293f,-0.990279f,-0.990266f,-0.990253f,-0.990239f,-0.990226f,-0.990213f,-0.990199f,-0.990186f,-0.990173f,-0.990159f,-0.990146f,-0.990132f,-0.990119f,-0.990105f,-0.990092f,-0.990078f,-0.990065f,-0.990051f,-0.990038f,-0.990024f,-0.990011f,-0.989997f,-0.989984f,-0.98997f,-0.989957f,-0.989943f,-0.98993f,-0.989916f,-0.989902f,-0.989889f,-0.989875f,-0.989862f,-0.989848f,-0.989834f,-0.989821f,-0.989807f,-0.989793f,-0.98978f,-0.989766f,-0.989752f,-0.989739f,-0.989725f,-0.989711f,-0.989698f,-0.989684f,-0.98967f,-0.989656f,-0.989643f,-0.989629f,-0.989615f,-0.989601f,-0.989588f,-0.989574f,-0.98956f,-0.989546f,-0.989532f,-0.989518f,-0.989505f,-0.989491f,-0.989477f,-0.989463f,-0.989449f,-0.989435f,-0.989421f,-0.989407f,-0.989393f,-0.98938f,-0.989366f,-0.989352f,-0.989338f,-0.989324f,-0.98931f,-0.989296f,-0.989282f,-0.989268f,-0.989254f,-0.98924f,-0.989226f,-0.989212f,-0.989198f,-0.989183f,-0.989169f,-0.989155f,-0.989141f,-0.989127f,-0.989113f,-0.989099f,-0.989085f,-0.989071f,-0.989057f,-0.989042f,-0.989028f,-0.989014f,-0.989f,-0.988986f,-0.988972f,-0.988957f,-0.988943f,-0.988929f,-0.988915f,-0.9889f,-0.988886f,-0.988872f,-0.988858f,-0.988843f,-0.988829f,-0.988815f,-0.9888f,-0.988786f,-0.988772f,-0.988757f,-0.988743f,-0.988729f,-0.988714f,-0.9887f,-0.988686f,-0.988671f,-0.988657f,-0.988643f,-0.988628f,-0.988614f,-0.988599f,-0.988585f,-0.98857f,-0.988556f,-0.988541f,-0.988527f,-0.988513f,-0.988498f,-0.988483f,-0.988469f,-0.988454f,-0.98844f,-0.988425f,-0.988411f,-0.988396f,-0.988382f,-0.988367f,-0.988353f,-0.988338f,-0.988323f,-0.988309f,-0.988294f,-0.98828f,-0.988265f,-0.98825f,-0.988236f,-0.988221f,-0.988206f,-0.988192f,-0.988177f,-0.988162f,-0.988147f,-0.988133f,-0.988118f,-0.988103f,-0.988088f,-0.988074f,-0.988059f,-0.988044f,-0.988029f,-0.988015f,-0.988f,-0.987985f,-0.98797f,-0.987955f,-0.98794f,-0.987926f,-0.987911f,-0.987896f,-0.987881f,-0.987866f,-0.987851f,-0.987836f,-0.987821f,-0.987806f,-0.987792f,-0.987777f,-0.987762f,-0.987747f,-0.987732f,-0.987717f,-0.987702f,-0.987687f,-0.987672f,-0.987657f,-0.987642f,-0.987627f,-0.987612f,-0.987597f,-0.987582f,-0.987567f,-0.987551f,-0.987536f,-0.987521f,-0.987506f,-0.987491f,-0.987476f,-0.987461f,-0.987446f,-0.987431f,-0.987415f,-0.9874f,-0.987385f,-0.98737f,-0.987355f,-0.987339f,-0.987324f,-0.987309f,-0.987294f,-0.987279f,-0.987263f,-0.987248f,-0.987233f,-0.987217f,-0.987202f,-0.987187f,-0.987172f,-0.987156f,-0.987141f,-0.987126f,-0.98711f,-0.987095f,-0.98708f,-0.987064f,-0.987049f,-0.987033f,-0.987018f,-0.987003f,-0.986987f,-0.986972f,-0.986956f,-0.986941f,-0.986926f,-0.98691f,-0.986895f,-0.986879f,-0.986864f,-0.986848f,-0.986833f,-0.986817f,-0.986802f,-0.986786f,-0.986771f,-0.986755f,-0.986739f,-0.986724f,-0.986708f,-0.986693f,-0.986677f,-0.986662f,-0.986646f,-0.98663f,-0.986615f,-0.986599f,-0.986583f,-0.986568f,-0.986552f,-0.986536f,-0.986521f,-0.986505f,-0.986489f,-0.986474f,-0.986458f,-0.986442f,-0.986426f,-0.986411f,-0.986395f,-0.986379f,-0.986363f,-0.986348f,-0.986332f,-0.986316f,-0.9863f,-0.986284f,-0.986269f,-0.986253f,-0.986237f,-0.986221f,-0.986205f,-0.986189f,-0.986173f,-0.986157f,-0.986142f,-0.986126f,-0.98611f,-0.986094f,-0.986078f,-0.986062f,-0.986046f,-0.98603f,-0.986014f,-0.985998f,-0.985982f,-0.985966f,-0.98595f,-0.985934f,-0.985918f,-0.985902f,-0.985886f,-0.98587f,-0.985854f,-0.985838f,-0.985822f,-0.985806f,-0.985789f,-0.985773f,-0.985757f,-0.985741f,-0.985725f,-0.985709f,-0.985693f,-0.985676f,-0.98566f,-0.985644f,-0.985628f,-0.985612f,-0.985595f,-0.985579f,-0.985563f,-0.985547f,-0.985531f,-0.985514f,-0.985498f,-0.985482f,-0.985466f,-0.985449f,-0.985433f,-0.985417f,-0.9854f,-0.985384f,-0.985368f,-0.985351f,-0.985335f,-0.985319f,-0.985302f,-0.985286f,-0.985269f,-0.985253f,-0.985237f,-0.98522f,-0.985204f,-0.985187f,-0.985171f,-0.985154f,-0.985138f,-0.985122f,-0.985105f,-0.985089f,-0.985072f,-0.985056f,-0.985039f,-0.985022f,-0.985006f,-0.984989f,-0.984973f,-0.984956f,-0.98494f,-0.984923f,-0.984907f,-0.98489f,-0.984873f,-0.984857f,-0.98484f,-0.984823f,-0.984807f,-0.98479f,-0.984773f,-0.984757f,-0.98474f,-0.984723f,-0.984707f,-0.98469f,-0.984673f,-0.984657f,-0.98464f,-0.984623f,-0.984606f,-0.98459f,-0.984573f,-0.984556f,-0.984539f,-0.984522f,-0.984506f,-0.984489f,-0.984472f,-0.984455f,-0.984438f,-0.984421f,-0.984405f,-0.984388f,-0.984371f,-0.984354f,-0.984337f,-0.98432f,-0.984303f,-0.984286f,-0.984269f,-0.984252f,-0.984235f,-0.984219f,-0.984202f,-0.984185f,-0.984168f,-0.984151f,-0.984134f,-0.984117f,-0.9841f,-0.984083f,-0.984066f,-0.984048f,-0.984031f,-0.984014f,-0.983997f,-0.98398f,-0.983963f,-0.983946f,-0.983929f,-0.983912f,-0.983895f,-0.983877f,-0.98386f,-0.983843f,-0.983826f,-0.983809f,-0.983792f,-0.983774f,-0.983757f,-0.98374f,-0.983723f,-0.983705f,-0.983688f,-0.983671f,-0.983654f,-0.983636f,-0.983619f,-0.983602f,-0.983585f,-0.983567f,-0.98355f,-0.983533f,-0.983515f,-0.983498f,-0.983481f,-0.983463f,-0.983446f,-0.983429f,-0.983411f,-0.983394f,-0.983376f,-0.983359f,-0.983342f,-0.983324f,-0.983307f,-0.983289f,-0.983272f,-0.983254f,-0.983237f,-0.983219f,-0.983202f,-0.983184f,-0.983167f,-0.983149f,-0.983132f,-0.983114f,-0.983097f,-0.983079f,-0.983062f,-0.983044f,-0.983026f,-0.983009f,-0.982991f,-0.982974f,-0.982956f,-0.982938f,-0.982921f,-0.982903f,-0.982885f,-0.982868f,-0.98285f,-0.982832f,-0.982815f,-0.982797f,-0.982779f,-0.982762f,-0.982744f,-0.982726f,-0.982708f,-0.982691f,-0.982673f,-0.982655f,-0.982637f,-0.982619f,-0.982602f,-0.982584f,-0.982566f,-0.982548f,-0.98253f,-0.982512f,-0.982495f,-0.982477f,-0.982459f,-0.982441f,-0.982423f,-0.982405f,-0.982387f,-0.982369f,-0.982351f,-0.982334f,-0.982316f,-0.982298f,-0.98228f,-0.982262f,-0.982244f,-0.982226f,-0.982208f,-0.98219f,-0.982172f,-0.982154f,-0.982136f,-0.982118f,-0.9821f,-0.982081f,-0.982063f,-0.982045f,-0.982027f,-0.982009f,-0.981991f,-0.981973f,-0.981955f,-0.981937f,-0.981918f,-0.9819f,-0.981882f,-0.981864f,-0.981846f,-0.981828f,-0.981809f,-0.981791f,-0.981773f,-0.981755f,-0.981737f,-0.981718f,-0.9817f,-0.981682f,-0.981663f,-0.981645f,-0.981627f,-0.981609f,-0.98159f,-0.981572f,-0.981554f,-0.981535f,-0.981517f,-0.981499f,-0.98148f,-0.981462f,-0.981444f,-0.981425f,-0.981407f,-0.981388f,-0.98137f,-0.981351f,-0.981333f,-0.981315f,-0.981296f,-0.981278f,-0.981259f,-0.981241f,-0.981222f,-0.981204f,-0.981185f,-0.981167f,-0.981148f,-0.98113f,-0.981111f,-0.981093f,-0.981074f,-0.981055f,-0.981037f,-0.981018f,-0.981f,-0.980981f,-0.980963f,-0.980944f,-0.980925f,-0.980907f,-0.980888f,-0.980869f,-0.980851f,-0.980832f,-0.980813f,-0.980795f,-0.980776f,-0.980757f,-0.980738f,-0.98072f,-0.980701f,-0.980682f,-0.980663f,-0.980645f,-0.980626f,-0.980607f,-0.980588f,-0.98057f,-0.980551f,-0.980532f,-0.980513f,-0.980494f,-0.980475f,-0.980457f,-0.980438f,-0.980419f,-0.9804f,-0.980381f,-0.980362f,-0.980343f,-0.980324f,-0.980305f,-0.980286f,-0.980268f,-0.980249f,-0.98023f,-0.980211f,-0.980192f,-0.980173f,-0.980154f,-0.980135f,-0.980116f,-0.980097f,-0.980078f,-0.980058f,-0.980039f,-0.98002f,-0.980001f,-0.979982f,-0.979963f,-0.979944f,-0.979925f,-0.979906f,-0.979887f,-0.979867f,-0.979848f,-0.979829f,-0.97981f,-0.979791f,-0.979772f,-0.979752f,-0.979733f,-0.979714f,-0.979695f,-0.979676f,-0.979656f,-0.979637f,-0.979618f,-0.979599f,-0.979579f,-0.97956f,-0.979541f,-0.979521f,-0.979502f,-0.979483f,-0.979464f,-0.979444f,-0.979425f,-0.979406f,-0.979386f,-0.979367f,-0.979347f,-0.979328f,-0.979309f,-0.979289f,-0.97927f,-0.97925f,-0.979231f,-0.979211f,-0.979192f,-0.979173f,-0.979153f,-0.979134f,-0.979114f,-0.979095f,-0.979075f,-0.979056f,-0.979036f,-0.979017f,-0.978997f,-0.978978f,-0.978958f,-0.978938f,-0.978919f,-0.978899f,-0.97888f,-0.97886f,-0.97884f,-0.978821f,-0.978801f,-0.978782f,-0.978762f,-0.978742f,-0.978723f,-0.978703f,-0.978683f,-0.978664f,-0.978644f,-0.978624f,-0.978604f,-0.978585f,-0.978565f,-0.978545f,-0.978525f,-0.978506f,-0.978486f,-0.978466f,-0.978446f,-0.978426f,-0.978407f,-0.978387f,-0.978367f,-0.978347f,-0.978327f,-0.978307f,-0.978288f,-0.978268f,-0.978248f,-0.978228f,-0.978208f,-0.978188f,-0.978168f,-0.978148f,-0.978128f,-0.978108f,-0.978088f,-0.978068f,-0.978049f,-0.978029f,-0.978009f,-0.977988f,-0.977968f,-0.977948f,-0.977928f,-0.977908f,-0.977888f,-0.977868f,-0.977848f,-0.977828f,-0.977808f,-0.977788f,-0.977768f,-0.977748f,-0.977728f,-0.977708f,-0.977687f,-0.977667f,-0.977647f,-0.977627f,-0.977607f,-0.977587f,-0.977566f,-0.977546f,-0.977526f,-0.977506f,-0.977486f,-0.977465f,-0.977445f,-0.977425f,-0.977405f,-0.977384f,-0.977364f,-0.977344f,-0.977323f,-0.977303f,-0.977283f,-0.977262f,-0.977242f,-0.977222f,-0.977201f,-0.977181f,-0.977161f,-0.97714f,-0.97712f,-0.9771f,-0.977079f,-0.977059f,-0.977038f,-0.977018f,-0.976997f,-0.976977f,-0.976957f,-0.976936f,-0.976916f,-0.976895f,-0.976875f,-0.976854f,-0.976834f,-0.976813f,-0.976793f,-0.976772f,-0.976752f,-0.976731f,-0.97671f,-0.97669f,-0.976669f,-0.976649f,-0.976628f,-0.976607f,-0.976587f,-0.976566f,-0.976545f,-0.976525f,-0.976504f,-0.976484f,-0.976463f,-0.976442f,-0.976421f,-0.976401f,-0.97638f,-0.976359f,-0.976339f,-0.976318f,-0.976297f,-0.976276f,-0.976256f,-0.976235f,-0.976214f,-0.976193f,-0.976172f,-0.976152f,-0.976131f,-0.97611f,-0.976089f,-0.976068f,-0.976048f,-0.976027f,-0.976006f,-0.975985f,-0.975964f,-0.975943f,-0.975922f,-0.975901f,-0.97588f,-0.975859f,-0.975838f,-0.975818f,-0.975797f,-0.975776f,-0.975755f,-0.975734f,-0.975713f,-0.975692f,-0.975671f,-0.97565f,-0.975628f,-0.975607f,-0.975586f,-0.975565f,-0.975544f,-0.975523f,-0.975502f,-0.975481f,-0.97546f,-0.975439f,-0.975418f,-0.975397f,-0.975375f,-0.975354f,-0.975333f,-0.975312f,-0.975291f,-0.97527f,-0.975248f,-0.975227f,-0.975206f,-0.975185f,-0.975164f,-0.975142f,-0.975121f,-0.9751f,-0.975079f,-0.975057f,-0.975036f,-0.975015f,-0.974993f,-0.974972f,-0.974951f,-0.974929f,-0.974908f,-0.974887f,-0.974865f,-0.974844f,-0.974823f,-0.974801f,-0.97478f,-0.974758f,-0.974737f,-0.974716f,-0.974694f,-0.974673f,-0.974651f,-0.97463f,-0.974608f,-0.974587f,-0.974565f,-0.974544f,-0.974522f,-0.974501f,-0.974479f,-0.974458f,-0.974436f,-0.974415f,-0.974393f,-0.974372f,-0.97435f,-0.974329f,-0.974307f,-0.974285f,-0.974264f,-0.974242f,-0.974221f,-0.974199f,-0.974177f,-0.974156f,-0.974134f,-0.974112f,-0.974091f,-0.974069f,-0.974047f,-0.974026f,-0.974004f,-0.973982f,-0.97396f,-0.973939f,-0.973917f,-0.973895f,-0.973873f,-0.973852f,-0.97383f,-0.973808f,-0.973786f,-0.973764f,-0.973743f,-0.973721f,-0.973699f,-0.973677f,-0.973655f,-0.973633f,-0.973611f,-0.973589f,-0.973568f,-0.973546f,-0.973524f,-0.973502f,-0.97348f,-0.973458f,-0.973436f,-0.973414f,-0.973392f,-0.97337f,-0.973348f,-0.973326f,-0.973304f,-0.973282f,-0.97326f,-0.973238f,-0.973216f,-0.973194f,-0.973172f,-0.97315f,-0.973128f,-0.973106f,-0.973084f,-0.973062f,-0.97304f,-0.973017f,-0.972995f,-0.972973f,-0.972951f,-0.972929f,-0.972907f,-0.972884f,-0.972862f,-0.97284f,-0.972818f,-0.972796f,-0.972773f,-0.972751f,-0.972729f,-0.972707f,-0.972685f,-0.972662f,-0.97264f,-0.972618f,-0.972596f,-0.972573f,-0.972551f,-0.972529f,-0.972506f,-0.972484f,-0.972462f,-0.972439f,-0.972417f,-0.972394f,-0.972372f,-0.97235f,-0.972327f,-0.972305f,-0.972283f,-0.97226f,-0.972238f,-0.972215f,-0.972193f,-0.97217f,-0.972148f,-0.972125f,-0.972103f,-0.97208f,-0.972058f,-0.972035f,-0.972013f,-0.97199f,-0.971968f,-0.971945f,-0.971923f,-0.9719f,-0.971878f,-0.971855f,-0.971832f,-0.97181f,-0.971787f,-0.971765f,-0.971742f,-0.971719f,-0.971697f,-0.971674f,-0.971651f,-0.971629f,-0.971606f,-0.971583f,-0.971561f,-0.971538f,-0.971515f,-0.971493f,-0.97147f,-0.971447f,-0.971424f,-0.971401f,-0.971379f,-0.971356f,-0.971333f,-0.97131f,-0.971288f,-0.971265f,-0.971242f,-0.971219f,-0.971196f,-0.971173f,-0.971151f,-0.971128f,-0.971105f,-0.971082f,-0.971059f,-0.971036f,-0.971013f,-0.97099f,-0.970967f,-0.970944f,-0.970921f,-0.970899f,-0.970876f,-0.970853f,-0.97083f,-0.970807f,-0.970784f,-0.970761f,-0.970738f,-0.970715f,-0.970691f,-0.970668f,-0.970645f,-0.970622f,-0.970599f,-0.970576f,-0.970553f,-0.97053f,-0.970507f,-0.970484f,-0.970461f,-0.970438f,-0.970414f,-0.970391f,-0.970368f,-0.970345f,-0.970322f,-0.970298f,-0.970275f,-0.970252f,-0.970229f,-0.970206f,-0.970182f,-0.970159f,-0.970136f,-0.970113f,-0.970089f,-0.970066f,-0.970043f,-0.97002f,-0.969996f,-0.969973f,-0.96995f,-0.969926f,-0.969903f,-0.96988f,-0.969856f,-0.969833f,-0.969809f,-0.969786f,-0.969763f,-0.969739f,-0.969716f,-0.969693f,-0.969669f,-0.969646f,-0.969622f,-0.969599f,-0.969575f,-0.969552f,-0.969528f,-0.969505f,-0.969481f,-0.969458f,-0.969434f,-0.969411f,-0.969387f,-0.969364f,-0.96934f,-0.969317f,-0.969293f,-0.969269f,-0.969246f,-0.969222f,-0.969199f,-0.969175f,-0.969151f,-0.969128f,-0.969104f,-0.96908f,-0.969057f,-0.969033f,-0.969009f,-0.968986f,-0.968962f,-0.968938f,-0.968915f,-0.968891f,-0.968867f,-0.968843f,-0.96882f,-0.968796f,-0.968772f,-0.968748f,-0.968725f,-0.968701f,-0.968677f,-0.968653f,-0.968629f,-0.968606f,-0.968582f,-0.968558f,-0.968534f,-0.96851f,-0.968486f,-0.968462f,-0.968439f,-0.968415f,-0.968391f,-0.968367f,-0.968343f,-0.968319f,-0.968295f,-0.968271f,-0.968247f,-0.968223f,-0.968199f,-0.968175f,-0.968151f,-0.968127f,-0.968103f,-0.968079f,-0.968055f,-0.968031f,-0.968007f,-0.967983f,-0.967959f,-0.967935f,-0.967911f,-0.967887f,-0.967862f,-0.967838f,-0.967814f,-0.96779f,-0.967766f,-0.967742f,-0.967718f,-0.967693f,-0.967669f,-0.967645f,-0.967621f,-0.967597f,-0.967572f,-0.967548f,-0.967524f,-0.9675f,-0.967475f,-0.967451f,-0.967427f,-0.967403f,-0.967378f,-0.967354f,-0.96733f,-0.967306f,-0.967281f,-0.967257f,-0.967232f,-0.967208f,-0.967184f,-0.967159f,-0.967135f,-0.967111f,-0.967086f,-0.967062f,-0.967037f,-0.967013f,-0.966989f,-0.966964f,-0.96694f,-0.966915f,-0.966891f,-0.966866f,-0.966842f,-0.966817f,-0.966793f,-0.966768f,-0.966744f,-0.966719f,-0.966695f,-0.96667f,-0.966646f,-0.966621f,-0.966597f,-0.966572f,-0.966547f,-0.966523f,-0.966498f,-0.966474f,-0.966449f,-0.966424f,-0.9664f,-0.966375f,-0.96635f,-0.966326f,-0.966301f,-0.966276f,-0.966252f,-0.966227f,-0.966202f,-0.966178f,-0.966153f,-0.966128f,-0.966103f,-0.966079f,-0.966054f,-0.966029f,-0.966004f,-0.96598f,-0.965955f,-0.96593f,-0.965905f,-0.96588f,-0.965855f,-0.965831f,-0.965806f,-0.965781f,-0.965756f,-0.965731f,-0.965706f,-0.965681f,-0.965656f,-0.965631f,-0.965607f,-0.965582f,-0.965557f,-0.965532f,-0.965507f,-0.965482f,-0.965457f,-0.965432f,-0.965407f,-0.965382f,-0.965357f,-0.965332f,-0.965307f,-0.965282f,-0.965257f,-0.965232f,-0.965207f,-0.965182f,-0.965156f,-0.965131f,-0.965106f,-0.965081f,-0.965056f,-0.965031f,-0.965006f,-0.964981f,-0.964956f,-0.96493f,-0.964905f,-0.96488f,-0.964855f,-0.96483f,-0.964804f,-0.964779f,-0.964754f,-0.964729f,-0.964703f,-0.964678f,-0.964653f,-0.964628f,-0.964602f,-0.964577f,-0.964552f,-0.964527f,-0.964501f,-0.964476f,-0.96445f,-0.964425f,-0.9644f,-0.964374f,-0.964349f,-0.964324f,-0.964298f,-0.964273f,-0.964248f,-0.964222f,-0.964197f,-0.964171f,-0.964146f,-0.96412f,-0.964095f,-0.96407f,-0.964044f,-0.964019f,-0.963993f,-0.963968f,-0.963942f,-0.963917f,-0.963891f,-0.963865f,-0.96384f,-0.963814f,-0.963789f,-0.963763f,-0.963738f,-0.963712f,-0.963687f,-0.963661f,-0.963635f,-0.96361f,-0.963584f,-0.963558f,-0.963533f,-0.963507f,-0.963481f,-0.963456f,-0.96343f,-0.963404f,-0.963379f,-0.963353f,-0.963327f,-0.963301f,-0.963276f,-0.96325f,-0.963224f,-0.963198f,-0.963173f,-0.963147f,-0.963121f,-0.963095f,-0.963069f,-0.963044f,-0.963018f,-0.962992f,-0.962966f,-0.96294f,-0.962914f,-0.962889f,-0.962863f,-0.962837f,-0.962811f,-0.962785f,-0.962759f,-0.962733f,-0.962707f,-0.962681f,-0.962655f,-0.962629f,-0.962603f,-0.962577f,-0.962551f,-0.962525f,-0.962499f,-0.962473f,-0.962447f,-0.962421f,-0.962395f,-0.962369f,-0.962343f,-0.962317f,-0.962291f,-0.962265f,-0.962239f,-0.962213f,-0.962187f,-0.962161f,-0.962134f,-0.962108f,-0.962082f,-0.962056f,-0.96203f,-0.962004f,-0.961978f,-0.961951f,-0.961925f,-0.961899f,-0.961873f,-0.961846f,-0.96182f,-0.961794f,-0.961768f,-0.961741f,-0.961715f,-0.961689f,-0.961663f,-0.961636f,-0.96161f,-0.961584f,-0.961557f,-0.961531f,-0.961505f,-0.961478f,-0.961452f,-0.961426f,-0.961399f,-0.961373f,-0.961346f,-0.96132f,-0.961294f,-0.961267f,-0.961241f,-0.961214f,-0.961188f,-0.961161f,-0.961135f,-0.961108f,-0.961082f,-0.961056f,-0.961029f,-0.961003f,-0.960976f,-0.960949f,-0.960923f,-0.960896f,-0.96087f,-0.960843f,-0.960817f,-0.96079f,-0.960764f,-0.960737f,-0.96071f,-0.960684f,-0.960657f,-0.96063f,-0.960604f,-0.960577f,-0.960551f,-0.960524f,-0.960497f,-0.96047f,-0.960444f,-0.960417f,-0.96039f,-0.960364f,-0.960337f,-0.96031f,-0.960284f,-0.960257f,-0.96023f,-0.960203f,-0.960176f,-0.96015f,-0.960123f,-0.960096f,-0.960069f,-0.960042f,-0.960016f,-0.959989f,-0.959962f,-0.959935f,-0.959908f,-0.959881f,-0.959854f,-0.959827f,-0.9598f,-0.959774f,-0.959747f,-0.95972f,-0.959693f,-0.959666f,-0.959639f,-0.959612f,-0.959585f,-0.959558f,-0.959531f,-0.959504f,-0.959477f,-0.95945f,-0.959423f,-0.959396f,-0.959369f,-0.959342f,-0.959315f,-0.959288f,-0.959261f,-0.959233f,-0.959206f,-0.959179f,-0.959152f,-0.959125f,-0.959098f,-0.959071f,-0.959044f,-0.959016f,-0.958989f,-0.958962f,-0.958935f,-0.958908f,-0.95888f,-0.958853f,-0.958826f,-0.958799f,-0.958772f,-0.958744f,-0.958717f,-0.95869f,-0.958663f,-0.958635f,-0.958608f,-0.958581f,-0.958553f,-0.958526f,-0.958499f,-0.958471f,-0.958444f,-0.958417f,-0.958389f,-0.958362f,-0.958335f,-0.958307f,-0.95828f,-0.958252f,-0.958225f,-0.958198f,-0.95817f,-0.958143f,-0.958115f,-0.958088f,-0.95806f,-0.958033f,-0.958005f,-0.957978f,-0.95795f,-0.957923f,-0.957895f,-0.957868f,-0.95784f,-0.957813f,-0.957785f,-0.957757f,-0.95773f,-0.957702f,-0.957675f,-0.957647f,-0.95762f,-0.957592f,-0.957564f,-0.957537f,-0.957509f,-0.957481f,-0.957454f,-0.957426f,-0.957398f,-0.957371f,-0.957343f,-0.957315f,-0.957288f,-0.95726f,-0.957232f,-0.957204f,-0.957177f,-0.957149f,-0.957121f,-0.957093f,-0.957065f,-0.957038f,-0.95701f,-0.956982f,-0.956954f,-0.956926f,-0.956899f,-0.956871f,-0.956843f,-0.956815f,-0.956787f,-0.956759f,-0.956731f,-0.956703f,-0.956675f,-0.956648f,-0.95662f,-0.956592f,-0.956564f,-0.956536f,-0.956508f,-0.95648f,-0.956452f,-0.956424f,-0.956396f,-0.956368f,-0.95634f,-0.956312f,-0.956284f,-0.956256f,-0.956228f,-0.9562f,-0.956172f,-0.956143f,-0.956115f,-0.956087f,-0.956059f,-0.956031f,-0.956003f,-0.955975f,-0.955947f,-0.955919f,-0.955891f,-0.955862f,-0.955834f,-0.955806f,-0.955778f,-0.95575f,-0.955721f,-0.955693f,-0.955665f,-0.955637f,-0.955608f,-0.95558f,-0.955552f,-0.955524f,-0.955495f,-0.955467f,-0.955439f,-0.955411f,-0.955382f,-0.955354f,-0.955325f,-0.955297f,-0.955269f,-0.95524f,-0.955212f,-0.955184f,-0.955155f,-0.955127f,-0.955099f,-0.95507f,-0.955042f,-0.955013f,-0.954985f,-0.954956f,-0.954928f,-0.954899f,-0.954871f,-0.954842f,-0.954814f,-0.954785f,-0.954757f,-0.954728f,-0.9547f,-0.954671f,-0.954643f,-0.954614f,-0.954586f,-0.954557f,-0.954529f,-0.9545f,-0.954472f,-0.954443f,-0.954414f,-0.954386f,-0.954357f,-0.954328f,-0.9543f,-0.954271f,-0.954242f,-0.954214f,-0.954185f,-0.954156f,-0.954128f,-0.954099f,-0.95407f,-0.954042f,-0.954013f,-0.953984f,-0.953955f,-0.953926f,-0.953898f,-0.953869f,-0.95384f,-0.953811f,-0.953783f,-0.953754f,-0.953725f,-0.953696f,-0.953667f,-0.953638f,-0.95361f,-0.953581f,-0.953552f,-0.953523f,-0.953494f,-0.953465f,-0.953436f,-0.953407f,-0.953378f,-0.953349f,-0.95332f,-0.953292f,-0.953263f,-0.953234f,-0.953205f,-0.953176f,-0.953147f,-0.953118f,-0.953089f,-0.95306f,-0.95303f,-0.953001f,-0.952972f,-0.952943f,-0.952914f,-0.952885f,-0.952856f,-0.952827f,-0.952798f,-0.952769f,-0.95274f,-0.952711f,-0.952681f,-0.952652f,-0.952623f,-0.952594f,-0.952565f,-0.952536f,-0.952506f,-0.952477f,-0.952448f,-0.952419f,-0.95239f,-0.95236f,-0.952331f,-0.952302f,-0.952273f,-0.952243f,-0.952214f,-0.952185f,-0.952156f,-0.952126f,-0.952097f,-0.952067f,-0.952038f,-0.952009f,-0.951979f,-0.95195f,-0.951921f,-0.951891f,-0.951862f,-0.951833f,-0.951803f,-0.951774f,-0.951744f,-0.951715f,-0.951686f,-0.951656f,-0.951627f,-0.951597f,-0.951568f,-0.951538f,-0.951509f,-0.951479f,-0.95145f,-0.95142f,-0.951391f,-0.951361f,-0.951332f,-0.951302f,-0.951273f,-0.951243f,-0.951213f,-0.951184f,-0.951154f,-0.951125f,-0.951095f,-0.951065f,-0.951036f,-0.951006f,-0.950976f,-0.950947f,-0.950917f,-0.950887f,-0.950858f,-0.950828f,-0.950798f,-0.950769f,-0.950739f,-0.950709f,-0.95068f,-0.95065f,-0.95062f,-0.95059f,-0.95056f,-0.950531f,-0.950501f,-0.950471f,-0.950441f,-0.950411f,-0.950382f,-0.950352f,-0.950322f,-0.950292f,-0.950262f,-0.950233f,-0.950203f,-0.950173f,-0.950143f,-0.950113f,-0.950083f,-0.950053f,-0.950023f,-0.949993f,-0.949963f,-0.949933f,-0.949903f,-0.949873f,-0.949843f,-0.949813f,-0.949784f,-0.949754f,-0.949723f,-0.949693f,-0.949663f,-0.949633f,-0.949603f,-0.949573f,-0.949543f,-0.949513f,-0.949483f,-0.949453f,-0.949423f,-0.949393f,-0.949363f,-0.949333f,-0.949302f,-0.949272f,-0.949242f,-0.949212f,-0.949182f,-0.949151f,-0.949121f,-0.949091f,-0.949061f,-0.949031f,-0.949f,-0.94897f,-0.94894f,-0.94891f,-0.94888f,-0.948849f,-0.948819f,-0.948789f,-0.948758f,-0.948728f,-0.948698f,-0.948667f,-0.948637f,-0.948607f,-0.948576f,-0.948546f,-0.948516f,-0.948485f,-0.948455f,-0.948425f,-0.948394f,-0.948364f,-0.948333f,-0.948303f,-0.948273f,-0.948242f,-0.948212f,-0.948181f,-0.948151f,-0.94812f,-0.94809f,-0.948059f,-0.948029f,-0.947998f,-0.947968f,-0.947937f,-0.947907f,-0.947876f,-0.947846f,-0.947815f,-0.947785f,-0.947754f,-0.947723f,-0.947693f,-0.947662f,-0.947631f,-0.947601f,-0.94757f,-0.94754f,-0.947509f,-0.947478f,-0.947448f,-0.947417f,-0.947386f,-0.947356f,-0.947325f,-0.947294f,-0.947263f,-0.947233f,-0.947202f,-0.947171f,-0.94714f,-0.94711f,-0.947079f,-0.947048f,-0.947017f,-0.946987f,-0.946956f,-0.946925f,-0.946894f,-0.946863f,-0.946832f,-0.946802f,-0.946771f,-0.94674f,-0.946709f,-0.946678f,-0.946647f,-0.946616f,-0.946585f,-0.946554f,-0.946524f,-0.946493f,-0.946462f,-0.946431f,-0.9464f,-0.946369f,-0.946338f,-0.946307f,-0.946276f,-0.946245f,-0.946214f,-0.946183f,-0.946152f,-0.946121f,-0.94609f,-0.946059f,-0.946028f,-0.945996f,-0.945965f,-0.945934f,-0.945903f,-0.945872f,-0.945841f,-0.94581f,-0.945779f,-0.945747f,-0.945716f,-0.945685f,-0.945654f,-0.945623f,-0.945592f,-0.94556f,-0.945529f,-0.945498f,-0.945467f,-0.945436f,-0.945404f,-0.945373f,-0.945342f,-0.945311f,-0.945279f,-0.945248f,-0.945217f,-0.945185f,-0.945154f,-0.945123f,-0.945091f,-0.94506f,-0.945029f,-0.944997f,-0.944966f,-0.944935f,-0.944903f,-0.944872f,-0.944841f,-0.944809f,-0.944778f,-0.944746f,-0.944715f,-0.944683f,-0.944652f,-0.94462f,-0.944589f,-0.944558f,-0.944526f,-0.944495f,-0.944463f,-0.944432f,-0.9444f,-0.944369f,-0.944337f,-0.944306f,-0.944274f,-0.944242f,-0.944211f,-0.944179f,-0.944148f,-0.944116f,-0.944084f,-0.944053f,-0.944021f,-0.94399f,-0.943958f,-0.943926f,-0.943895f,-0.943863f,-0.943831f,-0.9438f,-0.943768f,-0.943736f,-0.943704f,-0.943673f,-0.943641f,-0.943609f,-0.943578f,-0.943546f,-0.943514f,-0.943482f,-0.94345f,-0.943419f,-0.943387f,-0.943355f,-0.943323f,-0.943291f,-0.94326f,-0.943228f,-0.943196f,-0.943164f,-0.943132f,-0.9431f,-0.943068f,-0.943037f,-0.943005f,-0.942973f,-0.942941f,-0.942909f,-0.942877f,-0.942845f,-0.942813f,-0.942781f,-0.942749f,-0.942717f,-0.942685f,-0.942653f,-0.942621f,-0.942589f,-0.942557f,-0.942525f,-0.942493f,-0.942461f,-0.942429f,-0.942397f,-0.942365f,-0.942333f,-0.942301f,-0.942269f,-0.942236f,-0.942204f,-0.942172f,-0.94214f,-0.942108f,-0.942076f,-0.942044f,-0.942011f,-0.941979f,-0.941947f,-0.941915f,-0.941883f,-0.94185f,-0.941818f,-0.941786f,-0.941754f,-0.941722f,-0.941689f,-0.941657f,-0.941625f,-0.941592f,-0.94156f,-0.941528f,-0.941496f,-0.941463f,-0.941431f,-0.941399f,-0.941366f,-0.941334f,-0.941302f,-0.941269f,-0.941237f,-0.941204f,-0.941172f,-0.94114f,-0.941107f,-0.941075f,-0.941042f,-0.94101f,-0.940977f,-0.940945f,-0.940913f,-0.94088f,-0.940848f,-0.940815f,-0.940783f,-0.94075f,-0.940718f,-0.940685f,-0.940653f,-0.94062f,-0.940587f,-0.940555f,-0.940522f,-0.94049f,-0.940457f,-0.940425f,-0.940392f,-0.940359f,-0.940327f,-0.940294f,-0.940261f,-0.940229f,-0.940196f,-0.940164f,-0.940131f,-0.940098f,-0.940065f,-0.940033f,-0.94f,-0.939967f,-0.939935f,-0.939902f,-0.939869f,-0.939836f,-0.939804f,-0.939771f,-0.939738f,-0.939705f,-0.939673f,-0.93964f,-0.939607f,-0.939574f,-0.939541f,-0.939508f,-0.939476f,-0.939443f,-0.93941f,-0.939377f,-0.939344f,-0.939311f,-0.939278f,-0.939245f,-0.939213f,-0.93918f,-0.939147f,-0.939114f,-0.939081f,-0.939048f,-0.939015f,-0.938982f,-0.938949f,-0.938916f,-0.938883f,-0.93885f,-0.938817f,-0.938784f,-0.938751f,-0.938718f,-0.938685f,-0.938652f,-0.938619f,-0.938586f,-0.938553f,-0.938519f,-0.938486f,-0.938453f,-0.93842f,-0.938387f,-0.938354f,-0.938321f,-0.938287f,-0.938254f,-0.938221f,-0.938188f,-0.938155f,-0.938122f,-0.938088f,-0.938055f,-0.938022f,-0.937989f,-0.937955f,-0.937922f,-0.937889f,-0.937856f,-0.937822f,-0.937789f,-0.937756f,-0.937723f,-0.937689f,-0.937656f,-0.937623f,-0.937589f,-0.937556f,-0.937523f,-0.937489f,-0.937456f,-0.937423f,-0.937389f,-0.937356f,-0.937322f,-0.937289f,-0.937255f,-0.937222f,-0.937189f,-0.937155f,-0.937122f,-0.937088f,-0.937055f,-0.937021f,-0.936988f,-0.936954f,-0.936921f,-0.936887f,-0.936854f,-0.93682f,-0.936787f,-0.936753f,-0.936719f,-0.936686f,-0.936652f,-0.936619f,-0.936585f,-0.936552f,-0.936518f,-0.936484f,-0.936451f,-0.936417f,-0.936383f,-0.93635f,-0.936316f,-0.936282f,-0.936249f,-0.936215f,-0.936181f,-0.936148f,-0.936114f,-0.93608f,-0.936047f,-0.936013f,-0.935979f,-0.935945f,-0.935912f,-0.935878f,-0.935844f,-0.93581f,-0.935776f,-0.935742f,-0.935709f,-0.935675f,-0.935641f,-0.935607f,-0.935573f,-0.935539f,-0.935506f,-0.935472f,-0.935438f,-0.935404f,-0.93537f,-0.935336f,-0.935302f,-0.935268f,-0.935234f,-0.9352f,-0.935166f,-0.935132f,-0.935099f,-0.935065f,-0.935031f,-0.934997f,-0.934963f,-0.934929f,-0.934895f,-0.934861f,-0.934826f,-0.934792f,-0.934758f,-0.934724f,-0.93469f,-0.934656f,-0.934622f,-0.934588f,-0.934554f,-0.93452f,-0.934486f,-0.934451f,-0.934417f,-0.934383f,-0.934349f,-0.934315f,-0.934281f,-0.934246f,-0.934212f,-0.934178f,-0.934144f,-0.93411f,-0.934075f,-0.934041f,-0.934007f,-0.933973f,-0.933938f,-0.933904f,-0.93387f,-0.933836f,-0.933801f,-0.933767f,-0.933733f,-0.933698f,-0.933664f,-0.93363f,-0.933595f,-0.933561f,-0.933526f,-0.933492f,-0.933458f,-0.933423f,-0.933389f,-0.933355f,-0.93332f,-0.933286f,-0.933251f,-0.933217f,-0.933182f,-0.933148f,-0.933114f,-0.933079f,-0.933045f,-0.93301f,-0.932975f,-0.932941f,-0.932906f,-0.932872f,-0.932837f,-0.932803f,-0.932768f,-0.932734f,-0.932699f,-0.932665f,-0.93263f,-0.932595f,-0.932561f,-0.932526f,-0.932492f,-0.932457f,-0.932422f,-0.932388f,-0.932353f,-0.932318f,-0.932284f,-0.932249f,-0.932214f,-0.93218f,-0.932145f,-0.93211f,-0.932075f,-0.932041f,-0.932006f,-0.931971f,-0.931936f,-0.931902f,-0.931867f,-0.931832f,-0.931797f,-0.931762f,-0.931728f,-0.931693f,-0.931658f,-0.931623f,-0.931588f,-0.931553f,-0.931519f,-0.931484f,-0.931449f,-0.931414f,-0.931379f,-0.931344f,-0.931309f,-0.931274f,-0.931239f,-0.931204f,-0.931169f,-0.931134f,-0.9311f,-0.931065f,-0.93103f,-0.930995f,-0.93096f,-0.930925f,-0.93089f,-0.930855f,-0.93082f,-0.930784f,-0.930749f,-0.930714f,-0.930679f,-0.930644f,-0.930609f,-0.930574f,-0.930539f,-0.930504f,-0.930469f,-0.930434f,-0.930398f,-0.930363f,-0.930328f,-0.930293f,-0.930258f,-0.930222f,-0.930187f,-0.930152f,-0.930117f,-0.930082f,-0.930046f,-0.930011f,-0.929976f,-0.929941f,-0.929906f,-0.92987f,-0.929835f,-0.9298f,-0.929765f,-0.929729f,-0.929694f,-0.929659f,-0.929623f,-0.929588f,-0.929552f,-0.929517f,-0.929482f,-0.929446f,-0.929411f,-0.929376f,-0.92934f,-0.929305f,-0.929269f,-0.929234f,-0.929199f,-0.929163f,-0.929128f,-0.929092f,-0.929057f,-0.929021f,-0.928986f,-0.92895f,-0.928915f,-0.928879f,-0.928844f,-0.928808f,-0.928773f,-0.928737f,-0.928702f,-0.928666f,-0.928631f,-0.928595f,-0.928559f,-0.928524f,-0.928488f,-0.928453f,-0.928417f,-0.928381f,-0.928346f,-0.92831f,-0.928274f,-0.928239f,-0.928203f,-0.928167f,-0.928132f,-0.928096f,-0.92806f,-0.928025f,-0.927989f,-0.927953f,-0.927917f,-0.927882f,-0.927846f,-0.92781f,-0.927774f,-0.927739f,-0.927703f,-0.927667f,-0.927631f,-0.927595f,-0.92756f,-0.927524f,-0.927488f,-0.927452f,-0.927416f,-0.927381f,-0.927344f,-0.927309f,-0.927273f,-0.927237f,-0.927201f,-0.927165f,-0.927129f,-0.927093f,-0.927057f,-0.927021f,-0.926985f,-0.926949f,-0.926913f,-0.926877f,-0.926841f,-0.926805f,-0.926769f,-0.926733f,-0.926697f,-0.926661f,-0.926625f,-0.926589f,-0.926553f,-0.926517f,-0.926481f,-0.926445f,-0.926409f,-0.926373f,-0.926337f,-0.926301f,-0.926264f,-0.926228f,-0.926192f,-0.926156f,-0.92612f,-0.926084f,-0.926047f,-0.926011f,-0.925975f,-0.925939f,-0.925903f,-0.925866f,-0.92583f,-0.925794f,-0.925758f,-0.925722f,-0.925685f,-0.925649f,-0.925613f,-0.925576f,-0.92554f,-0.925504f,-0.925467f,-0.925431f,-0.925395f,-0.925358f,-0.925322f,-0.925286f,-0.925249f,-0.925213f,-0.925177f,-0.92514f,-0.925104f,-0.925067f,-0.925031f,-0.924994f,-0.924958f,-0.924922f,-0.924885f,-0.924849f,-0.924812f,-0.924776f,-0.924739f,-0.924703f,-0.924666f,-0.92463f,-0.924593f,-0.924557f,-0.92452f,-0.924484f,-0.924447f,-0.924411f,-0.924374f,-0.924337f,-0.924301f,-0.924264f,-0.924228f,-0.924191f,-0.924154f,-0.924118f,-0.924081f,-0.924045f,-0.924008f,-0.923971f,-0.923935f,-0.923898f,-0.923861f,-0.923824f,-0.923788f,-0.923751f,-0.923714f,-0.923678f,-0.923641f,-0.923604f,-0.923567f,-0.923531f,-0.923494f,-0.923457f,-0.92342f,-0.923383f,-0.923347f,-0.92331f,-0.923273f,-0.923236f,-0.923199f,-0.923162f,-0.923126f,-0.923089f,-0.923052f,-0.923015f,-0.922978f,-0.922941f,-0.922904f,-0.922867f,-0.92283f,-0.922794f,-0.922757f,-0.92272f,-0.922683f,-0.922646f,-0.922609f,-0.922572f,-0.922535f,-0.922498f,-0.922461f,-0.922424f,-0.922387f,-0.92235f,-0.922313f,-0.922275f,-0.922238f,-0.922201f,-0.922164f,-0.922127f,-0.92209f,-0.922053f,-0.922016f,-0.921979f,-0.921942f,-0.921904f,-0.921867f,-0.92183f,-0.921793f,-0.921756f,-0.921719f,-0.921681f,-0.921644f,-0.921607f,-0.92157f,-0.921533f,-0.921495f,-0.921458f,-0.921421f,-0.921384f,-0.921346f,-0.921309f,-0.921272f,-0.921234f,-0.921197f,-0.92116f,-0.921123f,-0.921085f,-0.921048f,-0.921011f,-0.920973f,-0.920936f,-0.920899f,-0.920861f,-0.920824f,-0.920786f,-0.920749f,-0.920711f,-0.920674f,-0.920637f,-0.920599f,-0.920562f,-0.920524f,-0.920487f,-0.920449f,-0.920412f,-0.920375f,-0.920337f,-0.9203f,-0.920262f,-0.920224f,-0.920187f,-0.920149f,-0.920112f,-0.920074f,-0.920037f,-0.919999f,-0.919962f,-0.919924f,-0.919886f,-0.919849f,-0.919811f,-0.919774f,-0.919736f,-0.919698f,-0.919661f,-0.919623f,-0.919585f,-0.919548f,-0.91951f,-0.919472f,-0.919435f,-0.919397f,-0.919359f,-0.919321f,-0.919284f,-0.919246f,-0.919208f,-0.91917f,-0.919133f,-0.919095f,-0.919057f,-0.919019f,-0.918981f,-0.918944f,-0.918906f,-0.918868f,-0.91883f,-0.918792f,-0.918755f,-0.918717f,-0.918679f,-0.918641f,-0.918603f,-0.918565f,-0.918527f,-0.918489f,-0.918452f,-0.918413f,-0.918376f,-0.918338f,-0.9183f,-0.918262f,-0.918224f,-0.918186f,-0.918148f,-0.91811f,-0.918072f,-0.918034f,-0.917996f,-0.917958f,-0.91792f,-0.917882f,-0.917844f,-0.917805f,-0.917767f,-0.917729f,-0.917691f,-0.917653f,-0.917615f,-0.917577f,-0.917539f,-0.917501f,-0.917463f,-0.917425f,-0.917386f,-0.917348f,-0.91731f,-0.917272f,-0.917234f,-0.917196f,-0.917157f,-0.917119f,-0.917081f,-0.917043f,-0.917004f,-0.916966f,-0.916928f,-0.91689f,-0.916851f,-0.916813f,-0.916775f,-0.916736f,-0.916698f,-0.91666f,-0.916622f,-0.916583f,-0.916545f,-0.916506f,-0.916468f,-0.91643f,-0.916391f,-0.916353f,-0.916315f,-0.916276f,-0.916238f,-0.916199f,-0.916161f,-0.916123f,-0.916084f,-0.916046f,-0.916007f,-0.915969f,-0.91593f,-0.915892f,-0.915853f,-0.915815f,-0.915776f,-0.915738f,-0.915699f,-0.915661f,-0.915622f,-0.915584f,-0.915545f,-0.915507f,-0.915468f,-0.915429f,-0.915391f,-0.915352f,-0.915313f,-0.915275f,-0.915236f,-0.915198f,-0.915159f,-0.91512f,-0.915082f,-0.915043f,-0.915004f,-0.914966f,-0.914927f,-0.914888f,-0.91485f,-0.914811f,-0.914772f,-0.914734f,-0.914695f,-0.914656f,-0.914617f,-0.914578f,-0.91454f,-0.914501f,-0.914462f,-0.914423f,-0.914384f,-0.914346f,-0.914307f,-0.914268f,-0.914229f,-0.91419f,-0.914151f,-0.914113f,-0.914074f,-0.914035f,-0.913996f,-0.913957f,-0.913918f,-0.913879f,-0.91384f,-0.913801f,-0.913762f,-0.913723f,-0.913684f,-0.913646f,-0.913607f,-0.913568f,-0.913529f,-0.91349f,-0.91345f,-0.913411f,-0.913372f,-0.913333f,-0.913294f,-0.913255f,-0.913216f,-0.913177f,-0.913138f,-0.913099f,-0.91306f,-0.913021f,-0.912982f,-0.912943f,-0.912903f,-0.912864f,-0.912825f,-0.912786f,-0.912747f,-0.912708f,-0.912668f,-0.912629f,-0.91259f,-0.912551f,-0.912512f,-0.912472f,-0.912433f,-0.912394f,-0.912355f,-0.912316f,-0.912276f,-0.912237f,-0.912198f,-0.912158f,-0.912119f,-0.91208f,-0.91204f,-0.912001f,-0.911962f,-0.911922f,-0.911883f,-0.911844f,-0.911804f,-0.911765f,-0.911726f,-0.911686f,-0.911647f,-0.911608f,-0.911568f,-0.911529f,-0.911489f,-0.91145f,-0.91141f,-0.911371f,-0.911331f,-0.911292f,-0.911252f,-0.911213f,-0.911173f,-0.911134f,-0.911094f,-0.911055f,-0.911015f,-0.910976f,-0.910936f,-0.910897f,-0.910857f,-0.910818f,-0.910778f,-0.910738f,-0.910699f,-0.910659f,-0.91062f,-0.91058f,-0.91054f,-0.910501f,-0.910461f,-0.910421f,-0.910382f,-0.910342f,-0.910302f,-0.910263f,-0.910223f,-0.910183f,-0.910143f,-0.910104f,-0.910064f,-0.910024f,-0.909985f,-0.909945f,-0.909905f,-0.909865f,-0.909826f,-0.909786f,-0.909746f,-0.909706f,-0.909666f,-0.909626f,-0.909587f,-0.909547f,-0.909507f,-0.909467f,-0.909427f,-0.909387f,-0.909347f,-0.909308f,-0.909268f,-0.909228f,-0.909188f,-0.909148f,-0.909108f,-0.909068f,-0.909028f,-0.908988f,-0.908948f,-0.908908f,-0.908868f,-0.908828f,-0.908788f,-0.908748f,-0.908708f,-0.908668f,-0.908628f,-0.908588f,-0.908548f,-0.908508f,-0.908468f,-0.908428f,-0.908388f,-0.908348f,-0.908307f,-0.908267f,-0.908227f,-0.908187f,-0.908147f,-0.908107f,-0.908067f,-0.908027f,-0.907987f,-0.907946f,-0.907906f,-0.907866f,-0.907826f,-0.907786f,-0.907745f,-0.907705f,-0.907665f,-0.907625f,-0.907584f,-0.907544f,-0.907504f,-0.907464f,-0.907423f,-0.907383f,-0.907343f,-0.907302f,-0.907262f,-0.907222f,-0.907182f,-0.907141f,-0.907101f,-0.90706f,-0.90702f,-0.90698f,-0.906939f,-0.906899f,-0.906858f,-0.906818f,-0.906778f,-0.906737f,-0.906697f,-0.906656f,-0.906616f,-0.906575f,-0.906535f,-0.906495f,-0.906454f,-0.906414f,-0.906373f,-0.906332f,-0.906292f,-0.906251f,-0.906211f,-0.90617f,-0.90613f,-0.906089f,-0.906049f,-0.906008f,-0.905968f,-0.905927f,-0.905886f,-0.905846f,-0.905805f,-0.905765f,-0.905724f,-0.905683f,-0.905643f,-0.905602f,-0.905561f,-0.90552f,-0.90548f,-0.905439f,-0.905398f,-0.905358f,-0.905317f,-0.905276f,-0.905236f,-0.905195f,-0.905154f,-0.905113f,-0.905073f,-0.905032f,-0.904991f,-0.90495f,-0.904909f,-0.904869f,-0.904828f,-0.904787f,-0.904746f,-0.904705f,-0.904664f,-0.904624f,-0.904583f,-0.904542f,-0.904501f,-0.90446f,-0.904419f,-0.904378f,-0.904337f,-0.904296f,-0.904255f,-0.904215f,-0.904174f,-0.904133f,-0.904092f,-0.904051f,-0.90401f,-0.903969f,-0.903928f,-0.903887f,-0.903846f,-0.903805f,-0.903764f,-0.903723f,-0.903681f,-0.90364f,-0.903599f,-0.903558f,-0.903517f,-0.903476f,-0.903435f,-0.903394f,-0.903353f,-0.903312f,-0.903271f,-0.90323f,-0.903188f,-0.903147f,-0.903106f,-0.903065f,-0.903024f,-0.902982f,-0.902941f,-0.9029f,-0.902859f,-0.902818f,-0.902776f,-0.902735f,-0.902694f,-0.902653f,-0.902611f,-0.90257f,-0.902529f,-0.902488f,-0.902446f,-0.902405f,-0.902364f,-0.902322f,-0.902281f,-0.90224f,-0.902198f,-0.902157f,-0.902116f,-0.902074f,-0.902033f,-0.901991f,-0.90195f,-0.901909f,-0.901867f,-0.901826f,-0.901784f,-0.901743f,-0.901701f,-0.90166f,-0.901618f,-0.901577f,-0.901536f,-0.901494f,-0.901453f,-0.901411f,-0.90137f,-0.901328f,-0.901287f,-0.901245f,-0.901203f,-0.901162f,-0.90112f,-0.901079f,-0.901037f,-0.900995f,-0.900954f,-0.900912f,-0.900871f,-0.900829f,-0.900787f,-0.900746f,-0.900704f,-0.900663f,-0.900621f,-0.900579f,-0.900538f,-0.900496f,-0.900454f,-0.900412f,-0.900371f,-0.900329f,-0.900287f,-0.900245f,-0.900204f,-0.900162f,-0.90012f,-0.900078f,-0.900037f,-0.899995f,-0.899953f,-0.899911f,-0.89987f,-0.899828f,-0.899786f,-0.899744f,-0.899702f,-0.89966f,-0.899618f,-0.899577f,-0.899535f,-0.899493f,-0.899451f,-0.899409f,-0.899367f,-0.899325f,-0.899283f,-0.899241f,-0.899199f,-0.899158f,-0.899116f,-0.899074f,-0.899031f,-0.898989f,-0.898947f,-0.898906f,-0.898863f,-0.898822f,-0.89878f,-0.898737f,-0.898695f,-0.898653f,-0.898611f,-0.898569f,-0.898527f,-0.898485f,-0.898443f,-0.898401f,-0.898359f,-0.898317f,-0.898274f,-0.898232f,-0.89819f,-0.898148f,-0.898106f,-0.898064f,-0.898022f,-0.897979f,-0.897937f,-0.897895f,-0.897853f,-0.897811f,-0.897768f,-0.897726f,-0.897684f,-0.897642f,-0.897599f,-0.897557f,-0.897515f,-0.897473f,-0.89743f,-0.897388f,-0.897346f,-0.897303f,-0.897261f,-0.897219f,-0.897176f,-0.897134f,-0.897092f,-0.897049f,-0.897007f,-0.896964f,-0.896922f,-0.89688f,-0.896837f,-0.896795f,-0.896752f,-0.89671f,-0.896668f,-0.896625f,-0.896583f,-0.89654f,-0.896498f,-0.896455f,-0.896413f,-0.89637f,-0.896328f,-0.896285f,-0.896243f,-0.8962f,-0.896158f,-0.896115f,-0.896073f,-0.89603f,-0.895987f,-0.895945f,-0.895902f,-0.89586f,-0.895817f,-0.895775f,-0.895732f,-0.895689f,-0.895647f,-0.895604f,-0.895561f,-0.895519f,-0.895476f,-0.895433f,-0.895391f,-0.895348f,-0.895305f,-0.895263f,-0.89522f,-0.895177f,-0.895134f,-0.895092f,-0.895049f,-0.895006f,-0.894963f,-0.89492f,-0.894878f,-0.894835f,-0.894792f,-0.894749f,-0.894706f,-0.894664f,-0.894621f,-0.894578f,-0.894535f,-0.894492f,-0.894449f,-0.894407f,-0.894364f,-0.894321f,-0.894278f,-0.894235f,-0.894192f,-0.894149f,-0.894106f,-0.894063f,-0.89402f,-0.893977f,-0.893934f,-0.893891f,-0.893848f,-0.893805f,-0.893762f,-0.893719f,-0.893676f,-0.893633f,-0.89359f,-0.893547f,-0.893504f,-0.893461f,-0.893418f,-0.893375f,-0.893332f,-0.893289f,-0.893246f,-0.893203f,-0.89316f,-0.893116f,-0.893073f,-0.89303f,-0.892987f,-0.892944f,-0.892901f,-0.892857f,-0.892814f,-0.892771f,-0.892728f,-0.892685f,-0.892642f,-0.892598f,-0.892555f,-0.892512f,-0.892469f,-0.892425f,-0.892382f,-0.892339f,-0.892296f,-0.892252f,-0.892209f,-0.892166f,-0.892122f,-0.892079f,-0.892036f,-0.891992f,-0.891949f,-0.891906f,-0.891862f,-0.891819f,-0.891776f,-0.891732f,-0.891689f,-0.891645f,-0.891602f,-0.891559f,-0.891515f,-0.891472f,-0.891428f,-0.891385f,-0.891341f,-0.891298f,-0.891254f,-0.891211f,-0.891167f,-0.891124f,-0.89108f,-0.891037f,-0.890993f,-0.89095f,-0.890906f,-0.890863f,-0.890819f,-0.890776f,-0.890732f,-0.890688f,-0.890645f,-0.890601f,-0.890558f,-0.890514f,-0.89047f,-0.890427f,-0.890383f,-0.89034f,-0.890296f,-0.890252f,-0.890209f,-0.890165f,-0.890121f,-0.890078f,-0.890034f,-0.88999f,-0.889946f,-0.889903f,-0.889859f,-0.889815f,-0.889771f,-0.889728f,-0.889684f,-0.88964f,-0.889596f,-0.889553f,-0.889509f,-0.889465f,-0.889421f,-0.889377f,-0.889333f,-0.889289f,-0.889246f,-0.889202f,-0.889158f,-0.889114f,-0.88907f,-0.889026f,-0.888982f,-0.888939f,-0.888895f,-0.888851f,-0.888807f,-0.888763f,-0.888719f,-0.888675f,-0.888631f,-0.888587f,-0.888543f,-0.888499f,-0.888455f,-0.888411f,-0.888367f,-0.888323f,-0.888279f,-0.888235f,-0.888191f,-0.888147f,-0.888103f,-0.888059f,-0.888015f,-0.887971f,-0.887926f,-0.887882f,-0.887838f,-0.887794f,-0.88775f,-0.887706f,-0.887662f,-0.887617f,-0.887573f,-0.887529f,-0.887485f,-0.887441f,-0.887397f,-0.887352f,-0.887308f,-0.887264f,-0.88722f,-0.887175f,-0.887131f,-0.887087f,-0.887043f,-0.886998f,-0.886954f,-0.88691f,-0.886866f,-0.886821f,-0.886777f,-0.886733f,-0.886688f,-0.886644f,-0.8866f,-0.886555f,-0.886511f,-0.886467f,-0.886422f,-0.886378f,-0.886333f,-0.886289f,-0.886245f,-0.8862f,-0.886156f,-0.886111f,-0.886067f,-0.886023f,-0.885978f,-0.885934f,-0.885889f,-0.885845f,-0.8858f,-0.885756f,-0.885711f,-0.885667f,-0.885622f,-0.885578f,-0.885533f,-0.885489f,-0.885444f,-0.885399f,-0.885355f,-0.88531f,-0.885266f,-0.885221f,-0.885177f,-0.885132f,-0.885087f,-0.885043f,-0.884998f,-0.884953f,-0.884909f,-0.884864f,-0.884819f,-0.884775f,-0.88473f,-0.884685f,-0.884641f,-0.884596f,-0.884551f,-0.884507f,-0.884462f,-0.884417f,-0.884372f,-0.884327f,-0.884283f,-0.884238f,-0.884193f,-0.884148f,-0.884104f,-0.884059f,-0.884014f,-0.883969f,-0.883924f,-0.88388f,-0.883835f,-0.88379f,-0.883745f,-0.8837f,-0.883655f,-0.88361f,-0.883565f,-0.88352f,-0.883476f,-0.883431f,-0.883386f,-0.883341f,-0.883296f,-0.883251f,-0.883206f,-0.883161f,-0.883116f,-0.883071f,-0.883026f,-0.882981f,-0.882936f,-0.882891f,-0.882846f,-0.882801f,-0.882756f,-0.882711f,-0.882666f,-0.882621f,-0.882576f,-0.882531f,-0.882486f,-0.88244f,-0.882395f,-0.88235f,-0.882305f,-0.88226f,-0.882215f,-0.88217f,-0.882124f,-0.882079f,-0.882034f,-0.881989f,-0.881944f,-0.881899f,-0.881853f,-0.881808f,-0.881763f,-0.881718f,-0.881673f,-0.881627f,-0.881582f,-0.881537f,-0.881492f,-0.881446f,-0.881401f,-0.881356f,-0.88131f,-0.881265f,-0.88122f,-0.881174f,-0.881129f,-0.881084f,-0.881038f,-0.880993f,-0.880948f,-0.880902f,-0.880857f,-0.880812f,-0.880766f,-0.880721f,-0.880675f,-0.88063f,-0.880584f,-0.880539f,-0.880494f,-0.880448f,-0.880403f,-0.880357f,-0.880312f,-0.880266f,-0.880221f,-0.880175f,-0.88013f,-0.880084f,-0.880039f,-0.879993f,-0.879947f,-0.879902f,-0.879856f,-0.879811f,-0.879765f,-0.87972f,-0.879674f,-0.879629f,-0.879583f,-0.879537f,-0.879492f,-0.879446f,-0.8794f,-0.879355f,-0.879309f,-0.879264f,-0.879218f,-0.879172f,-0.879126f,-0.879081f,-0.879035f,-0.878989f,-0.878944f,-0.878898f,-0.878852f,-0.878806f,-0.878761f,-0.878715f,-0.878669f,-0.878623f,-0.878578f,-0.878532f,-0.878486f,-0.87844f,-0.878394f,-0.878348f,-0.878303f,-0.878257f,-0.878211f,-0.878165f,-0.878119f,-0.878073f,-0.878027f,-0.877982f,-0.877936f,-0.87789f,-0.877844f,-0.877798f,-0.877752f,-0.877706f,-0.87766f,-0.877614f,-0.877568f,-0.877522f,-0.877476f,-0.87743f,-0.877384f,-0.877338f,-0.877292f,-0.877246f,-0.8772f,-0.877154f,-0.877108f,-0.877062f,-0.877016f,-0.87697f,-0.876924f,-0.876878f,-0.876832f,-0.876786f,-0.876739f,-0.876693f,-0.876647f,-0.876601f,-0.876555f,-0.876509f,-0.876463f,-0.876417f,-0.87637f,-0.876324f,-0.876278f,-0.876232f,-0.876185f,-0.876139f,-0.876093f,-0.876047f,-0.876001f,-0.875954f,-0.875908f,-0.875862f,-0.875816f,-0.875769f,-0.875723f,-0.875677f,-0.875631f,-0.875584f,-0.875538f,-0.875491f,-0.875445f,-0.875399f,-0.875352f,-0.875306f,-0.87526f,-0.875213f,-0.875167f,-0.875121f,-0.875074f,-0.875028f,-0.874981f,-0.874935f,-0.874889f,-0.874842f,-0.874796f,-0.874749f,-0.874703f,-0.874656f,-0.87461f,-0.874563f,-0.874517f,-0.87447f,-0.874424f,-0.874377f,-0.874331f,-0.874284f,-0.874238f,-0.874191f,-0.874145f,-0.874098f,-0.874052f,-0.874005f,-0.873958f,-0.873912f,-0.873865f,-0.873818f,-0.873772f,-0.873725f,-0.873679f,-0.873632f,-0.873585f,-0.873539f,-0.873492f,-0.873445f,-0.873399f,-0.873352f,-0.873305f,-0.873258f,-0.873212f,-0.873165f,-0.873118f,-0.873071f,-0.873025f,-0.872978f,-0.872931f,-0.872885f,-0.872838f,-0.872791f,-0.872744f,-0.872697f,-0.872651f,-0.872604f,-0.872557f,-0.87251f,-0.872463f,-0.872416f,-0.872369f,-0.872322f,-0.872276f,-0.872229f,-0.872182f,-0.872135f,-0.872088f,-0.872041f,-0.871994f,-0.871947f,-0.8719f,-0.871853f,-0.871807f,-0.871759f,-0.871712f,-0.871665f,-0.871618f,-0.871571f,-0.871524f,-0.871477f,-0.87143f,-0.871383f,-0.871336f,-0.871289f,-0.871242f,-0.871195f,-0.871148f,-0.871101f,-0.871054f,-0.871007f,-0.87096f,-0.870913f,-0.870865f,-0.870818f,-0.870771f,-0.870724f,-0.870677f,-0.87063f,-0.870583f,-0.870535f,-0.870488f,-0.870441f,-0.870394f,-0.870347f,-0.8703f,-0.870252f,-0.870205f,-0.870158f,-0.87011f,-0.870063f,-0.870016f,-0.869969f,-0.869921f,-0.869874f,-0.869827f,-0.86978f,-0.869732f,-0.869685f,-0.869638f,-0.86959f,-0.869543f,-0.869496f,-0.869448f,-0.869401f,-0.869353f,-0.869306f,-0.869259f,-0.869211f,-0.869164f,-0.869116f,-0.869069f,-0.869022f,-0.868974f,-0.868927f,-0.868879f,-0.868832f,-0.868784f,-0.868737f,-0.868689f,-0.868642f,-0.868594f,-0.868547f,-0.868499f,-0.868452f,-0.868404f,-0.868357f,-0.868309f,-0.868262f,-0.868214f,-0.868167f,-0.868119f,-0.868071f,-0.868024f,-0.867976f,-0.867928f,-0.867881f,-0.867833f,-0.867786f,-0.867738f,-0.86769f,-0.867643f,-0.867595f,-0.867547f,-0.8675f,-0.867452f,-0.867404f,-0.867357f,-0.867309f,-0.867261f,-0.867213f,-0.867165f,-0.867118f,-0.86707f,-0.867022f,-0.866974f,-0.866927f,-0.866879f,-0.866831f,-0.866783f,-0.866736f,-0.866688f,-0.86664f,-0.866592f,-0.866544f,-0.866496f,-0.866449f,-0.8664f,-0.866353f,-0.866305f,-0.866257f,-0.866209f,-0.866161f,-0.866113f,-0.866065f,-0.866017f,-0.865969f,-0.865921f,-0.865874f,-0.865826f,-0.865778f,-0.86573f,-0.865682f,-0.865633f,-0.865585f,-0.865537f,-0.865489f,-0.865441f,-0.865393f,-0.865345f,-0.865297f,-0.865249f,-0.865201f,-0.865153f,-0.865105f,-0.865057f,-0.865009f,-0.864961f,-0.864913f,-0.864865f,-0.864816f,-0.864768f,-0.86472f,-0.864672f,-0.864624f,-0.864576f,-0.864527f,-0.864479f,-0.864431f,-0.864383f,-0.864335f,-0.864286f,-0.864238f,-0.86419f,-0.864142f,-0.864094f,-0.864045f,-0.863997f,-0.863949f,-0.8639f,-0.863852f,-0.863804f,-0.863755f,-0.863707f,-0.863659f,-0.863611f,-0.863562f,-0.863514f,-0.863465f,-0.863417f,-0.863369f,-0.86332f,-0.863272f,-0.863223f,-0.863175f,-0.863127f,-0.863078f,-0.86303f,-0.862981f,-0.862933f,-0.862885f,-0.862836f,-0.862788f,-0.862739f,-0.862691f,-0.862642f,-0.862594f,-0.862545f,-0.862497f,-0.862448f,-0.8624f,-0.862351f,-0.862302f,-0.862254f,-0.862205f,-0.862157f,-0.862108f,-0.86206f,-0.862011f,-0.861963f,-0.861914f,-0.861865f,-0.861817f,-0.861768f,-0.861719f,-0.861671f,-0.861622f,-0.861573f,-0.861525f,-0.861476f,-0.861427f,-0.861379f,-0.86133f,-0.861281f,-0.861233f,-0.861184f,-0.861135f,-0.861086f,-0.861038f,-0.860989f,-0.86094f,-0.860891f,-0.860842f,-0.860794f,-0.860745f,-0.860696f,-0.860647f,-0.860598f,-0.86055f,-0.860501f,-0.860452f,-0.860403f,-0.860354f,-0.860305f,-0.860257f,-0.860208f,-0.860159f,-0.86011f,-0.860061f,-0.860012f,-0.859963f,-0.859914f,-0.859865f,-0.859816f,-0.859767f,-0.859718f,-0.859669f,-0.85962f,-0.859571f,-0.859522f,-0.859473f,-0.859424f,-0.859375f,-0.859326f,-0.859277f,-0.859228f,-0.859179f,-0.85913f,-0.859081f,-0.859032f,-0.858983f,-0.858934f,-0.858885f,-0.858836f,-0.858786f,-0.858737f,-0.858688f,-0.858639f,-0.85859f,-0.858541f,-0.858491f,-0.858442f,-0.858393f,-0.858344f,-0.858295f,-0.858246f,-0.858196f,-0.858147f,-0.858098f,-0.858049f,-0.858f,-0.85795f,-0.857901f,-0.857852f,-0.857803f,-0.857753f,-0.857704f,-0.857655f,-0.857605f,-0.857556f,-0.857507f,-0.857457f,-0.857408f,-0.857359f,-0.857309f,-0.85726f,-0.857211f,-0.857161f,-0.857112f,-0.857063f,-0.857013f,-0.856964f,-0.856914f,-0.856865f,-0.856815f,-0.856766f,-0.856716f,-0.856667f,-0.856618f,-0.856568f,-0.856519f,-0.856469f,-0.85642f,-0.85637f,-0.856321f,-0.856271f,-0.856222f,-0.856172f,-0.856122f,-0.856073f,-0.856023f,-0.855974f,-0.855924f,-0.855875f,-0.855825f,-0.855775f,-0.855726f,-0.855676f,-0.855627f,-0.855577f,-0.855527f,-0.855478f,-0.855428f,-0.855378f,-0.855329f,-0.855279f,-0.855229f,-0.85518f,-0.85513f,-0.85508f,-0.855031f,-0.854981f,-0.854931f,-0.854881f,-0.854832f,-0.854782f,-0.854732f,-0.854682f,-0.854633f,-0.854583f,-0.854533f,-0.854483f,-0.854433f,-0.854384f,-0.854334f,-0.854284f,-0.854234f,-0.854184f,-0.854134f,-0.854085f,-0.854035f,-0.853985f,-0.853935f,-0.853885f,-0.853835f,-0.853785f,-0.853735f,-0.853685f,-0.853635f,-0.853585f,-0.853535f,-0.853486f,-0.853436f,-0.853386f,-0.853336f,-0.853286f,-0.853236f,-0.853186f,-0.853136f,-0.853086f,-0.853036f,-0.852986f,-0.852935f,-0.852885f,-0.852835f,-0.852785f,-0.852735f,-0.852685f,-0.852635f,-0.852585f,-0.852535f,-0.852485f,-0.852435f,-0.852385f,-0.852334f,-0.852284f,-0.852234f,-0.852184f,-0.852134f,-0.852083f,-0.852033f,-0.851983f,-0.851933f,-0.851883f,-0.851833f,-0.851782f,-0.851732f,-0.851682f,-0.851632f,-0.851581f,-0.851531f,-0.851481f,-0.851431f,-0.85138f,-0.85133f,-0.85128f,-0.851229f,-0.851179f,-0.851129f,-0.851078f,-0.851028f,-0.850978f,-0.850927f,-0.850877f,-0.850827f,-0.850776f,-0.850726f,-0.850676f,-0.850625f,-0.850575f,-0.850524f,-0.850474f,-0.850423f,-0.850373f,-0.850322f,-0.850272f,-0.850221f,-0.850171f,-0.850121f,-0.85007f,-0.85002f,-0.849969f,-0.849919f,-0.849868f,-0.849818f,-0.849767f,-0.849716f,-0.849666f,-0.849615f,-0.849565f,-0.849514f,-0.849464f,-0.849413f,-0.849362f,-0.849312f,-0.849261f,-0.849211f,-0.84916f,-0.849109f,-0.849059f,-0.849008f,-0.848957f,-0.848907f,-0.848856f,-0.848805f,-0.848755f,-0.848704f,-0.848653f,-0.848602f,-0.848552f,-0.848501f,-0.84845f,-0.8484f,-0.848349f,-0.848298f,-0.848247f,-0.848197f,-0.848146f,-0.848095f,-0.848044f,-0.847993f,-0.847942f,-0.847892f,-0.847841f,-0.84779f,-0.847739f,-0.847688f,-0.847637f,-0.847587f,-0.847536f,-0.847485f,-0.847434f,-0.847383f,-0.847332f,-0.847281f,-0.84723f,-0.847179f,-0.847128f,-0.847077f,-0.847026f,-0.846975f,-0.846924f,-0.846873f,-0.846823f,-0.846772f,-0.846721f,-0.846669f,-0.846619f,-0.846568f,-0.846516f,-0.846465f,-0.846414f,-0.846363f,-0.846312f,-0.846261f,-0.84621f,-0.846159f,-0.846108f,-0.846057f,-0.846006f,-0.845954f,-0.845903f,-0.845852f,-0.845801f,-0.84575f,-0.845699f,-0.845648f,-0.845596f,-0.845545f,-0.845494f,-0.845443f,-0.845392f,-0.84534f,-0.845289f,-0.845238f,-0.845187f,-0.845136f,-0.845084f,-0.845033f,-0.844982f,-0.844931f,-0.844879f,-0.844828f,-0.844776f,-0.844725f,-0.844674f,-0.844622f,-0.844571f,-0.84452f,-0.844469f,-0.844417f,-0.844366f,-0.844315f,-0.844263f,-0.844212f,-0.84416f,-0.844109f,-0.844058f,-0.844006f,-0.843955f,-0.843903f,-0.843852f,-0.8438f,-0.843749f,-0.843697f,-0.843646f,-0.843594f,-0.843543f,-0.843492f,-0.84344f,-0.843389f,-0.843337f,-0.843286f,-0.843234f,-0.843183f,-0.843131f,-0.843079f,-0.843028f,-0.842976f,-0.842925f,-0.842873f,-0.842821f,-0.84277f,-0.842718f,-0.842667f,-0.842615f,-0.842563f,-0.842512f,-0.84246f,-0.842408f,-0.842357f,-0.842305f,-0.842253f,-0.842202f,-0.84215f,-0.842098f,-0.842046f,-0.841995f,-0.841943f,-0.841891f,-0.84184f,-0.841788f,-0.841736f,-0.841684f,-0.841633f,-0.841581f,-0.841529f,-0.841477f,-0.841425f,-0.841374f,-0.841322f,-0.84127f,-0.841218f,-0.841166f,-0.841114f,-0.841063f,-0.841011f,-0.840959f,-0.840907f,-0.840855f,-0.840803f,-0.840751f,-0.840699f,-0.840648f,-0.840595f,-0.840543f,-0.840492f,-0.84044f,-0.840388f,-0.840336f,-0.840284f,-0.840232f,-0.84018f,-0.840128f,-0.840076f,-0.840024f,-0.839972f,-0.83992f,-0.839868f,-0.839816f,-0.839763f,-0.839711f,-0.839659f,-0.839607f,-0.839555f,-0.839503f,-0.839451f,-0.839399f,-0.839347f,-0.839295f,-0.839243f,-0.839191f,-0.839138f,-0.839086f,-0.839034f,-0.838982f,-0.83893f,-0.838877f,-0.838825f,-0.838773f,-0.838721f,-0.838669f,-0.838616f,-0.838564f,-0.838512f,-0.83846f,-0.838408f,-0.838355f,-0.838303f,-0.838251f,-0.838199f,-0.838146f,-0.838094f,-0.838041f,-0.837989f,-0.837937f,-0.837885f,-0.837832f,-0.83778f,-0.837728f,-0.837675f,-0.837623f,-0.837571f,-0.837518f,-0.837466f,-0.837413f,-0.837361f,-0.837309f,-0.837256f,-0.837204f,-0.837151f,-0.837099f,-0.837046f,-0.836994f,-0.836941f,-0.836889f,-0.836836f,-0.836784f,-0.836731f,-0.836679f,-0.836626f,-0.836574f,-0.836522f,-0.836469f,-0.836416f,-0.836364f,-0.836311f,-0.836259f,-0.836206f,-0.836153f,-0.836101f,-0.836048f,-0.835996f,-0.835943f,-0.83589f,-0.835838f,-0.835785f,-0.835733f,-0.83568f,-0.835627f,-0.835575f,-0.835522f,-0.835469f,-0.835416f,-0.835364f,-0.835311f,-0.835258f,-0.835206f,-0.835153f,-0.8351f,-0.835047f,-0.834995f,-0.834942f,-0.834889f,-0.834836f,-0.834784f,-0.834731f,-0.834678f,-0.834625f,-0.834572f,-0.83452f,-0.834467f,-0.834414f,-0.834361f,-0.834308f,-0.834255f,-0.834203f,-0.83415f,-0.834097f,-0.834044f,-0.833991f,-0.833938f,-0.833885f,-0.833832f,-0.833779f,-0.833726f,-0.833673f,-0.83362f,-0.833568f,-0.833515f,-0.833462f,-0.833409f,-0.833356f,-0.833303f,-0.83325f,-0.833197f,-0.833144f,-0.833091f,-0.833038f,-0.832984f,-0.832931f,-0.832878f,-0.832825f,-0.832772f,-0.832719f,-0.832666f,-0.832613f,-0.83256f,-0.832507f,-0.832454f,-0.832401f,-0.832347f,-0.832294f,-0.832241f,-0.832188f,-0.832135f,-0.832081f,-0.832028f,-0.831975f,-0.831922f,-0.831869f,-0.831816f,-0.831762f,-0.831709f,-0.831656f,-0.831603f,-0.831549f,-0.831496f,-0.831443f,-0.83139f,-0.831336f,-0.831283f,-0.83123f,-0.831176f,-0.831123f,-0.83107f,-0.831016f,-0.830963f,-0.83091f,-0.830857f,-0.830803f,-0.83075f,-0.830696f,-0.830643f,-0.83059f,-0.830536f,-0.830483f,-0.83043f,-0.830376f,-0.830322f,-0.830269f,-0.830216f,-0.830162f,-0.830109f,-0.830055f,-0.830002f,-0.829948f,-0.829895f,-0.829841f,-0.829788f,-0.829734f,-0.829681f,-0.829627f,-0.829574f,-0.82952f,-0.829467f,-0.829413f,-0.82936f,-0.829306f,-0.829252f,-0.829199f,-0.829145f,-0.829092f,-0.829038f,-0.828984f,-0.828931f,-0.828877f,-0.828824f,-0.82877f,-0.828716f,-0.828663f,-0.828609f,-0.828555f,-0.828502f,-0.828448f,-0.828394f,-0.82834f,-0.828287f,-0.828233f,-0.828179f,-0.828126f,-0.828072f,-0.828018f,-0.827964f,-0.827911f,-0.827857f,-0.827803f,-0.827749f,-0.827695f,-0.827642f,-0.827588f,-0.827534f,-0.82748f,-0.827426f,-0.827372f,-0.827319f,-0.827265f,-0.827211f,-0.827157f,-0.827103f,-0.827049f,-0.826995f,-0.826941f,-0.826887f,-0.826833f,-0.82678f,-0.826726f,-0.826672f,-0.826618f,-0.826564f,-0.82651f,-0.826456f,-0.826402f,-0.826348f,-0.826294f,-0.82624f,-0.826186f,-0.826132f,-0.826078f,-0.826024f,-0.82597f,-0.825916f,-0.825862f,-0.825808f,-0.825754f,-0.8257f,-0.825645f,-0.825591f,-0.825537f,-0.825483f,-0.825429f,-0.825375f,-0.825321f,-0.825267f,-0.825213f,-0.825158f,-0.825104f,-0.82505f,-0.824996f,-0.824942f,-0.824887f,-0.824833f,-0.824779f,-0.824725f,-0.824671f,-0.824616f,-0.824562f,-0.824508f,-0.824454f,-0.824399f,-0.824345f,-0.824291f,-0.824236f,-0.824182f,-0.824128f,-0.824074f,-0.824019f,-0.823965f,-0.823911f,-0.823856f,-0.823802f,-0.823748f,-0.823693f,-0.823639f,-0.823585f,-0.82353f,-0.823476f,-0.823421f,-0.823367f,-0.823312f,-0.823258f,-0.823204f,-0.823149f,-0.823095f,-0.82304f,-0.822986f,-0.822931f,-0.822877f,-0.822823f,-0.822768f,-0.822714f,-0.822659f,-0.822605f,-0.82255f,-0.822495f,-0.822441f,-0.822386f,-0.822332f,-0.822277f,-0.822223f,-0.822168f,-0.822114f,-0.822059f,-0.822004f,-0.82195f,-0.821895f,-0.821841f,-0.821786f,-0.821731f,-0.821676f,-0.821622f,-0.821567f,-0.821513f,-0.821458f,-0.821403f,-0.821349f,-0.821294f,-0.821239f,-0.821185f,-0.82113f,-0.821075f,-0.82102f,-0.820966f,-0.820911f,-0.820856f,-0.820801f,-0.820746f,-0.820692f,-0.820637f,-0.820582f,-0.820527f,-0.820473f,-0.820418f,-0.820363f,-0.820308f,-0.820253f,-0.820199f,-0.820144f,-0.820089f,-0.820034f,-0.819979f,-0.819924f,-0.819869f,-0.819814f,-0.819759f,-0.819704f,-0.81965f,-0.819595f,-0.81954f,-0.819485f,-0.81943f,-0.819375f,-0.81932f,-0.819265f,-0.81921f,-0.819155f,-0.8191f,-0.819045f,-0.81899f,-0.818935f,-0.81888f,-0.818825f,-0.81877f,-0.818715f,-0.81866f,-0.818605f,-0.81855f,-0.818495f,-0.81844f,-0.818384f,-0.818329f,-0.818274f,-0.818219f,-0.818164f,-0.818109f,-0.818054f,-0.817998f,-0.817943f,-0.817888f,-0.817833f,-0.817778f,-0.817723f,-0.817668f,-0.817612f,-0.817557f,-0.817502f,-0.817447f,-0.817392f,-0.817336f,-0.817281f,-0.817226f,-0.81717f,-0.817115f,-0.81706f,-0.817005f,-0.816949f,-0.816894f,-0.816839f,-0.816783f,-0.816728f,-0.816673f,-0.816618f,-0.816562f,-0.816507f,-0.816452f,-0.816396f,-0.816341f,-0.816285f,-0.81623f,-0.816175f,-0.816119f,-0.816064f,-0.816008f,-0.815953f,-0.815897f,-0.815842f,-0.815787f,-0.815731f,-0.815676f,-0.81562f,-0.815565f,-0.815509f,-0.815454f,-0.815398f,-0.815343f,-0.815287f,-0.815232f,-0.815176f,-0.815121f,-0.815065f,-0.81501f,-0.814954f,-0.814898f,-0.814843f,-0.814787f,-0.814732f,-0.814676f,-0.814621f,-0.814565f,-0.814509f,-0.814454f,-0.814398f,-0.814342f,-0.814287f,-0.814231f,-0.814175f,-0.81412f,-0.814064f,-0.814008f,-0.813953f,-0.813897f,-0.813841f,-0.813786f,-0.81373f,-0.813674f,-0.813618f,-0.813563f,-0.813507f,-0.813451f,-0.813395f,-0.81334f,-0.813284f,-0.813228f,-0.813172f,-0.813116f,-0.813061f,-0.813005f,-0.812949f,-0.812893f,-0.812837f,-0.812782f,-0.812725f,-0.81267f,-0.812614f,-0.812558f,-0.812502f,-0.812446f,-0.81239f,-0.812334f,-0.812278f,-0.812223f,-0.812167f,-0.812111f,-0.812055f,-0.811999f,-0.811943f,-0.811887f,-0.811831f,-0.811775f,-0.811719f,-0.811663f,-0.811607f,-0.811551f,-0.811495f,-0.811439f,-0.811383f,-0.811327f,-0.811271f,-0.811215f,-0.811159f,-0.811103f,-0.811047f,-0.81099f,-0.810934f,-0.810878f,-0.810822f,-0.810766f,-0.81071f,-0.810654f,-0.810597f,-0.810541f,-0.810485f,-0.810429f,-0.810373f,-0.810317f,-0.810261f,-0.810204f,-0.810148f,-0.810092f,-0.810036f,-0.809979f,-0.809923f,-0.809867f,-0.809811f,-0.809754f,-0.809698f,-0.809642f,-0.809586f,-0.809529f,-0.809473f,-0.809417f,-0.809361f,-0.809304f,-0.809248f,-0.809192f,-0.809135f,-0.809079f,-0.809022f,-0.808966f,-0.80891f,-0.808853f,-0.808797f,-0.808741f,-0.808684f,-0.808628f,-0.808572f,-0.808515f,-0.808459f,-0.808402f,-0.808346f,-0.808289f,-0.808233f,-0.808176f,-0.80812f,-0.808063f,-0.808007f,-0.80795f,-0.807894f,-0.807837f,-0.807781f,-0.807724f,-0.807668f,-0.807611f,-0.807555f,-0.807498f,-0.807442f,-0.807385f,-0.807328f,-0.807272f,-0.807215f,-0.807159f,-0.807102f,-0.807046f,-0.806989f,-0.806932f,-0.806876f,-0.806819f,-0.806763f,-0.806706f,-0.806649f,-0.806593f,-0.806536f,-0.806479f,-0.806423f,-0.806366f,-0.806309f,-0.806252f,-0.806196f,-0.806139f,-0.806082f,-0.806025f,-0.805969f,-0.805912f,-0.805855f,-0.805798f,-0.805742f,-0.805685f,-0.805628f,-0.805571f,-0.805515f,-0.805457f,-0.805401f,-0.805344f,-0.805287f,-0.80523f,-0.805173f,-0.805117f,-0.80506f,-0.805003f,-0.804946f,-0.804889f,-0.804832f,-0.804775f,-0.804718f,-0.804662f,-0.804605f,-0.804547f,-0.804491f,-0.804434f,-0.804377f,-0.80432f,-0.804263f,-0.804206f,-0.804149f,-0.804092f,-0.804035f,-0.803978f,-0.803921f,-0.803864f,-0.803807f,-0.80375f,-0.803693f,-0.803635f,-0.803578f,-0.803521f,-0.803464f,-0.803407f,-0.80335f,-0.803293f,-0.803236f,-0.803179f,-0.803122f,-0.803065f,-0.803008f,-0.80295f,-0.802893f,-0.802836f,-0.802779f,-0.802722f,-0.802664f,-0.802607f,-0.80255f,-0.802493f,-0.802436f,-0.802379f,-0.802321f,-0.802264f,-0.802207f,-0.80215f,-0.802092f,-0.802035f,-0.801978f,-0.801921f,-0.801863f,-0.801806f,-0.801749f,-0.801691f,-0.801634f,-0.801577f,-0.801519f,-0.801462f,-0.801405f,-0.801347f,-0.80129f,-0.801233f,-0.801175f,-0.801118f,-0.801061f,-0.801003f,-0.800946f,-0.800888f,-0.800831f,-0.800773f,-0.800716f,-0.800659f,-0.800601f,-0.800544f,-0.800486f,-0.800429f,-0.800371f,-0.800314f,-0.800256f,-0.800199f,-0.800142f,-0.800084f,-0.800026f,-0.799969f,-0.799911f,-0.799854f,-0.799796f,-0.799739f,-0.799681f,-0.799623f,-0.799566f,-0.799508f,-0.799451f,-0.799393f,-0.799336f,-0.799278f,-0.79922f,-0.799163f,-0.799105f,-0.799048f,-0.79899f,-0.798932f,-0.798874f,-0.798817f,-0.798759f,-0.798701f,-0.798644f,-0.798586f,-0.798528f,-0.798471f,-0.798413f,-0.798355f,-0.798298f,-0.79824f,-0.798182f,-0.798124f,-0.798066f,-0.798009f,-0.797951f,-0.797893f,-0.797835f,-0.797777f,-0.79772f,-0.797662f,-0.797604f,-0.797546f,-0.797488f,-0.797431f,-0.797373f,-0.797315f,-0.797257f,-0.797199f,-0.797141f,-0.797083f,-0.797025f,-0.796967f,-0.796909f,-0.796852f,-0.796794f,-0.796736f,-0.796678f,-0.79662f,-0.796562f,-0.796504f,-0.796446f,-0.796388f,-0.79633f,-0.796272f,-0.796214f,-0.796156f,-0.796098f,-0.79604f,-0.795982f,-0.795924f,-0.795866f,-0.795808f,-0.79575f,-0.795692f,-0.795634f,-0.795576f,-0.795518f,-0.795459f,-0.795401f,-0.795343f,-0.795285f,-0.795227f,-0.795169f,-0.795111f,-0.795052f,-0.794994f,-0.794936f,-0.794878f,-0.79482f,-0.794762f,-0.794703f,-0.794645f,-0.794587f,-0.794529f,-0.794471f,-0.794412f,-0.794354f,-0.794296f,-0.794237f,-0.794179f,-0.794121f,-0.794063f,-0.794004f,-0.793946f,-0.793888f,-0.79383f,-0.793771f,-0.793713f,-0.793655f,-0.793596f,-0.793538f,-0.79348f,-0.793422f,-0.793363f,-0.793305f,-0.793246f,-0.793188f,-0.793129f,-0.793071f,-0.793013f,-0.792954f,-0.792896f,-0.792837f,-0.792779f,-0.792721f,-0.792662f,-0.792604f,-0.792545f,-0.792487f,-0.792428f,-0.79237f,-0.792311f,-0.792253f,-0.792194f,-0.792136f,-0.792077f,-0.792019f,-0.79196f,-0.791902f,-0.791843f,-0.791785f,-0.791726f,-0.791667f,-0.791609f,-0.79155f,-0.791492f,-0.791433f,-0.791374f,-0.791316f,-0.791257f,-0.791198f,-0.79114f,-0.791081f,-0.791023f,-0.790964f,-0.790905f,-0.790847f,-0.790788f,-0.790729f,-0.790671f,-0.790612f,-0.790553f,-0.790494f,-0.790436f,-0.790377f,-0.790318f,-0.790259f,-0.790201f,-0.790142f,-0.790083f,-0.790024f,-0.789966f,-0.789907f,-0.789848f,-0.789789f,-0.789731f,-0.789672f,-0.789613f,-0.789554f,-0.789495f,-0.789436f,-0.789377f,-0.789319f,-0.78926f,-0.789201f,-0.789142f,-0.789083f,-0.789024f,-0.788965f,-0.788906f,-0.788848f,-0.788789f,-0.78873f,-0.78867f,-0.788612f,-0.788553f,-0.788494f,-0.788435f,-0.788376f,-0.788317f,-0.788258f,-0.788199f,-0.78814f,-0.788081f,-0.788022f,-0.787963f,-0.787904f,-0.787845f,-0.787786f,-0.787727f,-0.787667f,-0.787608f,-0.787549f,-0.78749f,-0.787431f,-0.787372f,-0.787313f,-0.787254f,-0.787195f,-0.787136f,-0.787077f,-0.787017f,-0.786958f,-0.786899f,-0.78684f,-0.786781f,-0.786721f,-0.786662f,-0.786603f,-0.786544f,-0.786485f,-0.786425f,-0.786366f,-0.786307f,-0.786248f,-0.786189f,-0.786129f,-0.78607f,-0.786011f,-0.785952f,-0.785892f,-0.785833f,-0.785774f,-0.785714f,-0.785655f,-0.785596f,-0.785536f,-0.785477f,-0.785418f,-0.785358f,-0.785299f,-0.78524f,-0.78518f,-0.785121f,-0.785062f,-0.785002f,-0.784943f,-0.784883f,-0.784824f,-0.784764f,-0.784705f,-0.784646f,-0.784586f,-0.784527f,-0.784467f,-0.784408f,-0.784348f,-0.784289f,-0.784229f,-0.78417f,-0.784111f,-0.784051f,-0.783992f,-0.783932f,-0.783872f,-0.783813f,-0.783753f,-0.783694f,-0.783634f,-0.783575f,-0.783515f,-0.783455f,-0.783396f,-0.783336f,-0.783277f,-0.783217f,-0.783158f,-0.783098f,-0.783038f,-0.782979f,-0.782919f,-0.782859f,-0.7828f,-0.78274f,-0.78268f,-0.782621f,-0.782561f,-0.782501f,-0.782442f,-0.782382f,-0.782322f,-0.782263f,-0.782203f,-0.782143f,-0.782083f,-0.782024f,-0.781964f,-0.781904f,-0.781844f,-0.781784f,-0.781725f,-0.781665f,-0.781605f,-0.781545f,-0.781485f,-0.781426f,-0.781366f,-0.781306f,-0.781246f,-0.781186f,-0.781126f,-0.781067f,-0.781007f,-0.780947f,-0.780887f,-0.780827f,-0.780767f,-0.780707f,-0.780647f,-0.780587f,-0.780527f,-0.780468f,-0.780408f,-0.780348f,-0.780288f,-0.780228f,-0.780168f,-0.780108f,-0.780048f,-0.779988f,-0.779928f,-0.779868f,-0.779808f,-0.779748f,-0.779688f,-0.779628f,-0.779568f,-0.779508f,-0.779447f,-0.779387f,-0.779327f,-0.779267f,-0.779207f,-0.779147f,-0.779087f,-0.779027f,-0.778967f,-0.778907f,-0.778846f,-0.778786f,-0.778726f,-0.778666f,-0.778606f,-0.778546f,-0.778486f,-0.778425f,-0.778365f,-0.778305f,-0.778245f,-0.778185f,-0.778125f,-0.778064f,-0.778004f,-0.777944f,-0.777883f,-0.777823f,-0.777763f,-0.777703f,-0.777642f,-0.777582f,-0.777522f,-0.777462f,-0.777401f,-0.777341f,-0.777281f,-0.77722f,-0.77716f,-0.777099f,-0.777039f,-0.776979f,-0.776918f,-0.776858f,-0.776798f,-0.776737f,-0.776677f,-0.776617f,-0.776556f,-0.776496f,-0.776435f,-0.776375f,-0.776315f,-0.776254f,-0.776194f,-0.776133f,-0.776073f,-0.776012f,-0.775952f,-0.775891f,-0.775831f,-0.77577f,-0.77571f,-0.775649f,-0.775589f,-0.775528f,-0.775468f,-0.775407f,-0.775347f,-0.775286f,-0.775226f,-0.775165f,-0.775104f,-0.775044f,-0.774983f,-0.774923f,-0.774862f,-0.774801f,-0.774741f,-0.77468f,-0.77462f,-0.774559f,-0.774498f,-0.774438f,-0.774377f,-0.774316f,-0.774256f,-0.774195f,-0.774134f,-0.774074f,-0.774013f,-0.773952f,-0.773891f,-0.773831f,-0.77377f,-0.773709f,-0.773649f,-0.773588f,-0.773527f,-0.773466f,-0.773406f,-0.773345f,-0.773284f,-0.773223f,-0.773162f,-0.773101f,-0.773041f,-0.77298f,-0.772919f,-0.772858f,-0.772797f,-0.772737f,-0.772676f,-0.772615f,-0.772554f,-0.772493f,-0.772432f,-0.772371f,-0.772311f,-0.77225f,-0.772188f,-0.772128f,-0.772067f,-0.772006f,-0.771945f,-0.771884f,-0.771823f,-0.771762f,-0.771701f,-0.77164f,-0.771579f,-0.771518f,-0.771457f,-0.771396f,-0.771335f,-0.771274f,-0.771213f,-0.771152f,-0.771091f,-0.77103f,-0.770969f,-0.770908f,-0.770847f,-0.770786f,-0.770725f,-0.770663f,-0.770602f,-0.770541f,-0.77048f,-0.770419f,-0.770358f,-0.770297f,-0.770235f,-0.770174f,-0.770113f,-0.770052f,-0.769991f,-0.76993f,-0.769869f,-0.769807f,-0.769746f,-0.769685f,-0.769624f,-0.769563f,-0.769501f,-0.76944f,-0.769379f,-0.769318f,-0.769256f,-0.769195f,-0.769134f,-0.769073f,-0.769011f,-0.76895f,-0.768889f,-0.768827f,-0.768766f,-0.768705f,-0.768643f,-0.768582f,-0.768521f,-0.76846f,-0.768398f,-0.768337f,-0.768275f,-0.768214f,-0.768153f,-0.768091f,-0.76803f,-0.767968f,-0.767907f,-0.767846f,-0.767784f,-0.767723f,-0.767661f,-0.7676f,-0.767538f,-0.767477f,-0.767416f,-0.767354f,-0.767293f,-0.767231f,-0.767169f,-0.767108f,-0.767046f,-0.766985f,-0.766923f,-0.766862f,-0.7668f,-0.766739f,-0.766677f,-0.766616f,-0.766554f,-0.766493f,-0.766431f,-0.76637f,-0.766308f,-0.766246f,-0.766185f,-0.766123f,-0.766061f,-0.766f,-0.765938f,-0.765877f,-0.765815f,-0.765753f,-0.765692f,-0.76563f,-0.765568f,-0.765507f,-0.765445f,-0.765383f,-0.765322f,-0.76526f,-0.765198f,-0.765136f,-0.765074f,-0.765013f,-0.764951f,-0.764889f,-0.764828f,-0.764766f,-0.764704f,-0.764642f,-0.76458f,-0.764519f,-0.764457f,-0.764395f,-0.764333f,-0.764271f,-0.764209f,-0.764148f,-0.764086f,-0.764024f,-0.763962f,-0.7639f,-0.763838f,-0.763777f,-0.763715f,-0.763653f,-0.763591f,-0.763529f,-0.763467f,-0.763405f,-0.763343f,-0.763281f,-0.763219f,-0.763157f,-0.763095f,-0.763033f,-0.762971f,-0.762909f,-0.762847f,-0.762785f,-0.762724f,-0.762662f,-0.7626f,-0.762538f,-0.762475f,-0.762414f,-0.762351f,-0.762289f,-0.762227f,-0.762165f,-0.762103f,-0.762041f,-0.761979f,-0.761917f,-0.761855f,-0.761793f,-0.761731f,-0.761668f,-0.761606f,-0.761544f,-0.761482f,-0.76142f,-0.761358f,-0.761295f,-0.761233f,-0.761171f,-0.761109f,-0.761047f,-0.760985f,-0.760922f,-0.76086f,-0.760798f,-0.760736f,-0.760674f,-0.760611f,-0.760549f,-0.760487f,-0.760425f,-0.760362f,-0.7603f,-0.760238f,-0.760175f,-0.760113f,-0.760051f,-0.759988f,-0.759926f,-0.759864f,-0.759802f,-0.759739f,-0.759677f,-0.759615f,-0.759552f,-0.75949f,-0.759428f,-0.759365f,-0.759303f,-0.75924f,-0.759178f,-0.759115f,-0.759053f,-0.758991f,-0.758928f,-0.758866f,-0.758803f,-0.758741f,-0.758678f,-0.758616f,-0.758554f,-0.758491f,-0.758429f,-0.758366f,-0.758304f,-0.758241f,-0.758178f,-0.758116f,-0.758053f,-0.757991f,-0.757928f,-0.757866f,-0.757803f,-0.757741f,-0.757678f,-0.757616f,-0.757553f,-0.757491f,-0.757428f,-0.757365f,-0.757303f,-0.75724f,-0.757177f,-0.757115f,-0.757052f,-0.756989f,-0.756927f,-0.756864f,-0.756802f,-0.756739f,-0.756676f,-0.756614f,-0.756551f,-0.756488f,-0.756426f,-0.756363f,-0.7563f,-0.756237f,-0.756174f,-0.756112f,-0.756049f,-0.755986f,-0.755923f,-0.755861f,-0.755798f,-0.755735f,-0.755672f,-0.75561f,-0.755547f,-0.755484f,-0.755421f,-0.755359f,-0.755296f,-0.755233f,-0.75517f,-0.755107f,-0.755044f,-0.754981f,-0.754918f,-0.754856f,-0.754793f,-0.75473f,-0.754667f,-0.754604f,-0.754541f,-0.754478f,-0.754415f,-0.754352f,-0.754289f,-0.754226f,-0.754163f,-0.7541f,-0.754037f,-0.753974f,-0.753911f,-0.753848f,-0.753785f,-0.753722f,-0.75366f,-0.753597f,-0.753534f,-0.75347f,-0.753407f,-0.753344f,-0.753281f,-0.753218f,-0.753155f,-0.753092f,-0.753029f,-0.752966f,-0.752903f,-0.75284f,-0.752777f,-0.752714f,-0.75265f,-0.752587f,-0.752524f,-0.752461f,-0.752398f,-0.752335f,-0.752272f,-0.752208f,-0.752145f,-0.752082f,-0.752019f,-0.751956f,-0.751892f,-0.751829f,-0.751766f,-0.751703f,-0.751639f,-0.751576f,-0.751513f,-0.75145f,-0.751387f,-0.751323f,-0.75126f,-0.751197f,-0.751133f,-0.75107f,-0.751007f,-0.750943f,-0.75088f,-0.750817f,-0.750753f,-0.75069f,-0.750627f,-0.750564f,-0.7505f,-0.750437f,-0.750373f,-0.75031f,-0.750247f,-0.750183f,-0.75012f,-0.750056f,-0.749993f,-0.74993f,-0.749866f,-0.749803f,-0.749739f,-0.749676f,-0.749612f,-0.749549f,-0.749486f,-0.749422f,-0.749359f,-0.749295f,-0.749232f,-0.749168f,-0.749104f,-0.749041f,-0.748977f,-0.748914f,-0.74885f,-0.748787f,-0.748723f,-0.74866f,-0.748596f,-0.748533f,-0.748469f,-0.748406f,-0.748342f,-0.748278f,-0.748215f,-0.748151f,-0.748087f,-0.748024f,-0.74796f,-0.747896f,-0.747833f,-0.747769f,-0.747706f,-0.747642f,-0.747578f,-0.747515f,-0.747451f,-0.747387f,-0.747324f,-0.74726f,-0.747196f,-0.747132f,-0.747069f,-0.747005f,-0.746941f,-0.746877f,-0.746814f,-0.74675f,-0.746686f,-0.746622f,-0.746559f,-0.746495f,-0.746431f,-0.746367f,-0.746303f,-0.74624f,-0.746176f,-0.746112f,-0.746048f,-0.745984f,-0.74592f,-0.745856f,-0.745793f,-0.745729f,-0.745665f,-0.745601f,-0.745537f,-0.745473f,-0.745409f,-0.745345f,-0.745282f,-0.745218f,-0.745154f,-0.74509f,-0.745026f,-0.744962f,-0.744898f,-0.744834f,-0.74477f,-0.744706f,-0.744642f,-0.744578f,-0.744514f,-0.74445f,-0.744386f,-0.744322f,-0.744258f,-0.744194f,-0.74413f,-0.744066f,-0.744002f,-0.743937f,-0.743873f,-0.743809f,-0.743745f,-0.743681f,-0.743617f,-0.743553f,-0.743489f,-0.743425f,-0.743361f,-0.743297f,-0.743232f,-0.743168f,-0.743104f,-0.74304f,-0.742976f,-0.742911f,-0.742847f,-0.742783f,-0.742719f,-0.742655f,-0.742591f,-0.742526f,-0.742462f,-0.742398f,-0.742334f,-0.74227f,-0.742205f,-0.742141f,-0.742077f,-0.742013f,-0.741948f,-0.741884f,-0.741819f,-0.741755f,-0.741691f,-0.741627f,-0.741562f,-0.741498f,-0.741434f,-0.741369f,-0.741305f,-0.741241f,-0.741176f,-0.741112f,-0.741048f,-0.740983f,-0.740919f,-0.740854f,-0.74079f,-0.740726f,-0.740661f,-0.740597f,-0.740532f,-0.740468f,-0.740403f,-0.740339f,-0.740275f,-0.74021f,-0.740146f,-0.740081f,-0.740017f,-0.739952f,-0.739888f,-0.739823f,-0.739759f,-0.739694f,-0.73963f,-0.739565f,-0.739501f,-0.739436f,-0.739372f,-0.739307f,-0.739242f,-0.739178f,-0.739113f,-0.739049f,-0.738984f,-0.73892f,-0.738855f,-0.73879f,-0.738726f,-0.738661f,-0.738596f,-0.738532f,-0.738467f,-0.738402f,-0.738338f,-0.738273f,-0.738209f,-0.738144f,-0.738079f,-0.738015f,-0.73795f,-0.737885f,-0.737821f,-0.737756f,-0.737691f,-0.737626f,-0.737561f,-0.737497f,-0.737432f,-0.737367f,-0.737302f,-0.737238f,-0.737173f,-0.737108f,-0.737043f,-0.736979f,-0.736914f,-0.736849f,-0.736784f,-0.736719f,-0.736654f,-0.736589f,-0.736525f,-0.73646f,-0.736395f,-0.73633f,-0.736265f,-0.7362f,-0.736135f,-0.736071f,-0.736006f,-0.735941f,-0.735876f,-0.735811f,-0.735746f,-0.735681f,-0.735616f,-0.735551f,-0.735486f,-0.735421f,-0.735356f,-0.735291f,-0.735226f,-0.735161f,-0.735096f,-0.735031f,-0.734966f,-0.734901f,-0.734836f,-0.734771f,-0.734706f,-0.734641f,-0.734576f,-0.734511f,-0.734446f,-0.734381f,-0.734316f,-0.734251f,-0.734186f,-0.734121f,-0.734056f,-0.73399f,-0.733925f,-0.73386f,-0.733795f,-0.73373f,-0.733665f,-0.7336f,-0.733534f,-0.733469f,-0.733404f,-0.733339f,-0.733274f,-0.733208f,-0.733143f,-0.733078f,-0.733013f,-0.732948f,-0.732883f,-0.732817f,-0.732752f,-0.732687f,-0.732622f,-0.732556f,-0.732491f,-0.732426f,-0.73236f,-0.732295f,-0.73223f,-0.732165f,-0.732099f,-0.732034f,-0.731969f,-0.731903f,-0.731838f,-0.731773f,-0.731707f,-0.731642f,-0.731577f,-0.731511f,-0.731446f,-0.73138f,-0.731315f,-0.73125f,-0.731184f,-0.731119f,-0.731053f,-0.730988f,-0.730923f,-0.730857f,-0.730792f,-0.730726f,-0.730661f,-0.730595f,-0.73053f,-0.730465f,-0.730399f,-0.730333f,-0.730268f,-0.730202f,-0.730137f,-0.730071f,-0.730006f,-0.72994f,-0.729875f,-0.729809f,-0.729744f,-0.729678f,-0.729613f,-0.729547f,-0.729482f,-0.729416f,-0.729351f,-0.729285f,-0.729219f,-0.729153f,-0.729088f,-0.729022f,-0.728957f,-0.728891f,-0.728825f,-0.72876f,-0.728694f,-0.728629f,-0.728563f,-0.728497f,-0.728432f,-0.728366f,-0.7283f,-0.728234f,-0.728168f,-0.728103f,-0.728037f,-0.727971f,-0.727906f,-0.72784f,-0.727774f,-0.727709f,-0.727643f,-0.727577f,-0.727511f,-0.727445f,-0.72738f,-0.727314f,-0.727248f,-0.727182f,-0.727116f,-0.72705f,-0.726985f,-0.726919f,-0.726853f,-0.726787f,-0.726721f,-0.726656f,-0.72659f,-0.726524f,-0.726458f,-0.726392f,-0.726326f,-0.72626f,-0.726194f,-0.726128f,-0.726062f,-0.725996f,-0.725931f,-0.725865f,-0.725799f,-0.725733f,-0.725667f,-0.725601f,-0.725535f,-0.725469f,-0.725403f,-0.725337f,-0.725271f,-0.725205f,-0.725139f,-0.725073f,-0.725007f,-0.724941f,-0.724875f,-0.724809f,-0.724743f,-0.724676f,-0.72461f,-0.724544f,-0.724478f,-0.724412f,-0.724346f,-0.72428f,-0.724214f,-0.724148f,-0.724082f,-0.724016f,-0.723949f,-0.723883f,-0.723817f,-0.723751f,-0.723685f,-0.723619f,-0.723552f,-0.723486f,-0.72342f,-0.723354f,-0.723288f,-0.723222f,-0.723155f,-0.723089f,-0.723023f,-0.722957f,-0.72289f,-0.722824f,-0.722758f,-0.722691f,-0.722625f,-0.722559f,-0.722493f,-0.722426f,-0.72236f,-0.722294f,-0.722228f,-0.722161f,-0.722095f,-0.722029f,-0.721962f,-0.721896f,-0.721829f,-0.721763f,-0.721697f,-0.72163f,-0.721564f,-0.721498f,-0.721431f,-0.721365f,-0.721299f,-0.721232f,-0.721166f,-0.721099f,-0.721033f,-0.720967f,-0.7209f,-0.720834f,-0.720767f,-0.720701f,-0.720634f,-0.720568f,-0.720501f,-0.720435f,-0.720368f,-0.720302f,-0.720235f,-0.720169f,-0.720102f,-0.720036f,-0.719969f,-0.719903f,-0.719836f,-0.71977f,-0.719703f,-0.719636f,-0.71957f,-0.719503f,-0.719437f,-0.71937f,-0.719303f,-0.719237f,-0.71917f,-0.719104f,-0.719037f,-0.71897f,-0.718904f,-0.718837f,-0.718771f,-0.718704f,-0.718637f,-0.71857f,-0.718504f,-0.718437f,-0.71837f,-0.718304f,-0.718237f,-0.71817f,-0.718104f,-0.718037f,-0.71797f,-0.717903f,-0.717837f,-0.71777f,-0.717703f,-0.717636f,-0.71757f,-0.717503f,-0.717436f,-0.717369f,-0.717302f,-0.717236f,-0.717169f,-0.717102f,-0.717035f,-0.716968f,-0.716901f,-0.716835f,-0.716768f,-0.716701f,-0.716634f,-0.716567f,-0.7165f,-0.716433f,-0.716366f,-0.716299f,-0.716233f,-0.716166f,-0.716099f,-0.716032f,-0.715965f,-0.715898f,-0.715831f,-0.715764f,-0.715697f,-0.71563f,-0.715563f,-0.715496f,-0.715429f,-0.715362f,-0.715295f,-0.715228f,-0.715161f,-0.715094f,-0.715027f,-0.71496f,-0.714893f,-0.714826f,-0.714759f,-0.714692f,-0.714625f,-0.714558f,-0.714491f,-0.714424f,-0.714357f,-0.714289f,-0.714222f,-0.714155f,-0.714088f,-0.714021f,-0.713954f,-0.713887f,-0.71382f,-0.713753f,-0.713686f,-0.713618f,-0.713551f,-0.713484f,-0.713417f,-0.71335f,-0.713283f,-0.713215f,-0.713148f,-0.713081f,-0.713014f,-0.712946f,-0.712879f,-0.712812f,-0.712745f,-0.712677f,-0.71261f,-0.712543f,-0.712476f,-0.712408f,-0.712341f,-0.712274f,-0.712207f,-0.712139f,-0.712072f,-0.712004f,-0.711937f,-0.71187f,-0.711802f,-0.711735f,-0.711668f,-0.7116f,-0.711533f,-0.711466f,-0.711398f,-0.711331f,-0.711264f,-0.711196f,-0.711129f,-0.711061f,-0.710994f,-0.710926f,-0.710859f,-0.710792f,-0.710724f,-0.710657f,-0.710589f,-0.710522f,-0.710454f,-0.710387f,-0.71032f,-0.710252f,-0.710185f,-0.710117f,-0.71005f,-0.709982f,-0.709914f,-0.709847f,-0.709779f,-0.709712f,-0.709644f,-0.709577f,-0.709509f,-0.709442f,-0.709374f,-0.709307f,-0.709239f,-0.709171f,-0.709104f,-0.709036f,-0.708969f,-0.708901f,-0.708833f,-0.708766f,-0.708698f,-0.70863f,-0.708563f,-0.708495f,-0.708427f,-0.70836f,-0.708292f,-0.708224f,-0.708157f,-0.708089f,-0.708021f,-0.707954f,-0.707886f,-0.707818f,-0.70775f,-0.707683f,-0.707615f,-0.707547f,-0.707479f,-0.707412f,-0.707344f,-0.707276f,-0.707208f,-0.707141f,-0.707073f,-0.707005f,-0.706937f,-0.706869f,-0.706802f,-0.706734f,-0.706666f,-0.706598f,-0.70653f,-0.706462f,-0.706394f,-0.706327f,-0.706259f,-0.706191f,-0.706123f,-0.706055f,-0.705987f,-0.705919f,-0.705851f,-0.705784f,-0.705716f,-0.705648f,-0.70558f,-0.705512f,-0.705444f,-0.705376f,-0.705308f,-0.70524f,-0.705172f,-0.705104f,-0.705036f,-0.704968f,-0.7049f,-0.704832f,-0.704764f,-0.704696f,-0.704628f,-0.70456f,-0.704492f,-0.704424f,-0.704356f,-0.704288f,-0.70422f,-0.704151f,-0.704083f,-0.704015f,-0.703947f,-0.703879f,-0.703811f,-0.703743f,-0.703675f,-0.703607f,-0.703539f,-0.703471f,-0.703402f,-0.703334f,-0.703266f,-0.703198f,-0.70313f,-0.703061f,-0.702993f,-0.702925f,-0.702857f,-0.702789f,-0.702721f,-0.702652f,-0.702584f,-0.702516f,-0.702448f,-0.70238f,-0.702311f,-0.702243f,-0.702174f,-0.702106f,-0.702038f,-0.70197f,-0.701901f,-0.701833f,-0.701765f,-0.701697f,-0.701628f,-0.70156f,-0.701492f,-0.701423f,-0.701355f,-0.701287f,-0.701218f,-0.70115f,-0.701081f,-0.701013f,-0.700945f,-0.700876f,-0.700808f,-0.70074f,-0.700671f,-0.700603f,-0.700535f,-0.700466f,-0.700398f,-0.700329f,-0.700261f,-0.700192f,-0.700124f,-0.700055f,-0.699987f,-0.699918f,-0.69985f,-0.699781f,-0.699713f,-0.699645f,-0.699576f,-0.699508f,-0.699439f,-0.699371f,-0.699302f,-0.699233f,-0.699165f,-0.699096f,-0.699028f,-0.698959f,-0.69889f,-0.698822f,-0.698753f,-0.698685f,-0.698616f,-0.698548f,-0.698479f,-0.69841f,-0.698342f,-0.698273f,-0.698205f,-0.698136f,-0.698067f,-0.697999f,-0.69793f,-0.697861f,-0.697792f,-0.697724f,-0.697655f,-0.697587f,-0.697518f,-0.697449f,-0.69738f,-0.697312f,-0.697243f,-0.697174f,-0.697106f,-0.697037f,-0.696968f,-0.696899f,-0.696831f,-0.696762f,-0.696693f,-0.696624f,-0.696555f,-0.696487f,-0.696418f,-0.696349f,-0.69628f,-0.696211f,-0.696143f,-0.696074f,-0.696005f,-0.695936f,-0.695867f,-0.695799f,-0.69573f,-0.695661f,-0.695592f,-0.695523f,-0.695454f,-0.695385f,-0.695316f,-0.695247f,-0.695178f,-0.695109f,-0.695041f,-0.694972f,-0.694903f,-0.694834f,-0.694765f,-0.694696f,-0.694627f,-0.694558f,-0.694489f,-0.69442f,-0.694351f,-0.694282f,-0.694213f,-0.694144f,-0.694075f,-0.694006f,-0.693937f,-0.693868f,-0.693799f,-0.69373f,-0.693661f,-0.693592f,-0.693523f,-0.693454f,-0.693384f,-0.693315f,-0.693246f,-0.693177f,-0.693108f,-0.693039f,-0.69297f,-0.692901f,-0.692832f,-0.692762f,-0.692693f,-0.692624f,-0.692555f,-0.692486f,-0.692417f,-0.692348f,-0.692278f,-0.692209f,-0.69214f,-0.692071f,-0.692001f,-0.691932f,-0.691863f,-0.691794f,-0.691725f,-0.691655f,-0.691586f,-0.691517f,-0.691448f,-0.691378f,-0.691309f,-0.69124f,-0.69117f,-0.691101f,-0.691032f,-0.690962f,-0.690893f,-0.690824f,-0.690755f,-0.690685f,-0.690616f,-0.690547f,-0.690477f,-0.690408f,-0.690339f,-0.690269f,-0.6902f,-0.690131f,-0.690061f,-0.689991f,-0.689922f,-0.689853f,-0.689783f,-0.689714f,-0.689645f,-0.689575f,-0.689506f,-0.689436f,-0.689367f,-0.689297f,-0.689228f,-0.689159f,-0.689089f,-0.68902f,-0.68895f,-0.68888f,-0.688811f,-0.688741f,-0.688672f,-0.688602f,-0.688533f,-0.688463f,-0.688394f,-0.688324f,-0.688255f,-0.688185f,-0.688116f,-0.688046f,-0.687977f,-0.687907f,-0.687838f,-0.687768f,-0.687698f,-0.687628f,-0.687559f,-0.687489f,-0.68742f,-0.68735f,-0.68728f,-0.687211f,-0.687141f,-0.687072f,-0.687002f,-0.686932f,-0.686863f,-0.686793f,-0.686723f,-0.686653f,-0.686584f,-0.686514f,-0.686444f,-0.686374f,-0.686305f,-0.686235f,-0.686165f,-0.686096f,-0.686026f,-0.685956f,-0.685886f,-0.685817f,-0.685747f,-0.685677f,-0.685607f,-0.685537f,-0.685467f,-0.685398f,-0.685328f,-0.685258f,-0.685188f,-0.685118f,-0.685049f,-0.684979f,-0.684909f,-0.684839f,-0.684769f,-0.684699f,-0.68463f,-0.68456f,-0.68449f,-0.68442f,-0.68435f,-0.68428f,-0.68421f,-0.68414f,-0.68407f,-0.684f,-0.68393f,-0.68386f,-0.68379f,-0.683721f,-0.683651f,-0.683581f,-0.683511f,-0.683441f,-0.683371f,-0.6833f,-0.68323f,-0.68316f,-0.68309f,-0.68302f,-0.68295f,-0.68288f,-0.68281f,-0.68274f,-0.68267f,-0.6826f,-0.68253f,-0.68246f,-0.68239f,-0.68232f,-0.68225f,-0.68218f,-0.682109f,-0.682039f,-0.681969f,-0.681899f,-0.681829f,-0.681759f,-0.681689f,-0.681619f,-0.681549f,-0.681479f,-0.681408f,-0.681338f,-0.681268f,-0.681198f,-0.681128f,-0.681057f,-0.680987f,-0.680917f,-0.680847f,-0.680776f,-0.680706f,-0.680636f,-0.680566f,-0.680496f,-0.680425f,-0.680355f,-0.680285f,-0.680215f,-0.680144f,-0.680074f,-0.680004f,-0.679933f,-0.679863f,-0.679793f,-0.679722f,-0.679652f,-0.679582f,-0.679511f,-0.679441f,-0.679371f,-0.6793f,-0.67923f,-0.67916f,-0.679089f,-0.679019f,-0.678949f,-0.678878f,-0.678808f,-0.678737f,-0.678667f,-0.678596f,-0.678526f,-0.678456f,-0.678385f,-0.678315f,-0.678244f,-0.678174f,-0.678103f,-0.678033f,-0.677962f,-0.677892f,-0.677822f,-0.677751f,-0.677681f,-0.67761f,-0.677539f,-0.677469f,-0.677398f,-0.677328f,-0.677257f,-0.677187f,-0.677116f,-0.677046f,-0.676975f,-0.676905f,-0.676834f,-0.676763f,-0.676693f,-0.676622f,-0.676552f,-0.676481f,-0.67641f,-0.67634f,-0.676269f,-0.676198f,-0.676128f,-0.676057f,-0.675987f,-0.675916f,-0.675845f,-0.675775f,-0.675704f,-0.675633f,-0.675563f,-0.675492f,-0.675421f,-0.67535f,-0.67528f,-0.675209f,-0.675138f,-0.675068f,-0.674997f,-0.674926f,-0.674855f,-0.674785f,-0.674714f,-0.674643f,-0.674572f,-0.674502f,-0.674431f,-0.67436f,-0.674289f,-0.674218f,-0.674147f,-0.674077f,-0.674006f,-0.673935f,-0.673864f,-0.673793f,-0.673723f,-0.673652f,-0.673581f,-0.67351f,-0.673439f,-0.673368f,-0.673298f,-0.673227f,-0.673156f,-0.673085f,-0.673014f,-0.672943f,-0.672872f,-0.672801f,-0.67273f,-0.672659f,-0.672588f,-0.672517f,-0.672446f,-0.672375f,-0.672304f,-0.672234f,-0.672163f,-0.672092f,-0.672021f,-0.67195f,-0.671878f,-0.671807f,-0.671736f,-0.671665f,-0.671594f,-0.671523f,-0.671452f,-0.671381f,-0.67131f,-0.671239f,-0.671168f,-0.671097f,-0.671026f,-0.670955f,-0.670884f,-0.670813f,-0.670741f,-0.67067f,-0.670599f,-0.670528f,-0.670457f,-0.670386f,-0.670315f,-0.670244f,-0.670172f,-0.670101f,-0.67003f,-0.669959f,-0.669888f,-0.669817f,-0.669746f,-0.669674f,-0.669603f,-0.669532f,-0.66946f,-0.669389f,-0.669318f,-0.669247f,-0.669176f,-0.669104f,-0.669033f,-0.668962f,-0.668891f,-0.668819f,-0.668748f,-0.668677f,-0.668606f,-0.668534f,-0.668463f,-0.668391f,-0.66832f,-0.668249f,-0.668177f,-0.668106f,-0.668035f,-0.667964f,-0.667892f,-0.667821f,-0.66775f,-0.667678f,-0.667607f,-0.667535f,-0.667464f,-0.667393f,-0.667321f,-0.66725f,-0.667178f,-0.667107f,-0.667035f,-0.666964f,-0.666893f,-0.666821f,-0.66675f,-0.666678f,-0.666607f,-0.666535f,-0.666464f,-0.666393f,-0.666321f,-0.66625f,-0.666178f,-0.666106f,-0.666035f,-0.665963f,-0.665892f,-0.66582f,-0.665749f,-0.665677f,-0.665606f,-0.665534f,-0.665463f,-0.665391f,-0.66532f,-0.665248f,-0.665176f,-0.665105f,-0.665033f,-0.664961f,-0.66489f,-0.664818f,-0.664747f,-0.664675f,-0.664603f,-0.664532f,-0.66446f,-0.664388f,-0.664317f,-0.664245f,-0.664174f,-0.664102f,-0.66403f,-0.663959f,-0.663887f,-0.663815f,-0.663743f,-0.663671f,-0.6636f,-0.663528f,-0.663456f,-0.663385f,-0.663313f,-0.663241f,-0.66317f,-0.663098f,-0.663026f,-0.662954f,-0.662883f,-0.662811f,-0.662739f,-0.662667f,-0.662595f,-0.662523f,-0.662452f,-0.66238f,-0.662308f,-0.662236f,-0.662164f,-0.662092f,-0.662021f,-0.661949f,-0.661877f,-0.661805f,-0.661733f,-0.661661f,-0.661589f,-0.661517f,-0.661445f,-0.661373f,-0.661302f,-0.66123f,-0.661158f,-0.661086f,-0.661014f,-0.660942f,-0.66087f,-0.660798f,-0.660726f,-0.660654f,-0.660582f,-0.66051f,-0.660438f,-0.660366f,-0.660294f,-0.660222f,-0.66015f,-0.660078f,-0.660006f,-0.659934f,-0.659862f,-0.65979f,-0.659718f,-0.659646f,-0.659574f,-0.659502f,-0.65943f,-0.659358f,-0.659286f,-0.659213f,-0.659141f,-0.659069f,-0.658997f,-0.658925f,-0.658853f,-0.658781f,-0.658709f,-0.658637f,-0.658565f,-0.658492f,-0.65842f,-0.658348f,-0.658276f,-0.658204f,-0.658132f,-0.658059f,-0.657987f,-0.657915f,-0.657843f,-0.65777f,-0.657698f,-0.657626f,-0.657554f,-0.657482f,-0.657409f,-0.657337f,-0.657265f,-0.657193f,-0.65712f,-0.657048f,-0.656976f,-0.656903f,-0.656831f,-0.656759f,-0.656686f,-0.656614f,-0.656542f,-0.65647f,-0.656397f,-0.656325f,-0.656253f,-0.65618f,-0.656108f,-0.656036f,-0.655963f,-0.655891f,-0.655819f,-0.655746f,-0.655674f,-0.655601f,-0.655529f,-0.655456f,-0.655384f,-0.655312f,-0.655239f,-0.655167f,-0.655094f,-0.655022f,-0.65495f,-0.654877f,-0.654805f,-0.654732f,-0.65466f,-0.654587f,-0.654515f,-0.654442f,-0.65437f,-0.654297f,-0.654225f,-0.654152f,-0.65408f,-0.654007f,-0.653935f,-0.653862f,-0.65379f,-0.653717f,-0.653645f,-0.653572f,-0.653499f,-0.653427f,-0.653354f,-0.653281f,-0.653209f,-0.653136f,-0.653064f,-0.652991f,-0.652919f,-0.652846f,-0.652773f,-0.652701f,-0.652628f,-0.652556f,-0.652483f,-0.65241f,-0.652338f,-0.652265f,-0.652192f,-0.652119f,-0.652047f,-0.651974f,-0.651901f,-0.651829f,-0.651756f,-0.651683f,-0.65161f,-0.651538f,-0.651465f,-0.651392f,-0.65132f,-0.651247f,-0.651174f,-0.651101f,-0.651028f,-0.650956f,-0.650883f,-0.65081f,-0.650737f,-0.650665f,-0.650592f,-0.650519f,-0.650446f,-0.650373f,-0.650301f,-0.650228f,-0.650155f,-0.650082f,-0.650009f,-0.649936f,-0.649863f,-0.64979f,-0.649718f,-0.649645f,-0.649572f,-0.649499f,-0.649426f,-0.649353f,-0.64928f,-0.649207f,-0.649134f,-0.649062f,-0.648989f,-0.648916f,-0.648843f,-0.64877f,-0.648697f,-0.648624f,-0.648551f,-0.648478f,-0.648405f,-0.648332f,-0.648259f,-0.648186f,-0.648113f,-0.64804f,-0.647967f,-0.647894f,-0.647821f,-0.647748f,-0.647675f,-0.647602f,-0.647529f,-0.647455f,-0.647382f,-0.647309f,-0.647236f,-0.647163f,-0.64709f,-0.647017f,-0.646944f,-0.646871f,-0.646798f,-0.646725f,-0.646651f,-0.646578f,-0.646505f,-0.646432f,-0.646359f,-0.646285f,-0.646212f,-0.646139f,-0.646066f,-0.645993f,-0.64592f,-0.645847f,-0.645773f,-0.6457f,-0.645627f,-0.645554f,-0.645481f,-0.645407f,-0.645334f,-0.645261f,-0.645188f,-0.645114f,-0.645041f,-0.644968f,-0.644894f,-0.644821f,-0.644748f,-0.644675f,-0.644601f,-0.644528f,-0.644455f,-0.644382f,-0.644308f,-0.644235f,-0.644162f,-0.644088f,-0.644015f,-0.643941f,-0.643868f,-0.643795f,-0.643721f,-0.643648f,-0.643575f,-0.643501f,-0.643428f,-0.643354f,-0.643281f,-0.643208f,-0.643134f,-0.643061f,-0.642988f,-0.642914f,-0.642841f,-0.642767f,-0.642693f,-0.64262f,-0.642547f,-0.642473f,-0.6424f,-0.642326f,-0.642253f,-0.642179f,-0.642106f,-0.642032f,-0.641959f,-0.641885f,-0.641812f,-0.641738f,-0.641665f,-0.641591f,-0.641518f,-0.641444f,-0.64137f,-0.641297f,-0.641223f,-0.64115f,-0.641076f,-0.641003f,-0.640929f,-0.640856f,-0.640782f,-0.640708f,-0.640635f,-0.640561f,-0.640488f,-0.640414f,-0.64034f,-0.640266f,-0.640193f,-0.640119f,-0.640046f,-0.639972f,-0.639898f,-0.639825f,-0.639751f,-0.639677f,-0.639604f,-0.63953f,-0.639456f,-0.639382f,-0.639309f,-0.639235f,-0.639161f,-0.639087f,-0.639014f,-0.63894f,-0.638866f,-0.638792f,-0.638719f,-0.638645f,-0.638571f,-0.638497f,-0.638424f,-0.63835f,-0.638276f,-0.638202f,-0.638129f,-0.638055f,-0.637981f,-0.637907f,-0.637833f,-0.637759f,-0.637685f,-0.637611f,-0.637538f,-0.637464f,-0.63739f,-0.637316f,-0.637242f,-0.637168f,-0.637094f,-0.637021f,-0.636947f,-0.636873f,-0.636799f,-0.636725f,-0.636651f,-0.636577f,-0.636503f,-0.636429f,-0.636355f,-0.636281f,-0.636207f,-0.636133f,-0.636059f,-0.635985f,-0.635911f,-0.635837f,-0.635763f,-0.635689f,-0.635615f,-0.635541f,-0.635467f,-0.635393f,-0.635319f,-0.635245f,-0.635171f,-0.635097f,-0.635023f,-0.634949f,-0.634875f,-0.634801f,-0.634727f,-0.634653f,-0.634579f,-0.634504f,-0.63443f,-0.634356f,-0.634282f,-0.634208f,-0.634134f,-0.63406f,-0.633985f,-0.633911f,-0.633837f,-0.633763f,-0.633689f,-0.633615f,-0.633541f,-0.633466f,-0.633392f,-0.633318f,-0.633244f,-0.633169f,-0.633095f,-0.633021f,-0.632947f,-0.632873f,-0.632798f,-0.632724f,-0.63265f,-0.632576f,-0.632501f,-0.632427f,-0.632353f,-0.632279f,-0.632204f,-0.63213f,-0.632056f,-0.631981f,-0.631907f,-0.631833f,-0.631758f,-0.631684f,-0.63161f,-0.631536f,-0.631461f,-0.631387f,-0.631313f,-0.631238f,-0.631164f,-0.63109f,-0.631015f,-0.630941f,-0.630866f,-0.630792f,-0.630717f,-0.630643f,-0.630569f,-0.630494f,-0.63042f,-0.630345f,-0.630271f,-0.630197f,-0.630122f,-0.630048f,-0.629973f,-0.629899f,-0.629824f,-0.62975f,-0.629676f,-0.629601f,-0.629526f,-0.629452f,-0.629377f,-0.629303f,-0.629228f,-0.629154f,-0.629079f,-0.629005f,-0.62893f,-0.628856f,-0.628781f,-0.628707f,-0.628632f,-0.628558f,-0.628483f,-0.628408f,-0.628334f,-0.628259f,-0.628184f,-0.62811f,-0.628035f,-0.627961f,-0.627886f,-0.627812f,-0.627737f,-0.627662f,-0.627588f,-0.627513f,-0.627438f,-0.627364f,-0.627289f,-0.627214f,-0.62714f,-0.627065f,-0.62699f,-0.626916f,-0.626841f,-0.626766f,-0.626692f,-0.626617f,-0.626542f,-0.626467f,-0.626393f,-0.626318f,-0.626243f,-0.626169f,-0.626094f,-0.626019f,-0.625944f,-0.625869f,-0.625794f,-0.62572f,-0.625645f,-0.62557f,-0.625495f,-0.625421f,-0.625346f,-0.625271f,-0.625196f,-0.625121f,-0.625047f,-0.624972f,-0.624897f,-0.624822f,-0.624747f,-0.624672f,-0.624597f,-0.624522f,-0.624448f,-0.624373f,-0.624298f,-0.624223f,-0.624148f,-0.624073f,-0.623998f,-0.623923f,-0.623848f,-0.623774f,-0.623699f,-0.623624f,-0.623548f,-0.623473f,-0.623399f,-0.623324f,-0.623249f,-0.623174f,-0.623099f,-0.623024f,-0.622949f,-0.622874f,-0.622799f,-0.622724f,-0.622649f,-0.622574f,-0.622499f,-0.622424f,-0.622348f,-0.622273f,-0.622198f,-0.622123f,-0.622048f,-0.621973f,-0.621898f,-0.621823f,-0.621748f,-0.621673f,-0.621598f,-0.621523f,-0.621448f,-0.621373f,-0.621298f,-0.621222f,-0.621147f,-0.621072f,-0.620997f,-0.620922f,-0.620847f,-0.620771f,-0.620696f,-0.620621f,-0.620546f,-0.620471f,-0.620396f,-0.62032f,-0.620245f,-0.62017f,-0.620095f,-0.62002f,-0.619944f,-0.619869f,-0.619794f,-0.619718f,-0.619643f,-0.619568f,-0.619493f,-0.619417f,-0.619342f,-0.619267f,-0.619192f,-0.619116f,-0.619041f,-0.618966f,-0.618891f,-0.618815f,-0.61874f,-0.618664f,-0.618589f,-0.618514f,-0.618438f,-0.618363f,-0.618288f,-0.618213f,-0.618137f,-0.618062f,-0.617987f,-0.617911f,-0.617836f,-0.61776f,-0.617685f,-0.61761f,-0.617534f,-0.617459f,-0.617383f,-0.617308f,-0.617232f,-0.617157f,-0.617081f,-0.617006f,-0.616931f,-0.616855f,-0.61678f,-0.616704f,-0.616629f,-0.616553f,-0.616478f,-0.616402f,-0.616327f,-0.616251f,-0.616176f,-0.6161f,-0.616025f,-0.615949f,-0.615874f,-0.615798f,-0.615723f,-0.615647f,-0.615572f,-0.615496f,-0.615421f,-0.615345f,-0.615269f,-0.615194f,-0.615118f,-0.615042f,-0.614967f,-0.614891f,-0.614816f,-0.61474f,-0.614664f,-0.614589f,-0.614513f,-0.614438f,-0.614362f,-0.614286f,-0.614211f,-0.614135f,-0.614059f,-0.613984f,-0.613908f,-0.613832f,-0.613756f,-0.613681f,-0.613605f,-0.613529f,-0.613454f,-0.613378f,-0.613302f,-0.613227f,-0.613151f,-0.613075f,-0.612999f,-0.612924f,-0.612848f,-0.612772f,-0.612696f,-0.61262f,-0.612545f,-0.612469f,-0.612393f,-0.612317f,-0.612242f,-0.612166f,-0.61209f,-0.612014f,-0.611938f,-0.611863f,-0.611787f,-0.611711f,-0.611635f,-0.611559f,-0.611483f,-0.611407f,-0.611331f,-0.611256f,-0.61118f,-0.611104f,-0.611028f,-0.610952f,-0.610876f,-0.6108f,-0.610724f,-0.610649f,-0.610573f,-0.610497f,-0.610421f,-0.610345f,-0.610269f,-0.610193f,-0.610117f,-0.610041f,-0.609965f,-0.609889f,-0.609813f,-0.609737f,-0.609661f,-0.609585f,-0.609509f,-0.609433f,-0.609357f,-0.609281f,-0.609205f,-0.609129f,-0.609053f,-0.608977f,-0.608901f,-0.608825f,-0.608748f,-0.608672f,-0.608596f,-0.60852f,-0.608444f,-0.608368f,-0.608292f,-0.608216f,-0.60814f,-0.608064f,-0.607988f,-0.607912f,-0.607836f,-0.607759f,-0.607683f,-0.607607f,-0.607531f,-0.607455f,-0.607379f,-0.607302f,-0.607226f,-0.60715f,-0.607074f,-0.606998f,-0.606922f,-0.606845f,-0.606769f,-0.606693f,-0.606617f,-0.606541f,-0.606464f,-0.606388f,-0.606312f,-0.606235f,-0.606159f,-0.606083f,-0.606007f,-0.605931f,-0.605854f,-0.605778f,-0.605702f,-0.605625f,-0.605549f,-0.605473f,-0.605397f,-0.60532f,-0.605244f,-0.605167f,-0.605091f,-0.605015f,-0.604938f,-0.604862f,-0.604786f,-0.604709f,-0.604633f,-0.604557f,-0.60448f,-0.604404f,-0.604328f,-0.604251f,-0.604175f,-0.604099f,-0.604022f,-0.603945f,-0.603869f,-0.603793f,-0.603716f,-0.60364f,-0.603563f,-0.603487f,-0.603411f,-0.603334f,-0.603258f,-0.603181f,-0.603105f,-0.603028f,-0.602952f,-0.602875f,-0.602799f,-0.602722f,-0.602646f,-0.602569f,-0.602493f,-0.602416f,-0.60234f,-0.602263f,-0.602187f,-0.60211f,-0.602034f,-0.601957f,-0.60188f,-0.601804f,-0.601727f,-0.601651f,-0.601574f,-0.601497f,-0.601421f,-0.601344f,-0.601268f,-0.601191f,-0.601114f,-0.601038f,-0.600961f,-0.600885f,-0.600808f,-0.600731f,-0.600655f,-0.600578f,-0.600502f,-0.600425f,-0.600348f,-0.600271f,-0.600195f,-0.600118f,-0.600041f,-0.599964f,-0.599888f,-0.599811f,-0.599734f,-0.599658f,-0.599581f,-0.599504f,-0.599428f,-0.599351f,-0.599274f,-0.599197f,-0.59912f,-0.599044f,-0.598967f,-0.59889f,-0.598813f,-0.598737f,-0.59866f,-0.598583f,-0.598506f,-0.59843f,-0.598353f,-0.598276f,-0.598199f,-0.598122f,-0.598045f,-0.597969f,-0.597892f,-0.597815f,-0.597738f,-0.597661f,-0.597584f,-0.597507f,-0.59743f,-0.597354f,-0.597277f,-0.5972f,-0.597123f,-0.597046f,-0.596969f,-0.596892f,-0.596815f,-0.596738f,-0.596662f,-0.596584f,-0.596507f,-0.59643f,-0.596353f,-0.596277f,-0.5962f,-0.596123f,-0.596046f,-0.595969f,-0.595892f,-0.595815f,-0.595738f,-0.595661f,-0.595584f,-0.595507f,-0.59543f,-0.595352f,-0.595275f,-0.595198f,-0.595121f,-0.595044f,-0.594967f,-0.59489f,-0.594813f,-0.594736f,-0.594659f,-0.594582f,-0.594505f,-0.594428f,-0.594351f,-0.594274f,-0.594197f,-0.594119f,-0.594042f,-0.593965f,-0.593888f,-0.593811f,-0.593734f,-0.593657f,-0.593579f,-0.593502f,-0.593425f,-0.593348f,-0.593271f,-0.593194f,-0.593117f,-0.593039f,-0.592962f,-0.592885f,-0.592807f,-0.59273f,-0.592653f,-0.592576f,-0.592499f,-0.592421f,-0.592344f,-0.592267f,-0.59219f,-0.592113f,-0.592035f,-0.591958f,-0.591881f,-0.591804f,-0.591726f,-0.591649f,-0.591571f,-0.591494f,-0.591417f,-0.591339f,-0.591262f,-0.591185f,-0.591108f,-0.59103f,-0.590953f,-0.590876f,-0.590798f,-0.590721f,-0.590644f,-0.590566f,-0.590489f,-0.590411f,-0.590334f,-0.590257f,-0.590179f,-0.590102f,-0.590024f,-0.589947f,-0.58987f,-0.589792f,-0.589715f,-0.589637f,-0.58956f,-0.589483f,-0.589405f,-0.589328f,-0.58925f,-0.589173f,-0.589095f,-0.589018f,-0.58894f,-0.588863f,-0.588785f,-0.588708f,-0.58863f,-0.588553f,-0.588475f,-0.588398f,-0.58832f,-0.588243f,-0.588165f,-0.588088f,-0.58801f,-0.587933f,-0.587855f,-0.587777f,-0.5877f,-0.587622f,-0.587545f,-0.587467f,-0.587389f,-0.587312f,-0.587234f,-0.587157f,-0.587079f,-0.587002f,-0.586924f,-0.586846f,-0.586769f,-0.586691f,-0.586613f,-0.586536f,-0.586458f,-0.58638f,-0.586303f,-0.586225f,-0.586147f,-0.58607f,-0.585992f,-0.585914f,-0.585837f,-0.585759f,-0.585681f,-0.585604f,-0.585526f,-0.585448f,-0.58537f,-0.585292f,-0.585215f,-0.585137f,-0.585059f,-0.584982f,-0.584904f,-0.584826f,-0.584748f,-0.584671f,-0.584593f,-0.584515f,-0.584437f,-0.584359f,-0.584282f,-0.584204f,-0.584126f,-0.584048f,-0.58397f,-0.583892f,-0.583815f,-0.583737f,-0.583659f,-0.583581f,-0.583503f,-0.583425f,-0.583347f,-0.58327f,-0.583192f,-0.583114f,-0.583036f,-0.582958f,-0.58288f,-0.582802f,-0.582724f,-0.582646f,-0.582568f,-0.582491f,-0.582413f,-0.582335f,-0.582257f,-0.582179f,-0.582101f,-0.582023f,-0.581945f,-0.581867f,-0.581789f,-0.581711f,-0.581633f,-0.581555f,-0.581477f,-0.581399f,-0.581321f,-0.581243f,-0.581165f,-0.581087f,-0.581009f,-0.580931f,-0.580853f,-0.580775f,-0.580697f,-0.580619f,-0.580541f,-0.580463f,-0.580385f,-0.580306f,-0.580228f,-0.58015f,-0.580072f,-0.579994f,-0.579916f,-0.579838f,-0.57976f,-0.579682f,-0.579604f,-0.579525f,-0.579447f,-0.579369f,-0.579291f,-0.579213f,-0.579135f,-0.579056f,-0.578978f,-0.5789f,-0.578822f,-0.578744f,-0.578666f,-0.578587f,-0.578509f,-0.578431f,-0.578353f,-0.578275f,-0.578196f,-0.578118f,-0.57804f,-0.577962f,-0.577884f,-0.577805f,-0.577727f,-0.577649f,-0.57757f,-0.577492f,-0.577414f,-0.577336f,-0.577257f,-0.577179f,-0.577101f,-0.577022f,-0.576944f,-0.576866f,-0.576788f,-0.576709f,-0.576631f,-0.576552f,-0.576474f,-0.576396f,-0.576317f,-0.576239f,-0.576161f,-0.576082f,-0.576004f,-0.575926f,-0.575847f,-0.575769f,-0.575691f,-0.575612f,-0.575534f,-0.575455f,-0.575377f,-0.575298f,-0.57522f,-0.575141f,-0.575063f,-0.574985f,-0.574906f,-0.574828f,-0.574749f,-0.574671f,-0.574592f,-0.574514f,-0.574436f,-0.574357f,-0.574279f,-0.5742f,-0.574122f,-0.574043f,-0.573964f,-0.573886f,-0.573807f,-0.573729f,-0.57365f,-0.573572f,-0.573493f,-0.573415f,-0.573336f,-0.573258f,-0.573179f,-0.573101f,-0.573022f,-0.572944f,-0.572865f,-0.572787f,-0.572708f,-0.572629f,-0.57255f,-0.572472f,-0.572393f,-0.572315f,-0.572236f,-0.572157f,-0.572079f,-0.572f,-0.571922f,-0.571843f,-0.571764f,-0.571686f,-0.571607f,-0.571528f,-0.571449f,-0.571371f,-0.571292f,-0.571213f,-0.571135f,-0.571056f,-0.570977f,-0.570899f,-0.57082f,-0.570741f,-0.570663f,-0.570584f,-0.570505f,-0.570426f,-0.570348f,-0.570269f,-0.57019f,-0.570111f,-0.570032f,-0.569954f,-0.569875f,-0.569796f,-0.569717f,-0.569639f,-0.56956f,-0.569481f,-0.569402f,-0.569323f,-0.569245f,-0.569166f,-0.569087f,-0.569008f,-0.568929f,-0.56885f,-0.568771f,-0.568693f,-0.568614f,-0.568535f,-0.568456f,-0.568377f,-0.568298f,-0.568219f,-0.568141f,-0.568062f,-0.567983f,-0.567904f,-0.567825f,-0.567746f,-0.567667f,-0.567588f,-0.567509f,-0.56743f,-0.567351f,-0.567272f,-0.567193f,-0.567114f,-0.567035f,-0.566956f,-0.566877f,-0.566799f,-0.56672f,-0.566641f,-0.566562f,-0.566483f,-0.566403f,-0.566324f,-0.566245f,-0.566166f,-0.566087f,-0.566008f,-0.565929f,-0.56585f,-0.565771f,-0.565692f,-0.565613f,-0.565534f,-0.565455f,-0.565376f,-0.565297f,-0.565218f,-0.565138f,-0.565059f,-0.56498f,-0.564901f,-0.564822f,-0.564743f,-0.564664f,-0.564585f,-0.564506f,-0.564427f,-0.564347f,-0.564268f,-0.564189f,-0.56411f,-0.564031f,-0.563952f,-0.563873f,-0.563793f,-0.563714f,-0.563635f,-0.563556f,-0.563476f,-0.563397f,-0.563318f,-0.563239f,-0.56316f,-0.56308f,-0.563001f,-0.562922f,-0.562843f,-0.562764f,-0.562684f,-0.562605f,-0.562525f,-0.562446f,-0.562367f,-0.562288f,-0.562208f,-0.562129f,-0.56205f,-0.561971f,-0.561891f,-0.561812f,-0.561733f,-0.561653f,-0.561574f,-0.561495f,-0.561416f,-0.561336f,-0.561257f,-0.561177f,-0.561098f,-0.561019f,-0.560939f,-0.56086f,-0.56078f,-0.560701f,-0.560622f,-0.560542f,-0.560463f,-0.560384f,-0.560304f,-0.560225f,-0.560145f,-0.560066f,-0.559986f,-0.559907f,-0.559827f,-0.559748f,-0.559669f,-0.559589f,-0.55951f,-0.55943f,-0.559351f,-0.559271f,-0.559192f,-0.559112f,-0.559033f,-0.558954f,-0.558874f,-0.558795f,-0.558715f,-0.558635f,-0.558556f,-0.558476f,-0.558397f,-0.558317f,-0.558238f,-0.558158f,-0.558079f,-0.557999f,-0.55792f,-0.55784f,-0.55776f,-0.557681f,-0.557601f,-0.557522f,-0.557442f,-0.557362f,-0.557283f,-0.557203f,-0.557123f,-0.557044f,-0.556964f,-0.556885f,-0.556805f,-0.556726f,-0.556646f,-0.556566f,-0.556487f,-0.556407f,-0.556327f,-0.556248f,-0.556168f,-0.556088f,-0.556008f,-0.555929f,-0.555849f,-0.555769f,-0.55569f,-0.55561f,-0.55553f,-0.555451f,-0.555371f,-0.555291f,-0.555211f,-0.555132f,-0.555052f,-0.554972f,-0.554893f,-0.554812f,-0.554733f,-0.554653f,-0.554573f,-0.554493f,-0.554414f,-0.554334f,-0.554254f,-0.554174f,-0.554095f,-0.554015f,-0.553935f,-0.553855f,-0.553775f,-0.553696f,-0.553616f,-0.553536f,-0.553456f,-0.553376f,-0.553296f,-0.553216f,-0.553136f,-0.553056f,-0.552977f,-0.552897f,-0.552817f,-0.552737f,-0.552657f,-0.552577f,-0.552497f,-0.552418f,-0.552338f,-0.552257f,-0.552177f,-0.552097f,-0.552018f,-0.551938f,-0.551858f,-0.551778f,-0.551698f,-0.551618f,-0.551538f,-0.551458f,-0.551378f,-0.551298f,-0.551218f,-0.551138f,-0.551058f,-0.550978f,-0.550898f,-0.550818f,-0.550738f,-0.550658f,-0.550578f,-0.550498f,-0.550418f,-0.550338f,-0.550258f,-0.550178f,-0.550098f,-0.550018f,-0.549938f,-0.549858f,-0.549778f,-0.549697f,-0.549617f,-0.549537f,-0.549457f,-0.549377f,-0.549297f,-0.549217f,-0.549136f,-0.549056f,-0.548976f,-0.548896f,-0.548816f,-0.548736f,-0.548656f,-0.548576f,-0.548495f,-0.548415f,-0.548335f,-0.548255f,-0.548175f,-0.548094f,-0.548014f,-0.547934f,-0.547854f,-0.547774f,-0.547693f,-0.547613f,-0.547533f,-0.547453f,-0.547373f,-0.547292f,-0.547212f,-0.547132f,-0.547051f,-0.546971f,-0.546891f,-0.546811f,-0.54673f,-0.54665f,-0.54657f,-0.54649f,-0.546409f,-0.546329f,-0.546249f,-0.546169f,-0.546088f,-0.546008f,-0.545928f,-0.545847f,-0.545767f,-0.545686f,-0.545606f,-0.545526f,-0.545445f,-0.545365f,-0.545285f,-0.545204f,-0.545124f,-0.545044f,-0.544963f,-0.544883f,-0.544802f,-0.544722f,-0.544642f,-0.544561f,-0.544481f,-0.5444f,-0.54432f,-0.544239f,-0.544159f,-0.544079f,-0.543998f,-0.543918f,-0.543837f,-0.543757f,-0.543676f,-0.543596f,-0.543516f,-0.543435f,-0.543355f,-0.543274f,-0.543193f,-0.543113f,-0.543032f,-0.542952f,-0.542871f,-0.542791f,-0.54271f,-0.54263f,-0.542549f,-0.542469f,-0.542388f,-0.542308f,-0.542227f,-0.542147f,-0.542066f,-0.541986f,-0.541905f,-0.541824f,-0.541744f,-0.541663f,-0.541582f,-0.541502f,-0.541421f,-0.541341f,-0.54126f,-0.54118f,-0.541099f,-0.541018f,-0.540938f,-0.540857f,-0.540776f,-0.540696f,-0.540615f,-0.540534f,-0.540454f,-0.540373f,-0.540292f,-0.540212f,-0.540131f,-0.54005f,-0.53997f,-0.539889f,-0.539808f,-0.539728f,-0.539647f,-0.539566f,-0.539486f,-0.539405f,-0.539324f,-0.539243f,-0.539162f,-0.539082f,-0.539001f,-0.53892f,-0.538839f,-0.538759f,-0.538678f,-0.538597f,-0.538516f,-0.538436f,-0.538355f,-0.538274f,-0.538193f,-0.538112f,-0.538031f,-0.537951f,-0.53787f,-0.537789f,-0.537708f,-0.537627f,-0.537546f,-0.537466f,-0.537385f,-0.537304f,-0.537223f,-0.537142f,-0.537061f,-0.536981f,-0.5369f,-0.536819f,-0.536738f,-0.536657f,-0.536576f,-0.536495f,-0.536414f,-0.536333f,-0.536252f,-0.536171f,-0.536091f,-0.53601f,-0.535929f,-0.535848f,-0.535767f,-0.535686f,-0.535605f,-0.535524f,-0.535443f,-0.535362f,-0.535281f,-0.5352f,-0.535119f,-0.535038f,-0.534957f,-0.534876f,-0.534795f,-0.534714f,-0.534633f,-0.534552f,-0.534471f,-0.53439f,-0.534309f,-0.534228f,-0.534147f,-0.534065f,-0.533984f,-0.533903f,-0.533822f,-0.533741f,-0.53366f,-0.533579f,-0.533498f,-0.533417f,-0.533336f,-0.533255f,-0.533174f,-0.533093f,-0.533012f,-0.532931f,-0.532849f,-0.532768f,-0.532687f,-0.532606f,-0.532525f,-0.532443f,-0.532362f,-0.532281f,-0.5322f,-0.532119f,-0.532038f,-0.531957f,-0.531875f,-0.531794f,-0.531713f,-0.531632f,-0.531551f,-0.531469f,-0.531388f,-0.531307f,-0.531226f,-0.531144f,-0.531063f,-0.530982f,-0.530901f,-0.53082f,-0.530738f,-0.530657f,-0.530576f,-0.530495f,-0.530413f,-0.530332f,-0.530251f,-0.530169f,-0.530088f,-0.530007f,-0.529925f,-0.529844f,-0.529763f,-0.529681f,-0.5296f,-0.529519f,-0.529438f,-0.529356f,-0.529275f,-0.529194f,-0.529112f,-0.529031f,-0.52895f,-0.528868f,-0.528787f,-0.528705f,-0.528624f,-0.528542f,-0.528461f,-0.52838f,-0.528298f,-0.528217f,-0.528136f,-0.528054f,-0.527973f,-0.527891f,-0.52781f,-0.527729f,-0.527647f,-0.527566f,-0.527484f,-0.527403f,-0.527321f,-0.52724f,-0.527158f,-0.527077f,-0.526995f,-0.526914f,-0.526832f,-0.526751f,-0.526669f,-0.526588f,-0.526506f,-0.526425f,-0.526343f,-0.526262f,-0.52618f,-0.526099f,-0.526017f,-0.525936f,-0.525854f,-0.525773f,-0.525691f,-0.525609f,-0.525528f,-0.525446f,-0.525365f,-0.525283f,-0.525202f,-0.52512f,-0.525039f,-0.524957f,-0.524875f,-0.524793f,-0.524712f,-0.52463f,-0.524549f,-0.524467f,-0.524385f,-0.524304f,-0.524222f,-0.524141f,-0.524059f,-0.523977f,-0.523896f,-0.523814f,-0.523732f,-0.523651f,-0.523569f,-0.523487f,-0.523405f,-0.523324f,-0.523242f,-0.52316f,-0.523079f,-0.522997f,-0.522915f,-0.522834f,-0.522752f,-0.52267f,-0.522588f,-0.522507f,-0.522425f,-0.522343f,-0.522261f,-0.522179f,-0.522098f,-0.522016f,-0.521934f,-0.521852f,-0.521771f,-0.521689f,-0.521607f,-0.521525f,-0.521444f,-0.521362f,-0.52128f,-0.521198f,-0.521116f,-0.521035f,-0.520952f,-0.520871f,-0.520789f,-0.520707f,-0.520625f,-0.520543f,-0.520461f,-0.52038f,-0.520298f,-0.520216f,-0.520134f,-0.520052f,-0.51997f,-0.519888f,-0.519807f,-0.519725f,-0.519643f,-0.51956f,-0.519479f,-0.519397f,-0.519315f,-0.519233f,-0.519151f,-0.519069f,-0.518987f,-0.518905f,-0.518823f,-0.518741f,-0.518659f,-0.518577f,-0.518496f,-0.518414f,-0.518332f,-0.518249f,-0.518167f,-0.518085f,-0.518003f,-0.517921f,-0.517839f,-0.517757f,-0.517675f,-0.517593f,-0.517511f,-0.517429f,-0.517347f,-0.517265f,-0.517183f,-0.517101f,-0.517019f,-0.516937f,-0.516855f,-0.516773f,-0.51669f,-0.516608f,-0.516526f,-0.516444f,-0.516362f,-0.51628f,-0.516198f,-0.516116f,-0.516034f,-0.515952f,-0.51587f,-0.515788f,-0.515705f,-0.515623f,-0.515541f,-0.515459f,-0.515377f,-0.515294f,-0.515212f,-0.51513f,-0.515048f,-0.514966f,-0.514884f,-0.514802f,-0.514719f,-0.514637f,-0.514555f,-0.514473f,-0.514391f,-0.514308f,-0.514226f,-0.514144f,-0.514061f,-0.513979f,-0.513897f,-0.513815f,-0.513732f,-0.51365f,-0.513568f,-0.513486f,-0.513404f,-0.513321f,-0.513239f,-0.513157f,-0.513075f,-0.512992f,-0.51291f,-0.512827f,-0.512745f,-0.512663f,-0.51258f,-0.512498f,-0.512416f,-0.512334f,-0.512251f,-0.512169f,-0.512087f,-0.512004f,-0.511922f,-0.51184f,-0.511757f,-0.511674f,-0.511592f,-0.51151f,-0.511427f,-0.511345f,-0.511263f,-0.51118f,-0.511098f,-0.511016f,-0.510933f,-0.510851f,-0.510768f,-0.510686f,-0.510604f,-0.510521f,-0.510439f,-0.510356f,-0.510273f,-0.510191f,-0.510109f,-0.510026f,-0.509944f,-0.509861f,-0.509779f,-0.509696f,-0.509614f,-0.509531f,-0.509449f,-0.509366f,-0.509284f,-0.509202f,-0.509119f,-0.509037f,-0.508954f,-0.508871f,-0.508789f,-0.508706f,-0.508624f,-0.508541f,-0.508458f,-0.508376f,-0.508293f,-0.508211f,-0.508128f,-0.508046f,-0.507963f,-0.507881f,-0.507798f,-0.507716f,-0.507633f,-0.50755f,-0.507467f,-0.507385f,-0.507302f,-0.50722f,-0.507137f,-0.507054f,-0.506972f,-0.506889f,-0.506807f,-0.506724f,-0.506641f,-0.506559f,-0.506476f,-0.506393f,-0.50631f,-0.506228f,-0.506145f,-0.506062f,-0.50598f,-0.505897f,-0.505814f,-0.505732f,-0.505649f,-0.505566f,-0.505484f,-0.505401f,-0.505318f,-0.505235f,-0.505153f,-0.50507f,-0.504987f,-0.504904f,-0.504821f,-0.504739f,-0.504656f,-0.504573f,-0.50449f,-0.504408f,-0.504325f,-0.504242f,-0.504159f,-0.504077f,-0.503994f,-0.503911f,-0.503828f,-0.503745f,-0.503662f,-0.503579f,-0.503497f,-0.503414f,-0.503331f,-0.503248f,-0.503165f,-0.503083f,-0.503f,-0.502917f,-0.502834f,-0.502751f,-0.502668f,-0.502585f,-0.502503f,-0.50242f,-0.502337f,-0.502254f,-0.502171f,-0.502088f,-0.502005f,-0.501922f,-0.501839f,-0.501756f,-0.501673f,-0.50159f,-0.501508f,-0.501425f,-0.501342f,-0.501259f,-0.501176f,-0.501093f,-0.50101f,-0.500927f,-0.500844f,-0.500761f,-0.500678f,-0.500595f,-0.500512f,-0.500429f,-0.500346f,-0.500263f,-0.50018f,-0.500097f,-0.500014f,-0.499931f,-0.499848f,-0.499765f,-0.499682f,-0.499598f,-0.499515f,-0.499432f,-0.499349f,-0.499266f,-0.499183f,-0.4991f,-0.499017f,-0.498934f,-0.498851f,-0.498768f,-0.498685f,-0.498602f,-0.498519f,-0.498435f,-0.498352f,-0.498269f,-0.498186f,-0.498103f,-0.49802f,-0.497936f,-0.497853f,-0.49777f,-0.497687f,-0.497604f,-0.497521f,-0.497438f,-0.497355f,-0.497271f,-0.497188f,-0.497105f,-0.497022f,-0.496938f,-0.496855f,-0.496772f,-0.496689f,-0.496606f,-0.496522f,-0.496439f,-0.496356f,-0.496273f,-0.49619f,-0.496106f,-0.496023f,-0.49594f,-0.495857f,-0.495773f,-0.49569f,-0.495607f,-0.495523f,-0.49544f,-0.495357f,-0.495274f,-0.49519f,-0.495107f,-0.495024f,-0.49494f,-0.494857f,-0.494774f,-0.494691f,-0.494607f,-0.494524f,-0.494441f,-0.494357f,-0.494274f,-0.49419f,-0.494107f,-0.494024f,-0.49394f,-0.493857f,-0.493774f,-0.49369f,-0.493607f,-0.493524f,-0.49344f,-0.493357f,-0.493273f,-0.49319f,-0.493107f,-0.493023f,-0.49294f,-0.492856f,-0.492773f,-0.492689f,-0.492606f,-0.492523f,-0.492439f,-0.492356f,-0.492272f,-0.492189f,-0.492105f,-0.492022f,-0.491939f,-0.491855f,-0.491772f,-0.491688f,-0.491605f,-0.491521f,-0.491437f,-0.491354f,-0.49127f,-0.491187f,-0.491103f,-0.49102f,-0.490936f,-0.490853f,-0.490769f,-0.490686f,-0.490602f,-0.490519f,-0.490435f,-0.490352f,-0.490268f,-0.490184f,-0.490101f,-0.490017f,-0.489934f,-0.48985f,-0.489767f,-0.489683f,-0.489599f,-0.489516f,-0.489432f,-0.489349f,-0.489265f,-0.489182f,-0.489098f,-0.489014f,-0.488931f,-0.488847f,-0.488763f,-0.48868f,-0.488596f,-0.488512f,-0.488429f,-0.488345f,-0.488261f,-0.488178f,-0.488094f,-0.48801f,-0.487927f,-0.487843f,-0.487759f,-0.487676f,-0.487592f,-0.487508f,-0.487424f,-0.487341f,-0.487257f,-0.487173f,-0.487089f,-0.487006f,-0.486922f,-0.486838f,-0.486755f,-0.486671f,-0.486587f,-0.486503f,-0.48642f,-0.486336f,-0.486252f,-0.486168f,-0.486084f,-0.486001f,-0.485917f,-0.485833f,-0.485749f,-0.485665f,-0.485582f,-0.485498f,-0.485414f,-0.48533f,-0.485246f,-0.485163f,-0.485079f,-0.484995f,-0.484911f,-0.484827f,-0.484743f,-0.484659f,-0.484575f,-0.484492f,-0.484408f,-0.484324f,-0.48424f,-0.484156f,-0.484072f,-0.483988f,-0.483905f,-0.483821f,-0.483737f,-0.483653f,-0.483569f,-0.483485f,-0.483401f,-0.483317f,-0.483233f,-0.483149f,-0.483065f,-0.482981f,-0.482897f,-0.482813f,-0.48273f,-0.482646f,-0.482562f,-0.482478f,-0.482394f,-0.48231f,-0.482226f,-0.482142f,-0.482057f,-0.481973f,-0.481889f,-0.481806f,-0.481722f,-0.481638f,-0.481554f,-0.48147f,-0.481386f,-0.481302f,-0.481218f,-0.481133f,-0.481049f,-0.480965f,-0.480881f,-0.480797f,-0.480713f,-0.480629f,-0.480545f,-0.480461f,-0.480377f,-0.480293f,-0.480209f,-0.480124f,-0.48004f,-0.479956f,-0.479872f,-0.479788f,-0.479704f,-0.47962f,-0.479536f,-0.479452f,-0.479367f,-0.479283f,-0.479199f,-0.479115f,-0.479031f,-0.478947f,-0.478862f,-0.478778f,-0.478694f,-0.47861f,-0.478526f,-0.478442f,-0.478358f,-0.478273f,-0.478189f,-0.478105f,-0.47802f,-0.477936f,-0.477852f,-0.477768f,-0.477684f,-0.477599f,-0.477515f,-0.477431f,-0.477347f,-0.477263f,-0.477178f,-0.477094f,-0.47701f,-0.476926f,-0.476841f,-0.476757f,-0.476672f,-0.476588f,-0.476504f,-0.47642f,-0.476335f,-0.476251f,-0.476167f,-0.476083f,-0.475998f,-0.475914f,-0.47583f,-0.475745f,-0.475661f,-0.475577f,-0.475492f,-0.475408f,-0.475323f,-0.475239f,-0.475155f,-0.47507f,-0.474986f,-0.474902f,-0.474817f,-0.474733f,-0.474649f,-0.474564f,-0.47448f,-0.474396f,-0.474311f,-0.474227f,-0.474142f,-0.474058f,-0.473973f,-0.473889f,-0.473804f,-0.47372f,-0.473636f,-0.473551f,-0.473467f,-0.473382f,-0.473298f,-0.473214f,-0.473129f,-0.473045f,-0.47296f,-0.472876f,-0.472791f,-0.472707f,-0.472622f,-0.472537f,-0.472453f,-0.472369f,-0.472284f,-0.4722f,-0.472115f,-0.472031f,-0.471946f,-0.471862f,-0.471777f,-0.471693f,-0.471608f,-0.471524f,-0.471439f,-0.471354f,-0.47127f,-0.471185f,-0.4711f,-0.471016f,-0.470931f,-0.470847f,-0.470762f,-0.470678f,-0.470593f,-0.470509f,-0.470424f,-0.470339f,-0.470255f,-0.47017f,-0.470086f,-0.470001f,-0.469916f,-0.469831f,-0.469747f,-0.469662f,-0.469578f,-0.469493f,-0.469408f,-0.469324f,-0.469239f,-0.469154f,-0.46907f,-0.468985f,-0.4689f,-0.468816f,-0.468731f,-0.468646f,-0.468562f,-0.468477f,-0.468392f,-0.468307f,-0.468223f,-0.468138f,-0.468053f,-0.467969f,-0.467884f,-0.467799f,-0.467714f,-0.46763f,-0.467545f,-0.46746f,-0.467376f,-0.467291f,-0.467206f,-0.467121f,-0.467036f,-0.466951f,-0.466867f,-0.466782f,-0.466697f,-0.466612f,-0.466528f,-0.466443f,-0.466358f,-0.466273f,-0.466188f,-0.466104f,-0.466019f,-0.465934f,-0.465849f,-0.465764f,-0.465679f,-0.465594f,-0.46551f,-0.465425f,-0.46534f,-0.465255f,-0.46517f,-0.465085f,-0.465001f,-0.464916f,-0.464831f,-0.464746f,-0.464661f,-0.464576f,-0.464491f,-0.464406f,-0.464321f,-0.464236f,-0.464151f,-0.464067f,-0.463982f,-0.463897f,-0.463812f,-0.463727f,-0.463642f,-0.463557f,-0.463472f,-0.463387f,-0.463302f,-0.463217f,-0.463132f,-0.463047f,-0.462962f,-0.462877f,-0.462792f,-0.462707f,-0.462622f,-0.462537f,-0.462452f,-0.462367f,-0.462282f,-0.462197f,-0.462112f,-0.462027f,-0.461942f,-0.461857f,-0.461772f,-0.461687f,-0.461602f,-0.461517f,-0.461432f,-0.461347f,-0.461262f,-0.461177f,-0.461092f,-0.461007f,-0.460921f,-0.460836f,-0.460751f,-0.460666f,-0.460581f,-0.460496f,-0.460411f,-0.460326f,-0.46024f,-0.460155f,-0.46007f,-0.459985f,-0.4599f,-0.459815f,-0.45973f,-0.459645f,-0.45956f,-0.459475f,-0.459389f,-0.459304f,-0.459219f,-0.459134f,-0.459049f,-0.458964f,-0.458878f,-0.458793f,-0.458708f,-0.458623f,-0.458537f,-0.458452f,-0.458367f,-0.458282f,-0.458197f,-0.458111f,-0.458026f,-0.457941f,-0.457856f,-0.457771f,-0.457685f,-0.4576f,-0.457515f,-0.457429f,-0.457344f,-0.457259f,-0.457174f,-0.457088f,-0.457003f,-0.456918f,-0.456833f,-0.456747f,-0.456662f,-0.456577f,-0.456492f,-0.456406f,-0.456321f,-0.456236f,-0.45615f,-0.456065f,-0.455979f,-0.455894f,-0.455809f,-0.455724f,-0.455638f,-0.455553f,-0.455468f,-0.455382f,-0.455297f,-0.455212f,-0.455126f,-0.455041f,-0.454956f,-0.45487f,-0.454785f,-0.454699f,-0.454614f,-0.454528f,-0.454443f,-0.454358f,-0.454272f,-0.454187f,-0.454101f,-0.454016f,-0.453931f,-0.453845f,-0.45376f,-0.453674f,-0.453589f,-0.453504f,-0.453418f,-0.453332f,-0.453247f,-0.453161f,-0.453076f,-0.452991f,-0.452905f,-0.45282f,-0.452734f,-0.452649f,-0.452563f,-0.452478f,-0.452392f,-0.452307f,-0.452221f,-0.452136f,-0.45205f,-0.451964f,-0.451879f,-0.451793f,-0.451708f,-0.451622f,-0.451537f,-0.451451f,-0.451366f,-0.45128f,-0.451195f,-0.451109f,-0.451024f,-0.450938f,-0.450853f,-0.450767f,-0.450682f,-0.450596f,-0.45051f,-0.450424f,-0.450339f,-0.450253f,-0.450168f,-0.450082f,-0.449997f,-0.449911f,-0.449825f,-0.44974f,-0.449654f,-0.449568f,-0.449483f,-0.449397f,-0.449312f,-0.449226f,-0.44914f,-0.449054f,-0.448969f,-0.448883f,-0.448797f,-0.448712f,-0.448626f,-0.44854f,-0.448455f,-0.448369f,-0.448283f,-0.448198f,-0.448112f,-0.448026f,-0.447941f,-0.447855f,-0.447769f,-0.447683f,-0.447597f,-0.447512f,-0.447426f,-0.44734f,-0.447255f,-0.447169f,-0.447083f,-0.446997f,-0.446912f,-0.446826f,-0.44674f,-0.446654f,-0.446569f,-0.446482f,-0.446397f,-0.446311f,-0.446225f,-0.446139f,-0.446054f,-0.445968f,-0.445882f,-0.445796f,-0.44571f,-0.445625f,-0.445539f,-0.445453f,-0.445367f,-0.445281f,-0.445196f,-0.44511f,-0.445024f,-0.444938f,-0.444852f,-0.444766f,-0.44468f,-0.444594f,-0.444508f,-0.444423f,-0.444337f,-0.444251f,-0.444165f,-0.444079f,-0.443993f,-0.443907f,-0.443822f,-0.443736f,-0.443649f,-0.443563f,-0.443478f,-0.443392f,-0.443306f,-0.44322f,-0.443134f,-0.443048f,-0.442962f,-0.442876f,-0.44279f,-0.442704f,-0.442618f,-0.442532f,-0.442446f,-0.44236f,-0.442274f,-0.442188f,-0.442102f,-0.442016f,-0.44193f,-0.441844f,-0.441758f,-0.441672f,-0.441586f,-0.4415f,-0.441414f,-0.441328f,-0.441242f,-0.441156f,-0.44107f,-0.440984f,-0.440898f,-0.440812f,-0.440726f,-0.44064f,-0.440554f,-0.440468f,-0.440381f,-0.440295f,-0.440209f,-0.440123f,-0.440037f,-0.439951f,-0.439865f,-0.439779f,-0.439693f,-0.439607f,-0.43952f,-0.439434f,-0.439348f,-0.439262f,-0.439176f,-0.43909f,-0.439004f,-0.438918f,-0.438831f,-0.438745f,-0.438659f,-0.438573f,-0.438487f,-0.438401f,-0.438315f,-0.438229f,-0.438142f,-0.438056f,-0.43797f,-0.437883f,-0.437797f,-0.437711f,-0.437625f,-0.437539f,-0.437453f,-0.437366f,-0.43728f,-0.437194f,-0.437108f,-0.437022f,-0.436935f,-0.436849f,-0.436763f,-0.436676f,-0.43659f,-0.436504f,-0.436418f,-0.436331f,-0.436245f,-0.436159f,-0.436073f,-0.435986f,-0.4359f,-0.435814f,-0.435728f,-0.435641f,-0.435555f,-0.435469f,-0.435383f,-0.435296f,-0.43521f,-0.435123f,-0.435037f,-0.434951f,-0.434864f,-0.434778f,-0.434692f,-0.434605f,-0.434519f,-0.434433f,-0.434346f,-0.43426f,-0.434174f,-0.434087f,-0.434001f,-0.433914f,-0.433828f,-0.433742f,-0.433655f,-0.433569f,-0.433482f,-0.433396f,-0.43331f,-0.433223f,-0.433137f,-0.433051f,-0.432964f,-0.432878f,-0.432791f,-0.432705f,-0.432619f,-0.432532f,-0.432445f,-0.432359f,-0.432272f,-0.432186f,-0.4321f,-0.432013f,-0.431927f,-0.43184f,-0.431754f,-0.431667f,-0.431581f,-0.431494f,-0.431408f,-0.431322f,-0.431235f,-0.431148f,-0.431062f,-0.430975f,-0.430889f,-0.430802f,-0.430716f,-0.430629f,-0.430543f,-0.430456f,-0.43037f,-0.430283f,-0.430197f,-0.43011f,-0.430024f,-0.429937f,-0.42985f,-0.429764f,-0.429677f,-0.42959f,-0.429504f,-0.429417f,-0.429331f,-0.429244f,-0.429158f,-0.429071f,-0.428984f,-0.428898f,-0.428811f,-0.428725f,-0.428638f,-0.428552f,-0.428465f,-0.428378f,-0.428291f,-0.428205f,-0.428118f,-0.428031f,-0.427945f,-0.427858f,-0.427772f,-0.427685f,-0.427598f,-0.427512f,-0.427425f,-0.427338f,-0.427252f,-0.427165f,-0.427078f,-0.426991f,-0.426905f,-0.426818f,-0.426731f,-0.426645f,-0.426558f,-0.426471f,-0.426385f,-0.426298f,-0.426211f,-0.426124f,-0.426038f,-0.425951f,-0.425864f,-0.425778f,-0.425691f,-0.425604f,-0.425517f,-0.42543f,-0.425343f,-0.425257f,-0.42517f,-0.425083f,-0.424996f,-0.42491f,-0.424823f,-0.424736f,-0.424649f,-0.424563f,-0.424476f,-0.424389f,-0.424302f,-0.424215f,-0.424128f,-0.424041f,-0.423955f,-0.423868f,-0.423781f,-0.423694f,-0.423607f,-0.423521f,-0.423434f,-0.423347f,-0.42326f,-0.423173f,-0.423086f,-0.423f,-0.422913f,-0.422826f,-0.422739f,-0.422652f,-0.422565f,-0.422478f,-0.422391f,-0.422304f,-0.422217f,-0.42213f,-0.422044f,-0.421957f,-0.42187f,-0.421783f,-0.421696f,-0.421609f,-0.421522f,-0.421435f,-0.421348f,-0.421261f,-0.421174f,-0.421087f,-0.421f,-0.420913f,-0.420826f,-0.420739f,-0.420652f,-0.420565f,-0.420479f,-0.420392f,-0.420305f,-0.420218f,-0.420131f,-0.420044f,-0.419956f,-0.419869f,-0.419782f,-0.419695f,-0.419608f,-0.419521f,-0.419434f,-0.419347f,-0.41926f,-0.419173f,-0.419086f,-0.418999f,-0.418912f,-0.418825f,-0.418738f,-0.418651f,-0.418564f,-0.418477f,-0.418389f,-0.418302f,-0.418215f,-0.418128f,-0.418041f,-0.417954f,-0.417867f,-0.41778f,-0.417693f,-0.417606f,-0.417519f,-0.417432f,-0.417345f,-0.417257f,-0.41717f,-0.417083f,-0.416996f,-0.416909f,-0.416822f,-0.416734f,-0.416647f,-0.41656f,-0.416473f,-0.416386f,-0.416299f,-0.416212f,-0.416124f,-0.416037f,-0.41595f,-0.415863f,-0.415776f,-0.415688f,-0.415601f,-0.415514f,-0.415427f,-0.415339f,-0.415252f,-0.415165f,-0.415078f,-0.414991f,-0.414903f,-0.414816f,-0.414729f,-0.414642f,-0.414555f,-0.414467f,-0.41438f,-0.414293f,-0.414205f,-0.414118f,-0.414031f,-0.413944f,-0.413856f,-0.413769f,-0.413682f,-0.413595f,-0.413507f,-0.41342f,-0.413333f,-0.413245f,-0.413158f,-0.413071f,-0.412984f,-0.412896f,-0.412809f,-0.412721f,-0.412634f,-0.412547f,-0.412459f,-0.412372f,-0.412285f,-0.412197f,-0.41211f,-0.412023f,-0.411935f,-0.411848f,-0.411761f,-0.411673f,-0.411586f,-0.411498f,-0.411411f,-0.411324f,-0.411236f,-0.411149f,-0.411061f,-0.410974f,-0.410887f,-0.410799f,-0.410712f,-0.410625f,-0.410537f,-0.41045f,-0.410362f,-0.410275f,-0.410188f,-0.4101f,-0.410012f,-0.409925f,-0.409837f,-0.40975f,-0.409663f,-0.409575f,-0.409488f,-0.4094f,-0.409313f,-0.409225f,-0.409138f,-0.40905f,-0.408963f,-0.408876f,-0.408788f,-0.4087f,-0.408613f,-0.408525f,-0.408438f,-0.40835f,-0.408263f,-0.408175f,-0.408088f,-0.408f,-0.407913f,-0.407825f,-0.407738f,-0.40765f,-0.407563f,-0.407475f,-0.407388f,-0.4073f,-0.407212f,-0.407125f,-0.407037f,-0.406949f,-0.406862f,-0.406774f,-0.406687f,-0.406599f,-0.406512f,-0.406424f,-0.406337f,-0.406249f,-0.406161f,-0.406074f,-0.405986f,-0.405899f,-0.405811f,-0.405723f,-0.405635f,-0.405548f,-0.40546f,-0.405373f,-0.405285f,-0.405197f,-0.40511f,-0.405022f,-0.404934f,-0.404847f,-0.404759f,-0.404672f,-0.404584f,-0.404496f,-0.404408f,-0.40432f,-0.404233f,-0.404145f,-0.404057f,-0.40397f,-0.403882f,-0.403794f,-0.403707f,-0.403619f,-0.403531f,-0.403444f,-0.403356f,-0.403268f,-0.403181f,-0.403093f,-0.403005f,-0.402917f,-0.402829f,-0.402742f,-0.402654f,-0.402566f,-0.402478f,-0.402391f,-0.402303f,-0.402215f,-0.402127f,-0.40204f,-0.401952f,-0.401864f,-0.401776f,-0.401689f,-0.4016f,-0.401513f,-0.401425f,-0.401337f,-0.401249f,-0.401161f,-0.401074f,-0.400986f,-0.400898f,-0.40081f,-0.400722f,-0.400635f,-0.400547f,-0.400459f,-0.400371f,-0.400283f,-0.400195f,-0.400107f,-0.400019f,-0.399931f,-0.399844f,-0.399756f,-0.399668f,-0.39958f,-0.399492f,-0.399404f,-0.399316f,-0.399229f,-0.399141f,-0.399053f,-0.398965f,-0.398877f,-0.398789f,-0.398701f,-0.398613f,-0.398525f,-0.398437f,-0.398349f,-0.398261f,-0.398173f,-0.398086f,-0.397998f,-0.39791f,-0.397822f,-0.397734f,-0.397646f,-0.397558f,-0.39747f,-0.397382f,-0.397294f,-0.397206f,-0.397118f,-0.39703f,-0.396942f,-0.396854f,-0.396766f,-0.396678f,-0.39659f,-0.396502f,-0.396414f,-0.396326f,-0.396238f,-0.39615f,-0.396062f,-0.395974f,-0.395885f,-0.395797f,-0.395709f,-0.395621f,-0.395533f,-0.395445f,-0.395357f,-0.395269f,-0.395181f,-0.395093f,-0.395005f,-0.394917f,-0.394829f,-0.394741f,-0.394653f,-0.394565f,-0.394476f,-0.394388f,-0.3943f,-0.394212f,-0.394124f,-0.394036f,-0.393948f,-0.39386f,-0.393772f,-0.393683f,-0.393595f,-0.393507f,-0.393419f,-0.393331f,-0.393243f,-0.393155f,-0.393066f,-0.392978f,-0.39289f,-0.392802f,-0.392714f,-0.392626f,-0.392537f,-0.392449f,-0.392361f,-0.392273f,-0.392185f,-0.392097f,-0.392008f,-0.39192f,-0.391832f,-0.391744f,-0.391655f,-0.391567f,-0.391479f,-0.391391f,-0.391302f,-0.391214f,-0.391126f,-0.391038f,-0.39095f,-0.390861f,-0.390773f,-0.390685f,-0.390597f,-0.390509f,-0.39042f,-0.390332f,-0.390243f,-0.390155f,-0.390067f,-0.389979f,-0.38989f,-0.389802f,-0.389714f,-0.389626f,-0.389537f,-0.389449f,-0.389361f,-0.389272f,-0.389184f,-0.389096f,-0.389008f,-0.388919f,-0.388831f,-0.388742f,-0.388654f,-0.388566f,-0.388477f,-0.388389f,-0.388301f,-0.388212f,-0.388124f,-0.388036f,-0.387947f,-0.387859f,-0.387771f,-0.387682f,-0.387594f,-0.387506f,-0.387417f,-0.387328f,-0.38724f,-0.387152f,-0.387063f,-0.386975f,-0.386887f,-0.386798f,-0.38671f,-0.386621f,-0.386533f,-0.386445f,-0.386356f,-0.386268f,-0.386179f,-0.386091f,-0.386003f,-0.385914f,-0.385825f,-0.385737f,-0.385648f,-0.38556f,-0.385472f,-0.385383f,-0.385295f,-0.385206f,-0.385118f,-0.385029f,-0.384941f,-0.384852f,-0.384764f,-0.384676f,-0.384587f,-0.384498f,-0.38441f,-0.384321f,-0.384233f,-0.384144f,-0.384056f,-0.383967f,-0.383879f,-0.38379f,-0.383702f,-0.383613f,-0.383525f,-0.383436f,-0.383348f,-0.383259f,-0.383171f,-0.383082f,-0.382993f,-0.382905f,-0.382816f,-0.382727f,-0.382639f,-0.38255f,-0.382462f,-0.382373f,-0.382285f,-0.382196f,-0.382108f,-0.382019f,-0.38193f,-0.381842f,-0.381753f,-0.381664f,-0.381576f,-0.381487f,-0.381398f,-0.38131f,-0.381221f,-0.381133f,-0.381044f,-0.380955f,-0.380867f,-0.380778f,-0.38069f,-0.380601f,-0.380512f,-0.380424f,-0.380335f,-0.380246f,-0.380157f,-0.380069f,-0.37998f,-0.379891f,-0.379803f,-0.379714f,-0.379625f,-0.379537f,-0.379448f,-0.379359f,-0.379271f,-0.379182f,-0.379093f,-0.379005f,-0.378916f,-0.378827f,-0.378738f,-0.378649f,-0.378561f,-0.378472f,-0.378383f,-0.378294f,-0.378206f,-0.378117f,-0.378028f,-0.37794f,-0.377851f,-0.377762f,-0.377673f,-0.377585f,-0.377496f,-0.377407f,-0.377318f,-0.377229f,-0.37714f,-0.377052f,-0.376963f,-0.376874f,-0.376785f,-0.376696f,-0.376608f,-0.376519f,-0.37643f,-0.376341f,-0.376252f,-0.376164f,-0.376075f,-0.375986f,-0.375897f,-0.375808f,-0.375719f,-0.37563f,-0.375542f,-0.375453f,-0.375364f,-0.375275f,-0.375186f,-0.375097f,-0.375008f,-0.37492f,-0.374831f,-0.374742f,-0.374653f,-0.374564f,-0.374475f,-0.374386f,-0.374297f,-0.374208f,-0.374119f,-0.37403f,-0.373942f,-0.373853f,-0.373764f,-0.373675f,-0.373586f,-0.373497f,-0.373408f,-0.373319f,-0.37323f,-0.373141f,-0.373052f,-0.372963f,-0.372874f,-0.372785f,-0.372696f,-0.372607f,-0.372518f,-0.372429f,-0.372341f,-0.372252f,-0.372163f,-0.372074f,-0.371985f,-0.371896f,-0.371807f,-0.371718f,-0.371628f,-0.371539f,-0.37145f,-0.371361f,-0.371272f,-0.371183f,-0.371094f,-0.371005f,-0.370916f,-0.370827f,-0.370738f,-0.370649f,-0.37056f,-0.370471f,-0.370382f,-0.370293f,-0.370204f,-0.370115f,-0.370026f,-0.369937f,-0.369848f,-0.369759f,-0.36967f,-0.36958f,-0.369491f,-0.369402f,-0.369313f,-0.369224f,-0.369135f,-0.369046f,-0.368957f,-0.368868f,-0.368778f,-0.368689f,-0.3686f,-0.368511f,-0.368422f,-0.368333f,-0.368244f,-0.368155f,-0.368066f,-0.367976f,-0.367887f,-0.367798f,-0.367709f,-0.36762f,-0.367531f,-0.367442f,-0.367353f,-0.367263f,-0.367174f,-0.367085f,-0.366995f,-0.366906f,-0.366817f,-0.366728f,-0.366639f,-0.36655f,-0.366461f,-0.366371f,-0.366282f,-0.366193f,-0.366104f,-0.366015f,-0.365925f,-0.365836f,-0.365747f,-0.365657f,-0.365568f,-0.365479f,-0.36539f,-0.3653f,-0.365211f,-0.365122f,-0.365033f,-0.364944f,-0.364854f,-0.364765f,-0.364676f,-0.364587f,-0.364497f,-0.364408f,-0.364318f,-0.364229f,-0.36414f,-0.364051f,-0.363961f,-0.363872f,-0.363783f,-0.363694f,-0.363604f,-0.363515f,-0.363426f,-0.363336f,-0.363247f,-0.363158f,-0.363068f,-0.362979f,-0.362889f,-0.3628f,-0.362711f,-0.362621f,-0.362532f,-0.362443f,-0.362353f,-0.362264f,-0.362175f,-0.362085f,-0.361996f,-0.361907f,-0.361817f,-0.361728f,-0.361639f,-0.361549f,-0.36146f,-0.36137f,-0.361281f,-0.361191f,-0.361102f,-0.361013f,-0.360923f,-0.360834f,-0.360745f,-0.360655f,-0.360566f,-0.360476f,-0.360387f,-0.360298f,-0.360208f,-0.360118f,-0.360029f,-0.359939f,-0.35985f,-0.359761f,-0.359671f,-0.359582f,-0.359492f,-0.359403f,-0.359313f,-0.359224f,-0.359135f,-0.359045f,-0.358956f,-0.358866f,-0.358777f,-0.358687f,-0.358597f,-0.358508f,-0.358418f,-0.358329f,-0.358239f,-0.35815f,-0.35806f,-0.357971f,-0.357881f,-0.357792f,-0.357702f,-0.357613f,-0.357523f,-0.357434f,-0.357344f,-0.357255f,-0.357165f,-0.357075f,-0.356986f,-0.356896f,-0.356807f,-0.356717f,-0.356628f,-0.356538f,-0.356449f,-0.356359f,-0.35627f,-0.35618f,-0.35609f,-0.356001f,-0.355911f,-0.355822f,-0.355732f,-0.355642f,-0.355553f,-0.355463f,-0.355373f,-0.355284f,-0.355194f,-0.355105f,-0.355015f,-0.354925f,-0.354836f,-0.354746f,-0.354657f,-0.354567f,-0.354477f,-0.354388f,-0.354298f,-0.354208f,-0.354118f,-0.354029f,-0.353939f,-0.353849f,-0.35376f,-0.35367f,-0.353581f,-0.353491f,-0.353401f,-0.353312f,-0.353222f,-0.353132f,-0.353043f,-0.352953f,-0.352863f,-0.352773f,-0.352683f,-0.352594f,-0.352504f,-0.352414f,-0.352325f,-0.352235f,-0.352145f,-0.352056f,-0.351966f,-0.351876f,-0.351786f,-0.351697f,-0.351607f,-0.351517f,-0.351427f,-0.351337f,-0.351248f,-0.351158f,-0.351068f,-0.350978f,-0.350889f,-0.350799f,-0.350709f,-0.350619f,-0.35053f,-0.35044f,-0.35035f,-0.35026f,-0.35017f,-0.350081f,-0.34999f,-0.349901f,-0.349811f,-0.349721f,-0.349631f,-0.349542f,-0.349452f,-0.349362f,-0.349272f,-0.349182f,-0.349092f,-0.349003f,-0.348913f,-0.348823f,-0.348733f,-0.348643f,-0.348553f,-0.348463f,-0.348373f,-0.348284f,-0.348194f,-0.348104f,-0.348014f,-0.347924f,-0.347834f,-0.347744f,-0.347655f,-0.347565f,-0.347475f,-0.347385f,-0.347295f,-0.347205f,-0.347115f,-0.347025f,-0.346935f,-0.346845f,-0.346755f,-0.346665f,-0.346576f,-0.346486f,-0.346396f,-0.346306f,-0.346216f,-0.346126f,-0.346036f,-0.345946f,-0.345856f,-0.345766f,-0.345676f,-0.345586f,-0.345496f,-0.345406f,-0.345316f,-0.345226f,-0.345136f,-0.345046f,-0.344956f,-0.344866f,-0.344776f,-0.344686f,-0.344596f,-0.344506f,-0.344416f,-0.344326f,-0.344237f,-0.344146f,-0.344056f,-0.343966f,-0.343876f,-0.343786f,-0.343696f,-0.343606f,-0.343516f,-0.343426f,-0.343336f,-0.343246f,-0.343156f,-0.343066f,-0.342976f,-0.342886f,-0.342796f,-0.342705f,-0.342615f,-0.342525f,-0.342435f,-0.342345f,-0.342255f,-0.342165f,-0.342075f,-0.341985f,-0.341895f,-0.341805f,-0.341715f,-0.341625f,-0.341535f,-0.341445f,-0.341354f,-0.341264f,-0.341174f,-0.341084f,-0.340994f,-0.340903f,-0.340813f,-0.340723f,-0.340633f,-0.340543f,-0.340453f,-0.340363f,-0.340273f,-0.340183f,-0.340092f,-0.340002f,-0.339912f,-0.339822f,-0.339731f,-0.339641f,-0.339551f,-0.339461f,-0.339371f,-0.339281f,-0.339191f,-0.3391f,-0.33901f,-0.33892f,-0.33883f,-0.33874f,-0.33865f,-0.338559f,-0.338469f,-0.338378f,-0.338288f,-0.338198f,-0.338108f,-0.338018f,-0.337928f,-0.337837f,-0.337747f,-0.337657f,-0.337567f,-0.337476f,-0.337386f,-0.337296f,-0.337206f,-0.337116f,-0.337025f,-0.336935f,-0.336844f,-0.336754f,-0.336664f,-0.336574f,-0.336483f,-0.336393f,-0.336303f,-0.336213f,-0.336122f,-0.336032f,-0.335942f,-0.335851f,-0.335761f,-0.335671f,-0.335581f,-0.33549f,-0.3354f,-0.335309f,-0.335219f,-0.335129f,-0.335038f,-0.334948f,-0.334858f,-0.334767f,-0.334677f,-0.334587f,-0.334497f,-0.334406f,-0.334316f,-0.334226f,-0.334135f,-0.334045f,-0.333954f,-0.333864f,-0.333773f,-0.333683f,-0.333593f,-0.333502f,-0.333412f,-0.333322f,-0.333231f,-0.333141f,-0.333051f,-0.33296f,-0.33287f,-0.332779f,-0.332689f,-0.332599f,-0.332508f,-0.332417f,-0.332327f,-0.332237f,-0.332146f,-0.332056f,-0.331965f,-0.331875f,-0.331785f,-0.331694f,-0.331604f,-0.331513f,-0.331423f,-0.331332f,-0.331242f,-0.331152f,-0.331061f,-0.33097f,-0.33088f,-0.330789f,-0.330699f,-0.330608f,-0.330518f,-0.330428f,-0.330337f,-0.330247f,-0.330156f,-0.330066f,-0.329975f,-0.329885f,-0.329794f,-0.329704f,-0.329613f,-0.329522f,-0.329432f,-0.329341f,-0.329251f,-0.32916f,-0.32907f,-0.328979f,-0.328889f,-0.328798f,-0.328708f,-0.328617f,-0.328527f,-0.328436f,-0.328346f,-0.328255f,-0.328164f,-0.328074f,-0.327983f,-0.327893f,-0.327802f,-0.327711f,-0.327621f,-0.32753f,-0.32744f,-0.327349f,-0.327259f,-0.327168f,-0.327078f,-0.326987f,-0.326896f,-0.326806f,-0.326715f,-0.326624f,-0.326534f,-0.326443f,-0.326352f,-0.326262f,-0.326171f,-0.326081f,-0.32599f,-0.325899f,-0.325809f,-0.325718f,-0.325628f,-0.325537f,-0.325446f,-0.325356f,-0.325265f,-0.325174f,-0.325083f,-0.324993f,-0.324902f,-0.324811f,-0.324721f,-0.32463f,-0.324539f,-0.324449f,-0.324358f,-0.324267f,-0.324177f,-0.324086f,-0.323995f,-0.323905f,-0.323814f,-0.323723f,-0.323632f,-0.323542f,-0.323451f,-0.32336f,-0.323269f,-0.323179f,-0.323088f,-0.322997f,-0.322907f,-0.322816f,-0.322725f,-0.322635f,-0.322544f,-0.322453f,-0.322362f,-0.322271f,-0.32218f,-0.32209f,-0.321999f,-0.321908f,-0.321817f,-0.321727f,-0.321636f,-0.321545f,-0.321454f,-0.321364f,-0.321273f,-0.321182f,-0.321091f,-0.321001f,-0.32091f,-0.320819f,-0.320728f,-0.320637f,-0.320546f,-0.320456f,-0.320365f,-0.320274f,-0.320183f,-0.320092f,-0.320002f,-0.319911f,-0.31982f,-0.319729f,-0.319638f,-0.319547f,-0.319457f,-0.319365f,-0.319275f,-0.319184f,-0.319093f,-0.319002f,-0.318911f,-0.31882f,-0.31873f,-0.318639f,-0.318548f,-0.318457f,-0.318366f,-0.318275f,-0.318184f,-0.318094f,-0.318003f,-0.317912f,-0.31782f,-0.31773f,-0.317639f,-0.317548f,-0.317457f,-0.317366f,-0.317275f,-0.317184f,-0.317093f,-0.317002f,-0.316912f,-0.316821f,-0.31673f,-0.316639f,-0.316548f,-0.316457f,-0.316366f,-0.316275f,-0.316184f,-0.316093f,-0.316002f,-0.315911f,-0.31582f,-0.315729f,-0.315638f,-0.315547f,-0.315456f,-0.315365f,-0.315274f,-0.315183f,-0.315092f,-0.315002f,-0.31491f,-0.314819f,-0.314728f,-0.314637f,-0.314546f,-0.314455f,-0.314364f,-0.314273f,-0.314182f,-0.314091f,-0.314f,-0.313909f,-0.313818f,-0.313727f,-0.313636f,-0.313545f,-0.313454f,-0.313363f,-0.313272f,-0.313181f,-0.31309f,-0.312999f,-0.312908f,-0.312817f,-0.312726f,-0.312635f,-0.312543f,-0.312452f,-0.312361f,-0.31227f,-0.312179f,-0.312088f,-0.311997f,-0.311906f,-0.311815f,-0.311724f,-0.311632f,-0.311541f,-0.31145f,-0.311359f,-0.311268f,-0.311177f,-0.311086f,-0.310995f,-0.310904f,-0.310813f,-0.310722f,-0.310631f,-0.310539f,-0.310448f,-0.310357f,-0.310266f,-0.310174f,-0.310083f,-0.309992f,-0.309901f,-0.30981f,-0.309719f,-0.309628f,-0.309537f,-0.309445f,-0.309354f,-0.309263f,-0.309172f,-0.30908f,-0.308989f,-0.308898f,-0.308807f,-0.308716f,-0.308625f,-0.308533f,-0.308442f,-0.308351f,-0.30826f,-0.308169f,-0.308078f,-0.307986f,-0.307895f,-0.307804f,-0.307713f,-0.307622f,-0.30753f,-0.307439f,-0.307348f,-0.307256f,-0.307165f,-0.307074f,-0.306983f,-0.306892f,-0.3068f,-0.306709f,-0.306618f,-0.306527f,-0.306435f,-0.306344f,-0.306253f,-0.306162f,-0.30607f,-0.305979f,-0.305887f,-0.305796f,-0.305705f,-0.305614f,-0.305522f,-0.305431f,-0.30534f,-0.305249f,-0.305157f,-0.305066f,-0.304975f,-0.304884f,-0.304792f,-0.304701f,-0.304609f,-0.304518f,-0.304427f,-0.304335f,-0.304244f,-0.304153f,-0.304061f,-0.30397f,-0.303879f,-0.303788f,-0.303696f,-0.303605f,-0.303514f,-0.303422f,-0.303331f,-0.30324f,-0.303148f,-0.303056f,-0.302965f,-0.302874f,-0.302782f,-0.302691f,-0.3026f,-0.302508f,-0.302417f,-0.302326f,-0.302234f,-0.302143f,-0.302052f,-0.30196f,-0.301869f,-0.301778f,-0.301686f,-0.301594f,-0.301503f,-0.301412f,-0.30132f,-0.301229f,-0.301137f,-0.301046f,-0.300955f,-0.300863f,-0.300772f,-0.30068f,-0.300589f,-0.300498f,-0.300406f,-0.300315f,-0.300223f,-0.300131f,-0.30004f,-0.299949f,-0.299857f,-0.299766f,-0.299674f,-0.299583f,-0.299491f,-0.2994f,-0.299308f,-0.299217f,-0.299126f,-0.299034f,-0.298943f,-0.298851f,-0.298759f,-0.298668f,-0.298576f,-0.298485f,-0.298393f,-0.298302f,-0.29821f,-0.298119f,-0.298027f,-0.297936f,-0.297844f,-0.297753f,-0.297661f,-0.29757f,-0.297478f,-0.297387f,-0.297295f,-0.297203f,-0.297112f,-0.29702f,-0.296929f,-0.296837f,-0.296746f,-0.296654f,-0.296563f,-0.296471f,-0.29638f,-0.296288f,-0.296197f,-0.296105f,-0.296014f,-0.295922f,-0.29583f,-0.295738f,-0.295647f,-0.295555f,-0.295464f,-0.295372f,-0.295281f,-0.295189f,-0.295097f,-0.295006f,-0.294914f,-0.294823f,-0.294731f,-0.29464f,-0.294548f,-0.294456f,-0.294365f,-0.294273f,-0.294181f,-0.294089f,-0.293998f,-0.293906f,-0.293815f,-0.293723f,-0.293631f,-0.29354f,-0.293448f,-0.293357f,-0.293265f,-0.293173f,-0.293082f,-0.29299f,-0.292898f,-0.292806f,-0.292715f,-0.292623f,-0.292531f,-0.29244f,-0.292348f,-0.292256f,-0.292165f,-0.292073f,-0.291981f,-0.29189f,-0.291798f,-0.291706f,-0.291615f,-0.291523f,-0.291431f,-0.291339f,-0.291248f,-0.291156f,-0.291064f,-0.290972f,-0.290881f,-0.290789f,-0.290697f,-0.290606f,-0.290514f,-0.290422f,-0.29033f,-0.290239f,-0.290147f,-0.290055f,-0.289964f,-0.289871f,-0.28978f,-0.289688f,-0.289596f,-0.289504f,-0.289413f,-0.289321f,-0.289229f,-0.289137f,-0.289046f,-0.288954f,-0.288862f,-0.28877f,-0.288679f,-0.288587f,-0.288495f,-0.288403f,-0.288311f,-0.288219f,-0.288128f,-0.288036f,-0.287944f,-0.287852f,-0.28776f,-0.287669f,-0.287577f,-0.287485f,-0.287393f,-0.287302f,-0.28721f,-0.287118f,-0.287026f,-0.286934f,-0.286842f,-0.28675f,-0.286658f,-0.286567f,-0.286475f,-0.286383f,-0.286291f,-0.286199f,-0.286107f,-0.286016f,-0.285924f,-0.285832f,-0.28574f,-0.285648f,-0.285556f,-0.285464f,-0.285372f,-0.28528f,-0.285188f,-0.285097f,-0.285005f,-0.284913f,-0.284821f,-0.284729f,-0.284637f,-0.284545f,-0.284453f,-0.284362f,-0.28427f,-0.284178f,-0.284086f,-0.283994f,-0.283902f,-0.28381f,-0.283718f,-0.283626f,-0.283534f,-0.283442f,-0.28335f,-0.283258f,-0.283166f,-0.283074f,-0.282982f,-0.282891f,-0.282799f,-0.282707f,-0.282615f,-0.282523f,-0.28243f,-0.282338f,-0.282247f,-0.282155f,-0.282063f,-0.281971f,-0.281879f,-0.281787f,-0.281695f,-0.281603f,-0.281511f,-0.281419f,-0.281327f,-0.281235f,-0.281143f,-0.281051f,-0.280959f,-0.280867f,-0.280775f,-0.280683f,-0.280591f,-0.280499f,-0.280407f,-0.280315f,-0.280223f,-0.280131f,-0.280039f,-0.279947f,-0.279855f,-0.279763f,-0.279671f,-0.279578f,-0.279486f,-0.279394f,-0.279302f,-0.27921f,-0.279118f,-0.279026f,-0.278934f,-0.278842f,-0.27875f,-0.278658f,-0.278566f,-0.278474f,-0.278382f,-0.278289f,-0.278197f,-0.278105f,-0.278013f,-0.277921f,-0.277829f,-0.277737f,-0.277645f,-0.277552f,-0.27746f,-0.277368f,-0.277276f,-0.277184f,-0.277092f,-0.277f,-0.276908f,-0.276816f,-0.276724f,-0.276632f,-0.276539f,-0.276447f,-0.276355f,-0.276263f,-0.276171f,-0.276078f,-0.275986f,-0.275894f,-0.275802f,-0.27571f,-0.275618f,-0.275526f,-0.275434f,-0.275341f,-0.275249f,-0.275157f,-0.275065f,-0.274972f,-0.27488f,-0.274788f,-0.274696f,-0.274604f,-0.274512f,-0.274419f,-0.274327f,-0.274235f,-0.274143f,-0.274051f,-0.273959f,-0.273866f,-0.273774f,-0.273682f,-0.27359f,-0.273497f,-0.273405f,-0.273313f,-0.273221f,-0.273128f,-0.273036f,-0.272944f,-0.272852f,-0.27276f,-0.272667f,-0.272575f,-0.272483f,-0.272391f,-0.272298f,-0.272206f,-0.272114f,-0.272021f,-0.271929f,-0.271837f,-0.271745f,-0.271652f,-0.27156f,-0.271468f,-0.271376f,-0.271283f,-0.271191f,-0.271099f,-0.271007f,-0.270914f,-0.270822f,-0.27073f,-0.270638f,-0.270545f,-0.270453f,-0.27036f,-0.270268f,-0.270176f,-0.270084f,-0.269991f,-0.269899f,-0.269807f,-0.269714f,-0.269622f,-0.26953f,-0.269437f,-0.269345f,-0.269253f,-0.269161f,-0.269068f,-0.268975f,-0.268883f,-0.268791f,-0.268699f,-0.268606f,-0.268514f,-0.268422f,-0.268329f,-0.268237f,-0.268145f,-0.268052f,-0.26796f,-0.267868f,-0.267775f,-0.267683f,-0.26759f,-0.267498f,-0.267405f,-0.267313f,-0.267221f,-0.267128f,-0.267036f,-0.266944f,-0.266851f,-0.266759f,-0.266666f,-0.266574f,-0.266482f,-0.266389f,-0.266297f,-0.266205f,-0.266112f,-0.266019f,-0.265927f,-0.265835f,-0.265742f,-0.26565f,-0.265557f,-0.265465f,-0.265373f,-0.26528f,-0.265188f,-0.265095f,-0.265003f,-0.26491f,-0.264818f,-0.264726f,-0.264633f,-0.26454f,-0.264448f,-0.264355f,-0.264263f,-0.264171f,-0.264078f,-0.263986f,-0.263893f,-0.263801f,-0.263708f,-0.263616f,-0.263523f,-0.263431f,-0.263339f,-0.263246f,-0.263154f,-0.263061f,-0.262968f,-0.262876f,-0.262783f,-0.262691f,-0.262598f,-0.262506f,-0.262413f,-0.262321f,-0.262228f,-0.262136f,-0.262043f,-0.261951f,-0.261858f,-0.261766f,-0.261673f,-0.26158f,-0.261488f,-0.261395f,-0.261303f,-0.26121f,-0.261118f,-0.261025f,-0.260933f,-0.26084f,-0.260748f,-0.260655f,-0.260563f,-0.26047f,-0.260378f,-0.260285f,-0.260193f,-0.2601f,-0.260007f,-0.259914f,-0.259822f,-0.259729f,-0.259637f,-0.259544f,-0.259452f,-0.259359f,-0.259266f,-0.259174f,-0.259081f,-0.258989f,-0.258896f,-0.258804f,-0.258711f,-0.258618f,-0.258525f,-0.258433f,-0.25834f,-0.258248f,-0.258155f,-0.258062f,-0.25797f,-0.257877f,-0.257785f,-0.257692f,-0.257599f,-0.257507f,-0.257414f,-0.257322f,-0.257229f,-0.257136f,-0.257043f,-0.256951f,-0.256858f,-0.256765f,-0.256673f,-0.25658f,-0.256487f,-0.256395f,-0.256302f,-0.25621f,-0.256117f,-0.256024f,-0.255932f,-0.255839f,-0.255746f,-0.255654f,-0.255561f,-0.255468f,-0.255375f,-0.255283f,-0.25519f,-0.255097f,-0.255005f,-0.254912f,-0.254819f,-0.254726f,-0.254634f,-0.254541f,-0.254448f,-0.254356f,-0.254263f,-0.25417f,-0.254077f,-0.253984f,-0.253892f,-0.253799f,-0.253706f,-0.253614f,-0.253521f,-0.253428f,-0.253336f,-0.253243f,-0.25315f,-0.253057f,-0.252965f,-0.252872f,-0.252779f,-0.252686f,-0.252593f,-0.252501f,-0.252408f,-0.252315f,-0.252222f,-0.25213f,-0.252037f,-0.251944f,-0.251851f,-0.251759f,-0.251666f,-0.251573f,-0.25148f,-0.251387f,-0.251295f,-0.251202f,-0.251109f,-0.251016f,-0.250923f,-0.25083f,-0.250738f,-0.250645f,-0.250552f,-0.250459f,-0.250366f,-0.250274f,-0.250181f,-0.250088f,-0.249995f,-0.249902f,-0.24981f,-0.249717f,-0.249624f,-0.249531f,-0.249438f,-0.249345f,-0.249252f,-0.24916f,-0.249067f,-0.248974f,-0.248881f,-0.248788f,-0.248695f,-0.248603f,-0.24851f,-0.248417f,-0.248324f,-0.248231f,-0.248138f,-0.248045f,-0.247952f,-0.247859f,-0.247766f,-0.247674f,-0.247581f,-0.247488f,-0.247395f,-0.247302f,-0.247209f,-0.247116f,-0.247024f,-0.246931f,-0.246838f,-0.246745f,-0.246652f,-0.246559f,-0.246466f,-0.246373f,-0.24628f,-0.246187f,-0.246094f,-0.246001f,-0.245908f,-0.245816f,-0.245723f,-0.24563f,-0.245537f,-0.245444f,-0.245351f,-0.245258f,-0.245165f,-0.245072f,-0.244979f,-0.244886f,-0.244793f,-0.2447f,-0.244607f,-0.244514f,-0.244421f,-0.244328f,-0.244235f,-0.244142f,-0.244049f,-0.243957f,-0.243864f,-0.243771f,-0.243678f,-0.243584f,-0.243491f,-0.243398f,-0.243305f,-0.243212f,-0.243119f,-0.243026f,-0.242934f,-0.242841f,-0.242748f,-0.242655f,-0.242562f,-0.242469f,-0.242376f,-0.242283f,-0.24219f,-0.242096f,-0.242003f,-0.24191f,-0.241817f,-0.241724f,-0.241631f,-0.241538f,-0.241445f,-0.241352f,-0.241259f,-0.241166f,-0.241073f,-0.24098f,-0.240887f,-0.240794f,-0.240701f,-0.240608f,-0.240515f,-0.240422f,-0.240328f,-0.240235f,-0.240142f,-0.240049f,-0.239956f,-0.239863f,-0.23977f,-0.239677f,-0.239584f,-0.239491f,-0.239398f,-0.239305f,-0.239212f,-0.239118f,-0.239025f,-0.238932f,-0.238839f,-0.238746f,-0.238653f,-0.23856f,-0.238467f,-0.238374f,-0.238281f,-0.238188f,-0.238095f,-0.238001f,-0.237908f,-0.237815f,-0.237722f,-0.237629f,-0.237535f,-0.237442f,-0.237349f,-0.237256f,-0.237163f,-0.23707f,-0.236977f,-0.236884f,-0.236791f,-0.236697f,-0.236604f,-0.236511f,-0.236418f,-0.236325f,-0.236232f,-0.236139f,-0.236045f,-0.235952f,-0.235859f,-0.235766f,-0.235673f,-0.235579f,-0.235486f,-0.235393f,-0.2353f,-0.235207f,-0.235114f,-0.235021f,-0.234927f,-0.234834f,-0.234741f,-0.234648f,-0.234554f,-0.234461f,-0.234368f,-0.234275f,-0.234182f,-0.234088f,-0.233995f,-0.233902f,-0.233809f,-0.233716f,-0.233622f,-0.233529f,-0.233436f,-0.233343f,-0.23325f,-0.233156f,-0.233063f,-0.23297f,-0.232876f,-0.232783f,-0.23269f,-0.232597f,-0.232503f,-0.23241f,-0.232317f,-0.232224f,-0.232131f,-0.232037f,-0.231944f,-0.231851f,-0.231758f,-0.231664f,-0.231571f,-0.231477f,-0.231384f,-0.231291f,-0.231198f,-0.231105f,-0.231011f,-0.230918f,-0.230825f,-0.230732f,-0.230638f,-0.230545f,-0.230452f,-0.230358f,-0.230265f,-0.230172f,-0.230078f,-0.229985f,-0.229892f,-0.229798f,-0.229705f,-0.229612f,-0.229519f,-0.229425f,-0.229332f,-0.229239f,-0.229145f,-0.229052f,-0.228959f,-0.228865f,-0.228772f,-0.228679f,-0.228585f,-0.228492f,-0.228398f,-0.228305f,-0.228212f,-0.228119f,-0.228025f,-0.227932f,-0.227839f,-0.227745f,-0.227652f,-0.227559f,-0.227465f,-0.227372f,-0.227279f,-0.227185f,-0.227091f,-0.226998f,-0.226905f,-0.226811f,-0.226718f,-0.226625f,-0.226531f,-0.226438f,-0.226345f,-0.226251f,-0.226158f,-0.226065f,-0.225971f,-0.225878f,-0.225784f,-0.225691f,-0.225598f,-0.225504f,-0.225411f,-0.225317f,-0.225224f,-0.22513f,-0.225037f,-0.224944f,-0.22485f,-0.224757f,-0.224663f,-0.22457f,-0.224477f,-0.224383f,-0.22429f,-0.224196f,-0.224103f,-0.224009f,-0.223916f,-0.223822f,-0.223729f,-0.223635f,-0.223542f,-0.223449f,-0.223355f,-0.223262f,-0.223168f,-0.223075f,-0.222982f,-0.222888f,-0.222795f,-0.222701f,-0.222608f,-0.222514f,-0.22242f,-0.222327f,-0.222234f,-0.22214f,-0.222047f,-0.221953f,-0.22186f,-0.221766f,-0.221673f,-0.221579f,-0.221486f,-0.221392f,-0.221299f,-0.221206f,-0.221112f,-0.221018f,-0.220925f,-0.220831f,-0.220738f,-0.220644f,-0.220551f,-0.220457f,-0.220364f,-0.22027f,-0.220177f,-0.220083f,-0.21999f,-0.219896f,-0.219803f,-0.219709f,-0.219616f,-0.219522f,-0.219428f,-0.219335f,-0.219241f,-0.219148f,-0.219054f,-0.218961f,-0.218867f,-0.218774f,-0.21868f,-0.218587f,-0.218493f,-0.2184f,-0.218306f,-0.218213f,-0.218119f,-0.218025f,-0.217931f,-0.217838f,-0.217744f,-0.217651f,-0.217557f,-0.217464f,-0.21737f,-0.217277f,-0.217183f,-0.217089f,-0.216996f,-0.216902f,-0.216809f,-0.216715f,-0.216622f,-0.216528f,-0.216434f,-0.21634f,-0.216247f,-0.216153f,-0.21606f,-0.215966f,-0.215873f,-0.215779f,-0.215685f,-0.215592f,-0.215498f,-0.215405f,-0.215311f,-0.215217f,-0.215124f,-0.21503f,-0.214936f,-0.214843f,-0.214749f,-0.214655f,-0.214562f,-0.214468f,-0.214375f,-0.214281f,-0.214187f,-0.214094f,-0.214f,-0.213906f,-0.213813f,-0.213719f,-0.213626f,-0.213532f,-0.213438f,-0.213344f,-0.213251f,-0.213157f,-0.213063f,-0.21297f,-0.212876f,-0.212782f,-0.212689f,-0.212595f,-0.212501f,-0.212408f,-0.212314f,-0.21222f,-0.212127f,-0.212033f,-0.211939f,-0.211845f,-0.211752f,-0.211658f,-0.211564f,-0.211471f,-0.211377f,-0.211283f,-0.211189f,-0.211096f,-0.211002f,-0.210908f,-0.210815f,-0.210721f,-0.210627f,-0.210534f,-0.21044f,-0.210346f,-0.210252f,-0.210158f,-0.210065f,-0.209971f,-0.209877f,-0.209784f,-0.20969f,-0.209596f,-0.209502f,-0.209409f,-0.209315f,-0.209221f,-0.209128f,-0.209034f,-0.20894f,-0.208846f,-0.208752f,-0.208658f,-0.208565f,-0.208471f,-0.208377f,-0.208283f,-0.20819f,-0.208096f,-0.208002f,-0.207908f,-0.207815f,-0.207721f,-0.207627f,-0.207533f,-0.207439f,-0.207346f,-0.207252f,-0.207158f,-0.207064f,-0.20697f,-0.206877f,-0.206783f,-0.206689f,-0.206595f,-0.206502f,-0.206408f,-0.206314f,-0.20622f,-0.206126f,-0.206033f,-0.205938f,-0.205845f,-0.205751f,-0.205657f,-0.205563f,-0.205469f,-0.205376f,-0.205282f,-0.205188f,-0.205094f,-0.205f,-0.204907f,-0.204813f,-0.204719f,-0.204625f,-0.204531f,-0.204438f,-0.204343f,-0.204249f,-0.204156f,-0.204062f,-0.203968f,-0.203874f,-0.20378f,-0.203686f,-0.203593f,-0.203499f,-0.203405f,-0.203311f,-0.203217f,-0.203123f,-0.20303f,-0.202936f,-0.202841f,-0.202748f,-0.202654f,-0.20256f,-0.202466f,-0.202372f,-0.202278f,-0.202184f,-0.202091f,-0.201997f,-0.201903f,-0.201809f,-0.201715f,-0.201621f,-0.201527f,-0.201433f,-0.201339f,-0.201245f,-0.201151f,-0.201057f,-0.200963f,-0.20087f,-0.200776f,-0.200682f,-0.200588f,-0.200494f,-0.2004f,-0.200306f,-0.200212f,-0.200118f,-0.200025f,-0.199931f,-0.199836f,-0.199742f,-0.199648f,-0.199554f,-0.199461f,-0.199367f,-0.199273f,-0.199179f,-0.199085f,-0.198991f,-0.198897f,-0.198803f,-0.198709f,-0.198615f,-0.198521f,-0.198427f,-0.198333f,-0.198239f,-0.198145f,-0.198051f,-0.197957f,-0.197863f,-0.197769f,-0.197675f,-0.197581f,-0.197487f,-0.197393f,-0.197299f,-0.197206f,-0.197112f,-0.197018f,-0.196924f,-0.196829f,-0.196735f,-0.196641f,-0.196547f,-0.196453f,-0.196359f,-0.196265f,-0.196171f,-0.196077f,-0.195983f,-0.195889f,-0.195795f,-0.195701f,-0.195607f,-0.195513f,-0.195419f,-0.195325f,-0.195231f,-0.195137f,-0.195043f,-0.194949f,-0.194855f,-0.194761f,-0.194667f,-0.194573f,-0.194479f,-0.194385f,-0.194291f,-0.194197f,-0.194103f,-0.194009f,-0.193915f,-0.193821f,-0.193726f,-0.193632f,-0.193538f,-0.193444f,-0.19335f,-0.193256f,-0.193162f,-0.193068f,-0.192974f,-0.19288f,-0.192786f,-0.192692f,-0.192598f,-0.192504f,-0.19241f,-0.192316f,-0.192221f,-0.192127f,-0.192033f,-0.191939f,-0.191845f,-0.191751f,-0.191657f,-0.191563f,-0.191469f,-0.191375f,-0.19128f,-0.191186f,-0.191092f,-0.190998f,-0.190904f,-0.19081f,-0.190716f,-0.190621f,-0.190527f,-0.190433f,-0.190339f,-0.190245f,-0.190151f,-0.190057f,-0.189963f,-0.189869f,-0.189775f,-0.189681f,-0.189586f,-0.189492f,-0.189398f,-0.189304f,-0.189209f,-0.189115f,-0.189021f,-0.188927f,-0.188833f,-0.188739f,-0.188645f,-0.188551f,-0.188457f,-0.188362f,-0.188268f,-0.188174f,-0.18808f,-0.187986f,-0.187892f,-0.187798f,-0.187703f,-0.187609f,-0.187515f,-0.187421f,-0.187326f,-0.187232f,-0.187138f,-0.187044f,-0.18695f,-0.186856f,-0.186761f,-0.186667f,-0.186573f,-0.186479f,-0.186385f,-0.186291f,-0.186196f,-0.186102f,-0.186008f,-0.185914f,-0.185819f,-0.185725f,-0.185631f,-0.185537f,-0.185443f,-0.185348f,-0.185254f,-0.18516f,-0.185066f,-0.184972f,-0.184878f,-0.184783f,-0.184689f,-0.184594f,-0.1845f,-0.184406f,-0.184312f,-0.184218f,-0.184123f,-0.184029f,-0.183935f,-0.183841f,-0.183747f,-0.183652f,-0.183558f,-0.183464f,-0.18337f,-0.183276f,-0.183181f,-0.183087f,-0.182992f,-0.182898f,-0.182804f,-0.18271f,-0.182616f,-0.182521f,-0.182427f,-0.182333f,-0.182239f,-0.182144f,-0.18205f,-0.181956f,-0.181862f,-0.181767f,-0.181673f,-0.181578f,-0.181484f,-0.18139f,-0.181296f,-0.181201f,-0.181107f,-0.181013f,-0.180919f,-0.180824f,-0.18073f,-0.180636f,-0.180542f,-0.180447f,-0.180353f,-0.180259f,-0.180164f,-0.18007f,-0.179975f,-0.179881f,-0.179787f,-0.179693f,-0.179598f,-0.179504f,-0.17941f,-0.179315f,-0.179221f,-0.179127f,-0.179033f,-0.178938f,-0.178844f,-0.17875f,-0.178655f,-0.178561f,-0.178466f,-0.178372f,-0.178278f,-0.178183f,-0.178089f,-0.177995f,-0.1779f,-0.177806f,-0.177712f,-0.177617f,-0.177523f,-0.177429f,-0.177334f,-0.17724f,-0.177146f,-0.177051f,-0.176957f,-0.176862f,-0.176768f,-0.176674f,-0.176579f,-0.176485f,-0.176391f,-0.176296f,-0.176202f,-0.176108f,-0.176013f,-0.175919f,-0.175825f,-0.17573f,-0.175636f,-0.175541f,-0.175447f,-0.175352f,-0.175258f,-0.175164f,-0.175069f,-0.174975f,-0.174881f,-0.174786f,-0.174692f,-0.174597f,-0.174503f,-0.174409f,-0.174314f,-0.17422f,-0.174126f,-0.174031f,-0.173936f,-0.173842f,-0.173748f,-0.173653f,-0.173559f,-0.173464f,-0.17337f,-0.173276f,-0.173181f,-0.173087f,-0.172992f,-0.172898f,-0.172804f,-0.172709f,-0.172615f,-0.17252f,-0.172425f,-0.172331f,-0.172237f,-0.172142f,-0.172048f,-0.171953f,-0.171859f,-0.171765f,-0.17167f,-0.171576f,-0.171481f,-0.171387f,-0.171292f,-0.171198f,-0.171104f,-0.171009f,-0.170914f,-0.17082f,-0.170725f,-0.170631f,-0.170537f,-0.170442f,-0.170348f,-0.170253f,-0.170159f,-0.170064f,-0.16997f,-0.169875f,-0.169781f,-0.169686f,-0.169592f,-0.169498f,-0.169403f,-0.169308f,-0.169214f,-0.169119f,-0.169025f,-0.16893f,-0.168836f,-0.168741f,-0.168647f,-0.168552f,-0.168458f,-0.168364f,-0.168269f,-0.168175f,-0.16808f,-0.167986f,-0.167891f,-0.167796f,-0.167702f,-0.167607f,-0.167513f,-0.167418f,-0.167324f,-0.167229f,-0.167135f,-0.16704f,-0.166946f,-0.166851f,-0.166757f,-0.166662f,-0.166568f,-0.166473f,-0.166378f,-0.166284f,-0.166189f,-0.166095f,-0.166f,-0.165906f,-0.165811f,-0.165717f,-0.165622f,-0.165528f,-0.165433f,-0.165339f,-0.165244f,-0.165149f,-0.165055f,-0.16496f,-0.164865f,-0.164771f,-0.164676f,-0.164582f,-0.164487f,-0.164393f,-0.164298f,-0.164204f,-0.164109f,-0.164015f,-0.16392f,-0.163825f,-0.163731f,-0.163636f,-0.163542f,-0.163447f,-0.163353f,-0.163258f,-0.163163f,-0.163069f,-0.162974f,-0.162879f,-0.162785f,-0.16269f,-0.162596f,-0.162501f,-0.162407f,-0.162312f,-0.162217f,-0.162123f,-0.162028f,-0.161934f,-0.161839f,-0.161744f,-0.16165f,-0.161555f,-0.16146f,-0.161366f,-0.161271f,-0.161177f,-0.161082f,-0.160987f,-0.160893f,-0.160798f,-0.160704f,-0.160609f,-0.160514f,-0.16042f,-0.160325f,-0.16023f,-0.160136f,-0.160041f,-0.159946f,-0.159852f,-0.159757f,-0.159662f,-0.159568f,-0.159473f,-0.159379f,-0.159284f,-0.159189f,-0.159095f,-0.159f,-0.158905f,-0.158811f,-0.158716f,-0.158621f,-0.158527f,-0.158432f,-0.158337f,-0.158243f,-0.158148f,-0.158053f,-0.157959f,-0.157864f,-0.157769f,-0.157675f,-0.15758f,-0.157485f,-0.157391f,-0.157296f,-0.157201f,-0.157106f,-0.157012f,-0.156917f,-0.156822f,-0.156728f,-0.156633f,-0.156538f,-0.156444f,-0.156349f,-0.156254f,-0.15616f,-0.156065f,-0.15597f,-0.155876f,-0.155781f,-0.155686f,-0.155591f,-0.155497f,-0.155402f,-0.155307f,-0.155213f,-0.155118f,-0.155023f,-0.154928f,-0.154834f,-0.154739f,-0.154644f,-0.15455f,-0.154455f,-0.15436f,-0.154266f,-0.15417f,-0.154076f,-0.153981f,-0.153886f,-0.153792f,-0.153697f,-0.153602f,-0.153508f,-0.153413f,-0.153318f,-0.153223f,-0.153129f,-0.153034f,-0.152939f,-0.152845f,-0.15275f,-0.152655f,-0.15256f,-0.152465f,-0.15237f,-0.152276f,-0.152181f,-0.152086f,-0.151992f,-0.151897f,-0.151802f,-0.151707f,-0.151613f,-0.151518f,-0.151423f,-0.151328f,-0.151234f,-0.151139f,-0.151044f,-0.150949f,-0.150854f,-0.150759f,-0.150665f,-0.15057f,-0.150475f,-0.15038f,-0.150286f,-0.150191f,-0.150096f,-0.150001f,-0.149907f,-0.149812f,-0.149717f,-0.149622f,-0.149527f,-0.149432f,-0.149338f,-0.149243f,-0.149148f,-0.149053f,-0.148959f,-0.148864f,-0.148769f,-0.148674f,-0.148579f,-0.148485f,-0.14839f,-0.148295f,-0.1482f,-0.148106f,-0.14801f,-0.147915f,-0.147821f,-0.147726f,-0.147631f,-0.147536f,-0.147441f,-0.147347f,-0.147252f,-0.147157f,-0.147062f,-0.146967f,-0.146873f,-0.146778f,-0.146683f,-0.146588f,-0.146493f,-0.146398f,-0.146303f,-0.146209f,-0.146114f,-0.146019f,-0.145924f,-0.145829f,-0.145734f,-0.14564f,-0.145545f,-0.14545f,-0.145355f,-0.14526f,-0.145166f,-0.145071f,-0.144975f,-0.144881f,-0.144786f,-0.144691f,-0.144596f,-0.144501f,-0.144406f,-0.144312f,-0.144217f,-0.144122f,-0.144027f,-0.143932f,-0.143837f,-0.143742f,-0.143648f,-0.143553f,-0.143457f,-0.143363f,-0.143268f,-0.143173f,-0.143078f,-0.142983f,-0.142888f,-0.142793f,-0.142699f,-0.142604f,-0.142509f,-0.142414f,-0.142319f,-0.142224f,-0.142129f,-0.142034f,-0.14194f,-0.141844f,-0.141749f,-0.141655f,-0.14156f,-0.141465f,-0.14137f,-0.141275f,-0.14118f,-0.141085f,-0.14099f,-0.140895f,-0.140801f,-0.140706f,-0.140611f,-0.140516f,-0.140421f,-0.140326f,-0.140231f,-0.140136f,-0.140041f,-0.139946f,-0.139851f,-0.139756f,-0.139661f,-0.139566f,-0.139472f,-0.139377f,-0.139282f,-0.139187f,-0.139092f,-0.138997f,-0.138902f,-0.138807f,-0.138712f,-0.138617f,-0.138522f,-0.138427f,-0.138332f,-0.138237f,-0.138142f,-0.138047f,-0.137952f,-0.137857f,-0.137763f,-0.137668f,-0.137573f,-0.137478f,-0.137383f,-0.137287f,-0.137192f,-0.137097f,-0.137003f,-0.136908f,-0.136813f,-0.136718f,-0.136623f,-0.136528f,-0.136433f,-0.136338f,-0.136243f,-0.136148f,-0.136053f,-0.135958f,-0.135863f,-0.135768f,-0.135673f,-0.135578f,-0.135483f,-0.135388f,-0.135293f,-0.135198f,-0.135103f,-0.135008f,-0.134913f,-0.134818f,-0.134723f,-0.134628f,-0.134533f,-0.134438f,-0.134343f,-0.134248f,-0.134153f,-0.134058f,-0.133963f,-0.133868f,-0.133773f,-0.133678f,-0.133583f,-0.133488f,-0.133393f,-0.133298f,-0.133203f,-0.133108f,-0.133013f,-0.132918f,-0.132823f,-0.132728f,-0.132633f,-0.132538f,-0.132443f,-0.132348f,-0.132253f,-0.132158f,-0.132063f,-0.131968f,-0.131873f,-0.131778f,-0.131683f,-0.131587f,-0.131492f,-0.131397f,-0.131302f,-0.131207f,-0.131112f,-0.131017f,-0.130922f,-0.130827f,-0.130732f,-0.130637f,-0.130542f,-0.130447f,-0.130352f,-0.130257f,-0.130162f,-0.130067f,-0.129972f,-0.129877f,-0.129782f,-0.129687f,-0.129591f,-0.129496f,-0.129401f,-0.129306f,-0.129211f,-0.129116f,-0.129021f,-0.128926f,-0.128831f,-0.128736f,-0.128641f,-0.128546f,-0.128451f,-0.128355f,-0.12826f,-0.128165f,-0.12807f,-0.127975f,-0.12788f,-0.127785f,-0.12769f,-0.127595f,-0.1275f,-0.127404f,-0.127309f,-0.127214f,-0.127119f,-0.127024f,-0.126929f,-0.126834f,-0.126739f,-0.126644f,-0.126548f,-0.126453f,-0.126358f,-0.126263f,-0.126168f,-0.126073f,-0.125978f,-0.125883f,-0.125788f,-0.125693f,-0.125598f,-0.125502f,-0.125407f,-0.125312f,-0.125217f,-0.125122f,-0.125027f,-0.124931f,-0.124836f,-0.124741f,-0.124646f,-0.124551f,-0.124456f,-0.124361f,-0.124266f,-0.124171f,-0.124076f,-0.12398f,-0.123885f,-0.12379f,-0.123695f,-0.1236f,-0.123504f,-0.123409f,-0.123314f,-0.123219f,-0.123124f,-0.123029f,-0.122934f,-0.122839f,-0.122744f,-0.122648f,-0.122553f,-0.122458f,-0.122363f,-0.122268f,-0.122173f,-0.122078f,-0.121982f,-0.121887f,-0.121792f,-0.121697f,-0.121602f,-0.121506f,-0.121411f,-0.121316f,-0.121221f,-0.121126f,-0.121031f,-0.120936f,-0.12084f,-0.120745f,-0.12065f,-0.120555f,-0.12046f,-0.120364f,-0.120269f,-0.120174f,-0.120079f,-0.119984f,-0.119888f,-0.119793f,-0.119698f,-0.119603f,-0.119508f,-0.119413f,-0.119318f,-0.119222f,-0.119127f,-0.119032f,-0.118937f,-0.118841f,-0.118746f,-0.118651f,-0.118556f,-0.118461f,-0.118365f,-0.11827f,-0.118175f,-0.11808f,-0.117985f,-0.11789f,-0.117794f,-0.117699f,-0.117604f,-0.117509f,-0.117414f,-0.117318f,-0.117223f,-0.117128f,-0.117032f,-0.116937f,-0.116842f,-0.116747f,-0.116652f,-0.116557f,-0.116461f,-0.116366f,-0.116271f,-0.116176f,-0.116081f,-0.115985f,-0.11589f,-0.115794f,-0.115699f,-0.115604f,-0.115509f,-0.115414f,-0.115318f,-0.115223f,-0.115128f,-0.115033f,-0.114938f,-0.114842f,-0.114747f,-0.114652f,-0.114557f,-0.114462f,-0.114366f,-0.114271f,-0.114175f,-0.11408f,-0.113985f,-0.11389f,-0.113795f,-0.113699f,-0.113604f,-0.113509f,-0.113414f,-0.113318f,-0.113223f,-0.113128f,-0.113033f,-0.112938f,-0.112842f,-0.112747f,-0.112651f,-0.112556f,-0.112461f,-0.112366f,-0.11227f,-0.112175f,-0.11208f,-0.111985f,-0.111889f,-0.111794f,-0.111699f,-0.111604f,-0.111509f,-0.111413f,-0.111318f,-0.111222f,-0.111127f,-0.111032f,-0.110937f,-0.110841f,-0.110746f,-0.110651f,-0.110556f,-0.11046f,-0.110365f,-0.11027f,-0.110174f,-0.110079f,-0.109984f,-0.109889f,-0.109793f,-0.109698f,-0.109602f,-0.109507f,-0.109412f,-0.109317f,-0.109221f,-0.109126f,-0.109031f,-0.108936f,-0.10884f,-0.108745f,-0.10865f,-0.108554f,-0.108459f,-0.108364f,-0.108269f,-0.108173f,-0.108078f,-0.107982f,-0.107887f,-0.107792f,-0.107696f,-0.107601f,-0.107506f,-0.107411f,-0.107315f,-0.10722f,-0.107125f,-0.107029f,-0.106934f,-0.106839f,-0.106743f,-0.106648f,-0.106552f,-0.106457f,-0.106362f,-0.106267f,-0.106171f,-0.106076f,-0.105981f,-0.105885f,-0.10579f,-0.105695f,-0.105599f,-0.105504f,-0.105409f,-0.105313f,-0.105218f,-0.105123f,-0.105027f,-0.104932f,-0.104836f,-0.104741f,-0.104646f,-0.10455f,-0.104455f,-0.10436f,-0.104264f,-0.104169f,-0.104074f,-0.103979f,-0.103883f,-0.103788f,-0.103693f,-0.103597f,-0.103501f,-0.103406f,-0.103311f,-0.103215f,-0.10312f,-0.103025f,-0.102929f,-0.102834f,-0.102739f,-0.102643f,-0.102548f,-0.102453f,-0.102357f,-0.102262f,-0.102167f,-0.102071f,-0.101976f,-0.10188f,-0.101785f,-0.10169f,-0.101594f,-0.101499f,-0.101403f,-0.101308f,-0.101213f,-0.101117f,-0.101022f,-0.100927f,-0.100831f,-0.100736f,-0.100641f,-0.100545f,-0.10045f,-0.100354f,-0.100259f,-0.100163f,-0.100068f,-.0999726f,-.0998773f,-.0997819f,-.0996865f,-.0995912f,-.0994958f,-.0994004f,-.0993051f,-.0992097f,-.0991143f,-.0990189f,-.0989236f,-.0988277f,-.0987324f,-.098637f,-.0985416f,-.0984462f,-.0983508f,-.0982555f,-.0981601f,-.0980647f,-.0979693f,-.0978739f,-.0977785f,-.0976832f,-.0975878f,-.0974924f,-.097397f,-.0973011f,-.0972057f,-.0971104f,-.097015f,-.0969196f,-.0968242f,-.0967288f,-.0966334f,-.096538f,-.0964426f,-.0963472f,-.0962518f,-.0961564f,-.096061f,-.0959656f,-.0958702f,-.0957743f,-.0956789f,-.0955835f,-.0954881f,-.0953927f,-.0952973f,-.0952019f,-.0951065f,-.0950111f,-.0949156f,-.0948202f,-.0947248f,-.0946294f,-.094534f,-.0944386f,-.0943432f,-.0942473f,-.0941519f,-.0940564f,-.093961f,-.0938656f,-.0937702f,-.0936747f,-.0935793f,-.0934839f,-.0933885f,-.093293f,-.0931976f,-.0931022f,-.0930068f,-.0929113f,-.0928159f,-.09272f,-.0926246f,-.0925291f,-.0924337f,-.0923383f,-.0922428f,-.0921474f,-.092052f,-.0919565f,-.0918611f,-.0917656f,-.0916702f,-.0915748f,-.0914793f,-.0913839f,-.0912884f,-.0911925f,-.0910971f,-.0910016f,-.0909062f,-.0908107f,-.0907153f,-.0906198f,-.0905244f,-.0904289f,-.0903335f,-.090238f,-.0901426f,-.0900471f,-.0899517f,-.0898562f,-.0897608f,-.0896653f,-.0895694f,-.0894739f,-.0893784f,-.089283f,-.0891875f,-.0890921f,-.0889966f,-.0889011f,-.0888057f,-.0887102f,-.0886147f,-.0885193f,-.0884238f,-.0883283f,-.0882329f,-.0881374f,-.0880414f,-.087946f,-.0878505f,-.087755f,-.0876595f,-.0875641f,-.0874686f,-.0873731f,-.0872776f,-.0871821f,-.0870867f,-.0869912f,-.0868957f,-.0868002f,-.0867047f,-.0866093f,-.0865133f,-.0864178f,-.0863223f,-.0862268f,-.0861314f,-.0860359f,-.0859404f,-.0858449f,-.0857494f,-.0856539f,-.0855584f,-.0854629f,-.0853674f,-.0852719f,-.0851764f,-.0850809f,-.084985f,-.0848895f,-.084794f,-.0846985f,-.084603f,-.0845075f,-.084412f,-.0843165f,-.084221f,-.0841255f,-.08403f,-.0839344f,-.0838389f,-.0837434f,-.0836479f,-.0835524f,-.0834564f,-.0833609f,-.0832654f,-.0831699f,-.0830744f,-.0829789f,-.0828834f,-.0827878f,-.0826923f,-.0825968f,-.0825013f,-.0824058f,-.0823103f,-.0822147f,-.0821192f,-.0820237f,-.0819277f,-.0818322f,-.0817367f,-.0816411f,-.0815456f,-.0814501f,-.0813546f,-.081259f,-.0811635f,-.081068f,-.0809724f,-.0808769f,-.0807814f,-.0806859f,-.0805903f,-.0804948f,-.0803988f,-.0803032f,-.0802077f,-.0801122f,-.0800166f,-.0799211f,-.0798256f,-.07973f,-.0796345f,-.0795389f,-.0794434f,-.0793479f,-.0792523f,-.0791568f,-.0790612f,-.0789657f,-.0788701f,-.0787741f,-.0786786f,-.078583f,-.0784875f,-.0783919f,-.0782964f,-.0782008f,-.0781053f,-.0780097f,-.0779142f,-.0778186f,-.0777231f,-.0776275f,-.077532f,-.0774364f,-.0773408f,-.0772448f,-.0771492f,-.0770537f,-.0769581f,-.0768626f,-.076767f,-.0766714f,-.0765759f,-.0764803f,-.0763848f,-.0762892f,-.0761936f,-.0760981f,-.0760025f,-.0759069f,-.0758114f,-.0757153f,-.0756197f,-.0755242f,-.0754286f,-.075333f,-.0752375f,-.0751419f,-.0750463f,-.0749507f,-.0748552f,-.0747596f,-.074664f,-.0745684f,-.0744729f,-.0743773f,-.0742817f,-.0741856f,-.0740901f,-.0739945f,-.0738989f,-.0738033f,-.0737077f,-.0736122f,-.0735166f,-.073421f,-.0733254f,-.0732298f,-.0731342f,-.0730386f,-.072943f,-.0728475f,-.0727519f,-.0726558f,-.0725602f,-.0724646f,-.072369f,-.0722734f,-.0721778f,-.0720822f,-.0719866f,-.0718911f,-.0717955f,-.0716999f,-.0716043f,-.0715087f,-.0714131f,-.0713175f,-.0712219f,-.0711258f,-.0710302f,-.0709346f,-.070839f,-.0707434f,-.0706478f,-.0705522f,-.0704566f,-.070361f,-.0702653f,-.0701697f,-.0700741f,-.0699785f,-.0698829f,-.0697873f,-.0696917f,-.0695956f,-.0695f,-.0694044f,-.0693088f,-.0692132f,-.0691175f,-.0690219f,-.0689263f,-.0688307f,-.0687351f,-.0686394f,-.0685438f,-.0684482f,-.0683526f,-.068257f,-.0681614f,-.0680657f,-.0679696f,-.067874f,-.0677784f,-.0676828f,-.0675871f,-.0674915f,-.0673959f,-.0673003f,-.0672046f,-.067109f,-.0670134f,-.0669177f,-.0668221f,-.0667265f,-.0666309f,-.0665352f,-.0664391f,-.0663435f,-.0662479f,-.0661522f,-.0660566f,-.0659609f,-.0658653f,-.0657697f,-.065674f,-.0655784f,-.0654828f,-.0653871f,-.0652915f,-.0651958f,-.0651002f,-.0650046f,-.0649084f,-.0648128f,-.0647172f,-.0646215f,-.0645259f,-.0644302f,-.0643346f,-.0642389f,-.0641433f,-.0640476f,-.063952f,-.0638563f,-.0637607f,-.063665f,-.0635694f,-.0634737f,-.0633776f,-.063282f,-.0631863f,-.0630907f,-.062995f,-.0628994f,-.0628037f,-.062708f,-.0626124f,-.0625167f,-.0624211f,-.0623254f,-.0622298f,-.0621341f,-.0620384f,-.0619428f,-.0618466f,-.061751f,-.0616553f,-.0615597f,-.061464f,-.0613683f,-.0612727f,-.061177f,-.0610813f,-.0609857f,-.06089f,-.0607943f,-.0606987f,-.060603f,-.0605073f,-.0604117f,-.0603155f,-.0602199f,-.0601242f,-.0600285f,-.0599328f,-.0598372f,-.0597415f,-.0596458f,-.0595501f,-.0594545f,-.0593588f,-.0592631f,-.0591674f,-.0590718f,-.0589761f,-.0588804f,-.0587843f,-.0586886f,-.0585929f,-.0584972f,-.0584015f,-.0583059f,-.0582102f,-.0581145f,-.0580188f,-.0579231f,-.0578274f,-.0577318f,-.0576361f,-.0575404f,-.0574447f,-.057349f,-.0572533f,-.0571572f,-.0570615f,-.0569658f,-.0568701f,-.0567744f,-.0566787f,-.056583f,-.0564873f,-.0563917f,-.056296f,-.0562003f,-.0561046f,-.0560089f,-.0559132f,-.0558175f,-.0557218f,-.0556256f,-.0555299f,-.0554342f,-.0553385f,-.0552428f,-.0551471f,-.0550514f,-.0549557f,-.05486f,-.0547643f,-.0546686f,-.0545729f,-.0544772f,-.0543815f,-.0542858f,-.0541901f,-.0540939f,-.0539982f,-.0539025f,-.0538068f,-.0537111f,-.0536154f,-.0535197f,-.053424f,-.0533283f,-.0532326f,-.0531369f,-.0530412f,-.0529455f,-.0528498f,-.052754f,-.0526583f,-.0525621f,-.0524664f,-.0523707f,-.052275f,-.0521793f,-.0520836f,-.0519879f,-.0518922f,-.0517964f,-.0517007f,-.051605f,-.0515093f,-.0514136f,-.0513179f,-.0512221f,-.0511264f,-.0510302f,-.0509345f,-.0508388f,-.0507431f,-.0506473f,-.0505516f,-.0504559f,-.0503602f,-.0502645f,-.0501687f,-.050073f,-.0499773f,-.0498816f,-.0497858f,-.0496901f,-.0495944f,-.0494982f,-.0494024f,-.0493067f,-.049211f,-.0491153f,-.0490195f,-.0489238f,-.0488281f,-.0487323f,-.0486366f,-.0485409f,-.0484452f,-.0483494f,-.0482537f,-.048158f,-.0480622f,-.047966f,-.0478703f,-.0477745f,-.0476788f,-.0475831f,-.0474873f,-.0473916f,-.0472959f,-.0472001f,-.0471044f,-.0470087f,-.0469129f,-.0468172f,-.0467214f,-.0466257f,-.04653f,-.0464342f,-.046338f,-.0462423f,-.0461465f,-.0460508f,-.045955f,-.0458593f,-.0457635f,-.0456678f,-.0455721f,-.0454763f,-.0453806f,-.0452848f,-.0451891f,-.0450933f,-.0449976f,-.0449018f,-.0448056f,-.0447099f,-.0446141f,-.0445184f,-.0444226f,-.0443269f,-.0442311f,-.0441354f,-.0440396f,-.0439439f,-.0438481f,-.0437524f,-.0436566f,-.0435608f,-.0434651f,-.0433693f,-.0432731f,-.0431774f,-.0430816f,-.0429858f,-.0428901f,-.0427943f,-.0426986f,-.0426028f,-.0425071f,-.0424113f,-.0423155f,-.0422198f,-.042124f,-.0420283f,-.0419325f,-.0418367f,-.0417405f,-.0416447f,-.041549f,-.0414532f,-.0413575f,-.0412617f,-.0411659f,-.0410702f,-.0409744f,-.0408786f,-.0407829f,-.0406871f,-.0405914f,-.0404956f,-.0403998f,-.0403041f,-.0402078f,-.040112f,-.0400163f,-.0399205f,-.0398247f,-.039729f,-.0396332f,-.0395374f,-.0394417f,-.0393459f,-.0392501f,-.0391544f,-.0390586f,-.0389628f,-.038867f,-.0387713f,-.038675f,-.0385792f,-.0384835f,-.0383877f,-.0382919f,-.0381962f,-.0381004f,-.0380046f,-.0379088f,-.0378131f,-.0377173f,-.0376215f,-.0375257f,-.0374299f,-.0373342f,-.0372384f,-.0371421f,-.0370464f,-.0369506f,-.0368548f,-.036759f,-.0366632f,-.0365675f,-.0364717f,-.0363759f,-.0362801f,-.0361843f,-.0360886f,-.0359928f,-.035897f,-.0358012f,-.0357054f,-.0356096f,-.0355134f,-.0354176f,-.0353218f,-.035226f,-.0351302f,-.0350345f,-.0349387f,-.0348429f,-.0347471f,-.0346513f,-.0345555f,-.0344597f,-.034364f,-.0342682f,-.0341724f,-.0340766f,-.0339803f,-.0338845f,-.0337887f,-.033693f,-.0335972f,-.0335014f,-.0334056f,-.0333098f,-.033214f,-.0331182f,-.0330224f,-.0329266f,-.0328308f,-.032735f,-.0326393f,-.0325435f,-.0324472f,-.0323514f,-.0322556f,-.0321598f,-.032064f,-.0319682f,-.0318724f,-.0317766f,-.0316808f,-.031585f,-.0314892f,-.0313934f,-.0312976f,-.0312018f,-.031106f,-.0310102f,-.030914f,-.0308182f,-.0307224f,-.0306266f,-.0305308f,-.030435f,-.0303392f,-.0302434f,-.0301476f,-.0300518f,-.029956f,-.0298602f,-.0297644f,-.0296686f,-.0295728f,-.029477f,-.0293807f,-.0292849f,-.0291891f,-.0290933f,-.0289975f,-.0289017f,-.0288059f,-.0287101f,-.0286143f,-.0285184f,-.0284226f,-.0283268f,-.028231f,-.0281352f,-.0280394f,-.0279436f,-.0278473f,-.0277515f,-.0276557f,-.0275599f,-.0274641f,-.0273683f,-.0272725f,-.0271767f,-.0270809f,-.0269851f,-.0268892f,-.0267934f,-.0266976f,-.0266018f,-.026506f,-.0264102f,-.0263144f,-.0262181f,-.0261223f,-.0260265f,-.0259307f,-.0258348f,-.025739f,-.0256432f,-.0255474f,-.0254516f,-.0253558f,-.02526f,-.0251642f,-.0250683f,-.0249725f,-.0248767f,-.0247809f,-.0246846f,-.0245888f,-.024493f,-.0243972f,-.0243013f,-.0242055f,-.0241097f,-.0240139f,-.0239181f,-.0238223f,-.0237264f,-.0236306f,-.0235348f,-.023439f,-.0233432f,-.0232474f,-.0231511f,-.0230552f,-.0229594f,-.0228636f,-.0227678f,-.022672f,-.0225761f,-.0224803f,-.0223845f,-.0222887f,-.0221929f,-.022097f,-.0220012f,-.0219054f,-.0218096f,-.0217138f,-.0216175f,-.0215216f,-.0214258f,-.02133f,-.0212342f,-.0211383f,-.0210425f,-.0209467f,-.0208509f,-.0207551f,-.0206592f,-.0205634f,-.0204676f,-.0203718f,-.0202759f,-.0201801f,-.0200838f,-.019988f,-.0198922f,-.0197963f,-.0197005f,-.0196047f,-.0195089f,-.019413f,-.0193172f,-.0192214f,-.0191256f,-.0190297f,-.0189339f,-.0188381f,-.0187422f,-.0186464f,-.0185501f,-.0184543f,-.0183585f,-.0182626f,-.0181668f,-.018071f,-.0179751f,-.0178793f,-.0177835f,-.0176877f,-.0175918f,-.017496f,-.0174002f,-.0173043f,-.0172085f,-.0171127f,-.0170164f,-.0169205f,-.0168247f,-.0167289f,-.016633f,-.0165372f,-.0164414f,-.0163456f,-.0162497f,-.0161539f,-.0160581f,-.0159622f,-.0158664f,-.0157706f,-.0156747f,-.0155789f,-.0154831f,-.0153868f,-.0152909f,-.0151951f,-.0150993f,-.0150034f,-.0149076f,-.0148118f,-.0147159f,-.0146201f,-.0145243f,-.0144284f,-.0143326f,-.0142367f,-.0141409f,-.0140451f,-.0139492f,-.0138529f,-.0137571f,-.0136613f,-.0135654f,-.0134696f,-.0133738f,-.0132779f,-.0131821f,-.0130862f,-.0129904f,-.0128946f,-.0127987f,-.0127029f,-.0126071f,-.0125112f,-.0124154f,-.0123191f,-.0122232f,-.0121274f,-.0120316f,-.0119357f,-.0118399f,-.0117441f,-.0116482f,-.0115524f,-.0114565f,-.0113607f,-.0112649f,-.011169f,-.0110732f,-.0109774f,-.0108815f,-.0107852f,-.0106894f,-.0105935f,-.0104977f,-.0104018f,-.010306f,-.0102102f,-.0101143f,-.0100185f,-.00992264f,-.0098268f,-.00973096f,-.00963512f,-.00953928f,-.00944345f,-.0093476f,-.00925129f,-.00915545f,-.00905961f,-.00896377f,-.00886793f,-.00877209f,-.00867624f,-.0085804f,-.00848456f,-.00838872f,-.00829288f,-.00819704f,-.0081012f,-.00800536f,-.00790952f,-.00781368f,-.00771736f,-.00762152f,-.00752567f,-.00742983f,-.00733399f,-.00723815f,-.00714231f,-.00704647f,-.00695062f,-.00685478f,-.00675894f,-.0066631f,-.00656726f,-.00647141f,-.00637557f,-.00627973f,-.00618341f,-.00608757f,-.00599173f,-.00589588f,-.00580004f,-.0057042f,-.00560835f,-.00551251f,-.00541667f,-.00532083f,-.00522498f,-.00512914f,-.0050333f,-.00493745f,-.00484161f,-.00474577f,-.00464992f,-.0045536f,-.00445776f,-.00436192f,-.00426607f,-.00417023f,-.00407439f,-.00397854f,-.0038827f,-.00378686f,-.00369101f,-.00359517f,-.00349933f,-.00340348f,-.00330764f,-.00321179f,-.00311595f,-.00301963f,-.00292379f,-.00282794f,-.0027321f,-.00263625f,-.00254041f,-.00244457f,-.00234872f,-.00225288f,-.00215703f,-.00206119f,-.00196535f,-.0018695f,-.00177366f,-.00167781f,-.00158197f,-.00148565f,-.0013898f,-.00129396f,-.00119812f,-.00110227f,-.00100643f,-.000910584f,-.00081474f,-.000718896f,-.000623051f,-.000527207f,-.000431363f,-.000335519f,-.000239674f,-.00014383f,-4.79857e-05f
-    // clang-format on
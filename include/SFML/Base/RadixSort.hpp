@@ -0,0 +1,323 @@
+#pragma once
+#include <SFML/Copyright.hpp> // LICENSE AND COPYRIGHT (C) INFORMATION
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include "SFML/Base/Builtins/Memcpy.hpp"
+#include "SFML/Base/IntTypes.hpp"
+#include "SFML/Base/MaxAlignT.hpp"
+#include "SFML/Base/SizeT.hpp"
+#include "SFML/Base/Traits/IsFloatingPoint.hpp"
+#include "SFML/Base/Traits/IsSame.hpp"
+#include "SFML/Base/Traits/IsTriviallyCopyable.hpp"
+#include "SFML/Base/TrivialVector.hpp"
+
+
+namespace sf::base::priv
+{
+////////////////////////////////////////////////////////////
+template <SizeT N>
+struct UnsignedOfSize;
+
+template <>
+struct UnsignedOfSize<1>
+{
+    using Type = U8;
+};
+
+template <>
+struct UnsignedOfSize<2>
+{
+    using Type = U16;
+};
+
+template <>
+struct UnsignedOfSize<4>
+{
+    using Type = U32;
+};
+
+template <>
+struct UnsignedOfSize<8>
+{
+    using Type = U64;
+};
+
+
+////////////////////////////////////////////////////////////
+/// Bijection between a key and unsigned bits that compare in
+/// the same order, so that keys can be sorted digit by digit
+///
+////////////////////////////////////////////////////////////
+template <typename TKey>
+struct RadixKeyTraits
+{
+    using Bits = typename UnsignedOfSize<sizeof(TKey)>::Type;
+
+    static constexpr Bits signBit     = static_cast<Bits>(Bits{1u} << (sizeof(Bits) * 8u - 1u));
+    static constexpr bool isFloat     = SFML_BASE_IS_FLOATING_POINT(TKey);
+    static constexpr bool isSignedInt = !isFloat && static_cast<TKey>(-1) < static_cast<TKey>(0);
+
+    [[nodiscard, gnu::always_inline]] static Bits encode(TKey key) noexcept
+    {
+        Bits bits{};
+        SFML_BASE_MEMCPY(&bits, &key, sizeof(Bits));
+
+        // Negative floats are stored as sign and magnitude, flipping all their bits reverses their order
+        if constexpr (isFloat)
+            return (bits & signBit) != 0u ? static_cast<Bits>(~bits) : static_cast<Bits>(bits | signBit);
+        else if constexpr (isSignedInt)
+            return static_cast<Bits>(bits ^ signBit);
+        else
+            return bits;
+    }
+
+    [[nodiscard, gnu::always_inline]] static TKey decode(Bits bits) noexcept
+    {
+        if constexpr (isFloat)
+            bits = (bits & signBit) != 0u ? static_cast<Bits>(bits ^ signBit) : static_cast<Bits>(~bits);
+        else if constexpr (isSignedInt)
+            bits = static_cast<Bits>(bits ^ signBit);
+
+        TKey key{};
+        SFML_BASE_MEMCPY(&key, &bits, sizeof(Bits));
+        return key;
+    }
+};
+
+
+////////////////////////////////////////////////////////////
+struct RadixNoValue
+{
+};
+
+} // namespace sf::base::priv
+
+
+namespace sf::base
+{
+////////////////////////////////////////////////////////////
+/// \brief Stable LSD radix sort of numeric keys, with or without values
+///
+/// Keys can be any integer type, `float` or `double`, values
+/// any trivially copyable type. Sorting takes one pass over
+/// the keys per byte of the key type, passes over a byte that
+/// is the same in every key (e.g. the high bytes of depths in
+/// a small range) are skipped.
+///
+/// The sorter keeps its scratch memory between calls, so that
+/// sorting as many elements as before allocates nothing.
+///
+/// Floating point keys are ordered as by `operator<`, with
+/// `-0` before `+0` and NaNs after infinity (or before minus
+/// infinity for NaNs with the sign bit set).
+///
+////////////////////////////////////////////////////////////
+class [[nodiscard]] RadixSorter
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Sort keys in ascending order
+    ///
+    ////////////////////////////////////////////////////////////
+    template <typename TKey>
+    void sortKeys(TKey* keys, SizeT count)
+    {
+        sortImpl<true>(keys, keys, static_cast<priv::RadixNoValue*>(nullptr), count);
+    }
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Sort keys in ascending order, moving values along
+    ///
+    /// `values[i]` is the value associated to `keys[i]`. Values
+    /// of equal keys keep their relative order.
+    ///
+    ////////////////////////////////////////////////////////////
+    template <typename TKey, typename TValue>
+    void sortPairs(TKey* keys, TValue* values, SizeT count)
+    {
+        sortImpl<true>(keys, keys, values, count);
+    }
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Compute the order of keys without moving them
+    ///
+    /// Fills `indices` with the indices of `keys` in ascending
+    /// order of keys, indices of equal keys stay ascending.
+    ///
+    ////////////////////////////////////////////////////////////
+    template <typename TKey, typename TIndex>
+    void sortIndices(const TKey* keys, TIndex* indices, SizeT count)
+    {
+        for (SizeT i = 0u; i < count; ++i)
+            indices[i] = static_cast<TIndex>(i);
+
+        sortImpl<false>(keys, static_cast<TKey*>(nullptr), indices, count);
+    }
+
+private:
+    ////////////////////////////////////////////////////////////
+    static constexpr SizeT insertionSortThreshold = 64u;
+
+    ////////////////////////////////////////////////////////////
+    template <typename T>
+    [[nodiscard, gnu::always_inline]] static SizeT getPaddedSize(SizeT count) noexcept
+    {
+        return (count * sizeof(T) + sizeof(MaxAlignT) - 1u) / sizeof(MaxAlignT);
+    }
+
+    ////////////////////////////////////////////////////////////
+    template <bool WriteKeys, typename TKey, typename TValue>
+    void sortImpl(const TKey* keys, TKey* sortedKeys, TValue* values, SizeT count)
+    {
+        using Traits = priv::RadixKeyTraits<TKey>;
+        using Bits   = typename Traits::Bits;
+
+        static constexpr bool  hasValues  = !SFML_BASE_IS_SAME(TValue, priv::RadixNoValue);
+        static constexpr SizeT digitCount = sizeof(Bits);
+
+        static_assert(SFML_BASE_IS_TRIVIALLY_COPYABLE(TValue), "Values must be trivially copyable");
+        static_assert(alignof(TValue) <= alignof(MaxAlignT));
+
+        if (count < 2u)
+            return;
+
+        // Scratch memory: two buffers of encoded keys and one buffer of values to ping-pong with `values`
+        const SizeT bitsSize  = getPaddedSize<Bits>(count);
+        const SizeT valueSize = hasValues ? getPaddedSize<TValue>(count) : 0u;
+
+        m_scratch.reserve(bitsSize * 2u + valueSize);
+
+        auto* const bitsA   = reinterpret_cast<Bits*>(m_scratch.data());
+        auto* const bitsB   = reinterpret_cast<Bits*>(m_scratch.data() + bitsSize);
+        auto* const valuesB = reinterpret_cast<TValue*>(m_scratch.data() + bitsSize * 2u);
+
+        if (count <= insertionSortThreshold)
+        {
+            // Stable insertion sort, cheaper than the radix passes for a few elements
+            for (SizeT i = 0u; i < count; ++i)
+            {
+                const Bits bits = Traits::encode(keys[i]);
+                SizeT      hole = i;
+
+                for (; hole > 0u && bits < bitsA[hole - 1u]; --hole)
+                {
+                    bitsA[hole] = bitsA[hole - 1u];
+
+                    if constexpr (hasValues)
+                        valuesB[hole] = valuesB[hole - 1u];
+                }
+
+                bitsA[hole] = bits;
+
+                if constexpr (hasValues)
+                    valuesB[hole] = values[i];
+            }
+
+            if constexpr (hasValues)
+                SFML_BASE_MEMCPY(values, valuesB, sizeof(TValue) * count);
+
+            if constexpr (WriteKeys)
+                for (SizeT i = 0u; i < count; ++i)
+                    sortedKeys[i] = Traits::decode(bitsA[i]);
+
+            return;
+        }
+
+        // Encode the keys and count the occurrences of every digit of every byte in a single pass
+        SizeT histograms[digitCount][256]{};
+
+        for (SizeT i = 0u; i < count; ++i)
+        {
+            const Bits bits = Traits::encode(keys[i]);
+            bitsA[i]        = bits;
+
+            for (SizeT digit = 0u; digit < digitCount; ++digit)
+                ++histograms[digit][(bits >> (digit * 8u)) & 0xFFu];
+        }
+
+        Bits*   sourceBits   = bitsA;
+        Bits*   targetBits   = bitsB;
+        TValue* sourceValues = values;
+        TValue* targetValues = valuesB;
+
+        for (SizeT digit = 0u; digit < digitCount; ++digit)
+        {
+            SizeT* const histogram = histograms[digit];
+            const SizeT  shift     = digit * 8u;
+
+            // Every key has the same byte here, the pass would not change the order
+            if (histogram[(sourceBits[0] >> shift) & 0xFFu] == count)
+                continue;
+
+            SizeT offset = 0u;
+
+            for (SizeT& bucket : histograms[digit])
+            {
+                const SizeT bucketSize = bucket;
+                bucket                 = offset;
+                offset += bucketSize;
+            }
+
+            for (SizeT i = 0u; i < count; ++i)
+            {
+                const Bits  bits     = sourceBits[i];
+                const SizeT position = histogram[(bits >> shift) & 0xFFu]++;
+
+                targetBits[position] = bits;
+
+                if constexpr (hasValues)
+                    targetValues[position] = sourceValues[i];
+            }
+
+            Bits* const swappedBits = sourceBits;
+            sourceBits              = targetBits;
+            targetBits              = swappedBits;
+
+            TValue* const swappedValues = sourceValues;
+            sourceValues                = targetValues;
+            targetValues                = swappedValues;
+        }
+
+        if constexpr (hasValues)
+            if (sourceValues != values)
+                SFML_BASE_MEMCPY(values, sourceValues, sizeof(TValue) * count);
+
+        if constexpr (WriteKeys)
+            for (SizeT i = 0u; i < count; ++i)
+                sortedKeys[i] = Traits::decode(sourceBits[i]);
+    }
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    TrivialVector<MaxAlignT> m_scratch; //!< Encoded keys and values being sorted, only ever grows
+};
+
+} // namespace sf::base
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::base::RadixSorter
+/// \ingroup base
+///
+/// Usage example, sorting sprites back to front before adding
+/// them to a batch:
+/// \code
+/// sf::base::RadixSorter                 sorter; // Reused every frame
+/// sf::base::TrivialVector<float>         depths;
+/// sf::base::TrivialVector<sf::base::U32> order;
+///
+/// depths.clear();
+/// for (const Sprite& sprite : sprites)
+///     depths.pushBack(-sprite.depth);
+///
+/// order.resize(depths.size());
+/// sorter.sortIndices(depths.data(), order.data(), depths.size());
+///
+/// for (const sf::base::U32 index : order)
+///     batch.add(sprites[index]);
+/// \endcode
+///
+////////////////////////////////////////////////////////////
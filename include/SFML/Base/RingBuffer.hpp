@@ -0,0 +1,275 @@
+#pragma once
+#include <SFML/Copyright.hpp> // LICENSE AND COPYRIGHT (C) INFORMATION
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include "SFML/Base/Assert.hpp"
+#include "SFML/Base/Launder.hpp"
+#include "SFML/Base/Macros.hpp"
+#include "SFML/Base/PlacementNew.hpp"
+#include "SFML/Base/SizeT.hpp"
+#include "SFML/Base/Traits/IsTriviallyDestructible.hpp"
+
+
+namespace sf::base
+{
+////////////////////////////////////////////////////////////
+/// \brief FIFO queue backed by a contiguous circular buffer
+///
+/// Unlike `std::deque`, pushing and popping never allocates once
+/// the capacity has been reached: storage only grows (doubling
+/// its power-of-two capacity) when pushing into a full buffer.
+///
+////////////////////////////////////////////////////////////
+template <typename TItem>
+class [[nodiscard]] RingBuffer
+{
+private:
+    union [[nodiscard]] ItemUnion
+    {
+        TItem item;
+
+        [[gnu::always_inline]] ItemUnion()
+        {
+        }
+
+        [[gnu::always_inline]] ~ItemUnion()
+        {
+        }
+    };
+
+    static_assert(sizeof(ItemUnion) == sizeof(TItem));
+    static_assert(alignof(ItemUnion) == alignof(TItem));
+
+    ItemUnion* m_data{nullptr};
+    SizeT      m_capacity{0u}; // Always zero or a power of two
+    SizeT      m_head{0u};     // Index of the front item
+    SizeT      m_size{0u};
+
+
+    ////////////////////////////////////////////////////////////
+    [[nodiscard, gnu::always_inline, gnu::pure]] TItem* slot(const SizeT i) noexcept
+    {
+        return SFML_BASE_LAUNDER_CAST(TItem*, m_data + ((m_head + i) & (m_capacity - 1u)));
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    [[nodiscard, gnu::always_inline, gnu::pure]] const TItem* slot(const SizeT i) const noexcept
+    {
+        return SFML_BASE_LAUNDER_CAST(const TItem*, m_data + ((m_head + i) & (m_capacity - 1u)));
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    [[gnu::cold, gnu::noinline]] void reserveImpl(const SizeT targetCapacity)
+    {
+        SizeT newCapacity = m_capacity == 0u ? 8u : m_capacity;
+        while (newCapacity < targetCapacity)
+            newCapacity *= 2u;
+
+        auto* newData = new ItemUnion[newCapacity];
+
+        // Unwrap the items at the beginning of the new storage
+        for (SizeT i = 0u; i < m_size; ++i)
+        {
+            TItem* item = slot(i);
+            SFML_BASE_PLACEMENT_NEW(&newData[i].item) TItem(SFML_BASE_MOVE(*item));
+            item->~TItem();
+        }
+
+        delete[] m_data;
+
+        m_data     = newData;
+        m_capacity = newCapacity;
+        m_head     = 0u;
+    }
+
+
+public:
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] RingBuffer() = default;
+
+
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] explicit RingBuffer(const SizeT initialCapacity)
+    {
+        reserve(initialCapacity);
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    ~RingBuffer()
+    {
+        clear();
+        delete[] m_data;
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    RingBuffer(const RingBuffer&)            = delete;
+    RingBuffer& operator=(const RingBuffer&) = delete;
+
+
+    ////////////////////////////////////////////////////////////
+    [[nodiscard, gnu::always_inline]] RingBuffer(RingBuffer&& rhs) noexcept :
+    m_data{rhs.m_data},
+    m_capacity{rhs.m_capacity},
+    m_head{rhs.m_head},
+    m_size{rhs.m_size}
+    {
+        rhs.m_data     = nullptr;
+        rhs.m_capacity = 0u;
+        rhs.m_head     = 0u;
+        rhs.m_size     = 0u;
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    RingBuffer& operator=(RingBuffer&& rhs) noexcept
+    {
+        if (this == &rhs)
+            return *this;
+
+        clear();
+        delete[] m_data;
+
+        m_data     = rhs.m_data;
+        m_capacity = rhs.m_capacity;
+        m_head     = rhs.m_head;
+        m_size     = rhs.m_size;
+
+        rhs.m_data     = nullptr;
+        rhs.m_capacity = 0u;
+        rhs.m_head     = 0u;
+        rhs.m_size     = 0u;
+
+        return *this;
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    [[gnu::always_inline]] void reserve(const SizeT targetCapacity)
+    {
+        if (m_capacity < targetCapacity) [[unlikely]]
+            reserveImpl(targetCapacity);
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    template <typename... Ts>
+    [[gnu::always_inline, gnu::flatten]] TItem& emplaceBack(Ts&&... xs)
+    {
+        reserve(m_size + 1u);
+
+        TItem* item = SFML_BASE_PLACEMENT_NEW(slot(m_size)) TItem(static_cast<Ts&&>(xs)...);
+        ++m_size;
+
+        return *item;
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    template <typename T>
+    [[gnu::always_inline, gnu::flatten]] TItem& pushBack(T&& x)
+    {
+        return emplaceBack(static_cast<T&&>(x));
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    [[gnu::always_inline]] void popFront() noexcept
+    {
+        SFML_BASE_ASSERT(!empty());
+
+        if constexpr (!SFML_BASE_IS_TRIVIALLY_DESTRUCTIBLE(TItem))
+            slot(0u)->~TItem();
+
+        m_head = (m_head + 1u) & (m_capacity - 1u);
+        --m_size;
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    [[gnu::always_inline]] void clear() noexcept
+    {
+        if constexpr (!SFML_BASE_IS_TRIVIALLY_DESTRUCTIBLE(TItem))
+            for (SizeT i = 0u; i < m_size; ++i)
+                slot(i)->~TItem();
+
+        m_head = 0u;
+        m_size = 0u;
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    [[nodiscard, gnu::always_inline, gnu::pure]] TItem& front() noexcept
+    {
+        SFML_BASE_ASSERT(!empty());
+        return *slot(0u);
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    [[nodiscard, gnu::always_inline, gnu::pure]] const TItem& front() const noexcept
+    {
+        SFML_BASE_ASSERT(!empty());
+        return *slot(0u);
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    [[nodiscard, gnu::always_inline, gnu::pure]] TItem& back() noexcept
+    {
+        SFML_BASE_ASSERT(!empty());
+        return *slot(m_size - 1u);
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    [[nodiscard, gnu::always_inline, gnu::pure]] const TItem& back() const noexcept
+    {
+        SFML_BASE_ASSERT(!empty());
+        return *slot(m_size - 1u);
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    [[nodiscard, gnu::always_inline, gnu::pure]] TItem& operator[](const SizeT i) noexcept
+    {
+        SFML_BASE_ASSERT(i < m_size);
+        return *slot(i);
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    [[nodiscard, gnu::always_inline, gnu::pure]] const TItem& operator[](const SizeT i) const noexcept
+    {
+        SFML_BASE_ASSERT(i < m_size);
+        return *slot(i);
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    [[nodiscard, gnu::always_inline, gnu::pure]] SizeT size() const noexcept
+    {
+        return m_size;
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    [[nodiscard, gnu::always_inline, gnu::pure]] SizeT capacity() const noexcept
+    {
+        return m_capacity;
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    [[nodiscard, gnu::always_inline, gnu::pure]] bool empty() const noexcept
+    {
+        return m_size == 0u;
+    }
+};
+
+} // namespace sf::base
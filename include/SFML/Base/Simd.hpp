@@ -0,0 +1,251 @@
+#pragma once
+#include <SFML/Copyright.hpp> // LICENSE AND COPYRIGHT (C) INFORMATION
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define SFML_BASE_SIMD_SSE2
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#define SFML_BASE_SIMD_NEON
+#include <arm_neon.h>
+#elif defined(__wasm_simd128__)
+#define SFML_BASE_SIMD_WASM
+#include <wasm_simd128.h>
+#endif
+
+
+namespace sf::base
+{
+////////////////////////////////////////////////////////////
+/// \brief Four packed floats, mapped to the native 128-bit SIMD registers
+///
+/// Uses SSE2 on x86, NEON on ARM and SIMD128 on WebAssembly,
+/// falling back to plain scalar code elsewhere. Loads and stores
+/// are always unaligned, so any `float` pointer can be used.
+///
+////////////////////////////////////////////////////////////
+struct [[nodiscard]] F32x4
+{
+#if defined(SFML_BASE_SIMD_SSE2)
+    using Native = __m128;
+#elif defined(SFML_BASE_SIMD_NEON)
+    using Native = float32x4_t;
+#elif defined(SFML_BASE_SIMD_WASM)
+    using Native = v128_t;
+#else
+    struct Native
+    {
+        float lanes[4];
+    };
+#endif
+
+    Native value;
+
+
+    ////////////////////////////////////////////////////////////
+    [[nodiscard, gnu::always_inline]] static F32x4 load(const float* data) noexcept
+    {
+#if defined(SFML_BASE_SIMD_SSE2)
+        return {_mm_loadu_ps(data)};
+#elif defined(SFML_BASE_SIMD_NEON)
+        return {vld1q_f32(data)};
+#elif defined(SFML_BASE_SIMD_WASM)
+        return {wasm_v128_load(data)};
+#else
+        return {{{data[0], data[1], data[2], data[3]}}};
+#endif
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    [[nodiscard, gnu::always_inline]] static F32x4 broadcast(float x) noexcept
+    {
+#if defined(SFML_BASE_SIMD_SSE2)
+        return {_mm_set1_ps(x)};
+#elif defined(SFML_BASE_SIMD_NEON)
+        return {vdupq_n_f32(x)};
+#elif defined(SFML_BASE_SIMD_WASM)
+        return {wasm_f32x4_splat(x)};
+#else
+        return {{{x, x, x, x}}};
+#endif
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    [[nodiscard, gnu::always_inline]] static F32x4 zero() noexcept
+    {
+        return broadcast(0.f);
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    [[gnu::always_inline]] void store(float* data) const noexcept
+    {
+#if defined(SFML_BASE_SIMD_SSE2)
+        _mm_storeu_ps(data, value);
+#elif defined(SFML_BASE_SIMD_NEON)
+        vst1q_f32(data, value);
+#elif defined(SFML_BASE_SIMD_WASM)
+        wasm_v128_store(data, value);
+#else
+        for (int i = 0; i < 4; ++i)
+            data[i] = value.lanes[i];
+#endif
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    [[nodiscard, gnu::always_inline]] friend F32x4 operator+(F32x4 lhs, F32x4 rhs) noexcept
+    {
+#if defined(SFML_BASE_SIMD_SSE2)
+        return {_mm_add_ps(lhs.value, rhs.value)};
+#elif defined(SFML_BASE_SIMD_NEON)
+        return {vaddq_f32(lhs.value, rhs.value)};
+#elif defined(SFML_BASE_SIMD_WASM)
+        return {wasm_f32x4_add(lhs.value, rhs.value)};
+#else
+        return {{{lhs.value.lanes[0] + rhs.value.lanes[0],
+                  lhs.value.lanes[1] + rhs.value.lanes[1],
+                  lhs.value.lanes[2] + rhs.value.lanes[2],
+                  lhs.value.lanes[3] + rhs.value.lanes[3]}}};
+#endif
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    [[nodiscard, gnu::always_inline]] friend F32x4 operator-(F32x4 lhs, F32x4 rhs) noexcept
+    {
+#if defined(SFML_BASE_SIMD_SSE2)
+        return {_mm_sub_ps(lhs.value, rhs.value)};
+#elif defined(SFML_BASE_SIMD_NEON)
+        return {vsubq_f32(lhs.value, rhs.value)};
+#elif defined(SFML_BASE_SIMD_WASM)
+        return {wasm_f32x4_sub(lhs.value, rhs.value)};
+#else
+        return {{{lhs.value.lanes[0] - rhs.value.lanes[0],
+                  lhs.value.lanes[1] - rhs.value.lanes[1],
+                  lhs.value.lanes[2] - rhs.value.lanes[2],
+                  lhs.value.lanes[3] - rhs.value.lanes[3]}}};
+#endif
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    [[nodiscard, gnu::always_inline]] friend F32x4 operator*(F32x4 lhs, F32x4 rhs) noexcept
+    {
+#if defined(SFML_BASE_SIMD_SSE2)
+        return {_mm_mul_ps(lhs.value, rhs.value)};
+#elif defined(SFML_BASE_SIMD_NEON)
+        return {vmulq_f32(lhs.value, rhs.value)};
+#elif defined(SFML_BASE_SIMD_WASM)
+        return {wasm_f32x4_mul(lhs.value, rhs.value)};
+#else
+        return {{{lhs.value.lanes[0] * rhs.value.lanes[0],
+                  lhs.value.lanes[1] * rhs.value.lanes[1],
+                  lhs.value.lanes[2] * rhs.value.lanes[2],
+                  lhs.value.lanes[3] * rhs.value.lanes[3]}}};
+#endif
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Compute `a * b + c`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard, gnu::always_inline]] static F32x4 mulAdd(F32x4 a, F32x4 b, F32x4 c) noexcept
+    {
+#if defined(SFML_BASE_SIMD_NEON) && defined(__aarch64__)
+        return {vfmaq_f32(c.value, a.value, b.value)};
+#else
+        return a * b + c;
+#endif
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    [[nodiscard, gnu::always_inline]] static F32x4 min(F32x4 lhs, F32x4 rhs) noexcept
+    {
+#if defined(SFML_BASE_SIMD_SSE2)
+        return {_mm_min_ps(lhs.value, rhs.value)};
+#elif defined(SFML_BASE_SIMD_NEON)
+        return {vminq_f32(lhs.value, rhs.value)};
+#elif defined(SFML_BASE_SIMD_WASM)
+        return {wasm_f32x4_pmin(lhs.value, rhs.value)};
+#else
+        F32x4 result;
+        for (int i = 0; i < 4; ++i)
+            result.value.lanes[i] = rhs.value.lanes[i] < lhs.value.lanes[i] ? rhs.value.lanes[i] : lhs.value.lanes[i];
+        return result;
+#endif
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    [[nodiscard, gnu::always_inline]] static F32x4 max(F32x4 lhs, F32x4 rhs) noexcept
+    {
+#if defined(SFML_BASE_SIMD_SSE2)
+        return {_mm_max_ps(lhs.value, rhs.value)};
+#elif defined(SFML_BASE_SIMD_NEON)
+        return {vmaxq_f32(lhs.value, rhs.value)};
+#elif defined(SFML_BASE_SIMD_WASM)
+        return {wasm_f32x4_pmax(lhs.value, rhs.value)};
+#else
+        F32x4 result;
+        for (int i = 0; i < 4; ++i)
+            result.value.lanes[i] = lhs.value.lanes[i] < rhs.value.lanes[i] ? rhs.value.lanes[i] : lhs.value.lanes[i];
+        return result;
+#endif
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    [[nodiscard, gnu::always_inline]] static F32x4 abs(F32x4 x) noexcept
+    {
+#if defined(SFML_BASE_SIMD_SSE2)
+        return {_mm_andnot_ps(_mm_set1_ps(-0.f), x.value)};
+#elif defined(SFML_BASE_SIMD_NEON)
+        return {vabsq_f32(x.value)};
+#elif defined(SFML_BASE_SIMD_WASM)
+        return {wasm_f32x4_abs(x.value)};
+#else
+        F32x4 result;
+        for (int i = 0; i < 4; ++i)
+            result.value.lanes[i] = x.value.lanes[i] < 0.f ? -x.value.lanes[i] : x.value.lanes[i];
+        return result;
+#endif
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Sum of the four lanes
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard, gnu::always_inline]] float horizontalSum() const noexcept
+    {
+        float lanes[4];
+        store(lanes);
+
+        return (lanes[0] + lanes[1]) + (lanes[2] + lanes[3]);
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Largest of the four lanes
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard, gnu::always_inline]] float horizontalMax() const noexcept
+    {
+        float lanes[4];
+        store(lanes);
+
+        const float a = lanes[0] < lanes[1] ? lanes[1] : lanes[0];
+        const float b = lanes[2] < lanes[3] ? lanes[3] : lanes[2];
+
+        return a < b ? b : a;
+    }
+};
+
+} // namespace sf::base
@@ -0,0 +1,175 @@
+#pragma once
+#include <SFML/Copyright.hpp> // LICENSE AND COPYRIGHT (C) INFORMATION
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include "SFML/Base/Algorithm.hpp"
+#include "SFML/Base/Builtins/Memcpy.hpp"
+#include "SFML/Base/SizeT.hpp"
+#include "SFML/Base/Traits/IsTriviallyCopyable.hpp"
+
+#include <atomic>
+
+
+namespace sf::base
+{
+////////////////////////////////////////////////////////////
+/// \brief Bounded lock-free single-producer single-consumer queue
+///
+/// Exactly one thread may push and exactly one (possibly
+/// different) thread may pop at any given time. Neither side
+/// ever blocks or allocates: pushing into a full queue and
+/// popping from an empty one fail and return `false`.
+///
+////////////////////////////////////////////////////////////
+template <typename TItem, SizeT Capacity>
+class [[nodiscard]] SpscQueue
+{
+    static_assert(Capacity > 0u && (Capacity & (Capacity - 1u)) == 0u, "Capacity must be a power of two");
+    static_assert(SFML_BASE_IS_TRIVIALLY_COPYABLE(TItem), "Items must be trivially copyable");
+
+private:
+    static constexpr SizeT cacheLineSize = 64u;
+
+    // Indices grow monotonically and are wrapped on access, keeping full and empty distinguishable
+    alignas(cacheLineSize) std::atomic<SizeT> m_head{0u}; //!< Next index to pop, written by the consumer
+    alignas(cacheLineSize) std::atomic<SizeT> m_tail{0u}; //!< Next index to push, written by the producer
+    alignas(cacheLineSize) TItem m_items[Capacity];       //!< Item storage
+
+public:
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] SpscQueue() = default;
+
+
+    ////////////////////////////////////////////////////////////
+    SpscQueue(const SpscQueue&)            = delete;
+    SpscQueue& operator=(const SpscQueue&) = delete;
+
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Try to push an item (producer thread only)
+    ///
+    /// \return `true` on success, `false` if the queue is full
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool tryPush(const TItem& item) noexcept
+    {
+        const SizeT tail = m_tail.load(std::memory_order_relaxed);
+
+        if (tail - m_head.load(std::memory_order_acquire) == Capacity)
+            return false;
+
+        m_items[tail & (Capacity - 1u)] = item;
+        m_tail.store(tail + 1u, std::memory_order_release);
+
+        return true;
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Try to pop the oldest item (consumer thread only)
+    ///
+    /// \return `true` on success, `false` if the queue is empty
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool tryPop(TItem& item) noexcept
+    {
+        const SizeT head = m_head.load(std::memory_order_relaxed);
+
+        if (head == m_tail.load(std::memory_order_acquire))
+            return false;
+
+        item = m_items[head & (Capacity - 1u)];
+        m_head.store(head + 1u, std::memory_order_release);
+
+        return true;
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Push as many items as fit (producer thread only)
+    ///
+    /// Items are published all at once, so the consumer never
+    /// observes a partially pushed range.
+    ///
+    /// \return Number of items pushed, starting from the first one
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] SizeT tryPushBulk(const TItem* items, SizeT count) noexcept
+    {
+        const SizeT tail   = m_tail.load(std::memory_order_relaxed);
+        const SizeT pushed = base::min(count, Capacity - (tail - m_head.load(std::memory_order_acquire)));
+
+        // The range wraps around the end of the storage at most once
+        const SizeT first = tail & (Capacity - 1u);
+        const SizeT split = base::min(pushed, Capacity - first);
+
+        SFML_BASE_MEMCPY(m_items + first, items, split * sizeof(TItem));
+        SFML_BASE_MEMCPY(m_items, items + split, (pushed - split) * sizeof(TItem));
+
+        m_tail.store(tail + pushed, std::memory_order_release);
+        return pushed;
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Pop up to `count` of the oldest items (consumer thread only)
+    ///
+    /// \return Number of items popped into `items`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] SizeT tryPopBulk(TItem* items, SizeT count) noexcept
+    {
+        const SizeT head   = m_head.load(std::memory_order_relaxed);
+        const SizeT popped = base::min(count, m_tail.load(std::memory_order_acquire) - head);
+
+        const SizeT first = head & (Capacity - 1u);
+        const SizeT split = base::min(popped, Capacity - first);
+
+        SFML_BASE_MEMCPY(items, m_items + first, split * sizeof(TItem));
+        SFML_BASE_MEMCPY(items + split, m_items, (popped - split) * sizeof(TItem));
+
+        m_head.store(head + popped, std::memory_order_release);
+        return popped;
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Drop all queued items (consumer thread only)
+    ///
+    ////////////////////////////////////////////////////////////
+    void discardAll() noexcept
+    {
+        m_head.store(m_tail.load(std::memory_order_acquire), std::memory_order_release);
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of queued items
+    ///
+    /// The result is only a snapshot if the other side is
+    /// concurrently pushing or popping.
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] SizeT size() const noexcept
+    {
+        return m_tail.load(std::memory_order_acquire) - m_head.load(std::memory_order_acquire);
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool empty() const noexcept
+    {
+        return size() == 0u;
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static constexpr SizeT capacity() noexcept
+    {
+        return Capacity;
+    }
+};
+
+} // namespace sf::base
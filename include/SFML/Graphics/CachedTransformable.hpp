@@ -0,0 +1,249 @@
+#pragma once
+#include <SFML/Copyright.hpp> // LICENSE AND COPYRIGHT (C) INFORMATION
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include "SFML/Graphics/Export.hpp"
+
+#include "SFML/Graphics/Transform.hpp"
+#include "SFML/Graphics/Transformable.hpp"
+
+#include "SFML/System/Angle.hpp"
+#include "SFML/System/Vector2.hpp"
+
+#include "SFML/Base/Span.hpp"
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+/// \brief Transformable that caches its transform and inverse
+///        transform, recomputing them only after a change
+///
+////////////////////////////////////////////////////////////
+class SFML_GRAPHICS_API CachedTransformable
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Default constructor
+    ///
+    /// The object starts at the origin, unrotated and unscaled,
+    /// with an identity transform.
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] CachedTransformable() = default;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Construct from the components of a transformable
+    ///
+    /// \param transformable Position, rotation, scale and origin to start with
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] explicit CachedTransformable(const Transformable& transformable);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Refresh the cached transforms of all the dirty objects
+    ///
+    /// Computes the sines and cosines of the dirty objects eight
+    /// at a time, then their transforms. This pays off when a
+    /// large share of the objects changed since the last frame;
+    /// for mostly static scenes, the extra pass over the objects
+    /// costs more than letting `getTransform` refresh them lazily.
+    ///
+    /// Calling this once per frame before drawing also makes
+    /// `getTransform` safe to call from several threads, as it
+    /// no longer writes to the cache.
+    ///
+    /// Inverse transforms stay lazy: they are only computed by
+    /// the first call to `getInverseTransform` after a change.
+    ///
+    /// \param transformables Objects to refresh
+    ///
+    ////////////////////////////////////////////////////////////
+    static void updateTransforms(base::Span<CachedTransformable> transformables);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the position of the object
+    ///
+    /// \param position New position
+    ///
+    ////////////////////////////////////////////////////////////
+    [[gnu::always_inline]] void setPosition(Vector2f position);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the orientation of the object
+    ///
+    /// \param angle New rotation
+    ///
+    ////////////////////////////////////////////////////////////
+    [[gnu::always_inline]] void setRotation(Angle angle);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the scale factors of the object
+    ///
+    /// \param factors New scale factors
+    ///
+    ////////////////////////////////////////////////////////////
+    [[gnu::always_inline]] void setScale(Vector2f factors);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the local origin of the object
+    ///
+    /// \param origin New origin
+    ///
+    ////////////////////////////////////////////////////////////
+    [[gnu::always_inline]] void setOrigin(Vector2f origin);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Move the object by a given offset
+    ///
+    /// \param offset Offset added to the current position
+    ///
+    ////////////////////////////////////////////////////////////
+    [[gnu::always_inline]] void move(Vector2f offset);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Rotate the object
+    ///
+    /// \param angle Angle added to the current rotation
+    ///
+    ////////////////////////////////////////////////////////////
+    [[gnu::always_inline]] void rotate(Angle angle);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Scale the object
+    ///
+    /// \param factors Factors multiplied with the current scale
+    ///
+    ////////////////////////////////////////////////////////////
+    [[gnu::always_inline]] void scaleBy(Vector2f factors);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the position of the object
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard, gnu::always_inline, gnu::pure]] Vector2f getPosition() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the orientation of the object, wrapped to [0, 360) degrees
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard, gnu::always_inline, gnu::pure]] Angle getRotation() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the scale factors of the object
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard, gnu::always_inline, gnu::pure]] Vector2f getScale() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the local origin of the object
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard, gnu::always_inline, gnu::pure]] Vector2f getOrigin() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get all the components of the object at once
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard, gnu::always_inline, gnu::pure]] const Transformable& getComponents() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Check whether the cached transform is out of date
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard, gnu::always_inline, gnu::pure]] bool isTransformDirty() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the combined transform of the object
+    ///
+    /// Recomputed only if a component changed since the last call.
+    ///
+    /// \return Transform combining the position/rotation/scale/origin of the object
+    ///
+    /// \see `getInverseTransform`, `updateTransforms`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard, gnu::always_inline]] const Transform& getTransform() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the inverse of the combined transform of the object
+    ///
+    /// Recomputed only if a component changed since the last call.
+    ///
+    /// \return Inverse of the combined transformations applied to the object
+    ///
+    /// \see `getTransform`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard, gnu::always_inline]] const Transform& getInverseTransform() const;
+
+private:
+    ////////////////////////////////////////////////////////////
+    /// \brief Mark both cached transforms as out of date
+    ///
+    ////////////////////////////////////////////////////////////
+    [[gnu::always_inline]] void markDirty();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Recompute the cached transform
+    ///
+    ////////////////////////////////////////////////////////////
+    void updateTransform() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Recompute the cached inverse transform
+    ///
+    ////////////////////////////////////////////////////////////
+    void updateInverseTransform() const;
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    Transformable     m_components;                   //!< Position, rotation, scale and origin
+    mutable Transform m_transform;                    //!< Combined transform, valid unless dirty
+    mutable Transform m_inverseTransform;             //!< Inverse of the combined transform, valid unless dirty
+    mutable bool      m_transformDirty{false};        //!< Does `m_transform` need to be recomputed?
+    mutable bool      m_inverseTransformDirty{false}; //!< Does `m_inverseTransform` need to be recomputed?
+};
+
+} // namespace sf
+
+#include "SFML/Graphics/CachedTransformable.inl"
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::CachedTransformable
+/// \ingroup graphics
+///
+/// `sf::Transformable` exposes its components as plain data
+/// members and recomputes its transform on every call to
+/// `getTransform`, which is cheap but not free: a sine, a cosine
+/// and a handful of multiplications per object and per draw.
+///
+/// `sf::CachedTransformable` trades the plain data members for
+/// setters, which lets it remember when its transform and
+/// inverse transform are out of date. Objects that did not move
+/// since the last frame then cost a copy of their cached matrix.
+///
+/// When many objects change every frame, refreshing them in one
+/// pass with `updateTransforms` computes their sines and cosines
+/// in batches, and leaves `getTransform` free of writes so that
+/// the objects can be drawn from several threads:
+/// \code
+/// std::vector<sf::CachedTransformable> transformables(100'000);
+/// std::vector<sf::Sprite>              sprites(100'000, sf::Sprite{textureRect});
+///
+/// // Every frame
+/// transformables[i].move({1.f, 0.f}); // only a few objects move
+///
+/// sf::CachedTransformable::updateTransforms({transformables.data(), transformables.size()});
+///
+/// for (std::size_t i = 0; i < sprites.size(); ++i)
+///     batch.add(sprites[i], transformables[i].getTransform());
+/// \endcode
+///
+/// \see `sf::Transformable`, `sf::Transform`
+///
+////////////////////////////////////////////////////////////
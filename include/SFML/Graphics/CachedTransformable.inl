@@ -0,0 +1,137 @@
+#include <SFML/Copyright.hpp> // LICENSE AND COPYRIGHT (C) INFORMATION
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include "SFML/Graphics/CachedTransformable.hpp" // NOLINT(misc-header-include-cycle)
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+inline void CachedTransformable::setPosition(Vector2f position)
+{
+    m_components.position = position;
+    markDirty();
+}
+
+
+////////////////////////////////////////////////////////////
+inline void CachedTransformable::setRotation(Angle angle)
+{
+    m_components.rotation = angle.wrapUnsigned();
+    markDirty();
+}
+
+
+////////////////////////////////////////////////////////////
+inline void CachedTransformable::setScale(Vector2f factors)
+{
+    m_components.scale = factors;
+    markDirty();
+}
+
+
+////////////////////////////////////////////////////////////
+inline void CachedTransformable::setOrigin(Vector2f origin)
+{
+    m_components.origin = origin;
+    markDirty();
+}
+
+
+////////////////////////////////////////////////////////////
+inline void CachedTransformable::move(Vector2f offset)
+{
+    m_components.position += offset;
+    markDirty();
+}
+
+
+////////////////////////////////////////////////////////////
+inline void CachedTransformable::rotate(Angle angle)
+{
+    // Stored wrapped, so that repeated rotations do not lose precision as the angle grows
+    m_components.rotation = (getRotation() + angle).wrapUnsigned();
+    markDirty();
+}
+
+
+////////////////////////////////////////////////////////////
+inline void CachedTransformable::scaleBy(Vector2f factors)
+{
+    m_components.scaleBy(factors);
+    markDirty();
+}
+
+
+////////////////////////////////////////////////////////////
+inline Vector2f CachedTransformable::getPosition() const
+{
+    return m_components.position;
+}
+
+
+////////////////////////////////////////////////////////////
+inline Angle CachedTransformable::getRotation() const
+{
+    return m_components.rotation;
+}
+
+
+////////////////////////////////////////////////////////////
+inline Vector2f CachedTransformable::getScale() const
+{
+    return m_components.scale;
+}
+
+
+////////////////////////////////////////////////////////////
+inline Vector2f CachedTransformable::getOrigin() const
+{
+    return m_components.origin;
+}
+
+
+////////////////////////////////////////////////////////////
+inline const Transformable& CachedTransformable::getComponents() const
+{
+    return m_components;
+}
+
+
+////////////////////////////////////////////////////////////
+inline bool CachedTransformable::isTransformDirty() const
+{
+    return m_transformDirty;
+}
+
+
+////////////////////////////////////////////////////////////
+inline const Transform& CachedTransformable::getTransform() const
+{
+    if (m_transformDirty) [[unlikely]]
+        updateTransform();
+
+    return m_transform;
+}
+
+
+////////////////////////////////////////////////////////////
+inline const Transform& CachedTransformable::getInverseTransform() const
+{
+    if (m_inverseTransformDirty) [[unlikely]]
+        updateInverseTransform();
+
+    return m_inverseTransform;
+}
+
+
+////////////////////////////////////////////////////////////
+inline void CachedTransformable::markDirty()
+{
+    m_transformDirty        = true;
+    m_inverseTransformDirty = true;
+}
+
+} // namespace sf
@@ -25,6 +25,7 @@ class GLPersistentBuffer;
 class RenderTarget;
 class Shape;
 class Text;
+class Texture;
 struct GLElementBufferObject;
 struct GLVertexBufferObject;
 struct Sprite;
@@ -154,6 +155,16 @@ struct PersistentGPUStorage
     IndexType nIndices{};  //!< Number of "active" indices in the buffer
 };
 
+////////////////////////////////////////////////////////////
+/// \brief Range of a batch's indices drawn with the same texture
+///
+////////////////////////////////////////////////////////////
+struct TextureRun
+{
+    const Texture* texture;    //!< Texture of the run, null to use the texture of the render states
+    IndexType      firstIndex; //!< Index at which the run starts
+};
+
 ////////////////////////////////////////////////////////////
 /// \brief TODO P1: docs
 ///
@@ -183,6 +194,36 @@ public:
     ////////////////////////////////////////////////////////////
     void add(const Sprite& sprite);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Add a sprite that is drawn with its own texture
+    ///
+    /// The batch is split into one draw call per change of
+    /// texture, so sprites sharing a texture should be added
+    /// consecutively. Drawables added without a texture use
+    /// the texture of the render states, as usual.
+    ///
+    /// When all the images fit in a `TextureArray`, prefer
+    /// using it instead, as the batch is then drawn at once.
+    ///
+    /// \param sprite  Sprite to add, in pixel coordinates
+    /// \param texture Texture to draw the sprite with
+    ///
+    ////////////////////////////////////////////////////////////
+    void add(const Sprite& sprite, const Texture& texture);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Add a sprite with a precomputed transform
+    ///
+    /// The position, rotation, scale and origin of `sprite` are
+    /// ignored in favor of `transform`, which is typically the
+    /// cached transform of a `CachedTransformable`.
+    ///
+    /// \param sprite    Sprite to add, for its texture rectangle and color
+    /// \param transform Transform to apply to the sprite
+    ///
+    ////////////////////////////////////////////////////////////
+    void add(const Sprite& sprite, const Transform& transform);
+
     ////////////////////////////////////////////////////////////
     /// \brief TODO P1: docs
     ///
@@ -190,7 +231,15 @@ public:
     void add(const Shape& shape);
 
     ////////////////////////////////////////////////////////////
-    /// \brief TODO P1: docs
+    /// \brief Add the glyphs of a text to the batch
+    ///
+    /// If the font of the text uses signed distance field
+    /// glyphs, the batch is drawn with the shader returned by
+    /// `GraphicsContext::getBuiltInSdfTextShader` unless the
+    /// render states provide one, so it should not mix such
+    /// texts with other drawables. Its outline uniforms must be
+    /// set by the caller: they are per batch, not per text, and
+    /// the outline quads of the text are not added.
     ///
     ////////////////////////////////////////////////////////////
     void add(const Text& text);
@@ -204,10 +253,18 @@ public:
 private:
     friend RenderTarget;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Start a new texture run if the texture changed
+    ///
+    ////////////////////////////////////////////////////////////
+    void setCurrentTexture(const Texture* texture);
+
     ////////////////////////////////////////////////////////////
     // Member data
     ////////////////////////////////////////////////////////////
-    TStorage m_storage;
+    TStorage                        m_storage;
+    base::TrivialVector<TextureRun> m_textureRuns; //!< Empty unless textures were given to `add`
+    bool                            m_sdfText{};   //!< Whether text with distance field glyphs was added
 };
 
 ////////////////////////////////////////////////////////////
@@ -30,6 +30,7 @@ namespace sf
 class GraphicsContext;
 class InputStream;
 class Path;
+class Shader;
 class Text;
 class Texture;
 class TextureAtlas;
@@ -47,6 +48,25 @@ namespace sf
 class SFML_GRAPHICS_API Font
 {
 public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Character size at which signed distance field glyphs are rasterized
+    ///
+    /// \see `setSdf`
+    ///
+    ////////////////////////////////////////////////////////////
+    static constexpr unsigned int sdfReferenceSize = 64u;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Distance, in pixels at the reference size, covered by signed distance fields on each side of an edge
+    ///
+    /// Also bounds the thickness of the outlines and glows that
+    /// can be drawn around distance field glyphs.
+    ///
+    /// \see `setSdf`
+    ///
+    ////////////////////////////////////////////////////////////
+    static constexpr unsigned int sdfSpread = 8u;
+
     ////////////////////////////////////////////////////////////
     /// \brief Destructor
     ///
@@ -86,11 +106,24 @@ public:
     /// fonts installed on the user's system, thus you can't
     /// load them directly.
     ///
+    /// The file is memory-mapped rather than read: only the parts
+    /// of it that are actually needed are ever loaded, so opening
+    /// a large font (e.g. CJK) is fast and glyphs can be rendered
+    /// before the whole file has been touched.
+    ///
+    /// If \a shareFace is `true`, all the fonts opened from the
+    /// same file with it share a single mapping and FreeType face,
+    /// which saves memory when a font is opened many times. Each
+    /// of them still has its own glyph cache. As the face is not
+    /// thread-safe, such fonts must not be used from different
+    /// threads at the same time, just like copies of a font.
+    ///
     /// \warning SFML cannot preload all the font data in this
     /// function, so the file has to remain accessible until
     /// the sf::Font object is destroyed.
     ///
-    /// \param filename Path of the font file to load
+    /// \param filename  Path of the font file to load
+    /// \param shareFace Share the face with the other fonts opened from the same file with `shareFace` set
     ///
     /// \return Font if opening succeeded, `base::nullOpt` if it failed
     ///
@@ -99,7 +132,8 @@ public:
     ////////////////////////////////////////////////////////////
     [[nodiscard]] static base::Optional<Font> openFromFile(GraphicsContext& graphicsContext,
                                                            const Path&      filename,
-                                                           TextureAtlas*    textureAtlas = nullptr);
+                                                           TextureAtlas*    textureAtlas = nullptr,
+                                                           bool             shareFace    = false);
 
     ////////////////////////////////////////////////////////////
     /// \brief Open the font from a file in memory
@@ -294,7 +328,48 @@ public:
     ////////////////////////////////////////////////////////////
     [[nodiscard]] bool isSmooth() const;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Enable or disable signed distance field glyphs
+    ///
+    /// In this mode, each glyph is rasterized only once, at
+    /// `sdfReferenceSize`, as a signed distance field: every
+    /// texel stores its distance to the closest edge of the
+    /// glyph rather than its coverage. The same texels are then
+    /// used for every character size, and stay sharp under any
+    /// scale or rotation.
+    ///
+    /// Distance field glyphs must be drawn with the shader
+    /// returned by `GraphicsContext::getBuiltInSdfTextShader`,
+    /// which `sf::Text` selects automatically. It also draws
+    /// outlines, so outlined glyphs are not rasterized at all.
+    ///
+    /// Glyphs are not hinted in this mode, and the smooth filter
+    /// must be enabled. Changing the mode discards the glyphs
+    /// that were already loaded, so it should be done right
+    /// after opening the font.
+    ///
+    /// This mode is disabled by default.
+    ///
+    /// \param sdf `true` to enable signed distance field glyphs, `false` to disable them
+    ///
+    /// \see `isSdf`
+    ///
+    ////////////////////////////////////////////////////////////
+    void setSdf(bool sdf);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether glyphs are rendered as signed distance fields
+    ///
+    /// \return `true` if signed distance field glyphs are enabled, `false` otherwise
+    ///
+    /// \see `setSdf`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool isSdf() const;
+
 private:
+    friend Text;
+
     ////////////////////////////////////////////////////////////
     /// \brief Return the index of the internal representation a character
     ///
@@ -313,6 +388,12 @@ private:
     ////////////////////////////////////////////////////////////
     [[nodiscard]] bool setCurrentSize(unsigned int characterSize) const;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the shader used to draw distance field glyphs
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] const Shader& getSdfShader() const;
+
 public:
     ////////////////////////////////////////////////////////////
     /// \private
@@ -331,7 +412,7 @@ private:
     // Member data
     ////////////////////////////////////////////////////////////
     struct Impl;
-    base::InPlacePImpl<Impl, 256> m_impl; //!< Implementation details
+    base::InPlacePImpl<Impl, 320> m_impl; //!< Implementation details
 
     ////////////////////////////////////////////////////////////
     // Lifetime tracking
@@ -403,6 +484,17 @@ private:
 /// If you need to display text of a certain size, make sure the
 /// corresponding bitmap font that supports that size is used.
 ///
+/// Text that is scaled, zoomed or drawn at many different sizes
+/// can instead use signed distance field glyphs (see `setSdf`),
+/// which are rasterized once and stay sharp at any size:
+/// \code
+/// auto font = sf::Font::openFromFile("arial.ttf").value();
+/// font.setSdf(true);
+///
+/// sf::Text title(font, {.string = "Title", .characterSize = 200});
+/// title.setOutlineThickness(4.f); // Drawn by the distance field shader
+/// \endcode
+///
 /// \see `sf::Text`
 ///
 ////////////////////////////////////////////////////////////
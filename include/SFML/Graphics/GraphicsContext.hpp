@@ -22,6 +22,7 @@ class RenderTextureImplFBO;
 
 namespace sf
 {
+class Path;
 class Shader;
 class Texture;
 } // namespace sf
@@ -39,9 +40,71 @@ public:
     explicit GraphicsContext();
     ~GraphicsContext();
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Construct the context with a shader program cache
+    ///
+    /// Linked shader programs are saved as driver-specific
+    /// binaries in \p shaderCacheDirectory and reloaded from
+    /// there on later runs, skipping compilation and linking.
+    /// The directory is created on demand.
+    ///
+    /// \param shaderCacheDirectory Directory of the shader cache
+    ///
+    ////////////////////////////////////////////////////////////
+    explicit GraphicsContext(const Path& shaderCacheDirectory);
+
     [[nodiscard]] Shader&  getBuiltInShader();
     [[nodiscard]] Texture& getBuiltInWhiteDotTexture();
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the built-in shader used to draw from texture arrays
+    ///
+    /// The shader is compiled on first use.
+    ///
+    /// \see `sf::TextureArray`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Shader& getBuiltInTextureArrayShader();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the built-in shader used to draw signed distance field text
+    ///
+    /// The shader is compiled on first use. It uses the vertex
+    /// color as fill color, and draws an optional outline and
+    /// glow around the glyphs, controlled by these uniforms:
+    /// \li `vec4 sf_u_outlineColor`
+    /// \li `float sf_u_outlineWidth`
+    /// \li `vec4 sf_u_glowColor`
+    /// \li `float sf_u_glowWidth`
+    ///
+    /// Widths are expressed in distance field units: 0.5 spans
+    /// `Font::sdfSpread` pixels at `Font::sdfReferenceSize`.
+    /// `sf::Text` sets the outline uniforms from its own outline
+    /// properties when drawn, while the glow is left to the user.
+    ///
+    /// \see `sf::Font::setSdf`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Shader& getBuiltInSdfTextShader();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Change the directory of the shader program cache
+    ///
+    /// Only affects shaders created after the call.
+    ///
+    /// \param shaderCacheDirectory Directory of the shader cache, empty to disable caching
+    ///
+    ////////////////////////////////////////////////////////////
+    void setShaderCacheDirectory(const Path& shaderCacheDirectory);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the directory of the shader program cache
+    ///
+    /// \return Directory of the shader cache, empty if caching is disabled
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] const Path& getShaderCacheDirectory() const;
+
 private:
     friend Shader;
     friend priv::RenderTextureImplFBO;
@@ -55,7 +118,7 @@ private:
     // Member data
     ////////////////////////////////////////////////////////////
     struct Impl;
-    base::InPlacePImpl<Impl, 512> m_impl; //!< Implementation details
+    base::InPlacePImpl<Impl, 1024> m_impl; //!< Implementation details
 };
 
 } // namespace sf
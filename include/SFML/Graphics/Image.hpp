@@ -21,6 +21,7 @@
 namespace sf
 {
 class InputStream;
+class JobSystem;
 class Path;
 
 ////////////////////////////////////////////////////////////
@@ -42,6 +43,17 @@ public:
         JPG
     };
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Filters used to resample an image
+    ///
+    ////////////////////////////////////////////////////////////
+    enum class [[nodiscard]] ResampleFilter
+    {
+        Box,      //!< Average of the covered source pixels, cheapest and best suited to halving
+        Bilinear, //!< Triangle filter, widened when downscaling
+        Lanczos3  //!< Windowed sinc filter with three lobes, sharpest but may ring near hard edges
+    };
+
     ////////////////////////////////////////////////////////////
     /// \brief Construct the image and fill it with a unique color
     ///
@@ -140,13 +152,36 @@ public:
     ////////////////////////////////////////////////////////////
     void createMaskFromColor(Color color, base::U8 alpha = 0);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Replace every pixel of a specified color-key
+    ///
+    /// Unlike `createMaskFromColor`, all four components of the
+    /// matching pixels are replaced.
+    ///
+    /// \param color       Color to replace
+    /// \param replacement Color to assign to the matching pixels
+    ///
+    ////////////////////////////////////////////////////////////
+    void replaceColor(Color color, Color replacement);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Fill a rectangle of the image with a color
+    ///
+    /// The parts of \a `rect` outside of the image are ignored.
+    ///
+    /// \param rect  Rectangle to fill, in pixels
+    /// \param color Fill color
+    ///
+    ////////////////////////////////////////////////////////////
+    void fillRect(const IntRect& rect, Color color);
+
     ////////////////////////////////////////////////////////////
     /// \brief Copy pixels from another image onto this one
     ///
-    /// This function does a slow pixel copy and should not be
-    /// used intensively. It can be used to prepare a complex
-    /// static image from several others, but if you need this
-    /// kind of feature in real-time you'd better use `sf::RenderTexture`.
+    /// This function copies the pixels on the CPU. It can be used
+    /// to prepare a complex static image from several others, but
+    /// if you need this kind of feature in real-time you'd better
+    /// use `sf::RenderTexture`.
     ///
     /// If \a `sourceRect` is empty, the whole image is copied.
     /// If \a `applyAlpha` is set to `true`, alpha blending is
@@ -232,6 +267,78 @@ public:
     ////////////////////////////////////////////////////////////
     void flipVertically();
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Multiply the color components of each pixel by its alpha
+    ///
+    /// Each of the red, green and blue components becomes
+    /// `(component * alpha + 127) / 255`, i.e. the product rounded
+    /// to the nearest integer.
+    ///
+    /// \see `unpremultiplyAlpha`
+    ///
+    ////////////////////////////////////////////////////////////
+    void premultiplyAlpha();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Divide the color components of each pixel by its alpha
+    ///
+    /// Each of the red, green and blue components becomes
+    /// `(component * 255 + alpha / 2) / alpha`, clamped to 255.
+    /// Fully transparent pixels are left unchanged.
+    ///
+    /// Premultiplying then unpremultiplying loses precision for
+    /// pixels with a small alpha.
+    ///
+    /// \see `premultiplyAlpha`
+    ///
+    ////////////////////////////////////////////////////////////
+    void unpremultiplyAlpha();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Rearrange the components of each pixel
+    ///
+    /// Each parameter is the index of the component, in the
+    /// original pixel, to write to the corresponding component:
+    /// 0 for red, 1 for green, 2 for blue and 3 for alpha.
+    /// For example, `swizzleChannels(2, 1, 0, 3)` converts
+    /// between RGBA and BGRA.
+    ///
+    /// \param red   Source of the red component
+    /// \param green Source of the green component
+    /// \param blue  Source of the blue component
+    /// \param alpha Source of the alpha component
+    ///
+    ////////////////////////////////////////////////////////////
+    void swizzleChannels(base::U8 red, base::U8 green, base::U8 blue, base::U8 alpha);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Create a resampled copy of the image
+    ///
+    /// The filter is applied separably, first along columns
+    /// then along rows, with edge pixels extended past the
+    /// borders of the image. Components are filtered as they
+    /// are stored: call `premultiplyAlpha` beforehand to keep
+    /// the color of transparent pixels from bleeding into
+    /// their neighbors.
+    ///
+    /// Rows of the result are independent of each other: if
+    /// \a jobSystem is provided, they are computed in bands on
+    /// its workers. The result does not depend on the number of
+    /// workers.
+    ///
+    /// \param size      Size of the resampled image
+    /// \param filter    Filter to resample with
+    /// \param jobSystem Job system to spread the work over, or `nullptr` to use the calling thread only
+    ///
+    /// \return Resampled image, or `base::nullOpt` if \a size is zero
+    ///
+    /// \see `ImageUtils::generateMipChain`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] base::Optional<Image> resized(Vector2u       size,
+                                                ResampleFilter filter    = ResampleFilter::Box,
+                                                JobSystem*     jobSystem = nullptr) const;
+
     ////////////////////////////////////////////////////////////
     /// \private
     ///
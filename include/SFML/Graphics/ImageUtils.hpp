@@ -6,6 +6,8 @@
 ////////////////////////////////////////////////////////////
 #include "SFML/Graphics/Export.hpp"
 
+#include "SFML/Graphics/Image.hpp"
+
 #include "SFML/Base/IntTypes.hpp"
 
 #include <vector>
@@ -16,8 +18,8 @@
 ////////////////////////////////////////////////////////////
 namespace sf
 {
+class JobSystem;
 class Path;
-class Image;
 } // namespace sf
 
 
@@ -77,6 +79,34 @@ public:
     ///
     ////////////////////////////////////////////////////////////
     [[nodiscard]] static std::vector<base::U8> saveToMemory(const Image& image, SaveFormat format);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Generate the mipmap levels of an image
+    ///
+    /// Each level halves the dimensions of the previous one,
+    /// rounding down and stopping at 1, until the last level
+    /// has a size of 1x1. Each level is resampled from the
+    /// previous one, in bands of rows spread over the workers
+    /// of \a jobSystem if provided.
+    ///
+    /// The base level is not part of the result, which is empty
+    /// for a 1x1 image. The levels can be uploaded to a texture
+    /// with `Texture::uploadMipmap`, without generating them on
+    /// the GPU.
+    ///
+    /// \param image     Base level of the mipmap
+    /// \param jobSystem Job system to spread the work over, or `nullptr` to use the calling thread only
+    /// \param filter    Filter used to resample each level
+    ///
+    /// \return Levels 1 to N of the mipmap, from the largest to the smallest
+    ///
+    /// \see `Image::resized`, `Texture::uploadMipmap`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static std::vector<Image> generateMipChain(
+        const Image&          image,
+        JobSystem*            jobSystem = nullptr,
+        Image::ResampleFilter filter    = Image::ResampleFilter::Box);
 };
 
 } // namespace sf
@@ -19,6 +19,7 @@ namespace sf
 {
 class Shader;
 class Texture;
+class TextureArray;
 } // namespace sf
 
 
@@ -45,8 +46,9 @@ struct [[nodiscard]] SFML_GRAPHICS_API RenderStates
     // NOLINTNEXTLINE(readability-redundant-member-init)
     Transform transform{}; //!< Transform
 
-    const Texture* texture{}; //!< Texture
-    const Shader*  shader{};  //!< Shader
+    const Texture*      texture{};      //!< Texture
+    const Shader*       shader{};       //!< Shader
+    const TextureArray* textureArray{}; //!< Texture array (takes precedence over `texture`)
 
     CoordinateType coordinateType{CoordinateType::Pixels}; //!< Texture coordinate type
 };
@@ -32,6 +32,7 @@ class PersistentGPUDrawableBatch;
 class Shader;
 class Shape;
 class Texture;
+class TextureArray;
 class VertexBuffer;
 struct BlendMode;
 struct GLElementBufferObject;
@@ -47,6 +48,7 @@ struct View;
 namespace sf::priv
 {
 struct PersistentGPUStorage;
+struct TextureRun;
 } // namespace sf::priv
 
 
@@ -584,6 +586,14 @@ private:
     ////////////////////////////////////////////////////////////
     void setupDrawTexture(const RenderStates& states, bool shaderChanged);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Setup environment for drawing: texture array
+    ///
+    /// \param textureArray Texture array to use for drawing
+    ///
+    ////////////////////////////////////////////////////////////
+    void setupDrawTextureArray(const TextureArray& textureArray, bool shaderChanged);
+
     ////////////////////////////////////////////////////////////
     /// \brief Draw non-indexed primitives
     ///
@@ -599,9 +609,25 @@ private:
     ///
     /// \param type        Type of primitives to draw
     /// \param indexCount  Number of indices to use when drawing
+    /// \param firstIndex  Position of the first index to use when drawing
+    ///
+    ////////////////////////////////////////////////////////////
+    void drawIndexedPrimitives(PrimitiveType type, base::SizeT indexCount, base::SizeT firstIndex = 0u);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Draw the already uploaded indices of a batch, one draw call per texture run
+    ///
+    /// \param runs       Texture runs of the batch
+    /// \param runCount   Number of texture runs
+    /// \param indexCount Total number of indices of the batch
+    /// \param states     Render states to use for runs without a texture
     ///
     ////////////////////////////////////////////////////////////
-    void drawIndexedPrimitives(PrimitiveType type, base::SizeT indexCount);
+    void drawTextureRuns(bool                    persistent,
+                         const priv::TextureRun* runs,
+                         base::SizeT             runCount,
+                         base::SizeT             indexCount,
+                         const RenderStates&     states);
 
     ////////////////////////////////////////////////////////////
     /// \brief Clean up environment after drawing
@@ -175,6 +175,15 @@ public:
     ////////////////////////////////////////////////////////////
     [[nodiscard]] base::Optional<Event> waitEvent(Time timeout = Time::Zero);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Handles all pending events and forwards to `WindowBase::handleEvents`
+    ///
+    /// \see WindowBase::handleEvents
+    ///
+    ////////////////////////////////////////////////////////////
+    template <typename... Handlers>
+    base::SizeT handleEvents(Handlers&&... handlers);
+
 private:
     ////////////////////////////////////////////////////////////
     /// \brief Construct a new window
@@ -214,6 +223,8 @@ private:
 
 } // namespace sf
 
+#include "SFML/Graphics/RenderWindow.inl"
+
 
 ////////////////////////////////////////////////////////////
 /// \class sf::RenderWindow
@@ -0,0 +1,30 @@
+#include <SFML/Copyright.hpp> // LICENSE AND COPYRIGHT (C) INFORMATION
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include "SFML/Graphics/RenderWindow.hpp" // NOLINT(misc-header-include-cycle)
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+template <typename... Handlers>
+base::SizeT RenderWindow::handleEvents(Handlers&&... handlers)
+{
+    static_assert(sizeof...(Handlers) > 0, "Must provide at least one handler");
+
+    const auto dispatch = [&](const Event& event)
+    { event.match(static_cast<Handlers&&>(handlers)..., [](const priv::DelayOverloadResolution&) { /* ignore */ }); };
+
+    return drainEvents(
+        [this, &dispatch](const Event& event)
+        {
+            if (event.is<Event::Resized>())
+                onResize();
+
+            dispatch(event);
+        });
+}
+
+} // namespace sf
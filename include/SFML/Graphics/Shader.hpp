@@ -25,6 +25,7 @@ class InputStream;
 class Path;
 class RenderTarget;
 class Texture;
+class UniformBlock;
 } // namespace sf
 
 
@@ -592,6 +593,32 @@ public:
     ////////////////////////////////////////////////////////////
     void setUniformArray(UniformLocation location, const Glsl::Mat4* matrixArray, base::SizeT length);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Attach a uniform block to a GLSL uniform block
+    ///
+    /// The GLSL block named \p blockName is associated with the
+    /// binding point of \p block, so that its contents are read
+    /// from the block's buffer. The same block can be attached
+    /// to any number of shaders, which then all see the updates
+    /// made with a single `UniformBlock::update` call.
+    ///
+    /// It is important to note that \p block must remain alive
+    /// as long as the shader uses it, no copy is made internally.
+    ///
+    /// \param blockName Name of the uniform block in GLSL
+    /// \param block     Uniform block to attach
+    ///
+    /// \return `true` on success, `false` if the shader has no active block named \p blockName
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool setUniformBlock(base::StringView blockName, const UniformBlock& block);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Disallow setting from a temporary uniform block
+    ///
+    ////////////////////////////////////////////////////////////
+    void setUniformBlock(base::StringView blockName, const UniformBlock&& block) = delete;
+
     ////////////////////////////////////////////////////////////
     /// \brief Get the underlying OpenGL handle of the shader.
     ///
@@ -693,13 +720,10 @@ private:
     void bindTextures() const;
 
     ////////////////////////////////////////////////////////////
-    /// \brief RAII object to save and restore the program
-    ///        binding while uniforms are being set
-    ///
-    /// Implementation is private in the .cpp file.
+    /// \brief Bind all the uniform blocks used by the shader
     ///
     ////////////////////////////////////////////////////////////
-    class [[nodiscard]] UniformBinder;
+    void bindUniformBlocks() const;
 
     ////////////////////////////////////////////////////////////
     // Member data
@@ -768,6 +792,16 @@ private:
 /// shader.setUniform("current", sf::Shader::CurrentTexture);
 /// \endcode
 ///
+/// Uniforms are written directly into the program object, so
+/// setting them neither requires the shader to be bound nor
+/// disturbs the currently bound program. On WebGL, which cannot
+/// do that, the shader is temporarily bound instead.
+///
+/// Parameters shared by several shaders, or updated together
+/// every frame, can be grouped in a GLSL uniform block and
+/// uploaded all at once through a `sf::UniformBlock` attached
+/// with `setUniformBlock()`.
+///
 /// The special `Shader::CurrentTexture` argument maps the
 /// given \p sampler2D uniform to the current texture of the
 /// object being drawn (which cannot be known in advance).
@@ -821,6 +855,6 @@ private:
 /// sf::Shader::bind(nullptr);
 /// \endcode
 ///
-/// \see `sf::Glsl`
+/// \see `sf::Glsl`, `sf::UniformBlock`
 ///
 ////////////////////////////////////////////////////////////
@@ -77,18 +77,19 @@ public:
 namespace sf::priv
 {
 ////////////////////////////////////////////////////////////
-/// \brief TODO P1: docs
+/// \brief Write the quad of `sprite`, transformed by `transform`
+///         instead of its own components, to `target`
 ///
 ////////////////////////////////////////////////////////////
-[[gnu::always_inline, gnu::flatten]] inline void spriteToVertices(const Sprite& sprite, Vertex* target)
+[[gnu::always_inline, gnu::flatten]] inline void spriteToVertices(const Sprite&    sprite,
+                                                                  const Transform& transform,
+                                                                  Vertex*          target)
 {
     const auto& [position, size] = sprite.textureRect;
     const Vector2f absSize(base::fabs(size.x), base::fabs(size.y)); // TODO P0: consider dropping support for negative UVs
 
     // Position
     {
-        const auto transform = sprite.getTransform();
-
         target[0].position.x = transform.a02;
         target[0].position.y = transform.a12;
 
@@ -118,6 +119,16 @@ namespace sf::priv
     }
 }
 
+
+////////////////////////////////////////////////////////////
+/// \brief Write the quad of `sprite`, transformed by its own components, to `target`
+///
+////////////////////////////////////////////////////////////
+[[gnu::always_inline, gnu::flatten]] inline void spriteToVertices(const Sprite& sprite, Vertex* target)
+{
+    spriteToVertices(sprite, sprite.getTransform(), target);
+}
+
 } // namespace sf::priv
 
 
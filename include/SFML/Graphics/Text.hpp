@@ -263,6 +263,11 @@ public:
     /// Be aware that using a negative value for the outline
     /// thickness will cause distorted rendering.
     ///
+    /// With signed distance field fonts (see `Font::setSdf`),
+    /// the outline is drawn by the shader instead, and cannot
+    /// be thicker than `Font::sdfSpread` pixels at
+    /// `Font::sdfReferenceSize`, scaled to the character size.
+    ///
     /// \param thickness New outline thickness, in pixels
     ///
     /// \see `getOutlineThickness`
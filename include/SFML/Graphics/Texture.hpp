@@ -15,6 +15,7 @@
 #include "SFML/Base/Optional.hpp"
 #include "SFML/Base/PassKey.hpp"
 #include "SFML/Base/SizeT.hpp"
+#include "SFML/Base/Span.hpp"
 
 
 namespace sf
@@ -461,6 +462,32 @@ public:
     ////////////////////////////////////////////////////////////
     [[nodiscard]] bool generateMipmap();
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Upload a mipmap generated on the CPU
+    ///
+    /// Uploads each level with its own call to OpenGL, as an
+    /// alternative to `generateMipmap` for mipmaps built ahead
+    /// of time or on other threads, e.g. with
+    /// `ImageUtils::generateMipChain`.
+    ///
+    /// \a levels starts at level 1, the base level being the
+    /// current contents of the texture. Level `i` must have a
+    /// size of `max(1, size >> i)`. The chain may stop before
+    /// the 1x1 level, in which case sampling is limited to the
+    /// uploaded levels.
+    ///
+    /// Like a generated mipmap, the uploaded levels are discarded
+    /// the next time the base level is modified.
+    ///
+    /// \param levels Levels 1 to N of the mipmap, from the largest to the smallest
+    ///
+    /// \return `true` if the levels were uploaded, `false` if their sizes do not match the texture
+    ///
+    /// \see `generateMipmap`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool uploadMipmap(base::Span<const Image> levels);
+
     ////////////////////////////////////////////////////////////
     /// \brief Swap the contents of this texture with those of another
     ///
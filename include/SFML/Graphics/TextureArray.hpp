@@ -0,0 +1,276 @@
+#pragma once
+#include <SFML/Copyright.hpp> // LICENSE AND COPYRIGHT (C) INFORMATION
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include "SFML/Graphics/Export.hpp"
+
+#include "SFML/System/Rect.hpp"
+#include "SFML/System/Vector2.hpp"
+
+#include "SFML/Base/IntTypes.hpp"
+#include "SFML/Base/Optional.hpp"
+#include "SFML/Base/PassKey.hpp"
+
+
+////////////////////////////////////////////////////////////
+// Forward declarations
+////////////////////////////////////////////////////////////
+namespace sf
+{
+class GraphicsContext;
+class Image;
+class RenderTarget;
+} // namespace sf
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+/// \brief Stack of equally-sized images living on the graphics
+///        card, which can all be sampled by a single draw call
+///
+////////////////////////////////////////////////////////////
+class SFML_GRAPHICS_API TextureArray
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Create the texture array
+    ///
+    /// The contents of the layers are undefined until they are updated.
+    ///
+    /// \param layerSize  Width and height of each layer
+    /// \param layerCount Number of layers
+    /// \param sRgb       `true` to enable sRGB conversion, `false` to disable it
+    ///
+    /// \return Texture array on success, `base::nullOpt` if the size or
+    ///         layer count exceed the limits of the system
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static base::Optional<TextureArray> create(GraphicsContext& graphicsContext,
+                                                             Vector2u         layerSize,
+                                                             unsigned int     layerCount,
+                                                             bool             sRgb = false);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Destructor
+    ///
+    ////////////////////////////////////////////////////////////
+    ~TextureArray();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    TextureArray(const TextureArray&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy assignment
+    ///
+    ////////////////////////////////////////////////////////////
+    TextureArray& operator=(const TextureArray&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Move constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    TextureArray(TextureArray&& right) noexcept;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Move assignment
+    ///
+    ////////////////////////////////////////////////////////////
+    TextureArray& operator=(TextureArray&& right) noexcept;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Update a part of a layer from an array of pixels
+    ///
+    /// The pixel array is assumed to be in 32-bits RGBA format
+    /// and to contain `size.x * size.y` pixels.
+    ///
+    /// \param layer  Index of the layer to update
+    /// \param pixels Array of pixels to copy to the layer
+    /// \param size   Width and height of the pixel region contained in \a `pixels`
+    /// \param dest   Coordinates of the destination position in the layer
+    ///
+    ////////////////////////////////////////////////////////////
+    void update(unsigned int layer, const base::U8* pixels, Vector2u size, Vector2u dest = {0u, 0u});
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Update a part of a layer from an image
+    ///
+    /// \param layer Index of the layer to update
+    /// \param image Image to copy to the layer
+    /// \param dest  Coordinates of the destination position in the layer
+    ///
+    ////////////////////////////////////////////////////////////
+    void update(unsigned int layer, const Image& image, Vector2u dest = {0u, 0u});
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Enable or disable the smooth filter
+    ///
+    /// \param smooth `true` to enable smoothing, `false` to disable it
+    ///
+    /// \see `isSmooth`
+    ///
+    ////////////////////////////////////////////////////////////
+    void setSmooth(bool smooth);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether the smooth filter is enabled or not
+    ///
+    /// \return `true` if smoothing is enabled, `false` if it is disabled
+    ///
+    /// \see `setSmooth`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool isSmooth() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Return the size of each layer
+    ///
+    /// \return Size of each layer, in pixels
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Vector2u getLayerSize() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Return the number of layers
+    ///
+    /// \return Number of layers
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] unsigned int getLayerCount() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Map a rectangle of a layer to texture array coordinates
+    ///
+    /// Layers are laid out side by side along the X axis, with
+    /// a one pixel gap between them, so that the layer of each
+    /// vertex can be recovered from its texture coordinates.
+    /// The returned rectangle can be used as a sprite's texture
+    /// rectangle, and is only meaningful in pixel coordinates.
+    ///
+    /// \param layer Index of the layer
+    /// \param rect  Rectangle in the layer, in pixels
+    ///
+    /// \return Rectangle in texture array coordinates
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] FloatRect getTextureRect(unsigned int layer, const FloatRect& rect) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Map a whole layer to texture array coordinates
+    ///
+    /// \param layer Index of the layer
+    ///
+    /// \return Rectangle covering the layer, in texture array coordinates
+    ///
+    /// \see `getTextureRect`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] FloatRect getTextureRect(unsigned int layer) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the underlying OpenGL handle of the texture array
+    ///
+    /// \return OpenGL handle of the texture array
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] unsigned int getNativeHandle() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Bind the texture array for rendering
+    ///
+    ////////////////////////////////////////////////////////////
+    void bind(GraphicsContext& graphicsContext) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Unbind any bound texture array
+    ///
+    ////////////////////////////////////////////////////////////
+    static void unbind(GraphicsContext& graphicsContext);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the maximum number of layers allowed
+    ///
+    /// This maximum is defined by the graphics driver, and
+    /// is guaranteed to be at least 256.
+    ///
+    /// \return Maximum number of layers of a texture array
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static unsigned int getMaximumLayerCount(GraphicsContext& graphicsContext);
+
+    ////////////////////////////////////////////////////////////
+    /// \private
+    ///
+    /// \brief Construct from an existing OpenGL texture array
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] explicit TextureArray(base::PassKey<TextureArray>&&,
+                                        GraphicsContext& graphicsContext,
+                                        Vector2u         layerSize,
+                                        unsigned int     layerCount,
+                                        unsigned int     texture);
+
+private:
+    friend RenderTarget;
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    GraphicsContext* m_graphicsContext; //!< Graphics context used to create the texture array
+    Vector2u         m_layerSize;       //!< Size of each layer
+    unsigned int     m_layerCount;      //!< Number of layers
+    unsigned int     m_texture;         //!< Internal texture array identifier
+    bool             m_isSmooth{};      //!< Status of the smooth filter
+    unsigned int     m_cacheId;         //!< Unique number that identifies the array to the render target's cache
+};
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::TextureArray
+/// \ingroup graphics
+///
+/// `sf::TextureArray` stores several images of the same size
+/// in a single OpenGL array texture. Unlike `sf::TextureAtlas`,
+/// each layer can be as large as a regular texture, so content
+/// that would not fit in one atlas can still be drawn with a
+/// single draw call.
+///
+/// To draw from a texture array, set `RenderStates::textureArray`
+/// instead of `RenderStates::texture`: the built-in texture array
+/// shader then selects the layer of each vertex from its texture
+/// coordinates, as produced by `getTextureRect`.
+///
+/// Texture arrays are limited to `getMaximumLayerCount` layers.
+/// Content that does not fit can still be batched with regular
+/// textures by passing the texture to `DrawableBatch::add`, in
+/// which case the batch is split into one draw call per texture.
+///
+/// Usage example:
+/// \code
+/// auto textureArray = sf::TextureArray::create(graphicsContext, {512u, 512u}, 3u).value();
+/// textureArray.update(0u, sf::Image::loadFromFile("player.png").value());
+/// textureArray.update(1u, sf::Image::loadFromFile("enemy.png").value());
+/// textureArray.update(2u, sf::Image::loadFromFile("tiles.png").value());
+///
+/// sf::CPUDrawableBatch batch;
+///
+/// for (const Entity& entity : entities)
+/// {
+///     sf::Sprite sprite(textureArray.getTextureRect(entity.layer, entity.textureRect));
+///     sprite.position = entity.position;
+///     batch.add(sprite);
+/// }
+///
+/// window.draw(batch, {.textureArray = &textureArray});
+/// \endcode
+///
+/// \see `sf::Texture`, `sf::TextureAtlas`, `sf::RenderStates`
+///
+////////////////////////////////////////////////////////////
@@ -84,6 +84,28 @@ struct SFML_GRAPHICS_API Transformable
 
 } // namespace sf
 
+
+namespace sf::priv
+{
+////////////////////////////////////////////////////////////
+/// \brief Combine the components of a transformable into a transform
+///
+/// \param sine   Sine of the rotation of the object
+/// \param cosine Cosine of the rotation of the object
+///
+/// Allows callers that already have the sine and cosine of the
+/// rotation, e.g. from a batch, to skip computing them again.
+///
+////////////////////////////////////////////////////////////
+[[nodiscard, gnu::always_inline, gnu::flatten, gnu::pure]] constexpr Transform makeTransformableTransform(
+    Vector2f position,
+    Vector2f scale,
+    Vector2f origin,
+    float    sine,
+    float    cosine);
+
+} // namespace sf::priv
+
 #include "SFML/Graphics/Transformable.inl"
 
 
@@ -17,3 +17,26 @@ constexpr void Transformable::scaleBy(Vector2f factor)
 
 
 } // namespace sf
+
+
+namespace sf::priv
+{
+////////////////////////////////////////////////////////////
+constexpr Transform makeTransformableTransform(
+    const Vector2f position,
+    const Vector2f scale,
+    const Vector2f origin,
+    const float    sine,
+    const float    cosine)
+{
+    const float sxc = scale.x * cosine;
+    const float syc = scale.y * cosine;
+    const float sxs = scale.x * -sine;
+    const float sys = scale.y * -sine;
+    const float tx  = -origin.x * sxc - origin.y * sys + position.x;
+    const float ty  = origin.x * sxs - origin.y * syc + position.y;
+
+    return {/* a00 */ sxc, /* a01 */ sys, /* a02 */ tx, -/* a10 */ sxs, /* a11 */ syc, /* a12 */ ty};
+}
+
+} // namespace sf::priv
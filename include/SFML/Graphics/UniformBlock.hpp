@@ -0,0 +1,205 @@
+#pragma once
+#include <SFML/Copyright.hpp> // LICENSE AND COPYRIGHT (C) INFORMATION
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include "SFML/Graphics/Export.hpp"
+
+#include "SFML/Base/Optional.hpp"
+#include "SFML/Base/PassKey.hpp"
+#include "SFML/Base/SizeT.hpp"
+#include "SFML/Base/Traits/IsTriviallyCopyable.hpp"
+
+
+////////////////////////////////////////////////////////////
+// Forward declarations
+////////////////////////////////////////////////////////////
+namespace sf
+{
+class GraphicsContext;
+} // namespace sf
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+/// \brief Block of shader uniforms stored in a GPU buffer
+///
+////////////////////////////////////////////////////////////
+class SFML_GRAPHICS_API UniformBlock
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Create a uniform block
+    ///
+    /// \param size         Size of the block, in bytes
+    /// \param bindingPoint Uniform buffer binding point used by the block
+    ///
+    /// \return Uniform block on success, `base::nullOpt` if the size or
+    ///         binding point exceed the limits of the system
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static base::Optional<UniformBlock> create(GraphicsContext& graphicsContext,
+                                                             base::SizeT      size,
+                                                             unsigned int     bindingPoint);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Destructor
+    ///
+    ////////////////////////////////////////////////////////////
+    ~UniformBlock();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    UniformBlock(const UniformBlock&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy assignment
+    ///
+    ////////////////////////////////////////////////////////////
+    UniformBlock& operator=(const UniformBlock&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Move constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    UniformBlock(UniformBlock&& right) noexcept;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Move assignment
+    ///
+    ////////////////////////////////////////////////////////////
+    UniformBlock& operator=(UniformBlock&& right) noexcept;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Update a part of the block from raw bytes
+    ///
+    /// Updating the whole block lets the driver allocate fresh
+    /// storage instead of waiting for pending draw calls that
+    /// still read the previous contents.
+    ///
+    /// \param data   Bytes to copy into the block
+    /// \param size   Number of bytes to copy
+    /// \param offset Offset in the block at which to copy, in bytes
+    ///
+    /// \return `true` on success, `false` if the range exceeds the block
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool update(const void* data, base::SizeT size, base::SizeT offset = 0u);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Update the block from a parameter struct
+    ///
+    /// The layout of \p TData must match the GLSL block
+    /// (e.g. `layout(std140)`), including padding.
+    ///
+    /// \param data Struct to copy into the block
+    ///
+    /// \return `true` on success, `false` if the struct is larger than the block
+    ///
+    ////////////////////////////////////////////////////////////
+    template <typename TData>
+    [[nodiscard]] bool update(const TData& data)
+    {
+        static_assert(SFML_BASE_IS_TRIVIALLY_COPYABLE(TData), "Uniform block data must be trivially copyable");
+        return update(&data, sizeof(TData));
+    }
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Bind the block to its binding point
+    ///
+    /// Shaders using the block call this automatically.
+    ///
+    ////////////////////////////////////////////////////////////
+    void bind() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the size of the block
+    ///
+    /// \return Size of the block, in bytes
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] base::SizeT getSize() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the binding point of the block
+    ///
+    /// \return Uniform buffer binding point
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] unsigned int getBindingPoint() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the underlying OpenGL handle of the buffer
+    ///
+    /// \return OpenGL handle of the uniform buffer
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] unsigned int getNativeHandle() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \private
+    ///
+    /// \brief Construct from an existing uniform buffer
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] explicit UniformBlock(base::PassKey<UniformBlock>&&,
+                                        GraphicsContext& graphicsContext,
+                                        unsigned int     buffer,
+                                        base::SizeT      size,
+                                        unsigned int     bindingPoint);
+
+private:
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    GraphicsContext* m_graphicsContext; //!< Graphics context used to create the buffer
+    unsigned int     m_buffer;          //!< OpenGL identifier of the uniform buffer
+    base::SizeT      m_size;            //!< Size of the block, in bytes
+    unsigned int     m_bindingPoint;    //!< Uniform buffer binding point
+};
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::UniformBlock
+/// \ingroup graphics
+///
+/// `sf::UniformBlock` stores a set of shader parameters in a
+/// uniform buffer object, so that a whole struct can be
+/// uploaded with a single call instead of one `setUniform`
+/// call per parameter, and shared by several shaders.
+///
+/// Usage example:
+/// \code
+/// // GLSL:
+/// // layout(std140, binding = 0) uniform PostProcess
+/// // {
+/// //     vec4  tint;
+/// //     float exposure;
+/// //     float gamma;
+/// // };
+///
+/// struct PostProcess
+/// {
+///     sf::Glsl::Vec4 tint;
+///     float          exposure;
+///     float          gamma;
+///     float          padding[2];
+/// };
+///
+/// auto block = sf::UniformBlock::create(graphicsContext, sizeof(PostProcess), 0u).value();
+/// (void)bloomShader.setUniformBlock("PostProcess", block);
+/// (void)toneMapShader.setUniformBlock("PostProcess", block);
+///
+/// // Each frame
+/// (void)block.update(PostProcess{tint, exposure, gamma, {}});
+/// \endcode
+///
+/// \see `sf::Shader`
+///
+////////////////////////////////////////////////////////////
@@ -0,0 +1,322 @@
+#pragma once
+#include <SFML/Copyright.hpp> // LICENSE AND COPYRIGHT (C) INFORMATION
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include "SFML/Network/Export.hpp"
+
+#include "SFML/Network/IpAddress.hpp"
+
+#include "SFML/System/LifetimeDependant.hpp"
+#include "SFML/System/LifetimeDependee.hpp"
+#include "SFML/System/Time.hpp"
+
+#include "SFML/Base/IntTypes.hpp"
+#include "SFML/Base/Optional.hpp"
+#include "SFML/Base/SizeT.hpp"
+#include "SFML/Base/StringView.hpp"
+#include "SFML/Base/UniquePtr.hpp"
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+/// \brief Resolve host names on a background thread, with caching
+///
+////////////////////////////////////////////////////////////
+class SFML_NETWORK_API AsyncResolver
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Status of a resolution
+    ///
+    ////////////////////////////////////////////////////////////
+    enum class Status
+    {
+        Pending,  //!< The resolution is still in progress
+        Resolved, //!< The host name was successfully resolved
+        Failed    //!< The host name could not be resolved
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Configuration of the resolver
+    ///
+    ////////////////////////////////////////////////////////////
+    struct Settings
+    {
+        ////////////////////////////////////////////////////////////
+        /// \brief Blocking lookup of a host name, called from the worker threads
+        ///
+        ////////////////////////////////////////////////////////////
+        using LookupFunc = base::Optional<IpAddress> (*)(base::StringView hostName);
+
+        Time         positiveTtl{seconds(300.f)}; //!< How long successful resolutions are cached
+        Time         negativeTtl{seconds(10.f)};  //!< How long failed resolutions are cached
+        unsigned int workerCount{2u};             //!< Number of background threads performing lookups
+        LookupFunc   lookup{nullptr};             //!< Performs the lookups, `nullptr` for the system resolver
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Pollable handle to a (possibly pending) resolution
+    ///
+    /// A query must not outlive the resolver that created it.
+    ///
+    ////////////////////////////////////////////////////////////
+    class SFML_NETWORK_API Query
+    {
+    public:
+        ////////////////////////////////////////////////////////////
+        /// \brief Destructor
+        ///
+        /// Destroying a pending query does not cancel the lookup,
+        /// whose result will still be stored in the cache.
+        ///
+        ////////////////////////////////////////////////////////////
+        ~Query();
+
+        ////////////////////////////////////////////////////////////
+        /// \brief Deleted copy constructor
+        ///
+        ////////////////////////////////////////////////////////////
+        Query(const Query&) = delete;
+
+        ////////////////////////////////////////////////////////////
+        /// \brief Deleted copy assignment
+        ///
+        ////////////////////////////////////////////////////////////
+        Query& operator=(const Query&) = delete;
+
+        ////////////////////////////////////////////////////////////
+        /// \brief Move constructor
+        ///
+        ////////////////////////////////////////////////////////////
+        Query(Query&& rhs) noexcept;
+
+        ////////////////////////////////////////////////////////////
+        /// \brief Move assignment
+        ///
+        ////////////////////////////////////////////////////////////
+        Query& operator=(Query&& rhs) noexcept;
+
+        ////////////////////////////////////////////////////////////
+        /// \brief Get the current status of the resolution
+        ///
+        /// This function never blocks.
+        ///
+        /// \return Status of the resolution
+        ///
+        ////////////////////////////////////////////////////////////
+        [[nodiscard]] Status getStatus() const;
+
+        ////////////////////////////////////////////////////////////
+        /// \brief Tell whether the resolution has completed
+        ///
+        /// This function never blocks.
+        ///
+        /// \return `true` if the resolution succeeded or failed, `false` if it is still pending
+        ///
+        ////////////////////////////////////////////////////////////
+        [[nodiscard]] bool isReady() const;
+
+        ////////////////////////////////////////////////////////////
+        /// \brief Get the resolved address
+        ///
+        /// This function never blocks.
+        ///
+        /// \return Address if the resolution succeeded, `base::nullOpt` if it failed or is still pending
+        ///
+        ////////////////////////////////////////////////////////////
+        [[nodiscard]] base::Optional<IpAddress> getAddress() const;
+
+        ////////////////////////////////////////////////////////////
+        /// \brief Block until the resolution has completed
+        ///
+        /// \return Address if the resolution succeeded, `base::nullOpt` otherwise
+        ///
+        ////////////////////////////////////////////////////////////
+        [[nodiscard]] base::Optional<IpAddress> wait() const;
+
+        ////////////////////////////////////////////////////////////
+        /// \brief Block until the resolution has completed or `timeout` has elapsed
+        ///
+        /// \param timeout Maximum time to wait
+        ///
+        /// \return `true` if the resolution has completed
+        ///
+        ////////////////////////////////////////////////////////////
+        [[nodiscard]] bool waitFor(Time timeout) const;
+
+    private:
+        friend AsyncResolver;
+
+        ////////////////////////////////////////////////////////////
+        /// \brief Construct an already completed query
+        ///
+        ////////////////////////////////////////////////////////////
+        [[nodiscard]] explicit Query(base::Optional<IpAddress> address);
+
+        ////////////////////////////////////////////////////////////
+        /// \brief Construct a pending query, tracked by `resolver`
+        ///
+        ////////////////////////////////////////////////////////////
+        [[nodiscard]] explicit Query(AsyncResolver& resolver, base::U64 id);
+
+        ////////////////////////////////////////////////////////////
+        /// \brief Fetch the result from the resolver if the query is pending
+        ///
+        ////////////////////////////////////////////////////////////
+        void poll(bool block, Time timeout) const;
+
+        ////////////////////////////////////////////////////////////
+        // Member data
+        ////////////////////////////////////////////////////////////
+        mutable AsyncResolver*            m_resolver; //!< Resolver tracking the query (`nullptr` once completed)
+        base::U64                         m_id;       //!< Identifier of the pending query within the resolver
+        mutable Status                    m_status;   //!< Status of the resolution, once fetched
+        mutable base::Optional<IpAddress> m_address;  //!< Resolved address, once fetched
+
+        ////////////////////////////////////////////////////////////
+        // Lifetime tracking
+        ////////////////////////////////////////////////////////////
+        SFML_DEFINE_LIFETIME_DEPENDANT(AsyncResolver);
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Construct the resolver with default settings
+    ///
+    /// Starts the background worker threads.
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] AsyncResolver();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Construct the resolver with custom settings
+    ///
+    /// Starts the background worker threads.
+    ///
+    /// \param settings Cache and threading configuration
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] explicit AsyncResolver(const Settings& settings);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Destructor
+    ///
+    /// Waits for the lookups currently being performed by the
+    /// worker threads to complete, and discards queued ones.
+    ///
+    ////////////////////////////////////////////////////////////
+    ~AsyncResolver();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    AsyncResolver(const AsyncResolver&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy assignment
+    ///
+    ////////////////////////////////////////////////////////////
+    AsyncResolver& operator=(const AsyncResolver&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted move constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    AsyncResolver(AsyncResolver&&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted move assignment
+    ///
+    ////////////////////////////////////////////////////////////
+    AsyncResolver& operator=(AsyncResolver&&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Start resolving a host name
+    ///
+    /// Here \a address can be either a decimal address
+    /// (ex: "192.168.1.56") or a network name (ex: "localhost").
+    ///
+    /// Decimal addresses and cached host names are resolved
+    /// immediately, without involving the worker threads: the
+    /// returned query is already completed. Otherwise, the lookup
+    /// is queued for the worker threads and the returned query is
+    /// pending. Concurrent queries for the same host name share a
+    /// single lookup.
+    ///
+    /// This function never blocks on the system resolver.
+    ///
+    /// \param address IP address or network name
+    ///
+    /// \return Handle to the resolution
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Query resolve(base::StringView address);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Remove all the entries from the cache
+    ///
+    ////////////////////////////////////////////////////////////
+    void clearCache();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of entries in the cache
+    ///
+    /// Both successful and failed resolutions are counted,
+    /// including expired entries not evicted yet.
+    ///
+    /// \return Number of cached host names
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] base::SizeT getCacheSize() const;
+
+private:
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    struct Impl;
+    base::UniquePtr<Impl> m_impl; //!< Implementation details (needs address stability)
+
+    ////////////////////////////////////////////////////////////
+    // Lifetime tracking
+    ////////////////////////////////////////////////////////////
+    SFML_DEFINE_LIFETIME_DEPENDEE(AsyncResolver, Query);
+};
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::AsyncResolver
+/// \ingroup network
+///
+/// `sf::AsyncResolver` resolves host names without blocking
+/// the calling thread: lookups are performed by a small pool
+/// of background threads, and their results are exposed through
+/// pollable `sf::AsyncResolver::Query` handles.
+///
+/// Results are kept in an in-process cache: successful lookups
+/// are cached for `Settings::positiveTtl`, and failed lookups for
+/// `Settings::negativeTtl`, so that repeatedly resolving an
+/// unreachable host does not hit the system resolver every time.
+///
+/// Usage example:
+/// \code
+/// sf::AsyncResolver resolver;
+///
+/// // Start the lookup, this returns immediately
+/// sf::AsyncResolver::Query query = resolver.resolve("www.sfml-dev.org");
+///
+/// // ...later, e.g. once per frame
+/// if (query.isReady())
+/// {
+///     if (const sf::base::Optional<sf::IpAddress> address = query.getAddress())
+///         http.setHost("www.sfml-dev.org", 80, *address);
+/// }
+/// \endcode
+///
+/// \see sf::IpAddressUtils, sf::IpAddress
+///
+////////////////////////////////////////////////////////////
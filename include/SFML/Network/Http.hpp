@@ -6,10 +6,17 @@
 ////////////////////////////////////////////////////////////
 #include "SFML/Network/Export.hpp"
 
+#include "SFML/Network/IpAddress.hpp"
+
 #include "SFML/System/Time.hpp"
 
+#include "SFML/Base/FixedFunction.hpp"
 #include "SFML/Base/FwdStdString.hpp" // used
 #include "SFML/Base/InPlacePImpl.hpp"
+#include "SFML/Base/SizeT.hpp"
+#include "SFML/Base/Span.hpp"
+
+#include <vector>
 
 
 namespace sf
@@ -67,25 +74,25 @@ public:
         /// \brief Copy constructor
         ///
         ////////////////////////////////////////////////////////////
-        Request(const Request&) noexcept = default;
+        Request(const Request&);
 
         ////////////////////////////////////////////////////////////
         /// \brief Copy assignment
         ///
         ////////////////////////////////////////////////////////////
-        Request& operator=(const Request&) noexcept = default;
+        Request& operator=(const Request&);
 
         ////////////////////////////////////////////////////////////
         /// \brief Move constructor
         ///
         ////////////////////////////////////////////////////////////
-        Request(Request&&) noexcept = default;
+        Request(Request&&) noexcept;
 
         ////////////////////////////////////////////////////////////
         /// \brief Move assignment
         ///
         ////////////////////////////////////////////////////////////
-        Request& operator=(Request&&) noexcept = default;
+        Request& operator=(Request&&) noexcept;
 
         ////////////////////////////////////////////////////////////
         /// \brief Set the value of a field
@@ -245,25 +252,25 @@ public:
         /// \brief Copy constructor
         ///
         ////////////////////////////////////////////////////////////
-        Response(const Response&) noexcept = default;
+        Response(const Response&);
 
         ////////////////////////////////////////////////////////////
         /// \brief Copy assignment
         ///
         ////////////////////////////////////////////////////////////
-        Response& operator=(const Response&) noexcept = default;
+        Response& operator=(const Response&);
 
         ////////////////////////////////////////////////////////////
         /// \brief Move constructor
         ///
         ////////////////////////////////////////////////////////////
-        Response(Response&&) noexcept = default;
+        Response(Response&&) noexcept;
 
         ////////////////////////////////////////////////////////////
         /// \brief Move assignment
         ///
         ////////////////////////////////////////////////////////////
-        Response& operator=(Response&&) noexcept = default;
+        Response& operator=(Response&&) noexcept;
 
         ////////////////////////////////////////////////////////////
         /// \brief Get the value of a field
@@ -330,15 +337,18 @@ public:
         friend class Http;
 
         ////////////////////////////////////////////////////////////
-        /// \brief Construct the header from a response string
+        /// \brief Construct the header from a response header string
         ///
         /// This function is used by `Http` to build the response
-        /// of a request.
+        /// of a request. Only the status line and the header fields
+        /// are parsed, the body is decoded separately by `Http` as
+        /// it is received from the connection.
         ///
-        /// \param data Content of the response to parse
+        /// \param header Status line and header fields of the response,
+        ///               including the terminating empty line
         ///
         ////////////////////////////////////////////////////////////
-        void parse(const std::string& data);
+        void parseHeader(const std::string& header);
 
         ////////////////////////////////////////////////////////////
         // Member data
@@ -347,6 +357,17 @@ public:
         base::InPlacePImpl<Impl, 128> m_impl; //!< Implementation details
     };
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Callable that receives the body of a streamed response
+    ///
+    /// The callable is invoked with consecutive pieces of the
+    /// (already de-chunked) response body as they are received
+    /// from the connection. Returning `false` aborts the transfer,
+    /// in which case the connection is closed and not reused.
+    ///
+    ////////////////////////////////////////////////////////////
+    using BodyCallback = base::FixedFunction<bool(const char* data, base::SizeT size), 64>;
+
     ////////////////////////////////////////////////////////////
     /// \brief Default constructor
     ///
@@ -404,6 +425,21 @@ public:
     ////////////////////////////////////////////////////////////
     void setHost(const std::string& host, unsigned short port = 0);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the target host, with an already resolved address
+    ///
+    /// Behaves like `setHost(host, port)`, except that the host
+    /// name is not resolved: `address` is used instead. This
+    /// function never blocks, and is meant to be used together
+    /// with an asynchronous resolution (see `sf::AsyncResolver`).
+    ///
+    /// \param host    Web server to connect to, sent in the "Host" header field
+    /// \param port    Port to use for connection
+    /// \param address Address of the web server
+    ///
+    ////////////////////////////////////////////////////////////
+    void setHost(const std::string& host, unsigned short port, IpAddress address);
+
     ////////////////////////////////////////////////////////////
     /// \brief Send a HTTP request and return the server's response.
     ///
@@ -424,6 +460,117 @@ public:
     ////////////////////////////////////////////////////////////
     [[nodiscard]] Response sendRequest(const Request& request, Time timeout = Time::Zero);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Send a HTTP request and stream the response body
+    ///
+    /// Behaves like `sendRequest`, except that the body of the
+    /// response is not stored in the returned `Response` object:
+    /// it is instead forwarded piece by piece to `bodyCallback`
+    /// as soon as it is received. This allows large resources to
+    /// be downloaded without buffering them whole in memory.
+    ///
+    /// \param request      Request to send
+    /// \param bodyCallback Callable invoked with each received piece of the body
+    /// \param timeout      Maximum time to wait
+    ///
+    /// \return Server's response, with an empty body
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Response sendRequest(const Request&      request,
+                                       const BodyCallback& bodyCallback,
+                                       Time                timeout = Time::Zero);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Send multiple HTTP requests using pipelining
+    ///
+    /// Requests are written to the connection(s) upfront,
+    /// without waiting for the previous responses, then the
+    /// responses are read back in order. Requests are spread
+    /// over at most `getMaxConnections()` persistent connections.
+    ///
+    /// Pipelining requires persistent connections: the requests
+    /// are sent as if keep-alive was enabled, regardless of the
+    /// value set via `setKeepAlive`. If the server closes a
+    /// connection before answering all the requests sent over it,
+    /// the unanswered requests are sent again once over a new
+    /// connection.
+    ///
+    /// POST requests are not idempotent, so they are never
+    /// pipelined nor sent again: each one waits for the responses
+    /// to the previous requests of its connection, and its
+    /// response has the `ConnectionFailed` status if the
+    /// connection is lost before it is received.
+    ///
+    /// \param requests Requests to send
+    /// \param timeout  Maximum time to wait for each connection to be established
+    ///
+    /// \return Server's responses, in the same order as `requests`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::vector<Response> sendRequests(base::Span<const Request> requests, Time timeout = Time::Zero);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Enable or disable persistent connections
+    ///
+    /// When enabled, requests are sent with a `Connection: keep-alive`
+    /// header field (unless the request specifies its own) and the
+    /// connection is kept open after the response has been received,
+    /// to be reused by the next requests to the same host.
+    ///
+    /// When disabled (the default), a new connection is
+    /// established for every request.
+    ///
+    /// \param keepAlive `true` to enable persistent connections
+    ///
+    /// \see `getKeepAlive`
+    ///
+    ////////////////////////////////////////////////////////////
+    void setKeepAlive(bool keepAlive);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Tell whether persistent connections are enabled
+    ///
+    /// \return `true` if persistent connections are enabled
+    ///
+    /// \see `setKeepAlive`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool getKeepAlive() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Set the maximum number of connections to the host
+    ///
+    /// This is both the size of the pool of idle persistent
+    /// connections kept open, and the maximum number of
+    /// connections used in parallel by `sendRequests`.
+    /// The default value is 4. Values lower than 1 are clamped
+    /// to 1. Excess idle connections are closed immediately.
+    ///
+    /// \param maxConnections Maximum number of connections
+    ///
+    /// \see `getMaxConnections`
+    ///
+    ////////////////////////////////////////////////////////////
+    void setMaxConnections(base::SizeT maxConnections);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the maximum number of connections to the host
+    ///
+    /// \return Maximum number of connections
+    ///
+    /// \see `setMaxConnections`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] base::SizeT getMaxConnections() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of idle persistent connections
+    ///
+    /// \return Number of open connections currently waiting to be reused
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] base::SizeT getIdleConnectionCount() const;
+
 private:
     ////////////////////////////////////////////////////////////
     // Member data
@@ -467,6 +614,12 @@ private:
 /// `sf::Http::Request` and return the corresponding `sf::Http::Response`
 /// from the server.
 ///
+/// Persistent connections can be enabled with `setKeepAlive`, in
+/// which case connections to the host are pooled and reused across
+/// requests. Multiple requests can be pipelined over the pooled
+/// connections with `sendRequests`, and large bodies can be
+/// streamed through a callback instead of being buffered whole.
+///
 /// Usage example:
 /// \code
 /// // Create a new HTTP client
@@ -32,7 +32,7 @@ private:
     class SFML_SYSTEM_API Guard
     {
     public:
-        explicit Guard(std::ostream& stream, void* mutexPtr, bool multiLine);
+        explicit Guard(std::ostream& stream, void* ringPtr, bool multiLine);
         ~Guard();
 
         Guard(const Guard&)            = delete;
@@ -53,7 +53,7 @@ private:
 
     private:
         std::ostream& m_stream;
-        void*         m_mutexPtr;
+        void*         m_ringPtr;
         bool          m_multiLine;
     };
 
@@ -68,6 +68,14 @@ public:
     std::streambuf* rdbuf();
     void            rdbuf(std::streambuf* sbuf);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Block until every message emitted so far has been written
+    ///
+    /// Must not be called from real-time threads.
+    ///
+    ////////////////////////////////////////////////////////////
+    void flush();
+
     Guard operator<<(const char* value);
     Guard operator<<(ErrFlushType);
     Guard operator<<(PathDebugFormatter);
@@ -93,10 +101,29 @@ public:
 /// (-> the stderr descriptor) which is the console if there's
 /// one available.
 ///
-/// It is a standard `std::ostream` instance, so it supports all the
-/// insertion operations defined by the STL
+/// It supports the insertion operations defined by the STL
 /// (`operator<<`, manipulators, etc.).
 ///
+/// Messages are formatted into a buffer owned by the emitting
+/// thread and written to the output by a background thread, so
+/// emitting a message never waits for a lock or for I/O, which makes
+/// `sf::priv::err()` safe to use from real-time threads such as the
+/// audio callback.
+/// Pending messages are written when `flush()` is called, when the
+/// output is redirected, when the program exits and when it crashes.
+/// On a crash they are written straight to the standard error output
+/// (or standard output if redirected to `std::cout`) without taking
+/// any lock, as other outputs cannot be used from a signal handler.
+/// Messages emitted by a single thread keep their order. Messages
+/// that are too long are truncated, and messages emitted while the
+/// buffer of their thread is full are dropped (and counted).
+///
+/// When SFML is built with `SFML_ENABLE_STACK_TRACES`, single-line
+/// messages are instead written synchronously, followed by the
+/// stack trace of the emitting thread. This waits for the output
+/// and for other threads writing to it, so such builds are meant
+/// for debugging and give no real-time guarantee.
+///
 /// `sf::priv::err()` can be redirected to write to another output, independently
 /// of `std::cerr`, by using the `rdbuf()` function provided by the
 /// `std::ostream` class.
@@ -0,0 +1,245 @@
+#pragma once
+#include <SFML/Copyright.hpp> // LICENSE AND COPYRIGHT (C) INFORMATION
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include "SFML/System/Export.hpp"
+
+#include "SFML/Base/FixedFunction.hpp"
+#include "SFML/Base/IntTypes.hpp"
+#include "SFML/Base/SizeT.hpp"
+#include "SFML/Base/Span.hpp"
+#include "SFML/Base/UniquePtr.hpp"
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+/// \brief Reference to a job scheduled on a `sf::JobSystem`
+///
+/// Handles are cheap to copy and stay valid after the job has
+/// completed, they then simply refer to a finished job.
+///
+////////////////////////////////////////////////////////////
+struct [[nodiscard]] JobHandle
+{
+    base::U32 index{};      //!< Slot of the job in its job system
+    base::U32 generation{}; //!< Number of jobs that ran in the slot before this one
+};
+
+////////////////////////////////////////////////////////////
+/// \brief Work-stealing pool of worker threads running jobs
+///
+////////////////////////////////////////////////////////////
+class [[nodiscard]] SFML_SYSTEM_API JobSystem
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Function run by a job, its captures must fit in 64 bytes
+    ///
+    ////////////////////////////////////////////////////////////
+    using Job = base::FixedFunction<void(), 64>;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Maximum number of jobs that can be scheduled and not finished yet
+    ///
+    /// Scheduling more makes the scheduling thread run pending
+    /// jobs until a slot is freed.
+    ///
+    ////////////////////////////////////////////////////////////
+    static constexpr base::SizeT maxPendingJobs = 4096u;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of workers used by default
+    ///
+    /// One worker per hardware thread, minus one for the thread
+    /// that schedules the jobs, which also runs them while it waits.
+    ///
+    /// \return Default number of worker threads
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static unsigned int getDefaultWorkerCount();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Start the worker threads
+    ///
+    /// With no worker, jobs only run on threads waiting for them,
+    /// in the order in which they became ready, which makes the
+    /// execution fully deterministic.
+    ///
+    /// \param workerCount Number of worker threads
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] explicit JobSystem(unsigned int workerCount = getDefaultWorkerCount());
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Destructor
+    ///
+    /// Waits for all the scheduled jobs, then stops the workers.
+    ///
+    ////////////////////////////////////////////////////////////
+    ~JobSystem();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    JobSystem(const JobSystem&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy assignment
+    ///
+    ////////////////////////////////////////////////////////////
+    JobSystem& operator=(const JobSystem&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the number of worker threads
+    ///
+    /// \return Number of worker threads
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] unsigned int getWorkerCount() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Schedule a job
+    ///
+    /// The job runs on any thread once all of its dependencies
+    /// have completed. It can be scheduled from any thread,
+    /// including from another job.
+    ///
+    /// \param job          Function to run
+    /// \param dependencies Jobs that must complete before this one starts
+    ///
+    /// \return Handle to the scheduled job
+    ///
+    ////////////////////////////////////////////////////////////
+    JobHandle schedule(Job&& job, base::Span<const JobHandle> dependencies = {});
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Schedule a job that depends on a single other job
+    ///
+    /// \param job        Function to run
+    /// \param dependency Job that must complete before this one starts
+    ///
+    /// \return Handle to the scheduled job
+    ///
+    ////////////////////////////////////////////////////////////
+    JobHandle schedule(Job&& job, JobHandle dependency);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Check whether a job has completed
+    ///
+    /// \param handle Job to check
+    ///
+    /// \return `true` if the job has finished running
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool isDone(JobHandle handle) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Wait for a job to complete
+    ///
+    /// The calling thread runs pending jobs while it waits.
+    ///
+    /// \param handle Job to wait for
+    ///
+    ////////////////////////////////////////////////////////////
+    void wait(JobHandle handle);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Wait for all the scheduled jobs to complete
+    ///
+    /// The calling thread runs pending jobs while it waits.
+    ///
+    ////////////////////////////////////////////////////////////
+    void waitAll();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Run `func` over `[0, count)` split in chunks, in parallel
+    ///
+    /// `func` is called as `func(begin, end)` once per chunk of
+    /// `grainSize` indices (the last chunk may be smaller). Chunk
+    /// boundaries only depend on `count` and `grainSize`, never on
+    /// the number of workers, so results computed per chunk are
+    /// deterministic. The calling thread takes part in the work,
+    /// and this function returns once every chunk was processed.
+    ///
+    /// \param count     Number of indices
+    /// \param grainSize Number of indices per chunk
+    /// \param func      Function called for each chunk
+    ///
+    ////////////////////////////////////////////////////////////
+    template <typename F>
+    void parallelFor(base::SizeT count, base::SizeT grainSize, F&& func)
+    {
+        auto* funcPtr = &func;
+
+        parallelForImpl(count,
+                        grainSize,
+                        &funcPtr,
+                        [](void* userData, base::SizeT begin, base::SizeT end)
+                        { (**static_cast<decltype(funcPtr)*>(userData))(begin, end); });
+    }
+
+private:
+    ////////////////////////////////////////////////////////////
+    /// \brief Type-erased implementation of `parallelFor`
+    ///
+    ////////////////////////////////////////////////////////////
+    void parallelForImpl(base::SizeT count,
+                         base::SizeT grainSize,
+                         void*       userData,
+                         void (*invoke)(void* userData, base::SizeT begin, base::SizeT end));
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    struct Impl;
+    base::UniquePtr<Impl> m_impl; //!< Implementation details
+};
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::JobSystem
+/// \ingroup system
+///
+/// `sf::JobSystem` runs small units of work (jobs) on a fixed
+/// number of worker threads. Each worker has its own queue of
+/// jobs and steals from the others when it runs out, so work
+/// spreads evenly without a single contended queue.
+///
+/// Jobs can depend on other jobs, forming a task graph: a job
+/// only starts once all of its dependencies have completed.
+/// Threads waiting for a job run pending jobs in the meantime,
+/// so waiting from within a job never deadlocks.
+///
+/// `parallelFor` splits an index range into chunks and runs
+/// them in parallel, which is the simplest way to spread
+/// data-parallel work such as vertex generation or pixel
+/// processing across all cores.
+///
+/// Usage example:
+/// \code
+/// sf::JobSystem jobSystem;
+///
+/// // Task graph: decode two images, then combine them
+/// const sf::JobHandle handles[]{jobSystem.schedule([&] { decode(imageA); }),
+///                               jobSystem.schedule([&] { decode(imageB); })};
+///
+/// const sf::JobHandle combineJob = jobSystem.schedule([&] { combine(imageA, imageB); }, handles);
+/// jobSystem.wait(combineJob);
+///
+/// // Data parallelism: generate vertices by chunks of 1024
+/// jobSystem.parallelFor(vertices.size(),
+///                       1024,
+///                       [&](sf::base::SizeT begin, sf::base::SizeT end)
+///                       {
+///                           for (sf::base::SizeT i = begin; i < end; ++i)
+///                               vertices[i] = computeVertex(i);
+///                       });
+/// \endcode
+///
+////////////////////////////////////////////////////////////
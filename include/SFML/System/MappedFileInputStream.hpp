@@ -0,0 +1,193 @@
+#pragma once
+#include <SFML/Copyright.hpp> // LICENSE AND COPYRIGHT (C) INFORMATION
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include "SFML/Config.hpp"
+
+#include "SFML/System/Export.hpp"
+
+#include "SFML/System/InputStream.hpp"
+
+#include "SFML/Base/PassKey.hpp"
+#include "SFML/Base/SizeT.hpp"
+
+
+namespace sf
+{
+class Path;
+
+////////////////////////////////////////////////////////////
+/// \brief Implementation of input stream based on a memory-mapped file
+///
+////////////////////////////////////////////////////////////
+class SFML_SYSTEM_API MappedFileInputStream : public InputStream
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Destructor
+    ///
+    /// Unmaps the file.
+    ///
+    ////////////////////////////////////////////////////////////
+    ~MappedFileInputStream() override;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    MappedFileInputStream(const MappedFileInputStream&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy assignment
+    ///
+    ////////////////////////////////////////////////////////////
+    MappedFileInputStream& operator=(const MappedFileInputStream&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Move constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    MappedFileInputStream(MappedFileInputStream&& rhs) noexcept;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Move assignment
+    ///
+    ////////////////////////////////////////////////////////////
+    MappedFileInputStream& operator=(MappedFileInputStream&& rhs) noexcept;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Open the stream by mapping a file into memory
+    ///
+    /// The whole file is mapped read-only, and the OS is hinted
+    /// that it will be read sequentially.
+    ///
+    /// \param filename Name of the file to open
+    ///
+    /// \return Mapped file input stream on success, `base::nullOpt` on error
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static base::Optional<MappedFileInputStream> open(const Path& filename);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Read data from the stream
+    ///
+    /// After reading, the stream's reading position must be
+    /// advanced by the amount of bytes read.
+    ///
+    /// \param data Buffer where to copy the read data
+    /// \param size Desired number of bytes to read
+    ///
+    /// \return The number of bytes actually read, or `base::nullOpt` on error
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] base::Optional<base::SizeT> read(void* data, base::SizeT size) override;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Change the current reading position
+    ///
+    /// \param position The position to seek to, from the beginning
+    ///
+    /// \return The position actually sought to, or `base::nullOpt` on error
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] base::Optional<base::SizeT> seek(base::SizeT position) override;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the current reading position in the stream
+    ///
+    /// \return The current position, or `base::nullOpt` on error.
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] base::Optional<base::SizeT> tell() override;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Return the size of the stream
+    ///
+    /// \return The total number of bytes available in the stream, or `base::nullOpt` on error
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] base::Optional<base::SizeT> getSize() override;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get a pointer to the contents of the mapped file
+    ///
+    /// The pointer stays valid as long as the stream exists,
+    /// and can be passed to any `loadFromMemory`/`openFromMemory`
+    /// function to decode the file without copying it.
+    ///
+    /// \return Pointer to the first byte of the file, `nullptr` if the file is empty
+    ///
+    /// \see `getDataSize`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] const void* getData() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the size of the mapped file
+    ///
+    /// \return Size of the file in bytes
+    ///
+    /// \see `getData`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] base::SizeT getDataSize() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \private
+    ///
+    /// \brief Construct from an existing mapping, only usable by `open`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] explicit MappedFileInputStream(base::PassKey<MappedFileInputStream>&&,
+                                                 const unsigned char* data,
+                                                 base::SizeT          size);
+
+private:
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    const unsigned char* m_data{};   //!< Start of the mapping, `nullptr` if empty or moved-from
+    base::SizeT          m_size{};   //!< Total size of the mapping
+    base::SizeT          m_offset{}; //!< Current reading position
+};
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::MappedFileInputStream
+/// \ingroup system
+///
+/// This class is a specialization of `InputStream` that
+/// reads from a file on disk mapped into memory.
+///
+/// Unlike `sf::FileInputStream`, reads do not go through
+/// stdio buffers: they are a single copy out of the mapping,
+/// and `getSize` does not need to seek. The mapped contents
+/// are also directly accessible through `getData` and
+/// `getDataSize`, which lets loaders that accept memory
+/// decode the file with no intermediate copy at all.
+///
+/// Pages are only read from disk when first touched, so
+/// mapping a large file is cheap. The file must not be
+/// truncated by another process while it is mapped.
+///
+/// On Android, files inside the APK cannot be mapped; use
+/// `sf::FileInputStream` for those.
+///
+/// Usage example:
+/// \code
+/// auto file = sf::MappedFileInputStream::open("texture.png").value();
+///
+/// // Either as a stream...
+/// auto image = sf::Image::loadFromStream(file).value();
+///
+/// // ...or directly from memory, skipping the stream interface
+/// auto sameImage = sf::Image::loadFromMemory(file.getData(), file.getDataSize()).value();
+/// \endcode
+///
+/// \see `InputStream`, `FileInputStream`, `MemoryInputStream`
+///
+////////////////////////////////////////////////////////////
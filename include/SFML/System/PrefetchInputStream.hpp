@@ -0,0 +1,177 @@
+#pragma once
+#include <SFML/Copyright.hpp> // LICENSE AND COPYRIGHT (C) INFORMATION
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include "SFML/Config.hpp"
+
+#include "SFML/System/Export.hpp"
+
+#include "SFML/System/InputStream.hpp"
+
+#include "SFML/Base/SizeT.hpp"
+#include "SFML/Base/UniquePtr.hpp"
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+/// \brief Input stream adapter that reads ahead on a background thread
+///
+////////////////////////////////////////////////////////////
+class SFML_SYSTEM_API PrefetchInputStream : public InputStream
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Default size of each read-ahead block, in bytes
+    ///
+    ////////////////////////////////////////////////////////////
+    static constexpr base::SizeT defaultBlockSize = 256u * 1024u;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Construct the stream on top of `source`
+    ///
+    /// `source` must outlive the prefetch stream, and must not
+    /// be used directly while the prefetch stream exists, as it
+    /// is accessed from the background I/O thread.
+    ///
+    /// \param source    Stream to read ahead from
+    /// \param blockSize Size of each of the two read-ahead blocks, in bytes
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] explicit PrefetchInputStream(InputStream& source, base::SizeT blockSize = defaultBlockSize);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Construct the stream on top of `source`, taking ownership of it
+    ///
+    /// \param source    Stream to read ahead from
+    /// \param blockSize Size of each of the two read-ahead blocks, in bytes
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] explicit PrefetchInputStream(base::UniquePtr<InputStream>&& source,
+                                               base::SizeT                    blockSize = defaultBlockSize);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Destructor
+    ///
+    /// Waits for the read in progress on the I/O thread, if any.
+    ///
+    ////////////////////////////////////////////////////////////
+    ~PrefetchInputStream() override;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    PrefetchInputStream(const PrefetchInputStream&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Deleted copy assignment
+    ///
+    ////////////////////////////////////////////////////////////
+    PrefetchInputStream& operator=(const PrefetchInputStream&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Move constructor
+    ///
+    ////////////////////////////////////////////////////////////
+    PrefetchInputStream(PrefetchInputStream&&) noexcept;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Move assignment
+    ///
+    ////////////////////////////////////////////////////////////
+    PrefetchInputStream& operator=(PrefetchInputStream&&) noexcept;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Read data from the stream
+    ///
+    /// Data is served from the read-ahead blocks. Only a block
+    /// that has not been prefetched yet (e.g. after a seek)
+    /// makes this function wait for the source.
+    ///
+    /// \param data Buffer where to copy the read data
+    /// \param size Desired number of bytes to read
+    ///
+    /// \return The number of bytes actually read, or `base::nullOpt` on error
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] base::Optional<base::SizeT> read(void* data, base::SizeT size) override;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Change the current reading position
+    ///
+    /// Seeking is free; data at the new position is only fetched
+    /// when it is read, unless it is already in a read-ahead block.
+    ///
+    /// \param position The position to seek to, from the beginning
+    ///
+    /// \return The position actually sought to, or `base::nullOpt` on error
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] base::Optional<base::SizeT> seek(base::SizeT position) override;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the current reading position in the stream
+    ///
+    /// \return The current position, or `base::nullOpt` on error.
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] base::Optional<base::SizeT> tell() override;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Return the size of the stream
+    ///
+    /// \return The total number of bytes available in the stream, or `base::nullOpt` on error
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] base::Optional<base::SizeT> getSize() override;
+
+private:
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    struct Impl;
+    base::UniquePtr<Impl> m_impl; //!< Implementation details
+};
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::PrefetchInputStream
+/// \ingroup system
+///
+/// `sf::PrefetchInputStream` wraps another `sf::InputStream`
+/// and reads it in large blocks on a background I/O thread.
+///
+/// Decoders and image/font loaders tend to issue many small
+/// reads. On network filesystems or cold disks each of them
+/// can block for a long time. With this adapter, the small
+/// reads are served from memory: while one block is being
+/// consumed, the next one is already being read, so
+/// sequential access never waits for the source once the
+/// first block has arrived.
+///
+/// Random access still works. A read outside both blocks
+/// fetches the block at the new position synchronously, and
+/// read-ahead then resumes from there.
+///
+/// The adapter can be passed to any `loadFromStream` or
+/// `openFromStream` function, e.g. `sf::Music`,
+/// `sf::InputSoundFile`, `sf::Image` or `sf::Font`.
+/// `sf::Music::openFromFile` and `sf::InputSoundFile::openFromFile`
+/// can also use it internally.
+///
+/// Usage example:
+/// \code
+/// auto file = sf::FileInputStream::open("//server/share/music.ogg").value();
+///
+/// sf::PrefetchInputStream stream(file);
+/// auto music = sf::Music::openFromStream(stream).value();
+/// \endcode
+///
+/// \see `sf::InputStream`, `sf::FileInputStream`
+///
+////////////////////////////////////////////////////////////
@@ -7,26 +7,31 @@
 #include "SFML/System/Vector2.hpp"
 
 #include "SFML/Base/Optional.hpp"
+#include "SFML/Base/SizeT.hpp"
+#include "SFML/Base/Span.hpp"
 #include "SFML/Base/UniquePtr.hpp"
 
 
 namespace sf
 {
 ////////////////////////////////////////////////////////////
-/// \brief TODO P1: docs
+/// \brief Packs rectangles into a fixed-size area, with support
+///        for freeing them
 ///
 ////////////////////////////////////////////////////////////
 class RectPacker
 {
 public:
     ////////////////////////////////////////////////////////////
-    /// \brief TODO P1: docs
+    /// \brief Construct an empty packer
+    ///
+    /// \param size Size of the area to pack rectangles into
     ///
     ////////////////////////////////////////////////////////////
     [[nodiscard]] explicit RectPacker(Vector2u size);
 
     ////////////////////////////////////////////////////////////
-    /// \brief TODO P1: docs
+    /// \brief Destructor
     ///
     ////////////////////////////////////////////////////////////
     ~RectPacker();
@@ -56,23 +61,76 @@ public:
     RectPacker& operator=(RectPacker&& rhs) noexcept;
 
     ////////////////////////////////////////////////////////////
-    /// \brief TODO P1: docs
+    /// \brief Pack a rectangle
+    ///
+    /// Free space is reused first, picking a free rectangle of
+    /// about the smallest size that fits. Free space comes from
+    /// `remove` and from the gaps left below the skyline, i.e.
+    /// the upper contour of the packed rectangles. Otherwise,
+    /// the rectangle is placed as low as possible on the skyline.
+    ///
+    /// \param rectSize Size of the rectangle to pack
+    ///
+    /// \return Position of the rectangle, or `base::nullOpt` if it is zero-sized or does not fit
     ///
     ////////////////////////////////////////////////////////////
     [[nodiscard]] base::Optional<Vector2u> pack(Vector2u rectSize);
 
     ////////////////////////////////////////////////////////////
-    /// \brief TODO P1: docs
+    /// \brief Pack several rectangles at once
+    ///
+    /// The rectangles are packed from the tallest to the
+    /// shortest, which leaves less space unused than packing
+    /// them in an arbitrary order. Rectangles that are
+    /// zero-sized or do not fit are skipped, without logging
+    /// an error for each of them.
+    ///
+    /// \param rectSizes Sizes of the rectangles to pack
+    /// \param positions Receives the position of each rectangle, or `base::nullOpt`; same size as \a rectSizes
+    ///
+    /// \return Number of rectangles that were packed
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] base::SizeT packMany(base::Span<const Vector2u>           rectSizes,
+                                       base::Span<base::Optional<Vector2u>> positions);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Free the space of a packed rectangle
+    ///
+    /// The freed space is merged with adjacent free space when
+    /// they form a rectangle, and given back to the skyline when
+    /// nothing was packed above it.
+    ///
+    /// The rectangle must have been returned by `pack` or
+    /// `packMany` and not removed since, otherwise the behavior
+    /// is undefined.
+    ///
+    /// \param position Position of the packed rectangle
+    /// \param rectSize Size of the packed rectangle
+    ///
+    ////////////////////////////////////////////////////////////
+    void remove(Vector2u position, Vector2u rectSize);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the size of the area to pack rectangles into
     ///
     ////////////////////////////////////////////////////////////
     [[nodiscard]] Vector2u getSize() const;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the share of the area covered by packed rectangles
+    ///
+    /// \return Packed area divided by the total area, in [0, 1]
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] float getOccupancy() const;
+
 private:
     ////////////////////////////////////////////////////////////
     // Member data
     ////////////////////////////////////////////////////////////
     struct Impl;
-    base::UniquePtr<Impl> m_impl; //!< Implementation details (needs address stability)
+    base::UniquePtr<Impl> m_impl; //!< Implementation details
 };
 
 } // namespace sf
@@ -82,7 +140,20 @@ private:
 /// \class sf::RectPacker
 /// \ingroup system
 ///
-/// TODO P1: docs
+/// `sf::RectPacker` finds room for rectangles in a fixed-size
+/// area, typically to lay out images in a texture atlas. It
+/// keeps track of the skyline of the packed rectangles, which
+/// grows as needed, and of free rectangles for the gaps below
+/// the skyline and the space given back by `remove`.
+///
+/// \code
+/// sf::RectPacker packer({1024u, 1024u});
+///
+/// const sf::base::Optional<sf::Vector2u> position = packer.pack({32u, 48u});
+///
+/// // ...later, once the rectangle is no longer needed
+/// packer.remove(*position, {32u, 48u});
+/// \endcode
 ///
 /// \see sf::Rect
 ///
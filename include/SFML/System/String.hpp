@@ -122,7 +122,9 @@ public:
     /// \brief Construct from a single ANSI character and a locale
     ///
     /// The source character is converted to UTF-32 according
-    /// to the given locale.
+    /// to the given locale. Without a locale, ASCII characters
+    /// are converted directly and the default user locale is
+    /// only used for other characters.
     ///
     /// \param ansiChar ANSI character to convert
     /// \param locale   Locale to use for conversion
@@ -151,7 +153,9 @@ public:
     /// \brief Construct from a null-terminated C-style ANSI string and a locale
     ///
     /// The source string is converted to UTF-32 according
-    /// to the given locale.
+    /// to the given locale. Without a locale, ASCII characters
+    /// are converted directly and the default user locale is
+    /// only used for other characters.
     ///
     /// \param ansiString ANSI string to convert
     /// \param locale     Locale to use for conversion
@@ -164,7 +168,9 @@ public:
     /// \brief Construct from an ANSI string and a locale
     ///
     /// The source string is converted to UTF-32 according
-    /// to the given locale.
+    /// to the given locale. Without a locale, ASCII characters
+    /// are converted directly and the default user locale is
+    /// only used for other characters.
     ///
     /// \param ansiString ANSI string to convert
     /// \param locale     Locale to use for conversion
@@ -209,7 +215,9 @@ public:
     /// \brief Convert the Unicode string to an ANSI string
     ///
     /// The UTF-32 string is converted to an ANSI string in
-    /// the encoding defined by \a `locale`.
+    /// the encoding defined by \a `locale`. Without a locale,
+    /// ASCII strings are converted directly and the default
+    /// user locale is only used for other characters.
     /// Characters that do not fit in the target encoding are
     /// discarded from the returned string.
     ///
@@ -489,10 +497,16 @@ private:
     friend SFML_SYSTEM_API bool operator<(const String& lhs, const String& rhs);
 
     ////////////////////////////////////////////////////////////
-    /// \brief Retrieve the string stored in the PImpl
+    /// \brief Resize the string, leaving new characters uninitialized
+    ///
+    /// Used by `StringUtfUtils` to decode directly into the string.
+    ///
+    /// \param size New number of characters
+    ///
+    /// \return Pointer to the (null-terminated) characters of the string
     ///
     ////////////////////////////////////////////////////////////
-    void* getImplString();
+    char32_t* resizeForOverwrite(base::SizeT size);
 
     ////////////////////////////////////////////////////////////
     // Member data
@@ -612,8 +626,9 @@ private:
 /// s += L'a';           // automatically converted from wide string
 /// \endcode
 ///
-/// Conversions involving ANSI strings use the default user locale. However
-/// it is possible to use a custom locale if necessary:
+/// Conversions involving ANSI strings widen or narrow ASCII characters
+/// directly and only use the default user locale for other characters.
+/// It is also possible to use a custom locale if necessary:
 /// \code
 /// std::locale locale;
 /// sf::String s;
@@ -624,12 +639,13 @@ private:
 ///
 /// `sf::String` defines the most important functions of the
 /// standard `std::string` class: removing, random access, iterating,
-/// appending, comparing, etc. However it is a simple class
-/// provided for convenience, and you may have to consider using
-/// a more optimized class if your program requires complex string
-/// handling. The automatic conversion functions will then take
-/// care of converting your string to `sf::String` whenever SFML
-/// requires it.
+/// appending, comparing, etc. Short strings are stored in place,
+/// so they can be created and copied without allocating. However
+/// it is a simple class provided for convenience, and you may
+/// have to consider using a more optimized class if your
+/// program requires complex string handling. The automatic
+/// conversion functions will then take care of converting your
+/// string to `sf::String` whenever SFML requires it.
 ///
 /// Please note that SFML also defines a low-level, generic
 /// interface for Unicode handling, see the `sf::Utf` classes.
@@ -17,8 +17,11 @@ public:
     ////////////////////////////////////////////////////////////
     /// \brief Create a new sf::String from a UTF-8 encoded string
     ///
-    /// \param begin Forward iterator to the beginning of the UTF-8 sequence
-    /// \param end   Forward iterator to the end of the UTF-8 sequence
+    /// Forward iterators let the string be allocated once, input
+    /// iterators are read in a single pass.
+    ///
+    /// \param begin Iterator to the beginning of the UTF-8 sequence
+    /// \param end   Iterator to the end of the UTF-8 sequence
     ///
     /// \return A sf::String containing the source string
     ///
@@ -31,8 +34,11 @@ public:
     ////////////////////////////////////////////////////////////
     /// \brief Create a new sf::String from a UTF-16 encoded string
     ///
-    /// \param begin Forward iterator to the beginning of the UTF-16 sequence
-    /// \param end   Forward iterator to the end of the UTF-16 sequence
+    /// Forward iterators let the string be allocated once, input
+    /// iterators are read in a single pass.
+    ///
+    /// \param begin Iterator to the beginning of the UTF-16 sequence
+    /// \param end   Iterator to the end of the UTF-16 sequence
     ///
     /// \return A sf::String containing the source string
     ///
@@ -49,8 +55,11 @@ public:
     /// using the constructors that takes a const char32_t* or
     /// a std::u32string.
     ///
-    /// \param begin Forward iterator to the beginning of the UTF-32 sequence
-    /// \param end   Forward iterator to the end of the UTF-32 sequence
+    /// Forward iterators let the string be allocated once, input
+    /// iterators are read in a single pass.
+    ///
+    /// \param begin Iterator to the beginning of the UTF-32 sequence
+    /// \param end   Iterator to the end of the UTF-32 sequence
     ///
     /// \return A sf::String containing the source string
     ///
@@ -59,6 +68,16 @@ public:
     ////////////////////////////////////////////////////////////
     template <typename T>
     [[nodiscard]] static String fromUtf32(T begin, T end);
+
+private:
+    ////////////////////////////////////////////////////////////
+    /// \brief Output iterator appending characters to a string
+    ///
+    /// Used when the length of the input cannot be known without
+    /// consuming it.
+    ///
+    ////////////////////////////////////////////////////////////
+    class Appender;
 };
 
 } // namespace sf
@@ -8,16 +8,69 @@
 #include "SFML/System/Utf.hpp"
 
 #include "SFML/Base/Algorithm.hpp"
+#include "SFML/Base/SizeT.hpp"
+
+#include <iterator>
 
 
 namespace sf
 {
+////////////////////////////////////////////////////////////
+class StringUtfUtils::Appender
+{
+public:
+    using value_type = char32_t;
+
+    [[nodiscard, gnu::always_inline]] explicit Appender(String& string) noexcept : m_string(&string)
+    {
+    }
+
+    [[gnu::always_inline]] Appender& operator=(char32_t character)
+    {
+        const base::SizeT size = m_string->getSize();
+
+        // The string grows geometrically, so appending is amortized constant time
+        m_string->resizeForOverwrite(size + 1u)[size] = character;
+        return *this;
+    }
+
+    [[nodiscard, gnu::always_inline, gnu::pure]] Appender& operator*() noexcept
+    {
+        return *this;
+    }
+
+    [[gnu::always_inline, gnu::pure]] Appender& operator++() noexcept
+    {
+        return *this;
+    }
+
+    [[nodiscard, gnu::always_inline, gnu::pure]] Appender operator++(int) noexcept
+    {
+        return *this;
+    }
+
+private:
+    String* m_string;
+};
+
+
 ////////////////////////////////////////////////////////////
 template <typename T>
 String StringUtfUtils::fromUtf8(T begin, T end)
 {
     String string;
-    Utf8::toUtf32(begin, end, base::BackInserter(*static_cast<std::u32string*>(string.getImplString())));
+
+    if constexpr (std::forward_iterator<T>)
+    {
+        // A code unit never decodes to more than one code point, so the result can be written in place
+        char32_t* const buffer = string.resizeForOverwrite(static_cast<base::SizeT>(std::distance(begin, end)));
+        string.resizeForOverwrite(static_cast<base::SizeT>(Utf8::toUtf32(begin, end, buffer) - buffer));
+    }
+    else
+    {
+        Utf8::toUtf32(begin, end, Appender(string));
+    }
+
     return string;
 }
 
@@ -27,7 +80,18 @@ template <typename T>
 String StringUtfUtils::fromUtf16(T begin, T end)
 {
     String string;
-    Utf16::toUtf32(begin, end, base::BackInserter(*static_cast<std::u32string*>(string.getImplString())));
+
+    if constexpr (std::forward_iterator<T>)
+    {
+        // A code unit never decodes to more than one code point, so the result can be written in place
+        char32_t* const buffer = string.resizeForOverwrite(static_cast<base::SizeT>(std::distance(begin, end)));
+        string.resizeForOverwrite(static_cast<base::SizeT>(Utf16::toUtf32(begin, end, buffer) - buffer));
+    }
+    else
+    {
+        Utf16::toUtf32(begin, end, Appender(string));
+    }
+
     return string;
 }
 
@@ -37,7 +101,12 @@ template <typename T>
 String StringUtfUtils::fromUtf32(T begin, T end)
 {
     String string;
-    static_cast<std::u32string*>(string.getImplString())->assign(begin, end);
+
+    if constexpr (std::forward_iterator<T>)
+        base::copy(begin, end, string.resizeForOverwrite(static_cast<base::SizeT>(std::distance(begin, end))));
+    else
+        base::copy(begin, end, Appender(string));
+
     return string;
 }
 
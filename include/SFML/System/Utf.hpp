@@ -4,12 +4,48 @@
 ////////////////////////////////////////////////////////////
 // Headers
 ////////////////////////////////////////////////////////////
+#include "SFML/System/Export.hpp"
+
 #include "SFML/Base/IntTypes.hpp"
 #include "SFML/Base/SizeT.hpp"
 
+#include <iterator>
 #include <locale>
 
 
+namespace sf::priv
+{
+////////////////////////////////////////////////////////////
+/// \brief Widen the leading ASCII characters of a UTF-8 sequence to UTF-32
+///
+/// Uses SIMD instructions when available.
+///
+/// \param input  Pointer to the first code unit of the sequence
+/// \param size   Number of code units in the sequence
+/// \param output Pointer to room for at least \a `size` code points
+///
+/// \return Number of code units converted, i.e. the length of the ASCII prefix of the sequence
+///
+////////////////////////////////////////////////////////////
+[[nodiscard]] SFML_SYSTEM_API base::SizeT widenUtf8AsciiPrefix(const void* input, base::SizeT size, char32_t* output) noexcept;
+
+////////////////////////////////////////////////////////////
+/// \brief Widen the leading non-surrogate code units of a UTF-16 sequence to UTF-32
+///
+/// Uses SIMD instructions when available.
+///
+/// \param input  Pointer to the first code unit of the sequence
+/// \param size   Number of code units in the sequence
+/// \param output Pointer to room for at least \a `size` code points
+///
+/// \return Number of code units converted, i.e. the length of the prefix of the sequence without surrogates
+///
+////////////////////////////////////////////////////////////
+[[nodiscard]] SFML_SYSTEM_API base::SizeT widenUtf16BmpPrefix(const void* input, base::SizeT size, char32_t* output) noexcept;
+
+} // namespace sf::priv
+
+
 namespace sf
 {
 template <unsigned int N>
@@ -210,6 +246,10 @@ public:
     ////////////////////////////////////////////////////////////
     /// \brief Convert a UTF-8 characters range to UTF-32
     ///
+    /// Runs of ASCII characters in contiguous ranges (pointers,
+    /// `std::string` iterators, etc.) are converted in bulk with
+    /// SIMD instructions; other characters are decoded one by one.
+    ///
     /// \param begin  Iterator pointing to the beginning of the input sequence
     /// \param end    Iterator pointing to the end of the input sequence
     /// \param output Iterator pointing to the beginning of the output sequence
@@ -416,6 +456,11 @@ public:
     ////////////////////////////////////////////////////////////
     /// \brief Convert a UTF-16 characters range to UTF-32
     ///
+    /// Runs of characters that are not encoded as surrogate pairs
+    /// in contiguous ranges (pointers, `std::u16string` iterators,
+    /// etc.) are converted in bulk with SIMD instructions; other
+    /// characters are decoded one by one.
+    ///
     /// \param begin  Iterator pointing to the beginning of the input sequence
     /// \param end    Iterator pointing to the end of the input sequence
     /// \param output Iterator pointing to the beginning of the output sequence
@@ -6,6 +6,7 @@
 #include "SFML/System/Utf.hpp" // NOLINT(misc-header-include-cycle)
 
 #include "SFML/Base/Algorithm.hpp"
+#include "SFML/Base/Traits/IsSame.hpp"
 
 
 ////////////////////////////////////////////////////////////
@@ -19,8 +20,70 @@
 ////////////////////////////////////////////////////////////
 
 
+namespace sf::priv
+{
+////////////////////////////////////////////////////////////
+// Convert a contiguous range to UTF-32: the prefixes accepted by `widenPrefix` are converted in bulk,
+// and the blocks of characters that stop them are decoded one by one by `decode`
+template <typename Unit, typename Out, typename Decode>
+Out toUtf32Contiguous(const Unit* begin,
+                      const Unit* end,
+                      Out         output,
+                      base::SizeT (*widenPrefix)(const void*, base::SizeT, char32_t*) noexcept,
+                      Decode&&    decode)
+{
+    while (begin != end)
+    {
+        const auto remaining = static_cast<base::SizeT>(end - begin);
+
+        if constexpr (SFML_BASE_IS_SAME(Out, char32_t*))
+        {
+            // Widen straight into the output
+            const base::SizeT count = widenPrefix(begin, remaining, output);
+
+            begin += count;
+            output += count;
+
+            if (count == remaining)
+                break;
+        }
+        else
+        {
+            // Widen into a local buffer first, as the output iterator might not be contiguous
+            constexpr base::SizeT bufferSize = 64u;
+            char32_t              buffer[bufferSize];
+
+            const base::SizeT chunkSize = base::min(remaining, bufferSize);
+            const base::SizeT count     = widenPrefix(begin, chunkSize, buffer);
+
+            begin += count;
+            output = base::copy(buffer, buffer + count, output);
+
+            if (count == chunkSize)
+                continue;
+        }
+
+        // Decode one by one up to the end of the block that stopped the run, otherwise text
+        // without long runs would pay for an attempt at a bulk conversion for every character
+        const Unit* const blockEnd = begin + base::min(static_cast<base::SizeT>(end - begin), base::SizeT{16u});
+
+        while (begin < blockEnd)
+        {
+            base::U32 codepoint = 0;
+            begin               = decode(begin, end, codepoint);
+            *output++           = codepoint;
+        }
+    }
+
+    return output;
+}
+
+} // namespace sf::priv
+
+
 namespace sf
 {
+////////////////////////////////////////////////////////////
 template <typename In>
 In Utf<8>::decode(In begin, In end, base::U32& output, base::U32 replacement)
 {
@@ -46,7 +109,27 @@ In Utf<8>::decode(In begin, In end, base::U32& output, base::U32 replacement)
 
     // decode the character
     const auto trailingBytes = trailing[static_cast<base::U8>(*begin)];
-    if (trailingBytes < std::distance(begin, end))
+
+    if constexpr (!std::forward_iterator<In>)
+    {
+        // Single-pass input cannot be measured ahead, so check for its end before each byte
+        output = 0;
+
+        for (int i = 0; i <= trailingBytes; ++i)
+        {
+            if (begin == end)
+            {
+                // Incomplete character
+                output = replacement;
+                return begin;
+            }
+
+            output = (output << (i == 0 ? 0 : 6)) + static_cast<base::U8>(*begin++);
+        }
+
+        output -= offsets[trailingBytes];
+    }
+    else if (trailingBytes < std::distance(begin, end))
     {
         output = 0;
 
@@ -263,6 +346,20 @@ Out Utf<8>::toUtf16(In begin, In end, Out output)
 template <typename In, typename Out>
 Out Utf<8>::toUtf32(In begin, In end, Out output)
 {
+    if constexpr (std::contiguous_iterator<In> && sizeof(std::iter_value_t<In>) == 1)
+    {
+        if (begin == end)
+            return output;
+
+        const auto* const first = &*begin;
+
+        return priv::toUtf32Contiguous(first,
+                                       first + (end - begin),
+                                       output,
+                                       &priv::widenUtf8AsciiPrefix,
+                                       [](auto from, auto to, base::U32& codepoint) { return decode(from, to, codepoint); });
+    }
+
     while (begin != end)
     {
         base::U32 codepoint = 0;
@@ -486,6 +583,20 @@ Out Utf<16>::toUtf16(In begin, In end, Out output)
 template <typename In, typename Out>
 Out Utf<16>::toUtf32(In begin, In end, Out output)
 {
+    if constexpr (std::contiguous_iterator<In> && sizeof(std::iter_value_t<In>) == 2)
+    {
+        if (begin == end)
+            return output;
+
+        const auto* const first = &*begin;
+
+        return priv::toUtf32Contiguous(first,
+                                       first + (end - begin),
+                                       output,
+                                       &priv::widenUtf16BmpPrefix,
+                                       [](auto from, auto to, base::U32& codepoint) { return decode(from, to, codepoint); });
+    }
+
     while (begin != end)
     {
         base::U32 codepoint = 0;
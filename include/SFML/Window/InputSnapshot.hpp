@@ -0,0 +1,255 @@
+#pragma once
+#include <SFML/Copyright.hpp> // LICENSE AND COPYRIGHT (C) INFORMATION
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include "SFML/Window/Export.hpp"
+
+#include "SFML/Window/Keyboard.hpp"
+#include "SFML/Window/Mouse.hpp"
+
+#include "SFML/System/Vector2.hpp"
+
+#include "SFML/Base/EnumArray.hpp"
+
+
+////////////////////////////////////////////////////////////
+// Forward declarations
+////////////////////////////////////////////////////////////
+namespace sf
+{
+class Event;
+class WindowBase;
+} // namespace sf
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+/// \brief Copy of the keyboard and mouse state at a given time
+///
+////////////////////////////////////////////////////////////
+class [[nodiscard]] SFML_WINDOW_API InputSnapshot
+{
+public:
+    ////////////////////////////////////////////////////////////
+    /// \brief Default constructor
+    ///
+    /// Creates a snapshot in which no key or button is pressed
+    /// and the mouse is at the origin.
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] InputSnapshot() = default;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Capture the current state of the keyboard and mouse
+    ///
+    /// The mouse position relative to a window is the same as
+    /// the desktop position in the returned snapshot.
+    ///
+    /// \return Snapshot of the current input state
+    ///
+    /// \see `update`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static InputSnapshot capture();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Capture the current state of the keyboard and mouse
+    ///
+    /// \param relativeTo Reference window for `getRelativeMousePosition`
+    ///
+    /// \return Snapshot of the current input state
+    ///
+    /// \see `update`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static InputSnapshot capture(const WindowBase& relativeTo);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Overwrite the snapshot with the current state of the keyboard and mouse
+    ///
+    /// This is meant to be called once per frame: the whole
+    /// state is queried from the operating system at once, and
+    /// all subsequent queries on the snapshot are simple memory
+    /// lookups. On X11 this costs exactly two round trips to the
+    /// X server, regardless of how many keys are checked later.
+    ///
+    ////////////////////////////////////////////////////////////
+    void update();
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Overwrite the snapshot with the current state of the keyboard and mouse
+    ///
+    /// \param relativeTo Reference window for `getRelativeMousePosition`
+    ///
+    ////////////////////////////////////////////////////////////
+    void update(const WindowBase& relativeTo);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Update the snapshot incrementally from an event
+    ///
+    /// Key, mouse button and mouse move events update the
+    /// corresponding state. Losing focus releases all the keys
+    /// and buttons, as the matching release events will not be
+    /// received. Other events are ignored.
+    ///
+    /// This allows maintaining the snapshot from the event loop
+    /// without ever querying the operating system. Note that the
+    /// desktop mouse position is not updated this way.
+    ///
+    /// \param event Event received from the window
+    ///
+    ////////////////////////////////////////////////////////////
+    void applyEvent(const Event& event);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Check if a key was pressed when the snapshot was taken
+    ///
+    /// \param key Key to check
+    ///
+    /// \return `true` if the key was pressed, `false` otherwise
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool isKeyPressed(Keyboard::Key key) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Check if a key was pressed when the snapshot was taken
+    ///
+    /// \param code Scancode to check
+    ///
+    /// \return `true` if the physical key was pressed, `false` otherwise
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool isKeyPressed(Keyboard::Scancode code) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Check if a mouse button was pressed when the snapshot was taken
+    ///
+    /// \param button Button to check
+    ///
+    /// \return `true` if the button was pressed, `false` otherwise
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool isButtonPressed(Mouse::Button button) const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the position of the mouse in desktop coordinates
+    ///
+    /// \return Position of the mouse when the snapshot was taken
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Vector2i getMousePosition() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the position of the mouse relative to the reference window
+    ///
+    /// The reference window is the one passed to `capture` or
+    /// `update`, or the one that generated the events passed to
+    /// `applyEvent`.
+    ///
+    /// \return Position of the mouse when the snapshot was taken
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Vector2i getRelativeMousePosition() const;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Change the state of a key in the snapshot
+    ///
+    /// \param key     Key to change
+    /// \param pressed New state of the key
+    ///
+    ////////////////////////////////////////////////////////////
+    void setKeyPressed(Keyboard::Key key, bool pressed);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Change the state of a physical key in the snapshot
+    ///
+    /// \param code    Scancode to change
+    /// \param pressed New state of the key
+    ///
+    ////////////////////////////////////////////////////////////
+    void setKeyPressed(Keyboard::Scancode code, bool pressed);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Change the state of a mouse button in the snapshot
+    ///
+    /// \param button  Button to change
+    /// \param pressed New state of the button
+    ///
+    ////////////////////////////////////////////////////////////
+    void setButtonPressed(Mouse::Button button, bool pressed);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Change the position of the mouse in the snapshot
+    ///
+    /// \param desktopPosition  Position in desktop coordinates
+    /// \param relativePosition Position relative to the reference window
+    ///
+    ////////////////////////////////////////////////////////////
+    void setMousePosition(Vector2i desktopPosition, Vector2i relativePosition);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Release all the keys and buttons in the snapshot
+    ///
+    ////////////////////////////////////////////////////////////
+    void releaseAll();
+
+private:
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    base::EnumArray<Keyboard::Key, bool, Keyboard::KeyCount>           m_keys{};      //!< State of each key
+    base::EnumArray<Keyboard::Scancode, bool, Keyboard::ScancodeCount> m_scancodes{}; //!< State of each physical key
+    base::EnumArray<Mouse::Button, bool, Mouse::ButtonCount>           m_buttons{};   //!< State of each mouse button
+    Vector2i m_mousePosition;         //!< Position of the mouse in desktop coordinates
+    Vector2i m_relativeMousePosition; //!< Position of the mouse relative to the reference window
+};
+
+} // namespace sf
+
+
+////////////////////////////////////////////////////////////
+/// \class sf::InputSnapshot
+/// \ingroup window
+///
+/// `sf::Keyboard::isKeyPressed`, `sf::Mouse::isButtonPressed`
+/// and `sf::Mouse::getPosition` query the operating system on
+/// every call, which can be expensive: on X11, each of them is
+/// a synchronous round trip to the X server.
+///
+/// `sf::InputSnapshot` captures the whole keyboard and mouse
+/// state at once, typically once per frame, and then answers
+/// any number of queries from memory. Alternatively, it can be
+/// maintained from the event loop with `applyEvent`, without
+/// querying the operating system at all.
+///
+/// Usage example:
+/// \code
+/// sf::InputSnapshot input;
+///
+/// while (window.isOpen())
+/// {
+///     while (const sf::base::Optional event = window.pollEvent())
+///     {
+///         // ...
+///     }
+///
+///     // Capture the state once per frame
+///     input.update(window);
+///
+///     if (input.isKeyPressed(sf::Keyboard::Key::Left))
+///         character.move({-1.f, 0.f});
+///
+///     if (input.isKeyPressed(sf::Keyboard::Key::Right))
+///         character.move({1.f, 0.f});
+///
+///     if (input.isButtonPressed(sf::Mouse::Button::Left))
+///         gun.fire(input.getRelativeMousePosition());
+/// }
+/// \endcode
+///
+/// \see sf::Keyboard, sf::Mouse
+///
+////////////////////////////////////////////////////////////
@@ -15,8 +15,10 @@
 #include "SFML/System/Time.hpp"
 #include "SFML/System/Vector2.hpp"
 
+#include "SFML/Base/FixedFunction.hpp"
 #include "SFML/Base/IntTypes.hpp"
 #include "SFML/Base/Optional.hpp"
+#include "SFML/Base/SizeT.hpp"
 #include "SFML/Base/UniquePtr.hpp"
 
 
@@ -32,6 +34,12 @@ class WindowContext;
 namespace sf::priv
 {
 class WindowImpl;
+
+////////////////////////////////////////////////////////////
+/// \brief Non-allocating callback invoked for each drained event
+///
+////////////////////////////////////////////////////////////
+using EventCallback = base::FixedFunction<void(const Event&), 32>;
 } // namespace sf::priv
 
 namespace sf::Vulkan
@@ -236,6 +244,40 @@ public:
     template <typename... Handlers, auto PollEventFn = &WindowBase::pollEvent>
     void pollAndHandleEvents(Handlers&&... handlers);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Handle all pending events in a single batch
+    ///
+    /// Behaves like `pollAndHandleEvents`, but the operating system
+    /// is queried only once and every pending event is moved out of
+    /// the window's internal queue before its handler runs, without
+    /// wrapping it into a `base::Optional` first. Handlers may thus
+    /// push or poll events; events queued meanwhile are left for the
+    /// next call. No memory is allocated unless the internal queue
+    /// needs to grow.
+    ///
+    /// This is the preferred way of handling high-rate input such
+    /// as raw mouse motion, joystick axes or touch events.
+    ///
+    /// \code
+    /// window.handleEvents(
+    ///     [&](sf::Event::Closed) { window.close(); },
+    ///     [&](const sf::Event::MouseMovedRaw& move) { camera.rotate(move.delta); }
+    /// );
+    /// \endcode
+    ///
+    /// Events that are not matched by any handler are ignored.
+    /// Handlers must not destroy the window.
+    ///
+    /// \param handlers A variadic list of callables that take a specific event as their only parameter
+    ///
+    /// \return Number of events that were drained
+    ///
+    /// \see `pollAndHandleEvents`, `pollEvent`
+    ///
+    ////////////////////////////////////////////////////////////
+    template <typename... Handlers>
+    base::SizeT handleEvents(Handlers&&... handlers);
+
     ////////////////////////////////////////////////////////////
     /// \brief Get the position of the window
     ///
@@ -466,6 +508,20 @@ public:
     ////////////////////////////////////////////////////////////
     [[nodiscard]] bool createVulkanSurface(const Vulkan::VulkanSurfaceData& vulkanSurfaceData);
 
+protected:
+    ////////////////////////////////////////////////////////////
+    /// \brief Invoke `callback` on every pending event, emptying the event queue
+    ///
+    /// Events are filtered as in `pollEvent` before being passed
+    /// to `callback`.
+    ///
+    /// \param callback Function invoked for each event, in order
+    ///
+    /// \return Number of events that were drained
+    ///
+    ////////////////////////////////////////////////////////////
+    base::SizeT drainEvents(const priv::EventCallback& callback);
+
 private:
     friend class Window;
 
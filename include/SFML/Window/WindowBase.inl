@@ -35,4 +35,18 @@ void WindowBase::pollAndHandleEvents(Handlers&&... handlers)
         event->match(static_cast<Handlers&&>(handlers)..., [](const priv::DelayOverloadResolution&) { /* ignore */ });
 }
 
+
+////////////////////////////////////////////////////////////
+template <typename... Handlers>
+base::SizeT WindowBase::handleEvents(Handlers&&... handlers)
+{
+    static_assert(sizeof...(Handlers) > 0, "Must provide at least one handler");
+
+    const auto dispatch = [&](const Event& event)
+    { event.match(static_cast<Handlers&&>(handlers)..., [](const priv::DelayOverloadResolution&) { /* ignore */ }); };
+
+    // Only capture a single reference so that the callback fits in the fixed storage
+    return drainEvents([&dispatch](const Event& event) { dispatch(event); });
+}
+
 } // namespace sf
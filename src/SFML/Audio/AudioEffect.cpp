@@ -0,0 +1,46 @@
+#include <SFML/Copyright.hpp> // LICENSE AND COPYRIGHT (C) INFORMATION
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include "SFML/Audio/AudioEffect.hpp"
+
+#include "SFML/Base/Algorithm.hpp"
+#include "SFML/Base/Builtins/Memcpy.hpp"
+#include "SFML/Base/Builtins/Memset.hpp"
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+AudioEffect::~AudioEffect() = default;
+
+
+////////////////////////////////////////////////////////////
+EffectProcessor AudioEffect::makeEffectProcessor()
+{
+    return [this](const float*  inputFrames,
+                  unsigned int& inputFrameCount,
+                  float*        outputFrames,
+                  unsigned int& outputFrameCount,
+                  unsigned int  frameChannelCount)
+    {
+        if (inputFrames == nullptr)
+        {
+            // Process silence so that delay-based effects can still produce their tail
+            SFML_BASE_MEMSET(outputFrames, 0, outputFrameCount * frameChannelCount * sizeof(float));
+        }
+        else
+        {
+            // We process data 1:1
+            outputFrameCount = base::min(inputFrameCount, outputFrameCount);
+            inputFrameCount  = outputFrameCount;
+
+            SFML_BASE_MEMCPY(outputFrames, inputFrames, outputFrameCount * frameChannelCount * sizeof(float));
+        }
+
+        process(outputFrames, outputFrameCount, frameChannelCount);
+    };
+}
+
+} // namespace sf
@@ -0,0 +1,378 @@
+#include <SFML/Copyright.hpp> // LICENSE AND COPYRIGHT (C) INFORMATION
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include "SFML/Audio/BiquadFilter.hpp"
+
+#include "SFML/Base/Algorithm.hpp"
+#include "SFML/Base/Constants.hpp"
+#include "SFML/Base/Math/Cos.hpp"
+#include "SFML/Base/Math/Pow.hpp"
+#include "SFML/Base/Math/Sin.hpp"
+#include "SFML/Base/Math/Sqrt.hpp"
+#include "SFML/Base/Simd.hpp"
+
+#include <atomic>
+
+
+namespace
+{
+// A nested named namespace is used here to allow unity builds of SFML.
+namespace BiquadFilterImpl
+{
+////////////////////////////////////////////////////////////
+struct [[nodiscard]] Coefficients
+{
+    float b0{1.f}, b1{}, b2{}, a1{}, a2{}; // Normalized by a0
+};
+
+
+////////////////////////////////////////////////////////////
+// See the "Audio EQ Cookbook" by Robert Bristow-Johnson
+[[nodiscard]] Coefficients computeCoefficients(sf::BiquadFilter::Type type,
+                                               float                  sampleRate,
+                                               float                  frequency,
+                                               float                  q,
+                                               float                  gain)
+{
+    // Keep the frequency strictly between 0 and Nyquist, where the formulas are well defined
+    const float w0    = sf::base::tau * sf::base::clamp(frequency, 1.f, sampleRate * 0.499f) / sampleRate;
+    const float cosW0 = sf::base::cos(w0);
+    const float alpha = sf::base::sin(w0) / (2.f * sf::base::max(q, 0.001f));
+    const float a     = sf::base::pow(10.f, gain / 40.f);
+
+    float b0 = 1.f, b1 = 0.f, b2 = 0.f, a0 = 1.f, a1 = 0.f, a2 = 0.f;
+
+    switch (type)
+    {
+        case sf::BiquadFilter::Type::LowPass:
+            b0 = (1.f - cosW0) / 2.f;
+            b1 = 1.f - cosW0;
+            b2 = b0;
+            a0 = 1.f + alpha;
+            a1 = -2.f * cosW0;
+            a2 = 1.f - alpha;
+            break;
+
+        case sf::BiquadFilter::Type::HighPass:
+            b0 = (1.f + cosW0) / 2.f;
+            b1 = -(1.f + cosW0);
+            b2 = b0;
+            a0 = 1.f + alpha;
+            a1 = -2.f * cosW0;
+            a2 = 1.f - alpha;
+            break;
+
+        case sf::BiquadFilter::Type::BandPass:
+            b0 = alpha;
+            b1 = 0.f;
+            b2 = -alpha;
+            a0 = 1.f + alpha;
+            a1 = -2.f * cosW0;
+            a2 = 1.f - alpha;
+            break;
+
+        case sf::BiquadFilter::Type::Notch:
+            b0 = 1.f;
+            b1 = -2.f * cosW0;
+            b2 = 1.f;
+            a0 = 1.f + alpha;
+            a1 = -2.f * cosW0;
+            a2 = 1.f - alpha;
+            break;
+
+        case sf::BiquadFilter::Type::AllPass:
+            b0 = 1.f - alpha;
+            b1 = -2.f * cosW0;
+            b2 = 1.f + alpha;
+            a0 = 1.f + alpha;
+            a1 = -2.f * cosW0;
+            a2 = 1.f - alpha;
+            break;
+
+        case sf::BiquadFilter::Type::Peaking:
+            b0 = 1.f + alpha * a;
+            b1 = -2.f * cosW0;
+            b2 = 1.f - alpha * a;
+            a0 = 1.f + alpha / a;
+            a1 = -2.f * cosW0;
+            a2 = 1.f - alpha / a;
+            break;
+
+        case sf::BiquadFilter::Type::LowShelf:
+        {
+            const float k = 2.f * sf::base::sqrt(a) * alpha;
+
+            b0 = a * ((a + 1.f) - (a - 1.f) * cosW0 + k);
+            b1 = 2.f * a * ((a - 1.f) - (a + 1.f) * cosW0);
+            b2 = a * ((a + 1.f) - (a - 1.f) * cosW0 - k);
+            a0 = (a + 1.f) + (a - 1.f) * cosW0 + k;
+            a1 = -2.f * ((a - 1.f) + (a + 1.f) * cosW0);
+            a2 = (a + 1.f) + (a - 1.f) * cosW0 - k;
+            break;
+        }
+
+        case sf::BiquadFilter::Type::HighShelf:
+        {
+            const float k = 2.f * sf::base::sqrt(a) * alpha;
+
+            b0 = a * ((a + 1.f) + (a - 1.f) * cosW0 + k);
+            b1 = -2.f * a * ((a - 1.f) + (a + 1.f) * cosW0);
+            b2 = a * ((a + 1.f) + (a - 1.f) * cosW0 - k);
+            a0 = (a + 1.f) - (a - 1.f) * cosW0 + k;
+            a1 = 2.f * ((a - 1.f) - (a + 1.f) * cosW0);
+            a2 = (a + 1.f) - (a - 1.f) * cosW0 - k;
+            break;
+        }
+    }
+
+    return {b0 / a0, b1 / a0, b2 / a0, a1 / a0, a2 / a0};
+}
+
+
+////////////////////////////////////////////////////////////
+// Filter a block of interleaved frames in place, adding `delta` to the coefficients after each frame if `Ramp` is set
+template <bool Ramp>
+void filterBlock(float*              frames,
+                 unsigned int        frameCount,
+                 unsigned int        channelCount,
+                 unsigned int        processedChannelCount,
+                 Coefficients        c,
+                 const Coefficients& delta,
+                 float*              z1s,
+                 float*              z2s)
+{
+    using sf::base::F32x4;
+
+    const unsigned int vectorChannelCount = processedChannelCount / 4u * 4u;
+
+    // The recursion prevents vectorizing over time, so full groups of four channels are filtered at once instead
+    for (unsigned int firstChannel = 0u; firstChannel < vectorChannelCount; firstChannel += 4u)
+    {
+        auto b0 = F32x4::broadcast(c.b0);
+        auto b1 = F32x4::broadcast(c.b1);
+        auto b2 = F32x4::broadcast(c.b2);
+        auto a1 = F32x4::broadcast(-c.a1);
+        auto a2 = F32x4::broadcast(-c.a2);
+
+        auto z1 = F32x4::load(z1s + firstChannel);
+        auto z2 = F32x4::load(z2s + firstChannel);
+
+        float* channelFrames = frames + firstChannel;
+
+        for (unsigned int i = 0u; i < frameCount; ++i, channelFrames += channelCount)
+        {
+            const F32x4 x = F32x4::load(channelFrames);
+            const F32x4 y = F32x4::mulAdd(b0, x, z1);
+
+            z1 = F32x4::mulAdd(b1, x, F32x4::mulAdd(a1, y, z2));
+            z2 = F32x4::mulAdd(b2, x, a2 * y);
+
+            y.store(channelFrames);
+
+            if constexpr (Ramp)
+            {
+                b0 = b0 + F32x4::broadcast(delta.b0);
+                b1 = b1 + F32x4::broadcast(delta.b1);
+                b2 = b2 + F32x4::broadcast(delta.b2);
+                a1 = a1 - F32x4::broadcast(delta.a1);
+                a2 = a2 - F32x4::broadcast(delta.a2);
+            }
+        }
+
+        z1.store(z1s + firstChannel);
+        z2.store(z2s + firstChannel);
+    }
+
+    // The remaining channels (all of them for mono and stereo) would leave most SIMD lanes empty,
+    // so they are filtered with scalar code, interleaving their independent recursions
+    float* channelFrames = frames;
+
+    for (unsigned int i = 0u; i < frameCount; ++i, channelFrames += channelCount)
+    {
+        for (unsigned int channel = vectorChannelCount; channel < processedChannelCount; ++channel)
+        {
+            const float x = channelFrames[channel];
+            const float y = c.b0 * x + z1s[channel];
+
+            z1s[channel] = c.b1 * x - c.a1 * y + z2s[channel];
+            z2s[channel] = c.b2 * x - c.a2 * y;
+
+            channelFrames[channel] = y;
+        }
+
+        if constexpr (Ramp)
+        {
+            c.b0 += delta.b0;
+            c.b1 += delta.b1;
+            c.b2 += delta.b2;
+            c.a1 += delta.a1;
+            c.a2 += delta.a2;
+        }
+    }
+}
+
+} // namespace BiquadFilterImpl
+} // namespace
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+struct BiquadFilter::Impl
+{
+    explicit Impl(unsigned int theSampleRate, Type theType, float theFrequency, float theQ, float theGain) :
+    sampleRate(static_cast<float>(theSampleRate)),
+    type(theType),
+    frequency(theFrequency),
+    q(theQ),
+    gain(theGain)
+    {
+    }
+
+    const float sampleRate; //!< Sample rate of the processed audio
+
+    std::atomic<Type>              type;         //!< Frequency response, written by any thread
+    std::atomic<float>             frequency;    //!< Cutoff, center or corner frequency, written by any thread
+    std::atomic<float>             q;            //!< Quality factor, written by any thread
+    std::atomic<float>             gain;         //!< Gain of the peaking and shelf filters, written by any thread
+    std::atomic<bool>              dirty{true};  //!< Set when the coefficients must be recomputed
+    BiquadFilterImpl::Coefficients coefficients; //!< Coefficients used by the audio thread
+    bool                           primed{};     //!< Whether `coefficients` were computed at least once
+
+    // Transposed direct form II state
+    float z1[maxChannelCount]{}; //!< First state variable of each channel
+    float z2[maxChannelCount]{}; //!< Second state variable of each channel
+};
+
+
+////////////////////////////////////////////////////////////
+BiquadFilter::BiquadFilter(unsigned int sampleRate, Type type, float frequency, float q, float gain) :
+m_impl(base::makeUnique<Impl>(sampleRate, type, frequency, q, gain))
+{
+}
+
+
+////////////////////////////////////////////////////////////
+BiquadFilter::~BiquadFilter() = default;
+
+
+////////////////////////////////////////////////////////////
+void BiquadFilter::setType(Type type)
+{
+    m_impl->type.store(type, std::memory_order_relaxed);
+    m_impl->dirty.store(true, std::memory_order_release);
+}
+
+
+////////////////////////////////////////////////////////////
+void BiquadFilter::setFrequency(float frequency)
+{
+    m_impl->frequency.store(frequency, std::memory_order_relaxed);
+    m_impl->dirty.store(true, std::memory_order_release);
+}
+
+
+////////////////////////////////////////////////////////////
+void BiquadFilter::setQ(float q)
+{
+    m_impl->q.store(q, std::memory_order_relaxed);
+    m_impl->dirty.store(true, std::memory_order_release);
+}
+
+
+////////////////////////////////////////////////////////////
+void BiquadFilter::setGain(float gain)
+{
+    m_impl->gain.store(gain, std::memory_order_relaxed);
+    m_impl->dirty.store(true, std::memory_order_release);
+}
+
+
+////////////////////////////////////////////////////////////
+BiquadFilter::Type BiquadFilter::getType() const
+{
+    return m_impl->type.load(std::memory_order_relaxed);
+}
+
+
+////////////////////////////////////////////////////////////
+float BiquadFilter::getFrequency() const
+{
+    return m_impl->frequency.load(std::memory_order_relaxed);
+}
+
+
+////////////////////////////////////////////////////////////
+float BiquadFilter::getQ() const
+{
+    return m_impl->q.load(std::memory_order_relaxed);
+}
+
+
+////////////////////////////////////////////////////////////
+float BiquadFilter::getGain() const
+{
+    return m_impl->gain.load(std::memory_order_relaxed);
+}
+
+
+////////////////////////////////////////////////////////////
+void BiquadFilter::process(float* frames, unsigned int frameCount, unsigned int channelCount)
+{
+    if (frameCount == 0u)
+        return;
+
+    const unsigned int processedChannelCount = base::min(channelCount, maxChannelCount);
+
+    // Parameters written by other threads are only picked up between blocks
+    if (m_impl->dirty.exchange(false, std::memory_order_acquire))
+    {
+        const BiquadFilterImpl::Coefficients target = BiquadFilterImpl::computeCoefficients(
+            m_impl->type.load(std::memory_order_relaxed),
+            m_impl->sampleRate,
+            m_impl->frequency.load(std::memory_order_relaxed),
+            m_impl->q.load(std::memory_order_relaxed),
+            m_impl->gain.load(std::memory_order_relaxed));
+
+        // Switching coefficients abruptly mid-stream causes audible clicks ("zipper noise"),
+        // so they are interpolated linearly over this block instead, except for the very first one
+        if (m_impl->primed)
+        {
+            const BiquadFilterImpl::Coefficients& current = m_impl->coefficients;
+            const float                           scale   = 1.f / static_cast<float>(frameCount);
+
+            BiquadFilterImpl::filterBlock<true>(frames,
+                                                frameCount,
+                                                channelCount,
+                                                processedChannelCount,
+                                                current,
+                                                {(target.b0 - current.b0) * scale,
+                                                 (target.b1 - current.b1) * scale,
+                                                 (target.b2 - current.b2) * scale,
+                                                 (target.a1 - current.a1) * scale,
+                                                 (target.a2 - current.a2) * scale},
+                                                m_impl->z1,
+                                                m_impl->z2);
+
+            // Store the exact target rather than the accumulated ramp, so that rounding errors do not build up
+            m_impl->coefficients = target;
+            return;
+        }
+
+        m_impl->coefficients = target;
+        m_impl->primed       = true;
+    }
+
+    BiquadFilterImpl::filterBlock<false>(frames,
+                                         frameCount,
+                                         channelCount,
+                                         processedChannelCount,
+                                         m_impl->coefficients,
+                                         {},
+                                         m_impl->z1,
+                                         m_impl->z2);
+}
+
+} // namespace sf
@@ -0,0 +1,243 @@
+#include <SFML/Copyright.hpp> // LICENSE AND COPYRIGHT (C) INFORMATION
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include "SFML/Audio/Compressor.hpp"
+
+#include "SFML/Base/Algorithm.hpp"
+#include "SFML/Base/IntTypes.hpp"
+#include "SFML/Base/Math/Exp.hpp"
+#include "SFML/Base/Math/Fabs.hpp"
+#include "SFML/Base/Math/Log10.hpp"
+#include "SFML/Base/Math/Pow.hpp"
+#include "SFML/Base/Simd.hpp"
+#include "SFML/Base/SizeT.hpp"
+
+#include <atomic>
+
+
+namespace
+{
+// A nested named namespace is used here to allow unity builds of SFML.
+namespace CompressorImpl
+{
+////////////////////////////////////////////////////////////
+// The gain is computed once per block and linearly interpolated within it
+constexpr unsigned int blockFrameCount = 32u;
+
+
+////////////////////////////////////////////////////////////
+[[nodiscard]] float decibelsToGain(float decibels)
+{
+    return sf::base::pow(10.f, decibels / 20.f);
+}
+
+
+////////////////////////////////////////////////////////////
+// Smoothing coefficient that covers ~63% of the distance to the target in `time` seconds
+[[nodiscard]] float blockCoefficient(float time, float sampleRate)
+{
+    return 1.f - sf::base::exp(-static_cast<float>(blockFrameCount) / sf::base::max(time * sampleRate, 1.f));
+}
+
+
+////////////////////////////////////////////////////////////
+[[nodiscard]] float peak(const float* samples, sf::base::SizeT sampleCount)
+{
+    auto            peakX4 = sf::base::F32x4::zero();
+    sf::base::SizeT i      = 0u;
+
+    for (; i + 4u <= sampleCount; i += 4u)
+        peakX4 = sf::base::F32x4::max(peakX4, sf::base::F32x4::abs(sf::base::F32x4::load(samples + i)));
+
+    float result = peakX4.horizontalMax();
+
+    for (; i < sampleCount; ++i)
+        result = sf::base::max(result, sf::base::fabs(samples[i]));
+
+    return result;
+}
+
+} // namespace CompressorImpl
+} // namespace
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+struct Compressor::Impl
+{
+    explicit Impl(unsigned int theSampleRate) : sampleRate(static_cast<float>(theSampleRate))
+    {
+    }
+
+    const float sampleRate; //!< Sample rate of the processed audio
+
+    std::atomic<float>     threshold{-12.f};                            //!< Threshold in dB
+    std::atomic<float>     ratio{4.f};                                  //!< Compression ratio
+    std::atomic<base::I64> attack{milliseconds(10).asMicroseconds()};   //!< Attack time
+    std::atomic<base::I64> release{milliseconds(100).asMicroseconds()}; //!< Release time
+    std::atomic<float>     makeupGain{0.f};                             //!< Makeup gain in dB
+    std::atomic<float>     gainReduction{0.f};                          //!< Last gain reduction in dB, for metering
+
+    float envelope{}; //!< Smoothed peak level of the input
+    float gain{1.f};  //!< Linear gain applied at the end of the previous block
+};
+
+
+////////////////////////////////////////////////////////////
+Compressor::Compressor(unsigned int sampleRate) : m_impl(base::makeUnique<Impl>(sampleRate))
+{
+}
+
+
+////////////////////////////////////////////////////////////
+Compressor::~Compressor() = default;
+
+
+////////////////////////////////////////////////////////////
+void Compressor::setThreshold(float threshold)
+{
+    m_impl->threshold.store(threshold, std::memory_order_relaxed);
+}
+
+
+////////////////////////////////////////////////////////////
+void Compressor::setRatio(float ratio)
+{
+    m_impl->ratio.store(ratio, std::memory_order_relaxed);
+}
+
+
+////////////////////////////////////////////////////////////
+void Compressor::setAttack(Time attack)
+{
+    m_impl->attack.store(attack.asMicroseconds(), std::memory_order_relaxed);
+}
+
+
+////////////////////////////////////////////////////////////
+void Compressor::setRelease(Time release)
+{
+    m_impl->release.store(release.asMicroseconds(), std::memory_order_relaxed);
+}
+
+
+////////////////////////////////////////////////////////////
+void Compressor::setMakeupGain(float makeupGain)
+{
+    m_impl->makeupGain.store(makeupGain, std::memory_order_relaxed);
+}
+
+
+////////////////////////////////////////////////////////////
+float Compressor::getThreshold() const
+{
+    return m_impl->threshold.load(std::memory_order_relaxed);
+}
+
+
+////////////////////////////////////////////////////////////
+float Compressor::getRatio() const
+{
+    return m_impl->ratio.load(std::memory_order_relaxed);
+}
+
+
+////////////////////////////////////////////////////////////
+Time Compressor::getAttack() const
+{
+    return microseconds(m_impl->attack.load(std::memory_order_relaxed));
+}
+
+
+////////////////////////////////////////////////////////////
+Time Compressor::getRelease() const
+{
+    return microseconds(m_impl->release.load(std::memory_order_relaxed));
+}
+
+
+////////////////////////////////////////////////////////////
+float Compressor::getMakeupGain() const
+{
+    return m_impl->makeupGain.load(std::memory_order_relaxed);
+}
+
+
+////////////////////////////////////////////////////////////
+float Compressor::getGainReduction() const
+{
+    return m_impl->gainReduction.load(std::memory_order_relaxed);
+}
+
+
+////////////////////////////////////////////////////////////
+void Compressor::process(float* frames, unsigned int frameCount, unsigned int channelCount)
+{
+    Impl& impl = *m_impl;
+
+    const float threshold = CompressorImpl::decibelsToGain(impl.threshold.load(std::memory_order_relaxed));
+    const float exponent  = 1.f / base::max(impl.ratio.load(std::memory_order_relaxed), 1.f) - 1.f;
+    const float makeup    = CompressorImpl::decibelsToGain(impl.makeupGain.load(std::memory_order_relaxed));
+
+    const float attackCoefficient = CompressorImpl::blockCoefficient(
+        microseconds(impl.attack.load(std::memory_order_relaxed)).asSeconds(),
+        impl.sampleRate);
+
+    const float releaseCoefficient = CompressorImpl::blockCoefficient(
+        microseconds(impl.release.load(std::memory_order_relaxed)).asSeconds(),
+        impl.sampleRate);
+
+    float minReduction = 1.f;
+
+    for (unsigned int firstFrame = 0u; firstFrame < frameCount; firstFrame += CompressorImpl::blockFrameCount)
+    {
+        const unsigned int blockFrameCount = base::min(frameCount - firstFrame, CompressorImpl::blockFrameCount);
+        const base::SizeT  sampleCount     = base::SizeT{blockFrameCount} * channelCount;
+        float* const       samples         = frames + base::SizeT{firstFrame} * channelCount;
+
+        // All channels share the same detector, so that the stereo image does not shift
+        const float level = CompressorImpl::peak(samples, sampleCount);
+        impl.envelope += (level > impl.envelope ? attackCoefficient : releaseCoefficient) * (level - impl.envelope);
+
+        const float reduction = impl.envelope > threshold ? base::pow(impl.envelope / threshold, exponent) : 1.f;
+        const float target    = reduction * makeup;
+
+        minReduction = base::min(minReduction, reduction);
+
+        if (base::fabs(target - impl.gain) < 1e-6f)
+        {
+            // Steady state, the whole block gets the same gain
+            const auto  gain = base::F32x4::broadcast(target);
+            base::SizeT i    = 0u;
+
+            for (; i + 4u <= sampleCount; i += 4u)
+                (base::F32x4::load(samples + i) * gain).store(samples + i);
+
+            for (; i < sampleCount; ++i)
+                samples[i] *= target;
+        }
+        else
+        {
+            // Ramp towards the new gain to avoid zipper noise
+            const float step = (target - impl.gain) / static_cast<float>(blockFrameCount);
+            float       gain = impl.gain;
+
+            for (unsigned int frame = 0u; frame < blockFrameCount; ++frame)
+            {
+                gain += step;
+
+                for (unsigned int channel = 0u; channel < channelCount; ++channel)
+                    samples[frame * channelCount + channel] *= gain;
+            }
+        }
+
+        impl.gain = target;
+    }
+
+    impl.gainReduction.store(20.f * base::log10(minReduction), std::memory_order_relaxed);
+}
+
+} // namespace sf
@@ -0,0 +1,196 @@
+#include <SFML/Copyright.hpp> // LICENSE AND COPYRIGHT (C) INFORMATION
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include "SFML/Audio/Echo.hpp"
+
+#include "SFML/Base/Algorithm.hpp"
+#include "SFML/Base/Assert.hpp"
+#include "SFML/Base/Builtins/Memset.hpp"
+#include "SFML/Base/IntTypes.hpp"
+#include "SFML/Base/Simd.hpp"
+#include "SFML/Base/SizeT.hpp"
+#include "SFML/Base/TrivialVector.hpp"
+
+#include <atomic>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+struct Echo::Impl
+{
+    explicit Impl(unsigned int theSampleRate, Time maxDelay, unsigned int theChannelCount) :
+    sampleRate(theSampleRate),
+    maxDelayFrames(base::max(static_cast<base::SizeT>(maxDelay.asSeconds() * static_cast<float>(theSampleRate)),
+                             base::SizeT{1u})),
+    channelCount(theChannelCount),
+    buffer(maxDelayFrames * theChannelCount)
+    {
+        SFML_BASE_MEMSET(buffer.data(), 0, buffer.size() * sizeof(float));
+    }
+
+    const unsigned int sampleRate;     //!< Sample rate of the processed audio
+    const base::SizeT  maxDelayFrames; //!< Capacity of the delay line, in frames
+    const unsigned int channelCount;   //!< Maximum number of channels of the processed audio
+
+    std::atomic<base::I64> delay{milliseconds(200).asMicroseconds()}; //!< Delay, written by any thread
+    std::atomic<float>     feedback{0.5f};                            //!< Feedback, written by any thread
+    std::atomic<float>     wet{0.5f};                                 //!< Gain of the delayed signal
+    std::atomic<float>     dry{1.f};                                  //!< Gain of the original signal
+
+    base::TrivialVector<float> buffer;             //!< Interleaved delay line
+    base::SizeT                ringLength{};       //!< Samples of `buffer` in use for the current channel count
+    base::SizeT                writeIndex{};       //!< Next sample of the delay line to write
+    unsigned int               lastChannelCount{}; //!< Channel count of the previous block
+};
+
+
+////////////////////////////////////////////////////////////
+Echo::Echo(unsigned int sampleRate, Time maxDelay, unsigned int channelCount) :
+m_impl(base::makeUnique<Impl>(sampleRate, maxDelay, channelCount))
+{
+    SFML_BASE_ASSERT(channelCount > 0u && "Channel count must be positive");
+}
+
+
+////////////////////////////////////////////////////////////
+Echo::~Echo() = default;
+
+
+////////////////////////////////////////////////////////////
+void Echo::setDelay(Time delay)
+{
+    m_impl->delay.store(delay.asMicroseconds(), std::memory_order_relaxed);
+}
+
+
+////////////////////////////////////////////////////////////
+void Echo::setFeedback(float feedback)
+{
+    m_impl->feedback.store(feedback, std::memory_order_relaxed);
+}
+
+
+////////////////////////////////////////////////////////////
+void Echo::setWet(float wet)
+{
+    m_impl->wet.store(wet, std::memory_order_relaxed);
+}
+
+
+////////////////////////////////////////////////////////////
+void Echo::setDry(float dry)
+{
+    m_impl->dry.store(dry, std::memory_order_relaxed);
+}
+
+
+////////////////////////////////////////////////////////////
+Time Echo::getDelay() const
+{
+    return microseconds(m_impl->delay.load(std::memory_order_relaxed));
+}
+
+
+////////////////////////////////////////////////////////////
+float Echo::getFeedback() const
+{
+    return m_impl->feedback.load(std::memory_order_relaxed);
+}
+
+
+////////////////////////////////////////////////////////////
+float Echo::getWet() const
+{
+    return m_impl->wet.load(std::memory_order_relaxed);
+}
+
+
+////////////////////////////////////////////////////////////
+float Echo::getDry() const
+{
+    return m_impl->dry.load(std::memory_order_relaxed);
+}
+
+
+////////////////////////////////////////////////////////////
+void Echo::process(float* frames, unsigned int frameCount, unsigned int channelCount)
+{
+    Impl& impl = *m_impl;
+
+    if (channelCount > impl.channelCount)
+        return; // The delay line was not sized for that many channels
+
+    // The interleaved delay line is reinterpreted for the new channel count, which requires a fresh start
+    if (channelCount != impl.lastChannelCount)
+    {
+        SFML_BASE_MEMSET(impl.buffer.data(), 0, impl.buffer.size() * sizeof(float));
+
+        impl.ringLength       = impl.maxDelayFrames * channelCount;
+        impl.writeIndex       = 0u;
+        impl.lastChannelCount = channelCount;
+    }
+
+    const auto delayFrames = base::clamp(static_cast<base::SizeT>(
+                                             microseconds(impl.delay.load(std::memory_order_relaxed)).asSeconds() *
+                                             static_cast<float>(impl.sampleRate)),
+                                         base::SizeT{1u},
+                                         impl.maxDelayFrames);
+
+    const float feedback = impl.feedback.load(std::memory_order_relaxed);
+    const float wet      = impl.wet.load(std::memory_order_relaxed);
+    const float dry      = impl.dry.load(std::memory_order_relaxed);
+
+    const auto feedbackX4 = base::F32x4::broadcast(feedback);
+    const auto wetX4      = base::F32x4::broadcast(wet);
+    const auto dryX4      = base::F32x4::broadcast(dry);
+
+    float* const      line         = impl.buffer.data();
+    const base::SizeT ringLength   = impl.ringLength;
+    const base::SizeT delaySamples = delayFrames * channelCount;
+    base::SizeT       remaining    = base::SizeT{frameCount} * channelCount;
+    base::SizeT       writeIndex   = impl.writeIndex;
+    base::SizeT       readIndex    = (writeIndex + ringLength - delaySamples) % ringLength;
+    float*            samples      = frames;
+
+    while (remaining > 0u)
+    {
+        // Neither index wraps within a chunk, and a chunk never reads samples it wrote itself
+        const base::SizeT chunk = base::min(base::min(remaining, delaySamples),
+                                            base::min(ringLength - writeIndex, ringLength - readIndex));
+
+        float* const       write = line + writeIndex;
+        const float* const read  = line + readIndex;
+
+        base::SizeT i = 0u;
+
+        for (; i + 4u <= chunk; i += 4u)
+        {
+            const auto delayed = base::F32x4::load(read + i);
+            const auto input   = base::F32x4::load(samples + i);
+
+            base::F32x4::mulAdd(wetX4, delayed, dryX4 * input).store(samples + i);
+            base::F32x4::mulAdd(feedbackX4, delayed, input).store(write + i);
+        }
+
+        for (; i < chunk; ++i)
+        {
+            const float delayed = read[i];
+            const float input   = samples[i];
+
+            samples[i] = wet * delayed + dry * input;
+            write[i]   = feedback * delayed + input;
+        }
+
+        samples += chunk;
+        remaining -= chunk;
+        writeIndex = (writeIndex + chunk) % ringLength;
+        readIndex  = (readIndex + chunk) % ringLength;
+    }
+
+    impl.writeIndex = writeIndex;
+}
+
+} // namespace sf
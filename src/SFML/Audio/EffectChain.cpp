@@ -0,0 +1,86 @@
+#include <SFML/Copyright.hpp> // LICENSE AND COPYRIGHT (C) INFORMATION
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include "SFML/Audio/EffectChain.hpp"
+
+#include "SFML/Base/Assert.hpp"
+
+#include <atomic>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+struct EffectChain::Impl
+{
+    AudioEffect*             effects[maxEffectCount]{}; //!< Effects, in processing order
+    std::atomic<bool>        enabled[maxEffectCount]{}; //!< Whether each effect is applied
+    std::atomic<base::SizeT> effectCount{0u};           //!< Number of published effects
+};
+
+
+////////////////////////////////////////////////////////////
+EffectChain::EffectChain() : m_impl(base::makeUnique<Impl>())
+{
+}
+
+
+////////////////////////////////////////////////////////////
+EffectChain::~EffectChain() = default;
+
+
+////////////////////////////////////////////////////////////
+bool EffectChain::add(AudioEffect& effect)
+{
+    SFML_BASE_ASSERT(&effect != this && "An effect chain cannot contain itself");
+
+    const base::SizeT index = m_impl->effectCount.load(std::memory_order_relaxed);
+
+    if (index == maxEffectCount)
+        return false;
+
+    m_impl->effects[index] = &effect;
+    m_impl->enabled[index].store(true, std::memory_order_relaxed);
+
+    // Publish the new slot only once it is fully written, so that `add` is safe while processing
+    m_impl->effectCount.store(index + 1u, std::memory_order_release);
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+base::SizeT EffectChain::getEffectCount() const
+{
+    return m_impl->effectCount.load(std::memory_order_relaxed);
+}
+
+
+////////////////////////////////////////////////////////////
+void EffectChain::setEnabled(base::SizeT index, bool enabled)
+{
+    SFML_BASE_ASSERT(index < getEffectCount() && "Effect index is out of range");
+    m_impl->enabled[index].store(enabled, std::memory_order_relaxed);
+}
+
+
+////////////////////////////////////////////////////////////
+bool EffectChain::isEnabled(base::SizeT index) const
+{
+    SFML_BASE_ASSERT(index < getEffectCount() && "Effect index is out of range");
+    return m_impl->enabled[index].load(std::memory_order_relaxed);
+}
+
+
+////////////////////////////////////////////////////////////
+void EffectChain::process(float* frames, unsigned int frameCount, unsigned int channelCount)
+{
+    const base::SizeT effectCount = m_impl->effectCount.load(std::memory_order_acquire);
+
+    for (base::SizeT i = 0u; i < effectCount; ++i)
+        if (m_impl->enabled[i].load(std::memory_order_relaxed))
+            m_impl->effects[i]->process(frames, frameCount, channelCount);
+}
+
+} // namespace sf
@@ -0,0 +1,116 @@
+#include <SFML/Copyright.hpp> // LICENSE AND COPYRIGHT (C) INFORMATION
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include "SFML/Audio/FirFilter.hpp"
+
+#include "SFML/Base/Algorithm.hpp"
+#include "SFML/Base/Assert.hpp"
+#include "SFML/Base/Builtins/Memset.hpp"
+#include "SFML/Base/Simd.hpp"
+#include "SFML/Base/TrivialVector.hpp"
+
+#include <atomic>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+struct FirFilter::Impl
+{
+    explicit Impl(const float* taps, base::SizeT theTapCount) :
+    tapCount(theTapCount),
+    paddedTapCount((theTapCount + 3u) / 4u * 4u),
+    reversedTaps(paddedTapCount),
+    history(paddedTapCount * 2u * maxChannelCount)
+    {
+        // Taps are stored oldest-first to match the history layout, zero padding goes on the oldest side
+        const base::SizeT padding = paddedTapCount - tapCount;
+
+        for (base::SizeT i = 0u; i < paddedTapCount; ++i)
+            reversedTaps[i] = i < padding ? 0.f : taps[paddedTapCount - 1u - i];
+
+        SFML_BASE_MEMSET(history.data(), 0, history.size() * sizeof(float));
+    }
+
+    const base::SizeT tapCount;       //!< Number of taps of the impulse response
+    const base::SizeT paddedTapCount; //!< Number of taps rounded up to a multiple of four
+
+    std::atomic<float> gain{1.f}; //!< Output gain, written by any thread
+
+    base::TrivialVector<float> reversedTaps; //!< Impulse response, oldest sample first
+    base::TrivialVector<float> history;      //!< Doubled input history of each channel
+    base::SizeT                position{};   //!< Index of the oldest sample in each history
+};
+
+
+////////////////////////////////////////////////////////////
+FirFilter::FirFilter(const float* taps, base::SizeT tapCount) : m_impl(base::makeUnique<Impl>(taps, tapCount))
+{
+    SFML_BASE_ASSERT(taps != nullptr && tapCount > 0u && "A FIR filter needs at least one tap");
+}
+
+
+////////////////////////////////////////////////////////////
+FirFilter::~FirFilter() = default;
+
+
+////////////////////////////////////////////////////////////
+base::SizeT FirFilter::getTapCount() const
+{
+    return m_impl->tapCount;
+}
+
+
+////////////////////////////////////////////////////////////
+void FirFilter::setGain(float gain)
+{
+    m_impl->gain.store(gain, std::memory_order_relaxed);
+}
+
+
+////////////////////////////////////////////////////////////
+float FirFilter::getGain() const
+{
+    return m_impl->gain.load(std::memory_order_relaxed);
+}
+
+
+////////////////////////////////////////////////////////////
+void FirFilter::process(float* frames, unsigned int frameCount, unsigned int channelCount)
+{
+    Impl& impl = *m_impl;
+
+    const float        gain                  = impl.gain.load(std::memory_order_relaxed);
+    const base::SizeT  length                = impl.paddedTapCount;
+    const float* const taps                  = impl.reversedTaps.data();
+    const unsigned int processedChannelCount = base::min(channelCount, maxChannelCount);
+
+    for (unsigned int i = 0u; i < frameCount; ++i, frames += channelCount)
+    {
+        // Each sample is written twice, so that the last `length` samples are always contiguous
+        const base::SizeT writeIndex = impl.position;
+        impl.position                = (impl.position + 1u) % length;
+
+        for (unsigned int channel = 0u; channel < processedChannelCount; ++channel)
+        {
+            float* const history = impl.history.data() + channel * length * 2u;
+
+            history[writeIndex]          = frames[channel];
+            history[writeIndex + length] = frames[channel];
+
+            // Window of the last `length` inputs, oldest first
+            const float* const window = history + impl.position;
+
+            auto sum = base::F32x4::zero();
+
+            for (base::SizeT j = 0u; j < length; j += 4u)
+                sum = base::F32x4::mulAdd(base::F32x4::load(taps + j), base::F32x4::load(window + j), sum);
+
+            frames[channel] = sum.horizontalSum() * gain;
+        }
+    }
+}
+
+} // namespace sf
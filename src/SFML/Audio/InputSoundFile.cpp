@@ -14,6 +14,7 @@
 #include "SFML/System/MemoryInputStream.hpp"
 #include "SFML/System/Path.hpp"
 #include "SFML/System/PathUtils.hpp"
+#include "SFML/System/PrefetchInputStream.hpp"
 #include "SFML/System/Time.hpp"
 
 #include "SFML/Base/Algorithm.hpp"
@@ -57,7 +58,7 @@ void InputSoundFile::StreamDeleter::operator()(InputStream* ptr) const
 
 
 ////////////////////////////////////////////////////////////
-base::Optional<InputSoundFile> InputSoundFile::openFromFile(const Path& filename)
+base::Optional<InputSoundFile> InputSoundFile::openFromFile(const Path& filename, bool prefetch)
 {
     // Find a suitable reader for the file type
     auto reader = SoundFileFactory::createReaderFromFilename(filename);
@@ -78,7 +79,11 @@ base::Optional<InputSoundFile> InputSoundFile::openFromFile(const Path& filename
     }
 
     // Wrap the file into a stream
-    auto file = base::makeUnique<FileInputStream>(SFML_BASE_MOVE(*fileInputStream));
+    base::UniquePtr<InputStream> file = base::makeUnique<FileInputStream>(SFML_BASE_MOVE(*fileInputStream));
+
+    // Optionally read the file ahead on a background thread
+    if (prefetch)
+        file = base::makeUnique<PrefetchInputStream>(SFML_BASE_MOVE(file));
 
     // Pass the stream to the reader
     auto info = reader->open(*file);
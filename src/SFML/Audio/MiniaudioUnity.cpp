@@ -14,6 +14,7 @@
 #include "SFML/Audio/Unity/MiniaudioUtils.cpp"
 #include "SFML/Audio/Unity/PlaybackDevice.cpp"
 #include "SFML/Audio/Unity/SavedSettings.cpp"
+#include "SFML/Audio/Unity/SoundBus.cpp"
 #include "SFML/Audio/Unity/Sound.cpp"
 #include "SFML/Audio/Unity/SoundFileReaderWav.cpp"
 #include "SFML/Audio/Unity/SoundRecorder.cpp"
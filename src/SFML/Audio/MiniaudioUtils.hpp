@@ -22,6 +22,7 @@ using ma_sound_end_proc = void (*)(void*, ma_sound*);
 namespace sf
 {
 class EffectProcessor;
+class SoundBus;
 class Time;
 } // namespace sf
 
@@ -49,6 +50,9 @@ struct SoundBase
     void refreshSoundChannelMap();
 
     void setAndConnectEffectProcessor(EffectProcessor effectProcessor);
+    void setBus(SoundBus* bus);
+
+    [[nodiscard]] SoundBus* getBus() const;
 
     ////////////////////////////////////////////////////////////
     // Member data
@@ -108,9 +108,9 @@ base::Optional<Music> Music::tryOpenFromInputSoundFile(base::Optional<InputSound
 
 
 ////////////////////////////////////////////////////////////
-base::Optional<Music> Music::openFromFile(const Path& filename)
+base::Optional<Music> Music::openFromFile(const Path& filename, bool prefetch)
 {
-    return tryOpenFromInputSoundFile(InputSoundFile::openFromFile(filename), "file");
+    return tryOpenFromInputSoundFile(InputSoundFile::openFromFile(filename, prefetch), "file");
 }
 
 
@@ -0,0 +1,207 @@
+#include <SFML/Copyright.hpp> // LICENSE AND COPYRIGHT (C) INFORMATION
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include "SFML/Audio/Reverb.hpp"
+
+#include "SFML/Base/Algorithm.hpp"
+#include "SFML/Base/Builtins/Memset.hpp"
+#include "SFML/Base/Simd.hpp"
+#include "SFML/Base/SizeT.hpp"
+#include "SFML/Base/TrivialVector.hpp"
+
+#include <atomic>
+
+
+namespace
+{
+// A nested named namespace is used here to allow unity builds of SFML.
+namespace ReverbImpl
+{
+////////////////////////////////////////////////////////////
+constexpr sf::base::SizeT lineCount = 4u;
+
+////////////////////////////////////////////////////////////
+// Mutually prime lengths at 48 kHz (30 to 43 ms), so that the echoes of the lines rarely coincide
+constexpr sf::base::SizeT baseLineLengths[lineCount]{1433u, 1601u, 1867u, 2053u};
+
+} // namespace ReverbImpl
+} // namespace
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+struct Reverb::Impl
+{
+    explicit Impl(unsigned int sampleRate)
+    {
+        base::SizeT totalLength = 0u;
+
+        for (base::SizeT i = 0u; i < ReverbImpl::lineCount; ++i)
+        {
+            lineOffsets[i] = totalLength;
+            lineLengths[i] = base::max(ReverbImpl::baseLineLengths[i] * sampleRate / 48'000u, base::SizeT{1u});
+            totalLength += lineLengths[i];
+        }
+
+        lines.resize(totalLength);
+        SFML_BASE_MEMSET(lines.data(), 0, lines.size() * sizeof(float));
+    }
+
+    std::atomic<float> roomSize{0.5f}; //!< Room size, written by any thread
+    std::atomic<float> damping{0.5f};  //!< Damping, written by any thread
+    std::atomic<float> wet{0.3f};      //!< Gain of the reverberated signal
+    std::atomic<float> dry{1.f};       //!< Gain of the original signal
+
+    base::TrivialVector<float> lines;                                  //!< Storage of the four delay lines
+    base::SizeT                lineOffsets[ReverbImpl::lineCount]{};   //!< Start of each line in `lines`
+    base::SizeT                lineLengths[ReverbImpl::lineCount]{};   //!< Length of each line
+    base::SizeT                linePositions[ReverbImpl::lineCount]{}; //!< Read/write position in each line
+    float                      lowPassState[ReverbImpl::lineCount]{};  //!< Damping filter state of each line
+};
+
+
+////////////////////////////////////////////////////////////
+Reverb::Reverb(unsigned int sampleRate) : m_impl(base::makeUnique<Impl>(sampleRate))
+{
+}
+
+
+////////////////////////////////////////////////////////////
+Reverb::~Reverb() = default;
+
+
+////////////////////////////////////////////////////////////
+void Reverb::setRoomSize(float roomSize)
+{
+    m_impl->roomSize.store(roomSize, std::memory_order_relaxed);
+}
+
+
+////////////////////////////////////////////////////////////
+void Reverb::setDamping(float damping)
+{
+    m_impl->damping.store(damping, std::memory_order_relaxed);
+}
+
+
+////////////////////////////////////////////////////////////
+void Reverb::setWet(float wet)
+{
+    m_impl->wet.store(wet, std::memory_order_relaxed);
+}
+
+
+////////////////////////////////////////////////////////////
+void Reverb::setDry(float dry)
+{
+    m_impl->dry.store(dry, std::memory_order_relaxed);
+}
+
+
+////////////////////////////////////////////////////////////
+float Reverb::getRoomSize() const
+{
+    return m_impl->roomSize.load(std::memory_order_relaxed);
+}
+
+
+////////////////////////////////////////////////////////////
+float Reverb::getDamping() const
+{
+    return m_impl->damping.load(std::memory_order_relaxed);
+}
+
+
+////////////////////////////////////////////////////////////
+float Reverb::getWet() const
+{
+    return m_impl->wet.load(std::memory_order_relaxed);
+}
+
+
+////////////////////////////////////////////////////////////
+float Reverb::getDry() const
+{
+    return m_impl->dry.load(std::memory_order_relaxed);
+}
+
+
+////////////////////////////////////////////////////////////
+void Reverb::process(float* frames, unsigned int frameCount, unsigned int channelCount)
+{
+    Impl& impl = *m_impl;
+
+    const unsigned int processedChannelCount = base::min(channelCount, maxChannelCount);
+
+    if (processedChannelCount == 0u)
+        return;
+
+    // The Hadamard mix below is orthogonal, so any feedback gain below one keeps the network stable
+    const auto feedback = base::F32x4::broadcast(
+        0.7f + 0.28f * base::clamp(impl.roomSize.load(std::memory_order_relaxed), 0.f, 1.f));
+    const auto lowPassCoefficient = base::F32x4::broadcast(
+        1.f - 0.8f * base::clamp(impl.damping.load(std::memory_order_relaxed), 0.f, 1.f));
+
+    const float wet       = impl.wet.load(std::memory_order_relaxed);
+    const float dry       = impl.dry.load(std::memory_order_relaxed);
+    const float inputGain = 1.f / static_cast<float>(processedChannelCount);
+
+    float* const lines        = impl.lines.data();
+    auto         lowPassState = base::F32x4::load(impl.lowPassState);
+
+    for (unsigned int i = 0u; i < frameCount; ++i, frames += channelCount)
+    {
+        // The network is fed with the mono sum of the input
+        float input = 0.f;
+
+        for (unsigned int channel = 0u; channel < processedChannelCount; ++channel)
+            input += frames[channel];
+
+        float taps[ReverbImpl::lineCount];
+
+        for (base::SizeT line = 0u; line < ReverbImpl::lineCount; ++line)
+            taps[line] = lines[impl.lineOffsets[line] + impl.linePositions[line]];
+
+        // One-pole low-pass on every line at once, absorbing high frequencies on each round trip
+        lowPassState = base::F32x4::mulAdd(lowPassCoefficient, base::F32x4::load(taps) - lowPassState, lowPassState);
+        lowPassState.store(taps);
+
+        // Orthonormal 4x4 Hadamard matrix, as two levels of butterflies
+        const float sum01  = taps[0] + taps[1];
+        const float diff01 = taps[0] - taps[1];
+        const float sum23  = taps[2] + taps[3];
+        const float diff23 = taps[2] - taps[3];
+
+        const float mixed[ReverbImpl::lineCount]{(sum01 + sum23) * 0.5f,
+                                                 (diff01 + diff23) * 0.5f,
+                                                 (sum01 - sum23) * 0.5f,
+                                                 (diff01 - diff23) * 0.5f};
+
+        float fedBack[ReverbImpl::lineCount];
+        base::F32x4::mulAdd(base::F32x4::load(mixed), feedback, base::F32x4::broadcast(input * inputGain))
+            .store(fedBack);
+
+        for (base::SizeT line = 0u; line < ReverbImpl::lineCount; ++line)
+        {
+            base::SizeT& position = impl.linePositions[line];
+
+            lines[impl.lineOffsets[line] + position] = fedBack[line];
+
+            if (++position == impl.lineLengths[line])
+                position = 0u;
+        }
+
+        // Even and odd channels hear different pairs of lines, which decorrelates them
+        const float outputs[2]{taps[0] + taps[2], taps[1] + taps[3]};
+
+        for (unsigned int channel = 0u; channel < processedChannelCount; ++channel)
+            frames[channel] = dry * frames[channel] + wet * outputs[channel & 1u];
+    }
+
+    lowPassState.store(impl.lowPassState);
+}
+
+} // namespace sf
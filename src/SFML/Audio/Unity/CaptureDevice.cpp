@@ -13,12 +13,16 @@
 
 #include "SFML/System/Err.hpp"
 
+#include "SFML/Base/Algorithm.hpp"
 #include "SFML/Base/Assert.hpp"
-#include "SFML/Base/Builtins/Memcpy.hpp"
+#include "SFML/Base/SpscQueue.hpp"
 #include "SFML/Base/TrivialVector.hpp"
 
 #include <miniaudio.h>
 
+#include <atomic>
+#include <thread>
+
 
 namespace sf
 {
@@ -29,20 +33,88 @@ struct CaptureDevice::Impl
     {
         auto& impl = *static_cast<Impl*>(device->pUserData);
 
-        // Copy the new samples into our temporary buffer
-        impl.samples.resize(frameCount * impl.channelCount);
-        SFML_BASE_MEMCPY(impl.samples.data(), input, frameCount * impl.channelCount * sizeof(base::I16));
+        // Nothing else is done on the audio thread: no allocation, no locking, no user code
+        if (impl.recorderStopRequested.load(std::memory_order_relaxed))
+            return;
+
+        const base::SizeT sampleCount = frameCount * impl.channelCount;
+
+        // Only store whole frames, so that channels stay interleaved correctly after an overrun
+        const base::SizeT freeFrameCount = (decltype(impl.ring)::capacity() - impl.ring.size()) / impl.channelCount;
+        const base::SizeT writtenCount   = base::min(sampleCount, freeFrameCount * impl.channelCount);
+
+        [[maybe_unused]] const base::SizeT pushedCount = impl.ring.tryPushBulk(static_cast<const base::I16*>(input),
+                                                                               writtenCount);
+        SFML_BASE_ASSERT(pushedCount == writtenCount);
+
+        if (writtenCount < sampleCount)
+        {
+            impl.overrunCount.fetch_add(1u, std::memory_order_relaxed);
+            impl.droppedSampleCount.fetch_add(sampleCount - writtenCount, std::memory_order_relaxed);
+        }
 
-        // Notify the derived class of the availability of new samples
-        SFML_BASE_ASSERT(impl.processSamplesFunc != nullptr &&
+        // Wake up the processing thread, if any
+        impl.captureSequence.fetch_add(1u, std::memory_order_release);
+
+        if (impl.useProcessingThread)
+            impl.captureSequence.notify_one();
+    }
+
+    [[nodiscard]] bool processCapturedSamples(bool flush)
+    {
+        SFML_BASE_ASSERT(processSamplesFunc != nullptr &&
                          "processSamplesFunc callback not registered in capture device");
-        SFML_BASE_ASSERT(impl.soundRecorder != nullptr && "processSamplesFunc callback user data is null");
-        if (impl.processSamplesFunc(impl.soundRecorder, impl.samples.data(), impl.samples.size()))
+        SFML_BASE_ASSERT(soundRecorder != nullptr && "processSamplesFunc callback user data is null");
+
+        if (recorderStopRequested.load(std::memory_order_relaxed))
+            return false;
+
+        while (ring.size() >= blockSampleCount || (flush && !ring.empty()))
+        {
+            const base::SizeT count = ring.tryPopBulk(block.data(), blockSampleCount);
+
+            // Notify the derived class of the availability of new samples
+            if (!processSamplesFunc(soundRecorder, block.data(), count))
+            {
+                recorderStopRequested.store(true, std::memory_order_relaxed);
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    void runProcessingThread()
+    {
+        while (!processingStopRequested.load(std::memory_order_acquire))
+        {
+            // Loaded before processing so that samples captured in the meantime are not missed
+            const unsigned int sequence = captureSequence.load(std::memory_order_acquire);
+
+            if (!processCapturedSamples(/* flush */ false))
+            {
+                // If the derived class wants to stop, stop the capture (not allowed from the miniaudio callback)
+                if (const auto result = ma_device_stop(&maDevice); result != MA_SUCCESS)
+                    priv::MiniaudioUtils::fail("stop audio capture device", result);
+
+                return;
+            }
+
+            captureSequence.wait(sequence, std::memory_order_acquire);
+        }
+    }
+
+    void stopProcessingThread()
+    {
+        if (!processingThread.joinable())
             return;
 
-        // If the derived class wants to stop, stop the capture
-        if (const auto result = ma_device_stop(device); result != MA_SUCCESS)
-            priv::MiniaudioUtils::fail("stop audio capture device", result);
+        processingStopRequested.store(true, std::memory_order_release);
+
+        captureSequence.fetch_add(1u, std::memory_order_release);
+        captureSequence.notify_one();
+
+        processingThread.join();
     }
 
     // NOLINTNEXTLINE(cppcoreguidelines-pro-type-member-init)
@@ -56,6 +128,7 @@ struct CaptureDevice::Impl
 
     ~Impl()
     {
+        stopProcessingThread();
         deinitialize();
     }
 
@@ -87,15 +160,26 @@ struct CaptureDevice::Impl
     ////////////////////////////////////////////////////////////
     // Member data
     ////////////////////////////////////////////////////////////
-    AudioContext*                  audioContext;        //!< Audio context
-    CaptureDeviceHandle            captureDeviceHandle; //!< Capture device handle
-    ma_uint32                      channelCount{1u};    //!< Number of recording channels
-    ma_uint32                      sampleRate{44100u};  //!< Sample rate
-    base::TrivialVector<base::I16> samples;             //!< Buffer to store captured samples
-    ChannelMap channelMap{SoundChannel::Mono};          //!< The map of position in sample frame to sound channel
-
-    SoundRecorder*     soundRecorder{nullptr}; //!< Used in the miniaudio device callback
-    ProcessSamplesFunc processSamplesFunc{};   //!< Used in the miniaudio device callback
+    AudioContext*       audioContext;                   //!< Audio context
+    CaptureDeviceHandle captureDeviceHandle;            //!< Capture device handle
+    ma_uint32           channelCount{1u};               //!< Number of recording channels
+    ma_uint32           sampleRate{44100u};             //!< Sample rate
+    ChannelMap          channelMap{SoundChannel::Mono}; //!< The map of position in sample frame to sound channel
+
+    SoundRecorder*     soundRecorder{nullptr}; //!< Passed to the "process samples" callback
+    ProcessSamplesFunc processSamplesFunc{};   //!< Receives the captured samples, block by block
+
+    base::SpscQueue<base::I16, 65'536> ring;                  //!< Written by the miniaudio callback only
+    base::TrivialVector<base::I16>     block;                 //!< Block handed to the "process samples" callback
+    base::SizeT                        blockSampleCount{};    //!< Number of samples per delivered block
+    bool                               useProcessingThread{}; //!< Whether `processingThread` delivers the blocks
+
+    std::atomic<base::U64>    overrunCount{0u};               //!< Number of callbacks that overflowed the ring
+    std::atomic<base::U64>    droppedSampleCount{0u};         //!< Number of samples that did not fit in the ring
+    std::atomic<unsigned int> captureSequence{0u};            //!< Bumped to wake up the processing thread
+    std::atomic<bool>         processingStopRequested{false}; //!< Set to ask the processing thread to exit
+    std::atomic<bool>         recorderStopRequested{false};   //!< Set once the recorder asked to stop the capture
+    std::thread               processingThread;               //!< Delivers the blocks if `useProcessingThread`
 
     ma_device maDevice; //!< miniaudio capture device (one per hardware device)
 };
@@ -191,30 +275,66 @@ unsigned int CaptureDevice::getSampleRate() const
 
 
 ////////////////////////////////////////////////////////////
-[[nodiscard]] bool CaptureDevice::startDevice() const
+[[nodiscard]] bool CaptureDevice::startDevice(base::SizeT blockSampleCount, bool useProcessingThread)
 {
     SFML_BASE_ASSERT(isDeviceInitialized() && "Attempted to start an uninitialized audio capture device");
     SFML_BASE_ASSERT(!isDeviceStarted() && "Attempted to start an already started audio capture device");
+    SFML_BASE_ASSERT(!m_impl->processingThread.joinable() && "Processing thread is still running");
+
+    SFML_BASE_ASSERT(blockSampleCount > 0u && blockSampleCount % m_impl->channelCount == 0u &&
+                     "Block size must be a non-zero multiple of the channel count");
+    SFML_BASE_ASSERT(blockSampleCount <= decltype(m_impl->ring)::capacity() / 4u && "Block size is too large");
+
+    // Everything the processing side uses is allocated here, before the miniaudio thread starts writing
+    m_impl->ring.discardAll();
+    m_impl->block.resize(blockSampleCount);
+    m_impl->blockSampleCount    = blockSampleCount;
+    m_impl->useProcessingThread = useProcessingThread;
+
+    m_impl->overrunCount.store(0u, std::memory_order_relaxed);
+    m_impl->droppedSampleCount.store(0u, std::memory_order_relaxed);
+    m_impl->processingStopRequested.store(false, std::memory_order_relaxed);
+    m_impl->recorderStopRequested.store(false, std::memory_order_relaxed);
+
+    if (useProcessingThread)
+        m_impl->processingThread = std::thread([impl = m_impl.get()] { impl->runProcessingThread(); });
 
     if (const auto result = ma_device_start(&m_impl->maDevice); result != MA_SUCCESS)
+    {
+        m_impl->stopProcessingThread();
         return priv::MiniaudioUtils::fail("start audio capture device", result);
+    }
 
     return true;
 }
 
 
 ////////////////////////////////////////////////////////////
-[[nodiscard]] bool CaptureDevice::stopDevice() const
+[[nodiscard]] bool CaptureDevice::stopDevice()
 {
     SFML_BASE_ASSERT(isDeviceInitialized() && "Attempted to stop an uninitialized audio capture device");
-    SFML_BASE_ASSERT(isDeviceStarted() && "Attempted to stop an already stopped audio capture device");
 
+    // The processing thread might have stopped the device on its own, so it must be joined first
+    m_impl->stopProcessingThread();
+
+    // Does nothing if the device is already stopped
     if (const auto result = ma_device_stop(&m_impl->maDevice); result != MA_SUCCESS)
         return priv::MiniaudioUtils::fail("stop audio capture device", result);
 
     return true;
 }
 
+
+////////////////////////////////////////////////////////////
+[[nodiscard]] bool CaptureDevice::processCapturedSamples(bool flush)
+{
+    SFML_BASE_ASSERT((flush || !m_impl->useProcessingThread) &&
+                     "Captured samples are already being processed on a dedicated thread");
+
+    return m_impl->processCapturedSamples(flush);
+}
+
+
 ////////////////////////////////////////////////////////////
 bool CaptureDevice::setChannelCount(unsigned int channelCount)
 {
@@ -268,6 +388,20 @@ const ChannelMap& CaptureDevice::getChannelMap() const
 }
 
 
+////////////////////////////////////////////////////////////
+base::U64 CaptureDevice::getOverrunCount() const
+{
+    return m_impl->overrunCount.load(std::memory_order_relaxed);
+}
+
+
+////////////////////////////////////////////////////////////
+base::U64 CaptureDevice::getDroppedSampleCount() const
+{
+    return m_impl->droppedSampleCount.load(std::memory_order_relaxed);
+}
+
+
 ////////////////////////////////////////////////////////////
 void CaptureDevice::setProcessSamplesFunc(SoundRecorder* soundRecorder, ProcessSamplesFunc processSamplesFunc)
 {
@@ -7,6 +7,7 @@
 #include "SFML/Audio/MiniaudioUtils.hpp"
 #include "SFML/Audio/PlaybackDevice.hpp"
 #include "SFML/Audio/SavedSettings.hpp"
+#include "SFML/Audio/SoundBus.hpp"
 #include "SFML/Audio/SoundChannel.hpp"
 
 #include "SFML/System/Err.hpp"
@@ -40,6 +41,7 @@ struct MiniaudioUtils::SoundBase::Impl
     ma_data_source_base dataSourceBase{}; //!< The struct that makes this object a miniaudio data source (must be first member)
 
     PlaybackDevice* playbackDevice;
+    SoundBus*       bus{}; //!< Submix bus the sound is routed into, `nullptr` for the engine endpoint
 
     ma_node_vtable effectNodeVTable{};               //!< Vtable of the effect node
     EffectNode     effectNode;                       //!< The engine node that performs effect processing
@@ -77,6 +79,10 @@ impl(thePlaybackDevice)
             static_cast<SoundBase*>(ptr)->impl->playbackDevice     = &newPlaybackDevice;
             static_cast<SoundBase*>(ptr)->impl->resourceEntryIndex = newIndex;
 
+            // Buses belong to a single device, so follow the bus with the same name on the new one
+            if (SoundBus*& bus = static_cast<SoundBase*>(ptr)->impl->bus; bus != nullptr)
+                bus = newPlaybackDevice.findBus(bus->getName());
+
             SFML_UPDATE_LIFETIME_DEPENDANT(PlaybackDevice,
                                            SoundBase,
                                            static_cast<SoundBase*>(ptr),
@@ -204,11 +210,14 @@ void MiniaudioUtils::SoundBase::connectEffect(bool connect)
 {
     auto* engine = static_cast<ma_engine*>(impl->playbackDevice->getMAEngine());
 
+    // The sound is mixed into its submix bus if it has one, otherwise directly into the engine endpoint
+    auto* output = impl->bus != nullptr ? static_cast<ma_node*>(impl->bus->getMAInputNode())
+                                        : ma_engine_get_endpoint(engine);
+
     if (connect)
     {
-        // Attach the custom effect node output to our engine endpoint
-        if (const ma_result result = ma_node_attach_output_bus(&impl->effectNode, 0, ma_engine_get_endpoint(engine), 0);
-            result != MA_SUCCESS)
+        // Attach the custom effect node output to our bus or engine endpoint
+        if (const ma_result result = ma_node_attach_output_bus(&impl->effectNode, 0, output, 0); result != MA_SUCCESS)
         {
             fail("attach effect node output to endpoint", result);
             return;
@@ -216,7 +225,7 @@ void MiniaudioUtils::SoundBase::connectEffect(bool connect)
     }
     else
     {
-        // Detach the custom effect node output from our engine endpoint
+        // Detach the custom effect node output from our bus or engine endpoint
         if (const ma_result result = ma_node_detach_output_bus(&impl->effectNode, 0); result != MA_SUCCESS)
         {
             fail("detach effect node output from endpoint", result);
@@ -224,11 +233,8 @@ void MiniaudioUtils::SoundBase::connectEffect(bool connect)
         }
     }
 
-    // Attach the sound output to the custom effect node or the engine endpoint
-    if (const ma_result result = ma_node_attach_output_bus(&impl->sound,
-                                                           0,
-                                                           connect ? &impl->effectNode : ma_engine_get_endpoint(engine),
-                                                           0);
+    // Attach the sound output to the custom effect node or the bus or engine endpoint
+    if (const ma_result result = ma_node_attach_output_bus(&impl->sound, 0, connect ? &impl->effectNode : output, 0);
         result != MA_SUCCESS)
     {
         fail("attach sound node output to effect node", result);
@@ -273,6 +279,23 @@ void MiniaudioUtils::SoundBase::setAndConnectEffectProcessor(EffectProcessor eff
 }
 
 
+////////////////////////////////////////////////////////////
+void MiniaudioUtils::SoundBase::setBus(SoundBus* bus)
+{
+    SFML_BASE_ASSERT((bus == nullptr || bus->getMAEngine() == impl->playbackDevice->getMAEngine()) &&
+                     "The bus must belong to the playback device the sound is played on");
+
+    impl->bus = bus;
+}
+
+
+////////////////////////////////////////////////////////////
+SoundBus* MiniaudioUtils::SoundBase::getBus() const
+{
+    return impl->bus;
+}
+
+
 ////////////////////////////////////////////////////////////
 base::U8 MiniaudioUtils::soundChannelToMiniaudioChannel(SoundChannel soundChannel)
 {
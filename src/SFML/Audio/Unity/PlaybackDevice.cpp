@@ -9,6 +9,7 @@
 #include "SFML/Audio/MiniaudioUtils.hpp"
 #include "SFML/Audio/PlaybackDevice.hpp"
 #include "SFML/Audio/PlaybackDeviceHandle.hpp"
+#include "SFML/Audio/SoundBus.hpp"
 
 #include "SFML/System/Err.hpp"
 #include "SFML/System/LifetimeDependant.hpp"
@@ -16,13 +17,17 @@
 
 #include "SFML/Base/Algorithm.hpp"
 #include "SFML/Base/Assert.hpp"
+#include "SFML/Base/Macros.hpp"
 #include "SFML/Base/Optional.hpp"
+#include "SFML/Base/PassKey.hpp"
 #include "SFML/Base/TrivialVector.hpp"
 #include "SFML/Base/UniquePtr.hpp"
 
 #include <miniaudio.h>
 
 #include <mutex>
+#include <string>
+#include <vector>
 
 
 namespace sf
@@ -49,6 +54,10 @@ struct PlaybackDevice::Impl
 
     ~Impl()
     {
+        // Buses are destroyed in reverse order of creation, children before their parents
+        while (!buses.empty())
+            buses.pop_back();
+
         ma_engine_uninit(&maEngine);
         ma_device_uninit(&maDevice);
     }
@@ -92,6 +101,8 @@ struct PlaybackDevice::Impl
     base::TrivialVector<ResourceEntry> resources;      //!< Registered resources
     std::mutex                         resourcesMutex; //!< The mutex guarding the registered resources
 
+    std::vector<base::UniquePtr<SoundBus>> buses; //!< Submix buses owned by the device, in order of creation
+
     ma_device maDevice; //!< miniaudio playback device (one per hardware device)
     ma_engine maEngine; //!< miniaudio engine (one per hardware device, for effects/spatialization)
 };
@@ -198,6 +209,53 @@ void PlaybackDevice::transferResourcesTo(PlaybackDevice& other)
 }
 
 
+////////////////////////////////////////////////////////////
+unsigned int PlaybackDevice::getSampleRate() const
+{
+    return ma_engine_get_sample_rate(&m_impl->maEngine);
+}
+
+
+////////////////////////////////////////////////////////////
+unsigned int PlaybackDevice::getChannelCount() const
+{
+    return ma_engine_get_channels(&m_impl->maEngine);
+}
+
+
+////////////////////////////////////////////////////////////
+SoundBus* PlaybackDevice::createBus(base::StringView name, SoundBus* parent)
+{
+    SFML_BASE_ASSERT((parent == nullptr || parent->getMAEngine() == &m_impl->maEngine) &&
+                     "The parent bus must belong to the same playback device");
+
+    if (findBus(name) != nullptr)
+    {
+        priv::err() << "Failed to create sound bus: a bus named \"" << std::string(name.data(), name.size())
+                    << "\" already exists";
+        return nullptr;
+    }
+
+    auto bus = base::makeUnique<SoundBus>(base::PassKey<PlaybackDevice>{}, &m_impl->maEngine, name, parent);
+
+    if (!bus->initialize())
+        return nullptr;
+
+    return m_impl->buses.emplace_back(SFML_BASE_MOVE(bus)).get();
+}
+
+
+////////////////////////////////////////////////////////////
+SoundBus* PlaybackDevice::findBus(base::StringView name) const
+{
+    for (const base::UniquePtr<SoundBus>& bus : m_impl->buses)
+        if (bus->getName() == name)
+            return bus.get();
+
+    return nullptr;
+}
+
+
 ////////////////////////////////////////////////////////////
 PlaybackDevice::ResourceEntryIndex PlaybackDevice::registerResource(
     void*                       resource,
@@ -37,6 +37,9 @@ struct Sound::Impl
         if (!soundBase->initialize(&onEnd))
             priv::err() << "Failed to initialize Sound::Impl";
 
+        // After a transfer to another playback device, the sound base routes into the bus with the same name
+        owner->SoundSource::setBus(soundBase->getBus());
+
         // Because we are providing a custom data source, we have to provide the channel map ourselves
         if (buffer == nullptr || buffer->getChannelMap().isEmpty())
         {
@@ -256,6 +259,7 @@ void Sound::play(PlaybackDevice& playbackDevice)
     if (!m_impl->soundBase.hasValue())
     {
         m_impl->soundBase.emplace(playbackDevice, &Impl::vtable, [](void* ptr) { static_cast<Impl*>(ptr)->initialize(); });
+        m_impl->soundBase->setBus(getBus());
         m_impl->initialize();
 
         SFML_BASE_ASSERT(m_impl->soundBase.hasValue());
@@ -372,6 +376,19 @@ void Sound::setEffectProcessor(EffectProcessor effectProcessor)
 }
 
 
+////////////////////////////////////////////////////////////
+void Sound::setBus(SoundBus* bus)
+{
+    SoundSource::setBus(bus);
+
+    if (!m_impl->soundBase.hasValue())
+        return;
+
+    m_impl->soundBase->setBus(bus);
+    m_impl->soundBase->connectEffect(bool{getEffectProcessor()});
+}
+
+
 ////////////////////////////////////////////////////////////
 const SoundBuffer& Sound::getBuffer() const
 {
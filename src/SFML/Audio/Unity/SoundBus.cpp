@@ -0,0 +1,253 @@
+#include <SFML/Copyright.hpp> // LICENSE AND COPYRIGHT (C) INFORMATION
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include "SFML/Audio/EffectProcessor.hpp"
+#include "SFML/Audio/MiniaudioUtils.hpp"
+#include "SFML/Audio/SoundBus.hpp"
+
+#include "SFML/Base/Algorithm.hpp"
+#include "SFML/Base/Builtins/Memcpy.hpp"
+#include "SFML/Base/Macros.hpp"
+
+#include <miniaudio.h>
+
+#include <string>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+struct SoundBus::Impl
+{
+    struct EffectNode
+    {
+        ma_node_base base{};
+        Impl*        impl{};
+        ma_uint32    channelCount{};
+    };
+
+    explicit Impl(ma_engine& theMAEngine, base::StringView theName, SoundBus* theParent) :
+    maEngine(&theMAEngine),
+    name(theName.data(), theName.size()),
+    parent(theParent)
+    {
+    }
+
+    static void onProcess(ma_node*      node,
+                          const float** framesIn,
+                          ma_uint32*    frameCountIn,
+                          float**       framesOut,
+                          ma_uint32*    frameCountOut)
+    {
+        const EffectNode& effectNode = *static_cast<EffectNode*>(node);
+
+        // If a processor is set, call it
+        if (effectNode.impl->effectProcessor)
+        {
+            if (!framesIn)
+                *frameCountIn = 0;
+
+            effectNode.impl->effectProcessor(framesIn ? framesIn[0] : nullptr,
+                                             *frameCountIn,
+                                             framesOut[0],
+                                             *frameCountOut,
+                                             effectNode.channelCount);
+            return;
+        }
+
+        // Otherwise just pass the data through 1:1
+        if (framesIn == nullptr)
+        {
+            *frameCountIn  = 0;
+            *frameCountOut = 0;
+            return;
+        }
+
+        const auto toProcess = base::min(*frameCountIn, *frameCountOut);
+        SFML_BASE_MEMCPY(framesOut[0], framesIn[0], toProcess * effectNode.channelCount * sizeof(float));
+        *frameCountIn  = toProcess;
+        *frameCountOut = toProcess;
+    }
+
+    [[nodiscard]] ma_node* getOutputNode() const
+    {
+        return parent != nullptr ? static_cast<ma_node*>(parent->getMAInputNode()) : ma_engine_get_endpoint(maEngine);
+    }
+
+    ma_engine*  maEngine; //!< miniaudio engine of the playback device owning the bus
+    std::string name;     //!< Name of the bus, used to find it on the playback device
+    SoundBus*   parent;   //!< Bus this bus is mixed into, `nullptr` for the device output
+
+    ma_sound_group  group{};            //!< Mixes the inputs and applies the volume
+    ma_node_vtable  effectNodeVTable{}; //!< Vtable of the effect node
+    EffectNode      effectNode;         //!< The engine node that performs effect processing
+    EffectProcessor effectProcessor;    //!< The effect processor
+    float           volume{1.f};        //!< Volume of the bus, in the range [0, 1]
+
+    bool groupInitialized{};      //!< Whether `group` must be uninitialized
+    bool effectNodeInitialized{}; //!< Whether `effectNode` must be uninitialized
+};
+
+
+////////////////////////////////////////////////////////////
+SoundBus::SoundBus(base::PassKey<PlaybackDevice>&&, void* maEngine, base::StringView name, SoundBus* parent) :
+m_impl(base::makeUnique<Impl>(*static_cast<ma_engine*>(maEngine), name, parent))
+{
+}
+
+
+////////////////////////////////////////////////////////////
+SoundBus::~SoundBus()
+{
+    if (m_impl->groupInitialized)
+        ma_sound_group_uninit(&m_impl->group);
+
+    if (m_impl->effectNodeInitialized)
+        ma_node_uninit(&m_impl->effectNode, nullptr);
+}
+
+
+////////////////////////////////////////////////////////////
+base::StringView SoundBus::getName() const
+{
+    return m_impl->name;
+}
+
+
+////////////////////////////////////////////////////////////
+SoundBus* SoundBus::getParent() const
+{
+    return m_impl->parent;
+}
+
+
+////////////////////////////////////////////////////////////
+void SoundBus::setVolume(float volume)
+{
+    m_impl->volume = volume * 0.01f;
+
+    if (m_impl->groupInitialized)
+        ma_sound_group_set_volume(&m_impl->group, m_impl->volume);
+}
+
+
+////////////////////////////////////////////////////////////
+float SoundBus::getVolume() const
+{
+    return m_impl->volume * 100.f;
+}
+
+
+////////////////////////////////////////////////////////////
+void SoundBus::setEffectProcessor(EffectProcessor effectProcessor)
+{
+    m_impl->effectProcessor = SFML_BASE_MOVE(effectProcessor);
+    connectEffect(bool{m_impl->effectProcessor});
+}
+
+
+////////////////////////////////////////////////////////////
+EffectProcessor SoundBus::getEffectProcessor() const
+{
+    // NOLINTNEXTLINE(modernize-return-braced-init-list)
+    return m_impl->effectProcessor;
+}
+
+
+////////////////////////////////////////////////////////////
+bool SoundBus::initialize()
+{
+    // Spatialization and pitch are per-source concerns, the group only mixes and applies the volume
+    if (const ma_result result = ma_sound_group_init(m_impl->maEngine,
+                                                     MA_SOUND_FLAG_NO_SPATIALIZATION | MA_SOUND_FLAG_NO_PITCH,
+                                                     nullptr,
+                                                     &m_impl->group);
+        result != MA_SUCCESS)
+        return priv::MiniaudioUtils::fail("initialize sound bus group", result);
+
+    m_impl->groupInitialized = true;
+
+    // Initialize the custom effect node
+    m_impl->effectNodeVTable.onProcess                    = &Impl::onProcess;
+    m_impl->effectNodeVTable.onGetRequiredInputFrameCount = nullptr;
+    m_impl->effectNodeVTable.inputBusCount                = 1;
+    m_impl->effectNodeVTable.outputBusCount               = 1;
+    m_impl->effectNodeVTable.flags = MA_NODE_FLAG_CONTINUOUS_PROCESSING | MA_NODE_FLAG_ALLOW_NULL_INPUT;
+
+    const auto     nodeChannelCount = ma_engine_get_channels(m_impl->maEngine);
+    ma_node_config nodeConfig       = ma_node_config_init();
+    nodeConfig.vtable               = &m_impl->effectNodeVTable;
+    nodeConfig.pInputChannels       = &nodeChannelCount;
+    nodeConfig.pOutputChannels      = &nodeChannelCount;
+
+    if (const ma_result result = ma_node_init(ma_engine_get_node_graph(m_impl->maEngine),
+                                              &nodeConfig,
+                                              nullptr,
+                                              &m_impl->effectNode);
+        result != MA_SUCCESS)
+        return priv::MiniaudioUtils::fail("initialize sound bus effect node", result);
+
+    m_impl->effectNodeInitialized   = true;
+    m_impl->effectNode.impl         = m_impl.get();
+    m_impl->effectNode.channelCount = nodeChannelCount;
+
+    connectEffect(false);
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+void* SoundBus::getMAEngine() const
+{
+    return m_impl->maEngine;
+}
+
+
+////////////////////////////////////////////////////////////
+void* SoundBus::getMAInputNode() const
+{
+    return &m_impl->group;
+}
+
+
+////////////////////////////////////////////////////////////
+void SoundBus::connectEffect(bool connect)
+{
+    if (!m_impl->effectNodeInitialized)
+        return;
+
+    if (connect)
+    {
+        // Attach the custom effect node output to the parent bus or the engine endpoint
+        if (const ma_result result = ma_node_attach_output_bus(&m_impl->effectNode, 0, m_impl->getOutputNode(), 0);
+            result != MA_SUCCESS)
+        {
+            priv::MiniaudioUtils::fail("attach sound bus effect node output", result);
+            return;
+        }
+    }
+    else
+    {
+        // Detach the custom effect node output, nothing flows through it
+        if (const ma_result result = ma_node_detach_output_bus(&m_impl->effectNode, 0); result != MA_SUCCESS)
+        {
+            priv::MiniaudioUtils::fail("detach sound bus effect node output", result);
+            return;
+        }
+    }
+
+    // Attach the group output to the custom effect node, or directly to the parent bus or the engine endpoint
+    if (const ma_result result = ma_node_attach_output_bus(&m_impl->group,
+                                                           0,
+                                                           connect ? &m_impl->effectNode : m_impl->getOutputNode(),
+                                                           0);
+        result != MA_SUCCESS)
+    {
+        priv::MiniaudioUtils::fail("attach sound bus group output", result);
+        return;
+    }
+}
+
+} // namespace sf
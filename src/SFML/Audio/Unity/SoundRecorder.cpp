@@ -52,9 +52,19 @@ bool SoundRecorder::start(CaptureDevice& captureDevice, unsigned int sampleRate)
     if (!onStart(captureDevice))
         return false;
 
+    // Must be registered before the processing thread starts
+    captureDevice.setProcessSamplesFunc(this,
+                                        [](void* userData, const base::I16* samples, base::SizeT sampleCount) {
+                                            return static_cast<SoundRecorder*>(userData)->onProcessSamples(samples,
+                                                                                                           sampleCount);
+                                        });
+
     // Start the capture
-    if (!captureDevice.startDevice())
+    if (!captureDevice.startDevice(m_blockSize * captureDevice.getChannelCount(),
+                                   m_processingMode == ProcessingMode::Thread))
     {
+        captureDevice.setProcessSamplesFunc(nullptr, nullptr);
+
         priv::err() << "Failed to start sound recorder";
         return false;
     }
@@ -62,12 +72,6 @@ bool SoundRecorder::start(CaptureDevice& captureDevice, unsigned int sampleRate)
     m_lastCaptureDevice = &captureDevice;
     SFML_UPDATE_LIFETIME_DEPENDANT(CaptureDevice, SoundRecorder, this, m_lastCaptureDevice);
 
-    captureDevice.setProcessSamplesFunc(this,
-                                        [](void* userData, const base::I16* samples, base::SizeT sampleCount) {
-                                            return static_cast<SoundRecorder*>(userData)->onProcessSamples(samples,
-                                                                                                           sampleCount);
-                                        });
-
     return true;
 }
 
@@ -81,12 +85,21 @@ bool SoundRecorder::stop()
     auto* const savedCaptureDevice = m_lastCaptureDevice;
     m_lastCaptureDevice            = nullptr;
 
-    savedCaptureDevice->setProcessSamplesFunc(nullptr, nullptr);
-
-    if (!savedCaptureDevice->isDeviceInitialized() || !savedCaptureDevice->isDeviceStarted())
+    if (!savedCaptureDevice->isDeviceInitialized())
+    {
+        savedCaptureDevice->setProcessSamplesFunc(nullptr, nullptr);
         return false;
+    }
 
-    if (!savedCaptureDevice->stopDevice())
+    // Also joins the processing thread, so nothing else is delivered concurrently from now on
+    const bool stopped = savedCaptureDevice->stopDevice();
+
+    // Deliver the remaining samples, including the last incomplete block
+    [[maybe_unused]] const bool flushed = savedCaptureDevice->processCapturedSamples(/* flush */ true);
+
+    savedCaptureDevice->setProcessSamplesFunc(nullptr, nullptr);
+
+    if (!stopped)
     {
         priv::err() << "Failed to stop sound recorder";
         return false;
@@ -97,6 +110,55 @@ bool SoundRecorder::stop()
 }
 
 
+////////////////////////////////////////////////////////////
+bool SoundRecorder::poll()
+{
+    SFML_BASE_ASSERT(m_processingMode == ProcessingMode::Poll &&
+                     "SoundRecorder::poll() can only be used with ProcessingMode::Poll");
+
+    if (m_lastCaptureDevice == nullptr) // Not capturing
+        return false;
+
+    if (m_lastCaptureDevice->processCapturedSamples(/* flush */ false))
+        return true;
+
+    // The derived class wants to stop
+    if (!stop())
+        priv::err() << "Failed to stop sound recorder after processing samples";
+
+    return false;
+}
+
+
+////////////////////////////////////////////////////////////
+void SoundRecorder::setProcessingMode(ProcessingMode processingMode)
+{
+    m_processingMode = processingMode;
+}
+
+
+////////////////////////////////////////////////////////////
+SoundRecorder::ProcessingMode SoundRecorder::getProcessingMode() const
+{
+    return m_processingMode;
+}
+
+
+////////////////////////////////////////////////////////////
+void SoundRecorder::setBlockSize(base::SizeT frameCount)
+{
+    SFML_BASE_ASSERT(frameCount > 0u && frameCount <= 8192u && "Block size must be between 1 and 8192 sample frames");
+    m_blockSize = frameCount;
+}
+
+
+////////////////////////////////////////////////////////////
+base::SizeT SoundRecorder::getBlockSize() const
+{
+    return m_blockSize;
+}
+
+
 ////////////////////////////////////////////////////////////
 bool SoundRecorder::onStart(CaptureDevice&)
 {
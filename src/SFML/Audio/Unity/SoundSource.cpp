@@ -22,6 +22,7 @@ struct SoundSource::Impl
 {
     priv::SavedSettings savedSettings;
     EffectProcessor     effectProcessor{};
+    SoundBus*           bus{};
     Time                playingOffset;
 };
 
@@ -215,6 +216,13 @@ void SoundSource::setEffectProcessor(EffectProcessor effectProcessor)
 }
 
 
+////////////////////////////////////////////////////////////
+void SoundSource::setBus(SoundBus* bus)
+{
+    m_impl->bus = bus;
+}
+
+
 ////////////////////////////////////////////////////////////
 void SoundSource::setLooping(bool loop)
 {
@@ -356,6 +364,13 @@ EffectProcessor SoundSource::getEffectProcessor() const
 }
 
 
+////////////////////////////////////////////////////////////
+SoundBus* SoundSource::getBus() const
+{
+    return m_impl->bus;
+}
+
+
 ////////////////////////////////////////////////////////////
 bool SoundSource::isLooping() const
 {
@@ -390,6 +405,7 @@ SoundSource& SoundSource::operator=(const SoundSource& right)
     setMaxGain(right.getMaxGain());
     setAttenuation(right.getAttenuation());
     setEffectProcessor(right.getEffectProcessor());
+    setBus(right.getBus());
     setLooping(right.isLooping());
     setPlayingOffset(right.getPlayingOffset());
 
@@ -38,6 +38,9 @@ struct SoundStream::Impl
         if (!soundBase->initialize(&onEnd))
             priv::err() << "Failed to initialize SoundStream::Impl";
 
+        // After a transfer to another playback device, the sound base routes into the bus with the same name
+        owner->SoundSource::setBus(soundBase->getBus());
+
         // Because we are providing a custom data source, we have to provide the channel map ourselves
         if (channelMap.isEmpty())
         {
@@ -262,6 +265,7 @@ void SoundStream::play(PlaybackDevice& playbackDevice)
     if (!m_impl->soundBase.hasValue())
     {
         m_impl->soundBase.emplace(playbackDevice, &Impl::vtable, [](void* ptr) { static_cast<Impl*>(ptr)->initialize(); });
+        m_impl->soundBase->setBus(getBus());
         m_impl->initialize();
 
         SFML_BASE_ASSERT(m_impl->soundBase.hasValue());
@@ -392,6 +396,19 @@ void SoundStream::setEffectProcessor(EffectProcessor effectProcessor)
 }
 
 
+////////////////////////////////////////////////////////////
+void SoundStream::setBus(SoundBus* bus)
+{
+    SoundSource::setBus(bus);
+
+    if (!m_impl->soundBase.hasValue())
+        return;
+
+    m_impl->soundBase->setBus(bus);
+    m_impl->soundBase->connectEffect(bool{getEffectProcessor()});
+}
+
+
 ////////////////////////////////////////////////////////////
 base::Optional<base::U64> SoundStream::onLoop()
 {
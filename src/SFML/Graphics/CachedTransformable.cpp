@@ -0,0 +1,87 @@
+#include <SFML/Copyright.hpp> // LICENSE AND COPYRIGHT (C) INFORMATION
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include "SFML/Graphics/CachedTransformable.hpp"
+
+#include "SFML/Base/FastSinCos.hpp"
+#include "SFML/Base/SizeT.hpp"
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+CachedTransformable::CachedTransformable(const Transformable& transformable) :
+m_components{transformable},
+m_transformDirty{true},
+m_inverseTransformDirty{true}
+{
+}
+
+
+////////////////////////////////////////////////////////////
+void CachedTransformable::updateTransforms(base::Span<CachedTransformable> transformables)
+{
+    constexpr base::SizeT batchSize = 8u;
+
+    CachedTransformable* pending[batchSize]{};
+    float                radians[batchSize]{};
+    float                sines[batchSize];
+    float                cosines[batchSize];
+    base::SizeT          pendingCount = 0u;
+
+    const auto flush = [&]
+    {
+        base::fastSinCos8(radians, sines, cosines);
+
+        for (base::SizeT i = 0u; i < pendingCount; ++i)
+        {
+            const Transformable& components = pending[i]->m_components;
+
+            pending[i]->m_transform = priv::makeTransformableTransform(components.position,
+                                                                       components.scale,
+                                                                       components.origin,
+                                                                       sines[i],
+                                                                       cosines[i]);
+
+            pending[i]->m_transformDirty = false;
+        }
+
+        pendingCount = 0u;
+    };
+
+    for (CachedTransformable& transformable : transformables)
+    {
+        if (!transformable.m_transformDirty)
+            continue;
+
+        pending[pendingCount] = &transformable;
+        radians[pendingCount] = transformable.m_components.rotation.asRadians();
+
+        if (++pendingCount == batchSize)
+            flush();
+    }
+
+    // The unused lanes still hold angles of the previous batch, which are harmless
+    if (pendingCount > 0u)
+        flush();
+}
+
+
+////////////////////////////////////////////////////////////
+void CachedTransformable::updateTransform() const
+{
+    m_transform      = m_components.getTransform();
+    m_transformDirty = false;
+}
+
+
+////////////////////////////////////////////////////////////
+void CachedTransformable::updateInverseTransform() const
+{
+    m_inverseTransform      = getTransform().getInverse();
+    m_inverseTransformDirty = false;
+}
+
+} // namespace sf
@@ -14,14 +14,22 @@
 
 namespace
 {
+////////////////////////////////////////////////////////////
+[[nodiscard, gnu::always_inline, gnu::flatten, gnu::const]] inline constexpr float computeCircleAngle(
+    const sf::base::SizeT index,
+    const unsigned int    pointCount)
+{
+    return static_cast<float>(index) / static_cast<float>(pointCount) * sf::base::tau;
+}
+
+
 ////////////////////////////////////////////////////////////
 [[nodiscard, gnu::always_inline, gnu::flatten, gnu::const]] inline constexpr sf::Vector2f computeCirclePoint(
     const sf::base::SizeT index,
     const unsigned int    pointCount,
     const float           radius)
 {
-    const float radians       = static_cast<float>(index) / static_cast<float>(pointCount) * sf::base::tau;
-    const auto [sine, cosine] = sf::base::fastSinCos(radians);
+    const auto [sine, cosine] = sf::base::fastSinCos(computeCircleAngle(index, pointCount));
     return {radius * (1.f + sine), radius * (1.f + cosine)};
 }
 
@@ -97,9 +105,21 @@ void CircleShape::updateCircleGeometry()
     if (!Shape::updateImplResizeVerticesVector(m_pointCount)) [[unlikely]]
         return;
 
-    // Position
-    for (unsigned int i = 0u; i < m_pointCount; ++i)
-        m_vertices[i + 1].position = computeCirclePoint(i, m_pointCount, m_radius);
+    // Position, computing the sines and cosines of eight points at once
+    float radians[8];
+    float sines[8];
+    float cosines[8];
+
+    for (unsigned int i = 0u; i < m_pointCount; i += 8u)
+    {
+        for (unsigned int j = 0u; j < 8u; ++j)
+            radians[j] = computeCircleAngle(i + j, m_pointCount);
+
+        base::fastSinCos8(radians, sines, cosines);
+
+        for (unsigned int j = 0u; j < 8u && i + j < m_pointCount; ++j)
+            m_vertices[i + j + 1].position = {m_radius * (1.f + sines[j]), m_radius * (1.f + cosines[j])};
+    }
 
     Shape::updateImplFromVerticesPositions(m_pointCount);
 }
@@ -5,6 +5,7 @@
 ////////////////////////////////////////////////////////////
 #include "SFML/Graphics/DrawableBatch.hpp"
 #include "SFML/Graphics/DrawableBatchUtils.hpp"
+#include "SFML/Graphics/Font.hpp"
 #include "SFML/Graphics/GLPersistentBuffer.hpp"
 #include "SFML/Graphics/RenderTarget.hpp"
 #include "SFML/Graphics/Shape.hpp"
@@ -46,6 +47,8 @@ IndexType* PersistentGPUStorage::reserveMoreIndices(base::SizeT count)
 template <typename TStorage>
 void DrawableBatchImpl<TStorage>::addTriangles(const Transform& transform, const Vertex* data, base::SizeT size)
 {
+    setCurrentTexture(nullptr);
+
     appendIncreasingIndices(static_cast<IndexType>(size), m_storage.getNumVertices(), m_storage.reserveMoreIndices(size));
     m_storage.commitMoreIndices(size);
 
@@ -58,6 +61,10 @@ void DrawableBatchImpl<TStorage>::addTriangles(const Transform& transform, const
 template <typename TStorage>
 void DrawableBatchImpl<TStorage>::add(const Text& text)
 {
+    setCurrentTexture(nullptr);
+
+    m_sdfText |= text.getFont().isSdf();
+
     const auto [data, size] = text.getVertices();
     SFML_BASE_ASSERT(size % 6u == 0);
 
@@ -79,7 +86,44 @@ void DrawableBatchImpl<TStorage>::add(const Text& text)
 template <typename TStorage>
 void DrawableBatchImpl<TStorage>::add(const Sprite& sprite)
 {
+    setCurrentTexture(nullptr);
+
     appendSpriteIndicesAndVertices(sprite,
+                                   sprite.getTransform(),
+                                   m_storage.getNumVertices(),
+                                   m_storage.reserveMoreIndices(6u),
+                                   m_storage.reserveMoreVertices(4u));
+
+    m_storage.commitMoreIndices(6u);
+    m_storage.commitMoreVertices(4u);
+}
+
+
+////////////////////////////////////////////////////////////
+template <typename TStorage>
+void DrawableBatchImpl<TStorage>::add(const Sprite& sprite, const Texture& texture)
+{
+    setCurrentTexture(&texture);
+
+    appendSpriteIndicesAndVertices(sprite,
+                                   sprite.getTransform(),
+                                   m_storage.getNumVertices(),
+                                   m_storage.reserveMoreIndices(6u),
+                                   m_storage.reserveMoreVertices(4u));
+
+    m_storage.commitMoreIndices(6u);
+    m_storage.commitMoreVertices(4u);
+}
+
+
+////////////////////////////////////////////////////////////
+template <typename TStorage>
+void DrawableBatchImpl<TStorage>::add(const Sprite& sprite, const Transform& transform)
+{
+    setCurrentTexture(nullptr);
+
+    appendSpriteIndicesAndVertices(sprite,
+                                   transform,
                                    m_storage.getNumVertices(),
                                    m_storage.reserveMoreIndices(6u),
                                    m_storage.reserveMoreVertices(4u));
@@ -93,6 +137,8 @@ void DrawableBatchImpl<TStorage>::add(const Sprite& sprite)
 template <typename TStorage>
 void DrawableBatchImpl<TStorage>::add(const Shape& shape)
 {
+    setCurrentTexture(nullptr);
+
     const auto transform = shape.getTransform();
 
     if (const auto [fillData, fillSize] = shape.getFillVertices(); fillSize > 2u)
@@ -128,6 +174,31 @@ template <typename TStorage>
 void DrawableBatchImpl<TStorage>::clear()
 {
     m_storage.clear();
+    m_textureRuns.clear();
+    m_sdfText = false;
+}
+
+
+////////////////////////////////////////////////////////////
+template <typename TStorage>
+void DrawableBatchImpl<TStorage>::setCurrentTexture(const Texture* texture)
+{
+    // Fast path: batches that never received a texture are drawn in one call, without runs
+    if (m_textureRuns.empty())
+    {
+        if (texture == nullptr)
+            return;
+
+        // Geometry added so far keeps using the texture of the render states
+        if (m_storage.getNumIndices() > 0u)
+            m_textureRuns.pushBack(TextureRun{nullptr, IndexType{0u}});
+    }
+    else if (m_textureRuns[m_textureRuns.size() - 1u].texture == texture)
+    {
+        return;
+    }
+
+    m_textureRuns.pushBack(TextureRun{texture, m_storage.getNumIndices()});
 }
 
 
@@ -71,13 +71,14 @@ using IndexType = unsigned int;
 
 ////////////////////////////////////////////////////////////
 [[gnu::always_inline, gnu::flatten]] inline constexpr void appendSpriteIndicesAndVertices(
-    const Sprite&   sprite,
-    const IndexType nextIndex,
-    IndexType*      indexPtr,
-    Vertex* const   vertexPtr) noexcept
+    const Sprite&    sprite,
+    const Transform& transform,
+    const IndexType  nextIndex,
+    IndexType*       indexPtr,
+    Vertex* const    vertexPtr) noexcept
 {
     appendQuadIndices(indexPtr, nextIndex);
-    priv::spriteToVertices(sprite, vertexPtr);
+    priv::spriteToVertices(sprite, transform, vertexPtr);
 }
 
 
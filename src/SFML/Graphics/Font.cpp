@@ -14,6 +14,7 @@
 #include "SFML/System/RectPacker.hpp"
 #include "SFML/System/Vector2.hpp"
 
+#include "SFML/Base/Algorithm.hpp"
 #include "SFML/Base/Optional.hpp"
 #include "SFML/Base/TrivialVector.hpp"
 #ifdef SFML_SYSTEM_ANDROID
@@ -21,23 +22,28 @@
 #endif
 #include "SFML/System/Err.hpp"
 #include "SFML/System/InputStream.hpp"
+#include "SFML/System/MappedFileInputStream.hpp"
 #include "SFML/System/Path.hpp"
 #include "SFML/System/PathUtils.hpp"
 
 #include "SFML/Base/Macros.hpp"
 #include "SFML/Base/Math/Floor.hpp"
+#include "SFML/Base/Math/Sqrt.hpp"
 
 #include <ft2build.h>
 #include FT_FREETYPE_H
 #include FT_GLYPH_H
 #include FT_OUTLINE_H
 #include FT_BITMAP_H
+#include FT_SIZES_H
 #include FT_STROKER_H
 
 #include "SFML/Base/Assert.hpp"
 #include "SFML/Base/Builtins/Memcpy.hpp"
 
 #include <memory>
+#include <mutex>
+#include <string>
 #include <unordered_map>
 
 
@@ -86,20 +92,107 @@ template <typename T, typename U>
 
 
 ////////////////////////////////////////////////////////////
-bool setFaceCurrentSize(FT_Face face, unsigned int characterSize)
+struct FontHandles
 {
-    // FT_Set_Pixel_Sizes is an expensive function, so we must call it
-    // only when necessary to avoid killing performances
+    FontHandles() = default;
 
-    const FT_UShort currentSize = face->size->metrics.x_ppem;
+    ~FontHandles();
 
-    if (currentSize == characterSize)
-        return true;
+    // clang-format off
+    FontHandles(const FontHandles&)            = delete;
+    FontHandles& operator=(const FontHandles&) = delete;
+
+    FontHandles(FontHandles&&)            = delete;
+    FontHandles& operator=(FontHandles&&) = delete;
+    // clang-format on
+
+    FT_Library   library{};   //< Pointer to the internal library interface
+    FT_StreamRec streamRec{}; //< Stream rec object describing an input stream
+    FT_Face      face{};      //< Pointer to the internal font face
+    FT_Stroker   stroker{};   //< Pointer to the stroker
+
+    std::unordered_map<unsigned int, FT_Size> sizes; //< Size objects of the face, created on first use of a character size
+
+    sf::base::Optional<sf::MappedFileInputStream> mappedFile; //< Contents of the font file, if opened from a file
+
+    std::string registryKey; //< Key of the face in the registry, if it is shared
+};
+
+
+////////////////////////////////////////////////////////////
+// Faces opened from files with sharing enabled are shared by all the fonts opened from the same path
+struct FontHandlesRegistry
+{
+    std::mutex                                                   mutex;
+    std::unordered_map<std::string, std::weak_ptr<FontHandles>> handles;
+};
+
+
+////////////////////////////////////////////////////////////
+[[nodiscard]] FontHandlesRegistry& getFontHandlesRegistry()
+{
+    static FontHandlesRegistry registry;
+    return registry;
+}
+
+
+////////////////////////////////////////////////////////////
+FontHandles::~FontHandles()
+{
+    // All the function below are safe to call with null pointer arguments.
+    // The documentation of FreeType isn't clear on the matter, but the
+    // implementation does explicitly check for null.
+
+    FT_Stroker_Done(stroker);
+    FT_Done_Face(face); // Also releases the objects in `sizes`
+    // `streamRec` doesn't need to be explicitly freed.
+    FT_Done_FreeType(library);
+
+    // `mappedFile` is unmapped after the face is gone
+
+    if (registryKey.empty())
+        return;
+
+    // The face may have been opened again since the last font using it dropped it
+    FontHandlesRegistry&  registry = getFontHandlesRegistry();
+    const std::lock_guard lock(registry.mutex);
+
+    if (const auto it = registry.handles.find(registryKey); it != registry.handles.end() && it->second.expired())
+        registry.handles.erase(it);
+}
+
+
+////////////////////////////////////////////////////////////
+bool setFaceCurrentSize(FontHandles& fontHandles, unsigned int characterSize)
+{
+    FT_Face face = fontHandles.face;
+
+    // FT_Set_Pixel_Sizes is an expensive function, so each character size gets
+    // its own size object, set up once and then simply activated when needed
+
+    if (const auto it = fontHandles.sizes.find(characterSize); it != fontHandles.sizes.end())
+        return face->size == it->second || FT_Activate_Size(it->second) == FT_Err_Ok;
+
+    FT_Size size = nullptr;
+    if (FT_New_Size(face, &size) != FT_Err_Ok || FT_Activate_Size(size) != FT_Err_Ok)
+    {
+        FT_Done_Size(size);
+        return false;
+    }
 
     const FT_Error result = FT_Set_Pixel_Sizes(face, 0, characterSize);
 
+    if (result == FT_Err_Ok)
+    {
+        fontHandles.sizes.emplace(characterSize, size);
+        return true;
+    }
+
+    // Also makes another size object active, if any
+    FT_Done_Size(size);
+
     if (result != FT_Err_Invalid_Pixel_Size)
-        return result == FT_Err_Ok;
+        return false;
 
     if (FT_IS_SCALABLE(face))
     {
@@ -114,8 +207,8 @@ bool setFaceCurrentSize(FT_Face face, unsigned int characterSize)
 
     for (int i = 0; i < face->num_fixed_sizes; ++i)
     {
-        const long size = (face->available_sizes[i].y_ppem + 32) >> 6;
-        sf::priv::err(true /* multiLine */) << size << " ";
+        const long availableSize = (face->available_sizes[i].y_ppem + 32) >> 6;
+        sf::priv::err(true /* multiLine */) << availableSize << " ";
     }
 
     sf::priv::err() << '\n';
@@ -124,45 +217,140 @@ bool setFaceCurrentSize(FT_Face face, unsigned int characterSize)
 
 
 ////////////////////////////////////////////////////////////
-struct FontHandles
+// Squared distance used for "infinitely far" in the distance transforms below (finite, to avoid `inf - inf`)
+constexpr float edtInfinity = 1e20f;
+
+
+////////////////////////////////////////////////////////////
+// Exact 1D squared Euclidean distance transform of `n` samples of `grid` with a given `stride`,
+// using the lower envelope of parabolas (Felzenszwalb & Huttenlocher)
+void distanceTransform1D(float* grid, int n, int stride, float* f, float* z, int* v)
 {
-    FontHandles() = default;
+    for (int q = 0; q < n; ++q)
+        f[q] = grid[q * stride];
 
-    ~FontHandles()
+    int k = 0;
+    v[0]  = 0;
+    z[0]  = -edtInfinity;
+    z[1]  = edtInfinity;
+
+    for (int q = 1; q < n; ++q)
     {
-        // All the function below are safe to call with null pointer arguments.
-        // The documentation of FreeType isn't clear on the matter, but the
-        // implementation does explicitly check for null.
-
-        FT_Stroker_Done(stroker);
-        FT_Done_Face(face);
-        // `streamRec` doesn't need to be explicitly freed.
-        FT_Done_FreeType(library);
+        const auto intersection = [&]
+        {
+            const int r = v[k];
+            return (f[q] + static_cast<float>(q * q) - f[r] - static_cast<float>(r * r)) /
+                   static_cast<float>(2 * (q - r));
+        };
+
+        float s = intersection();
+
+        while (s <= z[k])
+        {
+            --k;
+            s = intersection();
+        }
+
+        ++k;
+        v[k]     = q;
+        z[k]     = s;
+        z[k + 1] = edtInfinity;
     }
 
-    // clang-format off
-    FontHandles(const FontHandles&)            = delete;
-    FontHandles& operator=(const FontHandles&) = delete;
+    k = 0;
 
-    FontHandles(FontHandles&&)            = delete;
-    FontHandles& operator=(FontHandles&&) = delete;
-    // clang-format on
+    for (int q = 0; q < n; ++q)
+    {
+        while (z[k + 1] < static_cast<float>(q))
+            ++k;
 
-    FT_Library   library{};   //< Pointer to the internal library interface
-    FT_StreamRec streamRec{}; //< Stream rec object describing an input stream
-    FT_Face      face{};      //< Pointer to the internal font face
-    FT_Stroker   stroker{};   //< Pointer to the stroker
-};
+        const int r      = v[k];
+        grid[q * stride] = static_cast<float>((q - r) * (q - r)) + f[r];
+    }
+}
 
 
 ////////////////////////////////////////////////////////////
-sf::Glyph loadGlyph(const FontHandles&                     fontHandles,
+// 2D squared Euclidean distance transform of a `width` x `height` grid, in place
+void distanceTransform2D(float* grid, int width, int height, float* f, float* z, int* v)
+{
+    for (int x = 0; x < width; ++x)
+        distanceTransform1D(grid + x, height, width, f, z, v);
+
+    for (int y = 0; y < height; ++y)
+        distanceTransform1D(grid + y * width, width, 1, f, z, v);
+}
+
+
+////////////////////////////////////////////////////////////
+// Replace the coverage stored in the alpha channel of `pixels` with a signed distance field:
+// 0.5 is the glyph's edge, 1 is `spread` pixels inside it and 0 is `spread` pixels outside of it.
+// Partially covered pixels are used to place the edge with sub-pixel accuracy (as in Mapbox's TinySDF).
+void coverageToDistanceField(sf::base::U8* pixels, sf::Vector2u size, unsigned int spread)
+{
+    const auto width  = static_cast<int>(size.x);
+    const auto height = static_cast<int>(size.y);
+    const auto count  = static_cast<sf::base::SizeT>(width) * static_cast<sf::base::SizeT>(height);
+    const auto length = static_cast<sf::base::SizeT>(sf::base::max(width, height));
+
+    sf::base::TrivialVector<float> outer; // Squared distance to the glyph, for pixels outside of it
+    sf::base::TrivialVector<float> inner; // Squared distance to the background, for pixels inside the glyph
+    sf::base::TrivialVector<float> f;
+    sf::base::TrivialVector<float> z;
+    sf::base::TrivialVector<int>   v;
+
+    outer.resize(count);
+    inner.resize(count);
+    f.resize(length);
+    z.resize(length + 1u);
+    v.resize(length);
+
+    for (sf::base::SizeT i = 0u; i < count; ++i)
+    {
+        const float coverage = static_cast<float>(pixels[i * 4 + 3]) / 255.f;
+
+        if (coverage >= 1.f)
+        {
+            outer[i] = 0.f;
+            inner[i] = edtInfinity;
+        }
+        else if (coverage <= 0.f)
+        {
+            outer[i] = edtInfinity;
+            inner[i] = 0.f;
+        }
+        else
+        {
+            const float edgeDistance = 0.5f - coverage;
+            outer[i]                 = edgeDistance > 0.f ? edgeDistance * edgeDistance : 0.f;
+            inner[i]                 = edgeDistance < 0.f ? edgeDistance * edgeDistance : 0.f;
+        }
+    }
+
+    distanceTransform2D(outer.data(), width, height, f.data(), z.data(), v.data());
+    distanceTransform2D(inner.data(), width, height, f.data(), z.data(), v.data());
+
+    const float range = 2.f * static_cast<float>(spread);
+
+    for (sf::base::SizeT i = 0u; i < count; ++i)
+    {
+        const float signedDistance = sf::base::sqrt(inner[i]) - sf::base::sqrt(outer[i]); // Positive inside
+        const float value          = sf::base::clamp(0.5f + signedDistance / range, 0.f, 1.f);
+
+        pixels[i * 4 + 3] = static_cast<sf::base::U8>(value * 255.f + 0.5f);
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+sf::Glyph loadGlyph(FontHandles&                           fontHandles,
                     sf::TextureAtlas&                      textureAtlas,
                     sf::base::TrivialVector<sf::base::U8>& pixelBuffer,
                     sf::base::U32                          codePoint,
                     unsigned int                           characterSize,
                     bool                                   bold,
-                    float                                  outlineThickness)
+                    float                                  outlineThickness,
+                    unsigned int                           sdfSpread = 0u)
 {
     sf::Glyph glyph; // Use a single local variable for NRVO
 
@@ -172,12 +360,13 @@ sf::Glyph loadGlyph(const FontHandles&                     fontHandles,
         return glyph; // Empty glyph
 
     // Set the character size
-    if (!setFaceCurrentSize(face, characterSize))
+    if (!setFaceCurrentSize(fontHandles, characterSize))
         return glyph; // Empty glyph
 
     // Load the glyph corresponding to the code point
-    FT_Int32 flags = FT_LOAD_TARGET_NORMAL | FT_LOAD_FORCE_AUTOHINT;
-    if (outlineThickness != 0)
+    // Distance field glyphs are scaled to any size, so they must not be hinted for a specific one
+    FT_Int32 flags = FT_LOAD_TARGET_NORMAL | (sdfSpread != 0u ? FT_LOAD_NO_HINTING : FT_LOAD_FORCE_AUTOHINT);
+    if (outlineThickness != 0 || sdfSpread != 0u)
         flags |= FT_LOAD_NO_BITMAP;
 
     if (FT_Load_Char(face, codePoint, flags) != 0)
@@ -244,8 +433,9 @@ sf::Glyph loadGlyph(const FontHandles&                     fontHandles,
     if ((size.x > 0) && (size.y > 0))
     {
         // Leave a small padding around characters, so that filtering doesn't
-        // pollute them with pixels from neighbors
-        const unsigned int padding = 2.f;
+        // pollute them with pixels from neighbors, plus room for the distance
+        // field to fall off outside of the glyph if needed
+        const unsigned int padding = 2u + sdfSpread;
 
         size += 2u * sf::Vector2u{padding, padding};
 
@@ -257,8 +447,8 @@ sf::Glyph loadGlyph(const FontHandles&                     fontHandles,
 
         // Make sure the texture data is positioned in the center
         // of the allocated texture rectangle
-        glyph.textureRect.position += sf::Vector2f{padding, padding};
-        glyph.textureRect.size -= 2.f * sf::Vector2f{padding, padding};
+        glyph.textureRect.position += sf::Vector2u{padding, padding}.toVector2f();
+        glyph.textureRect.size -= 2.f * sf::Vector2u{padding, padding}.toVector2f();
 
         // Compute the glyph's bounding box
         glyph.bounds.position = sf::Vector2i(bitmapGlyph->left, -bitmapGlyph->top).toVector2f();
@@ -311,6 +501,9 @@ sf::Glyph loadGlyph(const FontHandles&                     fontHandles,
             }
         }
 
+        if (sdfSpread != 0u)
+            coverageToDistanceField(pixelBuffer.data(), size, sdfSpread);
+
         // Write the pixels to the texture
         const auto dest       = glyph.textureRect.position.toVector2u() - sf::Vector2u{padding, padding};
         const auto updateSize = glyph.textureRect.size.toVector2u() + 2u * sf::Vector2u{padding, padding};
@@ -334,6 +527,7 @@ struct Font::Impl
 {
     using GlyphTable = std::unordered_map</* character size */ unsigned int,
                                           std::unordered_map</* combined key */ base::U64, Glyph>>; //!< Table mapping a codepoint to its glyph
+    using SdfGlyphTable = std::unordered_map</* combined key */ base::U64, Glyph>; //!< Table of reference size distance field glyphs
 
     [[nodiscard]] static Vector2u getMaxTextureSizeVec(GraphicsContext& graphicsContext)
     {
@@ -373,9 +567,11 @@ struct Font::Impl
 
     std::shared_ptr<FontHandles> fontHandles;    //!< Shared information about the internal font instance
     bool                         isSmooth{true}; //!< Status of the smooth filter
+    bool                         isSdf{};        //!< Are glyphs rendered as signed distance fields?
     FontInfo                     info;           //!< Information about the font
 
-    mutable GlyphTable glyphs; //!< Table mapping code points to their corresponding glyph
+    mutable GlyphTable    glyphs;    //!< Table mapping code points to their corresponding glyph
+    mutable SdfGlyphTable sdfGlyphs; //!< Distance field glyphs at the reference size, shared by all sizes
 
     mutable base::TrivialVector<base::U8> pixelBuffer; //!< Pixel buffer holding a glyph's pixels before being written to the texture
 
@@ -414,7 +610,10 @@ Font& Font::operator=(Font&&) noexcept = default;
 
 
 ////////////////////////////////////////////////////////////
-base::Optional<Font> Font::openFromFile(GraphicsContext& graphicsContext, const Path& filename, TextureAtlas* textureAtlas)
+base::Optional<Font> Font::openFromFile(GraphicsContext&      graphicsContext,
+                                        const Path&           filename,
+                                        TextureAtlas*         textureAtlas,
+                                        [[maybe_unused]] bool shareFace)
 {
     [[maybe_unused]] const auto fail = [&](const char* what)
     {
@@ -424,17 +623,49 @@ base::Optional<Font> Font::openFromFile(GraphicsContext& graphicsContext, const
 
 #ifndef SFML_SYSTEM_ANDROID
 
+    // Fonts opened from the same file with sharing enabled share their face and its mapping
+    FontHandlesRegistry&         registry = getFontHandlesRegistry();
+    std::unique_lock<std::mutex> lock;
+    std::string                  key;
+
+    if (shareFace)
+    {
+        key  = filename.absolute().to<std::string>();
+        lock = std::unique_lock(registry.mutex);
+
+        const auto it = registry.handles.find(key);
+
+        if (std::shared_ptr<FontHandles> fontHandles = it != registry.handles.end() ? it->second.lock() : nullptr)
+        {
+            const char* const familyName = fontHandles->face->family_name;
+            return base::makeOptional<Font>(base::PassKey<Font>{},
+                                            graphicsContext,
+                                            textureAtlas,
+                                            &fontHandles,
+                                            familyName);
+        }
+    }
+
     auto fontHandles = std::make_shared<FontHandles>();
 
+    // Map the file instead of reading it, so that only the tables and glyphs actually used are ever paged in
+    fontHandles->mappedFile = MappedFileInputStream::open(filename);
+    if (!fontHandles->mappedFile.hasValue())
+        return fail("failed to map the font file");
+
     // Initialize FreeType
-    // Note: we initialize FreeType for every font instance in order to avoid having a single
+    // Note: we initialize FreeType for every font face in order to avoid having a single
     // global manager that would create a lot of issues regarding creation and destruction order.
     if (FT_Init_FreeType(&fontHandles->library) != 0)
         return fail("failed to initialize FreeType");
 
-    // Load the new font face from the specified file
+    // Load the new font face from the mapped file
     FT_Face face = nullptr;
-    if (FT_New_Face(fontHandles->library, filename.toCharPtr(), 0, &face) != 0)
+    if (FT_New_Memory_Face(fontHandles->library,
+                           static_cast<const FT_Byte*>(fontHandles->mappedFile->getData()),
+                           static_cast<FT_Long>(fontHandles->mappedFile->getDataSize()),
+                           0,
+                           &face) != 0)
         return fail("failed to create the font face");
 
     fontHandles->face = face;
@@ -447,6 +678,12 @@ base::Optional<Font> Font::openFromFile(GraphicsContext& graphicsContext, const
     if (FT_Select_Charmap(face, FT_ENCODING_UNICODE) != 0)
         return fail("failed to set the Unicode character set");
 
+    if (shareFace)
+    {
+        fontHandles->registryKey = key;
+        registry.handles.insert_or_assign(key, fontHandles);
+    }
+
     return base::makeOptional<Font>(base::PassKey<Font>{}, graphicsContext, textureAtlas, &fontHandles, face->family_name);
 
 #else
@@ -584,12 +821,43 @@ const Glyph& Font::getGlyph(base::U32 codePoint, unsigned int characterSize, boo
     auto& glyphs = m_impl->glyphs[characterSize];
 
     // Build the key by combining the glyph index (based on code point), bold flag, and outline thickness
-    const base::U64 key = combine(outlineThickness, bold, getCharIndex(codePoint));
+    // (distance field glyphs are outlined by the shader, so their thickness is always zero)
+    const base::U64 key = combine(m_impl->isSdf ? 0.f : outlineThickness, bold, getCharIndex(codePoint));
 
     // Glyph cached: just return it
     if (const auto it = glyphs.find(key); it != glyphs.end())
         return it->second;
 
+    if (m_impl->isSdf)
+    {
+        // Distance field glyphs are only rasterized at the reference size, other sizes share their pixels
+        auto it = m_impl->sdfGlyphs.find(key);
+        if (it == m_impl->sdfGlyphs.end())
+            it = m_impl->sdfGlyphs
+                     .try_emplace(key,
+                                  loadGlyph(*m_impl->fontHandles,
+                                            m_impl->getTextureAtlas(),
+                                            m_impl->pixelBuffer,
+                                            codePoint,
+                                            sdfReferenceSize,
+                                            bold,
+                                            /* outlineThickness */ 0.f,
+                                            sdfSpread))
+                     .first;
+
+        // Scale the metrics, but keep the texture rectangle of the reference glyph
+        const float scale = static_cast<float>(characterSize) / static_cast<float>(sdfReferenceSize);
+
+        Glyph scaledGlyph = it->second;
+        scaledGlyph.advance *= scale;
+        scaledGlyph.lsbDelta = static_cast<int>(static_cast<float>(scaledGlyph.lsbDelta) * scale);
+        scaledGlyph.rsbDelta = static_cast<int>(static_cast<float>(scaledGlyph.rsbDelta) * scale);
+        scaledGlyph.bounds.position *= scale;
+        scaledGlyph.bounds.size *= scale;
+
+        return glyphs.try_emplace(key, scaledGlyph).first->second;
+    }
+
     // Glyph not cached: we have to load it
     const Glyph loadedGlyph = loadGlyph(*m_impl->fontHandles,
                                         m_impl->getTextureAtlas(),
@@ -729,13 +997,41 @@ bool Font::isSmooth() const
 }
 
 
+////////////////////////////////////////////////////////////
+void Font::setSdf(bool sdf)
+{
+    if (sdf == m_impl->isSdf)
+        return;
+
+    m_impl->isSdf = sdf;
+
+    // Glyphs rendered in the other mode cannot be reused
+    m_impl->glyphs.clear();
+    m_impl->sdfGlyphs.clear();
+}
+
+
+////////////////////////////////////////////////////////////
+bool Font::isSdf() const
+{
+    return m_impl->isSdf;
+}
+
+
+////////////////////////////////////////////////////////////
+const Shader& Font::getSdfShader() const
+{
+    return m_impl->graphicsContext->getBuiltInSdfTextShader();
+}
+
+
 ////////////////////////////////////////////////////////////
 bool Font::setCurrentSize(unsigned int characterSize) const
 {
     SFML_BASE_ASSERT(m_impl->fontHandles != nullptr);
     SFML_BASE_ASSERT(m_impl->fontHandles->face);
 
-    return setFaceCurrentSize(m_impl->fontHandles->face, characterSize);
+    return setFaceCurrentSize(*m_impl->fontHandles, characterSize);
 }
 
 } // namespace sf
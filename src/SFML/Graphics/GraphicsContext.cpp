@@ -11,6 +11,8 @@
 #include "SFML/Window/GLCheck.hpp"
 #include "SFML/Window/Glad.hpp"
 
+#include "SFML/System/Path.hpp"
+
 #include "SFML/Base/Assert.hpp"
 #include "SFML/Base/Optional.hpp"
 
@@ -62,6 +64,96 @@ void main()
 )glsl";
 
 
+////////////////////////////////////////////////////////////
+// Layers of a texture array are laid out side by side along the X axis of the texture coordinates,
+// `sf_u_texParams` holds the reciprocal of the layer size and the layer stride (see `TextureArray::getTextureRect`)
+constexpr const char* builtInTextureArrayShaderVertexSrc = R"glsl(
+
+layout(location = 0) uniform mat4 sf_u_mvpMatrix;
+layout(location = 1) uniform vec3 sf_u_texParams;
+
+layout(location = 0) in vec2 sf_a_position;
+layout(location = 1) in vec4 sf_a_color;
+layout(location = 2) in vec2 sf_a_texCoord;
+
+out vec4 sf_v_color;
+out vec2 sf_v_texCoord;
+flat out float sf_v_layer;
+
+void main()
+{
+    gl_Position = sf_u_mvpMatrix * vec4(sf_a_position, 0.0, 1.0);
+    sf_v_color = sf_a_color;
+
+    float layer = floor(sf_a_texCoord.x / sf_u_texParams[2]);
+
+    sf_v_texCoord = vec2(sf_u_texParams[0] * (sf_a_texCoord.x - layer * sf_u_texParams[2]),
+                         sf_u_texParams[1] * sf_a_texCoord.y);
+    sf_v_layer = layer;
+}
+
+)glsl";
+
+
+////////////////////////////////////////////////////////////
+constexpr const char* builtInTextureArrayShaderFragmentSrc = R"glsl(
+
+#ifdef GL_ES
+precision mediump sampler2DArray;
+#endif
+
+layout(location = 2) uniform sampler2DArray sf_u_texture;
+
+in vec4 sf_v_color;
+in vec2 sf_v_texCoord;
+flat in float sf_v_layer;
+
+layout(location = 0) out vec4 sf_fragColor;
+
+void main()
+{
+    sf_fragColor = sf_v_color * texture(sf_u_texture, vec3(sf_v_texCoord, sf_v_layer));
+}
+
+)glsl";
+
+
+////////////////////////////////////////////////////////////
+// The alpha channel of glyph textures holds a signed distance field (see `Font::setSdf`), with the edge at 0.5;
+// `fwidth` keeps the anti-aliased transition about one screen pixel wide regardless of the scale
+constexpr const char* builtInSdfTextShaderFragmentSrc = R"glsl(
+
+layout(location = 2) uniform sampler2D sf_u_texture;
+layout(location = 3) uniform vec4 sf_u_outlineColor;
+layout(location = 4) uniform float sf_u_outlineWidth;
+layout(location = 5) uniform vec4 sf_u_glowColor;
+layout(location = 6) uniform float sf_u_glowWidth;
+
+in vec4 sf_v_color;
+in vec2 sf_v_texCoord;
+
+layout(location = 0) out vec4 sf_fragColor;
+
+void main()
+{
+    float dist = texture(sf_u_texture, sf_v_texCoord).a;
+    float aa   = max(fwidth(dist) * 0.5, 0.0001);
+
+    float outlineEdge = 0.5 - max(sf_u_outlineWidth, 0.0);
+    float fill        = smoothstep(0.5 - aa, 0.5 + aa, dist);
+    float outline     = smoothstep(outlineEdge - aa, outlineEdge + aa, dist);
+    float glow        = sf_u_glowWidth > 0.0 ? smoothstep(outlineEdge - sf_u_glowWidth, outlineEdge, dist) : 0.0;
+
+    vec4 color = vec4(sf_u_glowColor.rgb, sf_u_glowColor.a * glow);
+    color      = mix(color, sf_u_outlineColor, sf_u_outlineWidth > 0.0 ? outline : 0.0);
+    color      = mix(color, sf_v_color, fill);
+
+    sf_fragColor = color;
+}
+
+)glsl";
+
+
 ////////////////////////////////////////////////////////////
 [[nodiscard]] sf::Shader createBuiltInShader(sf::GraphicsContext& graphicsContext, const char* vertexSrc, const char* fragmentSrc)
 {
@@ -82,14 +174,26 @@ namespace sf
 ////////////////////////////////////////////////////////////
 struct GraphicsContext::Impl
 {
+    Path                    shaderCacheDirectory;
     base::Optional<Shader>  builtInShader;
     base::Optional<Texture> builtInWhiteDotTexture;
+    base::Optional<Shader>  builtInTextureArrayShader;
+    base::Optional<Shader>  builtInSdfTextShader;
 };
 
 
 ////////////////////////////////////////////////////////////
-GraphicsContext::GraphicsContext()
+GraphicsContext::GraphicsContext() : GraphicsContext(Path{})
 {
+}
+
+
+////////////////////////////////////////////////////////////
+GraphicsContext::GraphicsContext(const Path& shaderCacheDirectory)
+{
+    // Must be set before the built-in shader is compiled, so that it is cached as well
+    m_impl->shaderCacheDirectory = shaderCacheDirectory;
+
     m_impl->builtInShader.emplace(createBuiltInShader(*this, builtInShaderVertexSrc, builtInShaderFragmentSrc));
     m_impl->builtInWhiteDotTexture = Texture::loadFromImage(*this, *Image::create({1u, 1u}, Color::White));
 }
@@ -118,6 +222,42 @@ GraphicsContext::~GraphicsContext()
 }
 
 
+////////////////////////////////////////////////////////////
+Shader& GraphicsContext::getBuiltInTextureArrayShader()
+{
+    if (!m_impl->builtInTextureArrayShader.hasValue())
+        m_impl->builtInTextureArrayShader.emplace(
+            createBuiltInShader(*this, builtInTextureArrayShaderVertexSrc, builtInTextureArrayShaderFragmentSrc));
+
+    return *m_impl->builtInTextureArrayShader;
+}
+
+
+////////////////////////////////////////////////////////////
+Shader& GraphicsContext::getBuiltInSdfTextShader()
+{
+    if (!m_impl->builtInSdfTextShader.hasValue())
+        m_impl->builtInSdfTextShader.emplace(
+            createBuiltInShader(*this, builtInShaderVertexSrc, builtInSdfTextShaderFragmentSrc));
+
+    return *m_impl->builtInSdfTextShader;
+}
+
+
+////////////////////////////////////////////////////////////
+void GraphicsContext::setShaderCacheDirectory(const Path& shaderCacheDirectory)
+{
+    m_impl->shaderCacheDirectory = shaderCacheDirectory;
+}
+
+
+////////////////////////////////////////////////////////////
+const Path& GraphicsContext::getShaderCacheDirectory() const
+{
+    return m_impl->shaderCacheDirectory;
+}
+
+
 ////////////////////////////////////////////////////////////
 const char* GraphicsContext::getBuiltInShaderVertexSrc() const
 {
@@ -7,6 +7,7 @@
 
 #include "SFML/System/Err.hpp"
 #include "SFML/System/InputStream.hpp"
+#include "SFML/System/JobSystem.hpp"
 #include "SFML/System/Path.hpp"
 #include "SFML/System/PathUtils.hpp"
 #include "SFML/System/Vector2.hpp"
@@ -14,9 +15,17 @@
 #include "SFML/Base/Algorithm.hpp"
 #include "SFML/Base/Assert.hpp"
 #include "SFML/Base/Builtins/Memcpy.hpp"
+#include "SFML/Base/Constants.hpp"
+#include "SFML/Base/IntTypes.hpp"
+#include "SFML/Base/Math/Ceil.hpp"
+#include "SFML/Base/Math/Fabs.hpp"
+#include "SFML/Base/Math/Floor.hpp"
+#include "SFML/Base/Math/Sin.hpp"
 #include "SFML/Base/Optional.hpp"
 #include "SFML/Base/PassKey.hpp"
 #include "SFML/Base/PtrDiffT.hpp"
+#include "SFML/Base/Simd.hpp"
+#include "SFML/Base/SizeT.hpp"
 #include "SFML/Base/TrivialVector.hpp"
 #include "SFML/Base/UniquePtr.hpp"
 
@@ -70,6 +79,585 @@ struct StbDeleter
 ////////////////////////////////////////////////////////////
 using StbPtr = sf::base::UniquePtr<stbi_uc, StbDeleter>;
 
+
+// The kernels below process whole blocks of four pixels with SSE2 where available and leave
+// the remaining pixels to a scalar loop working on 32-bit words, which compilers vectorize on
+// other targets. They must produce exactly the same bytes as the per-channel scalar formulas.
+
+////////////////////////////////////////////////////////////
+[[nodiscard, gnu::always_inline]] inline sf::base::U32 loadPixel(const sf::base::U8* ptr)
+{
+    sf::base::U32 pixel{};
+    SFML_BASE_MEMCPY(&pixel, ptr, sizeof(pixel));
+    return pixel;
+}
+
+
+////////////////////////////////////////////////////////////
+[[gnu::always_inline]] inline void storePixel(sf::base::U8* ptr, sf::base::U32 pixel)
+{
+    SFML_BASE_MEMCPY(ptr, &pixel, sizeof(pixel));
+}
+
+
+////////////////////////////////////////////////////////////
+[[nodiscard, gnu::always_inline]] inline sf::base::U32 packPixel(
+    const sf::base::U8 r,
+    const sf::base::U8 g,
+    const sf::base::U8 b,
+    const sf::base::U8 a)
+{
+    const sf::base::U8 bytes[4]{r, g, b, a};
+    return loadPixel(bytes);
+}
+
+
+////////////////////////////////////////////////////////////
+[[nodiscard, gnu::always_inline]] inline sf::base::U32 packPixel(sf::Color color)
+{
+    return packPixel(color.r, color.g, color.b, color.a);
+}
+
+
+////////////////////////////////////////////////////////////
+void fillPixels(sf::base::U8* pixels, sf::base::SizeT pixelCount, sf::base::U32 pixel)
+{
+    sf::base::SizeT i = 0u;
+
+#if defined(SFML_BASE_SIMD_SSE2)
+    const __m128i block = _mm_set1_epi32(static_cast<int>(pixel));
+
+    for (; i + 4u <= pixelCount; i += 4u)
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(pixels + i * 4u), block);
+#endif
+
+    for (; i < pixelCount; ++i)
+        storePixel(pixels + i * 4u, pixel);
+}
+
+
+////////////////////////////////////////////////////////////
+/// Replace the pixels equal to `key` with `(pixel & keepMask) | replacement`
+///
+////////////////////////////////////////////////////////////
+void replaceMatchingPixels(sf::base::U8*   pixels,
+                           sf::base::SizeT pixelCount,
+                           sf::base::U32   key,
+                           sf::base::U32   keepMask,
+                           sf::base::U32   replacement)
+{
+    sf::base::SizeT i = 0u;
+
+#if defined(SFML_BASE_SIMD_SSE2)
+    const __m128i keyBlock         = _mm_set1_epi32(static_cast<int>(key));
+    const __m128i replacementBlock = _mm_set1_epi32(static_cast<int>((key & keepMask) | replacement));
+
+    for (; i + 4u <= pixelCount; i += 4u)
+    {
+        auto* const   ptr   = reinterpret_cast<__m128i*>(pixels + i * 4u);
+        const __m128i block = _mm_loadu_si128(ptr);
+        const __m128i match = _mm_cmpeq_epi32(block, keyBlock);
+
+        _mm_storeu_si128(ptr, _mm_or_si128(_mm_and_si128(match, replacementBlock), _mm_andnot_si128(match, block)));
+    }
+#endif
+
+    for (; i < pixelCount; ++i)
+    {
+        const sf::base::U32 pixel = loadPixel(pixels + i * 4u);
+        storePixel(pixels + i * 4u, pixel == key ? (pixel & keepMask) | replacement : pixel);
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void reversePixels(sf::base::U8* row, sf::base::SizeT pixelCount)
+{
+    sf::base::U8* left  = row;
+    sf::base::U8* right = row + pixelCount * 4u;
+
+#if defined(SFML_BASE_SIMD_SSE2)
+    while (right - left >= 32)
+    {
+        right -= 16;
+
+        const __m128i leftBlock  = _mm_loadu_si128(reinterpret_cast<const __m128i*>(left));
+        const __m128i rightBlock = _mm_loadu_si128(reinterpret_cast<const __m128i*>(right));
+
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(left), _mm_shuffle_epi32(rightBlock, _MM_SHUFFLE(0, 1, 2, 3)));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(right), _mm_shuffle_epi32(leftBlock, _MM_SHUFFLE(0, 1, 2, 3)));
+
+        left += 16;
+    }
+#endif
+
+    while (right - left >= 8)
+    {
+        right -= 4;
+
+        const sf::base::U32 leftPixel = loadPixel(left);
+        storePixel(left, loadPixel(right));
+        storePixel(right, leftPixel);
+
+        left += 4;
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void swapBytes(sf::base::U8* a, sf::base::U8* b, sf::base::SizeT count)
+{
+    // Swap through a small buffer so that the copies use the widest loads and stores available
+    alignas(16) sf::base::U8 buffer[512];
+
+    while (count > 0u)
+    {
+        const sf::base::SizeT chunk = sf::base::min(count, sizeof(buffer));
+
+        SFML_BASE_MEMCPY(buffer, a, chunk);
+        SFML_BASE_MEMCPY(a, b, chunk);
+        SFML_BASE_MEMCPY(b, buffer, chunk);
+
+        a += chunk;
+        b += chunk;
+        count -= chunk;
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+[[nodiscard, gnu::always_inline]] inline sf::base::U8 blendOverAlpha(unsigned int srcAlpha, unsigned int dstAlpha)
+{
+    return static_cast<sf::base::U8>(srcAlpha + dstAlpha - srcAlpha * dstAlpha / 255);
+}
+
+
+#if defined(SFML_BASE_SIMD_SSE2)
+////////////////////////////////////////////////////////////
+/// Extract channel `shift / 8` of four pixels into 32-bit lanes
+///
+////////////////////////////////////////////////////////////
+[[nodiscard, gnu::always_inline]] inline __m128i extractChannel(__m128i pixels, int shift)
+{
+    return _mm_and_si128(_mm_srl_epi32(pixels, _mm_cvtsi32_si128(shift)), _mm_set1_epi32(0xFF));
+}
+
+
+////////////////////////////////////////////////////////////
+/// Divide non-negative integers below 2^24 held in floats, rounding down
+///
+/// The quotient of two such integers is either exact or at least
+/// `1 / denominator` away from the next integer, much more than
+/// the rounding error of the division, so truncating the correctly
+/// rounded float quotient gives the same result as integer division.
+///
+////////////////////////////////////////////////////////////
+[[nodiscard, gnu::always_inline]] inline __m128i divideFloor(__m128 numerator, __m128 denominator)
+{
+    return _mm_cvttps_epi32(_mm_div_ps(numerator, denominator));
+}
+#endif
+
+
+////////////////////////////////////////////////////////////
+void blendRowOver(const sf::base::U8* src, sf::base::U8* dst, sf::base::SizeT pixelCount)
+{
+    sf::base::SizeT i = 0u;
+
+#if defined(SFML_BASE_SIMD_SSE2)
+    const __m128i zero = _mm_setzero_si128();
+    const __m128  one  = _mm_set1_ps(1.f);
+
+    for (; i + 4u <= pixelCount; i += 4u)
+    {
+        const __m128i srcBlock = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i * 4u));
+        const __m128i dstBlock = _mm_loadu_si128(reinterpret_cast<const __m128i*>(dst + i * 4u));
+
+        const __m128i srcAlphaInt = _mm_srli_epi32(srcBlock, 24);
+        const __m128i dstAlphaInt = _mm_srli_epi32(dstBlock, 24);
+        const __m128  srcAlpha    = _mm_cvtepi32_ps(srcAlphaInt);
+        const __m128  dstAlpha    = _mm_cvtepi32_ps(dstAlphaInt);
+
+        const __m128i product  = divideFloor(_mm_mul_ps(srcAlpha, dstAlpha), _mm_set1_ps(255.f));
+        const __m128i outAlpha = _mm_sub_epi32(_mm_add_epi32(srcAlphaInt, dstAlphaInt), product);
+
+        // A transparent result copies the source color instead of dividing by zero
+        const __m128  outAlphaF     = _mm_cvtepi32_ps(outAlpha);
+        const __m128  dstWeight     = _mm_sub_ps(outAlphaF, srcAlpha);
+        const __m128  denominator   = _mm_max_ps(outAlphaF, one);
+        const __m128i isTransparent = _mm_cmpeq_epi32(outAlpha, zero);
+
+        __m128i result = _mm_slli_epi32(outAlpha, 24);
+
+        for (int shift = 0; shift < 24; shift += 8)
+        {
+            const __m128i srcChannel = extractChannel(srcBlock, shift);
+            const __m128i dstChannel = extractChannel(dstBlock, shift);
+            const __m128  numerator  = _mm_add_ps(_mm_mul_ps(_mm_cvtepi32_ps(srcChannel), srcAlpha),
+                                                 _mm_mul_ps(_mm_cvtepi32_ps(dstChannel), dstWeight));
+
+            const __m128i channel = divideFloor(numerator, denominator);
+            const __m128i blended = _mm_or_si128(_mm_and_si128(isTransparent, srcChannel),
+                                                 _mm_andnot_si128(isTransparent, channel));
+
+            result = _mm_or_si128(result, _mm_sll_epi32(blended, _mm_cvtsi32_si128(shift)));
+        }
+
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i * 4u), result);
+    }
+#endif
+
+    for (; i < pixelCount; ++i)
+    {
+        // Get a direct pointer to the components of the current pixel
+        const sf::base::U8* srcPixel = src + i * 4u;
+        sf::base::U8*       dstPixel = dst + i * 4u;
+
+        // Interpolate RGBA components using the alpha values of the destination and source pixels
+        const sf::base::U8 srcAlpha = srcPixel[3];
+        const sf::base::U8 outAlpha = blendOverAlpha(srcAlpha, dstPixel[3]);
+
+        dstPixel[3] = outAlpha;
+
+        if (outAlpha)
+            for (int k = 0; k < 3; k++)
+                dstPixel[k] = static_cast<sf::base::U8>(
+                    (srcPixel[k] * srcAlpha + dstPixel[k] * (outAlpha - srcAlpha)) / outAlpha);
+        else
+            for (int k = 0; k < 3; k++)
+                dstPixel[k] = srcPixel[k];
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void premultiplyPixels(sf::base::U8* pixels, sf::base::SizeT pixelCount)
+{
+    sf::base::SizeT i = 0u;
+
+#if defined(SFML_BASE_SIMD_SSE2)
+    // `(c * a + 127) / 255` computed as `(t + (t >> 8)) >> 8` with `t = c * a + 128`,
+    // which is exact for 8-bit operands and fits in 16-bit lanes
+    const __m128i zero      = _mm_setzero_si128();
+    const __m128i half      = _mm_set1_epi16(128);
+    const __m128i alphaMask = _mm_set_epi16(-1, 0, 0, 0, -1, 0, 0, 0);
+
+    const auto premultiplyHalf = [&](__m128i channels)
+    {
+        const __m128i alpha = _mm_shufflehi_epi16(_mm_shufflelo_epi16(channels, _MM_SHUFFLE(3, 3, 3, 3)),
+                                                  _MM_SHUFFLE(3, 3, 3, 3));
+
+        const __m128i t       = _mm_add_epi16(_mm_mullo_epi16(channels, alpha), half);
+        const __m128i product = _mm_srli_epi16(_mm_add_epi16(t, _mm_srli_epi16(t, 8)), 8);
+
+        return _mm_or_si128(_mm_and_si128(alphaMask, channels), _mm_andnot_si128(alphaMask, product));
+    };
+
+    for (; i + 4u <= pixelCount; i += 4u)
+    {
+        auto* const   ptr   = reinterpret_cast<__m128i*>(pixels + i * 4u);
+        const __m128i block = _mm_loadu_si128(ptr);
+
+        _mm_storeu_si128(ptr,
+                         _mm_packus_epi16(premultiplyHalf(_mm_unpacklo_epi8(block, zero)),
+                                          premultiplyHalf(_mm_unpackhi_epi8(block, zero))));
+    }
+#endif
+
+    for (; i < pixelCount; ++i)
+    {
+        sf::base::U8* pixel = pixels + i * 4u;
+
+        for (int k = 0; k < 3; ++k)
+            pixel[k] = static_cast<sf::base::U8>((pixel[k] * pixel[3] + 127) / 255);
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void unpremultiplyPixels(sf::base::U8* pixels, sf::base::SizeT pixelCount)
+{
+    sf::base::SizeT i = 0u;
+
+#if defined(SFML_BASE_SIMD_SSE2)
+    const __m128i zero    = _mm_setzero_si128();
+    const __m128i maximum = _mm_set1_epi32(255);
+    const __m128  one     = _mm_set1_ps(1.f);
+
+    for (; i + 4u <= pixelCount; i += 4u)
+    {
+        auto* const   ptr   = reinterpret_cast<__m128i*>(pixels + i * 4u);
+        const __m128i block = _mm_loadu_si128(ptr);
+
+        const __m128i alpha         = _mm_srli_epi32(block, 24);
+        const __m128i halfAlpha     = _mm_srli_epi32(alpha, 1);
+        const __m128  denominator   = _mm_max_ps(_mm_cvtepi32_ps(alpha), one);
+        const __m128i isTransparent = _mm_cmpeq_epi32(alpha, zero);
+
+        // Transparent pixels keep their color, so the result of the dummy division is discarded
+        const __m128i keptBits = _mm_or_si128(isTransparent, _mm_set1_epi32(static_cast<int>(0xFF000000u)));
+        __m128i       result   = _mm_and_si128(block, keptBits);
+
+        for (int shift = 0; shift < 24; shift += 8)
+        {
+            // `255 * c` as `(c << 8) - c`, as SSE2 lacks a 32-bit multiplication
+            const __m128i channel   = extractChannel(block, shift);
+            const __m128i numerator = _mm_add_epi32(_mm_sub_epi32(_mm_slli_epi32(channel, 8), channel), halfAlpha);
+
+            __m128i quotient = divideFloor(_mm_cvtepi32_ps(numerator), denominator);
+
+            // Clamp to 255, for colors that were brighter than their alpha allows
+            const __m128i overflow = _mm_cmpgt_epi32(quotient, maximum);
+            quotient = _mm_or_si128(_mm_and_si128(overflow, maximum), _mm_andnot_si128(overflow, quotient));
+
+            const __m128i shifted = _mm_sll_epi32(quotient, _mm_cvtsi32_si128(shift));
+            result                = _mm_or_si128(result, _mm_andnot_si128(isTransparent, shifted));
+        }
+
+        _mm_storeu_si128(ptr, result);
+    }
+#endif
+
+    for (; i < pixelCount; ++i)
+    {
+        sf::base::U8* pixel = pixels + i * 4u;
+
+        if (pixel[3] == 0)
+            continue;
+
+        for (int k = 0; k < 3; ++k)
+            pixel[k] = static_cast<sf::base::U8>(sf::base::min((pixel[k] * 255 + pixel[3] / 2) / pixel[3], 255));
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void swizzlePixels(sf::base::U8* pixels, sf::base::SizeT pixelCount, const sf::base::U8 (&sources)[4])
+{
+    sf::base::SizeT i = 0u;
+
+#if defined(SFML_BASE_SIMD_SSE2)
+    // Pixels are loaded as little-endian 32-bit lanes, so channel `k` lives at bits `8 * k`
+    __m128i sourceShifts[4];
+    for (int k = 0; k < 4; ++k)
+        sourceShifts[k] = _mm_cvtsi32_si128(sources[k] * 8);
+
+    for (; i + 4u <= pixelCount; i += 4u)
+    {
+        auto* const   ptr   = reinterpret_cast<__m128i*>(pixels + i * 4u);
+        const __m128i block = _mm_loadu_si128(ptr);
+
+        __m128i result = _mm_srl_epi32(block, sourceShifts[3]);
+        result         = _mm_slli_epi32(result, 24);
+
+        for (int k = 0; k < 3; ++k)
+        {
+            const __m128i channel = _mm_and_si128(_mm_srl_epi32(block, sourceShifts[k]), _mm_set1_epi32(0xFF));
+            result                = _mm_or_si128(result, _mm_sll_epi32(channel, _mm_cvtsi32_si128(k * 8)));
+        }
+
+        _mm_storeu_si128(ptr, result);
+    }
+#endif
+
+    for (; i < pixelCount; ++i)
+    {
+        sf::base::U8*      pixel = pixels + i * 4u;
+        const sf::base::U8 original[4]{pixel[0], pixel[1], pixel[2], pixel[3]};
+
+        for (int k = 0; k < 4; ++k)
+            pixel[k] = original[sources[k]];
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+/// Source pixels contributing to each destination pixel along
+/// one axis, and their weights. Every destination pixel uses
+/// the same number of taps, padded with zero weights, so that
+/// the inner loops have a fixed trip count.
+///
+////////////////////////////////////////////////////////////
+struct ResampleContributions
+{
+    sf::base::TrivialVector<unsigned int> firsts;     //!< First source pixel of each destination pixel
+    sf::base::TrivialVector<float>        weights;    //!< `tapCount` normalized weights per destination pixel
+    unsigned int                          tapCount{}; //!< Number of source pixels per destination pixel
+};
+
+
+////////////////////////////////////////////////////////////
+[[nodiscard]] float evaluateResampleKernel(sf::Image::ResampleFilter filter, float x)
+{
+    x = sf::base::fabs(x);
+
+    if (filter == sf::Image::ResampleFilter::Bilinear)
+        return x < 1.f ? 1.f - x : 0.f;
+
+    SFML_BASE_ASSERT(filter == sf::Image::ResampleFilter::Lanczos3);
+
+    if (x >= 3.f)
+        return 0.f;
+
+    if (x < 1e-5f)
+        return 1.f;
+
+    const float px = sf::base::pi * x;
+    return 3.f * sf::base::sin(px) * sf::base::sin(px / 3.f) / (px * px);
+}
+
+
+////////////////////////////////////////////////////////////
+[[nodiscard]] ResampleContributions computeResampleContributions(unsigned int              srcSize,
+                                                                 unsigned int              dstSize,
+                                                                 sf::Image::ResampleFilter filter)
+{
+    const float scale = static_cast<float>(srcSize) / static_cast<float>(dstSize);
+
+    // When downscaling, the kernel is stretched to cover all the source pixels that map to a destination pixel
+    const float filterScale = sf::base::max(scale, 1.f);
+
+    const float radius = filter == sf::Image::ResampleFilter::Box        ? 0.5f
+                         : filter == sf::Image::ResampleFilter::Bilinear ? 1.f
+                                                                         : 3.f;
+
+    const float support = radius * filterScale;
+
+    const auto getCenter = [&](unsigned int dst) { return (static_cast<float>(dst) + 0.5f) * scale; };
+
+    ResampleContributions result;
+    result.firsts.resize(dstSize);
+
+    // First pass: find the range of source pixels under each destination pixel
+    for (unsigned int dst = 0u; dst < dstSize; ++dst)
+    {
+        const float center = getCenter(dst);
+        const auto  first  = sf::base::max(static_cast<int>(sf::base::floor(center - support)), 0);
+        const auto  last   = sf::base::min(static_cast<int>(sf::base::ceil(center + support)) - 1,
+                                        static_cast<int>(srcSize) - 1);
+
+        result.firsts[dst] = static_cast<unsigned int>(first);
+        result.tapCount    = sf::base::max(result.tapCount, static_cast<unsigned int>(last - first + 1));
+    }
+
+    result.weights.resize(static_cast<sf::base::SizeT>(dstSize) * result.tapCount);
+
+    // Second pass: shift the windows that would end past the border, then weigh their pixels
+    for (unsigned int dst = 0u; dst < dstSize; ++dst)
+    {
+        const float  center  = getCenter(dst);
+        unsigned int first   = sf::base::min(result.firsts[dst], srcSize - result.tapCount);
+        float*       weights = result.weights.data() + static_cast<sf::base::SizeT>(dst) * result.tapCount;
+        float        sum     = 0.f;
+
+        result.firsts[dst] = first;
+
+        for (unsigned int tap = 0u; tap < result.tapCount; ++tap)
+        {
+            const auto src = static_cast<float>(first + tap);
+
+            if (filter == sf::Image::ResampleFilter::Box)
+            {
+                // Area of the source pixel covered by the box
+                const float overlap = sf::base::min(src + 1.f, center + support) - sf::base::max(src, center - support);
+                weights[tap]        = sf::base::max(overlap, 0.f);
+            }
+            else
+            {
+                weights[tap] = evaluateResampleKernel(filter, (src + 0.5f - center) / filterScale);
+            }
+
+            sum += weights[tap];
+        }
+
+        // Normalize, which also accounts for the taps clipped at the borders
+        for (unsigned int tap = 0u; tap < result.tapCount; ++tap)
+            weights[tap] /= sum;
+    }
+
+    return result;
+}
+
+
+////////////////////////////////////////////////////////////
+/// Resample the destination rows in `[rowBegin, rowEnd)`
+///
+/// Each row is first filtered vertically into `rowBuffer`, which
+/// holds one row of the source as floats, then horizontally one
+/// pixel (i.e. four components) per vector.
+///
+////////////////////////////////////////////////////////////
+void resampleRows(const sf::base::U8*          src,
+                  sf::Vector2u                 srcSize,
+                  sf::base::U8*                dst,
+                  sf::Vector2u                 dstSize,
+                  const ResampleContributions& horizontal,
+                  const ResampleContributions& vertical,
+                  sf::base::SizeT              rowBegin,
+                  sf::base::SizeT              rowEnd,
+                  float*                       rowBuffer)
+{
+    const sf::base::SizeT srcRowLength = static_cast<sf::base::SizeT>(srcSize.x) * 4u;
+    const sf::base::SizeT dstRowLength = static_cast<sf::base::SizeT>(dstSize.x) * 4u;
+
+    const sf::base::F32x4 zero    = sf::base::F32x4::zero();
+    const sf::base::F32x4 maximum = sf::base::F32x4::broadcast(255.f);
+    const sf::base::F32x4 half    = sf::base::F32x4::broadcast(0.5f);
+
+    for (sf::base::SizeT y = rowBegin; y < rowEnd; ++y)
+    {
+        // Vertical pass, written as plain loops over the whole row so that the compiler vectorizes them
+        const sf::base::U8* srcRows = src + vertical.firsts[y] * srcRowLength;
+        const float*        weightsY = vertical.weights.data() + y * vertical.tapCount;
+
+        for (sf::base::SizeT i = 0u; i < srcRowLength; ++i)
+            rowBuffer[i] = weightsY[0] * static_cast<float>(srcRows[i]);
+
+        for (unsigned int tap = 1u; tap < vertical.tapCount; ++tap)
+        {
+            const float weight = weightsY[tap];
+
+            if (weight == 0.f)
+                continue;
+
+            const sf::base::U8* srcRow = srcRows + tap * srcRowLength;
+
+            for (sf::base::SizeT i = 0u; i < srcRowLength; ++i)
+                rowBuffer[i] += weight * static_cast<float>(srcRow[i]);
+        }
+
+        // Horizontal pass
+        sf::base::U8* dstRow = dst + y * dstRowLength;
+
+        for (sf::base::SizeT x = 0u; x < dstSize.x; ++x)
+        {
+            const float* rowPixels = rowBuffer + horizontal.firsts[x] * 4u;
+            const float* weightsX  = horizontal.weights.data() + x * horizontal.tapCount;
+
+            sf::base::F32x4 sum = zero;
+
+            for (unsigned int tap = 0u; tap < horizontal.tapCount; ++tap)
+                sum = sf::base::F32x4::mulAdd(sf::base::F32x4::load(rowPixels + tap * 4u),
+                                              sf::base::F32x4::broadcast(weightsX[tap]),
+                                              sum);
+
+            // Clamp the overshoot of the Lanczos filter, then round to the nearest integer
+            const sf::base::F32x4 rounded = sf::base::F32x4::min(sf::base::F32x4::max(sum, zero), maximum) + half;
+
+#if defined(SFML_BASE_SIMD_SSE2)
+            const __m128i words = _mm_packs_epi32(_mm_cvttps_epi32(rounded.value), _mm_setzero_si128());
+            storePixel(dstRow + x * 4u, static_cast<sf::base::U32>(_mm_cvtsi128_si32(_mm_packus_epi16(words, words))));
+#else
+            float components[4];
+            rounded.store(components);
+
+            for (int k = 0; k < 4; ++k)
+                dstRow[x * 4u + static_cast<sf::base::SizeT>(k)] = static_cast<sf::base::U8>(components[k]);
+#endif
+        }
+    }
+}
+
 } // namespace
 
 
@@ -89,16 +677,7 @@ base::Optional<Image> Image::create(Vector2u size, Color color)
     result.emplace(base::PassKey<Image>{}, size, static_cast<base::SizeT>(size.x) * static_cast<base::SizeT>(size.y) * 4);
 
     // Fill it with the specified color
-    base::U8*       ptr = result->m_pixels.data();
-    base::U8* const end = ptr + result->m_pixels.size();
-
-    while (ptr != end)
-    {
-        *ptr++ = color.r;
-        *ptr++ = color.g;
-        *ptr++ = color.b;
-        *ptr++ = color.a;
-    }
+    fillPixels(result->m_pixels.data(), result->m_pixels.size() / 4u, packPixel(color));
 
     return result;
 }
@@ -266,15 +845,24 @@ void Image::createMaskFromColor(Color color, base::U8 alpha)
     SFML_BASE_ASSERT(!m_pixels.empty());
 
     // Replace the alpha of the pixels that match the transparent color
-    base::U8* ptr = m_pixels.data();
-    base::U8* end = ptr + m_pixels.size();
+    replaceMatchingPixels(m_pixels.data(),
+                          m_pixels.size() / 4u,
+                          packPixel(color),
+                          /* keepMask */ packPixel(0xFF, 0xFF, 0xFF, 0x00),
+                          /* replacement */ packPixel(0x00, 0x00, 0x00, alpha));
+}
 
-    while (ptr != end)
-    {
-        if ((ptr[0] == color.r) && (ptr[1] == color.g) && (ptr[2] == color.b) && (ptr[3] == color.a))
-            ptr[3] = alpha;
-        ptr += 4;
-    }
+
+////////////////////////////////////////////////////////////
+void Image::replaceColor(Color color, Color replacement)
+{
+    SFML_BASE_ASSERT(!m_pixels.empty());
+
+    replaceMatchingPixels(m_pixels.data(),
+                          m_pixels.size() / 4u,
+                          packPixel(color),
+                          /* keepMask */ 0u,
+                          packPixel(replacement));
 }
 
 
@@ -322,29 +910,10 @@ bool Image::copy(const Image& source, Vector2u dest, const IntRect& sourceRect,
     // Copy the pixels
     if (applyAlpha)
     {
-        // Interpolation using alpha values, pixel by pixel (slower)
+        // Interpolation using alpha values, row by row
         for (unsigned int i = 0; i < dstSize.y; ++i)
         {
-            for (unsigned int j = 0; j < dstSize.x; ++j)
-            {
-                // Get a direct pointer to the components of the current pixel
-                const base::U8* src = srcPixels + j * 4;
-                base::U8*       dst = dstPixels + j * 4;
-
-                // Interpolate RGBA components using the alpha values of the destination and source pixels
-                const base::U8 srcAlpha = src[3];
-                const base::U8 dstAlpha = dst[3];
-                const auto     outAlpha = static_cast<base::U8>(srcAlpha + dstAlpha - srcAlpha * dstAlpha / 255);
-
-                dst[3] = outAlpha;
-
-                if (outAlpha)
-                    for (int k = 0; k < 3; k++)
-                        dst[k] = static_cast<base::U8>((src[k] * srcAlpha + dst[k] * (outAlpha - srcAlpha)) / outAlpha);
-                else
-                    for (int k = 0; k < 3; k++)
-                        dst[k] = src[k];
-            }
+            blendRowOver(srcPixels, dstPixels, dstSize.x);
 
             srcPixels += srcStride;
             dstPixels += dstStride;
@@ -410,18 +979,7 @@ void Image::flipHorizontally()
     const base::SizeT rowSize = m_size.x * 4;
 
     for (base::SizeT y = 0; y < m_size.y; ++y)
-    {
-        auto* left  = m_pixels.begin() + static_cast<base::PtrDiffT>(y * rowSize);
-        auto* right = m_pixels.begin() + static_cast<base::PtrDiffT>((y + 1) * rowSize - 4);
-
-        for (base::SizeT x = 0; x < m_size.x / 2; ++x)
-        {
-            base::swapRanges(left, left + 4, right);
-
-            left += 4;
-            right -= 4;
-        }
-    }
+        reversePixels(m_pixels.data() + y * rowSize, m_size.x);
 }
 
 
@@ -437,11 +995,109 @@ void Image::flipVertically()
 
     for (base::SizeT y = 0; y < m_size.y / 2; ++y)
     {
-        base::swapRanges(top, top + rowSize, bottom);
+        swapBytes(top, bottom, static_cast<base::SizeT>(rowSize));
 
         top += rowSize;
         bottom -= rowSize;
     }
 }
 
+
+////////////////////////////////////////////////////////////
+void Image::fillRect(const IntRect& rect, Color color)
+{
+    SFML_BASE_ASSERT(!m_pixels.empty());
+
+    // Clip the rectangle to the image
+    const int left   = base::max(rect.position.x, 0);
+    const int top    = base::max(rect.position.y, 0);
+    const int right  = base::min(rect.position.x + rect.size.x, static_cast<int>(m_size.x));
+    const int bottom = base::min(rect.position.y + rect.size.y, static_cast<int>(m_size.y));
+
+    if (left >= right || top >= bottom)
+        return;
+
+    const base::U32 pixel = packPixel(color);
+
+    for (int y = top; y < bottom; ++y)
+        fillPixels(m_pixels.data() + (static_cast<base::SizeT>(y) * m_size.x + static_cast<base::SizeT>(left)) * 4u,
+                   static_cast<base::SizeT>(right - left),
+                   pixel);
+}
+
+
+////////////////////////////////////////////////////////////
+void Image::premultiplyAlpha()
+{
+    SFML_BASE_ASSERT(!m_pixels.empty());
+    premultiplyPixels(m_pixels.data(), m_pixels.size() / 4u);
+}
+
+
+////////////////////////////////////////////////////////////
+void Image::unpremultiplyAlpha()
+{
+    SFML_BASE_ASSERT(!m_pixels.empty());
+    unpremultiplyPixels(m_pixels.data(), m_pixels.size() / 4u);
+}
+
+
+////////////////////////////////////////////////////////////
+void Image::swizzleChannels(base::U8 red, base::U8 green, base::U8 blue, base::U8 alpha)
+{
+    SFML_BASE_ASSERT(!m_pixels.empty());
+    SFML_BASE_ASSERT(red < 4 && green < 4 && blue < 4 && alpha < 4 && "Image::swizzleChannels() channel out of range");
+
+    const base::U8 sources[4]{red, green, blue, alpha};
+    swizzlePixels(m_pixels.data(), m_pixels.size() / 4u, sources);
+}
+
+
+////////////////////////////////////////////////////////////
+base::Optional<Image> Image::resized(Vector2u size, ResampleFilter filter, JobSystem* jobSystem) const
+{
+    base::Optional<Image> result; // Use a single local variable for NRVO
+
+    if (size.x == 0 || size.y == 0)
+    {
+        priv::err() << "Failed to resize image, invalid size (zero) provided";
+        return result; // Empty optional
+    }
+
+    SFML_BASE_ASSERT(!m_pixels.empty());
+
+    result.emplace(base::PassKey<Image>{}, size, static_cast<base::SizeT>(size.x) * static_cast<base::SizeT>(size.y) * 4);
+
+    const ResampleContributions horizontal = computeResampleContributions(m_size.x, size.x, filter);
+    const ResampleContributions vertical   = computeResampleContributions(m_size.y, size.y, filter);
+
+    const auto resampleBand = [&](base::SizeT rowBegin, base::SizeT rowEnd)
+    {
+        base::TrivialVector<float> rowBuffer(static_cast<base::SizeT>(m_size.x) * 4u);
+
+        resampleRows(m_pixels.data(),
+                     m_size,
+                     result->m_pixels.data(),
+                     size,
+                     horizontal,
+                     vertical,
+                     rowBegin,
+                     rowEnd,
+                     rowBuffer.data());
+    };
+
+    if (jobSystem == nullptr)
+    {
+        resampleBand(0u, size.y);
+        return result;
+    }
+
+    // Bands of roughly 64K source components, so that the scheduling overhead stays negligible
+    const base::SizeT bandCost    = base::SizeT{m_size.x} * 4u * vertical.tapCount;
+    const base::SizeT rowsPerBand = base::max(base::SizeT{1u}, base::SizeT{65'536u} / bandCost);
+
+    jobSystem->parallelFor(size.y, rowsPerBand, resampleBand);
+    return result;
+}
+
 } // namespace sf
@@ -11,6 +11,7 @@
 #include "SFML/System/PathUtils.hpp"
 #include "SFML/System/Vector2.hpp"
 
+#include "SFML/Base/Algorithm.hpp"
 #include "SFML/Base/Assert.hpp"
 
 #define STB_IMAGE_WRITE_STATIC
@@ -109,4 +110,29 @@ std::vector<base::U8> ImageUtils::saveToMemory(const Image& image, SaveFormat fo
     return buffer;
 }
 
+
+////////////////////////////////////////////////////////////
+std::vector<Image> ImageUtils::generateMipChain(const Image& image, JobSystem* jobSystem, Image::ResampleFilter filter)
+{
+    std::vector<Image> levels; // Use a single local variable for NRVO
+
+    Vector2u size = image.getSize();
+
+    const unsigned int largestDimension = base::max(size.x, size.y);
+
+    unsigned int levelCount = 0u;
+    for (unsigned int dimension = largestDimension; dimension > 1u; dimension /= 2u)
+        ++levelCount;
+
+    levels.reserve(levelCount);
+
+    while (size.x > 1u || size.y > 1u)
+    {
+        size = {base::max(size.x / 2u, 1u), base::max(size.y / 2u, 1u)};
+        levels.push_back((levels.empty() ? image : levels.back()).resized(size, filter, jobSystem).value());
+    }
+
+    return levels;
+}
+
 } // namespace sf
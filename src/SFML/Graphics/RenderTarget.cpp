@@ -19,6 +19,7 @@
 #include "SFML/Graphics/Sprite.hpp"
 #include "SFML/Graphics/StencilMode.hpp"
 #include "SFML/Graphics/Texture.hpp"
+#include "SFML/Graphics/TextureArray.hpp"
 #include "SFML/Graphics/Transform.hpp"
 #include "SFML/Graphics/Vertex.hpp"
 #include "SFML/Graphics/VertexBuffer.hpp"
@@ -591,12 +592,39 @@ void RenderTarget::draw(const CPUDrawableBatch& drawableBatch, RenderStates stat
 {
     states.transform *= drawableBatch.getTransform();
 
-    drawIndexedVertices(drawableBatch.m_storage.vertices.data(),
-                        drawableBatch.m_storage.vertices.size(),
-                        drawableBatch.m_storage.indices.data(),
-                        drawableBatch.m_storage.indices.size(),
-                        PrimitiveType::Triangles,
-                        states);
+    // Distance field glyphs are drawn by a dedicated shader, as in `Text::draw`
+    if (drawableBatch.m_sdfText && states.shader == nullptr)
+        states.shader = &m_impl->graphicsContext->getBuiltInSdfTextShader();
+
+    const auto& vertices = drawableBatch.m_storage.vertices;
+    const auto& indices  = drawableBatch.m_storage.indices;
+
+    if (drawableBatch.m_textureRuns.empty())
+    {
+        drawIndexedVertices(vertices.data(),
+                            vertices.size(),
+                            indices.data(),
+                            indices.size(),
+                            PrimitiveType::Triangles,
+                            states);
+        return;
+    }
+
+    // Nothing to draw or inactive target
+    if (indices.empty() || !setActive(true))
+        return;
+
+    // Upload the whole batch once, each texture run then draws a range of it
+    setupDraw(/* persistent */ false, states);
+
+    RenderTargetImpl::streamVerticesToGPU(m_impl->vaoGroup.vbo.getId(), vertices.data(), vertices.size());
+    RenderTargetImpl::streamIndicesToGPU(m_impl->vaoGroup.ebo.getId(), indices.data(), indices.size());
+
+    drawTextureRuns(/* persistent */ false,
+                    drawableBatch.m_textureRuns.data(),
+                    drawableBatch.m_textureRuns.size(),
+                    indices.size(),
+                    states);
 }
 
 
@@ -604,7 +632,57 @@ void RenderTarget::draw(const CPUDrawableBatch& drawableBatch, RenderStates stat
 void RenderTarget::draw(const PersistentGPUDrawableBatch& drawableBatch, RenderStates states)
 {
     states.transform *= drawableBatch.getTransform();
-    drawPersistentMappedIndexedVertices(drawableBatch.m_storage.nIndices, PrimitiveType::Triangles, states);
+
+    // Distance field glyphs are drawn by a dedicated shader, as in `Text::draw`
+    if (drawableBatch.m_sdfText && states.shader == nullptr)
+        states.shader = &m_impl->graphicsContext->getBuiltInSdfTextShader();
+
+    if (drawableBatch.m_textureRuns.empty())
+    {
+        drawPersistentMappedIndexedVertices(drawableBatch.m_storage.nIndices, PrimitiveType::Triangles, states);
+        return;
+    }
+
+    // Nothing to draw or inactive target
+    if (drawableBatch.m_storage.nIndices == 0u || !setActive(true))
+        return;
+
+    GLSyncGuard syncGuard;
+
+    drawTextureRuns(/* persistent */ true,
+                    drawableBatch.m_textureRuns.data(),
+                    drawableBatch.m_textureRuns.size(),
+                    drawableBatch.m_storage.nIndices,
+                    states);
+}
+
+
+////////////////////////////////////////////////////////////
+void RenderTarget::drawTextureRuns(
+    bool                    persistent,
+    const priv::TextureRun* runs,
+    base::SizeT             runCount,
+    base::SizeT             indexCount,
+    const RenderStates&     states)
+{
+    for (base::SizeT i = 0u; i < runCount; ++i)
+    {
+        const priv::TextureRun& run      = runs[i];
+        const base::SizeT       endIndex = i + 1u < runCount ? runs[i + 1u].firstIndex : indexCount;
+
+        RenderStates runStates = states;
+
+        if (run.texture != nullptr)
+        {
+            runStates.texture        = run.texture;
+            runStates.textureArray   = nullptr;
+            runStates.coordinateType = CoordinateType::Pixels;
+        }
+
+        setupDraw(persistent, runStates);
+        drawIndexedPrimitives(PrimitiveType::Triangles, endIndex - run.firstIndex, run.firstIndex);
+        cleanupDraw(runStates);
+    }
 }
 
 
@@ -896,7 +974,11 @@ void RenderTarget::setupDraw(bool persistent, const RenderStates& states)
     }
 
     // Select shader to be used
-    const Shader& usedShader = states.shader != nullptr ? *states.shader : m_impl->graphicsContext->getBuiltInShader();
+    GraphicsContext& graphicsContext = *m_impl->graphicsContext;
+
+    const Shader& usedShader = states.shader != nullptr         ? *states.shader
+                               : states.textureArray != nullptr ? graphicsContext.getBuiltInTextureArrayShader()
+                                                                : graphicsContext.getBuiltInShader();
 
     // Update shader
     const auto usedNativeHandle = usedShader.getNativeHandle();
@@ -960,6 +1042,12 @@ void RenderTarget::setupDrawMVP(const RenderStates& states, const Transform& vie
 ////////////////////////////////////////////////////////////
 void RenderTarget::setupDrawTexture(const RenderStates& states, bool shaderChanged)
 {
+    if (states.textureArray != nullptr)
+    {
+        setupDrawTextureArray(*states.textureArray, shaderChanged);
+        return;
+    }
+
     // Select texture to be used
     const Texture& usedTexture = states.texture != nullptr ? *states.texture
                                                            : getGraphicsContext().getBuiltInWhiteDotTexture();
@@ -1001,6 +1089,34 @@ void RenderTarget::setupDrawTexture(const RenderStates& states, bool shaderChang
 }
 
 
+////////////////////////////////////////////////////////////
+void RenderTarget::setupDrawTextureArray(const TextureArray& textureArray, bool shaderChanged)
+{
+    // Texture array ids live in the upper half of the cache id space, so they never collide with texture ids
+    const base::U64 cacheId = (base::U64{1u} << 32u) | textureArray.m_cacheId;
+
+    if (m_impl->cache.enable && cacheId == m_impl->cache.lastTextureId && !shaderChanged)
+        return;
+
+    textureArray.bind(*m_impl->graphicsContext);
+
+    m_impl->cache.lastTextureId      = cacheId;
+    m_impl->cache.lastCoordinateType = CoordinateType::Pixels;
+
+    // The third parameter is the distance between layers along the X axis (see `TextureArray::getTextureRect`)
+    const auto            layerSize = textureArray.getLayerSize().toVector2f();
+    const Texture::Params elems{1.f / layerSize.x, 1.f / layerSize.y, layerSize.x + 1.f};
+
+    if (!shaderChanged && (m_impl->cache.enable && m_impl->cache.lastTextureParams == elems))
+        return;
+
+    m_impl->cache.lastTextureParams = elems;
+
+    // Upload uniform data to GPU (hardcoded layout location `1u` for `sf_u_texParams`)
+    glCheck(glUniform3f(1u, elems.a00, elems.a11, elems.a12));
+}
+
+
 ////////////////////////////////////////////////////////////
 void RenderTarget::drawPrimitives(PrimitiveType type, base::SizeT firstVertex, base::SizeT vertexCount)
 {
@@ -1011,14 +1127,14 @@ void RenderTarget::drawPrimitives(PrimitiveType type, base::SizeT firstVertex, b
 
 
 ////////////////////////////////////////////////////////////
-void RenderTarget::drawIndexedPrimitives(PrimitiveType type, base::SizeT indexCount)
+void RenderTarget::drawIndexedPrimitives(PrimitiveType type, base::SizeT indexCount, base::SizeT firstIndex)
 {
     static_assert(SFML_BASE_IS_SAME(IndexType, unsigned int));
 
     glCheck(glDrawElements(/* primitive type */ RenderTargetImpl::primitiveTypeToOpenGLMode(type),
                            /*    index count */ static_cast<GLsizei>(indexCount),
                            /*     index type */ GL_UNSIGNED_INT,
-                           /*   index offset */ nullptr));
+                           /*   index offset */ reinterpret_cast<const void*>(firstIndex * sizeof(IndexType))));
 }
 
 
@@ -8,7 +8,9 @@
 
 #include "SFML/Graphics/GraphicsContext.hpp"
 #include "SFML/Graphics/Shader.hpp"
+#include "SFML/Graphics/ShaderCache.hpp"
 #include "SFML/Graphics/Texture.hpp"
+#include "SFML/Graphics/UniformBlock.hpp"
 
 #include "SFML/Window/GLCheck.hpp"
 #include "SFML/Window/GLUtils.hpp"
@@ -301,15 +303,77 @@ precision mediump float;
     return {buffer.data(), buffer.size()};
 };
 
+
+#if defined(SFML_SYSTEM_EMSCRIPTEN)
+
+////////////////////////////////////////////////////////////
+// Program bound by `sf::Shader::bind`, tracked to avoid querying `GL_CURRENT_PROGRAM`
+thread_local GLhandle boundProgram{};
+
+
+////////////////////////////////////////////////////////////
+// WebGL 2 has no `glProgramUniform*`: uniforms can only be set on
+// the bound program, so switch to it temporarily if needed
+class [[nodiscard]] UniformBinder
+{
+public:
+    [[nodiscard, gnu::always_inline]] explicit UniformBinder(GLhandle program) : m_program(program)
+    {
+        if (m_program != boundProgram)
+            glCheck(glUseProgram(m_program));
+    }
+
+    [[gnu::always_inline]] ~UniformBinder()
+    {
+        if (m_program != boundProgram)
+            glCheck(glUseProgram(boundProgram));
+    }
+
+    UniformBinder(const UniformBinder&)            = delete;
+    UniformBinder& operator=(const UniformBinder&) = delete;
+
+private:
+    GLhandle m_program; //!< Program whose uniforms are being set
+};
+
+#endif
+
 } // namespace
 
 
+////////////////////////////////////////////////////////////
+// Set a uniform of `program` with `glProgramUniform<fnSuffix>`, or with
+// `glUniform<fnSuffix>` on the temporarily bound program where DSA is unavailable
+#if defined(SFML_SYSTEM_EMSCRIPTEN)
+
+#define SFML_PRIV_SET_PROGRAM_UNIFORM(fnSuffix, program, ...)   \
+    do                                                          \
+    {                                                           \
+        const UniformBinder binder{castToGlHandle(program)};    \
+        glCheck(glUniform##fnSuffix(__VA_ARGS__));              \
+    } while (false)
+
+#else
+
+#define SFML_PRIV_SET_PROGRAM_UNIFORM(fnSuffix, program, ...) \
+    glCheck(glProgramUniform##fnSuffix(castToGlHandle(program), __VA_ARGS__))
+
+#endif
+
+
 namespace sf
 {
 struct Shader::Impl
 {
-    using TextureTable = std::unordered_map<int, const Texture*>;
-    using UniformTable = std::unordered_map<std::string, int, StringHash, StringEq>;
+    struct UniformBlockBinding
+    {
+        unsigned int        blockIndex; //!< Index of the uniform block in the program
+        const UniformBlock* block;      //!< Uniform block attached to it
+    };
+
+    using TextureTable      = std::unordered_map<int, const Texture*>;
+    using UniformTable      = std::unordered_map<std::string, int, StringHash, StringEq>;
+    using UniformBlockTable = base::TrivialVector<UniformBlockBinding>;
 
     GraphicsContext* graphicsContext;
     unsigned int     shaderProgram{};    //!< OpenGL identifier for the program
@@ -319,6 +383,8 @@ struct Shader::Impl
     mutable TextureTable textures; //!< Texture variables in the shader, mapped to their location
     mutable UniformTable uniforms; //!< Parameters location cache
 
+    UniformBlockTable uniformBlocks; //!< Uniform blocks attached to the shader
+
     explicit Impl(GraphicsContext& theGraphicsContext, unsigned int theShaderProgram) :
     graphicsContext(&theGraphicsContext),
     shaderProgram(theShaderProgram)
@@ -330,7 +396,8 @@ struct Shader::Impl
     shaderProgram(base::exchange(rhs.shaderProgram, 0u)),
     currentTexture(base::exchange(rhs.currentTexture, -1)),
     textures(SFML_BASE_MOVE(rhs.textures)),
-    uniforms(SFML_BASE_MOVE(rhs.uniforms))
+    uniforms(SFML_BASE_MOVE(rhs.uniforms)),
+    uniformBlocks(SFML_BASE_MOVE(rhs.uniformBlocks))
     {
     }
 };
@@ -343,55 +410,6 @@ Shader::UniformLocation::UniformLocation(int location) : m_value(location)
 }
 
 
-////////////////////////////////////////////////////////////
-class [[nodiscard]] Shader::UniformBinder
-{
-public:
-    ////////////////////////////////////////////////////////////
-    /// \brief Constructor: set up state before uniform is set
-    ///
-    ////////////////////////////////////////////////////////////
-    [[nodiscard, gnu::always_inline]] explicit UniformBinder(unsigned int shaderProgram) :
-    m_currentProgram(static_cast<GLhandle>(castToGlHandle(shaderProgram)))
-    {
-        SFML_BASE_ASSERT(m_currentProgram != 0);
-
-        // Enable program object
-        glCheck(glGetIntegerv(GL_CURRENT_PROGRAM, reinterpret_cast<GLint*>(&m_savedProgram)));
-
-        if (m_currentProgram != m_savedProgram)
-            glCheck(glUseProgram(m_currentProgram));
-    }
-
-    ////////////////////////////////////////////////////////////
-    /// \brief Destructor: restore state after uniform is set
-    ///
-    ////////////////////////////////////////////////////////////
-    [[gnu::always_inline]] ~UniformBinder()
-    {
-        // Disable program object
-        if (m_currentProgram && (m_currentProgram != m_savedProgram))
-            glCheck(glUseProgram(m_savedProgram));
-    }
-
-    ////////////////////////////////////////////////////////////
-    /// \brief Deleted copy constructor
-    ///
-    ////////////////////////////////////////////////////////////
-    UniformBinder(const UniformBinder&) = delete;
-
-    ////////////////////////////////////////////////////////////
-    /// \brief Deleted copy assignment
-    ///
-    ////////////////////////////////////////////////////////////
-    UniformBinder& operator=(const UniformBinder&) = delete;
-
-private:
-    GLhandle m_currentProgram; //!< Handle to the program object of the modified `sf::Shader` instance
-    GLhandle m_savedProgram{}; //!< Handle to the previously active program object
-};
-
-
 ////////////////////////////////////////////////////////////
 Shader::~Shader()
 {
@@ -429,6 +447,7 @@ Shader& Shader::operator=(Shader&& right) noexcept
     m_impl->currentTexture = base::exchange(right.m_impl->currentTexture, -1);
     m_impl->textures       = SFML_BASE_MOVE(right.m_impl->textures);
     m_impl->uniforms       = SFML_BASE_MOVE(right.m_impl->uniforms);
+    m_impl->uniformBlocks  = SFML_BASE_MOVE(right.m_impl->uniformBlocks);
 
     return *this;
 }
@@ -697,64 +716,56 @@ base::Optional<Shader::UniformLocation> Shader::getUniformLocation(base::StringV
 ////////////////////////////////////////////////////////////
 void Shader::setUniform(UniformLocation location, float x) const
 {
-    const UniformBinder binder{m_impl->shaderProgram};
-    glCheck(glUniform1f(location.m_value, x));
+    SFML_PRIV_SET_PROGRAM_UNIFORM(1f, m_impl->shaderProgram, location.m_value, x);
 }
 
 
 ////////////////////////////////////////////////////////////
 void Shader::setUniform(UniformLocation location, Glsl::Vec2 v) const
 {
-    const UniformBinder binder{m_impl->shaderProgram};
-    glCheck(glUniform2f(location.m_value, v.x, v.y));
+    SFML_PRIV_SET_PROGRAM_UNIFORM(2f, m_impl->shaderProgram, location.m_value, v.x, v.y);
 }
 
 
 ////////////////////////////////////////////////////////////
 void Shader::setUniform(UniformLocation location, const Glsl::Vec3& v) const
 {
-    const UniformBinder binder{m_impl->shaderProgram};
-    glCheck(glUniform3f(location.m_value, v.x, v.y, v.z));
+    SFML_PRIV_SET_PROGRAM_UNIFORM(3f, m_impl->shaderProgram, location.m_value, v.x, v.y, v.z);
 }
 
 
 ////////////////////////////////////////////////////////////
 void Shader::setUniform(UniformLocation location, const Glsl::Vec4& v) const
 {
-    const UniformBinder binder{m_impl->shaderProgram};
-    glCheck(glUniform4f(location.m_value, v.x, v.y, v.z, v.w));
+    SFML_PRIV_SET_PROGRAM_UNIFORM(4f, m_impl->shaderProgram, location.m_value, v.x, v.y, v.z, v.w);
 }
 
 
 ////////////////////////////////////////////////////////////
 void Shader::setUniform(UniformLocation location, int x) const
 {
-    const UniformBinder binder{m_impl->shaderProgram};
-    glCheck(glUniform1i(location.m_value, x));
+    SFML_PRIV_SET_PROGRAM_UNIFORM(1i, m_impl->shaderProgram, location.m_value, x);
 }
 
 
 ////////////////////////////////////////////////////////////
 void Shader::setUniform(UniformLocation location, Glsl::Ivec2 v) const
 {
-    const UniformBinder binder{m_impl->shaderProgram};
-    glCheck(glUniform2i(location.m_value, v.x, v.y));
+    SFML_PRIV_SET_PROGRAM_UNIFORM(2i, m_impl->shaderProgram, location.m_value, v.x, v.y);
 }
 
 
 ////////////////////////////////////////////////////////////
 void Shader::setUniform(UniformLocation location, const Glsl::Ivec3& v) const
 {
-    const UniformBinder binder{m_impl->shaderProgram};
-    glCheck(glUniform3i(location.m_value, v.x, v.y, v.z));
+    SFML_PRIV_SET_PROGRAM_UNIFORM(3i, m_impl->shaderProgram, location.m_value, v.x, v.y, v.z);
 }
 
 
 ////////////////////////////////////////////////////////////
 void Shader::setUniform(UniformLocation location, const Glsl::Ivec4& v) const
 {
-    const UniformBinder binder{m_impl->shaderProgram};
-    glCheck(glUniform4i(location.m_value, v.x, v.y, v.z, v.w));
+    SFML_PRIV_SET_PROGRAM_UNIFORM(4i, m_impl->shaderProgram, location.m_value, v.x, v.y, v.z, v.w);
 }
 
 
@@ -789,16 +800,14 @@ void Shader::setUniform(UniformLocation location, const Glsl::Bvec4& v) const
 ////////////////////////////////////////////////////////////
 void Shader::setUniform(UniformLocation location, const Glsl::Mat3& matrix) const
 {
-    const UniformBinder binder{m_impl->shaderProgram};
-    glCheck(glUniformMatrix3fv(location.m_value, 1, GL_FALSE, matrix.array));
+    SFML_PRIV_SET_PROGRAM_UNIFORM(Matrix3fv, m_impl->shaderProgram, location.m_value, 1, GL_FALSE, matrix.array);
 }
 
 
 ////////////////////////////////////////////////////////////
 void Shader::setMat4Uniform(UniformLocation location, const float* matrixPtr) const
 {
-    const UniformBinder binder{m_impl->shaderProgram};
-    glCheck(glUniformMatrix4fv(location.m_value, 1, GL_FALSE, matrixPtr));
+    SFML_PRIV_SET_PROGRAM_UNIFORM(Matrix4fv, m_impl->shaderProgram, location.m_value, 1, GL_FALSE, matrixPtr);
 }
 
 
@@ -851,8 +860,11 @@ void Shader::setUniform(UniformLocation location, CurrentTextureType)
 ////////////////////////////////////////////////////////////
 void Shader::setUniformArray(UniformLocation location, const float* scalarArray, base::SizeT length)
 {
-    const UniformBinder binder{m_impl->shaderProgram};
-    glCheck(glUniform1fv(location.m_value, static_cast<GLsizei>(length), scalarArray));
+    SFML_PRIV_SET_PROGRAM_UNIFORM(1fv,
+                                  m_impl->shaderProgram,
+                                  location.m_value,
+                                  static_cast<GLsizei>(length),
+                                  scalarArray);
 }
 
 
@@ -860,8 +872,12 @@ void Shader::setUniformArray(UniformLocation location, const float* scalarArray,
 void Shader::setUniformArray(UniformLocation location, const Glsl::Vec2* vectorArray, base::SizeT length)
 {
     base::TrivialVector<float> contiguous = flatten(vectorArray, length);
-    const UniformBinder        binder{m_impl->shaderProgram};
-    glCheck(glUniform2fv(location.m_value, static_cast<GLsizei>(length), contiguous.data()));
+
+    SFML_PRIV_SET_PROGRAM_UNIFORM(2fv,
+                                  m_impl->shaderProgram,
+                                  location.m_value,
+                                  static_cast<GLsizei>(length),
+                                  contiguous.data());
 }
 
 
@@ -869,8 +885,12 @@ void Shader::setUniformArray(UniformLocation location, const Glsl::Vec2* vectorA
 void Shader::setUniformArray(UniformLocation location, const Glsl::Vec3* vectorArray, base::SizeT length)
 {
     base::TrivialVector<float> contiguous = flatten(vectorArray, length);
-    const UniformBinder        binder{m_impl->shaderProgram};
-    glCheck(glUniform3fv(location.m_value, static_cast<GLsizei>(length), contiguous.data()));
+
+    SFML_PRIV_SET_PROGRAM_UNIFORM(3fv,
+                                  m_impl->shaderProgram,
+                                  location.m_value,
+                                  static_cast<GLsizei>(length),
+                                  contiguous.data());
 }
 
 
@@ -878,8 +898,12 @@ void Shader::setUniformArray(UniformLocation location, const Glsl::Vec3* vectorA
 void Shader::setUniformArray(UniformLocation location, const Glsl::Vec4* vectorArray, base::SizeT length)
 {
     base::TrivialVector<float> contiguous = flatten(vectorArray, length);
-    const UniformBinder        binder{m_impl->shaderProgram};
-    glCheck(glUniform4fv(location.m_value, static_cast<GLsizei>(length), contiguous.data()));
+
+    SFML_PRIV_SET_PROGRAM_UNIFORM(4fv,
+                                  m_impl->shaderProgram,
+                                  location.m_value,
+                                  static_cast<GLsizei>(length),
+                                  contiguous.data());
 }
 
 
@@ -893,8 +917,12 @@ void Shader::setUniformArray(UniformLocation location, const Glsl::Mat3* matrixA
     for (base::SizeT i = 0; i < length; ++i)
         priv::copyMatrix(matrixArray[i].array, matrixSize, &contiguous[matrixSize * i]);
 
-    const UniformBinder binder{m_impl->shaderProgram};
-    glCheck(glUniformMatrix3fv(location.m_value, static_cast<GLsizei>(length), GL_FALSE, contiguous.data()));
+    SFML_PRIV_SET_PROGRAM_UNIFORM(Matrix3fv,
+                                  m_impl->shaderProgram,
+                                  location.m_value,
+                                  static_cast<GLsizei>(length),
+                                  GL_FALSE,
+                                  contiguous.data());
 }
 
 
@@ -908,8 +936,55 @@ void Shader::setUniformArray(UniformLocation location, const Glsl::Mat4* matrixA
     for (base::SizeT i = 0; i < length; ++i)
         priv::copyMatrix(matrixArray[i].array, matrixSize, &contiguous[matrixSize * i]);
 
-    const UniformBinder binder{m_impl->shaderProgram};
-    glCheck(glUniformMatrix4fv(location.m_value, static_cast<GLsizei>(length), GL_FALSE, contiguous.data()));
+    SFML_PRIV_SET_PROGRAM_UNIFORM(Matrix4fv,
+                                  m_impl->shaderProgram,
+                                  location.m_value,
+                                  static_cast<GLsizei>(length),
+                                  GL_FALSE,
+                                  contiguous.data());
+}
+
+
+////////////////////////////////////////////////////////////
+#undef SFML_PRIV_SET_PROGRAM_UNIFORM
+
+
+////////////////////////////////////////////////////////////
+bool Shader::setUniformBlock(base::StringView blockName, const UniformBlock& block)
+{
+    SFML_BASE_ASSERT(m_impl->shaderProgram);
+    SFML_BASE_ASSERT(m_impl->graphicsContext->hasActiveThreadLocalOrSharedGlContext());
+
+    // Use thread-local string buffer to get a null-terminated block name
+    thread_local std::string blockNameBuffer;
+    blockNameBuffer.assign(blockName.data(), blockName.size());
+
+    const GLuint blockIndex = glCheck(
+        glGetUniformBlockIndex(castToGlHandle(m_impl->shaderProgram), blockNameBuffer.c_str()));
+
+    if (blockIndex == GL_INVALID_INDEX)
+    {
+        priv::err() << "Uniform block \"" << blockNameBuffer << "\" not found in shader";
+        return false;
+    }
+
+    glCheck(glUniformBlockBinding(castToGlHandle(m_impl->shaderProgram), blockIndex, block.getBindingPoint()));
+
+    // The binding point is context state, make it effective even if the shader is already bound
+    block.bind();
+
+    for (Impl::UniformBlockBinding& binding : m_impl->uniformBlocks)
+    {
+        if (binding.blockIndex == blockIndex)
+        {
+            // Block already attached, just replace it
+            binding.block = &block;
+            return true;
+        }
+    }
+
+    m_impl->uniformBlocks.emplaceBack(Impl::UniformBlockBinding{blockIndex, &block});
+    return true;
 }
 
 
@@ -930,9 +1005,16 @@ void Shader::bind() const
     SFML_BASE_ASSERT(glCheck(glIsProgram(castToGlHandle(m_impl->shaderProgram))));
     glCheck(glUseProgram(castToGlHandle(m_impl->shaderProgram)));
 
+#if defined(SFML_SYSTEM_EMSCRIPTEN)
+    boundProgram = castToGlHandle(m_impl->shaderProgram);
+#endif
+
     // Bind the textures
     bindTextures();
 
+    // Bind the uniform blocks
+    bindUniformBlocks();
+
     // Bind the current texture
     if (m_impl->currentTexture != -1)
         glCheck(glUniform1i(m_impl->currentTexture, 0));
@@ -944,6 +1026,10 @@ void Shader::unbind([[maybe_unused]] GraphicsContext& graphicsContext)
 {
     SFML_BASE_ASSERT(graphicsContext.hasActiveThreadLocalOrSharedGlContext());
     glCheck(glUseProgram({}));
+
+#if defined(SFML_SYSTEM_EMSCRIPTEN)
+    boundProgram = {};
+#endif
 }
 
 
@@ -983,10 +1069,36 @@ base::Optional<Shader> Shader::compile(GraphicsContext& graphicsContext,
         return base::nullOpt;
     }
 
+    if (vertexShaderCode.data() == nullptr)
+        vertexShaderCode = graphicsContext.getBuiltInShaderVertexSrc();
+
+    if (fragmentShaderCode.data() == nullptr)
+        fragmentShaderCode = graphicsContext.getBuiltInShaderFragmentSrc();
+
+    // Try to skip compilation entirely by loading a previously linked binary
+    const Path& cacheDirectory = graphicsContext.getShaderCacheDirectory();
+    const bool  useCache       = !cacheDirectory.empty() && priv::ShaderCache::isAvailable();
+
+    base::U64 cacheKey = 0u;
+
+    if (useCache)
+    {
+        cacheKey = priv::ShaderCache::computeKey(vertexShaderCode, geometryShaderCode, fragmentShaderCode);
+
+        if (const base::Optional<unsigned int> cachedProgram = priv::ShaderCache::loadProgram(cacheDirectory, cacheKey))
+        {
+            glCheck(glFlush());
+            return base::makeOptional<Shader>(base::PassKey<Shader>{}, graphicsContext, *cachedProgram);
+        }
+    }
+
     // Create the program
     const GLhandle shaderProgram = glCheck(glCreateProgram());
     SFML_BASE_ASSERT(glCheck(glIsProgram(shaderProgram)));
 
+    if (useCache)
+        glCheck(glProgramParameteri(shaderProgram, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE));
+
     const auto makeShader = [&](GLenum type, const char* typeStr, base::StringView shaderCode)
     {
         // Add `#version` (and float precision if required)
@@ -1026,9 +1138,6 @@ base::Optional<Shader> Shader::compile(GraphicsContext& graphicsContext,
         return true;
     };
 
-    if (vertexShaderCode.data() == nullptr)
-        vertexShaderCode = graphicsContext.getBuiltInShaderVertexSrc();
-
     if (!makeShader(GL_VERTEX_SHADER, "vertex", vertexShaderCode))
         return base::nullOpt;
 
@@ -1040,9 +1149,6 @@ base::Optional<Shader> Shader::compile(GraphicsContext& graphicsContext,
             return base::nullOpt;
     }
 
-    if (fragmentShaderCode.data() == nullptr)
-        fragmentShaderCode = graphicsContext.getBuiltInShaderFragmentSrc();
-
     // Create the fragment shader
     if (!makeShader(GL_FRAGMENT_SHADER, "fragment", fragmentShaderCode))
         return base::nullOpt;
@@ -1062,6 +1168,10 @@ base::Optional<Shader> Shader::compile(GraphicsContext& graphicsContext,
         return base::nullOpt;
     }
 
+    // A failed write only costs a recompilation on the next run
+    if (useCache)
+        (void)priv::ShaderCache::storeProgram(cacheDirectory, cacheKey, castFromGlHandle(shaderProgram));
+
     // Force an OpenGL flush, so that the shader will appear updated
     // in all contexts immediately (solves problems in multi-threaded apps)
     glCheck(glFlush());
@@ -1087,4 +1197,12 @@ void Shader::bindTextures() const
     glCheck(glActiveTexture(GL_TEXTURE0));
 }
 
+
+////////////////////////////////////////////////////////////
+void Shader::bindUniformBlocks() const
+{
+    for (const Impl::UniformBlockBinding& binding : m_impl->uniformBlocks)
+        binding.block->bind();
+}
+
 } // namespace sf
@@ -0,0 +1,224 @@
+#include <SFML/Copyright.hpp> // LICENSE AND COPYRIGHT (C) INFORMATION
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include "SFML/Graphics/ShaderCache.hpp"
+
+#include "SFML/Window/GLCheck.hpp"
+#include "SFML/Window/GLUtils.hpp"
+#include "SFML/Window/Glad.hpp"
+
+#include "SFML/System/Err.hpp"
+#include "SFML/System/Path.hpp"
+
+#include "SFML/Base/Builtins/Memcmp.hpp"
+#include "SFML/Base/Builtins/Strlen.hpp"
+#include "SFML/Base/TrivialVector.hpp"
+
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+
+namespace
+{
+// A nested named namespace is used here to allow unity builds of SFML.
+namespace ShaderCacheImpl
+{
+////////////////////////////////////////////////////////////
+constexpr char          magic[4]{'S', 'F', 'P', 'B'};
+constexpr sf::base::U32 formatVersion = 1u; // Bump whenever the file layout or key derivation changes
+
+
+////////////////////////////////////////////////////////////
+struct [[nodiscard]] FileHeader
+{
+    char          magic[4];
+    sf::base::U32 version;
+    sf::base::U64 key;
+    sf::base::U32 binaryFormat;
+    sf::base::U32 binaryLength;
+};
+
+
+////////////////////////////////////////////////////////////
+// 64-bit FNV-1a, stable across runs and platforms unlike `std::hash`
+struct [[nodiscard]] Fnv1a
+{
+    sf::base::U64 state{14'695'981'039'346'656'037ull};
+
+    void feed(const void* data, sf::base::SizeT size)
+    {
+        const auto* bytes = static_cast<const unsigned char*>(data);
+
+        for (sf::base::SizeT i = 0u; i < size; ++i)
+        {
+            state ^= bytes[i];
+            state *= 1'099'511'628'211ull;
+        }
+    }
+
+    void feedString(const char* str, sf::base::SizeT size)
+    {
+        // Prefix with the length so that adjacent strings cannot collide
+        const sf::base::U64 length = str == nullptr ? ~sf::base::U64{0u} : size;
+        feed(&length, sizeof(length));
+        feed(str, str == nullptr ? 0u : size);
+    }
+};
+
+
+////////////////////////////////////////////////////////////
+[[nodiscard]] std::string getEntryPath(const sf::Path& directory, sf::base::U64 key)
+{
+    char name[32]{};
+
+    for (int i = 15; i >= 0; --i, key >>= 4u)
+        name[i] = "0123456789abcdef"[key & 0xFu];
+
+    return (directory / (std::string(name, 16) + ".bin")).to<std::string>();
+}
+
+} // namespace ShaderCacheImpl
+} // namespace
+
+
+namespace sf::priv::ShaderCache
+{
+////////////////////////////////////////////////////////////
+bool isAvailable()
+{
+    // Some drivers expose the entry points but support no binary format at all
+    return getGLInteger(GL_NUM_PROGRAM_BINARY_FORMATS) > 0;
+}
+
+
+////////////////////////////////////////////////////////////
+base::U64 computeKey(base::StringView vertexShaderCode,
+                     base::StringView geometryShaderCode,
+                     base::StringView fragmentShaderCode)
+{
+    ShaderCacheImpl::Fnv1a hash;
+
+    hash.feed(&ShaderCacheImpl::formatVersion, sizeof(ShaderCacheImpl::formatVersion));
+
+    for (const GLenum name : {GL_VENDOR, GL_RENDERER, GL_VERSION})
+    {
+        const auto* str = reinterpret_cast<const char*>(glCheck(glGetString(name)));
+        hash.feedString(str, str == nullptr ? 0u : SFML_BASE_STRLEN(str));
+    }
+
+    hash.feedString(vertexShaderCode.data(), vertexShaderCode.size());
+    hash.feedString(geometryShaderCode.data(), geometryShaderCode.size());
+    hash.feedString(fragmentShaderCode.data(), fragmentShaderCode.size());
+
+    return hash.state;
+}
+
+
+////////////////////////////////////////////////////////////
+base::Optional<unsigned int> loadProgram(const Path& directory, base::U64 key)
+{
+    std::ifstream file(ShaderCacheImpl::getEntryPath(directory, key), std::ios_base::binary);
+
+    if (!file)
+        return base::nullOpt; // Cache miss
+
+    ShaderCacheImpl::FileHeader header{};
+
+    if (!file.read(reinterpret_cast<char*>(&header), sizeof(header)) ||
+        SFML_BASE_MEMCMP(header.magic, ShaderCacheImpl::magic, sizeof(header.magic)) != 0 ||
+        header.version != ShaderCacheImpl::formatVersion || header.key != key || header.binaryLength == 0u)
+    {
+        priv::err() << "Ignoring invalid shader cache entry for key " << key;
+        return base::nullOpt;
+    }
+
+    base::TrivialVector<char> binary(header.binaryLength);
+
+    if (!file.read(binary.data(), static_cast<std::streamsize>(binary.size())) || file.peek() != EOF)
+    {
+        priv::err() << "Ignoring truncated shader cache entry for key " << key;
+        return base::nullOpt;
+    }
+
+    const GLuint program = glCheck(glCreateProgram());
+
+    glCheck(glProgramBinary(program,
+                            static_cast<GLenum>(header.binaryFormat),
+                            binary.data(),
+                            static_cast<GLsizei>(binary.size())));
+
+    // The driver can reject binaries at any time (e.g. after an update that kept the same version string)
+    GLint success = GL_FALSE;
+    glCheck(glGetProgramiv(program, GL_LINK_STATUS, &success));
+
+    if (success == GL_FALSE)
+    {
+        glCheck(glDeleteProgram(program));
+        return base::nullOpt;
+    }
+
+    return base::makeOptional<unsigned int>(program);
+}
+
+
+////////////////////////////////////////////////////////////
+bool storeProgram(const Path& directory, base::U64 key, unsigned int program)
+{
+    GLint binaryLength = 0;
+    glCheck(glGetProgramiv(program, GL_PROGRAM_BINARY_LENGTH, &binaryLength));
+
+    if (binaryLength <= 0)
+        return false;
+
+    base::TrivialVector<char> binary(static_cast<base::SizeT>(binaryLength));
+
+    GLsizei writtenLength = 0;
+    GLenum  binaryFormat  = 0;
+    glCheck(glGetProgramBinary(program, binaryLength, &writtenLength, &binaryFormat, binary.data()));
+
+    if (writtenLength <= 0)
+        return false;
+
+    const ShaderCacheImpl::FileHeader header{{ShaderCacheImpl::magic[0],
+                                              ShaderCacheImpl::magic[1],
+                                              ShaderCacheImpl::magic[2],
+                                              ShaderCacheImpl::magic[3]},
+                                             ShaderCacheImpl::formatVersion,
+                                             key,
+                                             static_cast<base::U32>(binaryFormat),
+                                             static_cast<base::U32>(writtenLength)};
+
+    std::error_code error;
+    std::filesystem::create_directories(directory.to<std::string>(), error);
+
+    // Write to a temporary file first so that concurrent readers never observe a partial entry
+    const std::string entryPath = ShaderCacheImpl::getEntryPath(directory, key);
+    const std::string tempPath  = entryPath + ".tmp";
+
+    {
+        std::ofstream file(tempPath, std::ios_base::binary | std::ios_base::trunc);
+
+        if (!file.write(reinterpret_cast<const char*>(&header), sizeof(header)) ||
+            !file.write(binary.data(), static_cast<std::streamsize>(writtenLength)))
+        {
+            priv::err() << "Failed to write shader cache entry " << tempPath;
+            return false;
+        }
+    }
+
+    std::filesystem::rename(tempPath, entryPath, error);
+
+    if (error)
+    {
+        priv::err() << "Failed to store shader cache entry " << entryPath << ": " << error.message();
+        std::filesystem::remove(tempPath, error);
+        return false;
+    }
+
+    return true;
+}
+
+} // namespace sf::priv::ShaderCache
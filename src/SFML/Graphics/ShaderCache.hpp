@@ -0,0 +1,61 @@
+#pragma once
+#include <SFML/Copyright.hpp> // LICENSE AND COPYRIGHT (C) INFORMATION
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include "SFML/Base/IntTypes.hpp"
+#include "SFML/Base/Optional.hpp"
+#include "SFML/Base/StringView.hpp"
+
+
+////////////////////////////////////////////////////////////
+// Forward declarations
+////////////////////////////////////////////////////////////
+namespace sf
+{
+class Path;
+} // namespace sf
+
+
+namespace sf::priv::ShaderCache
+{
+////////////////////////////////////////////////////////////
+/// \brief Check if the current context can save and load program binaries
+///
+////////////////////////////////////////////////////////////
+[[nodiscard]] bool isAvailable();
+
+////////////////////////////////////////////////////////////
+/// \brief Compute the cache key of a program
+///
+/// The key covers the shader sources and the vendor, renderer
+/// and version strings of the current context, as binaries
+/// are only valid for the driver that produced them.
+///
+////////////////////////////////////////////////////////////
+[[nodiscard]] base::U64 computeKey(base::StringView vertexShaderCode,
+                                   base::StringView geometryShaderCode,
+                                   base::StringView fragmentShaderCode);
+
+////////////////////////////////////////////////////////////
+/// \brief Create a linked program from a cached binary
+///
+/// \return OpenGL program on success, `base::nullOpt` if there is no
+///         valid cache entry or the driver rejected the binary
+///
+////////////////////////////////////////////////////////////
+[[nodiscard]] base::Optional<unsigned int> loadProgram(const Path& directory, base::U64 key);
+
+////////////////////////////////////////////////////////////
+/// \brief Save the binary of a linked program to the cache
+///
+/// The program must have been linked with the
+/// `GL_PROGRAM_BINARY_RETRIEVABLE_HINT` parameter set.
+///
+/// \return `true` on success
+///
+////////////////////////////////////////////////////////////
+bool storeProgram(const Path& directory, base::U64 key, unsigned int program);
+
+} // namespace sf::priv::ShaderCache
@@ -9,6 +9,7 @@
 #include "SFML/Graphics/PrimitiveType.hpp"
 #include "SFML/Graphics/RenderStates.hpp"
 #include "SFML/Graphics/RenderTarget.hpp"
+#include "SFML/Graphics/Shader.hpp"
 #include "SFML/Graphics/Text.hpp"
 #include "SFML/Graphics/Vertex.hpp"
 
@@ -22,6 +23,7 @@
 #include "SFML/Base/Math/Floor.hpp"
 #include "SFML/Base/Math/Fmax.hpp"
 #include "SFML/Base/Math/Fmin.hpp"
+#include "SFML/Base/Optional.hpp"
 #include "SFML/Base/TrivialVector.hpp"
 
 
@@ -52,21 +54,27 @@ void addLine(sf::Vertex*      vertices,
     index += 6;
 }
 
-// Add a glyph quad to the vertex array
+// Add a glyph quad to the vertex array, extended by `texturePadding` texels
+// (distance field glyphs need their whole fall-off area to be drawn)
 void addGlyphQuad(sf::Vertex*      vertices,
                   sf::base::SizeT& index,
                   sf::Vector2f     position,
                   sf::Color        color,
                   const sf::Glyph& glyph,
-                  float            italicShear)
+                  float            italicShear,
+                  float            texturePadding)
 {
-    const sf::Vector2f padding(1.f, 1.f);
+    // Glyph bounds and texture rectangles only differ in size for scaled distance field glyphs
+    const float texelSize = glyph.textureRect.size.x > 0.f ? glyph.bounds.size.x / glyph.textureRect.size.x : 1.f;
+
+    const sf::Vector2f padding(texturePadding * texelSize, texturePadding * texelSize);
+    const sf::Vector2f uvPadding(texturePadding, texturePadding);
 
     const sf::Vector2f p1 = glyph.bounds.position - padding;
     const sf::Vector2f p2 = glyph.bounds.position + glyph.bounds.size + padding;
 
-    const auto uv1 = glyph.textureRect.position - padding;
-    const auto uv2 = (glyph.textureRect.position + glyph.textureRect.size) + padding;
+    const auto uv1 = glyph.textureRect.position - uvPadding;
+    const auto uv2 = (glyph.textureRect.position + glyph.textureRect.size) + uvPadding;
 
     auto* ptr = vertices + index;
 
@@ -370,6 +378,28 @@ void Text::draw(RenderTarget& target, RenderStates states) const
     states.texture        = &m_font->getTexture();
     states.coordinateType = CoordinateType::Pixels;
 
+    // Distance field glyphs are drawn, and outlined, by a dedicated shader
+    if (m_font->isSdf())
+    {
+        const Shader& sdfShader = m_font->getSdfShader();
+
+        if (states.shader == nullptr)
+            states.shader = &sdfShader;
+
+        if (states.shader == &sdfShader)
+        {
+            // Convert the thickness from pixels at the current size to distance field units
+            const float scale        = static_cast<float>(Font::sdfReferenceSize) / static_cast<float>(m_characterSize);
+            const float outlineWidth = m_outlineThickness * scale / (2.f * static_cast<float>(Font::sdfSpread));
+
+            if (const base::Optional ulOutlineColor = sdfShader.getUniformLocation("sf_u_outlineColor"))
+                sdfShader.setUniform(*ulOutlineColor, Glsl::Vec4{m_outlineColor});
+
+            if (const base::Optional ulOutlineWidth = sdfShader.getUniformLocation("sf_u_outlineWidth"))
+                sdfShader.setUniform(*ulOutlineWidth, outlineWidth);
+        }
+    }
+
     const auto [data, size] = getVertices();
     target.drawVertices(data, size, PrimitiveType::Triangles, states);
 }
@@ -422,12 +452,16 @@ void Text::ensureGeometryUpdate(const Font& font) const
     whitespaceWidth += letterSpacing;
     const float lineSpacing = font.getLineSpacing(m_characterSize) * m_lineSpacing;
 
+    // Distance field glyphs are outlined by their shader, and must be drawn with their whole fall-off area
+    const bool  hasOutlineQuads = m_outlineThickness != 0.f && !font.isSdf();
+    const float texturePadding  = font.isSdf() ? static_cast<float>(Font::sdfSpread) + 1.f : 1.f;
+
     // Precalculate the amount of quads that will be produced
     base::SizeT fillQuadCount    = 0;
     base::SizeT outlineQuadCount = 0;
 
     {
-        const auto addLinesFake = [&, outlineQuadIncrement = (m_outlineThickness == 0.f) ? 0u : 1u]
+        const auto addLinesFake = [&, outlineQuadIncrement = hasOutlineQuads ? 1u : 0u]
         {
             outlineQuadCount += outlineQuadIncrement;
             ++fillQuadCount;
@@ -502,11 +536,12 @@ void Text::ensureGeometryUpdate(const Font& font) const
 
     base::U32 prevChar = 0;
 
-    const auto addLines = [this, &currFillIndex, &currOutlineIndex, &x, &y, &underlineThickness](float offset)
+    const auto addLines = [this, &currFillIndex, &currOutlineIndex, &x, &y, &underlineThickness, hasOutlineQuads](
+                              float offset)
     {
         addLine(m_vertices.data(), currFillIndex, x, y, m_fillColor, offset, underlineThickness);
 
-        if (m_outlineThickness != 0.f)
+        if (hasOutlineQuads)
             addLine(m_vertices.data(), currOutlineIndex, x, y, m_outlineColor, offset, underlineThickness, m_outlineThickness);
     };
 
@@ -562,19 +597,25 @@ void Text::ensureGeometryUpdate(const Font& font) const
         }
 
         // Apply the outline
-        if (m_outlineThickness != 0.f)
+        if (hasOutlineQuads)
         {
             const Glyph& glyph = font.getGlyph(curChar, m_characterSize, isBold, m_outlineThickness);
 
             // Add the outline glyph to the vertices
-            addGlyphQuad(m_vertices.data(), currOutlineIndex, Vector2f{x, y}, m_outlineColor, glyph, italicShear);
+            addGlyphQuad(m_vertices.data(),
+                         currOutlineIndex,
+                         Vector2f{x, y},
+                         m_outlineColor,
+                         glyph,
+                         italicShear,
+                         texturePadding);
         }
 
         // Extract the current glyph's description
         const Glyph& glyph = font.getGlyph(curChar, m_characterSize, isBold);
 
         // Add the glyph to the vertices
-        addGlyphQuad(m_vertices.data(), currFillIndex, Vector2f{x, y}, m_fillColor, glyph, italicShear);
+        addGlyphQuad(m_vertices.data(), currFillIndex, Vector2f{x, y}, m_fillColor, glyph, italicShear, texturePadding);
 
         // Update the current bounds
         const Vector2f p1 = glyph.bounds.position;
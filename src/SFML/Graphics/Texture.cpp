@@ -20,6 +20,7 @@
 #include "SFML/Base/Algorithm.hpp"
 #include "SFML/Base/Assert.hpp"
 #include "SFML/Base/Macros.hpp"
+#include "SFML/Base/Span.hpp"
 #include "SFML/Base/TrivialVector.hpp"
 
 #ifdef SFML_OPENGL_ES
@@ -787,6 +788,9 @@ bool Texture::generateMipmap()
     const priv::TextureSaver save;
 
     glCheck(glBindTexture(GL_TEXTURE_2D, m_texture));
+
+    // Lift the limit left by a partial mipmap passed to `uploadMipmap`
+    glCheck(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, 1000));
     glCheck(glGenerateMipmap(GL_TEXTURE_2D));
     glCheck(glTexParameteri(GL_TEXTURE_2D,
                             GL_TEXTURE_MIN_FILTER,
@@ -798,6 +802,75 @@ bool Texture::generateMipmap()
 }
 
 
+////////////////////////////////////////////////////////////
+bool Texture::uploadMipmap(base::Span<const Image> levels)
+{
+    SFML_BASE_ASSERT(m_texture);
+    SFML_BASE_ASSERT(glCheck(glIsTexture(m_texture)));
+
+    // Number of levels below the base level, down to 1x1
+    base::SizeT maxLevelCount = 0u;
+    for (unsigned int dimension = base::max(m_size.x, m_size.y); dimension > 1u; dimension /= 2u)
+        ++maxLevelCount;
+
+    if (levels.size() == 0u || levels.size() > maxLevelCount)
+    {
+        priv::err() << "Failed to upload mipmap, invalid number of levels (" << levels.size() << ", maximum is "
+                    << maxLevelCount << ")";
+
+        return false;
+    }
+
+    for (base::SizeT i = 0u; i < levels.size(); ++i)
+    {
+        const auto     level = static_cast<unsigned int>(i + 1u);
+        const Vector2u expectedSize{base::max(m_size.x >> level, 1u), base::max(m_size.y >> level, 1u)};
+
+        if (levels[i].getSize() != expectedSize)
+        {
+            priv::err() << "Failed to upload mipmap, level " << level << " should have a size of " << expectedSize.x
+                        << "x" << expectedSize.y;
+
+            return false;
+        }
+    }
+
+    SFML_BASE_ASSERT(m_graphicsContext->hasActiveThreadLocalOrSharedGlContext());
+
+    // Make sure that the current texture binding will be preserved
+    const priv::TextureSaver save;
+
+    glCheck(glBindTexture(GL_TEXTURE_2D, m_texture));
+
+    for (base::SizeT i = 0u; i < levels.size(); ++i)
+    {
+        glCheck(glTexImage2D(GL_TEXTURE_2D,
+                             static_cast<GLint>(i + 1u),
+                             (m_sRgb ? GL_SRGB8_ALPHA8 : GL_RGBA),
+                             static_cast<GLsizei>(levels[i].getSize().x),
+                             static_cast<GLsizei>(levels[i].getSize().y),
+                             0,
+                             GL_RGBA,
+                             GL_UNSIGNED_BYTE,
+                             levels[i].getPixelsPtr()));
+    }
+
+    // Keep the texture complete if the chain stops before the 1x1 level
+    glCheck(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, static_cast<GLint>(levels.size())));
+    glCheck(glTexParameteri(GL_TEXTURE_2D,
+                            GL_TEXTURE_MIN_FILTER,
+                            m_isSmooth ? GL_LINEAR_MIPMAP_LINEAR : GL_NEAREST_MIPMAP_LINEAR));
+
+    m_hasMipmap = true;
+
+    // Force an OpenGL flush, so that the texture data will appear updated
+    // in all contexts immediately (solves problems in multi-threaded apps)
+    glCheck(glFlush());
+
+    return true;
+}
+
+
 ////////////////////////////////////////////////////////////
 void Texture::invalidateMipmap()
 {
@@ -0,0 +1,325 @@
+#include <SFML/Copyright.hpp> // LICENSE AND COPYRIGHT (C) INFORMATION
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include "SFML/Graphics/GraphicsContext.hpp"
+#include "SFML/Graphics/Image.hpp"
+#include "SFML/Graphics/TextureArray.hpp"
+
+#include "SFML/Window/GLCheck.hpp"
+#include "SFML/Window/GLUtils.hpp"
+#include "SFML/Window/Glad.hpp"
+
+#include "SFML/System/Err.hpp"
+
+#include "SFML/Base/Algorithm.hpp"
+#include "SFML/Base/Assert.hpp"
+
+#include <atomic>
+
+
+namespace
+{
+// A nested named namespace is used here to allow unity builds of SFML.
+namespace TextureArrayImpl
+{
+////////////////////////////////////////////////////////////
+// Thread-safe unique identifier generator, is used for states cache (see RenderTarget)
+constinit std::atomic<unsigned int> nextUniqueId{1u}; // start at 1, zero is "no texture array"
+
+[[nodiscard, gnu::always_inline, gnu::flatten]] inline unsigned int getUniqueId() noexcept
+{
+    return nextUniqueId.fetch_add(1u, std::memory_order_relaxed);
+}
+
+
+////////////////////////////////////////////////////////////
+// Automatic wrapper for binding a texture array and restoring the previous binding
+class [[nodiscard]] BindingGuard
+{
+public:
+    explicit BindingGuard(unsigned int texture) :
+    m_previousBinding(static_cast<GLuint>(sf::priv::getGLInteger(GL_TEXTURE_BINDING_2D_ARRAY)))
+    {
+        glCheck(glBindTexture(GL_TEXTURE_2D_ARRAY, texture));
+    }
+
+    ~BindingGuard()
+    {
+        glCheck(glBindTexture(GL_TEXTURE_2D_ARRAY, m_previousBinding));
+    }
+
+    BindingGuard(const BindingGuard&)            = delete;
+    BindingGuard& operator=(const BindingGuard&) = delete;
+
+private:
+    GLuint m_previousBinding;
+};
+
+} // namespace TextureArrayImpl
+} // namespace
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+base::Optional<TextureArray> TextureArray::create(GraphicsContext& graphicsContext,
+                                                  Vector2u         layerSize,
+                                                  unsigned int     layerCount,
+                                                  bool             sRgb)
+{
+    SFML_BASE_ASSERT(graphicsContext.hasActiveThreadLocalOrSharedGlContext());
+
+    if (layerSize.x == 0u || layerSize.y == 0u || layerCount == 0u)
+    {
+        priv::err() << "Failed to create texture array, invalid size (" << layerSize.x << "x" << layerSize.y << "x"
+                    << layerCount << ")";
+
+        return base::nullOpt;
+    }
+
+    const auto maxSize = static_cast<unsigned int>(priv::getGLInteger(GL_MAX_TEXTURE_SIZE));
+    if (layerSize.x > maxSize || layerSize.y > maxSize)
+    {
+        priv::err() << "Failed to create texture array, its layer size is too high (" << layerSize.x << "x"
+                    << layerSize.y << ", maximum is " << maxSize << "x" << maxSize << ")";
+
+        return base::nullOpt;
+    }
+
+    const unsigned int maxLayerCount = getMaximumLayerCount(graphicsContext);
+    if (layerCount > maxLayerCount)
+    {
+        priv::err() << "Failed to create texture array, too many layers (" << layerCount << ", maximum is "
+                    << maxLayerCount << ")";
+
+        return base::nullOpt;
+    }
+
+    GLuint texture = 0u;
+    glCheck(glGenTextures(1, &texture));
+
+    if (texture == 0u)
+    {
+        priv::err() << "Failed to create texture array, texture generation failed";
+        return base::nullOpt;
+    }
+
+    {
+        const TextureArrayImpl::BindingGuard guard(texture);
+
+        glCheck(glTexImage3D(GL_TEXTURE_2D_ARRAY,
+                             0,
+                             sRgb ? GL_SRGB8_ALPHA8 : GL_RGBA8,
+                             static_cast<GLsizei>(layerSize.x),
+                             static_cast<GLsizei>(layerSize.y),
+                             static_cast<GLsizei>(layerCount),
+                             0,
+                             GL_RGBA,
+                             GL_UNSIGNED_BYTE,
+                             nullptr));
+
+        glCheck(glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE));
+        glCheck(glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE));
+        glCheck(glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MAG_FILTER, GL_NEAREST));
+        glCheck(glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MIN_FILTER, GL_NEAREST));
+    }
+
+    return base::makeOptional<TextureArray>(base::PassKey<TextureArray>{},
+                                            graphicsContext,
+                                            layerSize,
+                                            layerCount,
+                                            texture);
+}
+
+
+////////////////////////////////////////////////////////////
+TextureArray::~TextureArray()
+{
+    if (m_texture)
+    {
+        SFML_BASE_ASSERT(m_graphicsContext->hasActiveThreadLocalOrSharedGlContext());
+        glCheck(glDeleteTextures(1, &m_texture));
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+TextureArray::TextureArray(TextureArray&& right) noexcept :
+m_graphicsContext(right.m_graphicsContext),
+m_layerSize(right.m_layerSize),
+m_layerCount(right.m_layerCount),
+m_texture(base::exchange(right.m_texture, 0u)),
+m_isSmooth(right.m_isSmooth),
+m_cacheId(base::exchange(right.m_cacheId, 0u))
+{
+}
+
+
+////////////////////////////////////////////////////////////
+TextureArray& TextureArray::operator=(TextureArray&& right) noexcept
+{
+    // Make sure we aren't moving ourselves.
+    if (&right == this)
+        return *this;
+
+    if (m_texture)
+    {
+        SFML_BASE_ASSERT(m_graphicsContext->hasActiveThreadLocalOrSharedGlContext());
+        glCheck(glDeleteTextures(1, &m_texture));
+    }
+
+    m_graphicsContext = right.m_graphicsContext;
+    m_layerSize       = right.m_layerSize;
+    m_layerCount      = right.m_layerCount;
+    m_texture         = base::exchange(right.m_texture, 0u);
+    m_isSmooth        = right.m_isSmooth;
+    m_cacheId         = base::exchange(right.m_cacheId, 0u);
+
+    return *this;
+}
+
+
+////////////////////////////////////////////////////////////
+void TextureArray::update(unsigned int layer, const base::U8* pixels, Vector2u size, Vector2u dest)
+{
+    SFML_BASE_ASSERT(layer < m_layerCount && "Layer index is out of range");
+    SFML_BASE_ASSERT(dest.x + size.x <= m_layerSize.x && "Destination x coordinate is outside of layer");
+    SFML_BASE_ASSERT(dest.y + size.y <= m_layerSize.y && "Destination y coordinate is outside of layer");
+    SFML_BASE_ASSERT(pixels != nullptr);
+    SFML_BASE_ASSERT(m_texture);
+
+    SFML_BASE_ASSERT(m_graphicsContext->hasActiveThreadLocalOrSharedGlContext());
+
+    const TextureArrayImpl::BindingGuard guard(m_texture);
+
+    glCheck(glTexSubImage3D(GL_TEXTURE_2D_ARRAY,
+                            0,
+                            static_cast<GLint>(dest.x),
+                            static_cast<GLint>(dest.y),
+                            static_cast<GLint>(layer),
+                            static_cast<GLsizei>(size.x),
+                            static_cast<GLsizei>(size.y),
+                            1,
+                            GL_RGBA,
+                            GL_UNSIGNED_BYTE,
+                            pixels));
+}
+
+
+////////////////////////////////////////////////////////////
+void TextureArray::update(unsigned int layer, const Image& image, Vector2u dest)
+{
+    update(layer, image.getPixelsPtr(), image.getSize(), dest);
+}
+
+
+////////////////////////////////////////////////////////////
+void TextureArray::setSmooth(bool smooth)
+{
+    SFML_BASE_ASSERT(m_texture);
+
+    if (smooth == m_isSmooth)
+        return;
+
+    m_isSmooth = smooth;
+
+    SFML_BASE_ASSERT(m_graphicsContext->hasActiveThreadLocalOrSharedGlContext());
+
+    const TextureArrayImpl::BindingGuard guard(m_texture);
+
+    glCheck(glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MAG_FILTER, m_isSmooth ? GL_LINEAR : GL_NEAREST));
+    glCheck(glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MIN_FILTER, m_isSmooth ? GL_LINEAR : GL_NEAREST));
+}
+
+
+////////////////////////////////////////////////////////////
+bool TextureArray::isSmooth() const
+{
+    return m_isSmooth;
+}
+
+
+////////////////////////////////////////////////////////////
+Vector2u TextureArray::getLayerSize() const
+{
+    return m_layerSize;
+}
+
+
+////////////////////////////////////////////////////////////
+unsigned int TextureArray::getLayerCount() const
+{
+    return m_layerCount;
+}
+
+
+////////////////////////////////////////////////////////////
+FloatRect TextureArray::getTextureRect(unsigned int layer, const FloatRect& rect) const
+{
+    SFML_BASE_ASSERT(layer < m_layerCount && "Layer index is out of range");
+
+    // Must match the layer stride used by the built-in texture array shader
+    const auto layerStride = static_cast<float>(m_layerSize.x + 1u);
+    return {{rect.position.x + static_cast<float>(layer) * layerStride, rect.position.y}, rect.size};
+}
+
+
+////////////////////////////////////////////////////////////
+FloatRect TextureArray::getTextureRect(unsigned int layer) const
+{
+    return getTextureRect(layer, {{0.f, 0.f}, m_layerSize.toVector2f()});
+}
+
+
+////////////////////////////////////////////////////////////
+unsigned int TextureArray::getNativeHandle() const
+{
+    return m_texture;
+}
+
+
+////////////////////////////////////////////////////////////
+void TextureArray::bind([[maybe_unused]] GraphicsContext& graphicsContext) const
+{
+    SFML_BASE_ASSERT(graphicsContext.hasActiveThreadLocalOrSharedGlContext());
+    SFML_BASE_ASSERT(m_texture);
+
+    glCheck(glBindTexture(GL_TEXTURE_2D_ARRAY, m_texture));
+}
+
+
+////////////////////////////////////////////////////////////
+void TextureArray::unbind([[maybe_unused]] GraphicsContext& graphicsContext)
+{
+    SFML_BASE_ASSERT(graphicsContext.hasActiveThreadLocalOrSharedGlContext());
+    glCheck(glBindTexture(GL_TEXTURE_2D_ARRAY, 0u));
+}
+
+
+////////////////////////////////////////////////////////////
+unsigned int TextureArray::getMaximumLayerCount([[maybe_unused]] GraphicsContext& graphicsContext)
+{
+    SFML_BASE_ASSERT(graphicsContext.hasActiveThreadLocalOrSharedGlContext());
+
+    static const auto count = static_cast<unsigned int>(priv::getGLInteger(GL_MAX_ARRAY_TEXTURE_LAYERS));
+    return count;
+}
+
+
+////////////////////////////////////////////////////////////
+TextureArray::TextureArray(base::PassKey<TextureArray>&&,
+                           GraphicsContext& graphicsContext,
+                           Vector2u         layerSize,
+                           unsigned int     layerCount,
+                           unsigned int     texture) :
+m_graphicsContext(&graphicsContext),
+m_layerSize(layerSize),
+m_layerCount(layerCount),
+m_texture(texture),
+m_cacheId(TextureArrayImpl::getUniqueId())
+{
+}
+
+} // namespace sf
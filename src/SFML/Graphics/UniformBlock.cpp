@@ -0,0 +1,212 @@
+#include <SFML/Copyright.hpp> // LICENSE AND COPYRIGHT (C) INFORMATION
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include "SFML/Graphics/GraphicsContext.hpp"
+#include "SFML/Graphics/UniformBlock.hpp"
+
+#include "SFML/Window/GLCheck.hpp"
+#include "SFML/Window/GLUtils.hpp"
+#include "SFML/Window/Glad.hpp"
+
+#include "SFML/System/Err.hpp"
+
+#include "SFML/Base/Algorithm.hpp"
+#include "SFML/Base/Assert.hpp"
+
+
+namespace
+{
+// A nested named namespace is used here to allow unity builds of SFML.
+namespace UniformBlockImpl
+{
+////////////////////////////////////////////////////////////
+void uploadToBuffer(unsigned int    buffer,
+                    const void*     data,
+                    sf::base::SizeT size,
+                    sf::base::SizeT offset,
+                    sf::base::SizeT bufferSize)
+{
+    // Respecifying the whole storage orphans the previous one, which avoids waiting on in-flight draws
+    const bool wholeBuffer = offset == 0u && size == bufferSize;
+
+#ifdef SFML_OPENGL_ES
+    glCheck(glBindBuffer(GL_UNIFORM_BUFFER, buffer));
+
+    if (wholeBuffer)
+        glCheck(glBufferData(GL_UNIFORM_BUFFER, static_cast<GLsizeiptr>(size), data, GL_DYNAMIC_DRAW));
+    else
+        glCheck(glBufferSubData(GL_UNIFORM_BUFFER, static_cast<GLintptr>(offset), static_cast<GLsizeiptr>(size), data));
+
+    glCheck(glBindBuffer(GL_UNIFORM_BUFFER, 0u));
+#else
+    if (wholeBuffer)
+        glCheck(glNamedBufferData(buffer, static_cast<GLsizeiptr>(size), data, GL_DYNAMIC_DRAW));
+    else
+        glCheck(glNamedBufferSubData(buffer, static_cast<GLintptr>(offset), static_cast<GLsizeiptr>(size), data));
+#endif
+}
+
+} // namespace UniformBlockImpl
+} // namespace
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+base::Optional<UniformBlock> UniformBlock::create(GraphicsContext& graphicsContext,
+                                                  base::SizeT      size,
+                                                  unsigned int     bindingPoint)
+{
+    SFML_BASE_ASSERT(graphicsContext.hasActiveThreadLocalOrSharedGlContext());
+
+    if (size == 0u)
+    {
+        priv::err() << "Failed to create uniform block: size must not be zero";
+        return base::nullOpt;
+    }
+
+    const auto maxSize = static_cast<base::SizeT>(priv::getGLInteger(GL_MAX_UNIFORM_BLOCK_SIZE));
+    if (size > maxSize)
+    {
+        priv::err() << "Failed to create uniform block: size " << size << " exceeds the maximum of " << maxSize;
+        return base::nullOpt;
+    }
+
+    const auto maxBindings = static_cast<unsigned int>(priv::getGLInteger(GL_MAX_UNIFORM_BUFFER_BINDINGS));
+    if (bindingPoint >= maxBindings)
+    {
+        priv::err() << "Failed to create uniform block: binding point " << bindingPoint
+                    << " exceeds the maximum of " << maxBindings - 1u;
+        return base::nullOpt;
+    }
+
+    GLuint buffer = 0u;
+    glCheck(glGenBuffers(1, &buffer));
+
+    if (buffer == 0u)
+    {
+        priv::err() << "Failed to create uniform block: buffer generation failed";
+        return base::nullOpt;
+    }
+
+    // Allocate the storage, the contents are undefined until the first update
+    glCheck(glBindBuffer(GL_UNIFORM_BUFFER, buffer));
+    glCheck(glBufferData(GL_UNIFORM_BUFFER, static_cast<GLsizeiptr>(size), nullptr, GL_DYNAMIC_DRAW));
+    glCheck(glBindBuffer(GL_UNIFORM_BUFFER, 0u));
+
+    return base::makeOptional<UniformBlock>(base::PassKey<UniformBlock>{}, graphicsContext, buffer, size, bindingPoint);
+}
+
+
+////////////////////////////////////////////////////////////
+UniformBlock::~UniformBlock()
+{
+    if (m_buffer)
+    {
+        SFML_BASE_ASSERT(m_graphicsContext->hasActiveThreadLocalOrSharedGlContext());
+        glCheck(glDeleteBuffers(1, &m_buffer));
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+UniformBlock::UniformBlock(UniformBlock&& right) noexcept :
+m_graphicsContext(right.m_graphicsContext),
+m_buffer(base::exchange(right.m_buffer, 0u)),
+m_size(base::exchange(right.m_size, base::SizeT{0u})),
+m_bindingPoint(right.m_bindingPoint)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+UniformBlock& UniformBlock::operator=(UniformBlock&& right) noexcept
+{
+    // Make sure we aren't moving ourselves.
+    if (&right == this)
+        return *this;
+
+    if (m_buffer)
+    {
+        SFML_BASE_ASSERT(m_graphicsContext->hasActiveThreadLocalOrSharedGlContext());
+        glCheck(glDeleteBuffers(1, &m_buffer));
+    }
+
+    m_graphicsContext = right.m_graphicsContext;
+    m_buffer          = base::exchange(right.m_buffer, 0u);
+    m_size            = base::exchange(right.m_size, base::SizeT{0u});
+    m_bindingPoint    = right.m_bindingPoint;
+
+    return *this;
+}
+
+
+////////////////////////////////////////////////////////////
+bool UniformBlock::update(const void* data, base::SizeT size, base::SizeT offset)
+{
+    SFML_BASE_ASSERT(m_graphicsContext->hasActiveThreadLocalOrSharedGlContext());
+    SFML_BASE_ASSERT(m_buffer != 0u);
+
+    if (data == nullptr)
+    {
+        priv::err() << "Failed to update uniform block: data must not be null";
+        return false;
+    }
+
+    if (offset > m_size || size > m_size - offset)
+    {
+        priv::err() << "Failed to update uniform block: range [" << offset << ", " << offset + size
+                    << ") is out of bounds (size is " << m_size << ")";
+        return false;
+    }
+
+    UniformBlockImpl::uploadToBuffer(m_buffer, data, size, offset, m_size);
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+void UniformBlock::bind() const
+{
+    SFML_BASE_ASSERT(m_graphicsContext->hasActiveThreadLocalOrSharedGlContext());
+    glCheck(glBindBufferBase(GL_UNIFORM_BUFFER, m_bindingPoint, m_buffer));
+}
+
+
+////////////////////////////////////////////////////////////
+base::SizeT UniformBlock::getSize() const
+{
+    return m_size;
+}
+
+
+////////////////////////////////////////////////////////////
+unsigned int UniformBlock::getBindingPoint() const
+{
+    return m_bindingPoint;
+}
+
+
+////////////////////////////////////////////////////////////
+unsigned int UniformBlock::getNativeHandle() const
+{
+    return m_buffer;
+}
+
+
+////////////////////////////////////////////////////////////
+UniformBlock::UniformBlock(base::PassKey<UniformBlock>&&,
+                           GraphicsContext& graphicsContext,
+                           unsigned int     buffer,
+                           base::SizeT      size,
+                           unsigned int     bindingPoint) :
+m_graphicsContext(&graphicsContext),
+m_buffer(buffer),
+m_size(size),
+m_bindingPoint(bindingPoint)
+{
+}
+
+} // namespace sf
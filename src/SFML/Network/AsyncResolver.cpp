@@ -0,0 +1,382 @@
+#include <SFML/Copyright.hpp> // LICENSE AND COPYRIGHT (C) INFORMATION
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include "SFML/Network/AsyncResolver.hpp"
+#include "SFML/Network/IpAddress.hpp"
+#include "SFML/Network/IpAddressUtils.hpp"
+#include "SFML/Network/SocketImpl.hpp"
+
+#include "SFML/System/Clock.hpp"
+#include "SFML/System/Time.hpp"
+
+#include "SFML/Base/Algorithm.hpp"
+#include "SFML/Base/Assert.hpp"
+#include "SFML/Base/Optional.hpp"
+#include "SFML/Base/StringView.hpp"
+#include "SFML/Base/UniquePtr.hpp"
+
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+
+namespace
+{
+////////////////////////////////////////////////////////////
+/// \brief Resolve `address` without involving the system resolver
+///
+/// Only succeeds for decimal addresses ("xxx.xxx.xxx.xxx").
+///
+////////////////////////////////////////////////////////////
+[[nodiscard]] sf::base::Optional<sf::IpAddress> resolveLiteral(const std::string& address)
+{
+    if (address == "255.255.255.255")
+    {
+        // The broadcast address needs to be handled explicitly,
+        // because it is also the value returned by inet_addr on error
+        return sf::base::makeOptional(sf::IpAddress::Broadcast);
+    }
+
+    if (address == "0.0.0.0")
+        return sf::base::makeOptional(sf::IpAddress::Any);
+
+    if (const auto ip = sf::priv::SocketImpl::inetAddr(address.c_str()); ip.hasValue())
+        return sf::base::makeOptional<sf::IpAddress>(sf::priv::SocketImpl::getNtohl(*ip));
+
+    return sf::base::nullOpt;
+}
+
+} // namespace
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+struct AsyncResolver::Impl
+{
+    ////////////////////////////////////////////////////////////
+    struct CacheEntry
+    {
+        base::Optional<IpAddress> address; //!< Resolved address, `base::nullOpt` for failed lookups
+        Time                      expiry;  //!< Point in time (relative to `clock`) after which the entry is stale
+    };
+
+    ////////////////////////////////////////////////////////////
+    struct QueryResult
+    {
+        Status                    status{Status::Pending}; //!< Status of the resolution
+        base::Optional<IpAddress> address;                 //!< Resolved address
+    };
+
+    Settings settings; //!< Cache and threading configuration
+    Clock    clock;    //!< Time reference for cache expiry
+
+    mutable std::mutex      mutex;      //!< Protects all the members below
+    std::condition_variable workCv;     //!< Signaled when a lookup is queued or on shutdown
+    std::condition_variable completeCv; //!< Signaled when a lookup completes
+    bool                    stopping{}; //!< Set on destruction to stop the workers
+
+    std::unordered_map<std::string, CacheEntry>             cache;   //!< Completed lookups, by host name
+    std::unordered_map<std::string, std::vector<base::U64>> pending; //!< Queued or in-flight lookups and their queries
+    std::deque<std::string>                                 queue;   //!< Host names waiting for a worker
+    std::unordered_map<base::U64, QueryResult>              results; //!< Results of the queries not fetched yet
+    base::U64                                               nextQueryId{1u}; //!< Identifier of the next pending query
+
+    std::vector<std::thread> workers; //!< Background threads performing lookups
+
+
+    ////////////////////////////////////////////////////////////
+    explicit Impl(const Settings& theSettings) : settings(theSettings)
+    {
+        if (settings.lookup == nullptr)
+            settings.lookup = &IpAddressUtils::resolve;
+
+        const unsigned int workerCount = base::max(settings.workerCount, 1u);
+
+        workers.reserve(workerCount);
+        for (unsigned int i = 0u; i < workerCount; ++i)
+            workers.emplace_back([this] { workerLoop(); });
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    ~Impl()
+    {
+        {
+            const std::lock_guard lock(mutex);
+            stopping = true;
+        }
+
+        workCv.notify_all();
+        completeCv.notify_all();
+
+        for (std::thread& worker : workers)
+            worker.join();
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    void workerLoop()
+    {
+        std::unique_lock lock(mutex);
+
+        while (true)
+        {
+            workCv.wait(lock, [this] { return stopping || !queue.empty(); });
+
+            if (stopping)
+                return;
+
+            const std::string hostName = SFML_BASE_MOVE(queue.front());
+            queue.pop_front();
+
+            // Perform the blocking lookup without holding the lock
+            lock.unlock();
+            const base::Optional<IpAddress> address = settings.lookup(hostName);
+            lock.lock();
+
+            const Time ttl  = address.hasValue() ? settings.positiveTtl : settings.negativeTtl;
+            cache[hostName] = {address, clock.getElapsedTime() + ttl};
+
+            // Complete all the queries waiting for this host name
+            if (const auto it = pending.find(hostName); it != pending.end())
+            {
+                for (const base::U64 id : it->second)
+                {
+                    if (const auto resultIt = results.find(id); resultIt != results.end())
+                    {
+                        resultIt->second.status  = address.hasValue() ? Status::Resolved : Status::Failed;
+                        resultIt->second.address = address;
+                    }
+                }
+
+                pending.erase(it);
+            }
+
+            completeCv.notify_all();
+        }
+    }
+};
+
+
+////////////////////////////////////////////////////////////
+AsyncResolver::Query::Query(base::Optional<IpAddress> address) :
+m_resolver(nullptr),
+m_id(0u),
+m_status(address.hasValue() ? Status::Resolved : Status::Failed),
+m_address(address)
+{
+}
+
+
+////////////////////////////////////////////////////////////
+AsyncResolver::Query::Query(AsyncResolver& resolver, base::U64 id) :
+m_resolver(&resolver),
+m_id(id),
+m_status(Status::Pending)
+{
+    SFML_UPDATE_LIFETIME_DEPENDANT(AsyncResolver, Query, this, m_resolver);
+}
+
+
+////////////////////////////////////////////////////////////
+AsyncResolver::Query::~Query()
+{
+    if (m_resolver == nullptr)
+        return;
+
+    // Forget the result, the lookup itself keeps going and will populate the cache
+    const std::lock_guard lock(m_resolver->m_impl->mutex);
+    m_resolver->m_impl->results.erase(m_id);
+}
+
+
+////////////////////////////////////////////////////////////
+AsyncResolver::Query::Query(Query&& rhs) noexcept :
+m_resolver(base::exchange(rhs.m_resolver, nullptr)),
+m_id(rhs.m_id),
+m_status(rhs.m_status),
+m_address(rhs.m_address)
+{
+    SFML_UPDATE_LIFETIME_DEPENDANT(AsyncResolver, Query, this, m_resolver);
+    SFML_UPDATE_LIFETIME_DEPENDANT(AsyncResolver, Query, (&rhs), rhs.m_resolver);
+}
+
+
+////////////////////////////////////////////////////////////
+AsyncResolver::Query& AsyncResolver::Query::operator=(Query&& rhs) noexcept
+{
+    if (&rhs == this)
+        return *this;
+
+    // Release the result of the query being overwritten, if still tracked
+    Query discarded(SFML_BASE_MOVE(*this));
+
+    m_resolver = base::exchange(rhs.m_resolver, nullptr);
+    m_id       = rhs.m_id;
+    m_status   = rhs.m_status;
+    m_address  = rhs.m_address;
+
+    SFML_UPDATE_LIFETIME_DEPENDANT(AsyncResolver, Query, this, m_resolver);
+    SFML_UPDATE_LIFETIME_DEPENDANT(AsyncResolver, Query, (&rhs), rhs.m_resolver);
+
+    return *this;
+}
+
+
+////////////////////////////////////////////////////////////
+void AsyncResolver::Query::poll(bool block, Time timeout) const
+{
+    if (m_resolver == nullptr)
+        return;
+
+    Impl&            impl = *m_resolver->m_impl;
+    std::unique_lock lock(impl.mutex);
+
+    const auto it = impl.results.find(m_id);
+    SFML_BASE_ASSERT(it != impl.results.end());
+
+    const auto isComplete = [&] { return impl.stopping || it->second.status != Status::Pending; };
+
+    if (block)
+    {
+        if (timeout == Time::Zero)
+            impl.completeCv.wait(lock, isComplete);
+        else
+            impl.completeCv.wait_for(lock, std::chrono::microseconds(timeout.asMicroseconds()), isComplete);
+    }
+
+    if (it->second.status == Status::Pending)
+        return;
+
+    // Cache the result locally, the resolver does not need to track this query anymore
+    m_status  = it->second.status;
+    m_address = it->second.address;
+    impl.results.erase(it);
+
+    m_resolver = nullptr;
+    SFML_UPDATE_LIFETIME_DEPENDANT(AsyncResolver, Query, this, m_resolver);
+}
+
+
+////////////////////////////////////////////////////////////
+AsyncResolver::Status AsyncResolver::Query::getStatus() const
+{
+    poll(/* block */ false, Time::Zero);
+    return m_status;
+}
+
+
+////////////////////////////////////////////////////////////
+bool AsyncResolver::Query::isReady() const
+{
+    return getStatus() != Status::Pending;
+}
+
+
+////////////////////////////////////////////////////////////
+base::Optional<IpAddress> AsyncResolver::Query::getAddress() const
+{
+    poll(/* block */ false, Time::Zero);
+    return m_address;
+}
+
+
+////////////////////////////////////////////////////////////
+base::Optional<IpAddress> AsyncResolver::Query::wait() const
+{
+    poll(/* block */ true, Time::Zero);
+    return m_address;
+}
+
+
+////////////////////////////////////////////////////////////
+bool AsyncResolver::Query::waitFor(Time timeout) const
+{
+    poll(/* block */ true, base::max(timeout, microseconds(1)));
+    return m_status != Status::Pending;
+}
+
+
+////////////////////////////////////////////////////////////
+AsyncResolver::AsyncResolver() : AsyncResolver(Settings{})
+{
+}
+
+
+////////////////////////////////////////////////////////////
+AsyncResolver::AsyncResolver(const Settings& settings) : m_impl(base::makeUnique<Impl>(settings))
+{
+}
+
+
+////////////////////////////////////////////////////////////
+AsyncResolver::~AsyncResolver() = default;
+
+
+////////////////////////////////////////////////////////////
+AsyncResolver::Query AsyncResolver::resolve(base::StringView address)
+{
+    if (address.empty())
+    {
+        // Not generating an error message here as resolution failure is a valid outcome.
+        return Query(base::nullOpt);
+    }
+
+    std::string hostName(address.data(), address.size());
+
+    // Decimal addresses do not need the system resolver
+    if (const base::Optional<IpAddress> literal = resolveLiteral(hostName); literal.hasValue())
+        return Query(literal);
+
+    const std::lock_guard lock(m_impl->mutex);
+
+    // Serve fresh cache entries immediately, evict stale ones
+    if (const auto it = m_impl->cache.find(hostName); it != m_impl->cache.end())
+    {
+        if (m_impl->clock.getElapsedTime() < it->second.expiry)
+            return Query(it->second.address);
+
+        m_impl->cache.erase(it);
+    }
+
+    const base::U64 id = m_impl->nextQueryId++;
+    m_impl->results.try_emplace(id);
+
+    // Only queue a new lookup if there is none in flight for this host name
+    auto [pendingIt, inserted] = m_impl->pending.try_emplace(hostName);
+    pendingIt->second.push_back(id);
+
+    if (inserted)
+    {
+        m_impl->queue.push_back(SFML_BASE_MOVE(hostName));
+        m_impl->workCv.notify_one();
+    }
+
+    return Query(*this, id);
+}
+
+
+////////////////////////////////////////////////////////////
+void AsyncResolver::clearCache()
+{
+    const std::lock_guard lock(m_impl->mutex);
+    m_impl->cache.clear();
+}
+
+
+////////////////////////////////////////////////////////////
+base::SizeT AsyncResolver::getCacheSize() const
+{
+    const std::lock_guard lock(m_impl->mutex);
+    return m_impl->cache.size();
+}
+
+} // namespace sf
@@ -11,17 +11,21 @@
 #include "SFML/System/Err.hpp"
 #include "SFML/System/StringUtils.hpp"
 
+#include "SFML/Base/Algorithm.hpp"
 #include "SFML/Base/Assert.hpp"
+#include "SFML/Base/Macros.hpp"
 #include "SFML/Base/Optional.hpp"
 #include "SFML/Base/SizeT.hpp"
+#include "SFML/Base/Span.hpp"
 
-#include <iterator>
 #include <limits>
 #include <map>
 #include <sstream>
 #include <string>
+#include <vector>
 
 #include <cctype>
+#include <cstdlib>
 
 namespace
 {
@@ -52,6 +56,16 @@ void parseFields(std::istream& in, FieldTable& fields)
     }
 }
 
+
+////////////////////////////////////////////////////////////
+/// Can the request be sent again without changing its outcome? (RFC 7231, section 4.2.2)
+///
+////////////////////////////////////////////////////////////
+[[nodiscard]] bool isIdempotent(sf::Http::Request::Method method)
+{
+    return method != sf::Http::Request::Method::Post;
+}
+
 } // namespace
 
 
@@ -103,6 +117,22 @@ Http::Request::Request() : Http::Request::Request("/", Method::Get, "")
 Http::Request::~Request() = default;
 
 
+////////////////////////////////////////////////////////////
+Http::Request::Request(const Request&) = default;
+
+
+////////////////////////////////////////////////////////////
+Http::Request& Http::Request::operator=(const Request&) = default;
+
+
+////////////////////////////////////////////////////////////
+Http::Request::Request(Request&&) noexcept = default;
+
+
+////////////////////////////////////////////////////////////
+Http::Request& Http::Request::operator=(Request&&) noexcept = default;
+
+
 ////////////////////////////////////////////////////////////
 void Http::Request::setField(const std::string& field, const std::string& value)
 {
@@ -214,6 +244,22 @@ Http::Response::Response() = default;
 Http::Response::~Response() = default;
 
 
+////////////////////////////////////////////////////////////
+Http::Response::Response(const Response&) = default;
+
+
+////////////////////////////////////////////////////////////
+Http::Response& Http::Response::operator=(const Response&) = default;
+
+
+////////////////////////////////////////////////////////////
+Http::Response::Response(Response&&) noexcept = default;
+
+
+////////////////////////////////////////////////////////////
+Http::Response& Http::Response::operator=(Response&&) noexcept = default;
+
+
 ////////////////////////////////////////////////////////////
 const std::string& Http::Response::getField(const std::string& field) const
 {
@@ -256,9 +302,9 @@ const std::string& Http::Response::getBody() const
 
 
 ////////////////////////////////////////////////////////////
-void Http::Response::parse(const std::string& data)
+void Http::Response::parseHeader(const std::string& header)
 {
-    std::istringstream in(data);
+    std::istringstream in(header);
 
     // Extract the HTTP version from the first line
     std::string version;
@@ -295,57 +341,505 @@ void Http::Response::parse(const std::string& data)
     in.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
 
     // Parse the other lines, which contain fields, one by one
+    m_impl->fields.clear();
     parseFields(in, m_impl->fields);
 
     m_impl->body.clear();
+}
 
-    // Determine whether the transfer is chunked
-    if (priv::toLower(getField("transfer-encoding")) != "chunked")
+
+////////////////////////////////////////////////////////////
+struct Http::Impl
+{
+    ////////////////////////////////////////////////////////////
+    /// \brief Open connection to the host, with its receive buffer
+    ///
+    ////////////////////////////////////////////////////////////
+    struct Connection
     {
-        // Not chunked - just read everything at once
-        for (auto it = std::istreambuf_iterator<char>(in); it != std::istreambuf_iterator<char>(); ++it)
-            m_impl->body.push_back(*it);
+        TcpSocket   socket{/* isBlocking */ true}; //!< Socket connected to the host
+        std::string buffer;                        //!< Data received from the host but not consumed yet
+        bool        reused{};                      //!< Was the connection taken from the idle pool?
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Result of reading a response from a connection
+    ///
+    ////////////////////////////////////////////////////////////
+    enum class ReadResult
+    {
+        Complete,       //!< The response was fully received, the connection can be reused
+        CompleteClosed, //!< The response was fully received, the connection cannot be reused
+        NothingRead,    //!< The connection was closed before any byte of the response was received
+        Failed          //!< The connection was closed or aborted in the middle of the response
+    };
+
+    std::vector<Connection>   idleConnections;   //!< Pool of persistent connections waiting to be reused
+    base::Optional<IpAddress> host;              //!< Web host address
+    std::string               hostName;          //!< Web host name
+    unsigned short            port{};            //!< Port used for connection with host
+    bool                      keepAlive{};       //!< Use persistent connections?
+    base::SizeT               maxConnections{4}; //!< Maximum number of pooled/parallel connections
+
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Receive more data from the host into the connection buffer
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static bool receiveMore(Connection& connection)
+    {
+        char        data[16384];
+        base::SizeT received = 0;
+
+        if (connection.socket.receive(data, sizeof(data), received) != Socket::Status::Done)
+            return false;
+
+        connection.buffer.append(data, received);
+        return true;
     }
-    else
+
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Extract everything up to `delimiter` (included) from the connection
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static bool readUntil(Connection& connection, const char* delimiter, std::string& out)
     {
-        // Chunked - have to read chunk by chunk
-        base::SizeT length = 0;
+        const base::SizeT delimiterLength = std::char_traits<char>::length(delimiter);
+        base::SizeT       searchFrom      = 0;
 
-        // Read all chunks, identified by a chunk-size not being 0
-        while (in >> std::hex >> length)
+        while (true)
         {
-            // Drop the rest of the line (chunk-extension)
-            in.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
-
-            // Copy the actual content data
-            std::istreambuf_iterator<char>       it(in);
-            const std::istreambuf_iterator<char> itEnd;
-            for (base::SizeT i = 0; ((i < length) && (it != itEnd)); ++i)
+            if (const auto pos = connection.buffer.find(delimiter, searchFrom); pos != std::string::npos)
             {
-                m_impl->body.push_back(*it);
-                ++it; // Iterate in separate expression to work around false positive -Wnull-dereference warning in GCC 12.1.0
+                out.assign(connection.buffer, 0, pos + delimiterLength);
+                connection.buffer.erase(0, pos + delimiterLength);
+                return true;
             }
+
+            // The delimiter might straddle the boundary of the next received block
+            if (connection.buffer.size() >= delimiterLength)
+                searchFrom = connection.buffer.size() - delimiterLength + 1;
+
+            if (!receiveMore(connection))
+                return false;
         }
+    }
 
-        // Drop the rest of the line (chunk-extension)
-        in.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
 
-        // Read all trailers (if present)
-        parseFields(in, m_impl->fields);
+    ////////////////////////////////////////////////////////////
+    /// \brief Forward exactly `length` bytes of the connection to `sink`
+    ///
+    ////////////////////////////////////////////////////////////
+    template <typename Sink>
+    [[nodiscard]] static bool readBytes(Connection& connection, base::SizeT length, Sink& sink)
+    {
+        while (length > 0)
+        {
+            if (connection.buffer.empty() && !receiveMore(connection))
+                return false;
+
+            const base::SizeT count = base::min(length, connection.buffer.size());
+            if (!sink(connection.buffer.data(), count))
+                return false;
+
+            connection.buffer.erase(0, count);
+            length -= count;
+        }
+
+        return true;
     }
-}
 
 
-////////////////////////////////////////////////////////////
-struct Http::Impl
-{
-    TcpSocket                 connection; //!< Connection to the host
-    base::Optional<IpAddress> host;       //!< Web host address
-    std::string               hostName;   //!< Web host name
-    unsigned short            port{};     //!< Port used for connection with host
+    ////////////////////////////////////////////////////////////
+    /// \brief Forward a chunked body of the connection to `sink`, decoding it on the fly
+    ///
+    ////////////////////////////////////////////////////////////
+    template <typename Sink>
+    [[nodiscard]] static bool readChunkedBody(Connection& connection, Sink& sink, std::string& trailers)
+    {
+        std::string line;
+
+        while (true)
+        {
+            // Read the chunk-size line, ignoring any chunk-extension
+            if (!readUntil(connection, "\r\n", line))
+                return false;
+
+            char*                    end    = nullptr;
+            const unsigned long long length = std::strtoull(line.c_str(), &end, 16);
+            if (end == line.c_str())
+                return false;
+
+            if (length == 0)
+                break;
+
+            // Copy the actual content data, then drop the CRLF terminating the chunk
+            if (!readBytes(connection, static_cast<base::SizeT>(length), sink) || !readUntil(connection, "\r\n", line))
+                return false;
+        }
+
+        // Read all trailers (if present), up to the final empty line
+        while (true)
+        {
+            if (!readUntil(connection, "\r\n", line))
+                return false;
+
+            if (line.size() <= 2)
+                return true;
+
+            trailers += line;
+        }
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Forward the rest of the connection's data to `sink`, until the host closes it
+    ///
+    ////////////////////////////////////////////////////////////
+    template <typename Sink>
+    [[nodiscard]] static bool readBodyUntilClosed(Connection& connection, Sink& sink)
+    {
+        do
+        {
+            if (!connection.buffer.empty() && !sink(connection.buffer.data(), connection.buffer.size()))
+                return false;
+
+            connection.buffer.clear();
+        } while (receiveMore(connection));
+
+        return true;
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Read a complete response from a connection
+    ///
+    /// The body is forwarded to `bodyCallback` if provided,
+    /// otherwise it is stored in `response`.
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static ReadResult readResponse(Connection&         connection,
+                                                 Request::Method     method,
+                                                 Response&           response,
+                                                 const BodyCallback* bodyCallback)
+    {
+        std::string header;
+
+        // Read the header, skipping any interim "100 Continue" response
+        do
+        {
+            if (!readUntil(connection, "\r\n\r\n", header))
+                return header.empty() && connection.buffer.empty() ? ReadResult::NothingRead : ReadResult::Failed;
+
+            response.parseHeader(header);
+        } while (static_cast<int>(response.m_impl->status) / 100 == 1);
+
+        if (response.m_impl->status == Response::Status::InvalidResponse)
+            return ReadResult::Failed;
+
+        const auto appendToBody = [&](const char* data, base::SizeT size)
+        {
+            if (bodyCallback != nullptr)
+                return (*bodyCallback)(data, size);
+
+            response.m_impl->body.append(data, size);
+            return true;
+        };
+
+        // Determine whether the host is willing to keep the connection open
+        const std::string connectionField = priv::toLower(response.getField("connection"));
+        const bool        isHttp11        = response.m_impl->majorVersion * 10 + response.m_impl->minorVersion >= 11;
+        bool              canReuse        = isHttp11 ? connectionField != "close" : connectionField == "keep-alive";
+
+        // Determine how the end of the body is delimited
+        const auto         status        = static_cast<int>(response.m_impl->status);
+        const bool         hasNoBody     = (method == Request::Method::Head) || (status == 204) || (status == 304);
+        const std::string& contentLength = response.getField("content-length");
+
+        bool bodyOk = true;
+
+        if (hasNoBody)
+        {
+            // Nothing to read
+        }
+        else if (priv::toLower(response.getField("transfer-encoding")) == "chunked")
+        {
+            std::string trailers;
+            bodyOk = readChunkedBody(connection, appendToBody, trailers);
+
+            std::istringstream trailersIn(trailers);
+            parseFields(trailersIn, response.m_impl->fields);
+        }
+        else if (!contentLength.empty())
+        {
+            const auto length = static_cast<base::SizeT>(std::strtoull(contentLength.c_str(), nullptr, 10));
+            bodyOk            = readBytes(connection, length, appendToBody);
+        }
+        else
+        {
+            // No framing information -- the end of the body is marked by the host closing the connection
+            bodyOk   = readBodyUntilClosed(connection, appendToBody);
+            canReuse = false;
+        }
+
+        if (!bodyOk)
+            return ReadResult::Failed;
+
+        return canReuse ? ReadResult::Complete : ReadResult::CompleteClosed;
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Take an idle connection from the pool, or open a new one
+    ///
+    /// Pooled connections are only used if `allowPooled` is `true`,
+    /// as the host may have closed them in the meantime.
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] base::Optional<Connection> acquireConnection(Time timeout, bool allowPooled)
+    {
+        if (allowPooled && !idleConnections.empty())
+        {
+            base::Optional<Connection> connection(base::inPlace, SFML_BASE_MOVE(idleConnections.back()));
+            idleConnections.pop_back();
+            connection->reused = true;
+            return connection;
+        }
+
+        if (!host.hasValue())
+            return base::nullOpt;
+
+        base::Optional<Connection> connection(base::inPlace);
+        if (connection->socket.connect(*host, port, timeout) != Socket::Status::Done)
+            return base::nullOpt;
+
+        return connection;
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Return a connection to the idle pool, or close it
+    ///
+    ////////////////////////////////////////////////////////////
+    void releaseConnection(Connection&& connection, bool reusable)
+    {
+        if (reusable && connection.buffer.empty() && idleConnections.size() < maxConnections)
+        {
+            idleConnections.push_back(SFML_BASE_MOVE(connection));
+            return;
+        }
+
+        [[maybe_unused]] const bool rc = connection.socket.disconnect();
+        SFML_BASE_ASSERT(rc);
+    }
+
 
-    explicit Impl() : connection(/* isBlocking */ true)
+    ////////////////////////////////////////////////////////////
+    /// \brief Close all the idle connections
+    ///
+    ////////////////////////////////////////////////////////////
+    void closeIdleConnections()
     {
+        // Sockets are closed on destruction
+        idleConnections.clear();
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Add missing mandatory fields to a request, and convert it to string
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::string prepareRequest(const Request& request, bool persistent) const
+    {
+        Request toSend(request);
+
+        if (!toSend.hasField("From"))
+        {
+            toSend.setField("From", "user@sfml-dev.org");
+        }
+        if (!toSend.hasField("User-Agent"))
+        {
+            toSend.setField("User-Agent", "libsfml-network/3.x");
+        }
+        if (!toSend.hasField("Host"))
+        {
+            toSend.setField("Host", hostName);
+        }
+        if (!toSend.hasField("Content-Length"))
+        {
+            std::ostringstream out;
+            out << toSend.m_impl->body.size();
+            toSend.setField("Content-Length", out.str());
+        }
+        if ((toSend.m_impl->method == Request::Method::Post) && !toSend.hasField("Content-Type"))
+        {
+            toSend.setField("Content-Type", "application/x-www-form-urlencoded");
+        }
+        if (!toSend.hasField("Connection"))
+        {
+            if (persistent)
+                toSend.setField("Connection", "keep-alive");
+            else if (toSend.m_impl->majorVersion * 10 + toSend.m_impl->minorVersion >= 11)
+                toSend.setField("Connection", "close");
+        }
+
+        return toSend.prepare();
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Send requests over up to `connectionCount` connections, then read all their responses
+    ///
+    /// The requests are split in contiguous groups, one per connection.
+    /// Each group is written in batches (pipelining) before any of their
+    /// responses is read back, so that the host can process them in parallel.
+    /// A non-idempotent request is always sent alone in its batch, once the
+    /// responses to the previous requests of its group have been received.
+    /// `responses` must have the same size as `requests`.
+    ///
+    /// A batch of idempotent requests is sent again once on a new connection
+    /// if a pooled connection turns out to have been closed by the host, or
+    /// if the host stops answering halfway through it. Non-idempotent
+    /// requests are never sent twice, as the host may have processed them.
+    ///
+    ////////////////////////////////////////////////////////////
+    void sendPipelined(base::Span<const Request> requests,
+                       base::Span<Response>      responses,
+                       base::SizeT               connectionCount,
+                       bool                      persistent,
+                       const BodyCallback*       bodyCallback,
+                       Time                      timeout)
+    {
+        struct Group
+        {
+            base::SizeT                next;       //!< Index of the first request not answered yet
+            base::SizeT                end;        //!< Index past the last request of the group
+            base::SizeT                batchEnd;   //!< Index past the last request of the batch being sent
+            base::Optional<Connection> connection; //!< Connection the batch is sent over
+            bool                       retried;    //!< Was the group already sent again after a failure?
+        };
+
+        std::vector<Group> groups;
+
+        const base::SizeT groupSize = (requests.size() + connectionCount - 1) / connectionCount;
+        for (base::SizeT begin = 0; begin < requests.size(); begin += groupSize)
+            groups.push_back({begin, base::min(begin + groupSize, requests.size()), begin, base::nullOpt, false});
+
+        const auto isMethodIdempotent = [&](base::SizeT index)
+        { return isIdempotent(requests[index].m_impl->method); };
+
+        // Send the unanswered requests of the group again, or give up on them
+        const auto retryOrAbandon = [&](Group& group)
+        {
+            // Non-idempotent requests are alone in their batch
+            if (!group.retried && isMethodIdempotent(group.next))
+                group.retried = true;
+            else
+                group.next = group.end;
+        };
+
+        std::string payload;
+        bool        pending = true;
+
+        while (pending)
+        {
+            // Write the next batch of unanswered requests of each group to its connection
+            for (Group& group : groups)
+            {
+                if (group.next == group.end)
+                    continue;
+
+                group.batchEnd = group.next + 1;
+                if (isMethodIdempotent(group.next))
+                    while (group.batchEnd < group.end && isMethodIdempotent(group.batchEnd))
+                        ++group.batchEnd;
+
+                // Non-idempotent requests cannot be sent again if a pooled connection turns out to be stale
+                group.connection = acquireConnection(timeout, /* allowPooled */ isMethodIdempotent(group.next));
+                if (!group.connection.hasValue())
+                {
+                    group.next = group.end;
+                    continue;
+                }
+
+                payload.clear();
+                for (base::SizeT i = group.next; i < group.batchEnd; ++i)
+                    payload += prepareRequest(requests[i], persistent);
+
+                if (group.connection->socket.send(payload.data(), payload.size()) != Socket::Status::Done)
+                {
+                    // Most likely a stale pooled connection, try again with a new one
+                    if (group.connection->reused)
+                        retryOrAbandon(group);
+                    else
+                        group.next = group.end;
+
+                    releaseConnection(SFML_BASE_MOVE(*group.connection), /* reusable */ false);
+                    group.connection.reset();
+                }
+            }
+
+            // Read the responses back in order
+            pending = false;
+
+            for (Group& group : groups)
+            {
+                if (!group.connection.hasValue())
+                {
+                    pending |= group.next < group.end;
+                    continue;
+                }
+
+                Connection&       connection = *group.connection;
+                bool              reusable   = persistent;
+                const base::SizeT first      = group.next;
+
+                for (; group.next < group.batchEnd; ++group.next)
+                {
+                    Response&        response = responses[group.next];
+                    const ReadResult result   = readResponse(connection,
+                                                             requests[group.next].m_impl->method,
+                                                             response,
+                                                             bodyCallback);
+
+                    if (result == ReadResult::Complete)
+                        continue;
+
+                    reusable = false;
+
+                    if (result == ReadResult::CompleteClosed)
+                    {
+                        // The host will not answer the other requests sent over this connection
+                        ++group.next;
+
+                        if (group.next < group.batchEnd)
+                            retryOrAbandon(group);
+                    }
+                    else if (result == ReadResult::NothingRead && (connection.reused || group.next > first))
+                    {
+                        // A stale pooled connection, or the host closed it after the previous response
+                        response = Response();
+                        retryOrAbandon(group);
+                    }
+                    else
+                    {
+                        // Keep the diagnosis if the header could not be parsed
+                        if (response.m_impl->status != Response::Status::InvalidResponse)
+                            response.m_impl->status = Response::Status::ConnectionFailed;
+
+                        group.next = group.end;
+                    }
+
+                    break;
+                }
+
+                pending |= group.next < group.end;
+
+                releaseConnection(SFML_BASE_MOVE(connection), reusable);
+                group.connection.reset();
+            }
+        }
     }
 };
 
@@ -368,6 +862,18 @@ Http::Http(const std::string& host, unsigned short port)
 ////////////////////////////////////////////////////////////
 void Http::setHost(const std::string& host, unsigned short port)
 {
+    // Parse the host name, then resolve it (blocking)
+    setHost(host, port, IpAddress::Any);
+    m_impl->host = IpAddressUtils::resolve(m_impl->hostName);
+}
+
+
+////////////////////////////////////////////////////////////
+void Http::setHost(const std::string& host, unsigned short port, IpAddress address)
+{
+    // Connections to the previous host cannot be reused
+    m_impl->closeIdleConnections();
+
     // Check the protocol
     if (priv::toLower(host.substr(0, 7)) == "http://")
     {
@@ -393,76 +899,100 @@ void Http::setHost(const std::string& host, unsigned short port)
     if (!m_impl->hostName.empty() && (*m_impl->hostName.rbegin() == '/'))
         m_impl->hostName.erase(m_impl->hostName.size() - 1);
 
-    m_impl->host = IpAddressUtils::resolve(m_impl->hostName);
+    if (m_impl->hostName.empty())
+        m_impl->host.reset();
+    else
+        m_impl->host.emplace(address);
 }
 
 
 ////////////////////////////////////////////////////////////
 Http::Response Http::sendRequest(const Http::Request& request, Time timeout)
 {
-    // First make sure that the request is valid -- add missing mandatory fields
-    Request toSend(request);
-    if (!toSend.hasField("From"))
-    {
-        toSend.setField("From", "user@sfml-dev.org");
-    }
-    if (!toSend.hasField("User-Agent"))
-    {
-        toSend.setField("User-Agent", "libsfml-network/3.x");
-    }
-    if (!toSend.hasField("Host"))
-    {
-        toSend.setField("Host", m_impl->hostName);
-    }
-    if (!toSend.hasField("Content-Length"))
-    {
-        std::ostringstream out;
-        out << toSend.m_impl->body.size();
-        toSend.setField("Content-Length", out.str());
-    }
-    if ((toSend.m_impl->method == Request::Method::Post) && !toSend.hasField("Content-Type"))
-    {
-        toSend.setField("Content-Type", "application/x-www-form-urlencoded");
-    }
-    if ((toSend.m_impl->majorVersion * 10 + toSend.m_impl->minorVersion >= 11) && !toSend.hasField("Connection"))
-    {
-        toSend.setField("Connection", "close");
-    }
+    Response received;
+    m_impl->sendPipelined({&request, 1},
+                          {&received, 1},
+                          /* connectionCount */ 1,
+                          m_impl->keepAlive,
+                          /* bodyCallback */ nullptr,
+                          timeout);
+    return received;
+}
+
 
-    // Prepare the response
+////////////////////////////////////////////////////////////
+Http::Response Http::sendRequest(const Http::Request& request, const BodyCallback& bodyCallback, Time timeout)
+{
     Response received;
+    m_impl->sendPipelined({&request, 1},
+                          {&received, 1},
+                          /* connectionCount */ 1,
+                          m_impl->keepAlive,
+                          &bodyCallback,
+                          timeout);
+    return received;
+}
 
-    // Connect the socket to the host
-    if (m_impl->connection.connect(m_impl->host.value(), m_impl->port, timeout) == Socket::Status::Done)
-    {
-        // Convert the request to string and send it through the connected socket
-        const std::string requestStr = toSend.prepare();
 
-        if (!requestStr.empty())
-        {
-            // Send it through the socket
-            if (m_impl->connection.send(requestStr.c_str(), requestStr.size()) == Socket::Status::Done)
-            {
-                // Wait for the server's response
-                std::string receivedStr;
-                base::SizeT size = 0;
-                char        buffer[1024];
-                while (m_impl->connection.receive(buffer, sizeof(buffer), size) == Socket::Status::Done)
-                {
-                    receivedStr.append(buffer, buffer + size);
-                }
+////////////////////////////////////////////////////////////
+std::vector<Http::Response> Http::sendRequests(base::Span<const Request> requests, Time timeout)
+{
+    std::vector<Response> responses(requests.size());
 
-                // Build the Response object from the received data
-                received.parse(receivedStr);
-            }
-        }
+    if (!requests.empty())
+        m_impl->sendPipelined(requests,
+                              {responses.data(), responses.size()},
+                              base::min(m_impl->maxConnections, requests.size()),
+                              /* persistent */ true,
+                              /* bodyCallback */ nullptr,
+                              timeout);
 
-        // Close the connection
-        [[maybe_unused]] const bool rc = m_impl->connection.disconnect();
-        SFML_BASE_ASSERT(rc);
-    }
+    // Pipelining is a per-call override, honor the user's choice for idle connections
+    if (!m_impl->keepAlive)
+        m_impl->closeIdleConnections();
 
-    return received;
+    return responses;
+}
+
+
+////////////////////////////////////////////////////////////
+void Http::setKeepAlive(bool keepAlive)
+{
+    m_impl->keepAlive = keepAlive;
+
+    if (!keepAlive)
+        m_impl->closeIdleConnections();
+}
+
+
+////////////////////////////////////////////////////////////
+bool Http::getKeepAlive() const
+{
+    return m_impl->keepAlive;
+}
+
+
+////////////////////////////////////////////////////////////
+void Http::setMaxConnections(base::SizeT maxConnections)
+{
+    m_impl->maxConnections = base::max(maxConnections, base::SizeT{1});
+
+    while (m_impl->idleConnections.size() > m_impl->maxConnections)
+        m_impl->idleConnections.pop_back();
+}
+
+
+////////////////////////////////////////////////////////////
+base::SizeT Http::getMaxConnections() const
+{
+    return m_impl->maxConnections;
+}
+
+
+////////////////////////////////////////////////////////////
+base::SizeT Http::getIdleConnectionCount() const
+{
+    return m_impl->idleConnections.size();
 }
 
 } // namespace sf
@@ -7,16 +7,566 @@
 #include "SFML/System/Path.hpp"
 #include "SFML/System/PathUtils.hpp"
 
+#include "SFML/Base/Algorithm.hpp"
+#include "SFML/Base/Assert.hpp"
+#include "SFML/Base/Builtins/Memcpy.hpp"
+#include "SFML/Base/IntTypes.hpp"
+#include "SFML/Base/SizeT.hpp"
+#include "SFML/Base/SpscQueue.hpp"
 #include "SFML/Base/StackTrace.hpp"
 #include "SFML/Base/StringView.hpp"
 #include "SFML/Base/Traits/IsSame.hpp"
 
+#ifdef SFML_SYSTEM_WINDOWS
+#include "SFML/System/Win32/WindowsHeader.hpp"
+#else
+#include <cerrno>
+#include <unistd.h>
+#endif
+
 #include <atomic>
+#include <charconv>
+#include <csignal>
 #include <iostream>
 #include <mutex>
 #include <ostream>
+#include <streambuf>
 #include <string>
 #include <string_view>
+#include <thread>
+
+
+namespace
+{
+////////////////////////////////////////////////////////////
+constexpr sf::base::SizeT maxMessageSize        = 16u * 1024u; //!< Longer messages are truncated
+constexpr sf::base::SizeT ringCapacity          = 64u * 1024u; //!< Bytes of pending messages per thread
+constexpr sf::base::SizeT preallocatedRingCount = 4u; //!< Rings created upfront, so that most threads never allocate
+constexpr sf::base::SizeT crashClaimAttempts    = 16u * 1024u * 1024u; //!< Bound of the crash handler's wait for a ring
+
+////////////////////////////////////////////////////////////
+/// \brief Stream buffer formatting a message into a fixed array
+///
+/// Characters that do not fit are dropped, so that formatting
+/// a message never allocates. Room is left before the message
+/// for its size and after it for a suffix, so that the whole
+/// record can be queued at once.
+///
+////////////////////////////////////////////////////////////
+class MessageStreamBuf : public std::streambuf
+{
+public:
+    ////////////////////////////////////////////////////////////
+    static constexpr sf::base::SizeT headerSize     = sizeof(sf::base::SizeT);
+    static constexpr sf::base::SizeT suffixCapacity = 8u;
+
+    ////////////////////////////////////////////////////////////
+    MessageStreamBuf()
+    {
+        reset();
+    }
+
+    ////////////////////////////////////////////////////////////
+    void reset()
+    {
+        setp(m_data + headerSize, m_data + headerSize + maxMessageSize);
+        m_truncated = false;
+    }
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Append `suffix` and the size header, and return the size of the whole record
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] sf::base::SizeT finishRecord(std::string_view suffix)
+    {
+        SFML_BASE_ASSERT(suffix.size() <= suffixCapacity);
+        SFML_BASE_MEMCPY(pptr(), suffix.data(), suffix.size());
+
+        const auto payloadSize = static_cast<sf::base::SizeT>(pptr() - pbase()) + suffix.size();
+        SFML_BASE_MEMCPY(m_data, &payloadSize, headerSize);
+
+        return headerSize + payloadSize;
+    }
+
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] const char* getRecord() const
+    {
+        return m_data;
+    }
+
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool isTruncated() const
+    {
+        return m_truncated;
+    }
+
+protected:
+    ////////////////////////////////////////////////////////////
+    int_type overflow(int_type character) override
+    {
+        m_truncated = true;
+        return traits_type::not_eof(character);
+    }
+
+private:
+    char m_data[headerSize + maxMessageSize + suffixCapacity];
+    bool m_truncated{};
+};
+
+
+////////////////////////////////////////////////////////////
+/// \brief Per-thread queue of messages
+///
+/// Each thread emitting messages owns a ring: it is the only one
+/// pushing into it. A single thread at a time drains it, usually
+/// the flusher, which claims it through `drainer` for the duration
+/// of the drain, so that the crash handler can take it over without
+/// any lock. Rings are never freed, a ring released by an exiting
+/// thread is reused by the next thread that needs one.
+///
+////////////////////////////////////////////////////////////
+struct Ring
+{
+    ////////////////////////////////////////////////////////////
+    /// \brief Queue the message formatted in `messageBuffer`, or drop it if there is no room
+    ///
+    ////////////////////////////////////////////////////////////
+    void push(std::string_view suffix)
+    {
+        const sf::base::SizeT recordSize = messageBuffer.finishRecord(suffix);
+        messageBuffer.reset();
+
+        // Only this thread pushes, so the free space cannot shrink in between
+        if (queue.capacity() - queue.size() < recordSize)
+        {
+            droppedCount.fetch_add(1u, std::memory_order_relaxed);
+            return;
+        }
+
+        [[maybe_unused]] const sf::base::SizeT pushed = queue.tryPushBulk(messageBuffer.getRecord(), recordSize);
+        SFML_BASE_ASSERT(pushed == recordSize);
+    }
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Become the thread draining the ring, fails if another thread is draining it
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool tryClaimDrain(std::thread::id self)
+    {
+        std::thread::id expected{};
+        return drainer.compare_exchange_strong(expected, self, std::memory_order_acquire, std::memory_order_relaxed) ||
+               expected == self;
+    }
+
+    ////////////////////////////////////////////////////////////
+    void releaseDrain()
+    {
+        drainer.store(std::thread::id{}, std::memory_order_release);
+    }
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Pass every pending message to `sink`, in chunks
+    ///
+    ////////////////////////////////////////////////////////////
+    template <typename Sink>
+    void drain(Sink&& sink)
+    {
+        // Records are pushed whole, so a size is always followed by its payload
+        sf::base::SizeT payloadSize{};
+
+        while (queue.tryPopBulk(reinterpret_cast<char*>(&payloadSize), sizeof(payloadSize)) == sizeof(payloadSize))
+        {
+            char chunk[1024];
+
+            for (sf::base::SizeT remaining = payloadSize; remaining > 0u;)
+            {
+                const sf::base::SizeT popped = queue.tryPopBulk(chunk, sf::base::min(remaining, sizeof(chunk)));
+
+                // Only possible if the ring was corrupted, e.g. by a crash mid-push: stop rather than spin
+                if (popped == 0u)
+                    return;
+
+                sink(chunk, popped);
+                remaining -= popped;
+            }
+        }
+    }
+
+    sf::base::SpscQueue<char, ringCapacity> queue;                         //!< Pending messages, prefixed by size
+    std::atomic<sf::base::SizeT>            droppedCount{0u};              //!< Messages dropped for lack of room
+    std::atomic<bool>                       claimed{false};                //!< Whether a thread owns the ring
+    std::atomic<std::thread::id>            drainer{};                     //!< Thread draining the ring, if any
+    Ring*                                   next{nullptr};                 //!< Next ring in `ringList`
+    MessageStreamBuf                        messageBuffer;                 //!< Message being formatted
+    std::ostream                            messageStream{&messageBuffer}; //!< Formats into `messageBuffer`
+};
+
+
+////////////////////////////////////////////////////////////
+std::atomic<Ring*> ringList{nullptr}; //!< Every ring ever created
+
+
+////////////////////////////////////////////////////////////
+void publishRing(Ring& ring)
+{
+    ring.next = ringList.load(std::memory_order_relaxed);
+    while (!ringList.compare_exchange_weak(ring.next, &ring, std::memory_order_release, std::memory_order_relaxed))
+        ;
+}
+
+
+////////////////////////////////////////////////////////////
+/// \brief Return the ring of the calling thread, claiming one on first use
+///
+////////////////////////////////////////////////////////////
+[[nodiscard]] Ring& getThreadRing()
+{
+    struct Claim
+    {
+        Ring* ring{};
+
+        ~Claim()
+        {
+            if (ring != nullptr)
+                ring->claimed.store(false, std::memory_order_release);
+        }
+    };
+
+    thread_local Claim claim;
+
+    if (claim.ring != nullptr)
+        return *claim.ring;
+
+    for (Ring* ring = ringList.load(std::memory_order_acquire); ring != nullptr; ring = ring->next)
+    {
+        bool expected = false;
+        if (ring->claimed.compare_exchange_strong(expected, true, std::memory_order_acquire))
+            return *(claim.ring = ring);
+    }
+
+    // Every existing ring is in use, this is the only allocation a thread may ever do
+    auto* const ring = new Ring;
+    ring->claimed.store(true, std::memory_order_relaxed);
+    publishRing(*ring);
+
+    return *(claim.ring = ring);
+}
+
+
+////////////////////////////////////////////////////////////
+/// \brief Standard output the crash handler writes to, see `AsyncLog::flushOnCrash`
+///
+////////////////////////////////////////////////////////////
+enum class CrashOutput : unsigned char
+{
+    None,
+    StdOut,
+    StdErr
+};
+
+
+////////////////////////////////////////////////////////////
+[[nodiscard]] CrashOutput getCrashOutput(const std::streambuf* sink)
+{
+    if (sink == nullptr)
+        return CrashOutput::None;
+
+    // Other sinks cannot be written to from a signal handler, the standard error output is the closest substitute
+    return sink == std::cout.rdbuf() ? CrashOutput::StdOut : CrashOutput::StdErr;
+}
+
+
+////////////////////////////////////////////////////////////
+/// \brief Write `data` to `output` with a single system call, async-signal-safe
+///
+////////////////////////////////////////////////////////////
+void writeOnCrash(CrashOutput output, const char* data, sf::base::SizeT size)
+{
+    if (output == CrashOutput::None)
+        return;
+
+#ifdef SFML_SYSTEM_WINDOWS
+    const HANDLE handle = GetStdHandle(output == CrashOutput::StdOut ? STD_OUTPUT_HANDLE : STD_ERROR_HANDLE);
+    if (handle == nullptr || handle == INVALID_HANDLE_VALUE)
+        return;
+
+    DWORD written{};
+    WriteFile(handle, data, static_cast<DWORD>(size), &written, nullptr);
+#else
+    const int fd = output == CrashOutput::StdOut ? STDOUT_FILENO : STDERR_FILENO;
+
+    while (size > 0u)
+    {
+        const ssize_t written = ::write(fd, data, size);
+
+        if (written < 0)
+        {
+            if (errno == EINTR)
+                continue;
+
+            return;
+        }
+
+        data += written;
+        size -= static_cast<sf::base::SizeT>(written);
+    }
+#endif
+}
+
+
+////////////////////////////////////////////////////////////
+/// \brief Background writer of the messages queued by all threads
+///
+////////////////////////////////////////////////////////////
+class AsyncLog
+{
+public:
+    ////////////////////////////////////////////////////////////
+    explicit AsyncLog(std::streambuf* sink) : m_sink(sink), m_crashOutput(getCrashOutput(sink))
+    {
+        for (sf::base::SizeT i = 0u; i < preallocatedRingCount; ++i)
+            publishRing(*new Ring);
+
+        m_flusherThread = std::thread([this] { flusherLoop(); });
+    }
+
+    ////////////////////////////////////////////////////////////
+    ~AsyncLog()
+    {
+        m_stopRequested.store(true, std::memory_order_release);
+        wake();
+        m_flusherThread.join();
+
+        // Messages emitted by other threads while the flusher was exiting
+        flush();
+    }
+
+    ////////////////////////////////////////////////////////////
+    AsyncLog(const AsyncLog&)            = delete;
+    AsyncLog& operator=(const AsyncLog&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    AsyncLog(AsyncLog&&)            = delete;
+    AsyncLog& operator=(AsyncLog&&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Notify the flusher that a message was queued, never blocks
+    ///
+    ////////////////////////////////////////////////////////////
+    void wake()
+    {
+        m_wakeCounter.fetch_add(1u, std::memory_order_release);
+        m_wakeCounter.notify_one();
+    }
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Write every message queued so far to the sink
+    ///
+    ////////////////////////////////////////////////////////////
+    void flush()
+    {
+        const std::lock_guard lock(m_sinkMutex);
+        drainAll();
+    }
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Best effort flush from a signal handler
+    ///
+    /// Neither the mutex nor the sink are used, as the crashing
+    /// thread might be holding the former or be in the middle of
+    /// writing to the latter. Each ring is claimed on its own and
+    /// written with raw system calls to the standard output that
+    /// corresponds to the sink instead (see `getCrashOutput`).
+    ///
+    /// A ring that the crashing thread was draining is resumed,
+    /// possibly in the middle of a message. A ring that another
+    /// thread is draining is waited for, up to `crashClaimAttempts`
+    /// attempts to claim it: if that thread is stuck writing to
+    /// the sink for longer, the rest of that ring is lost. A ring
+    /// whose owner crashed in the middle of a push is drained up
+    /// to its last complete message.
+    ///
+    ////////////////////////////////////////////////////////////
+    void flushOnCrash()
+    {
+        const std::thread::id self   = std::this_thread::get_id();
+        const CrashOutput     output = m_crashOutput.load(std::memory_order_relaxed);
+
+        for (Ring* ring = ringList.load(std::memory_order_acquire); ring != nullptr; ring = ring->next)
+        {
+            bool claimed = false;
+
+            for (sf::base::SizeT attempt = 0u; attempt < crashClaimAttempts && !claimed; ++attempt)
+                claimed = ring->tryClaimDrain(self);
+
+            // The ring stays claimed, so that the flusher leaves it alone until the process terminates
+            if (claimed)
+                drainRing(*ring,
+                          [output](const char* data, sf::base::SizeT size) { writeOnCrash(output, data, size); });
+        }
+    }
+
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::streambuf* getSink()
+    {
+        const std::lock_guard lock(m_sinkMutex);
+        return m_sink;
+    }
+
+    ////////////////////////////////////////////////////////////
+    void setSink(std::streambuf* sink)
+    {
+        // Messages emitted before the switch still go to the previous sink
+        const std::lock_guard lock(m_sinkMutex);
+        drainAll();
+        m_sink = sink;
+        m_crashOutput.store(getCrashOutput(sink), std::memory_order_relaxed);
+    }
+
+private:
+    ////////////////////////////////////////////////////////////
+    void flusherLoop()
+    {
+        while (true)
+        {
+            const sf::base::U32 observedWakeCount = m_wakeCounter.load(std::memory_order_acquire);
+
+            flush();
+
+            if (m_stopRequested.load(std::memory_order_acquire))
+                return;
+
+            // Returns immediately if a message was queued since `observedWakeCount` was read
+            m_wakeCounter.wait(observedWakeCount, std::memory_order_acquire);
+        }
+    }
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Pass the pending messages of `ring` to `write`, followed by a notice if any were dropped
+    ///
+    /// \return `true` if anything was written
+    ///
+    ////////////////////////////////////////////////////////////
+    template <typename Write>
+    static bool drainRing(Ring& ring, Write&& write)
+    {
+        bool wroteAnything = false;
+
+        ring.drain(
+            [&](const char* data, sf::base::SizeT size)
+            {
+                write(data, size);
+                wroteAnything = true;
+            });
+
+        if (const sf::base::SizeT droppedCount = ring.droppedCount.exchange(0u, std::memory_order_relaxed))
+        {
+            // Formatted on the stack, as this also runs in the crash handler where allocating is unsafe
+            constexpr std::string_view prefix = "[[SFML ERROR]]: ";
+            constexpr std::string_view suffix = " message(s) dropped, too many were emitted at once\n";
+
+            char notice[prefix.size() + 20u + suffix.size()]; // 20 digits fit any 64-bit count
+
+            SFML_BASE_MEMCPY(notice, prefix.data(), prefix.size());
+            char* const countEnd = std::to_chars(notice + prefix.size(), notice + sizeof(notice), droppedCount).ptr;
+            SFML_BASE_MEMCPY(countEnd, suffix.data(), suffix.size());
+
+            write(notice, static_cast<sf::base::SizeT>(countEnd - notice) + suffix.size());
+            wroteAnything = true;
+        }
+
+        return wroteAnything;
+    }
+
+    ////////////////////////////////////////////////////////////
+    void drainAll()
+    {
+        const std::thread::id self = std::this_thread::get_id();
+
+        const auto write = [this](const char* data, sf::base::SizeT size)
+        {
+            if (m_sink != nullptr)
+                m_sink->sputn(data, static_cast<std::streamsize>(size));
+        };
+
+        bool wroteAnything = false;
+
+        for (Ring* ring = ringList.load(std::memory_order_acquire); ring != nullptr; ring = ring->next)
+        {
+            // Only fails once the crash handler took the ring over
+            if (!ring->tryClaimDrain(self))
+                continue;
+
+            wroteAnything |= drainRing(*ring, write);
+            ring->releaseDrain();
+        }
+
+        if (wroteAnything && m_sink != nullptr)
+            m_sink->pubsync();
+    }
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    std::mutex                 m_sinkMutex;            //!< Serializes the draining of the rings into the sink
+    std::streambuf*            m_sink;                 //!< Destination of the messages, guarded by `m_sinkMutex`
+    std::atomic<CrashOutput>   m_crashOutput;          //!< Where the crash handler writes, follows `m_sink`
+    std::atomic<sf::base::U32> m_wakeCounter{0u};      //!< Bumped every time a message is queued
+    std::atomic<bool>          m_stopRequested{false}; //!< Asks the flusher thread to exit
+    std::thread                m_flusherThread;        //!< Background thread writing to the sink
+};
+
+
+////////////////////////////////////////////////////////////
+std::atomic<AsyncLog*> activeLog{nullptr}; //!< Log flushed by `ErrStream::Guard` and by the crash handler
+
+
+////////////////////////////////////////////////////////////
+constexpr int crashSignals[]{SIGABRT, SIGFPE, SIGILL, SIGSEGV};
+
+using SignalHandler = void (*)(int);
+SignalHandler previousSignalHandlers[sizeof(crashSignals) / sizeof(crashSignals[0])]{};
+
+
+////////////////////////////////////////////////////////////
+void crashHandler(int signal)
+{
+    if (AsyncLog* const log = activeLog.exchange(nullptr))
+        log->flushOnCrash();
+
+    // Let the previous (usually default) handler terminate the process
+    for (sf::base::SizeT i = 0u; i < sizeof(crashSignals) / sizeof(crashSignals[0]); ++i)
+        if (crashSignals[i] == signal)
+            std::signal(signal, previousSignalHandlers[i]);
+
+    std::raise(signal);
+}
+
+
+////////////////////////////////////////////////////////////
+void installCrashHandlers()
+{
+    for (sf::base::SizeT i = 0u; i < sizeof(crashSignals) / sizeof(crashSignals[0]); ++i)
+    {
+        const SignalHandler previous = std::signal(crashSignals[i], &crashHandler);
+        previousSignalHandlers[i]    = previous == SIG_ERR ? SIG_DFL : previous;
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+void uninstallCrashHandlers()
+{
+    for (sf::base::SizeT i = 0u; i < sizeof(crashSignals) / sizeof(crashSignals[0]); ++i)
+    {
+        // Leave handlers installed by the user after ours alone
+        const SignalHandler current = std::signal(crashSignals[i], previousSignalHandlers[i]);
+        if (current != &crashHandler && current != SIG_ERR)
+            std::signal(crashSignals[i], current);
+    }
+}
+
+} // namespace
 
 
 namespace sf::priv
@@ -24,20 +574,30 @@ namespace sf::priv
 ////////////////////////////////////////////////////////////
 struct ErrStream::Impl
 {
-    std::ostream      stream;
-    std::mutex        mutex;
+    AsyncLog          log;
     std::atomic<bool> multiLine;
 
-    explicit Impl(std::streambuf* sbuf) : stream(sbuf)
+    explicit Impl(std::streambuf* sbuf) : log(sbuf)
     {
+        activeLog.store(&log);
+        installCrashHandlers();
     }
+
+    ~Impl()
+    {
+        uninstallCrashHandlers();
+        activeLog.store(nullptr);
+    }
+
+    Impl(const Impl&)            = delete;
+    Impl& operator=(const Impl&) = delete;
 };
 
 
 ////////////////////////////////////////////////////////////
-ErrStream::Guard::Guard(std::ostream& stream, void* mutexPtr, bool multiLine) :
+ErrStream::Guard::Guard(std::ostream& stream, void* ringPtr, bool multiLine) :
 m_stream(stream),
-m_mutexPtr(mutexPtr),
+m_ringPtr(ringPtr),
 m_multiLine(multiLine)
 {
 }
@@ -46,17 +606,26 @@ m_multiLine(multiLine)
 ////////////////////////////////////////////////////////////
 ErrStream::Guard::~Guard()
 {
+    auto& ring = *static_cast<Ring*>(m_ringPtr);
+
+    const bool truncated = ring.messageBuffer.isTruncated();
+    ring.push(truncated ? (m_multiLine ? " [...]" : " [...]\n") : (m_multiLine ? "" : "\n"));
+
+    AsyncLog* const log = activeLog.load(std::memory_order_acquire);
+    if (log == nullptr)
+        return;
+
+    log->wake();
+
+#ifdef SFML_ENABLE_STACK_TRACES
+    // The stack trace is printed directly, flush first so that it follows the message.
+    // This blocks the emitting thread on the sink and on I/O, see `sf::priv::err`
     if (!m_multiLine)
     {
-#ifdef SFML_ENABLE_STACK_TRACES
-        m_stream << '\n';
+        log->flush();
         base::priv::printStackTrace();
-#endif
-
-        m_stream << '\n' << std::flush;
     }
-
-    static_cast<std::mutex*>(m_mutexPtr)->unlock();
+#endif
 }
 
 
@@ -90,16 +659,21 @@ ErrStream::Guard ErrStream::operator<<(std::ostream& (*func)(std::ostream&))
 ////////////////////////////////////////////////////////////
 std::streambuf* ErrStream::rdbuf()
 {
-    const std::unique_lock lockGuard(m_impl->mutex);
-    return m_impl->stream.rdbuf();
+    return m_impl->log.getSink();
 }
 
 
 ////////////////////////////////////////////////////////////
 void ErrStream::rdbuf(std::streambuf* sbuf)
 {
-    const std::unique_lock lockGuard(m_impl->mutex);
-    m_impl->stream.rdbuf(sbuf);
+    m_impl->log.setSink(sbuf);
+}
+
+
+////////////////////////////////////////////////////////////
+void ErrStream::flush()
+{
+    m_impl->log.flush();
 }
 
 
@@ -116,42 +690,40 @@ ErrStream& err(bool multiLine)
 template <typename T>
 ErrStream::Guard ErrStream::operator<<(const T& value)
 {
-    m_impl->mutex.lock(); // Will be unlocked by `~Guard()`
-    m_impl->stream << "[[SFML ERROR]]: " << value;
+    Ring& ring = getThreadRing(); // Message will be queued by `~Guard()`
+    ring.messageStream << "[[SFML ERROR]]: " << value;
 
-    return Guard{m_impl->stream, &m_impl->mutex, m_impl->multiLine.load()};
+    return Guard{ring.messageStream, &ring, m_impl->multiLine.load()};
 }
 
 
 ////////////////////////////////////////////////////////////
 ErrStream::Guard ErrStream::operator<<(const char* value)
 {
-    m_impl->mutex.lock(); // Will be unlocked by `~Guard()`
-    m_impl->stream << "[[SFML ERROR]]: " << value;
+    Ring& ring = getThreadRing(); // Message will be queued by `~Guard()`
+    ring.messageStream << "[[SFML ERROR]]: " << value;
 
-    return Guard{m_impl->stream, &m_impl->mutex, m_impl->multiLine.load()};
+    return Guard{ring.messageStream, &ring, m_impl->multiLine.load()};
 }
 
 
 ////////////////////////////////////////////////////////////
 ErrStream::Guard ErrStream::operator<<(ErrFlushType)
 {
-    m_impl->mutex.lock(); // Will be unlocked by `~Guard()`
-    m_impl->stream << std::flush;
-
-    return Guard{m_impl->stream, &m_impl->mutex, m_impl->multiLine.load()};
+    Ring& ring = getThreadRing(); // Message will be queued by `~Guard()`
+    return Guard{ring.messageStream, &ring, m_impl->multiLine.load()};
 }
 
 
 ////////////////////////////////////////////////////////////
 ErrStream::Guard ErrStream::operator<<(PathDebugFormatter pathDebugFormatter)
 {
-    m_impl->mutex.lock(); // Will be unlocked by `~Guard()`
+    Ring& ring = getThreadRing(); // Message will be queued by `~Guard()`
 
-    m_impl->stream << "    Provided path: " << pathDebugFormatter.path.to<std::string>() << '\n'
-                   << "    Absolute path: " << pathDebugFormatter.path.absolute();
+    ring.messageStream << "    Provided path: " << pathDebugFormatter.path.to<std::string>() << '\n'
+                       << "    Absolute path: " << pathDebugFormatter.path.absolute();
 
-    return Guard{m_impl->stream, &m_impl->mutex, m_impl->multiLine.load()};
+    return Guard{ring.messageStream, &ring, m_impl->multiLine.load()};
 }
 
 
@@ -173,7 +745,7 @@ ErrStream::Guard& ErrStream::Guard::operator<<(const char* value)
 ////////////////////////////////////////////////////////////
 ErrStream::Guard& ErrStream::Guard::operator<<(ErrFlushType)
 {
-    m_stream << std::flush;
+    // Every message is handed to the flusher thread as soon as it is complete
     return *this;
 }
 
@@ -0,0 +1,52 @@
+#pragma once
+#include <SFML/Copyright.hpp> // LICENSE AND COPYRIGHT (C) INFORMATION
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include "SFML/Base/Optional.hpp"
+#include "SFML/Base/SizeT.hpp"
+
+
+////////////////////////////////////////////////////////////
+// Forward declarations
+////////////////////////////////////////////////////////////
+namespace sf
+{
+class Path;
+} // namespace sf
+
+
+namespace sf::priv
+{
+////////////////////////////////////////////////////////////
+/// \brief Read-only view of a whole file mapped into memory
+///
+////////////////////////////////////////////////////////////
+struct FileMapping
+{
+    const unsigned char* data{}; //!< First byte of the file, `nullptr` for empty files
+    base::SizeT          size{}; //!< Size of the file in bytes
+};
+
+
+////////////////////////////////////////////////////////////
+/// \brief Map a whole file into memory, read-only
+///
+/// The OS is hinted that the mapping will be read sequentially.
+/// Empty files succeed with a null mapping.
+///
+/// \param filename Path of the file to map
+///
+/// \return The mapping on success, `base::nullOpt` on error
+///
+////////////////////////////////////////////////////////////
+[[nodiscard]] base::Optional<FileMapping> mapFile(const Path& filename);
+
+////////////////////////////////////////////////////////////
+/// \brief Release a mapping returned by `mapFile`
+///
+////////////////////////////////////////////////////////////
+void unmapFile(const FileMapping& mapping);
+
+} // namespace sf::priv
@@ -0,0 +1,447 @@
+#include <SFML/Copyright.hpp> // LICENSE AND COPYRIGHT (C) INFORMATION
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include "SFML/System/JobSystem.hpp"
+
+#include "SFML/Base/Algorithm.hpp"
+#include "SFML/Base/Assert.hpp"
+#include "SFML/Base/Macros.hpp"
+#include "SFML/Base/TrivialVector.hpp"
+
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+
+namespace
+{
+////////////////////////////////////////////////////////////
+thread_local const void*  currentJobSystem{nullptr}; //!< System owning the current thread, if it is a worker
+thread_local unsigned int currentWorkerIndex{0u};    //!< Index of the current worker in its system
+
+} // namespace
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+struct JobSystem::Impl
+{
+    ////////////////////////////////////////////////////////////
+    struct JobRecord
+    {
+        Job                            job;                         //!< Function to run, empty once completed
+        std::mutex                     mutex;                       //!< Guards `continuations` and completion
+        base::TrivialVector<base::U32> continuations;               //!< Jobs depending on this one
+        std::atomic<base::U32>         generation{0u};              //!< Bumped every time a job completes
+        std::atomic<base::U32>         unfinishedDependencyCount{}; //!< Plus one while still being scheduled
+    };
+
+    ////////////////////////////////////////////////////////////
+    /// Bounded deque of ready jobs, never holds more than
+    /// `maxPendingJobs` as there are no more job slots
+    ///
+    ////////////////////////////////////////////////////////////
+    struct alignas(64) WorkQueue
+    {
+        std::mutex  mutex;                 //!< Guards the whole queue
+        base::U32   items[maxPendingJobs]; //!< Circular storage of job slot indices
+        base::SizeT front{};               //!< Position of the oldest job
+        base::SizeT size{};                //!< Number of queued jobs
+
+        void pushBack(base::U32 index)
+        {
+            const std::lock_guard lock(mutex);
+
+            SFML_BASE_ASSERT(size < maxPendingJobs);
+            items[(front + size++) % maxPendingJobs] = index;
+        }
+
+        [[nodiscard]] bool popBack(base::U32& index)
+        {
+            const std::lock_guard lock(mutex);
+
+            if (size == 0u)
+                return false;
+
+            index = items[(front + --size) % maxPendingJobs];
+            return true;
+        }
+
+        [[nodiscard]] bool popFront(base::U32& index)
+        {
+            const std::lock_guard lock(mutex);
+
+            if (size == 0u)
+                return false;
+
+            index = items[front];
+            front = (front + 1u) % maxPendingJobs;
+            --size;
+            return true;
+        }
+    };
+
+    ////////////////////////////////////////////////////////////
+    explicit Impl(unsigned int theWorkerCount) :
+    workerCount(theWorkerCount),
+    records(maxPendingJobs),
+    queues(workerCount + 1u)
+    {
+        // Lowest slots are handed out first, which keeps the execution order with no workers easy to follow
+        for (base::SizeT i = 0u; i < maxPendingJobs; ++i)
+            freeSlots[i] = static_cast<base::U32>(maxPendingJobs - 1u - i);
+
+        freeSlotCount = maxPendingJobs;
+
+        workers.reserve(workerCount);
+
+        for (unsigned int i = 0u; i < workerCount; ++i)
+            workers.emplace_back([this, i] { workerLoop(i); });
+    }
+
+    ////////////////////////////////////////////////////////////
+    ~Impl()
+    {
+        waitAll();
+
+        stopRequested.store(true, std::memory_order_release);
+        workSignal.fetch_add(1u, std::memory_order_release);
+        workSignal.notify_all();
+
+        for (std::thread& worker : workers)
+            worker.join();
+    }
+
+    ////////////////////////////////////////////////////////////
+    Impl(const Impl&)            = delete;
+    Impl& operator=(const Impl&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool isWorkerThread() const
+    {
+        return currentJobSystem == this;
+    }
+
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] base::U32 allocateSlot()
+    {
+        while (true)
+        {
+            {
+                const std::lock_guard lock(slotMutex);
+
+                if (freeSlotCount > 0u)
+                    return freeSlots[--freeSlotCount];
+            }
+
+            // Every slot is taken, make room by running some of the pending jobs
+            if (!runOneJob())
+                std::this_thread::yield();
+        }
+    }
+
+    ////////////////////////////////////////////////////////////
+    void releaseSlot(base::U32 index)
+    {
+        const std::lock_guard lock(slotMutex);
+        freeSlots[freeSlotCount++] = index;
+    }
+
+    ////////////////////////////////////////////////////////////
+    void enqueue(base::U32 index)
+    {
+        // Workers push to their own queue, other threads to the shared one after the worker queues
+        queues[isWorkerThread() ? currentWorkerIndex : workerCount].pushBack(index);
+
+        // Sequentially consistent, so that a worker about to sleep either is counted or sees the new signal
+        workSignal.fetch_add(1u);
+
+        if (sleepingWorkerCount.load() > 0u)
+            workSignal.notify_one();
+    }
+
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool tryPopJob(base::U32& index)
+    {
+        if (isWorkerThread())
+        {
+            // Newest job of the own queue first as its data is most likely still in cache
+            if (queues[currentWorkerIndex].popBack(index))
+                return true;
+
+            if (queues[workerCount].popFront(index))
+                return true;
+
+            for (unsigned int i = 1u; i < workerCount; ++i)
+                if (queues[(currentWorkerIndex + i) % workerCount].popFront(index))
+                    return true;
+
+            return false;
+        }
+
+        // Oldest job first, so that with no workers jobs run in the order in which they became ready
+        if (queues[workerCount].popFront(index))
+            return true;
+
+        for (unsigned int i = 0u; i < workerCount; ++i)
+            if (queues[i].popFront(index))
+                return true;
+
+        return false;
+    }
+
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool runOneJob()
+    {
+        base::U32 index{};
+
+        if (!tryPopJob(index))
+            return false;
+
+        JobRecord& record = records[index];
+
+        record.job();
+        record.job = Job{};
+
+        complete(index);
+        return true;
+    }
+
+    ////////////////////////////////////////////////////////////
+    void complete(base::U32 index)
+    {
+        JobRecord& record = records[index];
+
+        {
+            const std::lock_guard lock(record.mutex);
+
+            // From now on, handles to this job report it as done and no new continuation can be added
+            record.generation.fetch_add(1u, std::memory_order_release);
+
+            for (const base::U32 continuation : record.continuations)
+                if (records[continuation].unfinishedDependencyCount.fetch_sub(1u, std::memory_order_acq_rel) == 1u)
+                    enqueue(continuation);
+
+            record.continuations.clear();
+        }
+
+        releaseSlot(index);
+        pendingJobCount.fetch_sub(1u, std::memory_order_release);
+    }
+
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] JobHandle schedule(Job&& job, base::Span<const JobHandle> dependencies)
+    {
+        const base::U32 index  = allocateSlot();
+        JobRecord&      record = records[index];
+
+        record.job = SFML_BASE_MOVE(job);
+
+        // The extra count keeps the job from being enqueued by a dependency completing during the loop below
+        record.unfinishedDependencyCount.store(1u, std::memory_order_relaxed);
+        pendingJobCount.fetch_add(1u, std::memory_order_relaxed);
+
+        const JobHandle handle{index, record.generation.load(std::memory_order_relaxed)};
+
+        for (const JobHandle& dependency : dependencies)
+        {
+            SFML_BASE_ASSERT(dependency.index < maxPendingJobs);
+            JobRecord& dependencyRecord = records[dependency.index];
+
+            const std::lock_guard lock(dependencyRecord.mutex);
+
+            // A different generation means that the dependency already completed
+            if (dependencyRecord.generation.load(std::memory_order_relaxed) != dependency.generation)
+                continue;
+
+            record.unfinishedDependencyCount.fetch_add(1u, std::memory_order_relaxed);
+            dependencyRecord.continuations.pushBack(index);
+        }
+
+        if (record.unfinishedDependencyCount.fetch_sub(1u, std::memory_order_acq_rel) == 1u)
+            enqueue(index);
+
+        return handle;
+    }
+
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool isDone(JobHandle handle) const
+    {
+        SFML_BASE_ASSERT(handle.index < maxPendingJobs);
+        return records[handle.index].generation.load(std::memory_order_acquire) != handle.generation;
+    }
+
+    ////////////////////////////////////////////////////////////
+    template <typename Predicate>
+    void helpUntil(Predicate&& predicate)
+    {
+        while (!predicate())
+            if (!runOneJob())
+                std::this_thread::yield();
+    }
+
+    ////////////////////////////////////////////////////////////
+    void waitAll()
+    {
+        helpUntil([this] { return pendingJobCount.load(std::memory_order_acquire) == 0u; });
+    }
+
+    ////////////////////////////////////////////////////////////
+    void workerLoop(unsigned int workerIndex)
+    {
+        currentJobSystem   = this;
+        currentWorkerIndex = workerIndex;
+
+        while (true)
+        {
+            // Read the signal before looking for work, so that jobs enqueued in between wake the worker right away
+            const base::U32 signal = workSignal.load(std::memory_order_acquire);
+
+            if (runOneJob())
+                continue;
+
+            if (stopRequested.load(std::memory_order_acquire))
+                return;
+
+            sleepingWorkerCount.fetch_add(1u);
+            workSignal.wait(signal);
+            sleepingWorkerCount.fetch_sub(1u, std::memory_order_relaxed);
+        }
+    }
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    const unsigned int       workerCount;                 //!< Number of worker threads
+    std::vector<JobRecord>   records;                     //!< One record per job slot
+    std::vector<WorkQueue>   queues;                      //!< One queue per worker, plus a shared one
+    std::mutex               slotMutex;                   //!< Guards the free slot stack
+    base::U32                freeSlots[maxPendingJobs]{}; //!< Stack of unused job slots
+    base::SizeT              freeSlotCount{};             //!< Number of unused job slots
+    std::atomic<base::SizeT> pendingJobCount{0u};         //!< Jobs scheduled and not completed yet
+    std::atomic<base::U32>   workSignal{0u};              //!< Bumped whenever a job becomes ready
+    std::atomic<base::U32>   sleepingWorkerCount{0u};     //!< Workers waiting on `workSignal`
+    std::atomic<bool>        stopRequested{false};        //!< Set when the workers must exit
+    std::vector<std::thread> workers;                     //!< Worker threads
+};
+
+
+////////////////////////////////////////////////////////////
+unsigned int JobSystem::getDefaultWorkerCount()
+{
+    const unsigned int hardwareThreadCount = std::thread::hardware_concurrency();
+    return hardwareThreadCount > 1u ? hardwareThreadCount - 1u : 1u;
+}
+
+
+////////////////////////////////////////////////////////////
+JobSystem::JobSystem(unsigned int workerCount) : m_impl(base::makeUnique<Impl>(workerCount))
+{
+}
+
+
+////////////////////////////////////////////////////////////
+JobSystem::~JobSystem() = default;
+
+
+////////////////////////////////////////////////////////////
+unsigned int JobSystem::getWorkerCount() const
+{
+    return m_impl->workerCount;
+}
+
+
+////////////////////////////////////////////////////////////
+JobHandle JobSystem::schedule(Job&& job, base::Span<const JobHandle> dependencies)
+{
+    return m_impl->schedule(SFML_BASE_MOVE(job), dependencies);
+}
+
+
+////////////////////////////////////////////////////////////
+JobHandle JobSystem::schedule(Job&& job, JobHandle dependency)
+{
+    return m_impl->schedule(SFML_BASE_MOVE(job), base::Span<const JobHandle>(&dependency, 1u));
+}
+
+
+////////////////////////////////////////////////////////////
+bool JobSystem::isDone(JobHandle handle) const
+{
+    return m_impl->isDone(handle);
+}
+
+
+////////////////////////////////////////////////////////////
+void JobSystem::wait(JobHandle handle)
+{
+    m_impl->helpUntil([&] { return m_impl->isDone(handle); });
+}
+
+
+////////////////////////////////////////////////////////////
+void JobSystem::waitAll()
+{
+    m_impl->waitAll();
+}
+
+
+////////////////////////////////////////////////////////////
+void JobSystem::parallelForImpl(base::SizeT count,
+                                base::SizeT grainSize,
+                                void*       userData,
+                                void (*invoke)(void* userData, base::SizeT begin, base::SizeT end))
+{
+    if (count == 0u)
+        return;
+
+    grainSize = base::max(grainSize, base::SizeT{1u});
+
+    struct State
+    {
+        base::SizeT count;
+        base::SizeT grainSize;
+        base::SizeT chunkCount;
+        void*       userData;
+        void (*invoke)(void*, base::SizeT, base::SizeT);
+
+        std::atomic<base::SizeT> nextChunk{0u};
+        std::atomic<base::SizeT> finishedHelperCount{0u};
+
+        void run()
+        {
+            // Chunks are claimed dynamically, so that uneven chunks do not leave threads idle
+            for (base::SizeT chunk = nextChunk.fetch_add(1u, std::memory_order_relaxed); chunk < chunkCount;
+                 chunk             = nextChunk.fetch_add(1u, std::memory_order_relaxed))
+            {
+                const base::SizeT begin = chunk * grainSize;
+                invoke(userData, begin, base::min(begin + grainSize, count));
+            }
+        }
+    };
+
+    State state{count, grainSize, (count + grainSize - 1u) / grainSize, userData, invoke};
+
+    // The calling thread processes chunks too, so one helper less than there are chunks is enough
+    const base::SizeT helperCount = base::min(base::SizeT{m_impl->workerCount}, state.chunkCount - 1u);
+
+    auto helper = [&state]
+    {
+        state.run();
+        state.finishedHelperCount.fetch_add(1u, std::memory_order_release);
+    };
+
+    for (base::SizeT i = 0u; i < helperCount; ++i)
+        (void)schedule(helper);
+
+    state.run();
+
+    // `state` lives on this stack frame, wait until no helper touches it anymore
+    m_impl->helpUntil([&] { return state.finishedHelperCount.load(std::memory_order_acquire) == helperCount; });
+}
+
+} // namespace sf
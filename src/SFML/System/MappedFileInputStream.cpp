@@ -0,0 +1,121 @@
+#include <SFML/Copyright.hpp> // LICENSE AND COPYRIGHT (C) INFORMATION
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include "SFML/System/MappedFileInputStream.hpp"
+
+#include "SFML/System/FileMapping.hpp"
+#include "SFML/System/Path.hpp"
+
+#include "SFML/Base/Algorithm.hpp"
+#include "SFML/Base/Builtins/Memcpy.hpp"
+#include "SFML/Base/Optional.hpp"
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+MappedFileInputStream::~MappedFileInputStream()
+{
+    priv::unmapFile({m_data, m_size});
+}
+
+
+////////////////////////////////////////////////////////////
+MappedFileInputStream::MappedFileInputStream(MappedFileInputStream&& rhs) noexcept :
+m_data(base::exchange(rhs.m_data, nullptr)),
+m_size(base::exchange(rhs.m_size, base::SizeT{0u})),
+m_offset(base::exchange(rhs.m_offset, base::SizeT{0u}))
+{
+}
+
+
+////////////////////////////////////////////////////////////
+MappedFileInputStream& MappedFileInputStream::operator=(MappedFileInputStream&& rhs) noexcept
+{
+    if (&rhs == this)
+        return *this;
+
+    priv::unmapFile({m_data, m_size});
+
+    m_data   = base::exchange(rhs.m_data, nullptr);
+    m_size   = base::exchange(rhs.m_size, base::SizeT{0u});
+    m_offset = base::exchange(rhs.m_offset, base::SizeT{0u});
+
+    return *this;
+}
+
+
+////////////////////////////////////////////////////////////
+base::Optional<MappedFileInputStream> MappedFileInputStream::open(const Path& filename)
+{
+    const base::Optional<priv::FileMapping> mapping = priv::mapFile(filename);
+    if (!mapping.hasValue())
+        return base::nullOpt;
+
+    return base::makeOptional<MappedFileInputStream>(base::PassKey<MappedFileInputStream>{}, mapping->data, mapping->size);
+}
+
+
+////////////////////////////////////////////////////////////
+base::Optional<base::SizeT> MappedFileInputStream::read(void* data, base::SizeT size)
+{
+    const base::SizeT count = base::min(size, m_size - m_offset);
+
+    if (count > 0u)
+    {
+        SFML_BASE_MEMCPY(data, m_data + m_offset, count);
+        m_offset += count;
+    }
+
+    return base::makeOptional(count);
+}
+
+
+////////////////////////////////////////////////////////////
+base::Optional<base::SizeT> MappedFileInputStream::seek(base::SizeT position)
+{
+    m_offset = base::min(position, m_size);
+    return base::makeOptional(m_offset);
+}
+
+
+////////////////////////////////////////////////////////////
+base::Optional<base::SizeT> MappedFileInputStream::tell()
+{
+    return base::makeOptional(m_offset);
+}
+
+
+////////////////////////////////////////////////////////////
+base::Optional<base::SizeT> MappedFileInputStream::getSize()
+{
+    return base::makeOptional(m_size);
+}
+
+
+////////////////////////////////////////////////////////////
+const void* MappedFileInputStream::getData() const
+{
+    return m_data;
+}
+
+
+////////////////////////////////////////////////////////////
+base::SizeT MappedFileInputStream::getDataSize() const
+{
+    return m_size;
+}
+
+
+////////////////////////////////////////////////////////////
+MappedFileInputStream::MappedFileInputStream(base::PassKey<MappedFileInputStream>&&,
+                                             const unsigned char* data,
+                                             base::SizeT          size) :
+m_data(data),
+m_size(size)
+{
+}
+
+} // namespace sf
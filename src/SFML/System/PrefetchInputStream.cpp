@@ -0,0 +1,319 @@
+#include <SFML/Copyright.hpp> // LICENSE AND COPYRIGHT (C) INFORMATION
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include "SFML/System/PrefetchInputStream.hpp"
+
+#include "SFML/Base/Algorithm.hpp"
+#include "SFML/Base/Assert.hpp"
+#include "SFML/Base/Builtins/Memcpy.hpp"
+#include "SFML/Base/Macros.hpp"
+#include "SFML/Base/Optional.hpp"
+#include "SFML/Base/TrivialVector.hpp"
+
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+struct PrefetchInputStream::Impl
+{
+    ////////////////////////////////////////////////////////////
+    enum class [[nodiscard]] BlockState
+    {
+        Empty,   //!< Holds no data and no read is requested
+        Pending, //!< Being read (or about to be) by the I/O thread
+        Ready,   //!< Holds valid data, owned by the reading thread
+        Failed   //!< The source reported an error while reading
+    };
+
+    ////////////////////////////////////////////////////////////
+    struct Block
+    {
+        base::TrivialVector<unsigned char> data;                     //!< Storage, `blockSize` bytes
+        base::SizeT                        offset{};                 //!< Position of the first byte in the source
+        base::SizeT                        size{};                   //!< Number of valid bytes
+        BlockState                         state{BlockState::Empty}; //!< Guarded by `mutex`
+
+        [[nodiscard]] bool contains(base::SizeT position) const
+        {
+            return position >= offset && position - offset < size;
+        }
+    };
+
+    ////////////////////////////////////////////////////////////
+    explicit Impl(InputStream& theSource, base::UniquePtr<InputStream>&& theOwnedSource, base::SizeT theBlockSize) :
+    ownedSource(SFML_BASE_MOVE(theOwnedSource)),
+    source(theSource),
+    blockSize(base::max(theBlockSize, base::SizeT{1u})),
+    sourceSize(source.getSize())
+    {
+        for (Block& block : blocks)
+            block.data.resize(blockSize);
+
+        // The source is only ever accessed by the I/O thread from now on
+        requestFill(0u, 0u);
+        requestFill(1u, blockSize);
+
+        ioThread = std::thread([this] { ioThreadLoop(); });
+    }
+
+    ////////////////////////////////////////////////////////////
+    ~Impl()
+    {
+        {
+            const std::lock_guard lock(mutex);
+            stopRequested = true;
+        }
+
+        condition.notify_all();
+        ioThread.join();
+    }
+
+    ////////////////////////////////////////////////////////////
+    Impl(const Impl&)            = delete;
+    Impl& operator=(const Impl&) = delete;
+
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool isPastEnd(base::SizeT offset) const
+    {
+        return sourceSize.hasValue() && offset >= *sourceSize;
+    }
+
+    ////////////////////////////////////////////////////////////
+    /// Must be called with `mutex` held, or before the I/O thread starts
+    void requestFill(base::SizeT blockIndex, base::SizeT offset)
+    {
+        Block& block = blocks[blockIndex];
+
+        block.offset = offset;
+        block.size   = 0u;
+
+        if (isPastEnd(offset))
+        {
+            // Nothing to read, mark the block as an empty end-of-stream block
+            block.state = BlockState::Ready;
+            return;
+        }
+
+        block.state = BlockState::Pending;
+    }
+
+    ////////////////////////////////////////////////////////////
+    void ioThreadLoop()
+    {
+        std::unique_lock lock(mutex);
+
+        while (true)
+        {
+            condition.wait(lock,
+                           [this]
+                           {
+                               return stopRequested || blocks[0].state == BlockState::Pending ||
+                                      blocks[1].state == BlockState::Pending;
+                           });
+
+            if (stopRequested)
+                return;
+
+            // The block being read from takes priority over the read-ahead block
+            const base::SizeT blockIndex = blocks[current].state == BlockState::Pending ? current : 1u - current;
+            Block&            block      = blocks[blockIndex];
+            const base::SizeT offset     = block.offset;
+
+            // Pending blocks are only touched by this thread, so the read happens without holding the lock
+            lock.unlock();
+
+            base::SizeT size   = 0u;
+            bool        failed = false;
+
+            if (const base::Optional<base::SizeT> sought = source.seek(offset); !sought.hasValue() || *sought != offset)
+                failed = true;
+
+            // Sources may return less than requested before the end, e.g. across the callbacks of a decoder
+            while (!failed && size < blockSize)
+            {
+                const base::Optional<base::SizeT> count = source.read(block.data.data() + size, blockSize - size);
+
+                if (!count.hasValue())
+                    failed = true;
+                else if (*count == 0u)
+                    break;
+                else
+                    size += *count;
+            }
+
+            lock.lock();
+
+            // A seek may have re-targeted the block while it was being read, in which case it is read again
+            if (block.state != BlockState::Pending || block.offset != offset)
+                continue;
+
+            block.size  = size;
+            block.state = failed ? BlockState::Failed : BlockState::Ready;
+
+            condition.notify_all();
+        }
+    }
+
+    ////////////////////////////////////////////////////////////
+    /// Returns the block containing `position`, or one with no data at the end of the stream
+    [[nodiscard]] Block* acquireBlock(base::SizeT position)
+    {
+        std::unique_lock lock(mutex);
+
+        const auto isSettled = [this](base::SizeT blockIndex)
+        { return blocks[blockIndex].state != BlockState::Pending; };
+
+        while (true)
+        {
+            // Fast path, keep reading from the current block
+            condition.wait(lock, [&] { return isSettled(current); });
+
+            Block& currentBlock = blocks[current];
+
+            if (currentBlock.state == BlockState::Failed)
+                return nullptr;
+
+            // A short block marks the end of the stream, reading at its end yields no data
+            const bool atEnd = currentBlock.size < blockSize && position == currentBlock.offset + currentBlock.size;
+
+            if (currentBlock.contains(position) || atEnd)
+                return &currentBlock;
+
+            // The reader moved on, check whether the read-ahead block has it
+            const base::SizeT next      = 1u - current;
+            Block&            nextBlock = blocks[next];
+
+            const bool nextCovers = nextBlock.offset == currentBlock.offset + currentBlock.size &&
+                                    position >= nextBlock.offset && position - nextBlock.offset < blockSize;
+
+            if (nextCovers)
+            {
+                condition.wait(lock, [&] { return isSettled(next); });
+
+                // Swap the blocks and start reading ahead of the new current one
+                current = next;
+                requestFill(1u - current, nextBlock.offset + nextBlock.size);
+                condition.notify_all();
+                continue;
+            }
+
+            // Random access, fetch the block at the new position and read ahead from there
+            requestFill(current, position);
+            requestFill(next, position + blockSize);
+            condition.notify_all();
+        }
+    }
+
+    base::UniquePtr<InputStream> ownedSource; //!< Source stream, if owned
+    InputStream&                 source;      //!< Source stream, only accessed by the I/O thread after construction
+    const base::SizeT            blockSize;   //!< Size of each read-ahead block
+    base::Optional<base::SizeT>  sourceSize;  //!< Size of the source, queried once
+
+    Block       blocks[2];  //!< Double buffer, one block being read while the other is being filled
+    base::SizeT current{};  //!< Index of the block being read from, guarded by `mutex`
+    base::SizeT position{}; //!< Current reading position, only accessed by the reading thread
+
+    std::mutex              mutex;           //!< Guards the block states and the stop flag
+    std::condition_variable condition;       //!< Signals new requests and completed reads
+    bool                    stopRequested{}; //!< Asks the I/O thread to exit
+    std::thread             ioThread;        //!< Background thread reading from the source
+};
+
+
+////////////////////////////////////////////////////////////
+PrefetchInputStream::PrefetchInputStream(InputStream& source, base::SizeT blockSize) :
+m_impl(base::makeUnique<Impl>(source, nullptr, blockSize))
+{
+}
+
+
+////////////////////////////////////////////////////////////
+PrefetchInputStream::PrefetchInputStream(base::UniquePtr<InputStream>&& source, base::SizeT blockSize) :
+m_impl(base::makeUnique<Impl>(*source, SFML_BASE_MOVE(source), blockSize))
+{
+}
+
+
+////////////////////////////////////////////////////////////
+PrefetchInputStream::~PrefetchInputStream() = default;
+
+
+////////////////////////////////////////////////////////////
+PrefetchInputStream::PrefetchInputStream(PrefetchInputStream&&) noexcept = default;
+
+
+////////////////////////////////////////////////////////////
+PrefetchInputStream& PrefetchInputStream::operator=(PrefetchInputStream&&) noexcept = default;
+
+
+////////////////////////////////////////////////////////////
+base::Optional<base::SizeT> PrefetchInputStream::read(void* data, base::SizeT size)
+{
+    SFML_BASE_ASSERT(m_impl != nullptr && "Attempted to read from a moved-from PrefetchInputStream");
+
+    auto*       output = static_cast<unsigned char*>(data);
+    base::SizeT total  = 0u;
+
+    while (total < size && !m_impl->isPastEnd(m_impl->position))
+    {
+        Impl::Block* block = m_impl->acquireBlock(m_impl->position);
+
+        if (block == nullptr)
+        {
+            if (total == 0u)
+                return base::nullOpt;
+
+            break;
+        }
+
+        // Ready blocks are not touched by the I/O thread, so they can be copied from without the lock
+        const base::SizeT available = block->offset + block->size - m_impl->position;
+
+        if (available == 0u)
+            break; // End of stream
+
+        const base::SizeT count = base::min(available, size - total);
+        SFML_BASE_MEMCPY(output + total, block->data.data() + (m_impl->position - block->offset), count);
+
+        total += count;
+        m_impl->position += count;
+    }
+
+    return base::makeOptional(total);
+}
+
+
+////////////////////////////////////////////////////////////
+base::Optional<base::SizeT> PrefetchInputStream::seek(base::SizeT position)
+{
+    SFML_BASE_ASSERT(m_impl != nullptr && "Attempted to seek a moved-from PrefetchInputStream");
+
+    m_impl->position = m_impl->sourceSize.hasValue() ? base::min(position, *m_impl->sourceSize) : position;
+    return base::makeOptional(m_impl->position);
+}
+
+
+////////////////////////////////////////////////////////////
+base::Optional<base::SizeT> PrefetchInputStream::tell()
+{
+    SFML_BASE_ASSERT(m_impl != nullptr && "Attempted to query a moved-from PrefetchInputStream");
+
+    return base::makeOptional(m_impl->position);
+}
+
+
+////////////////////////////////////////////////////////////
+base::Optional<base::SizeT> PrefetchInputStream::getSize()
+{
+    SFML_BASE_ASSERT(m_impl != nullptr && "Attempted to query a moved-from PrefetchInputStream");
+
+    return m_impl->sourceSize;
+}
+
+} // namespace sf
@@ -6,12 +6,95 @@
 #include "SFML/System/Err.hpp"
 #include "SFML/System/RectPacker.hpp"
 
+#include "SFML/Base/Algorithm.hpp"
+#include "SFML/Base/Assert.hpp"
+#include "SFML/Base/IntTypes.hpp"
 #include "SFML/Base/Optional.hpp"
+#include "SFML/Base/SizeT.hpp"
+#include "SFML/Base/TrivialVector.hpp"
 #include "SFML/Base/UniquePtr.hpp"
 
-#define STBRP_STATIC
-#define STB_RECT_PACK_IMPLEMENTATION
-#include <stb_rect_pack.h>
+
+namespace
+{
+////////////////////////////////////////////////////////////
+/// Horizontal segment of the skyline: everything below `y`
+/// in `[x, x + width)` is either packed or wasted
+///
+////////////////////////////////////////////////////////////
+struct SkylineSegment
+{
+    unsigned int x;
+    unsigned int y;
+    unsigned int width;
+};
+
+
+////////////////////////////////////////////////////////////
+struct FreeRect
+{
+    sf::Vector2u position;
+    sf::Vector2u size;
+};
+
+
+////////////////////////////////////////////////////////////
+[[nodiscard]] sf::base::U64 getArea(sf::Vector2u size)
+{
+    return sf::base::U64{size.x} * sf::base::U64{size.y};
+}
+
+
+////////////////////////////////////////////////////////////
+/// Free rectangles are bucketed by the size class of each of
+/// their dimensions, `floor(log2(dimension))`, so that searches
+/// skip the buckets whose rectangles are all too small
+///
+////////////////////////////////////////////////////////////
+constexpr unsigned int sizeClassCount = 16u;
+
+
+////////////////////////////////////////////////////////////
+[[nodiscard]] unsigned int getSizeClass(unsigned int dimension)
+{
+    unsigned int sizeClass = 0u;
+
+    for (; dimension > 1u && sizeClass < sizeClassCount - 1u; dimension >>= 1u)
+        ++sizeClass;
+
+    return sizeClass;
+}
+
+
+////////////////////////////////////////////////////////////
+/// Merge `b` into `a` if they share a whole edge, i.e. if their union is a rectangle
+///
+////////////////////////////////////////////////////////////
+[[nodiscard]] bool tryMergeFreeRects(FreeRect& a, const FreeRect& b)
+{
+    if (a.position.x == b.position.x && a.size.x == b.size.x)
+    {
+        if (a.position.y + a.size.y == b.position.y || b.position.y + b.size.y == a.position.y)
+        {
+            a.position.y = sf::base::min(a.position.y, b.position.y);
+            a.size.y += b.size.y;
+            return true;
+        }
+    }
+    else if (a.position.y == b.position.y && a.size.y == b.size.y)
+    {
+        if (a.position.x + a.size.x == b.position.x || b.position.x + b.size.x == a.position.x)
+        {
+            a.position.x = sf::base::min(a.position.x, b.position.x);
+            a.size.x += b.size.x;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+} // namespace
 
 
 namespace sf
@@ -19,17 +102,334 @@ namespace sf
 ////////////////////////////////////////////////////////////
 struct RectPacker::Impl
 {
-    enum : int
+    Vector2u                            size;           //!< Size of the area to pack into
+    base::TrivialVector<SkylineSegment> skyline;        //!< Segments sorted by `x`, covering the whole width
+    base::TrivialVector<SkylineSegment> skylineScratch; //!< Storage reused when rebuilding the skyline
+    base::U64                           packedArea{};   //!< Sum of the areas of the packed rectangles
+
+    //! Free space below the skyline, removed or wasted, by size class of the height then of the width
+    base::TrivialVector<FreeRect> freeRects[sizeClassCount][sizeClassCount];
+
+    explicit Impl(Vector2u theSize) : size(theSize)
     {
-        MaxNodes = 2048
-    };
+        skyline.emplaceBack(SkylineSegment{0u, 0u, size.x});
+    }
+
+    ////////////////////////////////////////////////////////////
+    /// Height at which a rectangle of width `width` rests when
+    /// its left edge is on segment `index`, or `base::nullOpt`
+    /// if it would stick out of the right border
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] base::Optional<unsigned int> getSkylineFitHeight(base::SizeT index, unsigned int width) const
+    {
+        const unsigned int left = skyline[index].x;
+
+        if (width > size.x - left)
+            return base::nullOpt;
+
+        unsigned int y = 0u;
+
+        for (base::SizeT i = index; i < skyline.size() && skyline[i].x < left + width; ++i)
+            y = base::max(y, skyline[i].y);
+
+        return base::makeOptional(y);
+    }
+
+    ////////////////////////////////////////////////////////////
+    /// Replace the skyline over `[x, x + width)` by a single segment at height `y`
+    ///
+    ////////////////////////////////////////////////////////////
+    void setSkylineRange(unsigned int x, unsigned int width, unsigned int y)
+    {
+        const unsigned int right = x + width;
+
+        skylineScratch.clear();
+        skylineScratch.reserve(skyline.size() + 2u);
+
+        const auto append = [&](SkylineSegment segment)
+        {
+            // Merge with the previous segment when they are at the same height
+            if (!skylineScratch.empty())
+            {
+                SkylineSegment& last = skylineScratch[skylineScratch.size() - 1u];
+
+                if (last.y == segment.y)
+                {
+                    last.width += segment.width;
+                    return;
+                }
+            }
+
+            skylineScratch.unsafeEmplaceBack(segment);
+        };
+
+        bool inserted = false;
+
+        for (const SkylineSegment& segment : skyline)
+        {
+            const unsigned int segmentRight = segment.x + segment.width;
+
+            // Part of the segment left of the range
+            if (segment.x < x)
+                append({segment.x, segment.y, base::min(segmentRight, x) - segment.x});
+
+            if (!inserted && segmentRight > x)
+            {
+                append({x, y, width});
+                inserted = true;
+            }
+
+            // Part of the segment right of the range
+            if (segmentRight > right)
+            {
+                const unsigned int left = base::max(segment.x, right);
+                append({left, segment.y, segmentRight - left});
+            }
+        }
+
+        SFML_BASE_ASSERT(inserted);
+
+        skyline.clear();
+        skyline.emplaceRange(skylineScratch.data(), skylineScratch.size());
+    }
+
+    ////////////////////////////////////////////////////////////
+    /// Give `rect` back to the skyline if nothing was packed on top of it
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool tryLowerSkyline(const FreeRect& rect)
+    {
+        const unsigned int top   = rect.position.y + rect.size.y;
+        const unsigned int right = rect.position.x + rect.size.x;
+
+        for (const SkylineSegment& segment : skyline)
+        {
+            if (segment.x + segment.width <= rect.position.x || segment.x >= right)
+                continue;
+
+            if (segment.y != top)
+                return false;
+        }
+
+        setSkylineRange(rect.position.x, rect.size.x, rect.position.y);
+        return true;
+    }
+
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] base::TrivialVector<FreeRect>& getBucket(Vector2u rectSize)
+    {
+        return freeRects[getSizeClass(rectSize.y)][getSizeClass(rectSize.x)];
+    }
+
+    ////////////////////////////////////////////////////////////
+    void insertFreeRect(const FreeRect& rect)
+    {
+        getBucket(rect.size).emplaceBack(rect);
+    }
+
+    ////////////////////////////////////////////////////////////
+    static void eraseFreeRect(base::TrivialVector<FreeRect>& bucket, base::SizeT index)
+    {
+        bucket[index] = bucket[bucket.size() - 1u];
+        bucket.unsafeSetSize(bucket.size() - 1u);
+    }
+
+    ////////////////////////////////////////////////////////////
+    /// Remove a free rectangle that shares a whole edge with `rect` and merge it into `rect`
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool tryMergeNeighbor(FreeRect& rect)
+    {
+        // Neighbors sharing a horizontal edge have the same width, those sharing a vertical edge the same height
+        const unsigned int heightClass = getSizeClass(rect.size.y);
+        const unsigned int widthClass  = getSizeClass(rect.size.x);
+
+        for (unsigned int i = 0u; i < sizeClassCount * 2u; ++i)
+        {
+            base::TrivialVector<FreeRect>& bucket = i < sizeClassCount
+                                                        ? freeRects[i][widthClass]
+                                                        : freeRects[heightClass][i - sizeClassCount];
 
-    stbrp_node    nodes[MaxNodes]{};
-    stbrp_context context{};
+            for (base::SizeT j = 0u; j < bucket.size(); ++j)
+            {
+                if (!tryMergeFreeRects(rect, bucket[j]))
+                    continue;
 
-    explicit Impl(Vector2u size)
+                eraseFreeRect(bucket, j);
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    ////////////////////////////////////////////////////////////
+    /// Add `rect` to the free space, coalescing it with its neighbors
+    ///
+    ////////////////////////////////////////////////////////////
+    void addFreeRect(FreeRect rect)
     {
-        stbrp_init_target(&context, static_cast<int>(size.x), static_cast<int>(size.y), nodes, MaxNodes);
+        // Grow the rectangle until none of the free rectangles can be merged into it
+        while (tryMergeNeighbor(rect))
+            ;
+
+        if (!tryLowerSkyline(rect))
+        {
+            insertFreeRect(rect);
+            return;
+        }
+
+        // Lowering the skyline may uncover the tops of other free rectangles
+        for (bool lowered = true; lowered;)
+        {
+            lowered = false;
+
+            for (auto& row : freeRects)
+                for (base::TrivialVector<FreeRect>& bucket : row)
+                    for (base::SizeT i = 0u; i < bucket.size();)
+                    {
+                        if (tryLowerSkyline(bucket[i]))
+                        {
+                            eraseFreeRect(bucket, i);
+                            lowered = true;
+                        }
+                        else
+                        {
+                            ++i;
+                        }
+                    }
+        }
+    }
+
+    ////////////////////////////////////////////////////////////
+    /// Pack into a free rectangle of about the smallest size that fits, splitting the rest of it
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] base::Optional<Vector2u> packIntoFreeRects(Vector2u rectSize)
+    {
+        const unsigned int minHeightClass = getSizeClass(rectSize.y);
+        const unsigned int minWidthClass  = getSizeClass(rectSize.x);
+
+        base::TrivialVector<FreeRect>* bestBucket = nullptr;
+        base::SizeT                    bestIndex  = 0u;
+        base::U64                      bestArea   = 0u;
+
+        // Visit the buckets by increasing sum of size classes, i.e. roughly by increasing area, and stop at the
+        // first sum that has a rectangle large enough
+        for (unsigned int classSum = minHeightClass + minWidthClass;
+             classSum <= (sizeClassCount - 1u) * 2u && bestBucket == nullptr;
+             ++classSum)
+        {
+            // Only the buckets on this sum whose classes are both in range
+            const unsigned int maxClass         = sizeClassCount - 1u;
+            const unsigned int firstHeightClass = base::max(minHeightClass, classSum - base::min(classSum, maxClass));
+            const unsigned int lastHeightClass  = base::min(maxClass, classSum - minWidthClass);
+
+            for (unsigned int heightClass = firstHeightClass; heightClass <= lastHeightClass; ++heightClass)
+            {
+                base::TrivialVector<FreeRect>& bucket = freeRects[heightClass][classSum - heightClass];
+
+                for (base::SizeT i = 0u; i < bucket.size(); ++i)
+                {
+                    const FreeRect& freeRect = bucket[i];
+
+                    if (freeRect.size.x < rectSize.x || freeRect.size.y < rectSize.y)
+                        continue;
+
+                    const base::U64 area = getArea(freeRect.size);
+
+                    if (bestBucket == nullptr || area < bestArea)
+                    {
+                        bestBucket = &bucket;
+                        bestIndex  = i;
+                        bestArea   = area;
+                    }
+                }
+            }
+        }
+
+        if (bestBucket == nullptr)
+            return base::nullOpt;
+
+        const FreeRect chosen = (*bestBucket)[bestIndex];
+        eraseFreeRect(*bestBucket, bestIndex);
+
+        // Split the leftover space along its shorter side, which keeps the larger piece as big as possible
+        const Vector2u leftover = chosen.size - rectSize;
+        const bool     splitX   = leftover.x < leftover.y;
+
+        const FreeRect right{{chosen.position.x + rectSize.x, chosen.position.y},
+                             {leftover.x, splitX ? rectSize.y : chosen.size.y}};
+
+        const FreeRect below{{chosen.position.x, chosen.position.y + rectSize.y},
+                             {splitX ? chosen.size.x : rectSize.x, leftover.y}};
+
+        if (right.size.x > 0u && right.size.y > 0u)
+            insertFreeRect(right);
+
+        if (below.size.x > 0u && below.size.y > 0u)
+            insertFreeRect(below);
+
+        return base::makeOptional(chosen.position);
+    }
+
+    ////////////////////////////////////////////////////////////
+    /// Pack at the lowest position of the skyline, the leftmost one in case of a tie
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] base::Optional<Vector2u> packOntoSkyline(Vector2u rectSize)
+    {
+        base::SizeT  bestIndex = skyline.size();
+        unsigned int bestY     = 0u;
+
+        for (base::SizeT i = 0u; i < skyline.size(); ++i)
+        {
+            const base::Optional<unsigned int> y = getSkylineFitHeight(i, rectSize.x);
+
+            if (!y.hasValue() || rectSize.y > size.y - *y)
+                continue;
+
+            if (bestIndex == skyline.size() || *y < bestY)
+            {
+                bestIndex = i;
+                bestY     = *y;
+            }
+        }
+
+        if (bestIndex == skyline.size())
+            return base::nullOpt;
+
+        const unsigned int x = skyline[bestIndex].x;
+
+        // The space between the skyline and the bottom of the rectangle is wasted, unless it is a free rectangle
+        const unsigned int right = x + rectSize.x;
+
+        for (base::SizeT i = bestIndex; i < skyline.size() && skyline[i].x < right; ++i)
+        {
+            const SkylineSegment& segment = skyline[i];
+
+            if (segment.y < bestY)
+                insertFreeRect({{segment.x, segment.y},
+                                {base::min(segment.x + segment.width, right) - segment.x, bestY - segment.y}});
+        }
+
+        setSkylineRange(x, rectSize.x, bestY + rectSize.y);
+        return base::makeOptional(Vector2u{x, bestY});
+    }
+
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] base::Optional<Vector2u> tryPack(Vector2u rectSize)
+    {
+        base::Optional<Vector2u> result = packIntoFreeRects(rectSize);
+
+        if (!result.hasValue())
+            result = packOntoSkyline(rectSize);
+
+        if (result.hasValue())
+            packedArea += getArea(rectSize);
+
+        return result;
     }
 };
 
@@ -64,29 +464,87 @@ base::Optional<Vector2u> RectPacker::pack(Vector2u rectSize)
     if (rectSize.x == 0u || rectSize.y == 0u)
         return fail("zero-sized coordinate");
 
-    stbrp_rect toPack{/* id */ 0,
-                      /* input width */ static_cast<int>(rectSize.x),
-                      /* input height */ static_cast<int>(rectSize.y),
-                      /* output x*/ {},
-                      /* output y */ {},
-                      /* was_packed */ {}};
+    const base::Optional<Vector2u> result = m_impl->tryPack(rectSize);
 
-    const int rc = stbrp_pack_rects(&m_impl->context, &toPack, /* num_rects */ 1);
-
-    if (rc == /* failure */ 0)
+    if (!result.hasValue())
         return fail("no room to pack");
 
-    SFML_BASE_ASSERT(rc == /* success */ 1);
-    SFML_BASE_ASSERT(toPack.was_packed != 0);
+    return result;
+}
+
+
+////////////////////////////////////////////////////////////
+base::SizeT RectPacker::packMany(base::Span<const Vector2u> rectSizes, base::Span<base::Optional<Vector2u>> positions)
+{
+    SFML_BASE_ASSERT(rectSizes.size() == positions.size());
+
+    base::TrivialVector<base::SizeT> order(rectSizes.size());
+
+    for (base::SizeT i = 0u; i < order.size(); ++i)
+        order[i] = i;
+
+    // Tallest first, then widest first, then in input order so that the result does not depend on the sort
+    base::sort(order.begin(),
+               order.end(),
+               [&](base::SizeT lhs, base::SizeT rhs)
+               {
+                   const Vector2u a = rectSizes[lhs];
+                   const Vector2u b = rectSizes[rhs];
+
+                   if (a.y != b.y)
+                       return a.y > b.y;
+
+                   if (a.x != b.x)
+                       return a.x > b.x;
 
-    return base::makeOptional<Vector2u>(static_cast<unsigned int>(toPack.x), static_cast<unsigned int>(toPack.y));
+                   return lhs < rhs;
+               });
+
+    base::SizeT packedCount = 0u;
+
+    for (const base::SizeT index : order)
+    {
+        const Vector2u rectSize = rectSizes[index];
+
+        if (rectSize.x == 0u || rectSize.y == 0u)
+        {
+            positions[index].reset();
+            continue;
+        }
+
+        positions[index] = m_impl->tryPack(rectSize);
+
+        if (positions[index].hasValue())
+            ++packedCount;
+    }
+
+    return packedCount;
+}
+
+
+////////////////////////////////////////////////////////////
+void RectPacker::remove(Vector2u position, Vector2u rectSize)
+{
+    SFML_BASE_ASSERT(rectSize.x > 0u && rectSize.y > 0u);
+    SFML_BASE_ASSERT(position.x + rectSize.x <= m_impl->size.x && position.y + rectSize.y <= m_impl->size.y);
+    SFML_BASE_ASSERT(getArea(rectSize) <= m_impl->packedArea);
+
+    m_impl->packedArea -= getArea(rectSize);
+    m_impl->addFreeRect({position, rectSize});
 }
 
 
 ////////////////////////////////////////////////////////////
 Vector2u RectPacker::getSize() const
 {
-    return {static_cast<unsigned int>(m_impl->context.width), static_cast<unsigned int>(m_impl->context.height)};
+    return m_impl->size;
+}
+
+
+////////////////////////////////////////////////////////////
+float RectPacker::getOccupancy() const
+{
+    return static_cast<float>(static_cast<double>(m_impl->packedArea) / static_cast<double>(getArea(m_impl->size)));
 }
 
 } // namespace sf
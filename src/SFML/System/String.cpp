@@ -8,20 +8,293 @@
 
 #include "SFML/Base/Algorithm.hpp"
 #include "SFML/Base/Assert.hpp"
+#include "SFML/Base/Builtins/Memcpy.hpp"
+#include "SFML/Base/Builtins/Memmove.hpp"
 #include "SFML/Base/Builtins/Strlen.hpp"
 
 #include <locale>
+#include <stdexcept>
 #include <string>
+#include <string_view>
 
 #include <cwchar>
 
+#ifndef __EXCEPTIONS
+#include <cstdlib>
+#endif
+
+
+namespace
+{
+////////////////////////////////////////////////////////////
+/// Positions past the end are reported the same way `std::u32string` did
+///
+////////////////////////////////////////////////////////////
+void checkPosition(sf::base::SizeT position, sf::base::SizeT size)
+{
+    if (position <= size)
+        return;
+
+#ifdef __EXCEPTIONS
+    throw std::out_of_range("sf::String position is out of range");
+#else
+    std::abort();
+#endif
+}
+
+} // namespace
+
 
 namespace sf
 {
 ////////////////////////////////////////////////////////////
 struct String::Impl
 {
-    std::u32string string; //!< Internal string of UTF-32 characters
+    ////////////////////////////////////////////////////////////
+    /// Number of characters that can be stored without allocating,
+    /// excluding the null terminator (enough for short labels)
+    ///
+    ////////////////////////////////////////////////////////////
+    static constexpr base::SizeT inlineCapacity = 11u;
+
+    base::SizeT size{0u};                //!< Number of characters, excluding the null terminator
+    base::SizeT capacity{inlineCapacity}; //!< Number of characters that fit in the current buffer
+    union
+    {
+        char32_t  inlineBuffer[inlineCapacity + 1u]{}; //!< Storage used while the string fits in place
+        char32_t* heapBuffer;                          //!< Storage used once the string has grown past `inlineCapacity`
+    };
+
+
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Impl() = default;
+
+
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] explicit Impl(const char32_t* characters, base::SizeT count)
+    {
+        replace(0u, 0u, characters, count);
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    ~Impl()
+    {
+        if (!isInline())
+            delete[] heapBuffer;
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Impl(const Impl& rhs) : Impl(rhs.data(), rhs.size)
+    {
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    Impl& operator=(const Impl& rhs)
+    {
+        if (this != &rhs)
+            replace(0u, size, rhs.data(), rhs.size);
+
+        return *this;
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Impl(Impl&& rhs) noexcept
+    {
+        steal(rhs);
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    Impl& operator=(Impl&& rhs) noexcept
+    {
+        if (this != &rhs)
+        {
+            if (!isInline())
+                delete[] heapBuffer;
+
+            steal(rhs);
+        }
+
+        return *this;
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    [[nodiscard, gnu::always_inline]] bool isInline() const
+    {
+        return capacity == inlineCapacity;
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    [[nodiscard, gnu::always_inline]] char32_t* data()
+    {
+        return isInline() ? inlineBuffer : heapBuffer;
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    [[nodiscard, gnu::always_inline]] const char32_t* data() const
+    {
+        return isInline() ? inlineBuffer : heapBuffer;
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] std::u32string_view view() const
+    {
+        return {data(), size};
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    /// Take over the contents of `rhs`, leaving it empty
+    ///
+    ////////////////////////////////////////////////////////////
+    void steal(Impl& rhs) noexcept
+    {
+        size     = rhs.size;
+        capacity = rhs.capacity;
+
+        if (rhs.isInline())
+        {
+            SFML_BASE_MEMCPY(inlineBuffer, rhs.inlineBuffer, sizeof(char32_t) * (size + 1u));
+        }
+        else
+        {
+            heapBuffer          = rhs.heapBuffer;
+            rhs.capacity        = inlineCapacity;
+            rhs.inlineBuffer[0] = U'\0';
+        }
+
+        rhs.size = 0u;
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    /// Resize to `newSize` characters, keeping the existing ones;
+    /// characters past the previous size are left uninitialized
+    ///
+    ////////////////////////////////////////////////////////////
+    char32_t* resizeForOverwrite(base::SizeT newSize)
+    {
+        if (newSize > capacity)
+        {
+            const base::SizeT newCapacity = base::max(newSize, capacity * 2u);
+            auto* const       newBuffer   = new char32_t[newCapacity + 1u];
+
+            SFML_BASE_MEMCPY(newBuffer, data(), sizeof(char32_t) * size);
+
+            if (!isInline())
+                delete[] heapBuffer;
+
+            heapBuffer = newBuffer;
+            capacity   = newCapacity;
+        }
+
+        size         = newSize;
+        data()[size] = U'\0';
+
+        return data();
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    /// Replace `count` characters starting at `position` with the
+    /// `replaceCount` characters of `characters`, which must not
+    /// point into this string unless `position` is the end of it
+    ///
+    ////////////////////////////////////////////////////////////
+    void replace(base::SizeT position, base::SizeT count, const char32_t* characters, base::SizeT replaceCount)
+    {
+        checkPosition(position, size);
+
+        count = base::min(count, size - position);
+
+        const base::SizeT tailCount = size - position - count;
+        const base::SizeT newSize   = size - count + replaceCount;
+
+        if (newSize > capacity)
+        {
+            // Build the result in a new buffer, `characters` may be the string being appended to
+            const base::SizeT newCapacity = base::max(newSize, capacity * 2u);
+            auto* const       newBuffer   = new char32_t[newCapacity + 1u];
+
+            SFML_BASE_MEMCPY(newBuffer, data(), sizeof(char32_t) * position);
+            SFML_BASE_MEMCPY(newBuffer + position, characters, sizeof(char32_t) * replaceCount);
+            SFML_BASE_MEMCPY(newBuffer + position + replaceCount,
+                             data() + position + count,
+                             sizeof(char32_t) * tailCount);
+
+            if (!isInline())
+                delete[] heapBuffer;
+
+            heapBuffer = newBuffer;
+            capacity   = newCapacity;
+        }
+        else
+        {
+            char32_t* const buffer = data();
+
+            SFML_BASE_MEMMOVE(buffer + position + replaceCount, buffer + position + count, sizeof(char32_t) * tailCount);
+            SFML_BASE_MEMCPY(buffer + position, characters, sizeof(char32_t) * replaceCount);
+        }
+
+        size         = newSize;
+        data()[size] = U'\0';
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    /// Convert `length` ANSI characters, widening ASCII directly and
+    /// only falling back to the global locale for the rest
+    ///
+    ////////////////////////////////////////////////////////////
+    void assignAnsi(const char* ansiString, base::SizeT length)
+    {
+        char32_t* const buffer = resizeForOverwrite(length);
+
+        const base::SizeT asciiLength = priv::widenUtf8AsciiPrefix(ansiString, length, buffer);
+        if (asciiLength == length)
+            return;
+
+        const char32_t* const end = Utf32::fromAnsi(ansiString + asciiLength,
+                                                    ansiString + length,
+                                                    buffer + asciiLength,
+                                                    std::locale{});
+
+        resizeForOverwrite(static_cast<base::SizeT>(end - buffer));
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    /// Convert `length` ANSI characters according to `locale`
+    ///
+    ////////////////////////////////////////////////////////////
+    void assignAnsi(const char* ansiString, base::SizeT length, const priv::LocaleLike auto& locale)
+    {
+        char32_t* const       buffer = resizeForOverwrite(length);
+        const char32_t* const end    = Utf32::fromAnsi(ansiString, ansiString + length, buffer, locale);
+
+        resizeForOverwrite(static_cast<base::SizeT>(end - buffer));
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    /// Convert `length` wide characters, each of which maps to one UTF-32 character
+    ///
+    ////////////////////////////////////////////////////////////
+    void assignWide(const wchar_t* wideString, base::SizeT length)
+    {
+        char32_t* const       buffer = resizeForOverwrite(length);
+        const char32_t* const end    = Utf32::fromWide(wideString, wideString + length, buffer);
+
+        resizeForOverwrite(static_cast<base::SizeT>(end - buffer));
+    }
 };
 
 
@@ -50,35 +323,37 @@ String& String::operator=(String&&) noexcept = default;
 
 
 ////////////////////////////////////////////////////////////
-String::String(char ansiChar) : String(ansiChar, std::locale{})
+String::String(char ansiChar)
 {
+    m_impl->assignAnsi(&ansiChar, 1u);
 }
 
 
 ////////////////////////////////////////////////////////////
 String::String(char ansiChar, const priv::LocaleLike auto& locale)
 {
-    m_impl->string += Utf32::decodeAnsi(ansiChar, locale);
+    m_impl->assignAnsi(&ansiChar, 1u, locale);
 }
 
 
 ////////////////////////////////////////////////////////////
 String::String(wchar_t wideChar)
 {
-    m_impl->string += Utf32::decodeWide(wideChar);
+    m_impl->assignWide(&wideChar, 1u);
 }
 
 
 ////////////////////////////////////////////////////////////
-String::String(char32_t utf32Char)
+String::String(char32_t utf32Char) : m_impl(&utf32Char, base::SizeT{1u})
 {
-    m_impl->string += utf32Char;
 }
 
 
 ////////////////////////////////////////////////////////////
-String::String(const char* ansiString) : String(ansiString, std::locale{})
+String::String(const char* ansiString)
 {
+    if (ansiString)
+        m_impl->assignAnsi(ansiString, SFML_BASE_STRLEN(ansiString));
 }
 
 
@@ -86,28 +361,21 @@ String::String(const char* ansiString) : String(ansiString, std::locale{})
 String::String(const char* ansiString, const priv::LocaleLike auto& locale)
 {
     if (ansiString)
-    {
-        const base::SizeT length = SFML_BASE_STRLEN(ansiString);
-        if (length > 0)
-        {
-            m_impl->string.reserve(length + 1);
-            Utf32::fromAnsi(ansiString, ansiString + length, base::BackInserter(m_impl->string), locale);
-        }
-    }
+        m_impl->assignAnsi(ansiString, SFML_BASE_STRLEN(ansiString), locale);
 }
 
 
 ////////////////////////////////////////////////////////////
-String::String(const priv::AnsiStringLike auto& ansiString) : String(ansiString, std::locale{})
+String::String(const priv::AnsiStringLike auto& ansiString)
 {
+    m_impl->assignAnsi(ansiString.data(), ansiString.length());
 }
 
 
 ////////////////////////////////////////////////////////////
 String::String(const priv::AnsiStringLike auto& ansiString, const priv::LocaleLike auto& locale)
 {
-    m_impl->string.reserve(ansiString.length() + 1);
-    Utf32::fromAnsi(ansiString.begin(), ansiString.end(), base::BackInserter(m_impl->string), locale);
+    m_impl->assignAnsi(ansiString.data(), ansiString.length(), locale);
 }
 
 
@@ -115,22 +383,14 @@ String::String(const priv::AnsiStringLike auto& ansiString, const priv::LocaleLi
 String::String(const wchar_t* wideString)
 {
     if (wideString)
-    {
-        const base::SizeT length = std::wcslen(wideString);
-        if (length > 0)
-        {
-            m_impl->string.reserve(length + 1);
-            Utf32::fromWide(wideString, wideString + length, base::BackInserter(m_impl->string));
-        }
-    }
+        m_impl->assignWide(wideString, std::wcslen(wideString));
 }
 
 
 ////////////////////////////////////////////////////////////
 String::String(const priv::WStringLike auto& wideString)
 {
-    m_impl->string.reserve(wideString.length() + 1);
-    Utf32::fromWide(wideString.begin(), wideString.end(), base::BackInserter(m_impl->string));
+    m_impl->assignWide(wideString.data(), wideString.length());
 }
 
 
@@ -138,12 +398,12 @@ String::String(const priv::WStringLike auto& wideString)
 String::String(const char32_t* utf32String)
 {
     if (utf32String)
-        m_impl->string = utf32String;
+        m_impl->replace(0u, 0u, utf32String, std::char_traits<char32_t>::length(utf32String));
 }
 
 
 ////////////////////////////////////////////////////////////
-String::String(const priv::U32StringLike auto& utf32String) : m_impl(utf32String)
+String::String(const priv::U32StringLike auto& utf32String) : m_impl(utf32String.data(), utf32String.size())
 {
 }
 
@@ -152,7 +412,21 @@ String::String(const priv::U32StringLike auto& utf32String) : m_impl(utf32String
 template <priv::AnsiStringLike TString>
 TString String::toAnsiString() const
 {
-    return toAnsiString<std::string>(std::locale{});
+    // Narrow ASCII strings directly, only involve the global locale for other characters
+    const base::SizeT size = m_impl->size;
+    const char32_t*   data = m_impl->data();
+
+    std::string output(size, '\0');
+
+    for (base::SizeT i = 0u; i < size; ++i)
+    {
+        if (data[i] >= 0x80u)
+            return toAnsiString<TString>(std::locale{});
+
+        output[i] = static_cast<char>(data[i]);
+    }
+
+    return output;
 }
 
 
@@ -162,10 +436,10 @@ TString String::toAnsiString(const priv::LocaleLike auto& locale) const
 {
     // Prepare the output string
     std::string output;
-    output.reserve(m_impl->string.length() + 1);
+    output.reserve(m_impl->size + 1);
 
     // Convert
-    Utf32::toAnsi(m_impl->string.begin(), m_impl->string.end(), base::BackInserter(output), 0, locale);
+    Utf32::toAnsi(begin(), end(), base::BackInserter(output), 0, locale);
 
     return output;
 }
@@ -177,10 +451,10 @@ TString String::toWideString() const
 {
     // Prepare the output string
     std::wstring output;
-    output.reserve(m_impl->string.length() + 1);
+    output.reserve(m_impl->size + 1);
 
     // Convert
-    Utf32::toWide(m_impl->string.begin(), m_impl->string.end(), base::BackInserter(output), 0);
+    Utf32::toWide(begin(), end(), base::BackInserter(output), 0);
 
     return output;
 }
@@ -192,10 +466,10 @@ TString String::toUtf8() const
 {
     // Prepare the output string
     std::u8string output;
-    output.reserve(m_impl->string.length());
+    output.reserve(m_impl->size);
 
     // Convert
-    Utf32::toUtf8(m_impl->string.begin(), m_impl->string.end(), base::BackInserter(output));
+    Utf32::toUtf8(begin(), end(), base::BackInserter(output));
 
     return output;
 }
@@ -207,10 +481,10 @@ TString String::toUtf16() const
 {
     // Prepare the output string
     std::u16string output;
-    output.reserve(m_impl->string.length());
+    output.reserve(m_impl->size);
 
     // Convert
-    Utf32::toUtf16(m_impl->string.begin(), m_impl->string.end(), base::BackInserter(output));
+    Utf32::toUtf16(begin(), end(), base::BackInserter(output));
 
     return output;
 }
@@ -220,14 +494,14 @@ TString String::toUtf16() const
 template <priv::U32StringLike TString>
 TString String::toUtf32() const
 {
-    return m_impl->string;
+    return TString(m_impl->data(), m_impl->size);
 }
 
 
 ////////////////////////////////////////////////////////////
 String& String::operator+=(const String& rhs)
 {
-    m_impl->string += rhs.m_impl->string;
+    m_impl->replace(m_impl->size, 0u, rhs.m_impl->data(), rhs.m_impl->size);
     return *this;
 }
 
@@ -235,65 +509,72 @@ String& String::operator+=(const String& rhs)
 ////////////////////////////////////////////////////////////
 char32_t String::operator[](base::SizeT index) const
 {
-    SFML_BASE_ASSERT(index < m_impl->string.size() && "Index is out of bounds");
-    return m_impl->string[index];
+    SFML_BASE_ASSERT(index < m_impl->size && "Index is out of bounds");
+    return m_impl->data()[index];
 }
 
 
 ////////////////////////////////////////////////////////////
 char32_t& String::operator[](base::SizeT index)
 {
-    SFML_BASE_ASSERT(index < m_impl->string.size() && "Index is out of bounds");
-    return m_impl->string[index];
+    SFML_BASE_ASSERT(index < m_impl->size && "Index is out of bounds");
+    return m_impl->data()[index];
 }
 
 
 ////////////////////////////////////////////////////////////
 void String::clear()
 {
-    m_impl->string.clear();
+    m_impl->resizeForOverwrite(0u);
 }
 
 
 ////////////////////////////////////////////////////////////
 base::SizeT String::getSize() const
 {
-    return m_impl->string.size();
+    return m_impl->size;
 }
 
 
 ////////////////////////////////////////////////////////////
 bool String::isEmpty() const
 {
-    return m_impl->string.empty();
+    return m_impl->size == 0u;
 }
 
 
 ////////////////////////////////////////////////////////////
 void String::erase(base::SizeT position, base::SizeT count)
 {
-    m_impl->string.erase(position, count);
+    m_impl->replace(position, count, U"", 0u);
 }
 
 
 ////////////////////////////////////////////////////////////
 void String::insert(base::SizeT position, const String& str)
 {
-    m_impl->string.insert(position, str.m_impl->string);
+    replace(position, 0u, str);
 }
 
 
 ////////////////////////////////////////////////////////////
 base::SizeT String::find(const String& str, base::SizeT start) const
 {
-    return m_impl->string.find(str.m_impl->string, start);
+    return m_impl->view().find(str.m_impl->view(), start);
 }
 
 
 ////////////////////////////////////////////////////////////
 void String::replace(base::SizeT position, base::SizeT length, const String& replaceWith)
 {
-    m_impl->string.replace(position, length, replaceWith.m_impl->string);
+    // The characters being inserted must not move while the string is modified
+    if (&replaceWith == this)
+    {
+        replace(position, length, String{replaceWith});
+        return;
+    }
+
+    m_impl->replace(position, length, replaceWith.m_impl->data(), replaceWith.m_impl->size);
 }
 
 
@@ -316,56 +597,60 @@ void String::replace(const String& searchFor, const String& replaceWith)
 ////////////////////////////////////////////////////////////
 String String::substring(base::SizeT position, base::SizeT length) const
 {
-    return m_impl->string.substr(position, length);
+    checkPosition(position, m_impl->size);
+
+    String result;
+    result.m_impl->replace(0u, 0u, m_impl->data() + position, base::min(length, m_impl->size - position));
+    return result;
 }
 
 
 ////////////////////////////////////////////////////////////
 const char32_t* String::getData() const
 {
-    return m_impl->string.c_str();
+    return m_impl->data();
 }
 
 
 ////////////////////////////////////////////////////////////
 String::Iterator String::begin()
 {
-    return m_impl->string.empty() ? nullptr : &(m_impl->string.front());
+    return m_impl->data();
 }
 
 
 ////////////////////////////////////////////////////////////
 String::ConstIterator String::begin() const
 {
-    return m_impl->string.empty() ? nullptr : &(m_impl->string.front());
+    return m_impl->data();
 }
 
 
 ////////////////////////////////////////////////////////////
 String::Iterator String::end()
 {
-    return m_impl->string.empty() ? nullptr : &(m_impl->string.front()) + m_impl->string.size();
+    return m_impl->data() + m_impl->size;
 }
 
 
 ////////////////////////////////////////////////////////////
 String::ConstIterator String::end() const
 {
-    return m_impl->string.empty() ? nullptr : &(m_impl->string.front()) + m_impl->string.size();
+    return m_impl->data() + m_impl->size;
 }
 
 
 ////////////////////////////////////////////////////////////
-void* String::getImplString()
+char32_t* String::resizeForOverwrite(base::SizeT size)
 {
-    return &m_impl->string;
+    return m_impl->resizeForOverwrite(size);
 }
 
 
 ////////////////////////////////////////////////////////////
 bool operator==(const String& lhs, const String& rhs)
 {
-    return lhs.m_impl->string == rhs.m_impl->string;
+    return lhs.m_impl->view() == rhs.m_impl->view();
 }
 
 
@@ -379,7 +664,7 @@ bool operator!=(const String& lhs, const String& rhs)
 ////////////////////////////////////////////////////////////
 bool operator<(const String& lhs, const String& rhs)
 {
-    return lhs.m_impl->string < rhs.m_impl->string;
+    return lhs.m_impl->view() < rhs.m_impl->view();
 }
 
 
@@ -0,0 +1,62 @@
+#include <SFML/Copyright.hpp> // LICENSE AND COPYRIGHT (C) INFORMATION
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include "SFML/System/FileMapping.hpp"
+#include "SFML/System/Path.hpp"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+
+namespace sf::priv
+{
+////////////////////////////////////////////////////////////
+base::Optional<FileMapping> mapFile(const Path& filename)
+{
+    const int fd = ::open(filename.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd == -1)
+        return base::nullOpt;
+
+    // The mapping keeps its own reference to the file, so the descriptor can always be closed on exit
+    struct FdCloser
+    {
+        int fd;
+        ~FdCloser()
+        {
+            ::close(fd);
+        }
+    } fdCloser{fd};
+
+    struct stat fileStat{};
+    if (::fstat(fd, &fileStat) == -1 || !S_ISREG(fileStat.st_mode))
+        return base::nullOpt;
+
+    const auto size = static_cast<base::SizeT>(fileStat.st_size);
+
+    // `mmap` refuses zero-length mappings
+    if (size == 0u)
+        return base::makeOptional(FileMapping{});
+
+    void* const data = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (data == MAP_FAILED)
+        return base::nullOpt;
+
+    // Only a hint, the kernel is free to ignore it
+    (void)::posix_madvise(data, size, POSIX_MADV_SEQUENTIAL);
+
+    return base::makeOptional(FileMapping{static_cast<const unsigned char*>(data), size});
+}
+
+
+////////////////////////////////////////////////////////////
+void unmapFile(const FileMapping& mapping)
+{
+    if (mapping.data != nullptr)
+        ::munmap(const_cast<unsigned char*>(mapping.data), mapping.size);
+}
+
+} // namespace sf::priv
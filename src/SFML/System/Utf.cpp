@@ -0,0 +1,185 @@
+#include <SFML/Copyright.hpp> // LICENSE AND COPYRIGHT (C) INFORMATION
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include "SFML/System/Utf.hpp"
+
+#include "SFML/Base/Builtins/Memcpy.hpp"
+#include "SFML/Base/IntTypes.hpp"
+#include "SFML/Base/Simd.hpp"
+#include "SFML/Base/SizeT.hpp"
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+
+namespace
+{
+////////////////////////////////////////////////////////////
+[[nodiscard, gnu::always_inline]] inline sf::base::U16 loadUnit16(const sf::base::U8* input, sf::base::SizeT index)
+{
+    sf::base::U16 unit{};
+    SFML_BASE_MEMCPY(&unit, input + index * 2u, sizeof(unit));
+    return unit;
+}
+
+
+////////////////////////////////////////////////////////////
+[[nodiscard, gnu::always_inline]] inline bool isSurrogate(sf::base::U16 unit)
+{
+    return (unit & 0xF800u) == 0xD800u;
+}
+
+} // namespace
+
+
+namespace sf::priv
+{
+////////////////////////////////////////////////////////////
+base::SizeT widenUtf8AsciiPrefix(const void* input, base::SizeT size, char32_t* output) noexcept
+{
+    const auto* const bytes = static_cast<const base::U8*>(input);
+    base::SizeT       i     = 0u;
+
+    // Widen whole blocks as long as they only contain ASCII characters,
+    // the first block with a non-ASCII one is left to the scalar loop below
+
+#if defined(__AVX2__)
+    for (; i + 32u <= size; i += 32u)
+    {
+        const __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(bytes + i));
+        if (_mm256_movemask_epi8(block) != 0)
+            break;
+
+        for (base::SizeT j = 0u; j < 32u; j += 8u)
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(output + i + j),
+                                _mm256_cvtepu8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(bytes + i + j))));
+    }
+#endif
+
+#if defined(SFML_BASE_SIMD_SSE2)
+    const __m128i zero = _mm_setzero_si128();
+
+    for (; i + 16u <= size; i += 16u)
+    {
+        const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(bytes + i));
+        if (_mm_movemask_epi8(block) != 0)
+            break;
+
+        const __m128i low  = _mm_unpacklo_epi8(block, zero);
+        const __m128i high = _mm_unpackhi_epi8(block, zero);
+
+        auto* const out = reinterpret_cast<__m128i*>(output + i);
+        _mm_storeu_si128(out + 0, _mm_unpacklo_epi16(low, zero));
+        _mm_storeu_si128(out + 1, _mm_unpackhi_epi16(low, zero));
+        _mm_storeu_si128(out + 2, _mm_unpacklo_epi16(high, zero));
+        _mm_storeu_si128(out + 3, _mm_unpackhi_epi16(high, zero));
+    }
+#elif defined(SFML_BASE_SIMD_NEON) && defined(__aarch64__)
+    for (; i + 16u <= size; i += 16u)
+    {
+        const uint8x16_t block = vld1q_u8(bytes + i);
+        if (vmaxvq_u8(block) >= 0x80u)
+            break;
+
+        const uint16x8_t low  = vmovl_u8(vget_low_u8(block));
+        const uint16x8_t high = vmovl_u8(vget_high_u8(block));
+
+        auto* const out = reinterpret_cast<uint32_t*>(output + i);
+        vst1q_u32(out + 0, vmovl_u16(vget_low_u16(low)));
+        vst1q_u32(out + 4, vmovl_u16(vget_high_u16(low)));
+        vst1q_u32(out + 8, vmovl_u16(vget_low_u16(high)));
+        vst1q_u32(out + 12, vmovl_u16(vget_high_u16(high)));
+    }
+#else
+    // Test eight characters at once in a general purpose register
+    for (; i + 8u <= size; i += 8u)
+    {
+        base::U64 block{};
+        SFML_BASE_MEMCPY(&block, bytes + i, sizeof(block));
+        if ((block & 0x8080808080808080ull) != 0u)
+            break;
+
+        for (base::SizeT j = 0u; j < 8u; ++j)
+            output[i + j] = bytes[i + j];
+    }
+#endif
+
+    for (; i < size && bytes[i] < 0x80u; ++i)
+        output[i] = bytes[i];
+
+    return i;
+}
+
+
+////////////////////////////////////////////////////////////
+base::SizeT widenUtf16BmpPrefix(const void* input, base::SizeT size, char32_t* output) noexcept
+{
+    const auto* const bytes = static_cast<const base::U8*>(input);
+    base::SizeT       i     = 0u;
+
+    // Widen whole blocks as long as they do not contain surrogates,
+    // the first block with a surrogate is left to the scalar loop below
+
+#if defined(__AVX2__)
+    const __m256i surrogateMask256 = _mm256_set1_epi16(static_cast<short>(0xF800));
+    const __m256i surrogateBits256 = _mm256_set1_epi16(static_cast<short>(0xD800));
+
+    for (; i + 16u <= size; i += 16u)
+    {
+        const __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(bytes + i * 2u));
+        if (_mm256_movemask_epi8(_mm256_cmpeq_epi16(_mm256_and_si256(block, surrogateMask256), surrogateBits256)) != 0)
+            break;
+
+        auto* const out = reinterpret_cast<__m256i*>(output + i);
+        _mm256_storeu_si256(out + 0, _mm256_cvtepu16_epi32(_mm256_castsi256_si128(block)));
+        _mm256_storeu_si256(out + 1, _mm256_cvtepu16_epi32(_mm256_extracti128_si256(block, 1)));
+    }
+#endif
+
+#if defined(SFML_BASE_SIMD_SSE2)
+    const __m128i zero          = _mm_setzero_si128();
+    const __m128i surrogateMask = _mm_set1_epi16(static_cast<short>(0xF800));
+    const __m128i surrogateBits = _mm_set1_epi16(static_cast<short>(0xD800));
+
+    for (; i + 8u <= size; i += 8u)
+    {
+        const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(bytes + i * 2u));
+        if (_mm_movemask_epi8(_mm_cmpeq_epi16(_mm_and_si128(block, surrogateMask), surrogateBits)) != 0)
+            break;
+
+        auto* const out = reinterpret_cast<__m128i*>(output + i);
+        _mm_storeu_si128(out + 0, _mm_unpacklo_epi16(block, zero));
+        _mm_storeu_si128(out + 1, _mm_unpackhi_epi16(block, zero));
+    }
+#elif defined(SFML_BASE_SIMD_NEON) && defined(__aarch64__)
+    const uint16x8_t surrogateMask = vdupq_n_u16(0xF800u);
+    const uint16x8_t surrogateBits = vdupq_n_u16(0xD800u);
+
+    for (; i + 8u <= size; i += 8u)
+    {
+        const uint16x8_t block = vreinterpretq_u16_u8(vld1q_u8(bytes + i * 2u));
+        if (vmaxvq_u16(vceqq_u16(vandq_u16(block, surrogateMask), surrogateBits)) != 0u)
+            break;
+
+        auto* const out = reinterpret_cast<uint32_t*>(output + i);
+        vst1q_u32(out + 0, vmovl_u16(vget_low_u16(block)));
+        vst1q_u32(out + 4, vmovl_u16(vget_high_u16(block)));
+    }
+#endif
+
+    for (; i < size; ++i)
+    {
+        const base::U16 unit = loadUnit16(bytes, i);
+        if (isSurrogate(unit))
+            break;
+
+        output[i] = unit;
+    }
+
+    return i;
+}
+
+} // namespace sf::priv
@@ -0,0 +1,68 @@
+#include <SFML/Copyright.hpp> // LICENSE AND COPYRIGHT (C) INFORMATION
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include "SFML/System/FileMapping.hpp"
+#include "SFML/System/Path.hpp"
+#include "SFML/System/Win32/WindowsHeader.hpp"
+
+
+namespace sf::priv
+{
+////////////////////////////////////////////////////////////
+base::Optional<FileMapping> mapFile(const Path& filename)
+{
+    // Sequential scan lets the cache manager read ahead aggressively
+    const HANDLE file = CreateFileW(filename.c_str(),
+                                    GENERIC_READ,
+                                    FILE_SHARE_READ,
+                                    nullptr,
+                                    OPEN_EXISTING,
+                                    FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN,
+                                    nullptr);
+
+    if (file == INVALID_HANDLE_VALUE)
+        return base::nullOpt;
+
+    // The view keeps its own reference to the file, so the handles can always be closed on exit
+    struct HandleCloser
+    {
+        HANDLE handle;
+        ~HandleCloser()
+        {
+            if (handle != nullptr)
+                CloseHandle(handle);
+        }
+    } fileCloser{file};
+
+    LARGE_INTEGER fileSize{};
+    if (!GetFileSizeEx(file, &fileSize))
+        return base::nullOpt;
+
+    const auto size = static_cast<base::SizeT>(fileSize.QuadPart);
+
+    // `CreateFileMapping` refuses zero-length mappings
+    if (size == 0u)
+        return base::makeOptional(FileMapping{});
+
+    const HandleCloser mappingCloser{CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr)};
+    if (mappingCloser.handle == nullptr)
+        return base::nullOpt;
+
+    const void* const data = MapViewOfFile(mappingCloser.handle, FILE_MAP_READ, 0, 0, 0);
+    if (data == nullptr)
+        return base::nullOpt;
+
+    return base::makeOptional(FileMapping{static_cast<const unsigned char*>(data), size});
+}
+
+
+////////////////////////////////////////////////////////////
+void unmapFile(const FileMapping& mapping)
+{
+    if (mapping.data != nullptr)
+        UnmapViewOfFile(mapping.data);
+}
+
+} // namespace sf::priv
@@ -4,14 +4,17 @@
 ////////////////////////////////////////////////////////////
 // Headers
 ////////////////////////////////////////////////////////////
+#include "SFML/Config.hpp"
+
 #include "SFML/Window/Keyboard.hpp"
 #include "SFML/Window/Mouse.hpp"
 
 
 namespace sf
 {
+class InputSnapshot;
 class WindowBase;
-}
+} // namespace sf
 
 namespace sf::priv::InputImpl
 {
@@ -148,4 +151,22 @@ Vector2i getTouchPosition(unsigned int finger);
 ////////////////////////////////////////////////////////////
 Vector2i getTouchPosition(unsigned int finger, const WindowBase& relativeTo);
 
+#if defined(SFML_SYSTEM_LINUX_OR_BSD) && !defined(SFML_USE_DRM)
+
+////////////////////////////////////////////////////////////
+/// \brief Capture the whole keyboard and mouse state at once
+///
+/// Only implemented where querying the state in bulk is
+/// significantly cheaper than querying each key and button
+/// separately (X11). Elsewhere, `sf::InputSnapshot` falls back
+/// to the individual queries above.
+///
+/// \param snapshot   Snapshot to overwrite
+/// \param relativeTo Reference window for the relative mouse position (can be `nullptr`)
+///
+////////////////////////////////////////////////////////////
+void captureSnapshot(InputSnapshot& snapshot, const WindowBase* relativeTo);
+
+#endif
+
 } // namespace sf::priv::InputImpl
@@ -0,0 +1,211 @@
+#include <SFML/Copyright.hpp> // LICENSE AND COPYRIGHT (C) INFORMATION
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include "SFML/Config.hpp"
+
+#include "SFML/Window/Event.hpp"
+#include "SFML/Window/InputImpl.hpp"
+#include "SFML/Window/InputSnapshot.hpp"
+
+
+namespace
+{
+////////////////////////////////////////////////////////////
+[[gnu::always_inline]] inline bool isValid(sf::Keyboard::Key key)
+{
+    return key != sf::Keyboard::Key::Unknown;
+}
+
+
+////////////////////////////////////////////////////////////
+[[gnu::always_inline]] inline bool isValid(sf::Keyboard::Scancode code)
+{
+    return code != sf::Keyboard::Scan::Unknown;
+}
+
+
+////////////////////////////////////////////////////////////
+void captureSnapshotImpl(sf::InputSnapshot& snapshot, const sf::WindowBase* relativeTo)
+{
+#if defined(SFML_SYSTEM_LINUX_OR_BSD) && !defined(SFML_USE_DRM)
+
+    sf::priv::InputImpl::captureSnapshot(snapshot, relativeTo);
+
+#else
+
+    // No bulk query available, query each key and button individually
+    for (unsigned int i = 0u; i < sf::Keyboard::ScancodeCount; ++i)
+    {
+        const auto code = static_cast<sf::Keyboard::Scancode>(i);
+        snapshot.setKeyPressed(code, sf::priv::InputImpl::isKeyPressed(code));
+    }
+
+    for (unsigned int i = 0u; i < sf::Keyboard::KeyCount; ++i)
+    {
+        const auto key = static_cast<sf::Keyboard::Key>(i);
+        snapshot.setKeyPressed(key, sf::priv::InputImpl::isKeyPressed(key));
+    }
+
+    for (unsigned int i = 0u; i < sf::Mouse::ButtonCount; ++i)
+    {
+        const auto button = static_cast<sf::Mouse::Button>(i);
+        snapshot.setButtonPressed(button, sf::priv::InputImpl::isMouseButtonPressed(button));
+    }
+
+    const sf::Vector2i desktopPosition = sf::priv::InputImpl::getMousePosition();
+    snapshot.setMousePosition(desktopPosition,
+                              relativeTo != nullptr ? sf::priv::InputImpl::getMousePosition(*relativeTo)
+                                                    : desktopPosition);
+
+#endif
+}
+
+} // namespace
+
+
+namespace sf
+{
+////////////////////////////////////////////////////////////
+InputSnapshot InputSnapshot::capture()
+{
+    InputSnapshot snapshot;
+    snapshot.update();
+    return snapshot;
+}
+
+
+////////////////////////////////////////////////////////////
+InputSnapshot InputSnapshot::capture(const WindowBase& relativeTo)
+{
+    InputSnapshot snapshot;
+    snapshot.update(relativeTo);
+    return snapshot;
+}
+
+
+////////////////////////////////////////////////////////////
+void InputSnapshot::update()
+{
+    captureSnapshotImpl(*this, nullptr);
+}
+
+
+////////////////////////////////////////////////////////////
+void InputSnapshot::update(const WindowBase& relativeTo)
+{
+    captureSnapshotImpl(*this, &relativeTo);
+}
+
+
+////////////////////////////////////////////////////////////
+void InputSnapshot::applyEvent(const Event& event)
+{
+    if (const auto* keyPressed = event.getIf<Event::KeyPressed>())
+    {
+        setKeyPressed(keyPressed->code, true);
+        setKeyPressed(keyPressed->scancode, true);
+    }
+    else if (const auto* keyReleased = event.getIf<Event::KeyReleased>())
+    {
+        setKeyPressed(keyReleased->code, false);
+        setKeyPressed(keyReleased->scancode, false);
+    }
+    else if (const auto* buttonPressed = event.getIf<Event::MouseButtonPressed>())
+    {
+        setButtonPressed(buttonPressed->button, true);
+        m_relativeMousePosition = buttonPressed->position;
+    }
+    else if (const auto* buttonReleased = event.getIf<Event::MouseButtonReleased>())
+    {
+        setButtonPressed(buttonReleased->button, false);
+        m_relativeMousePosition = buttonReleased->position;
+    }
+    else if (const auto* mouseMoved = event.getIf<Event::MouseMoved>())
+    {
+        m_relativeMousePosition = mouseMoved->position;
+    }
+    else if (event.is<Event::FocusLost>())
+    {
+        // Release events are not delivered to unfocused windows
+        releaseAll();
+    }
+}
+
+
+////////////////////////////////////////////////////////////
+bool InputSnapshot::isKeyPressed(Keyboard::Key key) const
+{
+    return isValid(key) && m_keys[key];
+}
+
+
+////////////////////////////////////////////////////////////
+bool InputSnapshot::isKeyPressed(Keyboard::Scancode code) const
+{
+    return isValid(code) && m_scancodes[code];
+}
+
+
+////////////////////////////////////////////////////////////
+bool InputSnapshot::isButtonPressed(Mouse::Button button) const
+{
+    return m_buttons[button];
+}
+
+
+////////////////////////////////////////////////////////////
+Vector2i InputSnapshot::getMousePosition() const
+{
+    return m_mousePosition;
+}
+
+
+////////////////////////////////////////////////////////////
+Vector2i InputSnapshot::getRelativeMousePosition() const
+{
+    return m_relativeMousePosition;
+}
+
+
+////////////////////////////////////////////////////////////
+void InputSnapshot::setKeyPressed(Keyboard::Key key, bool pressed)
+{
+    if (isValid(key))
+        m_keys[key] = pressed;
+}
+
+
+////////////////////////////////////////////////////////////
+void InputSnapshot::setKeyPressed(Keyboard::Scancode code, bool pressed)
+{
+    if (isValid(code))
+        m_scancodes[code] = pressed;
+}
+
+
+////////////////////////////////////////////////////////////
+void InputSnapshot::setButtonPressed(Mouse::Button button, bool pressed)
+{
+    m_buttons[button] = pressed;
+}
+
+
+////////////////////////////////////////////////////////////
+void InputSnapshot::setMousePosition(Vector2i desktopPosition, Vector2i relativePosition)
+{
+    m_mousePosition         = desktopPosition;
+    m_relativeMousePosition = relativePosition;
+}
+
+
+////////////////////////////////////////////////////////////
+void InputSnapshot::releaseAll()
+{
+    m_keys.fill(false);
+    m_scancodes.fill(false);
+    m_buttons.fill(false);
+}
+
+} // namespace sf
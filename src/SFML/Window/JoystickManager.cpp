@@ -3,22 +3,291 @@
 ////////////////////////////////////////////////////////////
 // Headers
 ////////////////////////////////////////////////////////////
+#include "SFML/Config.hpp"
+
 #include "SFML/Window/JoystickIdentification.hpp"
 #include "SFML/Window/JoystickImpl.hpp"
 #include "SFML/Window/JoystickManager.hpp"
 
+#include "SFML/System/Clock.hpp"
+#include "SFML/System/Time.hpp"
+
 #include "SFML/Base/Assert.hpp"
 
+#if defined(SFML_SYSTEM_LINUX)
+
+#include "SFML/System/Err.hpp"
+
+#include "SFML/Base/Macros.hpp"
+#include "SFML/Base/SpscQueue.hpp"
+#include "SFML/Base/UniquePtr.hpp"
+
+#include <sys/eventfd.h>
+#include <unistd.h>
+
+#include <atomic>
+#include <mutex>
+#include <thread>
+
+#include <cerrno>
+#include <cstdint>
+
+#endif
+
+
+namespace
+{
+////////////////////////////////////////////////////////////
+[[nodiscard]] bool haveSameState(const sf::priv::JoystickState& lhs, const sf::priv::JoystickState& rhs)
+{
+    if (lhs.connected != rhs.connected)
+        return false;
+
+    for (unsigned int i = 0; i < sf::Joystick::AxisCount; ++i)
+        if (lhs.axes.data[i] != rhs.axes.data[i])
+            return false;
+
+    for (unsigned int i = 0; i < sf::Joystick::ButtonCount; ++i)
+        if (lhs.buttons[i] != rhs.buttons[i])
+            return false;
+
+    return true;
+}
+
+
+////////////////////////////////////////////////////////////
+/// Query a single joystick slot, opening or closing the
+/// joystick as needed. Returns `true` if it was just opened.
+///
+////////////////////////////////////////////////////////////
+bool updateSlot(unsigned int                      index,
+                sf::priv::JoystickImpl&           impl,
+                sf::priv::JoystickState&          state,
+                sf::priv::JoystickCapabilities&   capabilities,
+                sf::priv::JoystickIdentification& identification)
+{
+    if (state.connected)
+    {
+        // Get the current state of the joystick
+        state = impl.update();
+
+        // Check if it's still connected
+        if (!state.connected)
+        {
+            impl.close();
+
+            capabilities   = {};
+            state          = {};
+            identification = {};
+        }
+
+        return false;
+    }
+
+    // Check if the joystick was connected since last update
+    if (!sf::priv::JoystickImpl::isConnected(index) || !impl.open(index))
+        return false;
+
+    capabilities   = impl.getCapabilities();
+    state          = impl.update();
+    identification = impl.getIdentification();
+
+    return true;
+}
+
+
+#if defined(SFML_SYSTEM_LINUX)
+
+////////////////////////////////////////////////////////////
+struct ChangeRecord
+{
+    sf::priv::JoystickState state;          //!< State of the joystick after the change
+    sf::Time                timestamp;      //!< Time at which the change was read
+    unsigned int            joystickId{};   //!< Index of the joystick
+    unsigned int            connectionId{}; //!< Incremented on every connection, detects coalesced reconnections
+};
+
+
+////////////////////////////////////////////////////////////
+/// Reads the joysticks on a dedicated thread. The thread is
+/// the only one touching `impls` once started, and publishes
+/// full state snapshots so that changes that do not fit in
+/// the queue can simply be coalesced and retried later.
+///
+////////////////////////////////////////////////////////////
+class JoystickPoller
+{
+public:
+    ////////////////////////////////////////////////////////////
+    explicit JoystickPoller(const sf::Clock& clock) :
+    m_clock(clock),
+    m_wakeUpFd(eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK))
+    {
+        if (m_wakeUpFd < 0)
+            sf::priv::err() << "Failed to create joystick wake-up event, shutdown may be delayed: " << errno;
+
+        // Initial synchronous scan, so that joysticks connected at startup are visible from the first update
+        pollOnce();
+
+        m_thread = std::thread([this] { run(); });
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    ~JoystickPoller()
+    {
+        m_stopRequested.store(true, std::memory_order_relaxed);
+
+        if (m_wakeUpFd >= 0)
+        {
+            const std::uint64_t one = 1u;
+            [[maybe_unused]] const auto written = ::write(m_wakeUpFd, &one, sizeof(one));
+        }
+
+        m_thread.join();
+
+        for (unsigned int i = 0; i < sf::Joystick::MaxCount; ++i)
+            if (m_states[i].connected)
+                m_impls[i].close();
+
+        if (m_wakeUpFd >= 0)
+            ::close(m_wakeUpFd);
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    JoystickPoller(const JoystickPoller&)            = delete;
+    JoystickPoller& operator=(const JoystickPoller&) = delete;
+
+
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] bool popChange(ChangeRecord& record)
+    {
+        return m_changes.tryPop(record);
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    void getConnectionInfo(unsigned int                      joystickId,
+                           sf::priv::JoystickCapabilities&   capabilities,
+                           sf::priv::JoystickIdentification& identification)
+    {
+        const std::lock_guard lock(m_connectionMutex);
+
+        capabilities   = m_capabilities[joystickId];
+        identification = m_identifications[joystickId];
+    }
+
+
+private:
+    ////////////////////////////////////////////////////////////
+    void run()
+    {
+        while (!m_stopRequested.load(std::memory_order_relaxed))
+        {
+            sf::priv::JoystickImpl::waitForEvents(m_impls, sf::Joystick::MaxCount, m_wakeUpFd, getWaitTimeoutMs());
+
+            if (m_stopRequested.load(std::memory_order_relaxed))
+                break;
+
+            pollOnce();
+        }
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] int getWaitTimeoutMs() const
+    {
+        // Retry soon if the main thread is lagging behind and some changes could not be published
+        for (const bool pending : m_pending)
+            if (pending)
+                return 10;
+
+        // Without a udev monitor, connections can only be detected by rescanning
+        if (!sf::priv::JoystickImpl::hasMonitor())
+            return 500;
+
+        return m_wakeUpFd < 0 ? 100 : -1;
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    void pollOnce()
+    {
+        for (unsigned int i = 0; i < sf::Joystick::MaxCount; ++i)
+        {
+            const sf::priv::JoystickState previousState = m_states[i];
+
+            sf::priv::JoystickCapabilities   capabilities;
+            sf::priv::JoystickIdentification identification;
+
+            if (updateSlot(i, m_impls[i], m_states[i], capabilities, identification))
+            {
+                const std::lock_guard lock(m_connectionMutex);
+
+                m_capabilities[i]    = capabilities;
+                m_identifications[i] = SFML_BASE_MOVE(identification);
+                ++m_connectionIds[i];
+            }
+            else if (haveSameState(previousState, m_states[i]))
+            {
+                continue;
+            }
+
+            m_pending[i]      = true;
+            m_pendingTimes[i] = m_clock.getElapsedTime();
+        }
+
+        for (unsigned int i = 0; i < sf::Joystick::MaxCount; ++i)
+            if (m_pending[i])
+                m_pending[i] = !m_changes.tryPush({m_states[i], m_pendingTimes[i], i, m_connectionIds[i]});
+    }
+
+
+    ////////////////////////////////////////////////////////////
+    // Member data
+    ////////////////////////////////////////////////////////////
+    const sf::Clock& m_clock; //!< Clock shared with the manager, for timestamps
+
+    sf::priv::JoystickImpl  m_impls[sf::Joystick::MaxCount];           //!< Joystick implementations
+    sf::priv::JoystickState m_states[sf::Joystick::MaxCount];          //!< Latest states read by the thread
+    unsigned int            m_connectionIds[sf::Joystick::MaxCount]{}; //!< Connection counters
+    bool                    m_pending[sf::Joystick::MaxCount]{};       //!< Changed but not published yet
+    sf::Time                m_pendingTimes[sf::Joystick::MaxCount];    //!< Time of the unpublished changes
+
+    std::mutex                       m_connectionMutex;                         //!< Guards the connection info
+    sf::priv::JoystickCapabilities   m_capabilities[sf::Joystick::MaxCount];    //!< Connected capabilities
+    sf::priv::JoystickIdentification m_identifications[sf::Joystick::MaxCount]; //!< Connected identifications
+
+    sf::base::SpscQueue<ChangeRecord, 256> m_changes; //!< Changes published to the main thread
+
+    std::atomic<bool> m_stopRequested{false}; //!< Set to ask the thread to exit
+    int               m_wakeUpFd;             //!< Interrupts the blocking wait on shutdown
+    std::thread       m_thread;               //!< Polling thread, started last
+};
+
+#endif
+
+} // namespace
+
 
 namespace sf::priv
 {
 ////////////////////////////////////////////////////////////
 struct JoystickManager::Impl
 {
-    JoystickImpl           impls[Joystick::MaxCount];           //!< Joystick implementations
     JoystickState          states[Joystick::MaxCount];          //!< Joystick states
     JoystickCapabilities   capabilities[Joystick::MaxCount];    //!< Joystick capabilities
     JoystickIdentification identifications[Joystick::MaxCount]; //!< Joystick identifications
+    Time                   lastChangeTimes[Joystick::MaxCount]; //!< Time of the last state change
+    Clock                  clock;                               //!< Time reference for the changes
+
+#if defined(SFML_SYSTEM_LINUX)
+    unsigned int                    connectionIds[Joystick::MaxCount]{}; //!< Last connection seen per joystick
+    base::UniquePtr<JoystickPoller> poller;                              //!< Background polling thread
+#else
+    JoystickImpl impls[Joystick::MaxCount]; //!< Joystick implementations
+#endif
 };
 
 
@@ -46,39 +315,52 @@ const JoystickIdentification& JoystickManager::getIdentification(unsigned int jo
 }
 
 
+////////////////////////////////////////////////////////////
+Time JoystickManager::getLastChangeTime(unsigned int joystickId) const
+{
+    SFML_BASE_ASSERT(joystickId < Joystick::MaxCount && "Joystick index must be less than `Joystick::MaxCount`");
+    return m_impl->lastChangeTimes[joystickId];
+}
+
+
 ////////////////////////////////////////////////////////////
 void JoystickManager::update()
 {
-    for (unsigned int i = 0; i < Joystick::MaxCount; ++i)
+#if defined(SFML_SYSTEM_LINUX)
+
+    // Only apply the changes published by the polling thread
+    ChangeRecord record;
+    while (m_impl->poller->popChange(record))
     {
-        auto& [impls, states, capabilities, identifications] = *m_impl;
+        const unsigned int i = record.joystickId;
 
-        if (states[i].connected)
+        if (!record.state.connected)
         {
-            // Get the current state of the joystick
-            states[i] = impls[i].update();
-
-            // Check if it's still connected
-            if (!states[i].connected)
-            {
-                impls[i].close();
-
-                capabilities[i]    = {};
-                states[i]          = {};
-                identifications[i] = {};
-            }
+            m_impl->capabilities[i]    = {};
+            m_impl->identifications[i] = {};
         }
-        else
+        else if (record.connectionId != m_impl->connectionIds[i])
         {
-            // Check if the joystick was connected since last update
-            if (JoystickImpl::isConnected(i) && impls[i].open(i))
-            {
-                capabilities[i]    = impls[i].getCapabilities();
-                states[i]          = impls[i].update();
-                identifications[i] = impls[i].getIdentification();
-            }
+            m_impl->poller->getConnectionInfo(i, m_impl->capabilities[i], m_impl->identifications[i]);
+            m_impl->connectionIds[i] = record.connectionId;
         }
+
+        m_impl->states[i]          = record.state;
+        m_impl->lastChangeTimes[i] = record.timestamp;
     }
+
+#else
+
+    for (unsigned int i = 0; i < Joystick::MaxCount; ++i)
+    {
+        const JoystickState previousState = m_impl->states[i];
+
+        if (updateSlot(i, m_impl->impls[i], m_impl->states[i], m_impl->capabilities[i], m_impl->identifications[i]) ||
+            !haveSameState(previousState, m_impl->states[i]))
+            m_impl->lastChangeTimes[i] = m_impl->clock.getElapsedTime();
+    }
+
+#endif
 }
 
 
@@ -86,15 +368,24 @@ void JoystickManager::update()
 JoystickManager::JoystickManager()
 {
     JoystickImpl::initialize();
+
+#if defined(SFML_SYSTEM_LINUX)
+    m_impl->poller = base::makeUnique<JoystickPoller>(m_impl->clock);
+#endif
 }
 
 
 ////////////////////////////////////////////////////////////
 JoystickManager::~JoystickManager()
 {
+#if defined(SFML_SYSTEM_LINUX)
+    // Joins the polling thread and closes the joysticks
+    m_impl->poller.reset();
+#else
     for (unsigned int i = 0; i < Joystick::MaxCount; ++i)
         if (m_impl->states[i].connected)
             m_impl->impls[i].close();
+#endif
 
     JoystickImpl::cleanup();
 }
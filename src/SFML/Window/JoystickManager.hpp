@@ -10,6 +10,11 @@
 ////////////////////////////////////////////////////////////
 // Forward declarations
 ////////////////////////////////////////////////////////////
+namespace sf
+{
+class Time;
+} // namespace sf
+
 namespace sf::priv
 {
 struct JoystickCapabilities;
@@ -23,6 +28,16 @@ namespace sf::priv
 ////////////////////////////////////////////////////////////
 /// \brief Global joystick manager
 ///
+/// On Linux, joysticks are read by a dedicated thread that
+/// blocks on the device files and on the udev monitor, and
+/// publishes timestamped state changes through a lock-free
+/// queue. `update` then only drains that queue, so the cost
+/// of polling events no longer depends on the number of
+/// joystick slots and input is not sampled at the frame rate.
+///
+/// Other platforms query the joysticks synchronously from
+/// `update`.
+///
 ////////////////////////////////////////////////////////////
 class [[nodiscard]] JoystickManager
 {
@@ -81,9 +96,25 @@ public:
     ////////////////////////////////////////////////////////////
     [[nodiscard]] const JoystickIdentification& getIdentification(unsigned int joystickId) const;
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Get the time of the last state change of a joystick
+    ///
+    /// The time is measured from the construction of the
+    /// manager, at the moment the change was read from the
+    /// device rather than when `update` was called.
+    ///
+    /// \param joystick Index of the joystick
+    ///
+    /// \return Time of the last connection, move or button change
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] Time getLastChangeTime(unsigned int joystickId) const;
+
     ////////////////////////////////////////////////////////////
     /// \brief Update the state of all the joysticks
     ///
+    /// Must be called from the thread that owns the manager.
+    ///
     ////////////////////////////////////////////////////////////
     void update();
 
@@ -4,6 +4,7 @@
 // Headers
 ////////////////////////////////////////////////////////////
 #include "SFML/Window/InputImpl.hpp"
+#include "SFML/Window/InputSnapshot.hpp"
 #include "SFML/Window/Unix/Display.hpp"
 #include "SFML/Window/Unix/KeyboardImpl.hpp"
 #include "SFML/Window/WindowBase.hpp"
@@ -15,6 +16,61 @@
 #include <X11/keysym.h>
 
 
+namespace
+{
+////////////////////////////////////////////////////////////
+struct PointerState
+{
+    sf::Vector2i desktopPosition;  //!< Position of the pointer relative to the root window
+    sf::Vector2i relativePosition; //!< Position of the pointer relative to the queried window
+    unsigned int buttons{};        //!< Mask of the pressed buttons and modifiers
+};
+
+
+////////////////////////////////////////////////////////////
+PointerState queryPointer(::Display& display, ::Window window)
+{
+    // we don't care about these but they are required
+    ::Window root  = 0;
+    ::Window child = 0;
+
+    PointerState state;
+    XQueryPointer(&display,
+                  window,
+                  &root,
+                  &child,
+                  &state.desktopPosition.x,
+                  &state.desktopPosition.y,
+                  &state.relativePosition.x,
+                  &state.relativePosition.y,
+                  &state.buttons);
+
+    return state;
+}
+
+
+////////////////////////////////////////////////////////////
+bool isButtonInMask(unsigned int buttons, sf::Mouse::Button button)
+{
+    // Buttons 4 and 5 are the vertical wheel and 6 and 7 the horizontal wheel.
+    // There is no mask for buttons 8 and 9, so checking the state of buttons
+    // Mouse::Button::Extra1 and Mouse::Button::Extra2 is not supported.
+    // clang-format off
+    switch (button)
+    {
+        case sf::Mouse::Button::Left:   return buttons & Button1Mask;
+        case sf::Mouse::Button::Right:  return buttons & Button3Mask;
+        case sf::Mouse::Button::Middle: return buttons & Button2Mask;
+        case sf::Mouse::Button::Extra1: return false; // not supported by X
+        case sf::Mouse::Button::Extra2: return false; // not supported by X
+        default:                        return false;
+    }
+    // clang-format on
+}
+
+} // namespace
+
+
 namespace sf::priv::InputImpl
 {
 ////////////////////////////////////////////////////////////
@@ -65,31 +121,7 @@ bool isMouseButtonPressed(Mouse::Button button)
     // Open a connection with the X server
     const auto display = openDisplay();
 
-    // we don't care about these but they are required
-    ::Window root  = 0;
-    ::Window child = 0;
-    int      wx    = 0;
-    int      wy    = 0;
-    int      gx    = 0;
-    int      gy    = 0;
-
-    unsigned int buttons = 0;
-    XQueryPointer(display.get(), DefaultRootWindow(display.get()), &root, &child, &gx, &gy, &wx, &wy, &buttons);
-
-    // Buttons 4 and 5 are the vertical wheel and 6 and 7 the horizontal wheel.
-    // There is no mask for buttons 8 and 9, so checking the state of buttons
-    // Mouse::Button::Extra1 and Mouse::Button::Extra2 is not supported.
-    // clang-format off
-    switch (button)
-    {
-        case Mouse::Button::Left:   return buttons & Button1Mask;
-        case Mouse::Button::Right:  return buttons & Button3Mask;
-        case Mouse::Button::Middle: return buttons & Button2Mask;
-        case Mouse::Button::Extra1: return false; // not supported by X
-        case Mouse::Button::Extra2: return false; // not supported by X
-        default:                    return false;
-    }
-    // clang-format on
+    return isButtonInMask(queryPointer(*display, DefaultRootWindow(display.get())).buttons, button);
 }
 
 
@@ -99,18 +131,7 @@ Vector2i getMousePosition()
     // Open a connection with the X server
     const auto display = openDisplay();
 
-    // we don't care about these but they are required
-    ::Window     root    = 0;
-    ::Window     child   = 0;
-    int          x       = 0;
-    int          y       = 0;
-    unsigned int buttons = 0;
-
-    int gx = 0;
-    int gy = 0;
-    XQueryPointer(display.get(), DefaultRootWindow(display.get()), &root, &child, &gx, &gy, &x, &y, &buttons);
-
-    return {gx, gy};
+    return queryPointer(*display, DefaultRootWindow(display.get())).desktopPosition;
 }
 
 
@@ -123,18 +144,7 @@ Vector2i getMousePosition(const WindowBase& relativeTo)
         // Open a connection with the X server
         const auto display = openDisplay();
 
-        // we don't care about these but they are required
-        ::Window     root    = 0;
-        ::Window     child   = 0;
-        int          gx      = 0;
-        int          gy      = 0;
-        unsigned int buttons = 0;
-
-        int x = 0;
-        int y = 0;
-        XQueryPointer(display.get(), handle, &root, &child, &gx, &gy, &x, &y, &buttons);
-
-        return {x, y};
+        return queryPointer(*display, handle).relativePosition;
     }
 
     return {};
@@ -190,4 +200,26 @@ Vector2i getTouchPosition(unsigned int /* finger */, const WindowBase& /* relati
     return {};
 }
 
+
+////////////////////////////////////////////////////////////
+void captureSnapshot(InputSnapshot& snapshot, const WindowBase* relativeTo)
+{
+    // Open a connection with the X server
+    const auto display = openDisplay();
+
+    KeyboardImpl::captureKeyboardState(*display, snapshot);
+
+    // Querying the pointer relative to the window also yields the desktop position
+    const WindowHandle handle  = relativeTo != nullptr ? relativeTo->getNativeHandle() : WindowHandle{};
+    const PointerState pointer = queryPointer(*display, handle ? handle : DefaultRootWindow(display.get()));
+
+    for (unsigned int i = 0u; i < Mouse::ButtonCount; ++i)
+    {
+        const auto button = static_cast<Mouse::Button>(i);
+        snapshot.setButtonPressed(button, isButtonInMask(pointer.buttons, button));
+    }
+
+    snapshot.setMousePosition(pointer.desktopPosition, pointer.relativePosition);
+}
+
 } // namespace sf::priv::InputImpl
@@ -495,6 +495,43 @@ bool JoystickImpl::isConnected(unsigned int index)
     return joystickList[index].plugged;
 }
 
+////////////////////////////////////////////////////////////
+void JoystickImpl::waitForEvents(const JoystickImpl* impls, base::SizeT count, int wakeUpFd, int timeoutMs)
+{
+    pollfd      fds[Joystick::MaxCount + 2u]{};
+    base::SizeT fdCount = 0u;
+
+    fds[fdCount++] = {wakeUpFd, POLLIN, 0};
+
+    if (udevMonitor)
+        fds[fdCount++] = {udev_monitor_get_fd(udevMonitor.get()), POLLIN, 0};
+
+    for (base::SizeT i = 0u; i < count && i < Joystick::MaxCount; ++i)
+        if (impls[i].m_file >= 0)
+            fds[fdCount++] = {impls[i].m_file, POLLIN, 0};
+
+    // Errors and hang-ups are reported as ready, the caller detects them on the next update
+    while (poll(fds, static_cast<nfds_t>(fdCount), timeoutMs) < 0 && errno == EINTR)
+        ;
+
+    // Consume the device changes now: `isConnected` is only queried for the disconnected
+    // joysticks, and an unread monitor event would make every following wait return at once
+    if (udevMonitor)
+        while (hasMonitorEvent())
+        {
+            const auto udevDevice = UdevPtr<udev_device>(udev_monitor_receive_device(udevMonitor.get()));
+            updatePluggedList(udevDevice.get());
+        }
+}
+
+
+////////////////////////////////////////////////////////////
+bool JoystickImpl::hasMonitor()
+{
+    return udevMonitor != nullptr;
+}
+
+
 ////////////////////////////////////////////////////////////
 bool JoystickImpl::open(unsigned int index)
 {
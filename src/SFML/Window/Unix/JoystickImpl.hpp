@@ -6,6 +6,8 @@
 ////////////////////////////////////////////////////////////
 #include "SFML/Window/JoystickIdentification.hpp"
 
+#include "SFML/Base/SizeT.hpp"
+
 #include <linux/input.h>
 
 
@@ -40,6 +42,33 @@ public:
     ////////////////////////////////////////////////////////////
     static bool isConnected(unsigned int index);
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Block until joystick input or a device change is pending
+    ///
+    /// Waits on the file descriptors of all the open joysticks
+    /// and on the udev monitor at the same time. The pending
+    /// device changes are then applied to the list of plugged
+    /// joysticks, as seen by `isConnected`.
+    ///
+    /// \param impls     Joystick implementations to wait on
+    /// \param count     Number of joystick implementations
+    /// \param wakeUpFd  Additional file descriptor that interrupts the wait when readable
+    /// \param timeoutMs Maximum time to wait, in milliseconds (-1 to wait forever)
+    ///
+    ////////////////////////////////////////////////////////////
+    static void waitForEvents(const JoystickImpl* impls, base::SizeT count, int wakeUpFd, int timeoutMs);
+
+    ////////////////////////////////////////////////////////////
+    /// \brief Check if device changes are notified by the udev monitor
+    ///
+    /// Without a monitor, connections are only detected by
+    /// periodically rescanning the devices.
+    ///
+    /// \return `true` if the udev monitor is available
+    ///
+    ////////////////////////////////////////////////////////////
+    [[nodiscard]] static bool hasMonitor();
+
     ////////////////////////////////////////////////////////////
     /// \brief Open the joystick
     ///
@@ -3,6 +3,7 @@
 ////////////////////////////////////////////////////////////
 // Headers
 ////////////////////////////////////////////////////////////
+#include "SFML/Window/InputSnapshot.hpp"
 #include "SFML/Window/Unix/Display.hpp"
 #include "SFML/Window/Unix/KeySymToKeyMapping.hpp"
 #include "SFML/Window/Unix/KeySymToUnicodeMapping.hpp"
@@ -520,14 +521,13 @@ sf::Keyboard::Scancode keyCodeToScancode(KeyCode code)
 
 
 ////////////////////////////////////////////////////////////
-KeyCode keyToKeyCode(sf::Keyboard::Key key)
+KeyCode keyToKeyCode(Display& display, sf::Keyboard::Key key)
 {
     const KeySym keysym = sf::priv::keyToKeySym(key);
 
     if (keysym != NoSymbol)
     {
-        const auto    display = sf::priv::openDisplay();
-        const KeyCode keycode = XKeysymToKeycode(display.get(), keysym);
+        const KeyCode keycode = XKeysymToKeycode(&display, keysym);
 
         if (keycode != nullKeyCode)
             return keycode;
@@ -557,21 +557,29 @@ KeySym scancodeToKeySym(sf::Keyboard::Scancode code)
 
 
 ////////////////////////////////////////////////////////////
-bool isKeyPressedImpl(KeyCode keycode)
+/// Bit vector of the pressed keycodes, as returned by `XQueryKeymap`
+using Keymap = char[32];
+
+
+////////////////////////////////////////////////////////////
+bool isKeyCodePressed(const Keymap& keys, KeyCode keycode)
 {
-    if (keycode != nullKeyCode)
-    {
-        const auto display = sf::priv::openDisplay();
+    return keycode != nullKeyCode && (keys[keycode / 8] & (1 << (keycode % 8))) != 0;
+}
 
-        // Get the whole keyboard state
-        char keys[32];
-        XQueryKeymap(display.get(), keys);
 
-        // Check our keycode
-        return (keys[keycode / 8] & (1 << (keycode % 8))) != 0;
-    }
+////////////////////////////////////////////////////////////
+bool isKeyPressedImpl(Display& display, KeyCode keycode)
+{
+    if (keycode == nullKeyCode)
+        return false;
 
-    return false;
+    // Get the whole keyboard state
+    Keymap keys;
+    XQueryKeymap(&display, keys);
+
+    // Check our keycode
+    return isKeyCodePressed(keys, keycode);
 }
 
 } // anonymous namespace
@@ -582,23 +590,47 @@ namespace sf::priv
 ////////////////////////////////////////////////////////////
 bool KeyboardImpl::isKeyPressed(Keyboard::Key key)
 {
-    const KeyCode keycode = keyToKeyCode(key);
-    return isKeyPressedImpl(keycode);
+    const auto    display = openDisplay();
+    const KeyCode keycode = keyToKeyCode(*display, key);
+    return isKeyPressedImpl(*display, keycode);
 }
 
 
 ////////////////////////////////////////////////////////////
 bool KeyboardImpl::isKeyPressed(Keyboard::Scancode code)
 {
+    const auto    display = openDisplay();
     const KeyCode keycode = scancodeToKeyCode(code);
-    return isKeyPressedImpl(keycode);
+    return isKeyPressedImpl(*display, keycode);
+}
+
+
+////////////////////////////////////////////////////////////
+void KeyboardImpl::captureKeyboardState(::Display& display, InputSnapshot& snapshot)
+{
+    // Single round trip for the whole keyboard, the keycode lookups below are client-side
+    Keymap keys;
+    XQueryKeymap(&display, keys);
+
+    for (unsigned int i = 0u; i < Keyboard::ScancodeCount; ++i)
+    {
+        const auto code = static_cast<Keyboard::Scancode>(i);
+        snapshot.setKeyPressed(code, isKeyCodePressed(keys, scancodeToKeyCode(code)));
+    }
+
+    for (unsigned int i = 0u; i < Keyboard::KeyCount; ++i)
+    {
+        const auto key = static_cast<Keyboard::Key>(i);
+        snapshot.setKeyPressed(key, isKeyCodePressed(keys, keyToKeyCode(display, key)));
+    }
 }
 
 
 ////////////////////////////////////////////////////////////
 Keyboard::Scancode KeyboardImpl::delocalize(Keyboard::Key key)
 {
-    const KeyCode keycode = keyToKeyCode(key);
+    const auto    display = openDisplay();
+    const KeyCode keycode = keyToKeyCode(*display, key);
     return keyCodeToScancode(keycode);
 }
 
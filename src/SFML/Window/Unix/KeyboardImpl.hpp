@@ -9,6 +9,12 @@
 #include <X11/Xlib.h> // XKeyEvent
 
 
+namespace sf
+{
+class InputSnapshot;
+} // namespace sf
+
+
 ////////////////////////////////////////////////////////////
 /// \brief sf::priv::KeyboardImpl helper
 ///
@@ -29,6 +35,18 @@ bool isKeyPressed(Keyboard::Key key);
 ////////////////////////////////////////////////////////////
 bool isKeyPressed(Keyboard::Scancode code);
 
+////////////////////////////////////////////////////////////
+/// \brief Store the state of every key and scancode in `snapshot`
+///
+/// The whole keyboard state is queried with a single
+/// `XQueryKeymap` round trip.
+///
+/// \param display  Connection to the X server
+/// \param snapshot Snapshot to update
+///
+////////////////////////////////////////////////////////////
+void captureKeyboardState(::Display& display, InputSnapshot& snapshot);
+
 ////////////////////////////////////////////////////////////
 /// \copydoc sf::Keyboard::localize
 ///
@@ -95,6 +95,21 @@ base::Optional<Event> WindowBase::waitEvent(Time timeout)
 }
 
 
+////////////////////////////////////////////////////////////
+base::SizeT WindowBase::drainEvents(const priv::EventCallback& callback)
+{
+    return m_impl->drainEvents(
+        [this, &callback](const Event& event)
+        {
+            // Cache the new size if needed
+            if (const auto* resized = event.getIf<Event::Resized>())
+                m_size = resized->size;
+
+            callback(event);
+        });
+}
+
+
 ////////////////////////////////////////////////////////////
 Vector2i WindowBase::getPosition() const
 {
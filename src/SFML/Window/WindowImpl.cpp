@@ -24,11 +24,11 @@
 #include "SFML/System/Time.hpp"
 
 #include "SFML/Base/EnumArray.hpp"
+#include "SFML/Base/Macros.hpp"
 #include "SFML/Base/Math/Fabs.hpp"
+#include "SFML/Base/RingBuffer.hpp"
 #include "SFML/Base/UniquePtr.hpp"
 
-#include <queue>
-
 
 namespace
 {
@@ -46,9 +46,9 @@ namespace sf::priv
 ////////////////////////////////////////////////////////////
 struct WindowImpl::Impl
 {
-    WindowContext*    windowContext;                                    //!< Associated window context
-    std::queue<Event> events;                                           //!< Queue of available events
-    JoystickState     joystickStates[Joystick::MaxCount]{};             //!< Previous state of the joysticks
+    WindowContext*          windowContext;                              //!< Associated window context
+    base::RingBuffer<Event> events{64u};                                //!< Queue of available events
+    JoystickState           joystickStates[Joystick::MaxCount]{};       //!< Previous state of the joysticks
     base::EnumArray<Sensor::Type, Vector3f, Sensor::Count> sensorValue; //!< Previous value of the sensors
     float joystickThreshold{0.1f}; //!< Joystick threshold (minimum motion for "move" event to be generated)
     base::EnumArray<Joystick::Axis, float, Joystick::AxisCount>
@@ -227,18 +227,42 @@ base::Optional<Event> WindowImpl::popEvent()
 
     if (!m_impl->events.empty())
     {
-        event.emplace(m_impl->events.front());
-        m_impl->events.pop();
+        event.emplace(SFML_BASE_MOVE(m_impl->events.front()));
+        m_impl->events.popFront();
     }
 
     return event;
 }
 
 
+////////////////////////////////////////////////////////////
+base::SizeT WindowImpl::drainEvents(const EventCallback& callback)
+{
+    // Check the OS only once, only the events pending now are delivered
+    if (m_impl->events.empty())
+        populateEventQueue();
+
+    const base::SizeT pendingCount = m_impl->events.size();
+    base::SizeT       count        = 0u;
+
+    // The callback may poll or push events, which moves or grows the ring buffer:
+    // take each event out of the queue before passing it on
+    for (; count < pendingCount && !m_impl->events.empty(); ++count)
+    {
+        const Event event = SFML_BASE_MOVE(m_impl->events.front());
+        m_impl->events.popFront();
+
+        callback(event);
+    }
+
+    return count;
+}
+
+
 ////////////////////////////////////////////////////////////
 void WindowImpl::pushEvent(const Event& event)
 {
-    m_impl->events.push(event);
+    m_impl->events.pushBack(event);
 }
 
 
@@ -5,6 +5,7 @@
 // Headers
 ////////////////////////////////////////////////////////////
 #include "SFML/Window/Event.hpp"
+#include "SFML/Window/WindowBase.hpp"
 #include "SFML/Window/WindowHandle.hpp"
 
 #include "SFML/System/Vector2.hpp"
@@ -12,6 +13,7 @@
 #include "SFML/Base/InPlacePImpl.hpp"
 #include "SFML/Base/IntTypes.hpp"
 #include "SFML/Base/Optional.hpp"
+#include "SFML/Base/SizeT.hpp"
 #include "SFML/Base/UniquePtr.hpp"
 
 
@@ -114,6 +116,21 @@ public:
     ////////////////////////////////////////////////////////////
     [[nodiscard]] base::Optional<Event> pollEvent();
 
+    ////////////////////////////////////////////////////////////
+    /// \brief Invoke `callback` on every pending event, emptying the event queue
+    ///
+    /// If there's no event available, this function calls the
+    /// window's internal event processing function once. Events
+    /// are removed from the queue one by one and passed to
+    /// `callback` in order, so `callback` may poll or push events.
+    ///
+    /// \param callback Function invoked for each event
+    ///
+    /// \return Number of events that were drained
+    ///
+    ////////////////////////////////////////////////////////////
+    base::SizeT drainEvents(const EventCallback& callback);
+
     ////////////////////////////////////////////////////////////
     /// \brief Get the OS-specific handle of the window
     ///
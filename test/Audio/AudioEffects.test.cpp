@@ -0,0 +1,281 @@
+#include "SFML/Audio/BiquadFilter.hpp"
+#include "SFML/Audio/Compressor.hpp"
+#include "SFML/Audio/Echo.hpp"
+#include "SFML/Audio/EffectChain.hpp"
+#include "SFML/Audio/FirFilter.hpp"
+#include "SFML/Audio/Reverb.hpp"
+
+#include "SFML/System/Time.hpp"
+
+#include "SFML/Base/Math/Fabs.hpp"
+#include "SFML/Base/Traits/IsBaseOf.hpp"
+
+#include <Doctest.hpp>
+
+#include <CommonTraits.hpp>
+
+static_assert(!SFML_BASE_IS_COPY_CONSTRUCTIBLE(sf::BiquadFilter));
+static_assert(!SFML_BASE_IS_COPY_ASSIGNABLE(sf::BiquadFilter));
+static_assert(!SFML_BASE_IS_COPY_CONSTRUCTIBLE(sf::EffectChain));
+static_assert(!SFML_BASE_IS_COPY_ASSIGNABLE(sf::EffectChain));
+static_assert(SFML_BASE_IS_BASE_OF(sf::AudioEffect, sf::Reverb));
+
+
+namespace
+{
+////////////////////////////////////////////////////////////
+class Scale : public sf::AudioEffect
+{
+public:
+    explicit Scale(float theFactor) : factor(theFactor)
+    {
+    }
+
+    void process(float* frames, unsigned int frameCount, unsigned int channelCount) override
+    {
+        for (unsigned int i = 0u; i < frameCount * channelCount; ++i)
+            frames[i] *= factor;
+    }
+
+    float factor;
+};
+
+
+////////////////////////////////////////////////////////////
+class Offset : public sf::AudioEffect
+{
+public:
+    void process(float* frames, unsigned int frameCount, unsigned int channelCount) override
+    {
+        for (unsigned int i = 0u; i < frameCount * channelCount; ++i)
+            frames[i] += 1.f;
+    }
+};
+
+} // namespace
+
+
+TEST_CASE("[Audio] sf::BiquadFilter")
+{
+    float frames[2 * 4096];
+
+    SECTION("Construction")
+    {
+        const sf::BiquadFilter filter(44'100u, sf::BiquadFilter::Type::Peaking, 1000.f, 2.f, 6.f);
+        CHECK(filter.getType() == sf::BiquadFilter::Type::Peaking);
+        CHECK(filter.getFrequency() == 1000.f);
+        CHECK(filter.getQ() == 2.f);
+        CHECK(filter.getGain() == 6.f);
+    }
+
+    SECTION("Low-pass keeps DC")
+    {
+        sf::BiquadFilter filter(44'100u, sf::BiquadFilter::Type::LowPass, 1000.f);
+
+        for (float& sample : frames)
+            sample = 0.5f;
+
+        filter.process(frames, 4096u, 2u);
+        CHECK(frames[2 * 4095] == doctest::Approx(0.5f).epsilon(0.001));
+        CHECK(frames[2 * 4095 + 1] == doctest::Approx(0.5f).epsilon(0.001));
+    }
+
+    SECTION("High-pass removes DC")
+    {
+        sf::BiquadFilter filter(44'100u, sf::BiquadFilter::Type::HighPass, 1000.f);
+
+        for (float& sample : frames)
+            sample = 0.5f;
+
+        filter.process(frames, 4096u, 2u);
+        CHECK(sf::base::fabs(frames[2 * 4095]) < 0.001f);
+        CHECK(sf::base::fabs(frames[2 * 4095 + 1]) < 0.001f);
+    }
+
+    SECTION("Channel count does not change the output")
+    {
+        sf::BiquadFilter mono(44'100u, sf::BiquadFilter::Type::Peaking, 1000.f, 2.f, 6.f);
+        sf::BiquadFilter quad(44'100u, sf::BiquadFilter::Type::Peaking, 1000.f, 2.f, 6.f);
+
+        float monoFrames[512];
+        float quadFrames[4 * 512];
+
+        for (unsigned int i = 0u; i < 512u; ++i)
+        {
+            monoFrames[i] = (i % 7u == 0u) ? 1.f : -0.25f;
+
+            for (unsigned int channel = 0u; channel < 4u; ++channel)
+                quadFrames[4u * i + channel] = monoFrames[i];
+        }
+
+        mono.process(monoFrames, 512u, 1u);
+        quad.process(quadFrames, 512u, 4u);
+
+        for (unsigned int i = 0u; i < 512u; ++i)
+            for (unsigned int channel = 0u; channel < 4u; ++channel)
+                CHECK(quadFrames[4u * i + channel] == doctest::Approx(monoFrames[i]).epsilon(0.0001));
+    }
+
+    SECTION("Parameter changes are ramped over one block")
+    {
+        // The DC gain of a low shelf is its gain, and the input is settled on the unity gain response
+        sf::BiquadFilter filter(44'100u, sf::BiquadFilter::Type::LowShelf, 10'000.f);
+
+        for (float& sample : frames)
+            sample = 1.f;
+
+        filter.process(frames, 4096u, 2u);
+        CHECK(frames[2 * 4095] == doctest::Approx(1.f).epsilon(0.001));
+
+        filter.setGain(12.f);
+
+        for (float& sample : frames)
+            sample = 1.f;
+
+        filter.process(frames, 4096u, 2u);
+        CHECK(frames[0] == doctest::Approx(1.f).epsilon(0.001));
+        CHECK(frames[1] == doctest::Approx(1.f).epsilon(0.001));
+        CHECK(frames[2 * 4095] == doctest::Approx(3.981f).epsilon(0.001));
+    }
+}
+
+
+TEST_CASE("[Audio] sf::Echo")
+{
+    sf::Echo echo(1000u, sf::seconds(1.f), 1u);
+    echo.setDelay(sf::milliseconds(10));
+    echo.setFeedback(0.5f);
+
+    CHECK(echo.getDelay() == sf::milliseconds(10));
+    CHECK(echo.getFeedback() == 0.5f);
+
+    float frames[64]{};
+    frames[0] = 1.f;
+
+    echo.process(frames, 64u, 1u);
+
+    CHECK(frames[0] == 1.f);
+    CHECK(frames[10] == 0.5f);
+    CHECK(frames[20] == 0.25f);
+    CHECK(frames[5] == 0.f);
+
+    SECTION("More channels than configured are bypassed")
+    {
+        float stereo[4]{1.f, 1.f, 1.f, 1.f};
+        echo.process(stereo, 2u, 2u);
+        CHECK(stereo[3] == 1.f);
+    }
+}
+
+
+TEST_CASE("[Audio] sf::Reverb")
+{
+    sf::Reverb reverb(48'000u);
+    reverb.setWet(0.f);
+
+    float frames[256];
+
+    for (float& sample : frames)
+        sample = 0.25f;
+
+    reverb.process(frames, 128u, 2u);
+
+    for (const float sample : frames)
+        CHECK(sample == 0.25f);
+}
+
+
+TEST_CASE("[Audio] sf::Compressor")
+{
+    sf::Compressor compressor(44'100u);
+    compressor.setThreshold(-20.f);
+    compressor.setRatio(100.f);
+    compressor.setAttack(sf::Time::Zero);
+
+    CHECK(compressor.getGainReduction() == 0.f);
+
+    float frames[2 * 2048];
+
+    for (float& sample : frames)
+        sample = 1.f;
+
+    compressor.process(frames, 2048u, 2u);
+
+    // A limiter at -20 dB brings a full scale signal down to ~0.1
+    CHECK(frames[2 * 2047] == doctest::Approx(0.1f).epsilon(0.05));
+    CHECK(compressor.getGainReduction() < -19.f);
+}
+
+
+TEST_CASE("[Audio] sf::FirFilter")
+{
+    const float   taps[]{0.5f, 0.25f, 0.125f, 1.f, -1.f};
+    sf::FirFilter filter(taps);
+
+    CHECK(filter.getTapCount() == 5u);
+    CHECK(filter.getGain() == 1.f);
+
+    float frames[2 * 8]{};
+    frames[0] = 1.f;
+    frames[1] = 2.f;
+
+    filter.process(frames, 8u, 2u);
+
+    for (unsigned int i = 0u; i < 5u; ++i)
+    {
+        CHECK(frames[2 * i] == taps[i]);
+        CHECK(frames[2 * i + 1] == 2.f * taps[i]);
+    }
+
+    CHECK(frames[2 * 5] == 0.f);
+}
+
+
+TEST_CASE("[Audio] sf::EffectChain")
+{
+    Scale           scale(2.f);
+    Offset          offset;
+    sf::EffectChain chain;
+
+    CHECK(chain.getEffectCount() == 0u);
+    CHECK(chain.add(scale));
+    CHECK(chain.add(offset));
+    CHECK(chain.getEffectCount() == 2u);
+    CHECK(chain.isEnabled(0u));
+
+    float frames[2]{1.f, 2.f};
+
+    SECTION("Effects run in order")
+    {
+        chain.process(frames, 1u, 2u);
+        CHECK(frames[0] == 3.f);
+        CHECK(frames[1] == 5.f);
+    }
+
+    SECTION("Disabled effects are skipped")
+    {
+        chain.setEnabled(1u, false);
+        chain.process(frames, 1u, 2u);
+        CHECK(frames[0] == 2.f);
+        CHECK(frames[1] == 4.f);
+    }
+
+    SECTION("Effect processor")
+    {
+        auto processor = chain.makeEffectProcessor();
+
+        float        output[2]{-1.f, -1.f};
+        unsigned int inCount  = 1u;
+        unsigned int outCount = 1u;
+
+        processor(frames, inCount, output, outCount, 2u);
+        CHECK(output[0] == 3.f);
+        CHECK(output[1] == 5.f);
+        CHECK(inCount == 1u);
+        CHECK(outCount == 1u);
+
+        processor(nullptr, inCount, output, outCount, 2u);
+        CHECK(output[0] == 1.f);
+        CHECK(output[1] == 1.f);
+    }
+}
@@ -0,0 +1,117 @@
+#include "SFML/Audio/SoundBus.hpp"
+
+#include "SFML/Audio/AudioContext.hpp"
+#include "SFML/Audio/PlaybackDevice.hpp"
+
+// Other 1st party headers
+#include "SFML/Audio/EffectProcessor.hpp"
+#include "SFML/Audio/Sound.hpp"
+#include "SFML/Audio/SoundBuffer.hpp"
+
+#include "SFML/System/Path.hpp"
+
+#include "SFML/Base/StringView.hpp"
+
+#include <Doctest.hpp>
+
+#include <AudioUtil.hpp>
+#include <CommonTraits.hpp>
+
+
+TEST_CASE("[Audio] sf::SoundBus" * doctest::skip(skipAudioDeviceTests))
+{
+    auto audioContext   = sf::AudioContext::create().value();
+    auto playbackDevice = sf::PlaybackDevice::createDefault(audioContext).value();
+
+    SECTION("Type traits")
+    {
+        STATIC_CHECK(!SFML_BASE_IS_COPY_CONSTRUCTIBLE(sf::SoundBus));
+        STATIC_CHECK(!SFML_BASE_IS_COPY_ASSIGNABLE(sf::SoundBus));
+        STATIC_CHECK(!SFML_BASE_IS_MOVE_CONSTRUCTIBLE(sf::SoundBus));
+        STATIC_CHECK(!SFML_BASE_IS_MOVE_ASSIGNABLE(sf::SoundBus));
+    }
+
+    SECTION("Create and find")
+    {
+        sf::SoundBus* sfx = playbackDevice.createBus("sfx");
+        REQUIRE(sfx != nullptr);
+        CHECK(sfx->getName() == sf::base::StringView{"sfx"});
+        CHECK(sfx->getParent() == nullptr);
+        CHECK(sfx->getVolume() == 100.f);
+        CHECK(!sfx->getEffectProcessor());
+
+        sf::SoundBus* footsteps = playbackDevice.createBus("footsteps", sfx);
+        REQUIRE(footsteps != nullptr);
+        CHECK(footsteps->getParent() == sfx);
+
+        CHECK(playbackDevice.findBus("sfx") == sfx);
+        CHECK(playbackDevice.findBus("footsteps") == footsteps);
+        CHECK(playbackDevice.findBus("music") == nullptr);
+
+        // Names are unique per device
+        CHECK(playbackDevice.createBus("sfx") == nullptr);
+    }
+
+    SECTION("Volume and effect processor")
+    {
+        sf::SoundBus* bus = playbackDevice.createBus("bus");
+        REQUIRE(bus != nullptr);
+
+        bus->setVolume(50.f);
+        CHECK(bus->getVolume() == doctest::Approx(50.f));
+
+        bus->setEffectProcessor([](const float*, unsigned int&, float*, unsigned int&, unsigned int) {});
+        CHECK(bus->getEffectProcessor());
+
+        bus->setEffectProcessor(sf::EffectProcessor{});
+        CHECK(!bus->getEffectProcessor());
+    }
+
+    SECTION("Route sound")
+    {
+        sf::SoundBus* bus = playbackDevice.createBus("bus");
+        REQUIRE(bus != nullptr);
+
+        const auto soundBuffer = sf::SoundBuffer::loadFromFile("Audio/ding.flac").value();
+        sf::Sound  sound(soundBuffer);
+        CHECK(sound.getBus() == nullptr);
+
+        sound.setBus(bus);
+        CHECK(sound.getBus() == bus);
+
+        sound.play(playbackDevice);
+        sound.setBus(nullptr);
+        CHECK(sound.getBus() == nullptr);
+
+        const sf::Sound soundCopy(sound); // NOLINT(performance-unnecessary-copy-initialization)
+        CHECK(soundCopy.getBus() == nullptr);
+    }
+
+    SECTION("Transfer to another playback device")
+    {
+        auto otherPlaybackDevice = sf::PlaybackDevice::createDefault(audioContext).value();
+
+        sf::SoundBus* bus      = playbackDevice.createBus("bus");
+        sf::SoundBus* otherBus = otherPlaybackDevice.createBus("bus");
+        REQUIRE(bus != nullptr);
+        REQUIRE(otherBus != nullptr);
+
+        sf::SoundBus* music = playbackDevice.createBus("music");
+        REQUIRE(music != nullptr);
+
+        const auto soundBuffer = sf::SoundBuffer::loadFromFile("Audio/ding.flac").value();
+        sf::Sound  sound(soundBuffer);
+        sf::Sound  otherSound(soundBuffer);
+
+        sound.setBus(bus);
+        sound.play(playbackDevice);
+
+        otherSound.setBus(music);
+        otherSound.play(playbackDevice);
+
+        // Sounds follow the bus with the same name, if any
+        playbackDevice.transferResourcesTo(otherPlaybackDevice);
+        CHECK(sound.getBus() == otherBus);
+        CHECK(otherSound.getBus() == nullptr);
+    }
+}
@@ -1,5 +1,7 @@
 #include "SFML/Audio/SoundRecorder.hpp"
 
+#include <Doctest.hpp>
+
 #include <CommonTraits.hpp>
 
 static_assert(!SFML_BASE_IS_CONSTRUCTIBLE(sf::SoundRecorder));
@@ -7,3 +9,43 @@ static_assert(!SFML_BASE_IS_COPY_CONSTRUCTIBLE(sf::SoundRecorder));
 static_assert(!SFML_BASE_IS_COPY_ASSIGNABLE(sf::SoundRecorder));
 static_assert(!SFML_BASE_IS_NOTHROW_MOVE_CONSTRUCTIBLE(sf::SoundRecorder));
 static_assert(!SFML_BASE_IS_NOTHROW_MOVE_ASSIGNABLE(sf::SoundRecorder));
+
+
+namespace
+{
+////////////////////////////////////////////////////////////
+class TestSoundRecorder : public sf::SoundRecorder
+{
+    [[nodiscard]] bool onProcessSamples(const sf::base::I16*, sf::base::SizeT) override
+    {
+        return true;
+    }
+};
+
+
+////////////////////////////////////////////////////////////
+TEST_CASE("[Audio] sf::SoundRecorder")
+{
+    TestSoundRecorder recorder;
+
+    SECTION("Defaults")
+    {
+        CHECK(recorder.getProcessingMode() == sf::SoundRecorder::ProcessingMode::Thread);
+        CHECK(recorder.getBlockSize() == 512u);
+    }
+
+    SECTION("Set processing mode")
+    {
+        recorder.setProcessingMode(sf::SoundRecorder::ProcessingMode::Poll);
+        CHECK(recorder.getProcessingMode() == sf::SoundRecorder::ProcessingMode::Poll);
+        CHECK(!recorder.poll()); // Not capturing
+    }
+
+    SECTION("Set block size")
+    {
+        recorder.setBlockSize(1024u);
+        CHECK(recorder.getBlockSize() == 1024u);
+    }
+}
+
+} // namespace
@@ -2,6 +2,8 @@
 
 #include <Doctest.hpp>
 
+#include <algorithm>
+#include <random>
 #include <vector>
 
 
@@ -87,4 +89,46 @@ TEST_CASE("[Base] Base/Algorithm.hpp")
         CHECK(sf::base::exchange(a, b) == 0);
         CHECK(a == 1);
     }
+
+    SECTION("Sort")
+    {
+        std::minstd_rand rng(42u);
+
+        for (const int size : {0, 1, 2, 3, 16, 17, 100, 1000, 10'000})
+        {
+            std::vector<int> values(static_cast<std::size_t>(size));
+
+            for (int& value : values)
+                value = static_cast<int>(rng() % 100u); // Many duplicates
+
+            std::vector<int> expected = values;
+            std::sort(expected.begin(), expected.end());
+
+            sf::base::sort(values.data(), values.data() + values.size());
+            CHECK(values == expected);
+
+            // Already sorted, reversed and all equal inputs
+            sf::base::sort(values.begin(), values.end());
+            CHECK(values == expected);
+
+            sf::base::sort(values.begin(), values.end(), [](int a, int b) { return a > b; });
+            CHECK(std::is_sorted(values.rbegin(), values.rend()));
+
+            std::fill(values.begin(), values.end(), 7);
+            sf::base::sort(values.begin(), values.end());
+            CHECK(std::count(values.begin(), values.end(), 7) == size);
+        }
+
+        SECTION("Adversarial input")
+        {
+            // Organ pipe, a pattern that degrades median of three quicksort without the heapsort fallback
+            std::vector<int> values(20'000);
+
+            for (std::size_t i = 0; i < values.size(); ++i)
+                values[i] = static_cast<int>(i < values.size() / 2 ? i : values.size() - i);
+
+            sf::base::sort(values.begin(), values.end());
+            CHECK(std::is_sorted(values.begin(), values.end()));
+        }
+    }
 }
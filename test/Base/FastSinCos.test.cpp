@@ -2,35 +2,113 @@
 
 #include "SFML/Base/Constants.hpp"
 
+#include <Doctest.hpp>
 
-////////////////////////////////////////////////////////////
-static_assert(sizeof(float) == 4);
+#include <cmath>
 
 
 ////////////////////////////////////////////////////////////
-static_assert(sf::base::priv::radToIndex >= 10430.0f);
-static_assert(sf::base::priv::radToIndex <= 10430.9f);
+static_assert(sizeof(float) == 4);
 
 
 ////////////////////////////////////////////////////////////
 static_assert(sf::base::fastSin(sf::base::halfPi * 0.f) == 0.f);
-static_assert(sf::base::fastSin(sf::base::halfPi * 0.5f) == 0.70710678118f);
 static_assert(sf::base::fastSin(sf::base::halfPi * 1.f) == 1.f);
-static_assert(sf::base::fastSin(sf::base::halfPi * 1.5f) == 0.70710678118f);
 static_assert(sf::base::fastSin(sf::base::halfPi * 2.f) == 0.f);
-static_assert(sf::base::fastSin(sf::base::halfPi * 2.5f) == -0.70710678118f);
 static_assert(sf::base::fastSin(sf::base::halfPi * 3.f) == -1.f);
-static_assert(sf::base::fastSin(sf::base::halfPi * 3.5f) == -0.70710678118f);
 static_assert(sf::base::fastSin(sf::base::halfPi * 4.f) == 0.f);
+static_assert(sf::base::fastSin(sf::base::halfPi * -1.f) == -1.f);
 
 
 ////////////////////////////////////////////////////////////
 static_assert(sf::base::fastCos(sf::base::halfPi * 0.f) == 1.f);
-static_assert(sf::base::fastCos(sf::base::halfPi * 0.5f) == 0.70710678118f);
 static_assert(sf::base::fastCos(sf::base::halfPi * 1.f) == 0.f);
-static_assert(sf::base::fastCos(sf::base::halfPi * 1.5f) == -0.70710678118f);
 static_assert(sf::base::fastCos(sf::base::halfPi * 2.f) == -1.f);
-static_assert(sf::base::fastCos(sf::base::halfPi * 2.5f) == -0.70710678118f);
 static_assert(sf::base::fastCos(sf::base::halfPi * 3.f) == 0.f);
-static_assert(sf::base::fastCos(sf::base::halfPi * 3.5f) == 0.70710678118f);
 static_assert(sf::base::fastCos(sf::base::halfPi * 4.f) == 1.f);
+static_assert(sf::base::fastCos(sf::base::halfPi * -2.f) == -1.f);
+
+
+TEST_CASE("[Base] Base/FastSinCos.hpp")
+{
+    SECTION("Accuracy")
+    {
+        // Dense sweep over two full turns in both directions, compared to the double precision functions
+        constexpr int sampleCount = 1'000'000;
+
+        double maxSinError = 0.;
+        double maxCosError = 0.;
+        bool   consistent  = true;
+
+        for (int i = 0; i <= sampleCount; ++i)
+        {
+            const float radians = -sf::base::tau * 2.f + sf::base::tau * 4.f * static_cast<float>(i) / sampleCount;
+
+            const auto [sine, cosine] = sf::base::fastSinCos(radians);
+
+            consistent &= sine == sf::base::fastSin(radians) && cosine == sf::base::fastCos(radians);
+
+            maxSinError = std::fmax(maxSinError, std::fabs(sine - std::sin(static_cast<double>(radians))));
+            maxCosError = std::fmax(maxCosError, std::fabs(cosine - std::cos(static_cast<double>(radians))));
+        }
+
+        CHECK(consistent);
+
+        // Beyond `tau`, the bulk of the error comes from `halfPi` being a rounded float
+        CHECK(maxSinError < 1e-6);
+        CHECK(maxCosError < 1e-6);
+
+        double maxErrorOneTurn = 0.;
+
+        for (int i = 0; i <= sampleCount; ++i)
+        {
+            const float radians = -sf::base::tau + sf::base::tau * 2.f * static_cast<float>(i) / sampleCount;
+
+            const auto [sine, cosine] = sf::base::fastSinCos(radians);
+
+            maxErrorOneTurn = std::fmax(maxErrorOneTurn, std::fabs(sine - std::sin(static_cast<double>(radians))));
+            maxErrorOneTurn = std::fmax(maxErrorOneTurn, std::fabs(cosine - std::cos(static_cast<double>(radians))));
+        }
+
+        CHECK(maxErrorOneTurn < 2.5e-7);
+    }
+
+    SECTION("Diagonals")
+    {
+        CHECK(sf::base::fastSin(sf::base::halfPi * 0.5f) == doctest::Approx(0.70710678118).epsilon(1e-6));
+        CHECK(sf::base::fastCos(sf::base::halfPi * 2.5f) == doctest::Approx(-0.70710678118).epsilon(1e-6));
+        CHECK(sf::base::fastSin(sf::base::halfPi * -3.5f) == doctest::Approx(0.70710678118).epsilon(1e-6));
+    }
+
+    SECTION("Batches match the scalar functions")
+    {
+        float radians[8]{};
+        float sines[8]{};
+        float cosines[8]{};
+
+        for (int i = -2000; i < 2000; i += 8)
+        {
+            for (int j = 0; j < 8; ++j)
+                radians[j] = static_cast<float>(i + j) * 0.01f;
+
+            // Include exact multiples of `halfPi` and ties of the quadrant rounding
+            if (i == 0)
+            {
+                radians[1] = sf::base::halfPi;
+                radians[2] = sf::base::halfPi * -3.f;
+                radians[3] = sf::base::halfPi * 0.5f;
+                radians[4] = sf::base::halfPi * -2.5f;
+            }
+
+            sf::base::fastSinCos8(radians, sines, cosines);
+
+            for (int j = 0; j < 8; ++j)
+            {
+                const auto [sine, cosine] = sf::base::fastSinCos(radians[j]);
+
+                CHECK(sines[j] == sine);
+                CHECK(cosines[j] == cosine);
+            }
+        }
+    }
+}
@@ -0,0 +1,170 @@
+#include "SFML/Base/RadixSort.hpp"
+
+#include "SFML/Base/IntTypes.hpp"
+#include "SFML/Base/TrivialVector.hpp"
+
+#include <Doctest.hpp>
+
+#include <AllocationCounter.hpp>
+
+#include <algorithm>
+#include <limits>
+#include <random>
+#include <type_traits>
+#include <vector>
+
+#include <cmath>
+
+
+namespace
+{
+template <typename TKey>
+std::vector<TKey> makeKeys(std::minstd_rand& rng, std::size_t count)
+{
+    std::vector<TKey> keys(count);
+
+    if constexpr (std::is_floating_point_v<TKey>)
+    {
+        std::uniform_real_distribution<TKey> distribution(-1000, 1000);
+
+        for (TKey& key : keys)
+            key = distribution(rng);
+    }
+    else
+    {
+        using Wide = std::conditional_t<std::is_signed_v<TKey>, long long, unsigned long long>;
+
+        std::uniform_int_distribution<Wide> distribution(std::numeric_limits<TKey>::min(),
+                                                         std::numeric_limits<TKey>::max());
+
+        for (TKey& key : keys)
+            key = static_cast<TKey>(distribution(rng));
+    }
+
+    return keys;
+}
+
+template <typename TKey>
+void checkSortKeys(sf::base::RadixSorter& sorter, std::minstd_rand& rng)
+{
+    for (const std::size_t count : {0u, 1u, 2u, 50u, 64u, 65u, 1000u, 5000u})
+    {
+        std::vector<TKey> keys     = makeKeys<TKey>(rng, count);
+        std::vector<TKey> expected = keys;
+        std::sort(expected.begin(), expected.end());
+
+        sorter.sortKeys(keys.data(), keys.size());
+        CHECK(keys == expected);
+    }
+}
+} // namespace
+
+
+TEST_CASE("[Base] Base/RadixSort.hpp")
+{
+    std::minstd_rand      rng(42u);
+    sf::base::RadixSorter sorter;
+
+    SECTION("Key types")
+    {
+        checkSortKeys<float>(sorter, rng);
+        checkSortKeys<double>(sorter, rng);
+        checkSortKeys<sf::base::I8>(sorter, rng);
+        checkSortKeys<sf::base::U16>(sorter, rng);
+        checkSortKeys<sf::base::I32>(sorter, rng);
+        checkSortKeys<sf::base::U32>(sorter, rng);
+        checkSortKeys<sf::base::I64>(sorter, rng);
+        checkSortKeys<sf::base::U64>(sorter, rng);
+    }
+
+    SECTION("Special floats")
+    {
+        constexpr float infinity = std::numeric_limits<float>::infinity();
+
+        for (const std::size_t count : {8u, 200u})
+        {
+            std::vector<float> keys;
+
+            for (std::size_t i = 0; i < count / 8; ++i)
+                keys.insert(keys.end(), {1.f, -0.f, infinity, -1.f, 0.f, -infinity, 1e-40f, -1e-40f});
+
+            sorter.sortKeys(keys.data(), keys.size());
+
+            CHECK(std::is_sorted(keys.begin(), keys.end()));
+            CHECK(std::signbit(keys[count / 8 * 3])); // -0 before +0
+            CHECK(!std::signbit(keys[count / 8 * 4]));
+        }
+    }
+
+    SECTION("Pairs are sorted stably")
+    {
+        for (const std::size_t count : {40u, 3000u})
+        {
+            struct Value
+            {
+                int   originalIndex;
+                float payload;
+            };
+
+            std::vector<sf::base::I32> keys(count);
+            std::vector<Value>         values(count);
+
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                keys[i]   = static_cast<sf::base::I32>(rng() % 16u) - 8; // Many equal keys
+                values[i] = {static_cast<int>(i), static_cast<float>(keys[i])};
+            }
+
+            sorter.sortPairs(keys.data(), values.data(), count);
+
+            bool sorted = true;
+
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                sorted &= values[i].payload == static_cast<float>(keys[i]);
+
+                if (i > 0)
+                    sorted &= keys[i - 1] < keys[i] ||
+                              (keys[i - 1] == keys[i] && values[i - 1].originalIndex < values[i].originalIndex);
+            }
+
+            CHECK(sorted);
+        }
+    }
+
+    SECTION("Indices")
+    {
+        const std::vector<float> keys = makeKeys<float>(rng, 1000);
+
+        sf::base::TrivialVector<sf::base::U32> indices(keys.size());
+        sorter.sortIndices(keys.data(), indices.data(), keys.size());
+
+        bool sorted = true;
+        for (std::size_t i = 1; i < keys.size(); ++i)
+            sorted &= keys[indices[i - 1]] <= keys[indices[i]];
+
+        CHECK(sorted);
+
+        // Every index exactly once
+        std::vector<sf::base::U32> sortedIndices(indices.begin(), indices.end());
+        std::sort(sortedIndices.begin(), sortedIndices.end());
+
+        CHECK(std::adjacent_find(sortedIndices.begin(), sortedIndices.end()) == sortedIndices.end());
+        CHECK(sortedIndices.back() == keys.size() - 1);
+    }
+
+    SECTION("No allocation after warm-up")
+    {
+        std::vector<float>         keys = makeKeys<float>(rng, 10'000);
+        std::vector<sf::base::U32> values(keys.size());
+
+        sorter.sortPairs(keys.data(), values.data(), keys.size());
+
+        const sf::base::SizeT allocationsBefore = getAllocationCount();
+
+        for (int i = 0; i < 10; ++i)
+            sorter.sortPairs(keys.data(), values.data(), keys.size() - static_cast<std::size_t>(i) * 100u);
+
+        CHECK(getAllocationCount() == allocationsBefore);
+    }
+}
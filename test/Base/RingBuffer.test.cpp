@@ -0,0 +1,175 @@
+#include "SFML/Base/RingBuffer.hpp"
+
+#include "SFML/Base/Macros.hpp"
+#include "SFML/Base/SizeT.hpp"
+#include "SFML/Base/Traits/IsCopyAssignable.hpp"
+#include "SFML/Base/Traits/IsCopyConstructible.hpp"
+#include "SFML/Base/Traits/IsNothrowMoveAssignable.hpp"
+#include "SFML/Base/Traits/IsNothrowMoveConstructible.hpp"
+
+#include <Doctest.hpp>
+
+#include <AllocationCounter.hpp>
+
+#include <string>
+
+
+namespace
+{
+////////////////////////////////////////////////////////////
+struct Tracked
+{
+    explicit Tracked(int theValue, int& theLiveCount) : value(theValue), liveCount(&theLiveCount)
+    {
+        ++*liveCount;
+    }
+
+    Tracked(const Tracked& rhs) : value(rhs.value), liveCount(rhs.liveCount)
+    {
+        ++*liveCount;
+    }
+
+    Tracked(Tracked&& rhs) noexcept : value(rhs.value), liveCount(rhs.liveCount)
+    {
+        ++*liveCount;
+    }
+
+    Tracked& operator=(const Tracked&) = delete;
+    Tracked& operator=(Tracked&&)      = delete;
+
+    ~Tracked()
+    {
+        --*liveCount;
+    }
+
+    int  value;
+    int* liveCount;
+};
+
+
+TEST_CASE("[Base] Base/RingBuffer.hpp")
+{
+    SECTION("Type traits")
+    {
+        STATIC_CHECK(!SFML_BASE_IS_COPY_CONSTRUCTIBLE(sf::base::RingBuffer<int>));
+        STATIC_CHECK(!SFML_BASE_IS_COPY_ASSIGNABLE(sf::base::RingBuffer<int>));
+        STATIC_CHECK(SFML_BASE_IS_NOTHROW_MOVE_CONSTRUCTIBLE(sf::base::RingBuffer<int>));
+        STATIC_CHECK(SFML_BASE_IS_NOTHROW_MOVE_ASSIGNABLE(sf::base::RingBuffer<int>));
+    }
+
+    SECTION("Empty")
+    {
+        const sf::base::RingBuffer<int> rb;
+        CHECK(rb.empty());
+        CHECK(rb.size() == 0u);
+        CHECK(rb.capacity() == 0u);
+    }
+
+    SECTION("Initial capacity is rounded up to a power of two")
+    {
+        const sf::base::RingBuffer<int> rb(20u);
+        CHECK(rb.empty());
+        CHECK(rb.capacity() == 32u);
+    }
+
+    SECTION("FIFO order")
+    {
+        sf::base::RingBuffer<int> rb;
+
+        for (int i = 0; i < 5; ++i)
+            rb.pushBack(i);
+
+        CHECK(rb.size() == 5u);
+        CHECK(rb.front() == 0);
+        CHECK(rb.back() == 4);
+        CHECK(rb[2] == 2);
+
+        rb.popFront();
+        rb.popFront();
+        CHECK(rb.size() == 3u);
+        CHECK(rb.front() == 2);
+
+        rb.emplaceBack(5);
+        CHECK(rb.back() == 5);
+    }
+
+    SECTION("Growth preserves order across the wrap-around point")
+    {
+        sf::base::RingBuffer<std::string> rb(8u);
+
+        // Move the head forward so that the contents wrap around
+        for (int i = 0; i < 6; ++i)
+            rb.pushBack(std::to_string(i));
+
+        for (int i = 0; i < 6; ++i)
+            rb.popFront();
+
+        for (int i = 0; i < 20; ++i)
+            rb.pushBack(std::to_string(i));
+
+        CHECK(rb.size() == 20u);
+        CHECK(rb.capacity() == 32u);
+
+        for (int i = 0; i < 20; ++i)
+        {
+            CHECK(rb.front() == std::to_string(i));
+            rb.popFront();
+        }
+
+        CHECK(rb.empty());
+    }
+
+    SECTION("Items are destroyed exactly once")
+    {
+        int liveCount = 0;
+
+        {
+            sf::base::RingBuffer<Tracked> rb;
+
+            for (int i = 0; i < 40; ++i)
+                rb.emplaceBack(i, liveCount);
+
+            CHECK(liveCount == 40);
+
+            for (int i = 0; i < 10; ++i)
+                rb.popFront();
+
+            CHECK(liveCount == 30);
+            CHECK(rb.front().value == 10);
+
+            sf::base::RingBuffer<Tracked> moved(SFML_BASE_MOVE(rb));
+            CHECK(rb.empty()); // NOLINT(bugprone-use-after-move)
+            CHECK(moved.size() == 30u);
+            CHECK(liveCount == 30);
+
+            moved.clear();
+            CHECK(liveCount == 0);
+
+            moved.emplaceBack(0, liveCount);
+        }
+
+        CHECK(liveCount == 0);
+    }
+
+    SECTION("Steady-state pushing and popping does not allocate")
+    {
+        sf::base::RingBuffer<std::string> rb(64u);
+
+        const sf::base::SizeT allocationsBefore = getAllocationCount();
+
+        // Strings short enough to fit in the small string buffer
+        for (int round = 0; round < 1000; ++round)
+        {
+            for (int i = 0; i < 50; ++i)
+                rb.emplaceBack("event");
+
+            while (!rb.empty())
+                rb.popFront();
+        }
+
+        CHECK(getAllocationCount() == allocationsBefore);
+        CHECK(rb.capacity() == 64u);
+    }
+}
+
+} // namespace
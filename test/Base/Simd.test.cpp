@@ -0,0 +1,54 @@
+#include "SFML/Base/Simd.hpp"
+
+#include <Doctest.hpp>
+
+
+TEST_CASE("[Base] Base/Simd.hpp")
+{
+    const float a[4]{1.f, -2.f, 3.f, -4.f};
+    const float b[4]{0.5f, 0.5f, 2.f, 2.f};
+
+    const auto check = [](const sf::base::F32x4 x, const float (&expected)[4])
+    {
+        float result[4];
+        x.store(result);
+
+        for (int i = 0; i < 4; ++i)
+            CHECK(result[i] == expected[i]);
+    };
+
+    SECTION("Load and store")
+    {
+        check(sf::base::F32x4::load(a), {1.f, -2.f, 3.f, -4.f});
+        check(sf::base::F32x4::broadcast(7.f), {7.f, 7.f, 7.f, 7.f});
+        check(sf::base::F32x4::zero(), {0.f, 0.f, 0.f, 0.f});
+    }
+
+    SECTION("Arithmetic")
+    {
+        const auto x = sf::base::F32x4::load(a);
+        const auto y = sf::base::F32x4::load(b);
+
+        check(x + y, {1.5f, -1.5f, 5.f, -2.f});
+        check(x - y, {0.5f, -2.5f, 1.f, -6.f});
+        check(x * y, {0.5f, -1.f, 6.f, -8.f});
+        check(sf::base::F32x4::mulAdd(x, y, sf::base::F32x4::broadcast(1.f)), {1.5f, 0.f, 7.f, -7.f});
+    }
+
+    SECTION("Min, max and abs")
+    {
+        const auto x = sf::base::F32x4::load(a);
+        const auto y = sf::base::F32x4::load(b);
+
+        check(sf::base::F32x4::min(x, y), {0.5f, -2.f, 2.f, -4.f});
+        check(sf::base::F32x4::max(x, y), {1.f, 0.5f, 3.f, 2.f});
+        check(sf::base::F32x4::abs(x), {1.f, 2.f, 3.f, 4.f});
+    }
+
+    SECTION("Horizontal reductions")
+    {
+        CHECK(sf::base::F32x4::load(a).horizontalSum() == -2.f);
+        CHECK(sf::base::F32x4::load(a).horizontalMax() == 3.f);
+        CHECK(sf::base::F32x4::load(b).horizontalMax() == 2.f);
+    }
+}
@@ -0,0 +1,133 @@
+#include "SFML/Base/SpscQueue.hpp"
+
+#include "SFML/Base/Traits/IsCopyAssignable.hpp"
+#include "SFML/Base/Traits/IsCopyConstructible.hpp"
+
+#include <Doctest.hpp>
+
+#include <thread>
+
+
+namespace
+{
+TEST_CASE("[Base] Base/SpscQueue.hpp")
+{
+    SECTION("Type traits")
+    {
+        STATIC_CHECK(!SFML_BASE_IS_COPY_CONSTRUCTIBLE(sf::base::SpscQueue<int, 8>));
+        STATIC_CHECK(!SFML_BASE_IS_COPY_ASSIGNABLE(sf::base::SpscQueue<int, 8>));
+        STATIC_CHECK(sf::base::SpscQueue<int, 8>::capacity() == 8u);
+    }
+
+    SECTION("Empty")
+    {
+        sf::base::SpscQueue<int, 4> queue;
+        CHECK(queue.empty());
+        CHECK(queue.size() == 0u);
+
+        int item = -1;
+        CHECK(!queue.tryPop(item));
+        CHECK(item == -1);
+    }
+
+    SECTION("FIFO order and full queue")
+    {
+        sf::base::SpscQueue<int, 4> queue;
+
+        for (int i = 0; i < 4; ++i)
+            CHECK(queue.tryPush(i));
+
+        CHECK(queue.size() == 4u);
+        CHECK(!queue.tryPush(4));
+
+        int item = -1;
+        CHECK(queue.tryPop(item));
+        CHECK(item == 0);
+        CHECK(queue.tryPush(4));
+
+        for (int i = 1; i < 5; ++i)
+        {
+            CHECK(queue.tryPop(item));
+            CHECK(item == i);
+        }
+
+        CHECK(queue.empty());
+    }
+
+    SECTION("Bulk push and pop")
+    {
+        sf::base::SpscQueue<int, 8> queue;
+
+        const int items[6]{0, 1, 2, 3, 4, 5};
+        CHECK(queue.tryPushBulk(items, 6u) == 6u);
+        CHECK(queue.tryPushBulk(items, 6u) == 2u); // Only two slots left
+        CHECK(queue.size() == 8u);
+
+        int popped[8]{};
+        CHECK(queue.tryPopBulk(popped, 5u) == 5u);
+        CHECK(popped[0] == 0);
+        CHECK(popped[4] == 4);
+
+        // Wraps around the end of the storage
+        CHECK(queue.tryPushBulk(items, 4u) == 4u);
+        CHECK(queue.tryPopBulk(popped, 8u) == 7u);
+
+        const int expected[7]{5, 0, 1, 0, 1, 2, 3};
+        for (int i = 0; i < 7; ++i)
+            CHECK(popped[i] == expected[i]);
+
+        CHECK(queue.empty());
+        CHECK(queue.tryPopBulk(popped, 8u) == 0u);
+    }
+
+    SECTION("Discard all")
+    {
+        sf::base::SpscQueue<int, 4> queue;
+
+        CHECK(queue.tryPush(1));
+        CHECK(queue.tryPush(2));
+
+        queue.discardAll();
+        CHECK(queue.empty());
+        CHECK(queue.tryPush(3));
+    }
+
+    SECTION("Concurrent producer and consumer")
+    {
+        sf::base::SpscQueue<unsigned int, 64> queue;
+
+        constexpr unsigned int count = 100'000u;
+
+        std::thread producer(
+            [&queue]
+            {
+                for (unsigned int i = 0u; i < count; ++i)
+                    while (!queue.tryPush(i))
+                        std::this_thread::yield();
+            });
+
+        unsigned int expected   = 0u;
+        bool         allInOrder = true;
+
+        while (expected < count)
+        {
+            unsigned int item = 0u;
+
+            if (!queue.tryPop(item))
+            {
+                std::this_thread::yield();
+                continue;
+            }
+
+            allInOrder &= (item == expected);
+            ++expected;
+        }
+
+        producer.join();
+
+        CHECK(allInOrder);
+        CHECK(queue.empty());
+    }
+}
+
+} // namespace
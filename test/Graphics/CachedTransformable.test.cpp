@@ -0,0 +1,151 @@
+#include "SFML/Graphics/CachedTransformable.hpp"
+
+#include <Doctest.hpp>
+
+#include <CommonTraits.hpp>
+#include <GraphicsUtil.hpp>
+
+#include <vector>
+
+
+TEST_CASE("[Graphics] sf::CachedTransformable")
+{
+    SECTION("Type traits")
+    {
+        STATIC_CHECK(SFML_BASE_IS_COPY_CONSTRUCTIBLE(sf::CachedTransformable));
+        STATIC_CHECK(SFML_BASE_IS_COPY_ASSIGNABLE(sf::CachedTransformable));
+        STATIC_CHECK(SFML_BASE_IS_NOTHROW_MOVE_CONSTRUCTIBLE(sf::CachedTransformable));
+        STATIC_CHECK(SFML_BASE_IS_NOTHROW_MOVE_ASSIGNABLE(sf::CachedTransformable));
+        STATIC_CHECK(SFML_BASE_IS_TRIVIALLY_COPYABLE(sf::CachedTransformable));
+    }
+
+    SECTION("Construction")
+    {
+        const sf::CachedTransformable cachedTransformable;
+        CHECK(!cachedTransformable.isTransformDirty());
+        CHECK(cachedTransformable.getPosition() == sf::Vector2f{0, 0});
+        CHECK(cachedTransformable.getRotation() == sf::Angle::Zero);
+        CHECK(cachedTransformable.getScale() == sf::Vector2f{1, 1});
+        CHECK(cachedTransformable.getOrigin() == sf::Vector2f{0, 0});
+        CHECK(cachedTransformable.getTransform() == sf::Transform());
+        CHECK(cachedTransformable.getInverseTransform() == sf::Transform());
+    }
+
+    SECTION("Construction from transformable")
+    {
+        const sf::Transformable transformable{.position = {3, 4},
+                                              .scale    = {5, 6},
+                                              .origin   = {7, 8},
+                                              .rotation = sf::degrees(30)};
+
+        const sf::CachedTransformable cachedTransformable(transformable);
+        CHECK(cachedTransformable.isTransformDirty());
+        CHECK(cachedTransformable.getPosition() == sf::Vector2f{3, 4});
+        CHECK(cachedTransformable.getScale() == sf::Vector2f{5, 6});
+        CHECK(cachedTransformable.getOrigin() == sf::Vector2f{7, 8});
+        CHECK(cachedTransformable.getRotation() == Approx(sf::degrees(30)));
+
+        CHECK(cachedTransformable.getTransform() == transformable.getTransform());
+        CHECK(!cachedTransformable.isTransformDirty());
+        CHECK(cachedTransformable.getInverseTransform() == transformable.getInverseTransform());
+    }
+
+    SECTION("Setters mark the transform dirty")
+    {
+        sf::CachedTransformable cachedTransformable;
+        sf::Transformable       transformable;
+
+        const auto checkMatches = [&]
+        {
+            CHECK(cachedTransformable.isTransformDirty());
+            CHECK(cachedTransformable.getComponents().getTransform() == transformable.getTransform());
+            CHECK(cachedTransformable.getTransform() == transformable.getTransform());
+            CHECK(cachedTransformable.getInverseTransform() == transformable.getInverseTransform());
+            CHECK(!cachedTransformable.isTransformDirty());
+        };
+
+        cachedTransformable.setPosition({3, 4});
+        transformable.position = {3, 4};
+        checkMatches();
+
+        cachedTransformable.setRotation(sf::degrees(-72));
+        transformable.rotation = sf::degrees(-72);
+        CHECK(cachedTransformable.getRotation() == Approx(sf::degrees(288)));
+        checkMatches();
+
+        cachedTransformable.setScale({5, 6});
+        transformable.scale = {5, 6};
+        checkMatches();
+
+        cachedTransformable.setOrigin({7, 8});
+        transformable.origin = {7, 8};
+        checkMatches();
+
+        cachedTransformable.move({-15, 2});
+        transformable.position += {-15, 2};
+        CHECK(cachedTransformable.getPosition() == sf::Vector2f{-12, 6});
+        checkMatches();
+
+        // The rotation is stored wrapped, so it grows from 288 degrees rather than -72
+        cachedTransformable.rotate(sf::degrees(100));
+        transformable.rotation = sf::Angle(transformable.rotation) + sf::degrees(100);
+        CHECK(cachedTransformable.getRotation() == Approx(sf::degrees(28)));
+        checkMatches();
+
+        cachedTransformable.scaleBy({2, -1});
+        transformable.scaleBy({2, -1});
+        CHECK(cachedTransformable.getScale() == sf::Vector2f{10, -6});
+        checkMatches();
+    }
+
+    SECTION("Inverse transform is updated after the transform")
+    {
+        sf::CachedTransformable cachedTransformable;
+        cachedTransformable.setPosition({10, 20});
+
+        sf::Transform translation;
+        translation.translate({10, 20});
+
+        CHECK(cachedTransformable.getTransform() == translation);
+        CHECK(cachedTransformable.getInverseTransform() == translation.getInverse());
+    }
+
+    SECTION("updateTransforms()")
+    {
+        // Not a multiple of the batch size, with a mix of dirty and clean objects
+        std::vector<sf::CachedTransformable> cachedTransformables(37);
+        std::vector<sf::Transformable>       transformables(cachedTransformables.size());
+
+        for (std::size_t i = 0; i < cachedTransformables.size(); ++i)
+        {
+            if (i % 3 == 0)
+                continue;
+
+            const auto f = static_cast<float>(i);
+
+            transformables[i] = {.position = {f, -f},
+                                 .scale    = {1 + f, 2},
+                                 .origin   = {f * 0.5f, 1},
+                                 .rotation = sf::degrees(f * 17)};
+
+            cachedTransformables[i] = sf::CachedTransformable(transformables[i]);
+        }
+
+        sf::CachedTransformable::updateTransforms({cachedTransformables.data(), cachedTransformables.size()});
+
+        for (std::size_t i = 0; i < cachedTransformables.size(); ++i)
+        {
+            CHECK(!cachedTransformables[i].isTransformDirty());
+            CHECK(cachedTransformables[i].getTransform() == Approx(transformables[i].getTransform()));
+            CHECK(cachedTransformables[i].getInverseTransform() == Approx(transformables[i].getInverseTransform()));
+        }
+
+        cachedTransformables[5].move({1, 1});
+        sf::CachedTransformable::updateTransforms({cachedTransformables.data(), cachedTransformables.size()});
+
+        transformables[5].position += {1, 1};
+        CHECK(!cachedTransformables[5].isTransformDirty());
+        CHECK(cachedTransformables[5].getTransform() == Approx(transformables[5].getTransform()));
+        CHECK(cachedTransformables[5].getInverseTransform() == Approx(transformables[5].getInverseTransform()));
+    }
+}
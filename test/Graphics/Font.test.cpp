@@ -62,6 +62,48 @@ TEST_CASE("[Graphics] sf::Font" * doctest::skip(skipDisplayTests))
             CHECK(texture.getNativeHandle() != 0);
             CHECK(font.isSmooth());
         }
+
+        SECTION("Same file twice")
+        {
+            auto font0 = sf::Font::openFromFile(graphicsContext, "Graphics/tuffy.ttf");
+            auto font1 = sf::Font::openFromFile(graphicsContext, "Graphics/tuffy.ttf");
+            REQUIRE(font0.hasValue());
+            REQUIRE(font1.hasValue());
+
+            CHECK(font0->getLineSpacing(24) == 30);
+            CHECK(font1->getLineSpacing(12) == font0->getLineSpacing(12));
+            CHECK(font1->getGlyph(0x45, 16, false).advance == 9);
+        }
+
+        SECTION("Same file twice with a shared face")
+        {
+            auto font0 = sf::Font::openFromFile(graphicsContext, "Graphics/tuffy.ttf", nullptr, /* shareFace */ true);
+            const auto font1 = sf::Font::openFromFile(graphicsContext, "Graphics/tuffy.ttf", nullptr, /* shareFace */ true)
+                                   .value();
+            REQUIRE(font0.hasValue());
+
+            // Switching back and forth between sizes of the shared face
+            CHECK(font0->getLineSpacing(24) == 30);
+            CHECK(font1.getLineSpacing(12) == font0->getLineSpacing(12));
+            CHECK(font1.getLineSpacing(24) == 30);
+            CHECK(&font0->getTexture() != &font1.getTexture());
+
+            // The face outlives the font that opened it first
+            font0.reset();
+            CHECK(font1.getInfo().family == "Tuffy");
+            CHECK(font1.getGlyph(0x45, 16, false).advance == 9);
+            CHECK(font1.getKerning(0x41, 0x42, 12) == -1);
+        }
+
+        SECTION("Shared face is opened again once released")
+        {
+            for (int i = 0; i < 2; ++i)
+            {
+                const auto font = sf::Font::openFromFile(graphicsContext, "Graphics/tuffy.ttf", nullptr, /* shareFace */ true)
+                                      .value();
+                CHECK(font.getGlyph(0x45, 16, false).advance == 9);
+            }
+        }
     }
 
     SECTION("openFromMemory()")
@@ -134,4 +176,23 @@ TEST_CASE("[Graphics] sf::Font" * doctest::skip(skipDisplayTests))
         font.setSmooth(false);
         CHECK(!font.isSmooth());
     }
+
+    SECTION("Signed distance field")
+    {
+        auto font = sf::Font::openFromFile(graphicsContext, "Graphics/tuffy.ttf").value();
+        CHECK(!font.isSdf());
+
+        font.setSdf(true);
+        CHECK(font.isSdf());
+
+        const sf::Glyph  reference = font.getGlyph(0x45, sf::Font::sdfReferenceSize, false);
+        const sf::Glyph& half      = font.getGlyph(0x45, sf::Font::sdfReferenceSize / 2u, false);
+        CHECK(half.advance == Approx(reference.advance / 2.f));
+        CHECK(half.bounds.position == reference.bounds.position / 2.f);
+        CHECK(half.bounds.size == reference.bounds.size / 2.f);
+        CHECK(half.textureRect == reference.textureRect);
+
+        // Outlines are drawn by the shader, not rasterized
+        CHECK(&font.getGlyph(0x45, sf::Font::sdfReferenceSize / 2u, false, 2.f) == &half);
+    }
 }
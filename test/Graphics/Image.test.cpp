@@ -4,6 +4,7 @@
 
 // Other 1st party headers
 #include "SFML/System/FileInputStream.hpp"
+#include "SFML/System/JobSystem.hpp"
 #include "SFML/System/Path.hpp"
 
 #include "SFML/Base/TrivialVector.hpp"
@@ -13,6 +14,95 @@
 #include <CommonTraits.hpp>
 #include <GraphicsUtil.hpp>
 
+#include <algorithm>
+#include <random>
+#include <vector>
+
+
+namespace
+{
+////////////////////////////////////////////////////////////
+// Scalar pixel by pixel implementations that the vectorized operations must match exactly
+using Pixels = std::vector<sf::base::U8>;
+
+Pixels getPixels(const sf::Image& image)
+{
+    const sf::base::U8* pixels = image.getPixelsPtr();
+    return {pixels, pixels + image.getSize().x * image.getSize().y * 4};
+}
+
+void referenceBlendOver(const Pixels& source, Pixels& dest)
+{
+    for (std::size_t i = 0; i < dest.size(); i += 4)
+    {
+        const sf::base::U8* src = source.data() + i;
+        sf::base::U8*       dst = dest.data() + i;
+
+        const sf::base::U8 srcAlpha = src[3];
+        const sf::base::U8 dstAlpha = dst[3];
+        const auto         outAlpha = static_cast<sf::base::U8>(srcAlpha + dstAlpha - srcAlpha * dstAlpha / 255);
+
+        dst[3] = outAlpha;
+
+        if (outAlpha)
+            for (int k = 0; k < 3; k++)
+                dst[k] = static_cast<sf::base::U8>((src[k] * srcAlpha + dst[k] * (outAlpha - srcAlpha)) / outAlpha);
+        else
+            for (int k = 0; k < 3; k++)
+                dst[k] = src[k];
+    }
+}
+
+void referenceReplaceColor(Pixels& pixels, sf::Color color, sf::Color replacement, bool alphaOnly)
+{
+    for (std::size_t i = 0; i < pixels.size(); i += 4)
+    {
+        sf::base::U8* ptr = pixels.data() + i;
+
+        if ((ptr[0] == color.r) && (ptr[1] == color.g) && (ptr[2] == color.b) && (ptr[3] == color.a))
+        {
+            if (!alphaOnly)
+            {
+                ptr[0] = replacement.r;
+                ptr[1] = replacement.g;
+                ptr[2] = replacement.b;
+            }
+
+            ptr[3] = replacement.a;
+        }
+    }
+}
+
+void referencePremultiply(Pixels& pixels)
+{
+    for (std::size_t i = 0; i < pixels.size(); i += 4)
+        for (std::size_t k = 0; k < 3; ++k)
+            pixels[i + k] = static_cast<sf::base::U8>((pixels[i + k] * pixels[i + 3] + 127) / 255);
+}
+
+void referenceUnpremultiply(Pixels& pixels)
+{
+    for (std::size_t i = 0; i < pixels.size(); i += 4)
+        if (pixels[i + 3] != 0)
+            for (std::size_t k = 0; k < 3; ++k)
+                pixels[i + k] = static_cast<sf::base::U8>(
+                    std::min((pixels[i + k] * 255 + pixels[i + 3] / 2) / pixels[i + 3], 255));
+}
+
+sf::Image makeRandomImage(std::minstd_rand& rng, sf::Vector2u size)
+{
+    // Favor the extreme values, which are the edge cases of the blending formulas
+    static constexpr sf::base::U8 palette[]{0, 1, 2, 127, 128, 254, 255};
+
+    Pixels pixels(size.x * size.y * 4);
+
+    for (sf::base::U8& component : pixels)
+        component = (rng() % 2 == 0) ? palette[rng() % 7] : static_cast<sf::base::U8>(rng());
+
+    return sf::Image::create(size, pixels.data()).value();
+}
+} // namespace
+
 
 TEST_CASE("[Graphics] sf::Image")
 {
@@ -429,4 +519,303 @@ TEST_CASE("[Graphics] sf::Image")
 
         CHECK(image.getPixel(sf::Vector2u{0, 9}) == sf::Color::Green);
     }
+
+    SECTION("Vectorized operations match the scalar code")
+    {
+        std::minstd_rand rng(42u);
+
+        // Widths that are not multiples of the vector width leave pixels to the scalar tails
+        const sf::Vector2u sizes[]{{1, 1}, {3, 2}, {37, 5}, {64, 9}};
+
+        SECTION("Copy with alpha")
+        {
+            for (const sf::Vector2u size : sizes)
+            {
+                const sf::Image source = makeRandomImage(rng, size);
+                sf::Image       dest   = makeRandomImage(rng, size);
+
+                Pixels expected = getPixels(dest);
+                referenceBlendOver(getPixels(source), expected);
+
+                CHECK(dest.copy(source, {0, 0}, {}, true));
+                CHECK(getPixels(dest) == expected);
+            }
+        }
+
+        SECTION("Color-key")
+        {
+            for (const sf::Vector2u size : sizes)
+            {
+                sf::Image image = makeRandomImage(rng, size);
+                image.setPixel({0, 0}, sf::Color::Magenta);
+                image.setPixel({size.x - 1, size.y - 1}, sf::Color::Magenta);
+
+                Pixels expected = getPixels(image);
+                referenceReplaceColor(expected, sf::Color::Magenta, {0, 0, 0, 7}, /* alphaOnly */ true);
+
+                image.createMaskFromColor(sf::Color::Magenta, 7);
+                CHECK(getPixels(image) == expected);
+
+                referenceReplaceColor(expected, {255, 0, 255, 7}, sf::Color::Cyan, /* alphaOnly */ false);
+
+                image.replaceColor({255, 0, 255, 7}, sf::Color::Cyan);
+                CHECK(getPixels(image) == expected);
+                CHECK(image.getPixel({0, 0}) == sf::Color::Cyan);
+            }
+        }
+
+        SECTION("Flip")
+        {
+            for (const sf::Vector2u size : sizes)
+            {
+                sf::Image    image  = makeRandomImage(rng, size);
+                const Pixels before = getPixels(image);
+
+                Pixels flippedHorizontally(before.size());
+                Pixels flippedVertically(before.size());
+
+                for (std::size_t y = 0; y < size.y; ++y)
+                    for (std::size_t x = 0; x < size.x; ++x)
+                        for (std::size_t k = 0; k < 4; ++k)
+                        {
+                            const sf::base::U8 component = before[(y * size.x + x) * 4 + k];
+
+                            flippedHorizontally[(y * size.x + (size.x - 1 - x)) * 4 + k] = component;
+                            flippedVertically[((size.y - 1 - y) * size.x + x) * 4 + k]   = component;
+                        }
+
+                image.flipHorizontally();
+                CHECK(getPixels(image) == flippedHorizontally);
+
+                image.flipHorizontally();
+                image.flipVertically();
+                CHECK(getPixels(image) == flippedVertically);
+            }
+        }
+
+        SECTION("Premultiply and unpremultiply")
+        {
+            for (const sf::Vector2u size : sizes)
+            {
+                sf::Image image    = makeRandomImage(rng, size);
+                Pixels    expected = getPixels(image);
+
+                referencePremultiply(expected);
+                image.premultiplyAlpha();
+                CHECK(getPixels(image) == expected);
+
+                sf::Image straight = makeRandomImage(rng, size);
+                expected           = getPixels(straight);
+
+                referenceUnpremultiply(expected);
+                straight.unpremultiplyAlpha();
+                CHECK(getPixels(straight) == expected);
+            }
+        }
+
+        SECTION("Swizzle")
+        {
+            for (const sf::Vector2u size : sizes)
+            {
+                sf::Image    image  = makeRandomImage(rng, size);
+                const Pixels before = getPixels(image);
+
+                image.swizzleChannels(2, 1, 0, 3);
+                image.swizzleChannels(3, 3, 1, 0);
+
+                const Pixels after = getPixels(image);
+
+                for (std::size_t i = 0; i < before.size(); i += 4)
+                {
+                    CHECK(after[i + 0] == before[i + 3]);
+                    CHECK(after[i + 1] == before[i + 3]);
+                    CHECK(after[i + 2] == before[i + 1]);
+                    CHECK(after[i + 3] == before[i + 2]);
+                }
+            }
+        }
+
+        SECTION("Fill rectangle")
+        {
+            for (const sf::Vector2u size : sizes)
+            {
+                sf::Image image    = makeRandomImage(rng, size);
+                Pixels    expected = getPixels(image);
+
+                const sf::IntRect rect({1, -1}, {static_cast<int>(size.x), 2});
+
+                for (int y = 0; y < static_cast<int>(size.y); ++y)
+                    for (int x = 0; x < static_cast<int>(size.x); ++x)
+                        if (rect.contains({x, y}))
+                        {
+                            const auto i    = (static_cast<std::size_t>(y) * size.x + static_cast<std::size_t>(x)) * 4;
+                            expected[i + 0] = 1;
+                            expected[i + 1] = 2;
+                            expected[i + 2] = 3;
+                            expected[i + 3] = 4;
+                        }
+
+                image.fillRect(rect, {1, 2, 3, 4});
+                CHECK(getPixels(image) == expected);
+            }
+        }
+
+        SECTION("Every pair of alpha values")
+        {
+            // One pixel per combination of source and destination alpha, or of component and alpha
+            Pixels sourcePixels(256 * 256 * 4);
+            Pixels destPixels(256 * 256 * 4);
+
+            for (std::size_t i = 0; i < 256 * 256; ++i)
+            {
+                for (std::size_t k = 0; k < 3; ++k)
+                {
+                    sourcePixels[i * 4 + k] = static_cast<sf::base::U8>(rng());
+                    destPixels[i * 4 + k]   = static_cast<sf::base::U8>(k == 0 ? i / 256 : rng());
+                }
+
+                sourcePixels[i * 4 + 3] = static_cast<sf::base::U8>(i / 256);
+                destPixels[i * 4 + 3]   = static_cast<sf::base::U8>(i % 256);
+            }
+
+            const sf::Image source = sf::Image::create({256, 256}, sourcePixels.data()).value();
+            sf::Image       dest   = sf::Image::create({256, 256}, destPixels.data()).value();
+
+            Pixels expected = destPixels;
+            referenceBlendOver(sourcePixels, expected);
+
+            CHECK(dest.copy(source, {0, 0}, {}, true));
+            CHECK(getPixels(dest) == expected);
+
+            sf::Image premultiplied = sf::Image::create({256, 256}, destPixels.data()).value();
+            expected                = destPixels;
+
+            referencePremultiply(expected);
+            premultiplied.premultiplyAlpha();
+            CHECK(getPixels(premultiplied) == expected);
+
+            sf::Image unpremultiplied = sf::Image::create({256, 256}, destPixels.data()).value();
+            expected                  = destPixels;
+
+            referenceUnpremultiply(expected);
+            unpremultiplied.unpremultiplyAlpha();
+            CHECK(getPixels(unpremultiplied) == expected);
+        }
+    }
+    SECTION("resized()")
+    {
+        constexpr sf::Image::ResampleFilter filters[]{sf::Image::ResampleFilter::Box,
+                                                      sf::Image::ResampleFilter::Bilinear,
+                                                      sf::Image::ResampleFilter::Lanczos3};
+
+        std::minstd_rand rng(42);
+
+        SECTION("Invalid size")
+        {
+            const sf::Image image = sf::Image::create({4, 4}).value();
+            CHECK(!image.resized({0, 4}).hasValue());
+            CHECK(!image.resized({4, 0}).hasValue());
+        }
+
+        SECTION("Same size")
+        {
+            const sf::Image image = makeRandomImage(rng, {13, 7});
+
+            for (const sf::Image::ResampleFilter filter : filters)
+                CHECK(getPixels(image.resized({13, 7}, filter).value()) == getPixels(image));
+        }
+
+        SECTION("Uniform color")
+        {
+            const sf::Image image = sf::Image::create({37, 23}, {10, 100, 200, 255}).value();
+
+            for (const sf::Image::ResampleFilter filter : filters)
+                for (const sf::Vector2u size : {sf::Vector2u{10, 50}, sf::Vector2u{1, 1}, sf::Vector2u{74, 5}})
+                {
+                    const sf::Image resized = image.resized(size, filter).value();
+                    CHECK(resized.getSize() == size);
+                    CHECK(getPixels(resized) == getPixels(sf::Image::create(size, {10, 100, 200, 255}).value()));
+                }
+        }
+
+        SECTION("Box filter halving averages 2x2 blocks")
+        {
+            const sf::Image image   = makeRandomImage(rng, {64, 48});
+            const sf::Image resized = image.resized({32, 24}).value();
+
+            const Pixels source = getPixels(image);
+            Pixels       expected(32 * 24 * 4);
+
+            for (std::size_t y = 0; y < 24; ++y)
+                for (std::size_t x = 0; x < 32; ++x)
+                    for (std::size_t k = 0; k < 4; ++k)
+                    {
+                        const auto at = [&](std::size_t sx, std::size_t sy) { return source[(sy * 64 + sx) * 4 + k]; };
+                        const int sum = at(x * 2, y * 2) + at(x * 2 + 1, y * 2) + at(x * 2, y * 2 + 1) +
+                                        at(x * 2 + 1, y * 2 + 1);
+
+                        expected[(y * 32 + x) * 4 + k] = static_cast<sf::base::U8>((sum + 2) / 4);
+                    }
+
+            CHECK(getPixels(resized) == expected);
+        }
+
+        SECTION("Job system gives the same result")
+        {
+            const sf::Image image = makeRandomImage(rng, {301, 257});
+            sf::JobSystem   jobSystem(3u);
+
+            for (const sf::Image::ResampleFilter filter : filters)
+                for (const sf::Vector2u size : {sf::Vector2u{150, 128}, sf::Vector2u{97, 300}})
+                    CHECK(getPixels(image.resized(size, filter, &jobSystem).value()) ==
+                          getPixels(image.resized(size, filter).value()));
+        }
+    }
+
+    SECTION("generateMipChain()")
+    {
+        SECTION("1x1 image")
+        {
+            CHECK(sf::ImageUtils::generateMipChain(sf::Image::create({1, 1}).value()).empty());
+        }
+
+        SECTION("Level sizes")
+        {
+            const sf::Image              image  = sf::Image::create({37, 10}, sf::Color::Cyan).value();
+            const std::vector<sf::Image> levels = sf::ImageUtils::generateMipChain(image);
+
+            REQUIRE(levels.size() == 5);
+            CHECK(levels[0].getSize() == sf::Vector2u{18, 5});
+            CHECK(levels[1].getSize() == sf::Vector2u{9, 2});
+            CHECK(levels[2].getSize() == sf::Vector2u{4, 1});
+            CHECK(levels[3].getSize() == sf::Vector2u{2, 1});
+            CHECK(levels[4].getSize() == sf::Vector2u{1, 1});
+
+            for (const sf::Image& level : levels)
+                CHECK(getPixels(level) == getPixels(sf::Image::create(level.getSize(), sf::Color::Cyan).value()));
+        }
+
+        SECTION("Job system gives the same result")
+        {
+            std::minstd_rand rng(42);
+
+            const sf::Image image = makeRandomImage(rng, {256, 100});
+            sf::JobSystem   jobSystem(3u);
+
+            constexpr auto filter = sf::Image::ResampleFilter::Lanczos3;
+
+            const std::vector<sf::Image> levels         = sf::ImageUtils::generateMipChain(image);
+            const std::vector<sf::Image> lanczosLevels  = sf::ImageUtils::generateMipChain(image, nullptr, filter);
+            const std::vector<sf::Image> parallelLevels = sf::ImageUtils::generateMipChain(image, &jobSystem, filter);
+
+            REQUIRE(levels.size() == 8);
+            REQUIRE(parallelLevels.size() == 8);
+            REQUIRE(lanczosLevels.size() == 8);
+
+            CHECK(getPixels(levels[0]) == getPixels(image.resized({128, 50}).value()));
+
+            for (std::size_t i = 0; i < levels.size(); ++i)
+                CHECK(getPixels(parallelLevels[i]) == getPixels(lanczosLevels[i]));
+        }
+    }
 }
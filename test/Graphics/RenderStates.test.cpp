@@ -35,6 +35,7 @@ TEST_CASE("[Graphics] sf::RenderStates")
             CHECK(renderStates.coordinateType == sf::CoordinateType::Pixels);
             CHECK(renderStates.texture == nullptr);
             CHECK(renderStates.shader == nullptr);
+            CHECK(renderStates.textureArray == nullptr);
         }
     }
 
@@ -46,5 +47,6 @@ TEST_CASE("[Graphics] sf::RenderStates")
         CHECK(sf::RenderStates::Default.coordinateType == sf::CoordinateType::Pixels);
         CHECK(sf::RenderStates::Default.texture == nullptr);
         CHECK(sf::RenderStates::Default.shader == nullptr);
+        CHECK(sf::RenderStates::Default.textureArray == nullptr);
     }
 }
@@ -2,6 +2,7 @@
 
 // Other 1st party headers
 #include "SFML/Graphics/GraphicsContext.hpp"
+#include "SFML/Graphics/UniformBlock.hpp"
 
 #include "SFML/System/FileInputStream.hpp"
 #include "SFML/System/Path.hpp"
@@ -12,6 +13,11 @@
 
 #include <CommonTraits.hpp>
 
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <vector>
+
 namespace
 {
 constexpr auto vertexSource = R"glsl(
@@ -132,6 +138,27 @@ void main()
 
 )glsl";
 
+constexpr auto uniformBlockFragmentSource = R"glsl(
+
+layout(location = 2) uniform sampler2D sf_u_texture;
+
+layout(std140) uniform Params
+{
+    vec4 tint;
+};
+
+in vec4 sf_v_color;
+in vec2 sf_v_texCoord;
+
+layout(location = 0) out vec4 sf_fragColor;
+
+void main()
+{
+    sf_fragColor = sf_v_color * tint * texture(sf_u_texture, sf_v_texCoord);
+}
+
+)glsl";
+
 #ifdef SFML_RUN_DISPLAY_TESTS
 constexpr bool skipShaderFullTest = false;
 #else
@@ -289,4 +316,75 @@ TEST_CASE("[Graphics] sf::Shader" * doctest::skip(skipShaderFullTest))
                 CHECK(static_cast<bool>(shader->getNativeHandle()) == sf::Shader::isGeometryAvailable(graphicsContext));
         }
     }
+
+    SECTION("setUniformBlock()")
+    {
+        auto block = sf::UniformBlock::create(graphicsContext, sizeof(float) * 4u, 0u).value();
+        const float tint[4]{1.f, 0.5f, 0.25f, 1.f};
+        CHECK(block.update(tint));
+
+        auto shader = sf::Shader::loadFromMemory(graphicsContext, uniformBlockFragmentSource, sf::Shader::Type::Fragment)
+                          .value();
+
+        CHECK(shader.setUniformBlock("Params", block));
+        CHECK(shader.setUniformBlock("Params", block));
+        CHECK(!shader.setUniformBlock("Missing", block));
+
+        // The same block can be shared by several shaders
+        auto otherShader = sf::Shader::loadFromMemory(graphicsContext,
+                                                      uniformBlockFragmentSource,
+                                                      sf::Shader::Type::Fragment)
+                               .value();
+
+        CHECK(otherShader.setUniformBlock("Params", block));
+
+        shader.bind();
+        otherShader.bind();
+        sf::Shader::unbind(graphicsContext);
+    }
+
+    SECTION("Shader cache")
+    {
+        const sf::Path cacheDirectory = sf::Path::tempDirectoryPath() / "sfml_shader_cache_test";
+        std::filesystem::remove_all(cacheDirectory.to<std::string>());
+
+        graphicsContext.setShaderCacheDirectory(cacheDirectory);
+        CHECK(graphicsContext.getShaderCacheDirectory() == cacheDirectory.to<std::string>());
+
+        const auto getEntries = [&]
+        {
+            std::vector<std::filesystem::path> entries;
+
+            for (const auto& entry : std::filesystem::directory_iterator(cacheDirectory.to<std::string>()))
+                entries.push_back(entry.path());
+
+            return entries;
+        };
+
+        // Cold load stores the binary
+        CHECK(sf::Shader::loadFromMemory(graphicsContext, fragmentSource, sf::Shader::Type::Fragment).hasValue());
+
+        const std::vector<std::filesystem::path> entries = getEntries();
+        REQUIRE(entries.size() == 1);
+        CHECK(entries[0].extension() == ".bin");
+
+        // Warm load reads it back, a miss would have stored it again
+        const auto oldWriteTime = std::filesystem::last_write_time(entries[0]) - std::chrono::hours(1);
+        std::filesystem::last_write_time(entries[0], oldWriteTime);
+
+        CHECK(sf::Shader::loadFromMemory(graphicsContext, fragmentSource, sf::Shader::Type::Fragment).hasValue());
+        CHECK(std::filesystem::last_write_time(entries[0]) == oldWriteTime);
+
+        // Corrupted entries are ignored, the shader is recompiled and stored again
+        std::ofstream(entries[0], std::ios_base::binary | std::ios_base::trunc) << "garbage";
+
+        CHECK(sf::Shader::loadFromMemory(graphicsContext, fragmentSource, sf::Shader::Type::Fragment).hasValue());
+        CHECK(getEntries() == entries);
+        CHECK(std::filesystem::file_size(entries[0]) > 7);
+
+        graphicsContext.setShaderCacheDirectory(sf::Path{});
+        CHECK(graphicsContext.getShaderCacheDirectory().empty());
+
+        std::filesystem::remove_all(cacheDirectory.to<std::string>());
+    }
 }
@@ -3,6 +3,7 @@
 // Other 1st party headers
 #include "SFML/Graphics/GraphicsContext.hpp"
 #include "SFML/Graphics/Image.hpp"
+#include "SFML/Graphics/ImageUtils.hpp"
 
 #include "SFML/System/FileInputStream.hpp"
 #include "SFML/System/Path.hpp"
@@ -17,6 +18,8 @@
 #include <LoadIntoMemoryUtil.hpp>
 #include <WindowUtil.hpp>
 
+#include <vector>
+
 TEST_CASE("[Graphics] sf::Texture" * doctest::skip(skipDisplayTests))
 {
     sf::GraphicsContext graphicsContext;
@@ -260,6 +263,22 @@ TEST_CASE("[Graphics] sf::Texture" * doctest::skip(skipDisplayTests))
         CHECK(texture.generateMipmap());
     }
 
+    SECTION("uploadMipmap()")
+    {
+        sf::Texture texture = sf::Texture::create(graphicsContext, {100, 40}).value();
+        const auto  image   = sf::Image::create({100, 40}, sf::Color::Red).value();
+        texture.update(image);
+
+        const std::vector<sf::Image> levels = sf::ImageUtils::generateMipChain(image);
+        REQUIRE(levels.size() == 6);
+
+        CHECK(!texture.uploadMipmap({}));
+        CHECK(!texture.uploadMipmap({levels.data() + 1, levels.size() - 1}));
+        CHECK(texture.uploadMipmap({levels.data(), 3}));
+        CHECK(texture.uploadMipmap({levels.data(), levels.size()}));
+        CHECK(texture.generateMipmap());
+    }
+
     SECTION("swap()")
     {
         constexpr sf::base::U8 blue[] = {0x00, 0x00, 0xFF, 0xFF};
@@ -0,0 +1,134 @@
+#include "SFML/Graphics/TextureArray.hpp"
+
+// Other 1st party headers
+#include "SFML/Graphics/DrawableBatch.hpp"
+#include "SFML/Graphics/GraphicsContext.hpp"
+#include "SFML/Graphics/Image.hpp"
+#include "SFML/Graphics/RenderStates.hpp"
+#include "SFML/Graphics/RenderTexture.hpp"
+#include "SFML/Graphics/Sprite.hpp"
+#include "SFML/Graphics/Texture.hpp"
+
+#include "SFML/Base/Macros.hpp"
+
+#include <Doctest.hpp>
+
+#include <CommonTraits.hpp>
+#include <GraphicsUtil.hpp>
+#include <WindowUtil.hpp>
+
+
+TEST_CASE("[Graphics] sf::TextureArray" * doctest::skip(skipDisplayTests))
+{
+    sf::GraphicsContext graphicsContext;
+
+    SECTION("Type traits")
+    {
+        STATIC_CHECK(!SFML_BASE_IS_DEFAULT_CONSTRUCTIBLE(sf::TextureArray));
+        STATIC_CHECK(!SFML_BASE_IS_COPY_CONSTRUCTIBLE(sf::TextureArray));
+        STATIC_CHECK(!SFML_BASE_IS_COPY_ASSIGNABLE(sf::TextureArray));
+        STATIC_CHECK(SFML_BASE_IS_NOTHROW_MOVE_CONSTRUCTIBLE(sf::TextureArray));
+        STATIC_CHECK(SFML_BASE_IS_NOTHROW_MOVE_ASSIGNABLE(sf::TextureArray));
+    }
+
+    SECTION("create()")
+    {
+        CHECK(!sf::TextureArray::create(graphicsContext, {0u, 16u}, 2u).hasValue());
+        CHECK(!sf::TextureArray::create(graphicsContext, {16u, 16u}, 0u).hasValue());
+        CHECK(!sf::TextureArray::create(graphicsContext,
+                                        {16u, 16u},
+                                        sf::TextureArray::getMaximumLayerCount(graphicsContext) + 1u)
+                   .hasValue());
+
+        const auto textureArray = sf::TextureArray::create(graphicsContext, {16u, 8u}, 3u);
+        REQUIRE(textureArray.hasValue());
+        CHECK(textureArray->getLayerSize() == sf::Vector2u{16u, 8u});
+        CHECK(textureArray->getLayerCount() == 3u);
+        CHECK(!textureArray->isSmooth());
+        CHECK(textureArray->getNativeHandle() != 0u);
+    }
+
+    SECTION("getMaximumLayerCount()")
+    {
+        CHECK(sf::TextureArray::getMaximumLayerCount(graphicsContext) >= 256u);
+    }
+
+    SECTION("getTextureRect()")
+    {
+        const auto textureArray = sf::TextureArray::create(graphicsContext, {16u, 8u}, 3u).value();
+
+        CHECK(textureArray.getTextureRect(0u) == sf::FloatRect{{0.f, 0.f}, {16.f, 8.f}});
+        CHECK(textureArray.getTextureRect(2u) == sf::FloatRect{{34.f, 0.f}, {16.f, 8.f}});
+        CHECK(textureArray.getTextureRect(1u, {{4.f, 2.f}, {8.f, 4.f}}) == sf::FloatRect{{21.f, 2.f}, {8.f, 4.f}});
+    }
+
+    SECTION("Move semantics")
+    {
+        auto               textureArray = sf::TextureArray::create(graphicsContext, {16u, 8u}, 2u).value();
+        const unsigned int handle       = textureArray.getNativeHandle();
+
+        sf::TextureArray movedTextureArray(SFML_BASE_MOVE(textureArray));
+        CHECK(movedTextureArray.getNativeHandle() == handle);
+        CHECK(movedTextureArray.getLayerCount() == 2u);
+    }
+
+    SECTION("setSmooth()")
+    {
+        auto textureArray = sf::TextureArray::create(graphicsContext, {16u, 8u}, 2u).value();
+        textureArray.setSmooth(true);
+        CHECK(textureArray.isSmooth());
+    }
+
+    SECTION("Draw batch")
+    {
+        auto renderTexture = sf::RenderTexture::create(graphicsContext, {32u, 16u}).value();
+
+        const auto redImage  = sf::Image::create({16u, 16u}, sf::Color::Red).value();
+        const auto blueImage = sf::Image::create({16u, 16u}, sf::Color::Blue).value();
+
+        sf::CPUDrawableBatch batch;
+
+        SECTION("Texture array")
+        {
+            auto textureArray = sf::TextureArray::create(graphicsContext, {16u, 16u}, 2u).value();
+            textureArray.update(0u, redImage);
+            textureArray.update(1u, blueImage);
+
+            sf::Sprite redSprite(textureArray.getTextureRect(0u));
+            sf::Sprite blueSprite(textureArray.getTextureRect(1u));
+            blueSprite.position = {16.f, 0.f};
+
+            batch.add(redSprite);
+            batch.add(blueSprite);
+
+            renderTexture.clear();
+            renderTexture.draw(batch, {.textureArray = &textureArray});
+            renderTexture.display();
+
+            const sf::Image image = renderTexture.getTexture().copyToImage();
+            CHECK(image.getPixel({8u, 8u}) == sf::Color::Red);
+            CHECK(image.getPixel({24u, 8u}) == sf::Color::Blue);
+        }
+
+        SECTION("Texture runs")
+        {
+            const auto redTexture  = sf::Texture::loadFromImage(graphicsContext, redImage).value();
+            const auto blueTexture = sf::Texture::loadFromImage(graphicsContext, blueImage).value();
+
+            sf::Sprite redSprite(redTexture.getRect());
+            sf::Sprite blueSprite(blueTexture.getRect());
+            blueSprite.position = {16.f, 0.f};
+
+            batch.add(redSprite, redTexture);
+            batch.add(blueSprite, blueTexture);
+
+            renderTexture.clear();
+            renderTexture.draw(batch);
+            renderTexture.display();
+
+            const sf::Image image = renderTexture.getTexture().copyToImage();
+            CHECK(image.getPixel({8u, 8u}) == sf::Color::Red);
+            CHECK(image.getPixel({24u, 8u}) == sf::Color::Blue);
+        }
+    }
+}
@@ -0,0 +1,79 @@
+#include "SFML/Graphics/UniformBlock.hpp"
+
+// Other 1st party headers
+#include "SFML/Graphics/GraphicsContext.hpp"
+
+#include "SFML/Base/Builtins/OffsetOf.hpp"
+#include "SFML/Base/Macros.hpp"
+
+#include <Doctest.hpp>
+
+#include <CommonTraits.hpp>
+
+
+namespace
+{
+#ifdef SFML_RUN_DISPLAY_TESTS
+constexpr bool skipUniformBlockTest = false;
+#else
+constexpr bool skipUniformBlockTest = true;
+#endif
+
+struct Params
+{
+    float tint[4];
+    float exposure;
+    float gamma;
+    float padding[2];
+};
+
+} // namespace
+
+
+TEST_CASE("[Graphics] sf::UniformBlock" * doctest::skip(skipUniformBlockTest))
+{
+    sf::GraphicsContext graphicsContext;
+
+    SECTION("Type traits")
+    {
+        STATIC_CHECK(!SFML_BASE_IS_DEFAULT_CONSTRUCTIBLE(sf::UniformBlock));
+        STATIC_CHECK(!SFML_BASE_IS_COPY_CONSTRUCTIBLE(sf::UniformBlock));
+        STATIC_CHECK(!SFML_BASE_IS_COPY_ASSIGNABLE(sf::UniformBlock));
+        STATIC_CHECK(SFML_BASE_IS_NOTHROW_MOVE_CONSTRUCTIBLE(sf::UniformBlock));
+        STATIC_CHECK(SFML_BASE_IS_NOTHROW_MOVE_ASSIGNABLE(sf::UniformBlock));
+    }
+
+    SECTION("create()")
+    {
+        CHECK(!sf::UniformBlock::create(graphicsContext, 0u, 0u).hasValue());
+        CHECK(!sf::UniformBlock::create(graphicsContext, sizeof(Params), 100'000u).hasValue());
+
+        const auto block = sf::UniformBlock::create(graphicsContext, sizeof(Params), 1u);
+        REQUIRE(block.hasValue());
+        CHECK(block->getSize() == sizeof(Params));
+        CHECK(block->getBindingPoint() == 1u);
+        CHECK(block->getNativeHandle() != 0u);
+    }
+
+    SECTION("Move semantics")
+    {
+        auto block = sf::UniformBlock::create(graphicsContext, sizeof(Params), 0u).value();
+
+        const unsigned int handle = block.getNativeHandle();
+        const sf::UniformBlock movedBlock(SFML_BASE_MOVE(block));
+        CHECK(movedBlock.getNativeHandle() == handle);
+        CHECK(movedBlock.getSize() == sizeof(Params));
+    }
+
+    SECTION("update()")
+    {
+        auto block = sf::UniformBlock::create(graphicsContext, sizeof(Params), 0u).value();
+
+        const Params params{{1.f, 0.5f, 0.25f, 1.f}, 2.f, 2.2f, {}};
+        CHECK(block.update(params));
+        CHECK(block.update(&params.gamma, sizeof(float), SFML_BASE_OFFSETOF(Params, gamma)));
+
+        CHECK(!block.update(&params, sizeof(Params), 4u));
+        CHECK(!block.update(nullptr, sizeof(Params)));
+    }
+}
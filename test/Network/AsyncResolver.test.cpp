@@ -0,0 +1,203 @@
+#include "SFML/Network/AsyncResolver.hpp"
+
+// Other 1st party headers
+#include "SFML/Network/IpAddress.hpp"
+#include "SFML/Network/IpAddressUtils.hpp"
+
+#include "SFML/System/Time.hpp"
+
+#include "SFML/Base/Macros.hpp"
+#include "SFML/Base/StringView.hpp"
+
+#include <Doctest.hpp>
+
+#include <CommonTraits.hpp>
+
+#include <atomic>
+#include <string>
+#include <thread>
+
+
+using namespace sf::base::literals;
+using namespace std::string_literals;
+
+namespace
+{
+std::atomic<int>  fakeLookupCount{0};
+std::atomic<bool> fakeLookupBlocked{false};
+
+////////////////////////////////////////////////////////////
+/// Only knows "sfml.test", and waits while `fakeLookupBlocked` is set
+///
+////////////////////////////////////////////////////////////
+sf::base::Optional<sf::IpAddress> fakeLookup(sf::base::StringView hostName)
+{
+    ++fakeLookupCount;
+
+    while (fakeLookupBlocked.load())
+        std::this_thread::yield();
+
+    if (hostName == "sfml.test"_sv)
+        return sf::base::makeOptional(sf::IpAddress(203, 0, 113, 7));
+
+    return sf::base::nullOpt;
+}
+
+} // namespace
+
+TEST_CASE("[Network] sf::AsyncResolver")
+{
+    SECTION("Type traits")
+    {
+        STATIC_CHECK(!SFML_BASE_IS_COPY_CONSTRUCTIBLE(sf::AsyncResolver));
+        STATIC_CHECK(!SFML_BASE_IS_COPY_ASSIGNABLE(sf::AsyncResolver));
+        STATIC_CHECK(!SFML_BASE_IS_MOVE_CONSTRUCTIBLE(sf::AsyncResolver));
+        STATIC_CHECK(!SFML_BASE_IS_MOVE_ASSIGNABLE(sf::AsyncResolver));
+
+        STATIC_CHECK(!SFML_BASE_IS_COPY_CONSTRUCTIBLE(sf::AsyncResolver::Query));
+        STATIC_CHECK(!SFML_BASE_IS_COPY_ASSIGNABLE(sf::AsyncResolver::Query));
+        STATIC_CHECK(SFML_BASE_IS_NOTHROW_MOVE_CONSTRUCTIBLE(sf::AsyncResolver::Query));
+        STATIC_CHECK(SFML_BASE_IS_NOTHROW_MOVE_ASSIGNABLE(sf::AsyncResolver::Query));
+    }
+
+    sf::AsyncResolver resolver;
+
+    SECTION("Literal addresses are resolved immediately")
+    {
+        const auto query = resolver.resolve("203.0.113.2"_sv);
+        CHECK(query.isReady());
+        CHECK(query.getStatus() == sf::AsyncResolver::Status::Resolved);
+        REQUIRE(query.getAddress().hasValue());
+        CHECK(sf::IpAddressUtils::toString(*query.getAddress()) == "203.0.113.2"s);
+
+        CHECK(*resolver.resolve("255.255.255.255"_sv).getAddress() == sf::IpAddress::Broadcast);
+        CHECK(*resolver.resolve("0.0.0.0"_sv).getAddress() == sf::IpAddress::Any);
+
+        // Literal addresses never go through the cache
+        CHECK(resolver.getCacheSize() == 0);
+    }
+
+    SECTION("Empty address fails immediately")
+    {
+        const auto query = resolver.resolve(""_sv);
+        CHECK(query.isReady());
+        CHECK(query.getStatus() == sf::AsyncResolver::Status::Failed);
+        CHECK(!query.getAddress().hasValue());
+    }
+
+    SECTION("Host name is resolved in the background and cached")
+    {
+        const auto query = resolver.resolve("localhost"_sv);
+        const auto localHost = query.wait();
+        REQUIRE(localHost.hasValue());
+        CHECK(*localHost == sf::IpAddress::LocalHost);
+        CHECK(query.isReady());
+        CHECK(query.getStatus() == sf::AsyncResolver::Status::Resolved);
+        CHECK(resolver.getCacheSize() == 1);
+
+        // Served from the cache, without waiting
+        const auto cached = resolver.resolve("localhost"_sv);
+        CHECK(cached.isReady());
+        CHECK(cached.getAddress() == localHost);
+
+        resolver.clearCache();
+        CHECK(resolver.getCacheSize() == 0);
+    }
+
+    SECTION("Concurrent queries share a single lookup")
+    {
+        const auto query0 = resolver.resolve("localhost"_sv);
+        const auto query1 = resolver.resolve("localhost"_sv);
+
+        CHECK(query0.waitFor(sf::seconds(10.f)));
+        CHECK(query1.wait() == query0.getAddress());
+        CHECK(resolver.getCacheSize() == 1);
+    }
+
+    SECTION("Queries can be moved and discarded while pending")
+    {
+        auto query = resolver.resolve("localhost"_sv);
+        auto moved = SFML_BASE_MOVE(query);
+        CHECK(moved.wait() == sf::base::makeOptional(sf::IpAddress::LocalHost));
+
+        (void)resolver.resolve("localhost"_sv);
+    }
+}
+
+TEST_CASE("[Network] sf::AsyncResolver (expired entries)")
+{
+    sf::AsyncResolver resolver({.positiveTtl = sf::Time::Zero, .negativeTtl = sf::Time::Zero, .workerCount = 1u});
+
+    const auto query = resolver.resolve("localhost"_sv);
+    CHECK(query.wait() == sf::base::makeOptional(sf::IpAddress::LocalHost));
+    CHECK(resolver.getCacheSize() == 1);
+
+    // The entry has already expired, so a new lookup is performed
+    const auto again = resolver.resolve("localhost"_sv);
+    CHECK(again.wait() == sf::base::makeOptional(sf::IpAddress::LocalHost));
+}
+
+TEST_CASE("[Network] sf::AsyncResolver (fake lookup)")
+{
+    fakeLookupCount   = 0;
+    fakeLookupBlocked = false;
+
+    sf::AsyncResolver resolver({.lookup = &fakeLookup});
+
+    SECTION("Successful lookups are cached")
+    {
+        const auto query = resolver.resolve("sfml.test"_sv);
+        CHECK(query.wait() == sf::base::makeOptional(sf::IpAddress(203, 0, 113, 7)));
+        CHECK(query.getStatus() == sf::AsyncResolver::Status::Resolved);
+
+        const auto cached = resolver.resolve("sfml.test"_sv);
+        CHECK(cached.isReady());
+        CHECK(cached.getAddress() == query.getAddress());
+        CHECK(fakeLookupCount == 1);
+    }
+
+    SECTION("Failed lookups are cached")
+    {
+        const auto query = resolver.resolve("unknown.test"_sv);
+        CHECK(!query.wait().hasValue());
+        CHECK(query.getStatus() == sf::AsyncResolver::Status::Failed);
+        CHECK(resolver.getCacheSize() == 1);
+
+        const auto cached = resolver.resolve("unknown.test"_sv);
+        CHECK(cached.isReady());
+        CHECK(cached.getStatus() == sf::AsyncResolver::Status::Failed);
+        CHECK(fakeLookupCount == 1);
+    }
+
+    SECTION("Concurrent queries share a single lookup")
+    {
+        fakeLookupBlocked = true;
+
+        const auto query0 = resolver.resolve("sfml.test"_sv);
+        const auto query1 = resolver.resolve("sfml.test"_sv);
+        CHECK(!query0.isReady());
+        CHECK(!query1.isReady());
+
+        fakeLookupBlocked = false;
+
+        CHECK(query0.wait().hasValue());
+        CHECK(query1.wait() == query0.getAddress());
+        CHECK(fakeLookupCount == 1);
+        CHECK(resolver.getCacheSize() == 1);
+    }
+
+    SECTION("Expired entries are looked up again")
+    {
+        sf::AsyncResolver expiring(
+            {.positiveTtl = sf::seconds(300.f), .negativeTtl = sf::Time::Zero, .lookup = &fakeLookup});
+
+        CHECK(!expiring.resolve("unknown.test"_sv).wait().hasValue());
+        CHECK(!expiring.resolve("unknown.test"_sv).wait().hasValue());
+        CHECK(fakeLookupCount == 2);
+
+        // Successful lookups are kept for longer
+        CHECK(expiring.resolve("sfml.test"_sv).wait().hasValue());
+        CHECK(expiring.resolve("sfml.test"_sv).isReady());
+        CHECK(fakeLookupCount == 3);
+    }
+}
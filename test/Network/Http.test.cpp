@@ -1,10 +1,165 @@
 #include "SFML/Network/Http.hpp"
 
+// Other 1st party headers
+#include "SFML/Network/IpAddress.hpp"
+#include "SFML/Network/Socket.hpp"
+#include "SFML/Network/TcpListener.hpp"
+#include "SFML/Network/TcpSocket.hpp"
+
+#include "SFML/System/Sleep.hpp"
+#include "SFML/System/Time.hpp"
+
 #include <Doctest.hpp>
 
 #include <CommonTraits.hpp>
 
+#include <atomic>
+#include <functional>
+#include <mutex>
 #include <string>
+#include <thread>
+#include <vector>
+
+#include <cstdlib>
+
+namespace
+{
+////////////////////////////////////////////////////////////
+/// Minimal HTTP/1.1 stand-in server listening on the loopback interface
+///
+/// Every connection is served by its own thread. For each request
+/// received, `handler` is invoked with the raw request text and
+/// returns the raw response text. Setting `closeAfter` to `true`
+/// closes the connection once the response has been sent, and an
+/// empty response closes it without sending anything.
+////////////////////////////////////////////////////////////
+class LoopbackServer
+{
+public:
+    using Handler = std::function<std::string(const std::string& request, bool& closeAfter)>;
+
+    explicit LoopbackServer(Handler handler) : m_handler(std::move(handler))
+    {
+        REQUIRE(m_listener.listen(0, sf::IpAddress::LocalHost) == sf::Socket::Status::Done);
+        m_acceptThread = std::thread([this] { acceptLoop(); });
+    }
+
+    ~LoopbackServer()
+    {
+        m_running = false;
+        m_acceptThread.join();
+
+        for (std::thread& thread : m_connectionThreads)
+            thread.join();
+    }
+
+    [[nodiscard]] unsigned short getPort() const
+    {
+        return m_listener.getLocalPort();
+    }
+
+    [[nodiscard]] int getConnectionCount() const
+    {
+        return m_connectionCount.load();
+    }
+
+    [[nodiscard]] int getRequestCount() const
+    {
+        return m_requestCount.load();
+    }
+
+private:
+    void acceptLoop()
+    {
+        while (m_running)
+        {
+            sf::TcpSocket socket(/* isBlocking */ true);
+
+            if (m_listener.accept(socket) != sf::Socket::Status::Done)
+            {
+                sf::sleep(sf::milliseconds(1));
+                continue;
+            }
+
+            ++m_connectionCount;
+            m_connectionThreads.emplace_back([this, s = std::move(socket)]() mutable { serve(s); });
+        }
+    }
+
+    void serve(sf::TcpSocket& socket)
+    {
+        std::string buffer;
+        char        data[4096];
+        std::size_t received = 0;
+
+        while (true)
+        {
+            // Extract a complete request (header and body) from the buffer
+            const std::size_t headerEnd = buffer.find("\r\n\r\n");
+            if (headerEnd != std::string::npos)
+            {
+                std::size_t       bodySize = 0;
+                const std::size_t lengthPos = buffer.find("content-length: ");
+                if (lengthPos != std::string::npos && lengthPos < headerEnd)
+                    bodySize = std::strtoul(buffer.c_str() + lengthPos + 16, nullptr, 10);
+
+                if (buffer.size() >= headerEnd + 4 + bodySize)
+                {
+                    const std::string request = buffer.substr(0, headerEnd + 4 + bodySize);
+                    buffer.erase(0, request.size());
+                    ++m_requestCount;
+
+                    bool              closeAfter = false;
+                    const std::string response   = m_handler(request, closeAfter);
+
+                    if (response.empty() || socket.send(response.data(), response.size()) != sf::Socket::Status::Done ||
+                        closeAfter)
+                        return;
+
+                    continue;
+                }
+            }
+
+            if (socket.receive(data, sizeof(data), received) != sf::Socket::Status::Done)
+                return;
+
+            buffer.append(data, received);
+        }
+    }
+
+    Handler                  m_handler;
+    sf::TcpListener          m_listener{/* isBlocking */ false};
+    std::atomic<bool>        m_running{true};
+    std::atomic<int>         m_connectionCount{0};
+    std::atomic<int>         m_requestCount{0};
+    std::thread              m_acceptThread;
+    std::vector<std::thread> m_connectionThreads;
+};
+
+
+////////////////////////////////////////////////////////////
+[[nodiscard]] std::string getUri(const std::string& request)
+{
+    const std::size_t begin = request.find(' ') + 1;
+    return request.substr(begin, request.find(' ', begin) - begin);
+}
+
+
+////////////////////////////////////////////////////////////
+[[nodiscard]] bool wantsKeepAlive(const std::string& request)
+{
+    return request.find("connection: keep-alive") != std::string::npos;
+}
+
+
+////////////////////////////////////////////////////////////
+[[nodiscard]] std::string makeResponse(const std::string& body, bool keepAlive)
+{
+    return "HTTP/1.1 200 OK\r\nContent-Length: " + std::to_string(body.size()) +
+           (keepAlive ? "\r\n" : "\r\nConnection: close\r\n") + "\r\n" + body;
+}
+
+} // namespace
 
 TEST_CASE("[Network] sf::Http")
 {
@@ -47,4 +202,288 @@ TEST_CASE("[Network] sf::Http")
             CHECK(response.getBody().empty());
         }
     }
+
+    SECTION("Keep-alive")
+    {
+        SECTION("Defaults")
+        {
+            const sf::Http http;
+            CHECK(!http.getKeepAlive());
+            CHECK(http.getMaxConnections() == 4);
+            CHECK(http.getIdleConnectionCount() == 0);
+        }
+
+        SECTION("Max connections is clamped")
+        {
+            sf::Http http;
+            http.setMaxConnections(0);
+            CHECK(http.getMaxConnections() == 1);
+        }
+    }
+
+    SECTION("Loopback server")
+    {
+        LoopbackServer server(
+            [](const std::string& request, bool& closeAfter)
+            {
+                const std::string uri = getUri(request);
+                closeAfter            = !wantsKeepAlive(request);
+
+                if (uri == "/chunked")
+                    return std::string("HTTP/1.1 200 OK\r\nTransfer-Encoding: chunked\r\n\r\n"
+                                       "5\r\nHello\r\n"
+                                       "8;ext=1\r\n, World!\r\n"
+                                       "0\r\nX-Checksum: 42\r\n\r\n");
+
+                if (uri == "/large")
+                    return makeResponse(std::string(256 * 1024, 'x'), !closeAfter);
+
+                if (uri == "/until-close")
+                {
+                    closeAfter = true;
+                    return std::string("HTTP/1.0 200 OK\r\n\r\nno framing");
+                }
+
+                if (uri == "/close")
+                {
+                    closeAfter = true;
+                    return makeResponse(uri, /* keepAlive */ false);
+                }
+
+                if (uri == "/drop")
+                {
+                    // Advertise keep-alive but close the connection anyway
+                    closeAfter = true;
+                    return makeResponse(uri, /* keepAlive */ true);
+                }
+
+                if (uri == "/head")
+                    return std::string("HTTP/1.1 200 OK\r\nContent-Length: 1234\r\n\r\n");
+
+                if (uri == "/garbage")
+                    return std::string("garbage\r\n\r\n");
+
+                if (uri == "/vanish")
+                {
+                    // Close the connection without answering
+                    closeAfter = true;
+                    return std::string();
+                }
+
+                return makeResponse(uri, !closeAfter);
+            });
+
+        sf::Http http("127.0.0.1", server.getPort());
+
+        SECTION("Connection per request")
+        {
+            for (int i = 0; i < 3; ++i)
+            {
+                const sf::Http::Response response = http.sendRequest(sf::Http::Request("/hello"));
+                CHECK(response.getStatus() == sf::Http::Response::Status::Ok);
+                CHECK(response.getBody() == "/hello");
+            }
+
+            CHECK(http.getIdleConnectionCount() == 0);
+            CHECK(server.getConnectionCount() == 3);
+        }
+
+        SECTION("Persistent connection")
+        {
+            http.setKeepAlive(true);
+
+            for (int i = 0; i < 3; ++i)
+            {
+                const sf::Http::Response response = http.sendRequest(sf::Http::Request("/page" + std::to_string(i)));
+                CHECK(response.getStatus() == sf::Http::Response::Status::Ok);
+                CHECK(response.getBody() == "/page" + std::to_string(i));
+                CHECK(http.getIdleConnectionCount() == 1);
+            }
+
+            CHECK(server.getConnectionCount() == 1);
+            CHECK(server.getRequestCount() == 3);
+
+            http.setKeepAlive(false);
+            CHECK(http.getIdleConnectionCount() == 0);
+        }
+
+        SECTION("Server closes persistent connection")
+        {
+            http.setKeepAlive(true);
+
+            CHECK(http.sendRequest(sf::Http::Request("/close")).getBody() == "/close");
+            CHECK(http.getIdleConnectionCount() == 0);
+
+            CHECK(http.sendRequest(sf::Http::Request("/again")).getBody() == "/again");
+            CHECK(server.getConnectionCount() == 2);
+        }
+
+        SECTION("Stale pooled connection is retried")
+        {
+            http.setKeepAlive(true);
+
+            CHECK(http.sendRequest(sf::Http::Request("/drop")).getBody() == "/drop");
+            CHECK(http.getIdleConnectionCount() == 1);
+
+            const sf::Http::Response response = http.sendRequest(sf::Http::Request("/after-drop"));
+            CHECK(response.getStatus() == sf::Http::Response::Status::Ok);
+            CHECK(response.getBody() == "/after-drop");
+            CHECK(server.getConnectionCount() == 2);
+        }
+
+        SECTION("Chunked transfer encoding")
+        {
+            http.setKeepAlive(true);
+
+            const sf::Http::Response response = http.sendRequest(sf::Http::Request("/chunked"));
+            CHECK(response.getStatus() == sf::Http::Response::Status::Ok);
+            CHECK(response.getBody() == "Hello, World!");
+            CHECK(response.getField("X-Checksum") == "42");
+            CHECK(http.getIdleConnectionCount() == 1);
+        }
+
+        SECTION("Body delimited by connection close")
+        {
+            const sf::Http::Response response = http.sendRequest(sf::Http::Request("/until-close"));
+            CHECK(response.getStatus() == sf::Http::Response::Status::Ok);
+            CHECK(response.getBody() == "no framing");
+        }
+
+        SECTION("HEAD response has no body")
+        {
+            http.setKeepAlive(true);
+
+            const sf::Http::Request  request("/head", sf::Http::Request::Method::Head);
+            const sf::Http::Response response = http.sendRequest(request);
+            CHECK(response.getStatus() == sf::Http::Response::Status::Ok);
+            CHECK(response.getField("Content-Length") == "1234");
+            CHECK(response.getBody().empty());
+            CHECK(http.getIdleConnectionCount() == 1);
+        }
+
+        SECTION("Streaming body callback")
+        {
+            std::size_t totalSize = 0;
+            bool        allX      = true;
+
+            const sf::Http::Response response = http.sendRequest(sf::Http::Request("/large"),
+                                                                 [&](const char* data, std::size_t size)
+                                                                 {
+                                                                     for (std::size_t i = 0; i < size; ++i)
+                                                                         allX &= data[i] == 'x';
+
+                                                                     totalSize += size;
+                                                                     return true;
+                                                                 });
+
+            CHECK(response.getStatus() == sf::Http::Response::Status::Ok);
+            CHECK(response.getBody().empty());
+            CHECK(totalSize == 256 * 1024);
+            CHECK(allX);
+        }
+
+        SECTION("Streaming body callback can abort")
+        {
+            http.setKeepAlive(true);
+
+            const sf::Http::Response response = http.sendRequest(sf::Http::Request("/large"),
+                                                                 [](const char*, std::size_t) { return false; });
+
+            CHECK(response.getBody().empty());
+            CHECK(http.getIdleConnectionCount() == 0);
+        }
+
+        SECTION("Pipelining")
+        {
+            http.setKeepAlive(true);
+            http.setMaxConnections(2);
+
+            std::vector<sf::Http::Request> requests;
+            for (int i = 0; i < 6; ++i)
+                requests.emplace_back("/item" + std::to_string(i));
+
+            const std::vector<sf::Http::Response> responses = http.sendRequests({requests.data(), requests.size()});
+
+            REQUIRE(responses.size() == 6);
+            for (std::size_t i = 0; i < responses.size(); ++i)
+            {
+                CHECK(responses[i].getStatus() == sf::Http::Response::Status::Ok);
+                CHECK(responses[i].getBody() == "/item" + std::to_string(i));
+            }
+
+            CHECK(server.getConnectionCount() == 2);
+            CHECK(server.getRequestCount() == 6);
+            CHECK(http.getIdleConnectionCount() == 2);
+        }
+
+        SECTION("Pipelining resends requests after premature close")
+        {
+            const sf::Http::Request requests[]{sf::Http::Request("/first"),
+                                               sf::Http::Request("/close"),
+                                               sf::Http::Request("/third")};
+
+            http.setMaxConnections(1);
+            const std::vector<sf::Http::Response> responses = http.sendRequests(requests);
+
+            REQUIRE(responses.size() == 3);
+            CHECK(responses[0].getBody() == "/first");
+            CHECK(responses[1].getBody() == "/close");
+            CHECK(responses[2].getBody() == "/third");
+            CHECK(server.getConnectionCount() == 2);
+
+            // Keep-alive is disabled, pipelined connections are not kept around
+            CHECK(http.getIdleConnectionCount() == 0);
+        }
+
+        SECTION("Invalid response is reported as such")
+        {
+            const sf::Http::Response response = http.sendRequest(sf::Http::Request("/garbage"));
+            CHECK(response.getStatus() == sf::Http::Response::Status::InvalidResponse);
+        }
+
+        SECTION("POST is sent over a new connection")
+        {
+            http.setKeepAlive(true);
+
+            CHECK(http.sendRequest(sf::Http::Request("/drop")).getBody() == "/drop");
+            CHECK(http.getIdleConnectionCount() == 1);
+
+            // The pooled connection is stale, but it is not even tried
+            const sf::Http::Request  request("/post", sf::Http::Request::Method::Post, "data");
+            const sf::Http::Response response = http.sendRequest(request);
+            CHECK(response.getStatus() == sf::Http::Response::Status::Ok);
+            CHECK(response.getBody() == "/post");
+            CHECK(server.getConnectionCount() == 2);
+            CHECK(server.getRequestCount() == 2);
+        }
+
+        SECTION("Pipelining does not send POST twice")
+        {
+            const sf::Http::Request requests[]{sf::Http::Request("/first"),
+                                               sf::Http::Request("/vanish", sf::Http::Request::Method::Post, "data"),
+                                               sf::Http::Request("/third")};
+
+            http.setMaxConnections(1);
+            const std::vector<sf::Http::Response> responses = http.sendRequests(requests);
+
+            REQUIRE(responses.size() == 3);
+            CHECK(responses[0].getBody() == "/first");
+            CHECK(responses[1].getStatus() == sf::Http::Response::Status::ConnectionFailed);
+            CHECK(responses[2].getStatus() == sf::Http::Response::Status::ConnectionFailed);
+            CHECK(server.getRequestCount() == 2);
+        }
+
+        SECTION("Pipelining resends GET after dropped connection")
+        {
+            const sf::Http::Request requests[]{sf::Http::Request("/first"), sf::Http::Request("/vanish")};
+
+            http.setMaxConnections(1);
+            const std::vector<sf::Http::Response> responses = http.sendRequests(requests);
+
+            REQUIRE(responses.size() == 2);
+            CHECK(responses[0].getBody() == "/first");
+            CHECK(responses[1].getStatus() == sf::Http::Response::Status::ConnectionFailed);
+            CHECK(server.getRequestCount() == 3);
+        }
+    }
 }
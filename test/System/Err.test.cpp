@@ -2,8 +2,13 @@
 
 #include <Doctest.hpp>
 
+#include <AllocationCounter.hpp>
+
+#include <atomic>
 #include <sstream>
 #include <string>
+#include <thread>
+#include <vector>
 
 TEST_CASE("[System] sf::err")
 {
@@ -26,6 +31,7 @@ TEST_CASE("[System] sf::err")
         const std::stringstream stream;
         sf::priv::err().rdbuf(stream.rdbuf());
         sf::priv::err() << "Something went wrong!\n";
+        sf::priv::err().flush();
         CHECK(stream.str().find("Something went wrong!\n") != std::string::npos);
 
         sf::priv::err().rdbuf(nullptr);
@@ -34,6 +40,7 @@ TEST_CASE("[System] sf::err")
 
         sf::priv::err().rdbuf(stream.rdbuf());
         sf::priv::err() << "Back to the stringstream :)\n";
+        sf::priv::err().flush();
         CHECK(stream.str().find("Something went wrong!\n") != std::string::npos);
         CHECK(stream.str().find("Back to the stringstream :)\n") != std::string::npos);
 
@@ -41,4 +48,111 @@ TEST_CASE("[System] sf::err")
         sf::priv::err().rdbuf(defaultStreamBuffer);
         CHECK(sf::priv::err().rdbuf() == defaultStreamBuffer);
     }
+
+    SECTION("Messages from several threads")
+    {
+        auto* const defaultStreamBuffer = sf::priv::err().rdbuf();
+
+        const std::stringstream stream;
+        sf::priv::err().rdbuf(stream.rdbuf());
+
+        // More threads than preallocated buffers, each emitting more than fits in its buffer at once
+        std::vector<std::thread> threads;
+
+        for (int i = 0; i < 8; ++i)
+            threads.emplace_back(
+                [i]
+                {
+                    for (int j = 0; j < 100; ++j)
+                        sf::priv::err() << "thread " << i << " message " << j;
+                });
+
+        for (std::thread& thread : threads)
+            thread.join();
+
+        sf::priv::err().flush();
+
+        // Messages of a thread keep their order
+        for (int i = 0; i < 8; ++i)
+        {
+            const std::string prefix = "[[SFML ERROR]]: thread " + std::to_string(i) + " message ";
+            CHECK(stream.str().find(prefix + "0\n") < stream.str().find(prefix + "99\n"));
+        }
+
+        sf::priv::err().rdbuf(defaultStreamBuffer);
+    }
+
+    SECTION("Emitting does not allocate")
+    {
+        auto* const defaultStreamBuffer = sf::priv::err().rdbuf();
+
+        const std::stringstream stream;
+        sf::priv::err().rdbuf(stream.rdbuf());
+        sf::priv::err() << "Warm up";
+
+        const sf::base::SizeT allocationsBefore = getAllocationCount();
+        sf::priv::err() << "Buffer underrun: " << 512u << " frames, " << 0.5f << " ms";
+        CHECK(getAllocationCount() == allocationsBefore);
+
+        sf::priv::err().flush();
+        CHECK(stream.str().find("[[SFML ERROR]]: Buffer underrun: 512 frames, 0.5 ms\n") != std::string::npos);
+
+        sf::priv::err().rdbuf(defaultStreamBuffer);
+    }
+
+    SECTION("Dropped messages are counted")
+    {
+        // Holds the flusher thread in its first write, so that the buffer of this thread fills up
+        struct GatedStreamBuf : std::stringbuf
+        {
+            std::atomic<bool> open{false};
+
+            std::streamsize xsputn(const char* data, std::streamsize size) override
+            {
+                while (!open.load())
+                    std::this_thread::yield();
+
+                return std::stringbuf::xsputn(data, size);
+            }
+        };
+
+        auto* const defaultStreamBuffer = sf::priv::err().rdbuf();
+
+        GatedStreamBuf streamBuf;
+        sf::priv::err().rdbuf(&streamBuf);
+
+        for (int i = 0; i < 10'000; ++i)
+            sf::priv::err() << "message " << i;
+
+        streamBuf.open.store(true);
+        sf::priv::err().flush();
+
+        const std::string output = streamBuf.str();
+        const auto        noticePosition = output.find(" message(s) dropped, too many were emitted at once\n");
+        REQUIRE(noticePosition != std::string::npos);
+        CHECK(output.find("message 0\n") != std::string::npos);
+        CHECK(output.find("message 9999\n") == std::string::npos);
+
+        // The count follows the usual prefix
+        const std::string prefix        = "[[SFML ERROR]]: ";
+        const auto        countPosition = output.rfind(prefix, noticePosition) + prefix.size();
+        CHECK(std::stoi(output.substr(countPosition, noticePosition - countPosition)) > 0);
+
+        sf::priv::err().rdbuf(defaultStreamBuffer);
+    }
+
+    SECTION("Long message")
+    {
+        auto* const defaultStreamBuffer = sf::priv::err().rdbuf();
+
+        const std::stringstream stream;
+        sf::priv::err().rdbuf(stream.rdbuf());
+        sf::priv::err() << std::string(100'000, 'x').c_str();
+        sf::priv::err().flush();
+
+        CHECK(stream.str().size() < 100'000);
+        CHECK(stream.str().find("xxx [...]\n") != std::string::npos);
+
+        sf::priv::err().rdbuf(defaultStreamBuffer);
+    }
 }
@@ -0,0 +1,225 @@
+#include "SFML/System/JobSystem.hpp"
+
+#include "SFML/Base/Macros.hpp"
+
+#include <Doctest.hpp>
+
+#include <CommonTraits.hpp>
+
+#include <atomic>
+#include <string>
+#include <vector>
+
+TEST_CASE("[System] sf::JobSystem")
+{
+    SECTION("Type traits")
+    {
+        STATIC_CHECK(!SFML_BASE_IS_COPY_CONSTRUCTIBLE(sf::JobSystem));
+        STATIC_CHECK(!SFML_BASE_IS_COPY_ASSIGNABLE(sf::JobSystem));
+        STATIC_CHECK(SFML_BASE_IS_TRIVIALLY_COPYABLE(sf::JobHandle));
+    }
+
+    SECTION("Construction")
+    {
+        CHECK(sf::JobSystem::getDefaultWorkerCount() >= 1u);
+
+        const sf::JobSystem jobSystem(3u);
+        CHECK(jobSystem.getWorkerCount() == 3u);
+    }
+
+    SECTION("No workers")
+    {
+        sf::JobSystem jobSystem(0u);
+        std::string   order;
+
+        const sf::JobHandle a = jobSystem.schedule([&] { order += 'a'; });
+        const sf::JobHandle b = jobSystem.schedule([&] { order += 'b'; });
+        const sf::JobHandle c = jobSystem.schedule([&] { order += 'c'; }, b);
+
+        // Nothing runs until a thread waits
+        CHECK(!jobSystem.isDone(a));
+        CHECK(order.empty());
+
+        jobSystem.wait(a);
+        CHECK(jobSystem.isDone(a));
+        CHECK(order == "a");
+
+        // Jobs run in the order in which they became ready
+        const sf::JobHandle d = jobSystem.schedule([&] { order += 'd'; });
+        jobSystem.waitAll();
+
+        CHECK(jobSystem.isDone(b));
+        CHECK(jobSystem.isDone(c));
+        CHECK(jobSystem.isDone(d));
+        CHECK(order == "abdc");
+    }
+
+    SECTION("Dependencies")
+    {
+        for (const unsigned int workerCount : {0u, 1u, 4u})
+        {
+            sf::JobSystem jobSystem(workerCount);
+
+            std::atomic<int> firstCount{0};
+            std::atomic<int> firstCountSeenBySecond{-1};
+            std::atomic<int> secondCountSeenByLast{-1};
+            std::atomic<int> secondCount{0};
+
+            sf::JobHandle first[8];
+            for (sf::JobHandle& handle : first)
+                handle = jobSystem.schedule([&] { firstCount.fetch_add(1); });
+
+            sf::JobHandle second[2];
+            for (sf::JobHandle& handle : second)
+                handle = jobSystem.schedule(
+                    [&]
+                    {
+                        firstCountSeenBySecond.store(firstCount.load());
+                        secondCount.fetch_add(1);
+                    },
+                    first);
+
+            const sf::JobHandle last = jobSystem.schedule([&] { secondCountSeenByLast.store(secondCount.load()); },
+                                                          second);
+
+            jobSystem.wait(last);
+
+            CHECK(firstCountSeenBySecond.load() == 8);
+            CHECK(secondCountSeenByLast.load() == 2);
+
+            // Depending on completed jobs is allowed and does not delay the new job
+            const sf::JobHandle late = jobSystem.schedule([] {}, last);
+            jobSystem.wait(late);
+            CHECK(jobSystem.isDone(late));
+        }
+    }
+
+    SECTION("Jobs scheduling jobs")
+    {
+        sf::JobSystem    jobSystem(2u);
+        std::atomic<int> count{0};
+
+        for (int i = 0; i < 16; ++i)
+            (void)jobSystem.schedule(
+                [&]
+                {
+                    for (int j = 0; j < 16; ++j)
+                        (void)jobSystem.schedule([&] { count.fetch_add(1); });
+                });
+
+        jobSystem.waitAll();
+        CHECK(count.load() == 16 * 16);
+    }
+
+    SECTION("More jobs than slots")
+    {
+        for (const unsigned int workerCount : {0u, 3u})
+        {
+            sf::JobSystem    jobSystem(workerCount);
+            std::atomic<int> count{0};
+
+            constexpr int jobCount = static_cast<int>(sf::JobSystem::maxPendingJobs) * 3;
+
+            for (int i = 0; i < jobCount; ++i)
+                (void)jobSystem.schedule([&] { count.fetch_add(1); });
+
+            jobSystem.waitAll();
+            CHECK(count.load() == jobCount);
+        }
+    }
+
+    SECTION("Destructor waits for jobs")
+    {
+        std::atomic<int> count{0};
+
+        {
+            sf::JobSystem jobSystem(2u);
+
+            for (int i = 0; i < 100; ++i)
+                (void)jobSystem.schedule([&] { count.fetch_add(1); });
+        }
+
+        CHECK(count.load() == 100);
+    }
+
+    SECTION("parallelFor")
+    {
+        constexpr sf::base::SizeT count     = 10'000u;
+        constexpr sf::base::SizeT grainSize = 64u;
+
+        std::vector<float> values(count);
+        for (sf::base::SizeT i = 0u; i < count; ++i)
+            values[i] = 1.f / static_cast<float>(i + 1u);
+
+        // Per-chunk floating point sums, which only match across runs if chunks never change
+        const auto computeChunkSums = [&](sf::JobSystem& jobSystem)
+        {
+            std::vector<float> sums((count + grainSize - 1u) / grainSize);
+
+            jobSystem.parallelFor(count,
+                                  grainSize,
+                                  [&](sf::base::SizeT begin, sf::base::SizeT end)
+                                  {
+                                      float sum = 0.f;
+
+                                      for (sf::base::SizeT i = begin; i < end; ++i)
+                                          sum += values[i];
+
+                                      sums[begin / grainSize] = sum;
+                                  });
+
+            return sums;
+        };
+
+        sf::JobSystem noWorkers(0u);
+        sf::JobSystem fourWorkers(4u);
+
+        const std::vector<float> expected = computeChunkSums(noWorkers);
+
+        for (int run = 0; run < 10; ++run)
+            CHECK(computeChunkSums(fourWorkers) == expected);
+
+        SECTION("Every index once")
+        {
+            std::vector<std::atomic<int>> visits(count);
+
+            fourWorkers.parallelFor(count,
+                                    7u,
+                                    [&](sf::base::SizeT begin, sf::base::SizeT end)
+                                    {
+                                        for (sf::base::SizeT i = begin; i < end; ++i)
+                                            visits[i].fetch_add(1);
+                                    });
+
+            bool allOnce = true;
+            for (const std::atomic<int>& visit : visits)
+                allOnce &= visit.load() == 1;
+
+            CHECK(allOnce);
+        }
+
+        SECTION("Empty range")
+        {
+            bool called = false;
+            fourWorkers.parallelFor(0u, 16u, [&](sf::base::SizeT, sf::base::SizeT) { called = true; });
+            CHECK(!called);
+        }
+
+        SECTION("Nested")
+        {
+            std::atomic<sf::base::SizeT> total{0u};
+
+            fourWorkers.parallelFor(16u,
+                                    1u,
+                                    [&](sf::base::SizeT, sf::base::SizeT)
+                                    {
+                                        fourWorkers.parallelFor(100u,
+                                                                10u,
+                                                                [&](sf::base::SizeT begin, sf::base::SizeT end)
+                                                                { total.fetch_add(end - begin); });
+                                    });
+
+            CHECK(total.load() == 16u * 100u);
+        }
+    }
+}
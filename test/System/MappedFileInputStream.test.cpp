@@ -0,0 +1,147 @@
+#include "SFML/System/MappedFileInputStream.hpp"
+
+#include "SFML/System/Path.hpp"
+
+#include "SFML/Base/Assert.hpp"
+#include "SFML/Base/Macros.hpp"
+#include "SFML/Base/StringView.hpp"
+
+#include <Doctest.hpp>
+
+#include <CommonTraits.hpp>
+#include <StringifyOptionalUtil.hpp>
+#include <StringifyStringViewUtil.hpp>
+
+#include <fstream>
+#include <sstream>
+#include <string>
+
+namespace
+{
+sf::Path getTemporaryFilePath()
+{
+    static int counter = 0;
+
+    std::ostringstream oss;
+    oss << "sfmlmappedtemp" << counter++ << ".tmp";
+
+    return sf::Path::tempDirectoryPath() / oss.str();
+}
+
+class TemporaryFile
+{
+public:
+    // Create a temporary file with a randomly generated path, containing 'contents'.
+    explicit TemporaryFile(const std::string& contents) : m_path(getTemporaryFilePath())
+    {
+        std::ofstream ofs(m_path.to<std::string>());
+        SFML_BASE_ASSERT(ofs && "Stream encountered an error");
+
+        ofs << contents;
+        SFML_BASE_ASSERT(ofs && "Stream encountered an error");
+    }
+
+    // Close and delete the generated file.
+    ~TemporaryFile()
+    {
+        [[maybe_unused]] const bool removed = m_path.remove();
+        SFML_BASE_ASSERT(removed && "m_path failed to be removed from filesystem");
+    }
+
+    // Prevent copies.
+    TemporaryFile(const TemporaryFile&) = delete;
+
+    TemporaryFile& operator=(const TemporaryFile&) = delete;
+
+    // Return the randomly generated path.
+    [[nodiscard]] const sf::Path& getPath() const
+    {
+        return m_path;
+    }
+
+private:
+    sf::Path m_path;
+};
+} // namespace
+
+TEST_CASE("[System] sf::MappedFileInputStream")
+{
+    using namespace sf::base::literals;
+
+    SECTION("Type traits")
+    {
+        STATIC_CHECK(!SFML_BASE_IS_DEFAULT_CONSTRUCTIBLE(sf::MappedFileInputStream));
+        STATIC_CHECK(!SFML_BASE_IS_COPY_CONSTRUCTIBLE(sf::MappedFileInputStream));
+        STATIC_CHECK(!SFML_BASE_IS_COPY_ASSIGNABLE(sf::MappedFileInputStream));
+        STATIC_CHECK(SFML_BASE_IS_NOTHROW_MOVE_CONSTRUCTIBLE(sf::MappedFileInputStream));
+        STATIC_CHECK(SFML_BASE_IS_NOTHROW_MOVE_ASSIGNABLE(sf::MappedFileInputStream));
+    }
+
+    const TemporaryFile temporaryFile("Hello world");
+    char                buffer[32];
+
+    SECTION("Missing file")
+    {
+        CHECK(!sf::MappedFileInputStream::open(sf::Path::tempDirectoryPath() / "sfmlmappedmissing.tmp").hasValue());
+    }
+
+    SECTION("Empty file")
+    {
+        const TemporaryFile emptyFile("");
+
+        auto mappedFileInputStream = sf::MappedFileInputStream::open(emptyFile.getPath()).value();
+        CHECK(mappedFileInputStream.getSize().value() == 0);
+        CHECK(mappedFileInputStream.getDataSize() == 0);
+        CHECK(mappedFileInputStream.read(buffer, 5).value() == 0);
+    }
+
+    SECTION("Move semantics")
+    {
+        SECTION("Move constructor")
+        {
+            auto movedMappedFileInputStream = sf::MappedFileInputStream::open(temporaryFile.getPath()).value();
+            CHECK(movedMappedFileInputStream.read(buffer, 6).value() == 6);
+
+            sf::MappedFileInputStream mappedFileInputStream = SFML_BASE_MOVE(movedMappedFileInputStream);
+            CHECK(mappedFileInputStream.tell().value() == 6);
+            CHECK(mappedFileInputStream.getSize().value() == 11);
+            CHECK(mappedFileInputStream.read(buffer, 5).value() == 5);
+            CHECK(sf::base::StringView(buffer, 5) == "world"_sv);
+        }
+
+        SECTION("Move assignment")
+        {
+            auto movedMappedFileInputStream = sf::MappedFileInputStream::open(temporaryFile.getPath()).value();
+            const TemporaryFile temporaryFile2("Hello world the sequel");
+            auto mappedFileInputStream = sf::MappedFileInputStream::open(temporaryFile2.getPath()).value();
+            mappedFileInputStream      = SFML_BASE_MOVE(movedMappedFileInputStream);
+            CHECK(mappedFileInputStream.read(buffer, 6).value() == 6);
+            CHECK(mappedFileInputStream.tell().value() == 6);
+            CHECK(mappedFileInputStream.getSize().value() == 11);
+            CHECK(sf::base::StringView(buffer, 6) == "Hello "_sv);
+        }
+    }
+
+    SECTION("Temporary file stream")
+    {
+        auto mappedFileInputStream = sf::MappedFileInputStream::open(temporaryFile.getPath()).value();
+        CHECK(mappedFileInputStream.read(buffer, 5).value() == 5);
+        CHECK(mappedFileInputStream.tell().value() == 5);
+        CHECK(mappedFileInputStream.getSize().value() == 11);
+        CHECK(sf::base::StringView(buffer, 5) == "Hello"_sv);
+        CHECK(mappedFileInputStream.seek(6).value() == 6);
+        CHECK(mappedFileInputStream.tell().value() == 6);
+        CHECK(mappedFileInputStream.read(buffer, 32).value() == 5);
+        CHECK(sf::base::StringView(buffer, 5) == "world"_sv);
+        CHECK(mappedFileInputStream.seek(1'000).value() == 11);
+    }
+
+    SECTION("Direct access")
+    {
+        const auto mappedFileInputStream = sf::MappedFileInputStream::open(temporaryFile.getPath()).value();
+        REQUIRE(mappedFileInputStream.getData() != nullptr);
+        CHECK(mappedFileInputStream.getDataSize() == 11);
+        CHECK(sf::base::StringView(static_cast<const char*>(mappedFileInputStream.getData()),
+                                   mappedFileInputStream.getDataSize()) == "Hello world"_sv);
+    }
+}
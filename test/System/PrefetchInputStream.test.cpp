@@ -0,0 +1,141 @@
+#include "SFML/System/PrefetchInputStream.hpp"
+
+#include "SFML/System/MemoryInputStream.hpp"
+
+#include "SFML/Base/Macros.hpp"
+#include "SFML/Base/StringView.hpp"
+
+#include <Doctest.hpp>
+
+#include <CommonTraits.hpp>
+#include <StringifyStringViewUtil.hpp>
+
+TEST_CASE("[System] sf::PrefetchInputStream")
+{
+    SECTION("Type traits")
+    {
+        STATIC_CHECK(!SFML_BASE_IS_COPY_CONSTRUCTIBLE(sf::PrefetchInputStream));
+        STATIC_CHECK(!SFML_BASE_IS_COPY_ASSIGNABLE(sf::PrefetchInputStream));
+        STATIC_CHECK(SFML_BASE_IS_NOTHROW_MOVE_CONSTRUCTIBLE(sf::PrefetchInputStream));
+        STATIC_CHECK(SFML_BASE_IS_NOTHROW_MOVE_ASSIGNABLE(sf::PrefetchInputStream));
+    }
+
+    using namespace sf::base::literals;
+
+    // Small blocks, so that the tests cross block boundaries
+    static constexpr sf::base::SizeT blockSize = 4u;
+    static constexpr auto            input     = "We Love SFML and its streams!"_sv;
+
+    sf::MemoryInputStream source(input.data(), input.size());
+
+    SECTION("Construction")
+    {
+        sf::PrefetchInputStream prefetchInputStream(source, blockSize);
+        CHECK(prefetchInputStream.tell().value() == 0);
+        CHECK(prefetchInputStream.getSize().value() == input.size());
+    }
+
+    SECTION("Empty source")
+    {
+        sf::MemoryInputStream   emptySource(input.data(), 0);
+        sf::PrefetchInputStream prefetchInputStream(emptySource, blockSize);
+        CHECK(prefetchInputStream.getSize().value() == 0);
+
+        char output[8]{};
+        CHECK(prefetchInputStream.read(output, 8).value() == 0);
+        CHECK(prefetchInputStream.tell().value() == 0);
+    }
+
+    SECTION("read()")
+    {
+        sf::PrefetchInputStream prefetchInputStream(source, blockSize);
+        char                    output[64]{};
+
+        SECTION("Within a block")
+        {
+            CHECK(prefetchInputStream.read(output, 2).value() == 2);
+            CHECK(sf::base::StringView(output, 2) == "We"_sv);
+            CHECK(prefetchInputStream.tell().value() == 2);
+        }
+
+        SECTION("Across blocks")
+        {
+            CHECK(prefetchInputStream.read(output, 13).value() == 13);
+            CHECK(sf::base::StringView(output, 13) == "We Love SFML "_sv);
+            CHECK(prefetchInputStream.tell().value() == 13);
+        }
+
+        SECTION("Byte by byte")
+        {
+            for (sf::base::SizeT i = 0u; i < input.size(); ++i)
+                CHECK(prefetchInputStream.read(output + i, 1).value() == 1);
+
+            CHECK(sf::base::StringView(output, input.size()) == input);
+            CHECK(prefetchInputStream.read(output, 1).value() == 0);
+        }
+
+        SECTION("Beyond input")
+        {
+            CHECK(prefetchInputStream.read(output, 64).value() == input.size());
+            CHECK(sf::base::StringView(output, input.size()) == input);
+            CHECK(prefetchInputStream.tell().value() == input.size());
+            CHECK(prefetchInputStream.read(output, 64).value() == 0);
+        }
+    }
+
+    SECTION("seek()")
+    {
+        sf::PrefetchInputStream prefetchInputStream(source, blockSize);
+        char                    output[64]{};
+
+        SECTION("Forward, outside the read-ahead blocks")
+        {
+            CHECK(prefetchInputStream.seek(17).value() == 17);
+            CHECK(prefetchInputStream.read(output, 3).value() == 3);
+            CHECK(sf::base::StringView(output, 3) == "its"_sv);
+            CHECK(prefetchInputStream.tell().value() == 20);
+        }
+
+        SECTION("Backward")
+        {
+            CHECK(prefetchInputStream.seek(8).value() == 8);
+            CHECK(prefetchInputStream.read(output, 4).value() == 4);
+            CHECK(sf::base::StringView(output, 4) == "SFML"_sv);
+
+            CHECK(prefetchInputStream.seek(3).value() == 3);
+            CHECK(prefetchInputStream.read(output, 4).value() == 4);
+            CHECK(sf::base::StringView(output, 4) == "Love"_sv);
+        }
+
+        SECTION("Beyond input")
+        {
+            CHECK(prefetchInputStream.seek(1'000).value() == input.size());
+            CHECK(prefetchInputStream.tell().value() == input.size());
+            CHECK(prefetchInputStream.read(output, 4).value() == 0);
+        }
+    }
+
+    SECTION("Owning constructor")
+    {
+        sf::PrefetchInputStream prefetchInputStream(sf::base::makeUnique<sf::MemoryInputStream>(input.data(),
+                                                                                                input.size()),
+                                                    blockSize);
+
+        char output[64]{};
+        CHECK(prefetchInputStream.read(output, 64).value() == input.size());
+        CHECK(sf::base::StringView(output, input.size()) == input);
+    }
+
+    SECTION("Move semantics")
+    {
+        sf::PrefetchInputStream prefetchInputStream(source, blockSize);
+
+        char output[64]{};
+        CHECK(prefetchInputStream.read(output, 3).value() == 3);
+
+        sf::PrefetchInputStream movedPrefetchInputStream(SFML_BASE_MOVE(prefetchInputStream));
+        CHECK(movedPrefetchInputStream.tell().value() == 3);
+        CHECK(movedPrefetchInputStream.read(output, 4).value() == 4);
+        CHECK(sf::base::StringView(output, 4) == "Love"_sv);
+    }
+}
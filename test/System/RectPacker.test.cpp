@@ -7,6 +7,9 @@
 #include <CommonTraits.hpp>
 #include <SystemUtil.hpp>
 
+#include <random>
+#include <vector>
+
 namespace
 {
 ////////////////////////////////////////////////////////////
@@ -18,6 +21,43 @@ void checkPack(sf::RectPacker& rectPacker, sf::Vector2u size, sf::Vector2u posit
     CHECK(p0->y == position.y);
 }
 
+////////////////////////////////////////////////////////////
+// Marks the packed rectangles on a grid, failing on overlaps
+class Coverage
+{
+public:
+    explicit Coverage(sf::Vector2u size) : m_size(size), m_cells(size.x * size.y)
+    {
+    }
+
+    void mark(sf::Vector2u position, sf::Vector2u size, bool covered)
+    {
+        REQUIRE(position.x + size.x <= m_size.x);
+        REQUIRE(position.y + size.y <= m_size.y);
+
+        for (unsigned int y = position.y; y < position.y + size.y; ++y)
+            for (unsigned int x = position.x; x < position.x + size.x; ++x)
+            {
+                REQUIRE(m_cells[y * m_size.x + x] != covered);
+                m_cells[y * m_size.x + x] = covered;
+            }
+    }
+
+    [[nodiscard]] float getOccupancy() const
+    {
+        std::size_t coveredCount = 0;
+
+        for (const bool cell : m_cells)
+            coveredCount += cell;
+
+        return static_cast<float>(coveredCount) / static_cast<float>(m_cells.size());
+    }
+
+private:
+    sf::Vector2u      m_size;
+    std::vector<bool> m_cells;
+};
+
 } // namespace
 
 TEST_CASE("[System] sf::RectPacker", "")
@@ -69,4 +109,140 @@ TEST_CASE("[System] sf::RectPacker", "")
         CHECK(!rectPacker.pack({1u, 1u}));
         CHECK(!rectPacker.pack({64u, 64u}));
     }
+
+    SECTION("Occupancy")
+    {
+        sf::RectPacker rectPacker({128u, 128u});
+        CHECK(rectPacker.getOccupancy() == 0.f);
+
+        checkPack(rectPacker, {64u, 64u}, {0u, 0u});
+        CHECK(rectPacker.getOccupancy() == 0.25f);
+
+        checkPack(rectPacker, {128u, 32u}, {0u, 64u});
+        CHECK(rectPacker.getOccupancy() == 0.5f);
+    }
+
+    SECTION("No node limit")
+    {
+        // Alternating heights give the skyline one segment per rectangle
+        sf::RectPacker rectPacker({5000u, 2u});
+
+        for (unsigned int i = 0u; i < 5000u; ++i)
+            REQUIRE(rectPacker.pack({1u, 1u + i % 2u}) == sf::base::makeOptional(sf::Vector2u{i, 0u}));
+
+        checkPack(rectPacker, {1u, 1u}, {0u, 1u});
+        CHECK(!rectPacker.pack({2u, 1u}));
+    }
+
+    SECTION("remove()")
+    {
+        sf::RectPacker rectPacker({128u, 128u});
+
+        checkPack(rectPacker, {64u, 64u}, {0u, 0u});
+        checkPack(rectPacker, {64u, 64u}, {64u, 0u});
+        checkPack(rectPacker, {64u, 64u}, {0u, 64u});
+        checkPack(rectPacker, {64u, 64u}, {64u, 64u});
+
+        SECTION("Full area")
+        {
+            sf::RectPacker fullPacker({128u, 128u});
+
+            checkPack(fullPacker, {128u, 128u}, {0u, 0u});
+            fullPacker.remove({0u, 0u}, {128u, 128u});
+            CHECK(fullPacker.getOccupancy() == 0.f);
+            checkPack(fullPacker, {128u, 128u}, {0u, 0u});
+        }
+
+        SECTION("Adjacent free rectangles are merged")
+        {
+            rectPacker.remove({0u, 0u}, {64u, 64u});
+            rectPacker.remove({64u, 0u}, {64u, 64u});
+            CHECK(rectPacker.getOccupancy() == 0.5f);
+
+            checkPack(rectPacker, {128u, 64u}, {0u, 0u});
+            CHECK(!rectPacker.pack({1u, 1u}));
+        }
+
+        SECTION("Space below the skyline is given back to it")
+        {
+            rectPacker.remove({0u, 0u}, {64u, 64u});
+            rectPacker.remove({0u, 64u}, {64u, 64u});
+            CHECK(rectPacker.getOccupancy() == 0.5f);
+
+            checkPack(rectPacker, {64u, 128u}, {0u, 0u});
+            CHECK(rectPacker.getOccupancy() == 1.f);
+        }
+
+        SECTION("Partially reused free rectangle")
+        {
+            rectPacker.remove({64u, 64u}, {64u, 64u});
+
+            checkPack(rectPacker, {32u, 64u}, {64u, 64u});
+            checkPack(rectPacker, {32u, 64u}, {96u, 64u});
+            CHECK(!rectPacker.pack({1u, 1u}));
+        }
+    }
+
+    SECTION("packMany()")
+    {
+        const std::vector<sf::Vector2u> sizes{{10u, 5u}, {0u, 3u}, {20u, 30u}, {10u, 30u}, {200u, 1u}, {30u, 10u}};
+        std::vector<sf::base::Optional<sf::Vector2u>> positions(sizes.size());
+
+        sf::RectPacker rectPacker({64u, 64u});
+        CHECK(rectPacker.packMany({sizes.data(), sizes.size()}, {positions.data(), positions.size()}) == 4u);
+
+        // Tallest first
+        CHECK(positions[2] == sf::base::makeOptional(sf::Vector2u{0u, 0u}));
+        CHECK(positions[3] == sf::base::makeOptional(sf::Vector2u{20u, 0u}));
+        CHECK(positions[5] == sf::base::makeOptional(sf::Vector2u{30u, 0u}));
+        CHECK(positions[0] == sf::base::makeOptional(sf::Vector2u{30u, 10u}));
+
+        // Zero-sized and too large
+        CHECK(!positions[1].hasValue());
+        CHECK(!positions[4].hasValue());
+    }
+
+    SECTION("Random packs and removals")
+    {
+        constexpr sf::Vector2u size{256u, 256u};
+
+        std::minstd_rand rng(42u);
+        sf::RectPacker   rectPacker(size);
+        Coverage         coverage(size);
+
+        struct Packed
+        {
+            sf::Vector2u position;
+            sf::Vector2u size;
+        };
+
+        std::vector<Packed> packed;
+
+        for (int i = 0; i < 4000; ++i)
+        {
+            if (!packed.empty() && rng() % 3u == 0u)
+            {
+                const std::size_t index = rng() % packed.size();
+
+                rectPacker.remove(packed[index].position, packed[index].size);
+                coverage.mark(packed[index].position, packed[index].size, false);
+
+                packed[index] = packed.back();
+                packed.pop_back();
+            }
+            else
+            {
+                const sf::Vector2u rectSize{1u + static_cast<unsigned int>(rng() % 24u),
+                                            1u + static_cast<unsigned int>(rng() % 24u)};
+
+                if (const auto position = rectPacker.pack(rectSize))
+                {
+                    coverage.mark(*position, rectSize, true);
+                    packed.push_back({*position, rectSize});
+                }
+            }
+
+            REQUIRE(rectPacker.getOccupancy() == doctest::Approx(coverage.getOccupancy()));
+        }
+    }
 }
@@ -3,16 +3,21 @@
 #include "SFML/System/StringUtfUtils.hpp"
 
 #include "SFML/Base/Assert.hpp"
+#include "SFML/Base/Macros.hpp"
 
 #include <Doctest.hpp>
 
+#include <AllocationCounter.hpp>
 #include <CommonTraits.hpp>
 #include <GraphicsUtil.hpp>
 #include <StringifyStringUtil.hpp>
 
+#include <iterator>
 #include <sstream>
 #include <string>
 
+#include <cstdio>
+
 namespace
 {
 // Return either argument depending on whether wchar_t is 16 or 32 bits
@@ -231,6 +236,25 @@ TEST_CASE("[System] sf::String")
             CHECK(string.getSize() == 1);
             CHECK(string[0] == defaultReplacementCharacter);
         }
+
+        SECTION("Input iterators")
+        {
+            std::stringbuf   buffer("w\xC3\xB1yz\xF4\x84\x8C\xA1");
+            const sf::String string = sf::StringUtfUtils::fromUtf8(std::istreambuf_iterator<char>(&buffer),
+                                                                   std::istreambuf_iterator<char>());
+            CHECK(string.toUtf32<std::u32string>() == U"w\xF1yz\U00104321"s);
+        }
+
+        SECTION("Input iterators with insufficient input")
+        {
+            std::stringbuf     buffer("wx\xF4\x84");
+            const sf::String   string = sf::StringUtfUtils::fromUtf8(std::istreambuf_iterator<char>(&buffer),
+                                                                   std::istreambuf_iterator<char>());
+            constexpr char32_t defaultReplacementCharacter = 0;
+            CHECK(string.getSize() == 3);
+            CHECK(string.toUtf32<std::u32string>().substr(0, 2) == U"wx"s);
+            CHECK(string[2] == defaultReplacementCharacter);
+        }
     }
 
     SECTION("fromUtf16()")
@@ -247,6 +271,15 @@ TEST_CASE("[System] sf::String")
         CHECK(string.getData() != nullptr);
     }
 
+    SECTION("fromUtf16() with input iterators")
+    {
+        std::basic_stringbuf<char16_t> buffer(u"\xF1xy\U00104321"s);
+        const sf::String string = sf::StringUtfUtils::fromUtf16(std::istreambuf_iterator<char16_t>(&buffer),
+                                                                std::istreambuf_iterator<char16_t>());
+        CHECK(string.toUtf32<std::u32string>() == U"\xF1xy\U00104321"s);
+        CHECK(string.getSize() == 4);
+    }
+
     SECTION("fromUtf32()")
     {
         constexpr sf::base::U32 characters[4]{'w', 0x104321, 'y', 'z'};
@@ -261,6 +294,16 @@ TEST_CASE("[System] sf::String")
         CHECK(string.getData() != nullptr);
     }
 
+    SECTION("fromUtf32() with input iterators")
+    {
+        // Long enough to outgrow the inline storage while appending
+        const std::u32string            source = U"w\U00104321yz, and then some more characters"s;
+        std::basic_stringbuf<char32_t> buffer(source);
+        const sf::String string = sf::StringUtfUtils::fromUtf32(std::istreambuf_iterator<char32_t>(&buffer),
+                                                                std::istreambuf_iterator<char32_t>());
+        CHECK(string.toUtf32<std::u32string>() == source);
+    }
+
     SECTION("clear()")
     {
         sf::String string("you'll never guess what happens when you call clear()");
@@ -337,6 +380,75 @@ TEST_CASE("[System] sf::String")
         CHECK(string == "xxxxxxxxxxxxxxxxxxxxxxxx");
     }
 
+    SECTION("Small buffer")
+    {
+        SECTION("Short strings")
+        {
+            const std::string ansiString = "HP: 100";
+
+            const sf::base::SizeT allocationsBefore = getAllocationCount();
+
+            sf::String       string("HP: 100");
+            const sf::String fromAnsiString(ansiString);
+            const sf::String fromUtf32(U"HP: 100");
+            const sf::String fromUtf8 = sf::StringUtfUtils::fromUtf8(ansiString.begin(), ansiString.end());
+            sf::String       copy     = string;
+            const sf::String moved    = SFML_BASE_MOVE(copy);
+            string += sf::String("/250");
+            copy = string;
+
+            CHECK(getAllocationCount() == allocationsBefore);
+            CHECK(fromAnsiString == moved);
+            CHECK(fromUtf32 == moved);
+            CHECK(fromUtf8 == moved);
+            CHECK(copy.toAnsiString<std::string>() == "HP: 100/250"s);
+        }
+
+        SECTION("Long strings")
+        {
+            sf::String string("HP: 100/250");
+
+            const sf::base::SizeT allocationsBefore = getAllocationCount();
+
+            string += sf::String('!');
+            CHECK(getAllocationCount() == allocationsBefore + 1);
+
+            const sf::String copy = string;
+            CHECK(getAllocationCount() == allocationsBefore + 2);
+
+            sf::String moved = SFML_BASE_MOVE(string);
+            CHECK(getAllocationCount() == allocationsBefore + 2);
+            CHECK(moved == copy);
+            CHECK(moved.toAnsiString<std::string>() == "HP: 100/250!"s);
+
+            moved.insert(0, moved);
+            CHECK(moved.toAnsiString<std::string>() == "HP: 100/250!HP: 100/250!"s);
+            moved.erase(4, 16);
+            CHECK(moved.toAnsiString<std::string>() == "HP: 250!"s);
+        }
+
+        SECTION("Construction and copy")
+        {
+            // Labels rebuilt every frame by a HUD never touch the heap
+            char            buffer[16]{};
+            sf::base::SizeT totalSize = 0;
+
+            const sf::base::SizeT allocationsBefore = getAllocationCount();
+
+            for (int i = 0; i < 10'000; ++i)
+            {
+                std::snprintf(buffer, sizeof(buffer), "HP: %d", i);
+
+                const sf::String label(buffer);
+                const sf::String copy = label;
+                totalSize += copy.getSize();
+            }
+
+            CHECK(getAllocationCount() == allocationsBefore);
+            CHECK(totalSize == 78'890);
+        }
+    }
+
     SECTION("Operators")
     {
         SECTION("operator+=")
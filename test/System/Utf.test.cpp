@@ -0,0 +1,149 @@
+#include "SFML/System/Utf.hpp"
+
+#include "SFML/System/String.hpp"
+#include "SFML/System/StringUtfUtils.hpp"
+
+#include "SFML/Base/Algorithm.hpp"
+
+#include <Doctest.hpp>
+
+#include <StringifyStringUtil.hpp>
+
+#include <list>
+#include <random>
+#include <string>
+
+namespace
+{
+// Decode through a non-contiguous range, which always takes the code point by code point path
+template <typename Utf, typename CharT>
+std::u32string decodeSlowly(const std::basic_string<CharT>& input)
+{
+    const std::list<CharT> list(input.begin(), input.end());
+
+    std::u32string output;
+    Utf::toUtf32(list.begin(), list.end(), sf::base::BackInserter(output));
+    return output;
+}
+
+template <typename Utf, typename CharT>
+std::u32string decodeToPointer(const std::basic_string<CharT>& input)
+{
+    std::u32string output(input.size(), U'\0');
+    output.resize(static_cast<std::size_t>(Utf::toUtf32(input.data(), input.data() + input.size(), output.data()) -
+                                           output.data()));
+    return output;
+}
+
+template <typename Utf, typename CharT>
+std::u32string decodeToInserter(const std::basic_string<CharT>& input)
+{
+    std::u32string output;
+    Utf::toUtf32(input.begin(), input.end(), sf::base::BackInserter(output));
+    return output;
+}
+
+// Random text mostly made of ASCII, with multi-byte characters placed at every offset over a few SIMD blocks
+std::u32string makeText(std::minstd_rand& rng, std::size_t length)
+{
+    constexpr char32_t samples[]{U'é', U'€', U'中', U'😀', U'\U0010FFFF', U'￿', U'\u0080', U'߿'};
+
+    std::u32string text;
+
+    for (std::size_t i = 0; i < length; ++i)
+        text += rng() % 8 == 0 ? samples[rng() % 8] : static_cast<char32_t>(U' ' + rng() % 95);
+
+    return text;
+}
+} // namespace
+
+TEST_CASE("[System] sf::Utf")
+{
+    std::minstd_rand rng(42u);
+
+    SECTION("UTF-8 to UTF-32")
+    {
+        SECTION("ASCII")
+        {
+            const std::string input = "The quick brown fox jumps over the lazy dog, 0123456789 times!";
+            const auto        expected = std::u32string(input.begin(), input.end());
+
+            CHECK(decodeSlowly<sf::Utf8>(input) == expected);
+            CHECK(decodeToPointer<sf::Utf8>(input) == expected);
+            CHECK(decodeToInserter<sf::Utf8>(input) == expected);
+        }
+
+        SECTION("Mixed")
+        {
+            for (std::size_t length = 0; length < 150; ++length)
+            {
+                const std::u32string text = makeText(rng, length);
+
+                std::string input;
+                sf::Utf32::toUtf8(text.begin(), text.end(), sf::base::BackInserter(input));
+
+                CHECK(decodeSlowly<sf::Utf8>(input) == text);
+                CHECK(decodeToPointer<sf::Utf8>(input) == text);
+                CHECK(decodeToInserter<sf::Utf8>(input) == text);
+            }
+        }
+
+        SECTION("Incomplete character")
+        {
+            for (std::size_t prefix = 0; prefix < 40; ++prefix)
+            {
+                const std::string input = std::string(prefix, 'a') + "\xE2\x82";
+
+                CHECK(decodeToPointer<sf::Utf8>(input) == decodeSlowly<sf::Utf8>(input));
+                CHECK(decodeToInserter<sf::Utf8>(input).back() == U'\0');
+            }
+        }
+    }
+
+    SECTION("UTF-16 to UTF-32")
+    {
+        SECTION("Mixed")
+        {
+            for (std::size_t length = 0; length < 150; ++length)
+            {
+                const std::u32string text = makeText(rng, length);
+
+                std::u16string input;
+                sf::Utf32::toUtf16(text.begin(), text.end(), sf::base::BackInserter(input));
+
+                CHECK(decodeSlowly<sf::Utf16>(input) == text);
+                CHECK(decodeToPointer<sf::Utf16>(input) == text);
+                CHECK(decodeToInserter<sf::Utf16>(input) == text);
+            }
+        }
+
+        SECTION("Unpaired surrogates")
+        {
+            for (std::size_t prefix = 0; prefix < 20; ++prefix)
+            {
+                for (const std::u16string suffix : {u"\xDC00x", u"\xD800x", u"\xD800"})
+                {
+                    const std::u16string input = std::u16string(prefix, u'a') + suffix;
+
+                    CHECK(decodeToPointer<sf::Utf16>(input) == decodeSlowly<sf::Utf16>(input));
+                    CHECK(decodeToInserter<sf::Utf16>(input) == decodeSlowly<sf::Utf16>(input));
+                }
+            }
+        }
+    }
+
+    SECTION("sf::StringUtfUtils")
+    {
+        const std::u32string text = makeText(rng, 100);
+
+        std::string utf8;
+        sf::Utf32::toUtf8(text.begin(), text.end(), sf::base::BackInserter(utf8));
+
+        std::u16string utf16;
+        sf::Utf32::toUtf16(text.begin(), text.end(), sf::base::BackInserter(utf16));
+
+        CHECK(sf::StringUtfUtils::fromUtf8(utf8.begin(), utf8.end()).toUtf32<std::u32string>() == text);
+        CHECK(sf::StringUtfUtils::fromUtf16(utf16.begin(), utf16.end()).toUtf32<std::u32string>() == text);
+        CHECK(sf::StringUtfUtils::fromUtf8(utf8.end(), utf8.end()).isEmpty());
+    }
+}
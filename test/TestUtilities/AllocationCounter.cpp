@@ -0,0 +1,68 @@
+#include "AllocationCounter.hpp"
+
+#include <atomic>
+#include <new>
+
+#include <cstdlib>
+
+
+namespace
+{
+std::atomic<sf::base::SizeT> allocationCount{0u};
+
+
+void* countedAllocate(std::size_t size)
+{
+    allocationCount.fetch_add(1u, std::memory_order_relaxed);
+
+    if (void* ptr = std::malloc(size == 0u ? 1u : size))
+        return ptr;
+
+    throw std::bad_alloc{};
+}
+
+} // namespace
+
+
+sf::base::SizeT getAllocationCount()
+{
+    return allocationCount.load(std::memory_order_relaxed);
+}
+
+
+// NOLINTBEGIN(misc-new-delete-overloads)
+void* operator new(std::size_t size)
+{
+    return countedAllocate(size);
+}
+
+
+void* operator new[](std::size_t size)
+{
+    return countedAllocate(size);
+}
+
+
+void operator delete(void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+
+void operator delete[](void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+
+void operator delete(void* ptr, std::size_t) noexcept
+{
+    std::free(ptr);
+}
+
+
+void operator delete[](void* ptr, std::size_t) noexcept
+{
+    std::free(ptr);
+}
+// NOLINTEND(misc-new-delete-overloads)
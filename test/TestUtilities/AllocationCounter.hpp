@@ -0,0 +1,14 @@
+// Header for SFML unit tests.
+//
+// Replaces the global allocation functions with counting ones in every test
+// executable that uses `getAllocationCount`, to verify that code is allocation-free.
+
+#pragma once
+
+#include "SFML/Base/SizeT.hpp"
+
+
+////////////////////////////////////////////////////////////
+/// \brief Number of calls to the global `operator new` so far, across all threads
+///
+[[nodiscard]] sf::base::SizeT getAllocationCount();
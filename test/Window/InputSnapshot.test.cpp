@@ -0,0 +1,106 @@
+#include "SFML/Window/InputSnapshot.hpp"
+
+// Other 1st party headers
+#include "SFML/Window/Event.hpp"
+
+#include <Doctest.hpp>
+
+#include <CommonTraits.hpp>
+#include <SystemUtil.hpp>
+#include <WindowUtil.hpp>
+
+
+TEST_CASE("[Window] sf::InputSnapshot")
+{
+    SECTION("Type traits")
+    {
+        STATIC_CHECK(SFML_BASE_IS_DEFAULT_CONSTRUCTIBLE(sf::InputSnapshot));
+        STATIC_CHECK(SFML_BASE_IS_COPY_CONSTRUCTIBLE(sf::InputSnapshot));
+        STATIC_CHECK(SFML_BASE_IS_COPY_ASSIGNABLE(sf::InputSnapshot));
+        STATIC_CHECK(SFML_BASE_IS_NOTHROW_MOVE_CONSTRUCTIBLE(sf::InputSnapshot));
+        STATIC_CHECK(SFML_BASE_IS_NOTHROW_MOVE_ASSIGNABLE(sf::InputSnapshot));
+        STATIC_CHECK(SFML_BASE_IS_TRIVIALLY_COPYABLE(sf::InputSnapshot));
+    }
+
+    sf::InputSnapshot snapshot;
+
+    SECTION("Default constructor")
+    {
+        CHECK(!snapshot.isKeyPressed(sf::Keyboard::Key::A));
+        CHECK(!snapshot.isKeyPressed(sf::Keyboard::Scan::A));
+        CHECK(!snapshot.isButtonPressed(sf::Mouse::Button::Left));
+        CHECK(snapshot.getMousePosition() == sf::Vector2i{});
+        CHECK(snapshot.getRelativeMousePosition() == sf::Vector2i{});
+    }
+
+    SECTION("Setters")
+    {
+        snapshot.setKeyPressed(sf::Keyboard::Key::W, true);
+        snapshot.setKeyPressed(sf::Keyboard::Scan::S, true);
+        snapshot.setButtonPressed(sf::Mouse::Button::Right, true);
+        snapshot.setMousePosition({100, 200}, {10, 20});
+
+        CHECK(snapshot.isKeyPressed(sf::Keyboard::Key::W));
+        CHECK(!snapshot.isKeyPressed(sf::Keyboard::Scan::W));
+        CHECK(snapshot.isKeyPressed(sf::Keyboard::Scan::S));
+        CHECK(!snapshot.isKeyPressed(sf::Keyboard::Key::S));
+        CHECK(snapshot.isButtonPressed(sf::Mouse::Button::Right));
+        CHECK(!snapshot.isButtonPressed(sf::Mouse::Button::Left));
+        CHECK(snapshot.getMousePosition() == sf::Vector2i{100, 200});
+        CHECK(snapshot.getRelativeMousePosition() == sf::Vector2i{10, 20});
+
+        snapshot.releaseAll();
+        CHECK(!snapshot.isKeyPressed(sf::Keyboard::Key::W));
+        CHECK(!snapshot.isKeyPressed(sf::Keyboard::Scan::S));
+        CHECK(!snapshot.isButtonPressed(sf::Mouse::Button::Right));
+        CHECK(snapshot.getMousePosition() == sf::Vector2i{100, 200});
+    }
+
+    SECTION("Unknown keys are never pressed")
+    {
+        snapshot.setKeyPressed(sf::Keyboard::Key::Unknown, true);
+        snapshot.setKeyPressed(sf::Keyboard::Scan::Unknown, true);
+
+        CHECK(!snapshot.isKeyPressed(sf::Keyboard::Key::Unknown));
+        CHECK(!snapshot.isKeyPressed(sf::Keyboard::Scan::Unknown));
+    }
+
+    SECTION("applyEvent")
+    {
+        snapshot.applyEvent(sf::Event::KeyPressed{sf::Keyboard::Key::Q, sf::Keyboard::Scan::A});
+        CHECK(snapshot.isKeyPressed(sf::Keyboard::Key::Q));
+        CHECK(snapshot.isKeyPressed(sf::Keyboard::Scan::A));
+
+        snapshot.applyEvent(sf::Event::MouseButtonPressed{sf::Mouse::Button::Middle, {5, 6}});
+        CHECK(snapshot.isButtonPressed(sf::Mouse::Button::Middle));
+        CHECK(snapshot.getRelativeMousePosition() == sf::Vector2i{5, 6});
+
+        snapshot.applyEvent(sf::Event::MouseMoved{{7, 8}});
+        CHECK(snapshot.getRelativeMousePosition() == sf::Vector2i{7, 8});
+        CHECK(snapshot.getMousePosition() == sf::Vector2i{});
+
+        snapshot.applyEvent(sf::Event::KeyReleased{sf::Keyboard::Key::Q, sf::Keyboard::Scan::A});
+        CHECK(!snapshot.isKeyPressed(sf::Keyboard::Key::Q));
+        CHECK(!snapshot.isKeyPressed(sf::Keyboard::Scan::A));
+
+        snapshot.applyEvent(sf::Event::MouseButtonReleased{sf::Mouse::Button::Middle, {9, 10}});
+        CHECK(!snapshot.isButtonPressed(sf::Mouse::Button::Middle));
+        CHECK(snapshot.getRelativeMousePosition() == sf::Vector2i{9, 10});
+
+        snapshot.applyEvent(sf::Event::KeyPressed{sf::Keyboard::Key::Space, sf::Keyboard::Scan::Space});
+        snapshot.applyEvent(sf::Event::MouseButtonPressed{sf::Mouse::Button::Left, {}});
+        snapshot.applyEvent(sf::Event::FocusLost{});
+        CHECK(!snapshot.isKeyPressed(sf::Keyboard::Key::Space));
+        CHECK(!snapshot.isKeyPressed(sf::Keyboard::Scan::Space));
+        CHECK(!snapshot.isButtonPressed(sf::Mouse::Button::Left));
+    }
+}
+
+TEST_CASE("[Window] sf::InputSnapshot (capture)" * doctest::skip(skipDisplayTests))
+{
+    const auto snapshot = sf::InputSnapshot::capture();
+
+    CHECK(snapshot.isKeyPressed(sf::Keyboard::Key::W) == sf::Keyboard::isKeyPressed(sf::Keyboard::Key::W));
+    CHECK(snapshot.isKeyPressed(sf::Keyboard::Scan::W) == sf::Keyboard::isKeyPressed(sf::Keyboard::Scan::W));
+    CHECK(snapshot.getRelativeMousePosition() == snapshot.getMousePosition());
+}
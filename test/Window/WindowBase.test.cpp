@@ -8,6 +8,7 @@
 
 #include <Doctest.hpp>
 
+#include <AllocationCounter.hpp>
 #include <CommonTraits.hpp>
 #include <StringifyOptionalUtil.hpp>
 #include <SystemUtil.hpp>
@@ -84,6 +85,24 @@ TEST_CASE("[Window] sf::WindowBase" * doctest::skip(skipDisplayTests))
         }
     }
 
+    SECTION("handleEvents()")
+    {
+        sf::WindowBase windowBase(windowContext, {.size{360u, 240u}, .title = "WindowBase Tests"});
+
+        // Let the window settle and drain the initial burst of events
+        for (int i = 0; i < 10; ++i)
+            windowBase.handleEvents([](const auto&) {});
+
+        CHECK(!windowBase.pollEvent().hasValue());
+
+        const sf::base::SizeT allocationsBefore = getAllocationCount();
+
+        for (int i = 0; i < 100; ++i)
+            windowBase.handleEvents([](sf::Event::Closed) {}, [](const auto&) {});
+
+        CHECK(getAllocationCount() == allocationsBefore);
+    }
+
     SECTION("Set/get position")
     {
         sf::WindowBase windowBase(windowContext, {.size{360u, 240u}, .title = "WindowBase Tests"});
@@ -162,5 +181,10 @@ TEST_CASE("[Window] sf::WindowBase" * doctest::skip(skipDisplayTests))
 
         // Should compile if user provides both a specific handler and a catch-all
         windowBase.pollAndHandleEvents([](sf::Event::Closed) {}, [](const auto&) {});
+
+        // Same for the batch version
+        windowBase.handleEvents([](sf::Event::Closed) {});
+        windowBase.handleEvents([](const auto&) {});
+        windowBase.handleEvents([](sf::Event::Closed) {}, [](const auto&) {});
     };
 }